@@ -6,6 +6,7 @@ import json
 import sys
 import re
 import sys
+import struct
 from datetime import date
 
 ## https://riscv.org/wp-content/uploads/2017/05/riscv-spec-v2.2.pdf
@@ -16,10 +17,503 @@ registers_vec = [ 'vd', 'vs1', 'vs2', 'vs3' ]
 
 registers_flt = [ 'fd', 'fs1', 'fs2', 'fs3' ]
 
+# first operand found defines how the immediate is built (vsetivli carries both zimm10 and zimm)
+immediate_kinds = [
+	('jimm20', 'RISCV_IMM_J'),
+	('bimm12hi', 'RISCV_IMM_B'),
+	('imm12hi', 'RISCV_IMM_S'),
+	('imm20', 'RISCV_IMM_U'),
+	('imm12', 'RISCV_IMM_I'),
+	('shamt', 'RISCV_IMM_UIMM6'),
+	('shamtw', 'RISCV_IMM_UIMM5'),
+	('simm5', 'RISCV_IMM_SIMM5'),
+	('zimm10', 'RISCV_IMM_ZIMM10'),
+	('zimm11', 'RISCV_IMM_ZIMM11'),
+	('zimm', 'RISCV_IMM_ZIMM'),
+	('imm6', 'RISCV_IMM_UIMM6'),
+	('imm5', 'RISCV_IMM_UIMM5'),
+	('imm4', 'RISCV_IMM_UIMM4'),
+	('rnum', 'RISCV_IMM_UIMM4'),
+	('imm3', 'RISCV_IMM_UIMM3'),
+	('imm2', 'RISCV_IMM_UIMM2'),
+	('bs', 'RISCV_IMM_BS'),
+]
+
+# branch-free expressions building each immediate kind from the instruction word
+immediate_expressions = [
+	('RISCV_IMM_I', '(st32)data >> 20'),
+	('RISCV_IMM_S', '((st32)(data & 0xfe000000) >> 20) | ((data >> 7) & 0x1f)'),
+	('RISCV_IMM_B', '((st32)(data & 0x80000000) >> 19) | ((data & 0x80) << 4) | ((data >> 20) & 0x7e0) | ((data >> 7) & 0x1e)'),
+	('RISCV_IMM_U', '(st32)(data & 0xfffff000)'),
+	('RISCV_IMM_J', '((st32)(data & 0x80000000) >> 11) | (data & 0xff000) | ((data >> 9) & 0x800) | ((data >> 20) & 0x7fe)'),
+	('RISCV_IMM_CSR', 'data >> 20'),
+	('RISCV_IMM_UIMM2', '(data >> 20) & 0x3'),
+	('RISCV_IMM_UIMM3', '(data >> 20) & 0x7'),
+	('RISCV_IMM_UIMM4', '(data >> 20) & 0xf'),
+	('RISCV_IMM_UIMM5', '(data >> 20) & 0x1f'),
+	('RISCV_IMM_UIMM6', '(data >> 20) & 0x3f'),
+	('RISCV_IMM_ZIMM', '(data >> 15) & 0x1f'),
+	('RISCV_IMM_SIMM5', '(st32)(data << 12) >> 27'),
+	('RISCV_IMM_ZIMM10', '(data >> 20) & 0x3ff'),
+	('RISCV_IMM_ZIMM11', '(data >> 20) & 0x7ff'),
+	('RISCV_IMM_BS', 'data >> 30'),
+]
+
+# the same immediates as (signed, [(shift, width, position)]) pieces, used by the binary tables
+immediate_pieces = [
+	('RISCV_IMM_I', True, [(20, 12, 0)]),
+	('RISCV_IMM_S', True, [(25, 7, 5), (7, 5, 0)]),
+	('RISCV_IMM_B', True, [(31, 1, 12), (7, 1, 11), (25, 6, 5), (8, 4, 1)]),
+	('RISCV_IMM_U', True, [(12, 20, 12)]),
+	('RISCV_IMM_J', True, [(31, 1, 20), (12, 8, 12), (20, 1, 11), (21, 10, 1)]),
+	('RISCV_IMM_CSR', False, [(20, 12, 0)]),
+	('RISCV_IMM_UIMM2', False, [(20, 2, 0)]),
+	('RISCV_IMM_UIMM3', False, [(20, 3, 0)]),
+	('RISCV_IMM_UIMM4', False, [(20, 4, 0)]),
+	('RISCV_IMM_UIMM5', False, [(20, 5, 0)]),
+	('RISCV_IMM_UIMM6', False, [(20, 6, 0)]),
+	('RISCV_IMM_ZIMM', False, [(15, 5, 0)]),
+	('RISCV_IMM_SIMM5', True, [(15, 5, 0)]),
+	('RISCV_IMM_ZIMM10', False, [(20, 10, 0)]),
+	('RISCV_IMM_ZIMM11', False, [(20, 11, 0)]),
+	('RISCV_IMM_BS', False, [(30, 2, 0)]),
+]
+
+# RISCVBlobOperandKind, how the operands of the binary tables are rendered
+blob_operand_kinds = ['GPR', 'FPR', 'VEC', 'IMM', 'TARGET', 'HEX', 'CSR', 'CHOICE']
+
+# register names by number
+register_names_std = [
+	'zero', 'ra', 'sp', 'gp', 'tp', 't0', 't1', 't2', 's0', 's1', 'a0', 'a1', 'a2', 'a3', 'a4', 'a5',
+	'a6', 'a7', 's2', 's3', 's4', 's5', 's6', 's7', 's8', 's9', 's10', 's11', 't3', 't4', 't5', 't6',
+]
+register_names_flt = ['f{}'.format(x) for x in range(32)]
+register_names_vec = ['v{}'.format(x) for x in range(32)]
+
+# split or scrambled immediates rebuilt as a whole in the text decoders, lo parts are folded in the hi ones
+fused_immediates = {
+	'imm12': 'RISCV_IMM_I', 'imm12hi': 'RISCV_IMM_S', 'bimm12hi': 'RISCV_IMM_B', 'jimm20': 'RISCV_IMM_J',
+}
+
+# first regex matching the mnemonic defines the RZ_ANALYSIS_OP_TYPE_*
+operation_types = [
+	(r'^jal$', 'JMP'),
+	(r'^jalr$', 'RJMP'),
+	(r'^b(eq|ne|lt|ge)u?$', 'CJMP'),
+	(r'^(ecall|scall)$', 'SWI'),
+	(r'^(ebreak|sbreak)$', 'TRAP'),
+	(r'^[smd]ret$', 'RET'),
+	(r'^(fence|pause|sfence|hfence|sinval|hinval|cbo)', 'SYNC'),
+	(r'^prefetch', 'NOP'),
+	(r'^(lr\.|l[bhwd]u?$|fl[hwdq]$|hlvx?\.|vl(s?e\d|[uo]xei|\dr|m\.))', 'LOAD'),
+	(r'^(sc\.|s[bhwd]$|fs[hwdq]$|hsv\.|vs(s?e\d|[uo]xei|\dr|m\.))', 'STORE'),
+	(r'^amo', 'XCHG'),
+	(r'^lui$', 'MOV'),
+	(r'^auipc$', 'LEA'),
+	(r'^(csr|f[rs](csr|rm|flags)|rd(cycle|time|instret))', 'MOV'),
+	(r'^(v|vf|f)?mv', 'MOV'),
+	(r'^(v|vf|vw|vfw|f)?n?m(add|sub|acc|sac)', 'MUL'),
+	(r'^(v|vf|vw|vfw|vs|va|f|k|uk|r|ur|sh[123])?add', 'ADD'),
+	(r'^(v|vf|vw|vfw|vs|vss|va|vr|vfr|f|k|uk|r|ur)?sub', 'SUB'),
+	(r'mul', 'MUL'),
+	(r'div', 'DIV'),
+	(r'rem', 'MOD'),
+	(r'^(slt|vms(eq|ne|lt|le|gt|ge)|vmf(eq|ne|lt|le|gt|ge)|f(eq|lt|le)\.|[su]?cmp)', 'CMP'),
+	(r'^(v|k|kn)?sll', 'SHL'),
+	(r'^(v|vn|vs)?srl', 'SHR'),
+	(r'^(v|vn|vs)?sra', 'SAR'),
+	(r'^rol', 'ROL'),
+	(r'^ror', 'ROR'),
+	(r'^(vm?)?xor', 'XOR'),
+	(r'^(vm?)?or', 'OR'),
+	(r'^(vm?)?and', 'AND'),
+	(r'^(aes|sha|sm[34])', 'CRYPTO'),
+]
+
+operation_families = {
+	'rv32f': 'FPU', 'rv64f': 'FPU', 'rv32d': 'FPU', 'rv64d': 'FPU',
+	'rv32q': 'FPU', 'rv64q': 'FPU', 'rv32zfh': 'FPU', 'rv64zfh': 'FPU',
+	'rv32d-zfh': 'FPU', 'rv32q-zfh': 'FPU',
+	'rvv': 'SSE', 'rvp': 'MMX',
+	'rv32a': 'THREAD', 'rv64a': 'THREAD',
+	'rv32k': 'CRYPTO', 'rv64k': 'CRYPTO', 'rvk': 'CRYPTO',
+	'rv32h': 'VIRT', 'rv64h': 'VIRT',
+	'svinval': 'PRIV',
+}
+
+branch_conditions = {
+	'beq': 'EQ', 'bne': 'NE', 'blt': 'LT', 'bge': 'GE', 'bltu': 'LO', 'bgeu': 'HS',
+}
+
+# register operands and the RISCV_REGS_* role they have, vs3 is the data of vector stores
+register_roles = {
+	'rd': 'GPR_RD', 'rs1': 'GPR_RS1', 'rs2': 'GPR_RS2', 'rs3': 'GPR_RS3',
+	'fd': 'FPR_RD', 'fs1': 'FPR_RS1', 'fs2': 'FPR_RS2', 'fs3': 'FPR_RS3',
+	'vd': 'VEC_RD', 'vs1': 'VEC_RS1', 'vs2': 'VEC_RS2', 'vs3': 'VEC_RD_USE', 'vm': 'VEC_VM',
+}
+
+# bit order of the RISCV_REGS_* roles
+register_role_bits = [
+	'GPR_RD', 'GPR_RS1', 'GPR_RS2', 'GPR_RS3', 'FPR_RD', 'FPR_RS1', 'FPR_RS2', 'FPR_RS3',
+	'VEC_RD', 'VEC_RS1', 'VEC_RS2', 'VEC_RD_USE', 'VEC_VM',
+]
+
+# vector accumulators read vd before writing it
+vector_accumulators = r'^vf?w?n?m(acc|sac|add|sub)'
+
+# register group spanned by the vd/vs3, vs1 and vs2 operands, the first matching rule is used
+#   LMUL  group of LMUL registers         WIDE  group of 2 * LMUL registers
+#   ONE   one register, follows vta/vma    MASK  one register, always tail agnostic
+#   FRACn group of LMUL / n registers      EEW   group of EEW / SEW * LMUL registers
+#   WHOLE registers set by the mnemonic, the configuration is ignored
+vector_groups = [
+	(r'^v(l\d+re?\d*|s\d+r)\.v$', 'WHOLE', 'LMUL', 'LMUL'),
+	(r'^vmv(\d|nf)r\.v$', 'WHOLE', 'LMUL', 'WHOLE'),
+	(r'^v[ls](m|e1)\.v$', 'MASK', 'LMUL', 'LMUL'),
+	(r'^(v[ls][ou]?xei|vamo\w+ei)\d+\.v$', 'LMUL', 'LMUL', 'EEW'),
+	(r'^v[ls]s?e\d+(ff)?\.v$', 'EEW', 'LMUL', 'LMUL'),
+	(r'^vf?mv\.[xf]\.s$', 'LMUL', 'LMUL', 'ONE'),
+	(r'^vf?mv\.s\.[xf]$', 'ONE', 'LMUL', 'LMUL'),
+	(r'\.vs$', 'ONE', 'ONE', 'LMUL'),
+	(r'\.mm$', 'MASK', 'MASK', 'MASK'),
+	(r'^v(cpop|first|ms[bio]f)\.m$', 'MASK', 'LMUL', 'MASK'),
+	(r'^viota\.m$', 'LMUL', 'LMUL', 'MASK'),
+	(r'^vcompress\.vm$', 'LMUL', 'MASK', 'LMUL'),
+	(r'^vm(s|f|adc)', 'MASK', 'LMUL', 'LMUL'),
+	(r'^v(n(sr|clip)|fncvt)', 'LMUL', 'LMUL', 'WIDE'),
+	(r'^vf?w.*\.w[vxf]$', 'WIDE', 'LMUL', 'WIDE'),
+	(r'^vf?w', 'WIDE', 'LMUL', 'LMUL'),
+	(r'^v[sz]ext\.vf2$', 'LMUL', 'LMUL', 'FRAC2'),
+	(r'^v[sz]ext\.vf4$', 'LMUL', 'LMUL', 'FRAC4'),
+	(r'^v[sz]ext\.vf8$', 'LMUL', 'LMUL', 'FRAC8'),
+	(r'^vrgatherei16', 'LMUL', 'EEW', 'LMUL'),
+	(r'', 'LMUL', 'LMUL', 'LMUL'),
+]
+
+# major opcodes decoded through buckets keyed by the (shift, width) fields, the other ones are scanned.
+# buckets with more than two candidates are split again by the nested fields, when given.
+subtables = [
+	('rvv_arith', 'OP-V, keyed by funct3 (OPIVV..OPCFG) and funct6', [0x57], [(12, 3), (26, 6)], []),
+	('rvv_memory', 'LOAD-FP/STORE-FP, keyed by load/store, width, lumop/sumop and mew/mop', [0x07, 0x27], [(5, 1), (12, 3), (20, 5), (26, 3)], []),
+	('rvp', 'OP-P, keyed by funct3 and funct7, unary operations by funct5', [0x77], [(12, 3), (25, 7)], [(20, 5)]),
+]
+
+# bit position and mask of the fields an alias predicate can check
+alias_fields = {
+	'rd': (7, 0x1f), 'rs1': (15, 0x1f), 'rs2': (20, 0x1f),
+	'imm': (20, 0xfff), 'csr': (20, 0xfff),
+	'fm': (28, 0xf), 'pred': (24, 0xf), 'succ': (20, 0xf),
+}
+
+# printf format and value of each alias operand
+alias_operands = {
+	'rd': ('%s', 'registers_std[dec->rd]'),
+	'rs1': ('%s', 'registers_std[dec->rs1]'),
+	'rs2': ('%s', 'registers_std[dec->rs2]'),
+	'fd': ('%s', 'registers_flt[dec->rd]'),
+	'fs1': ('%s', 'registers_flt[dec->rs1]'),
+	'imm': ('%" PFMT64d "', 'dec->imm'),
+	'target': ('0x%" PFMT64x "', 'pc + dec->imm'),
+	'csr': ('%s', 'riscv_csr_operand(dec->imm, csr_hex)'),
+	'zimm': ('0x%x', 'dec->rs1'),
+}
+
+# pseudo instructions rendered in place of the decoded one when all the field
+# predicates match ('same' requires rs1 == rs2); within the same instruction
+# the first match wins, so the most specific aliases come first.
+aliases = [
+	('addi', {'rd': 0, 'rs1': 0, 'imm': 0}, 'nop'),
+	('addi', {'rs1': 0}, 'li {rd}, {imm}'),
+	('addi', {'imm': 0}, 'mv {rd}, {rs1}'),
+	('addiw', {'imm': 0}, 'sext.w {rd}, {rs1}'),
+	('xori', {'imm': -1}, 'not {rd}, {rs1}'),
+	('sub', {'rs1': 0}, 'neg {rd}, {rs2}'),
+	('subw', {'rs1': 0}, 'negw {rd}, {rs2}'),
+	('sltiu', {'imm': 1}, 'seqz {rd}, {rs1}'),
+	('sltu', {'rs1': 0}, 'snez {rd}, {rs2}'),
+	('slt', {'rs2': 0}, 'sltz {rd}, {rs1}'),
+	('slt', {'rs1': 0}, 'sgtz {rd}, {rs2}'),
+	('beq', {'rs2': 0}, 'beqz {rs1}, {target}'),
+	('bne', {'rs2': 0}, 'bnez {rs1}, {target}'),
+	('bge', {'rs1': 0}, 'blez {rs2}, {target}'),
+	('bge', {'rs2': 0}, 'bgez {rs1}, {target}'),
+	('blt', {'rs2': 0}, 'bltz {rs1}, {target}'),
+	('blt', {'rs1': 0}, 'bgtz {rs2}, {target}'),
+	('jal', {'rd': 0}, 'j {target}'),
+	('jal', {'rd': 1}, 'jal {target}'),
+	('jalr', {'rd': 0, 'rs1': 1, 'imm': 0}, 'ret'),
+	('jalr', {'rd': 0, 'imm': 0}, 'jr {rs1}'),
+	('jalr', {'rd': 1, 'imm': 0}, 'jalr {rs1}'),
+	('fence', {'fm': 8, 'pred': 3, 'succ': 3}, 'fence.tso'),
+	('fence', {'fm': 0, 'pred': 1, 'succ': 0, 'rd': 0, 'rs1': 0}, 'pause'),
+	('csrrs', {'rs1': 0, 'csr': 0xc00}, 'rdcycle {rd}'),
+	('csrrs', {'rs1': 0, 'csr': 0xc01}, 'rdtime {rd}'),
+	('csrrs', {'rs1': 0, 'csr': 0xc02}, 'rdinstret {rd}'),
+	('csrrs', {'rs1': 0, 'csr': 0xc80}, 'rdcycleh {rd}'),
+	('csrrs', {'rs1': 0, 'csr': 0xc81}, 'rdtimeh {rd}'),
+	('csrrs', {'rs1': 0, 'csr': 0xc82}, 'rdinstreth {rd}'),
+	('csrrs', {'rs1': 0, 'csr': 0x001}, 'frflags {rd}'),
+	('csrrs', {'rs1': 0, 'csr': 0x002}, 'frrm {rd}'),
+	('csrrs', {'rs1': 0, 'csr': 0x003}, 'frcsr {rd}'),
+	('csrrs', {'rs1': 0}, 'csrr {rd}, {csr}'),
+	('csrrs', {'rd': 0}, 'csrs {csr}, {rs1}'),
+	('csrrc', {'rd': 0}, 'csrc {csr}, {rs1}'),
+	('csrrw', {'rd': 0, 'csr': 0x001}, 'fsflags {rs1}'),
+	('csrrw', {'csr': 0x001}, 'fsflags {rd}, {rs1}'),
+	('csrrw', {'rd': 0, 'csr': 0x002}, 'fsrm {rs1}'),
+	('csrrw', {'csr': 0x002}, 'fsrm {rd}, {rs1}'),
+	('csrrw', {'rd': 0, 'csr': 0x003}, 'fscsr {rs1}'),
+	('csrrw', {'csr': 0x003}, 'fscsr {rd}, {rs1}'),
+	('csrrw', {'rd': 0}, 'csrw {csr}, {rs1}'),
+	('csrrwi', {'rd': 0, 'csr': 0x001}, 'fsflagsi {zimm}'),
+	('csrrwi', {'csr': 0x001}, 'fsflagsi {rd}, {zimm}'),
+	('csrrwi', {'rd': 0, 'csr': 0x002}, 'fsrmi {zimm}'),
+	('csrrwi', {'csr': 0x002}, 'fsrmi {rd}, {zimm}'),
+	('csrrwi', {'rd': 0}, 'csrwi {csr}, {zimm}'),
+	('csrrsi', {'rd': 0}, 'csrsi {csr}, {zimm}'),
+	('csrrci', {'rd': 0}, 'csrci {csr}, {zimm}'),
+	('fsgnj.s', {'same': True}, 'fmv.s {fd}, {fs1}'),
+	('fsgnjn.s', {'same': True}, 'fneg.s {fd}, {fs1}'),
+	('fsgnjx.s', {'same': True}, 'fabs.s {fd}, {fs1}'),
+	('fsgnj.d', {'same': True}, 'fmv.d {fd}, {fs1}'),
+	('fsgnjn.d', {'same': True}, 'fneg.d {fd}, {fs1}'),
+	('fsgnjx.d', {'same': True}, 'fabs.d {fd}, {fs1}'),
+]
+
+# RzIL templates: nested tuples (operation, [attribute], operands...) serialized to
+# postfix code. The leaves below are the holes patched by riscv_il() when lifting:
+# rs1/rs2 (x0 reads as zero), fs1/fs2/fs3, imm, next (pc + size), target (pc + imm)
+il_leaves = [ 'rs1', 'rs2', 'fs1', 'fs2', 'fs3', 'imm', 'next', 'target' ]
+
+# operation: (arity, result), the attribute (bits, float size or name) is not an operand
+il_operations = {
+	'const': (0, 'pure'),
+	'var': (0, 'pure'),
+	'signed': (1, 'pure'),
+	'unsigned': (1, 'pure'),
+	'load': (1, 'pure'),
+	'not': (1, 'pure'),
+	'neg': (1, 'pure'),
+	'inv': (1, 'pure'),
+	'bool': (1, 'pure'),
+	'float': (1, 'pure'),
+	'fbits': (1, 'pure'),
+	'fneg': (1, 'pure'),
+	'fsqrt': (1, 'pure'),
+	'ftoint': (1, 'pure'),
+	'ftosint': (1, 'pure'),
+	'itof': (1, 'pure'),
+	'sitof': (1, 'pure'),
+	'fconv': (1, 'pure'),
+	'add': (2, 'pure'),
+	'sub': (2, 'pure'),
+	'mul': (2, 'pure'),
+	'div': (2, 'pure'),
+	'sdiv': (2, 'pure'),
+	'mod': (2, 'pure'),
+	'smod': (2, 'pure'),
+	'and': (2, 'pure'),
+	'or': (2, 'pure'),
+	'xor': (2, 'pure'),
+	'shl': (2, 'pure'),
+	'shr': (2, 'pure'),
+	'sar': (2, 'pure'),
+	'eq': (2, 'pure'),
+	'ult': (2, 'pure'),
+	'slt': (2, 'pure'),
+	'fadd': (2, 'pure'),
+	'fsub': (2, 'pure'),
+	'fmul': (2, 'pure'),
+	'fdiv': (2, 'pure'),
+	'flt': (2, 'pure'),
+	'fle': (2, 'pure'),
+	'feq': (2, 'pure'),
+	'ite': (3, 'pure'),
+	'fmad': (3, 'pure'),
+	# effects must stay last, riscv_il() tells them apart by their value
+	'setrd': (1, 'effect'),
+	'setfd': (1, 'effect'),
+	'setl': (1, 'effect'),
+	'store': (2, 'effect'),
+	'jmp': (1, 'effect'),
+	'branch': (1, 'effect'),
+	'seq': (2, 'effect'),
+	'nop': (0, 'effect'),
+	'goto': (0, 'effect'),
+}
+
+# operations carrying an attribute in the code argument
+il_attributes = [ 'const', 'var', 'signed', 'unsigned', 'load', 'float', 'ftoint', 'ftosint', 'itof', 'sitof', 'fconv', 'setl', 'goto' ]
+
+def il_const(bits, value):
+	return ('const', bits, value & ((1 << bits) - 1))
+
+def il_low32(x):
+	return ('unsigned', 32, x)
+
+def il_sext(x):
+	return ('signed', 64, x)
+
+def il_setrd(x):
+	return ('setrd', x)
+
+def il_seq(*effects):
+	if len(effects) == 1:
+		return effects[0]
+	return ('seq', effects[0], il_seq(*effects[1:]))
+
+il_address = ('add', 'rs1', 'imm')
+il_nanbox = il_const(64, 0xffffffff00000000)
+
+il_templates = {
+	'lui': il_setrd('imm'),
+	'auipc': il_setrd('target'),
+	'jal': il_seq(il_setrd('next'), ('jmp', 'target')),
+	'jalr': il_seq(('setl', 'tgt', ('and', il_address, il_const(64, ~1))), il_setrd('next'), ('jmp', ('var', 'tgt'))),
+	'beq': ('branch', ('eq', 'rs1', 'rs2')),
+	'bne': ('branch', ('inv', ('eq', 'rs1', 'rs2'))),
+	'blt': ('branch', ('slt', 'rs1', 'rs2')),
+	'bge': ('branch', ('inv', ('slt', 'rs1', 'rs2'))),
+	'bltu': ('branch', ('ult', 'rs1', 'rs2')),
+	'bgeu': ('branch', ('inv', ('ult', 'rs1', 'rs2'))),
+	'lb': il_setrd(il_sext(('load', 8, il_address))),
+	'lh': il_setrd(il_sext(('load', 16, il_address))),
+	'lw': il_setrd(il_sext(('load', 32, il_address))),
+	'ld': il_setrd(('load', 64, il_address)),
+	'lbu': il_setrd(('unsigned', 64, ('load', 8, il_address))),
+	'lhu': il_setrd(('unsigned', 64, ('load', 16, il_address))),
+	'lwu': il_setrd(('unsigned', 64, ('load', 32, il_address))),
+	'sb': ('store', il_address, ('unsigned', 8, 'rs2')),
+	'sh': ('store', il_address, ('unsigned', 16, 'rs2')),
+	'sw': ('store', il_address, il_low32('rs2')),
+	'sd': ('store', il_address, 'rs2'),
+	'slti': il_setrd(('bool', ('slt', 'rs1', 'imm'))),
+	'sltiu': il_setrd(('bool', ('ult', 'rs1', 'imm'))),
+	'slt': il_setrd(('bool', ('slt', 'rs1', 'rs2'))),
+	'sltu': il_setrd(('bool', ('ult', 'rs1', 'rs2'))),
+	'slli': il_setrd(('shl', 'rs1', 'imm')),
+	'srli': il_setrd(('shr', 'rs1', 'imm')),
+	'srai': il_setrd(('sar', 'rs1', 'imm')),
+	'sll': il_setrd(('shl', 'rs1', ('and', 'rs2', il_const(64, 63)))),
+	'srl': il_setrd(('shr', 'rs1', ('and', 'rs2', il_const(64, 63)))),
+	'sra': il_setrd(('sar', 'rs1', ('and', 'rs2', il_const(64, 63)))),
+	'addiw': il_setrd(il_sext(('add', il_low32('rs1'), il_low32('imm')))),
+	'slliw': il_setrd(il_sext(('shl', il_low32('rs1'), il_low32('imm')))),
+	'srliw': il_setrd(il_sext(('shr', il_low32('rs1'), il_low32('imm')))),
+	'sraiw': il_setrd(il_sext(('sar', il_low32('rs1'), il_low32('imm')))),
+	'sllw': il_setrd(il_sext(('shl', il_low32('rs1'), ('and', il_low32('rs2'), il_const(32, 31))))),
+	'srlw': il_setrd(il_sext(('shr', il_low32('rs1'), ('and', il_low32('rs2'), il_const(32, 31))))),
+	'sraw': il_setrd(il_sext(('sar', il_low32('rs1'), ('and', il_low32('rs2'), il_const(32, 31))))),
+	'mulh': il_setrd(('unsigned', 64, ('shr', ('mul', ('signed', 128, 'rs1'), ('signed', 128, 'rs2')), il_const(128, 64)))),
+	'mulhsu': il_setrd(('unsigned', 64, ('shr', ('mul', ('signed', 128, 'rs1'), ('unsigned', 128, 'rs2')), il_const(128, 64)))),
+	'mulhu': il_setrd(('unsigned', 64, ('shr', ('mul', ('unsigned', 128, 'rs1'), ('unsigned', 128, 'rs2')), il_const(128, 64)))),
+	'fence': ('nop',),
+	'fence.i': ('nop',),
+	'sfence.vma': ('nop',),
+	'wfi': ('nop',),
+	'ecall': ('goto', 'ecall'),
+	'ebreak': ('goto', 'ebreak'),
+}
+
+for name, op in [('add', 'add'), ('sub', 'sub'), ('xor', 'xor'), ('or', 'or'), ('and', 'and'), ('mul', 'mul')]:
+	il_templates[name] = il_setrd((op, 'rs1', 'rs2'))
+	if name in ['add', 'xor', 'or', 'and']:
+		il_templates[name + 'i'] = il_setrd((op, 'rs1', 'imm'))
+	if name in ['add', 'sub', 'mul']:
+		il_templates[name + 'w'] = il_setrd(il_sext((op, il_low32('rs1'), il_low32('rs2'))))
+
+# division by zero and signed overflow do not trap, the results are defined by the isa
+for suffix, bits, a, b in [('', 64, 'rs1', 'rs2'), ('w', 32, il_low32('rs1'), il_low32('rs2'))]:
+	extend = il_sext if bits == 32 else lambda x: x
+	zero = ('eq', b, il_const(bits, 0))
+	minus = ('eq', b, il_const(bits, -1))
+	il_templates['div' + suffix] = il_setrd(extend(('ite', zero, il_const(bits, -1), ('ite', minus, ('neg', a), ('sdiv', a, b)))))
+	il_templates['divu' + suffix] = il_setrd(extend(('ite', zero, il_const(bits, -1), ('div', a, b))))
+	il_templates['rem' + suffix] = il_setrd(extend(('ite', zero, a, ('ite', minus, il_const(bits, 0), ('smod', a, b)))))
+	il_templates['remu' + suffix] = il_setrd(extend(('ite', zero, a, ('mod', a, b))))
+
+# reservations are not modeled, sc always succeeds
+for suffix, bits in [('w', 32), ('d', 64)]:
+	narrow = il_low32 if bits == 32 else lambda x: x
+	extend = il_sext if bits == 32 else lambda x: x
+	value = ('var', 'val')
+	rs2 = extend(narrow('rs2'))
+	results = {
+		'add': ('add', value, 'rs2'),
+		'xor': ('xor', value, 'rs2'),
+		'or': ('or', value, 'rs2'),
+		'and': ('and', value, 'rs2'),
+		'swap': 'rs2',
+		'min': ('ite', ('slt', value, rs2), value, rs2),
+		'max': ('ite', ('slt', value, rs2), rs2, value),
+		'minu': ('ite', ('ult', value, rs2), value, rs2),
+		'maxu': ('ite', ('ult', value, rs2), rs2, value),
+	}
+	for op, result in results.items():
+		il_templates['amo' + op + '.' + suffix] = il_seq(('setl', 'val', extend(('load', bits, 'rs1'))), ('store', 'rs1', narrow(result)), il_setrd(value))
+	il_templates['lr.' + suffix] = il_setrd(extend(('load', bits, 'rs1')))
+	il_templates['sc.' + suffix] = il_seq(('store', 'rs1', narrow('rs2')), il_setrd(il_const(64, 0)))
+
+# single precision values are nan-boxed in the 64 bits f registers
+for suffix, bits in [('s', 32), ('d', 64)]:
+	narrow = il_low32 if bits == 32 else lambda x: x
+	sign = il_const(bits, 1 << (bits - 1))
+	magnitude = il_const(bits, (1 << (bits - 1)) - 1)
+	def setf_bits(x, bits=bits):
+		return ('setfd', ('or', il_nanbox, ('unsigned', 64, x)) if bits == 32 else x)
+	def setf(x, setf_bits=setf_bits):
+		return setf_bits(('fbits', x))
+	f1, f2, f3 = map(lambda x: ('float', bits, narrow(x)), ['fs1', 'fs2', 'fs3'])
+	for op in ['add', 'sub', 'mul', 'div']:
+		il_templates['f' + op + '.' + suffix] = setf(('f' + op, f1, f2))
+	il_templates['fsqrt.' + suffix] = setf(('fsqrt', f1))
+	il_templates['fmin.' + suffix] = setf(('ite', ('flt', f1, f2), f1, f2))
+	il_templates['fmax.' + suffix] = setf(('ite', ('flt', f2, f1), f1, f2))
+	il_templates['fmadd.' + suffix] = setf(('fmad', f1, f2, f3))
+	il_templates['fmsub.' + suffix] = setf(('fmad', f1, f2, ('fneg', f3)))
+	il_templates['fnmsub.' + suffix] = setf(('fmad', ('fneg', f1), f2, f3))
+	il_templates['fnmadd.' + suffix] = setf(('fmad', ('fneg', f1), f2, ('fneg', f3)))
+	il_templates['fsgnj.' + suffix] = setf_bits(('or', ('and', narrow('fs1'), magnitude), ('and', narrow('fs2'), sign)))
+	il_templates['fsgnjn.' + suffix] = setf_bits(('or', ('and', narrow('fs1'), magnitude), ('and', ('not', narrow('fs2')), sign)))
+	il_templates['fsgnjx.' + suffix] = setf_bits(('xor', narrow('fs1'), ('and', narrow('fs2'), sign)))
+	for op in ['eq', 'lt', 'le']:
+		il_templates['f' + op + '.' + suffix] = il_setrd(('bool', ('f' + op, f1, f2)))
+	il_templates['fcvt.w.' + suffix] = il_setrd(il_sext(('ftosint', 32, f1)))
+	il_templates['fcvt.wu.' + suffix] = il_setrd(il_sext(('ftoint', 32, f1)))
+	il_templates['fcvt.l.' + suffix] = il_setrd(('ftosint', 64, f1))
+	il_templates['fcvt.lu.' + suffix] = il_setrd(('ftoint', 64, f1))
+	il_templates['fcvt.' + suffix + '.w'] = setf(('sitof', bits, il_low32('rs1')))
+	il_templates['fcvt.' + suffix + '.wu'] = setf(('itof', bits, il_low32('rs1')))
+	il_templates['fcvt.' + suffix + '.l'] = setf(('sitof', bits, 'rs1'))
+	il_templates['fcvt.' + suffix + '.lu'] = setf(('itof', bits, 'rs1'))
+	il_templates['fl' + ('w' if bits == 32 else 'd')] = setf_bits(('load', bits, il_address))
+	il_templates['fs' + ('w' if bits == 32 else 'd')] = ('store', il_address, narrow('fs2'))
+	il_templates['fcvt.' + suffix + '.' + ('d' if bits == 32 else 's')] = setf(('fconv', bits, ('float', 96 - bits, 'fs1' if bits == 32 else il_low32('fs1'))))
+
+il_templates['fmv.x.w'] = il_setrd(il_sext(il_low32('fs1')))
+il_templates['fmv.w.x'] = ('setfd', ('or', il_nanbox, ('unsigned', 64, il_low32('rs1'))))
+il_templates['fmv.x.d'] = il_setrd('fs1')
+il_templates['fmv.d.x'] = ('setfd', 'rs1')
+
 instrtbl = []
 decoders = []
+decodernames = {}
 stucttbl = []
-stuctfmt = '\t{{ {name}, /* {pad}{mask} */ 0x{cbits:08x}, 0x{cmask:08x}, {decode} }},'
+analysistbl = []
+identifiers = []
+immediate_cases = []
+csrtbl = []
+csrpool = []
+csrindex = []
+csrenum = []
+aliastbl = []
+choicetables = {}
+renderers = []
+stuctfmt = '\t{{ 0x{cbits:08x}, 0x{cmask:08x}, {regs}, {imm} }}, /* {mnemonic}{pad} {mask} */'
+descfmt = '\t{{ {name}, {decode} }}, /* {mnemonic} */'
+aliasfmt = '\t{{ {ident}, {same}, 0x{mask:08x}, 0x{bits:08x}, {name}, {render} }}, /* {alias} */'
+analysisfmt = '\t{{ RZ_ANALYSIS_OP_TYPE_{optype}, RZ_ANALYSIS_OP_FAMILY_{family}, RZ_TYPE_COND_{cond}, {memsize} }}, /* {name} */'
+vshapefmt = '\t{{ {ident}, RISCV_VGROUP_{vd}, RISCV_VGROUP_{vs1}, RISCV_VGROUP_{vs2}, {eew}, {count}, {flags} }}, /* {name} */'
 
 def eprint(*args, **kwargs):
     print(*args, file=sys.stderr, **kwargs)
@@ -43,24 +537,32 @@ class Bitfield():
 
 	def format_value(self):
 		if self._type == 'immediate':
-			if self._name == 'jimm20':
+			if self._name in ['jimm20', 'bimm12hi']:
 				return '0x%" PFMT64x "'
+			elif self._name in fused_immediates:
+				return "%d"
 			return "0x%x"
-		elif self._type in ['register', 'suffix', 'choice', 'nfields']:
+		elif self._type in ['register', 'suffix', 'choice', 'nfields', 'csr']:
 			return "%s"
 		else:
 			sys.exit("unknown bitfield type: " + self._type)
 
-	def format_var(self):
+	def format_var(self, prefix=''):
 		if self._type == 'immediate':
-			if 'hi' in self._name:
+			if self._name == 'bimm12hi':
+				return "pc + bimm12"
+			elif 'hi' in self._name:
 				return self._name.replace("hi", "")
 			elif 'lo' in self._name:
 				return None
 			elif self._name == 'jimm20':
 				return "pc + jimm20"
-		elif self._type in ['suffix', 'nfields']:
+		elif self._type in ['choice', 'suffix']:
+			return "{}[{}]".format(self.choice_table(prefix), self._name)
+		elif self._type == 'nfields':
 			return None
+		elif self._type == 'csr':
+			return "riscv_csr_operand({}, csr_hex)".format(self._name)
 		elif self._type == 'register':
 			if self._name in registers_flt:
 				return "registers_flt[{}]".format(self._name)
@@ -69,14 +571,67 @@ class Bitfield():
 			return "registers_std[{}]".format(self._name)
 		return self._name
 
+	def choice_names(self, prefix=''):
+		# one name for each value of the field, the values without a name are printed as numbers
+		values = dict(map(lambda x: (x[1], x[0]), self._choices))
+		names = []
+		for value in range(1 << (self._between[0] - self._between[1] + 1)):
+			if value in values:
+				names.append(prefix + values[value] if values[value] else '')
+			elif self._type == 'suffix':
+				names.append('')
+			else:
+				names.append(prefix + str(value))
+		return names
+
+	def choice_table(self, prefix=''):
+		table = 'choices_' + self._name + ('_sep' if prefix else '')
+		choicetables[table] = self.choice_names(prefix)
+		return table
+
+	def blob_operand(self, prefix=''):
+		shift = self._between[1]
+		width = self._between[0] - shift + 1
+		choices = ()
+		if self._type == 'register':
+			if self._name in registers_flt:
+				kind = 'FPR'
+			elif self._name in registers_vec:
+				kind = 'VEC'
+			else:
+				kind = 'GPR'
+		elif self._type == 'immediate':
+			if self._name in ['jimm20', 'bimm12hi']:
+				kind = 'TARGET'
+			elif self._name in fused_immediates:
+				kind = 'IMM'
+			else:
+				kind = 'HEX'
+		elif self._type == 'csr':
+			kind = 'CSR'
+		elif self._type in ['choice', 'suffix']:
+			kind = 'CHOICE'
+			choices = tuple(self.choice_names(prefix))
+		else:
+			sys.exit("unknown blob operand type: " + self._type)
+		return (blob_operand_kinds.index(kind), shift, width, choices)
+
 	def extract(self):
+		if self._name in fused_immediates:
+			expression = dict(immediate_expressions)[fused_immediates[self._name]]
+			return "\tst32 {name} = {expr};\n".format(name=self.format_key(), expr=expression)
+		elif self._name in ['imm12lo', 'bimm12lo']:
+			return ""
 		extract = 1
 		for x in range(self._between[1], self._between[0]):
 			extract <<= 1
 			extract |= 1
 		extract <<= self._between[1]
 		shift = self._between[1]
-		return "\tut{bits} {name} = (data & 0x{ext:x}) >> {sh};\n".format(bits=self._bits, name=self._name, ext=extract, sh=shift)
+		field = "\tut{bits} {name} = (data & 0x{ext:x}) >> {sh};\n".format(bits=self._bits, name=self._name, ext=extract, sh=shift)
+		if self._type == 'csr':
+			field += "\tchar csr_hex[8];\n"
+		return field
 
 class Description():
 	def __init__(self, obj, bits):
@@ -85,24 +640,33 @@ class Description():
 		self._format = obj['format']
 		self._type = obj['type']
 
+	def printed(self):
+		# only the fields printed by the format are extracted
+		return list(filter(lambda x: ("{" + x.format_key() + "}") in self._format, self._bitfields))
+
 	def bitfields(self):
 		fields = ""
-		for bf in self._bitfields:
+		for bf in self.printed():
 			fields += bf.extract()
 		return fields
 
 	def format(self):
 		kargs = {'name':''}
 		variables = []
-		for bf in self._bitfields:
-			key = bf.format_key()
-			if ("{" + key + "}") not in self._format:
-				continue
-			kargs[key] = bf.format_value()
-			variables.append(bf.format_var())
+		# the separator of a choice is part of its names, like in the blob, to omit the dynamic rounding mode
+		fmt = self._format
+		separators = set()
+		for bf in self.printed():
+			if bf._type == 'choice' and (", {" + bf.format_key() + "}") in fmt:
+				fmt = fmt.replace(", {" + bf.format_key() + "}", "{" + bf.format_key() + "}")
+				separators.add(bf.format_key())
+		# the arguments follow the operands order of the format, not the bitfields one
+		for bf in sorted(self.printed(), key=lambda x: fmt.index("{" + x.format_key() + "}")):
+			kargs[bf.format_key()] = bf.format_value()
+			variables.append(bf.format_var(', ' if bf.format_key() in separators else ''))
 		variables = list(filter(None, variables))
-		fmt = self._format.format(**kargs)
-		return "\trz_str_buf_appendf(\"{fmt}\", {vars});\n".format(fmt=fmt, vars=', '.join(variables))
+		fmt = fmt.format(**kargs)
+		return "\trz_strbuf_appendf(sb, \"{fmt}\", {vars});\n".format(fmt=fmt, vars=', '.join(variables))
 	
 	def is_unique(self):
 		return " " not in self._format
@@ -119,104 +683,1595 @@ class Instr(object):
 		self._standard = obj['standard']
 		self._size = obj['size']
 		self._description = Description(obj['description'], self._size)
+		self._il = 0
+
+	def decoder_body(self):
+		body = self._description.bitfields()
+		body += "\trz_strbuf_set(sb, name);\n"
+		body += self._description.format()
+		body += "\treturn {};\n".format(int(self._size / 8))
+		return body
+
+	def decoder_name(self):
+		# decoders with the same body are shared, named after the operands they render
+		body = self.decoder_body()
+		if body not in decodernames:
+			operands = filter(lambda x: x not in ['name', 'suffix'], re.findall(r'{(\w+)}', self._description._format))
+			name = 'riscv_fmt_' + '_'.join(operands)
+			taken = set(decodernames.values())
+			suffix = 2
+			while name in taken:
+				name = re.sub(r'_\d+$', '', name) + '_' + str(suffix)
+				suffix += 1
+			decodernames[body] = name
+		return decodernames[body]
 
 	def decoder(self):
 		if self._description.is_unique():
 			return ""
 		func = ""
-		func += "static ut32 riscv_{0}_{1}(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {{\n".format(self._standard, self._bitmask)
-		func += self._description.bitfields()
-		func += "\trz_strbuf_set(sb, name);\n"
-		func += self._description.format()
-		func += "\treturn {};\n".format(int(self._size / 8))
+		func += "static ut32 {0}(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {{\n".format(self.decoder_name())
+		func += self.decoder_body()
 		func += "}\n"
 		return func
 
 
+	def identifier(self):
+		return 'RISCV_INS_' + re.sub('[^A-Za-z0-9]', '_', self._mnemonic).upper()
+
+	def immediate(self):
+		if self._description._type == 'csr':
+			return 'RISCV_IMM_CSR'
+		for operand, kind in immediate_kinds:
+			if operand in self._fields:
+				return kind
+		return 'RISCV_IMM_NONE'
+
+	def roles(self):
+		roles = [register_roles[f] for f in self._fields if f in register_roles]
+		if 'VEC_RD' in roles and re.search(vector_accumulators, self._mnemonic):
+			roles.append('VEC_RD_USE')
+		return roles
+
+	def registers(self):
+		roles = self.roles()
+		if len(roles) < 1:
+			return '0'
+		return ' | '.join(map(lambda x: 'RISCV_REGS_' + x, roles))
+
+	def blob_format(self, operand):
+		# the operands are replaced by the index returned by operand(), the name is not part of the format
+		fmt = self._description._format.replace('{name}', '')
+		bitfields = dict(map(lambda x: (x.format_key(), x), self._description._bitfields))
+		def replace(m):
+			bitfield = bitfields[m.group(2)]
+			# the separator of an optional choice (the dynamic rounding mode) is part of its names
+			prefix = m.group(1) or ''
+			if bitfield._type == 'choice':
+				return chr(operand(bitfield.blob_operand(prefix)))
+			return prefix + chr(operand(bitfield.blob_operand()))
+		return re.sub(r'(, )?{(\w+)}', replace, fmt)
+
+	def vector_shape(self):
+		if self._standard != 'rvv' or self._mnemonic.startswith('vset'):
+			return None
+		m = self._mnemonic
+		vd, vs1, vs2 = next((x[1], x[2], x[3]) for x in vector_groups if re.search(x[0], m))
+		eew = re.search(r'ei?(\d+)(ff)?\.v', m)
+		eew = int(eew.group(1)) if eew and int(eew.group(1)) >= 8 else 0
+		count = re.search(r'^v(l|s|mv)(\d)r', m)
+		count = int(count.group(2)) if count else 0
+		flags = []
+		if 'nf' in self._fields and vd != 'WHOLE':
+			flags.append('RISCV_VSHAPE_SEGMENT')
+		if re.search(r'\.v[vxif]m$', m) and 'vm' not in self._fields:
+			flags.append('RISCV_VSHAPE_CARRY')
+		flags = ' | '.join(flags) if flags else '0'
+		return vshapefmt.format(ident=self.identifier(), vd=vd, vs1=vs1, vs2=vs2, eew=eew, count=count, flags=flags, name=m)
+
+	def optype(self):
+		for regex, optype in operation_types:
+			if re.search(regex, self._mnemonic):
+				return optype
+		return 'UNK'
+
+	def memsize(self):
+		optype = self.optype()
+		if optype not in ['LOAD', 'STORE', 'XCHG'] or self._mnemonic[0] == 'v':
+			return 0
+		width = self._mnemonic.split('.')[-1] if '.' in self._mnemonic else self._mnemonic
+		width = width.rstrip('u')
+		return { 'b': 1, 'h': 2, 'w': 4, 'd': 8, 'q': 16 }.get(width[-1:], 0)
+
+	def analysis(self):
+		family = operation_families.get(self._standard, 'CPU')
+		if self._mnemonic in ['sret', 'mret', 'dret', 'wfi'] or self._mnemonic.startswith('sfence'):
+			family = 'PRIV'
+		cond = branch_conditions.get(self._mnemonic, 'AL')
+		return analysisfmt.format(optype=self.optype(), family=family, cond=cond, memsize=self.memsize(), name=self._mnemonic)
+
+	def decoder_index(self):
+		return decodertbl.index('riscv_unique' if self._description.is_unique() else self.decoder_name())
+
 	def struct(self):
-		name = '"' + self._mnemonic + '"'
-		decode = 'riscv_unique' if self._description.is_unique() else 'riscv_{0}_{1}'.format(self._standard, self._bitmask)
-		pad = " " * (18 - len(name))
-		return stuctfmt.format(name=name, pad=pad, mask=self._bitmask, cbits=self._cbits, cmask=self._cmask, decode=decode)
+		pad = " " * (16 - len(self._mnemonic))
+		return stuctfmt.format(pad=pad, mnemonic=self._mnemonic, mask=self._bitmask, cbits=self._cbits, cmask=self._cmask, imm=self.immediate(), regs=self.registers())
+
+	def description(self, name):
+		return descfmt.format(name=name, decode=self.decoder_index(), mnemonic=self._mnemonic)
+
+class Alias(object):
+	def __init__(self, instr, predicates, fmt):
+		super(Alias, self).__init__()
+		self._instr = instr
+		self._same = predicates.get('same', False)
+		self._mask = 0
+		self._bits = 0
+		for field, value in predicates.items():
+			if field == 'same':
+				continue
+			shift, mask = alias_fields[field]
+			self._mask |= mask << shift
+			self._bits |= (value & mask) << shift
+		self._name = fmt.split(' ')[0]
+		self._operands = fmt[len(self._name) + 1:]
+
+	def render_name(self):
+		operands = re.findall(r'{(\w+)}', self._operands)
+		if len(operands) < 1:
+			return 'riscv_alias_none'
+		return 'riscv_alias_' + '_'.join(operands)
+
+	def render(self):
+		operands = re.findall(r'{(\w+)}', self._operands)
+		func = "static void {0}(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {{\n".format(self.render_name())
+		if len(operands) < 1:
+			func += "\trz_strbuf_set(sb, name);\n"
+		else:
+			if 'csr' in operands:
+				func += "\tchar csr_hex[8];\n"
+			fmt = re.sub(r'{(\w+)}', lambda m: alias_operands[m.group(1)][0], self._operands)
+			variables = ', '.join(map(lambda x: alias_operands[x][1], operands))
+			func += "\trz_strbuf_setf(sb, \"%s {fmt}\", name, {vars});\n".format(fmt=fmt, vars=variables)
+		func += "}\n"
+		return func
+
+	def struct(self, name):
+		same = 'true' if self._same else 'false'
+		render = rendertbl.index(self.render_name())
+		return aliasfmt.format(ident=self._instr.identifier(), same=same, mask=self._mask, bits=self._bits, name=name, render=render, alias=self._name)
 
 with open('./riscv_opcodes.json', 'r') as f:
 	instrtbl += json.load(f)
 
+# the generic pseudo instructions are rendered by the alias stage
+instrtbl = list(filter(lambda x: x['standard'] != 'pseudo', instrtbl))
 instrtbl = list(map(lambda x: Instr(x), instrtbl))
 instrtbl.sort(key=lambda x: x._cmask)
+# the first match in mask order wins, the ids are grouped by standard so each one gets its own translation unit
+standards = []
+for priority, x in enumerate(instrtbl):
+	x._priority = priority
+	if x._standard not in standards:
+		standards.append(x._standard)
+instrtbl.sort(key=lambda x: (standards.index(x._standard), x._priority))
+mnemonics = dict(map(lambda x: (x._mnemonic, x), instrtbl))
+for mnemonic, predicates, fmt in aliases:
+	if mnemonic not in mnemonics:
+		sys.exit("unknown alias instruction: " + mnemonic)
+	aliastbl.append(Alias(mnemonics[mnemonic], predicates, fmt))
+ids = list(map(lambda x: x.identifier(), instrtbl))
+aliastbl.sort(key=lambda x: ids.index(x._instr.identifier()))
+renderers = list(set(map(lambda x: x.render(), aliastbl)))
+renderers.sort()
+immediate_cases = list(map(lambda x: '\tcase {0}:\n\t\timm = {1};\n\t\tbreak;'.format(x[0], x[1]), immediate_expressions))
+
+with open('./riscv_csrs.json', 'r') as f:
+	csrtbl += json.load(f)
+
+# names are stored back to back, offset 0 is the empty string used for unknown csr
+csroffsets = [0] * 4096
+pooloffset = 1
+for csr in csrtbl:
+	csroffsets[csr['csr']] = pooloffset
+	pooloffset += len(csr['name']) + 1
+	csrpool.append('\t"{name}\\0" /* 0x{csr:03x} */'.format(name=csr['name'], csr=csr['csr']))
+	rv32 = ' /* rv32 only */' if csr['rv32'] else ''
+	csrenum.append('\tRISCV_CSR_{name} = 0x{csr:03x},{rv32}'.format(name=csr['name'].upper(), csr=csr['csr'], rv32=rv32))
+if pooloffset > 0xffff:
+	sys.exit("csr string pool is too big: " + str(pooloffset))
+for i in range(0, len(csroffsets), 16):
+	csrindex.append('\t' + ' '.join(map(lambda x: '{},'.format(x), csroffsets[i:i + 16])))
 decoders = list(set(map(lambda x: x.decoder(), instrtbl)))
 decoders.sort()
+decodertbl = ['riscv_unique'] + sorted(set(decodernames.values()))
+rendertbl = sorted(set(map(lambda x: x.render_name(), aliastbl)))
+
+# the names are stored back to back, the tables hold their offsets to avoid relocations
+def string_pool(names):
+	pool = []
+	offsets = []
+	offset = 0
+	for name in names:
+		offsets.append(offset)
+		pool.append('\t"{}\\0"'.format(name))
+		offset += len(name) + 1
+	if offset > 0xffff:
+		sys.exit("string pool is too big: " + str(offset))
+	return pool, offsets
+
+aliaspool, aliasoffsets = string_pool(map(lambda x: x._name, aliastbl))
 stucttbl = list(map(lambda x: x.struct(), instrtbl))
+vshapetbl = list(filter(None, map(lambda x: x.vector_shape(), instrtbl)))
+identifiers = list(map(lambda x: '\t{},'.format(x.identifier()), instrtbl))
+
+# candidate lists end with UT16_MAX and are shared between buckets, in mask order
+# so the first match of a bucket is the same one of a linear scan of the sorted masks
+def subtable_list(pool, offsets, candidates):
+	key = tuple(candidates)
+	if key not in offsets:
+		offsets[key] = len(pool)
+		pool.extend(candidates + [0xffff])
+	return offsets[key]
+
+def subtable_key(fields):
+	terms = []
+	pos = 0
+	for shift, width in fields:
+		mask = ((1 << width) - 1) << pos
+		if shift > pos:
+			terms.append('((data >> {}) & 0x{:x})'.format(shift - pos, mask))
+		elif shift < pos:
+			terms.append('((data << {}) & 0x{:x})'.format(pos - shift, mask))
+		else:
+			terms.append('(data & 0x{:x})'.format(mask))
+		pos += width
+	return ' | '.join(terms)
+
+def subtable_bits(base, fields, key):
+	pos = 0
+	for shift, width in fields:
+		base |= ((key >> pos) & ((1 << width) - 1)) << shift
+		pos += width
+	return base
+
+def subtable_array(name, values):
+	lines = ['static const ut16 {}[{}] = {{'.format(name, len(values))]
+	for i in range(0, len(values), 16):
+		lines.append('\t' + ' '.join(map(lambda x: 'UT16_MAX,' if x == 0xffff else '{},'.format(x), values[i:i + 16])))
+	lines.append('};\n')
+	return lines
+
+subtabledefs = ['/* index entries with this bit set select a block of the nested table */', '#define RISCV_SUBTABLE_NESTED 0x8000\n']
+subtablecases = []
+subtabledata = []
+subtableops = set()
+priorities = sorted(enumerate(instrtbl), key=lambda x: x[1]._priority)
+for name, comment, opcodes, fields, nested in subtables:
+	fieldmask = sum(((1 << w) - 1) << sh for sh, w in fields)
+	nestedmask = sum(((1 << w) - 1) << sh for sh, w in nested)
+	if any((op ^ opcodes[0]) & ~fieldmask for op in opcodes):
+		sys.exit("sub-table opcodes must differ only in the key fields: " + name)
+	subtableops.update(opcodes)
+	opmask = 0x7f | fieldmask
+	base = opcodes[0] & ~fieldmask
+	members = [(i, x) for i, x in priorities if (x._cbits ^ base) & x._cmask & 0x7f & ~fieldmask == 0]
+	pool = []
+	offsets = {}
+	index = []
+	blocks = []
+	blockoffsets = {}
+	for key in range(1 << sum(w for sh, w in fields)):
+		bits = subtable_bits(base, fields, key)
+		candidates = [i for i, x in members if (x._cbits ^ bits) & x._cmask & opmask == 0]
+		if len(candidates) <= 2 or not nested:
+			index.append(subtable_list(pool, offsets, candidates))
+			continue
+		block = []
+		for nkey in range(1 << sum(w for sh, w in nested)):
+			nbits = subtable_bits(bits, nested, nkey)
+			block.append(subtable_list(pool, offsets, [i for i in candidates if (instrtbl[i]._cbits ^ nbits) & instrtbl[i]._cmask & nestedmask == 0]))
+		if tuple(block) not in blockoffsets:
+			blockoffsets[tuple(block)] = len(blockoffsets)
+			blocks += block
+		index.append(0x8000 | blockoffsets[tuple(block)])
+	if len(pool) >= 0x8000:
+		sys.exit("sub-table candidates do not fit the index: " + name)
+	subtabledata.append((opcodes, fields, nested, pool, index, blocks))
+	subtabledefs.append('/* {} */'.format(comment))
+	subtabledefs += subtable_array(name + '_candidates', pool)
+	subtabledefs += subtable_array(name + '_index', index)
+	cases = ''.join(map(lambda x: '\tcase 0x{:02x}:\n'.format(x), opcodes))
+	if not blocks:
+		subtablecases.append(cases + '\t\treturn riscv_lookup_list(data, {0}_candidates + {0}_index[{1}]);'.format(name, subtable_key(fields)))
+		continue
+	subtabledefs += subtable_array(name + '_nested', blocks)
+	nbits = sum(w for sh, w in nested)
+	subtablecases.append(cases[:-1] + ' {{\n\t\tut16 entry = {0}_index[{1}];\n\t\tif (entry & RISCV_SUBTABLE_NESTED) {{\n\t\t\tentry = {0}_nested[((entry & ~RISCV_SUBTABLE_NESTED) << {2}) | {3}];\n\t\t}}\n\t\treturn riscv_lookup_list(data, {0}_candidates + entry);\n\t}}'.format(name, subtable_key(fields), nbits, subtable_key(nested)))
+
+# everything else is scanned linearly
+scanned = [i for i, x in priorities if (x._cbits & 0x7f) not in subtableops] + [0xffff]
+subtabledefs.append('/* instructions outside the sub-tables */')
+subtabledefs += subtable_array('scanned_candidates', scanned)
+
+# postfix code shared by all the templates, offset 0 is the empty template
+ilcode = [('RISCV_IL_END', 0, 'end')]
+ilconsts = []
+ilnames = []
+iloffsets = {}
+ildepth = 0
+
+def il_serialize(node, code):
+	if isinstance(node, str):
+		if node not in il_leaves:
+			sys.exit("unknown il leaf: " + node)
+		code.append(('RISCV_IL_' + node.upper(), 0))
+		return ('pure', 1)
+	op = node[0]
+	if op not in il_operations:
+		sys.exit("unknown il operation: " + op)
+	arity, result = il_operations[op]
+	operands = node[1:]
+	arg = 0
+	if op in il_attributes:
+		attribute = operands[0]
+		operands = operands[1:]
+		if op == 'const':
+			attribute = (attribute, operands[0])
+			operands = ()
+			if attribute not in ilconsts:
+				ilconsts.append(attribute)
+			arg = ilconsts.index(attribute)
+		elif op in ['var', 'setl', 'goto']:
+			if attribute not in ilnames:
+				ilnames.append(attribute)
+			arg = ilnames.index(attribute)
+		else:
+			arg = attribute
+	if len(operands) != arity:
+		sys.exit("wrong number of il operands: " + str(node))
+	depth = 0
+	for i, operand in enumerate(operands):
+		kind, needed = il_serialize(operand, code)
+		expected = 'effect' if op == 'seq' else 'pure'
+		if kind != expected:
+			sys.exit("il operand is not " + expected + ": " + str(node))
+		depth = max(depth, needed + i)
+	code.append(('RISCV_IL_' + op.upper(), arg))
+	return (result, max(depth, 1))
+
+for instr in instrtbl:
+	template = il_templates.pop(instr._mnemonic, None)
+	if template == None:
+		continue
+	code = []
+	kind, depth = il_serialize(template, code)
+	if kind != 'effect':
+		sys.exit("il template is not an effect: " + instr._mnemonic)
+	ildepth = max(ildepth, depth)
+	code.append(('RISCV_IL_END', 0))
+	key = tuple(code)
+	if key not in iloffsets:
+		iloffsets[key] = len(ilcode)
+		ilcode += map(lambda x: (x[0], x[1], instr._mnemonic), code)
+	instr._il = iloffsets[key]
+if len(il_templates) > 0:
+	sys.exit("unknown il instructions: " + ", ".join(il_templates.keys()))
+if len(ilcode) > 0xffff or len(ilconsts) > 0xff:
+	sys.exit("il code is too big")
 
 
+# types shared by the dispatch and the standard translation units
+standardtypes = """typedef struct riscv_analysis_t {
+	ut32 type; /*    RZ_ANALYSIS_OP_TYPE_* */
+	st8 family; /*   RZ_ANALYSIS_OP_FAMILY_* */
+	ut8 cond; /*     RZ_TYPE_COND_* for conditional branches */
+	ut8 memsize; /*  bytes accessed by loads and stores */
+} RISCVAnalysis;
+
+typedef struct riscv_description_t {
+	ut16 name; /*    offset of the instruction name in the names of the standard */
+	ut8 decode; /*   index of the text decoder in decoders */
+} RISCVDescription;"""
+
+def standard_name(standard):
+	return re.sub('[^a-z0-9]', '_', standard)
+
+if len(sys.argv) > 1 and sys.argv[1] == '--standards':
+	print("\n".join(map(standard_name, standards)))
+	sys.exit(0)
+
+# binary tables used in place by riscv_blob.c, all the fields are little endian
+if len(sys.argv) > 1 and sys.argv[1] == '--blob':
+	blobpool = bytearray(b'\0')
+	blobstrings = {'': 0}
+	def blob_string(text):
+		if text not in blobstrings:
+			blobstrings[text] = len(blobpool)
+			blobpool.extend(text.encode('ascii') + b'\0')
+		return blobstrings[text]
+
+	# offset 0 is the index shared by the opcodes without key fields, offset 1 the empty list
+	blobtable = [0, 0xffff]
+	def blob_table(values):
+		offset = len(blobtable)
+		blobtable.extend(values)
+		return offset
+
+	bloboperands = [None]
+	def blob_operand(operand):
+		if operand not in bloboperands:
+			bloboperands.append(operand)
+		return bloboperands.index(operand)
+
+	nodes = [None] * 128
+	for opcodes, fields, nested, pool, index, blocks in subtabledata:
+		node = (fields, nested, blob_table(pool), blob_table(index), blob_table(blocks) if blocks else 0)
+		for opcode in opcodes:
+			nodes[opcode] = node
+	for opcode in range(128):
+		if nodes[opcode]:
+			continue
+		candidates = [i for i, x in priorities if (x._cbits & 0x7f) == opcode]
+		nodes[opcode] = ([], [], blob_table(candidates + [0xffff]) if candidates else 1, 0, 0)
+
+	immkinds = ['RISCV_IMM_NONE'] + list(map(lambda x: x[0], immediate_pieces))
+	if immkinds[1:] != list(map(lambda x: x[0], immediate_expressions)):
+		sys.exit("immediate pieces do not follow RISCVImmediate")
+	insns = bytearray()
+	for x in instrtbl:
+		roles = sum(1 << register_role_bits.index(r) for r in x.roles())
+		fmt = blob_string(x.blob_format(blob_operand))
+		insns += struct.pack('<IIHHHBB', x._cmask, x._cbits, blob_string(x._mnemonic), fmt, roles, immkinds.index(x.immediate()), x._size // 8)
+	if len(bloboperands) > 0x1f:
+		sys.exit("too many blob operands: " + str(len(bloboperands)))
+
+	blobnodes = bytearray()
+	for fields, nested, candidates, index, blocks in nodes:
+		keys = [b for f in (fields + [(0, 0)] * 4)[:4] for b in f]
+		keys += [b for f in (nested + [(0, 0)] * 2)[:2] for b in f]
+		blobnodes += struct.pack('<12BIII', *keys, candidates, index, blocks)
+
+	operands = bytearray(8)
+	for kind, shift, width, choices in bloboperands[1:]:
+		offset = 0
+		if choices:
+			offset = blob_table(list(map(blob_string, choices)))
+		operands += struct.pack('<BBBxI', kind, shift, width, offset)
+
+	immediates = bytearray(16)
+	for kind, signed, pieces in immediate_pieces:
+		bits = max(map(lambda x: x[1] + x[2], pieces))
+		flat = [b for piece in (pieces + [(0, 0, 0)] * 4)[:4] for b in piece]
+		immediates += struct.pack('<14B2x', bits if signed else 0, len(pieces), *flat)
+
+	registers = list(map(blob_string, register_names_std + register_names_flt + register_names_vec))
+	csrs = [0] * 4096
+	for csr in csrtbl:
+		csrs[csr['csr']] = blob_string(csr['name'])
+	if len(blobpool) > 0xffff or len(blobtable) > 0xffffffff:
+		sys.exit("blob string pool is too big: " + str(len(blobpool)))
+
+	sections = [
+		insns,
+		blobnodes,
+		struct.pack('<{}H'.format(len(blobtable)), *blobtable),
+		operands,
+		immediates,
+		struct.pack('<96H', *registers),
+		struct.pack('<4096H', *csrs),
+		blobpool,
+	]
+	body = bytearray()
+	offsets = []
+	header = 16 + 8 * len(sections)
+	for section in sections:
+		body += bytes(-len(body) % 4)
+		offsets += [header + len(body), len(section)]
+		body += section
+	blob = struct.pack('<4sHHII', b'RVDB', 1, len(sections), header + len(body), len(instrtbl))
+	blob += struct.pack('<{}I'.format(len(offsets)), *offsets) + body
+	sys.stdout.buffer.write(blob)
+	sys.exit(0)
+
 print("// SPDX-FileCopyrightText: {year} deroad <wargio@libero.it>".format(year=date.today().year))
 print("// SPDX-License-Identifier: LGPL-3.0-only")
-print("""
+
+# types and tables shared by the translation units of the decoder, hidden outside of the library
+if len(sys.argv) > 1 and sys.argv[1] == '--private-header':
+	print("""
+#ifndef RISCV_DECODE_PRIVATE_H
+#define RISCV_DECODE_PRIVATE_H
+
+#include "riscv_decode.h"
+
+#if defined(__GNUC__) && !defined(_WIN32)
+#define RISCV_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define RISCV_HIDDEN
+#endif
+""")
+	print(standardtypes)
+	print("""
+RISCV_HIDDEN extern const char registers_std[32][RISCV_REG_NAME_SIZE];
+RISCV_HIDDEN extern const char registers_vec[32][RISCV_REG_NAME_SIZE];
+RISCV_HIDDEN extern const char registers_flt[32][RISCV_REG_NAME_SIZE];
+
+/* names, descriptions and analysis of each standard, defined by riscv_decode_<standard>.c */""")
+	for standard in map(standard_name, standards):
+		print("RISCV_HIDDEN extern const char riscv_{}_names[];".format(standard))
+		print("RISCV_HIDDEN extern const RISCVDescription riscv_{}_descriptions[];".format(standard))
+		print("RISCV_HIDDEN extern const RISCVAnalysis riscv_{}_analysis[];".format(standard))
+	print("""
+#endif /* RISCV_DECODE_PRIVATE_H */""")
+	sys.exit(0)
+
+if len(sys.argv) > 2 and sys.argv[1] == '--standard':
+	standard = next((x for x in standards if standard_name(x) == sys.argv[2]), None)
+	if not standard:
+		sys.exit("unknown standard: " + sys.argv[2])
+	members = [x for x in instrtbl if x._standard == standard]
+	pool, offsets = string_pool(map(lambda x: x._mnemonic, members))
+	print("""
+#include "riscv_decode_private.h"
+
+/* {0}, {1} to {2} */
+const char riscv_{3}_names[] =""".format(standard, members[0].identifier(), members[-1].identifier(), standard_name(standard)))
+	print("\n".join(pool) + ";")
+	print("""
+const RISCVDescription riscv_{}_descriptions[] = {{""".format(standard_name(standard)))
+	print("\n".join(map(lambda x: x[1].description(offsets[x[0]]), enumerate(members))))
+	print("""}};
+
+const RISCVAnalysis riscv_{}_analysis[] = {{""".format(standard_name(standard)))
+	print("\n".join(map(lambda x: x.analysis(), members)))
+	print("};")
+	sys.exit(0)
+
+if len(sys.argv) > 1 and sys.argv[1] == '--il':
+	print("""
+#include "riscv_decode_private.h"
+
+#define RISCV_IL_STACK {depth}
+
+typedef enum {{""".format(depth=ildepth))
+	print("\tRISCV_IL_END = 0,")
+	print("\n".join(map(lambda x: '\tRISCV_IL_{},'.format(x.upper()), il_leaves + list(il_operations.keys()))))
+	print("""} RISCVILOp;
+
+typedef struct riscv_il_code_t {
+	ut8 op; /*  RISCVILOp */
+	ut8 arg; /* size in bits, index of il_consts[] or of il_names[] */
+} RISCVILCode;
+
+typedef struct riscv_il_const_t {
+	ut8 bits;
+	ut64 value;
+} RISCVILConst;
+
+/* operands popped from the stack by each RISCVILOp */
+static const ut8 il_arity[] = {
+	0, /* end */""")
+	print("\n".join(map(lambda x: '\t0, /* {} */'.format(x), il_leaves)))
+	print("\n".join(map(lambda x: '\t{}, /* {} */'.format(x[1][0], x[0]), il_operations.items())))
+	print("""};
+
+static const RISCVILConst il_consts[] = {""")
+	print("\n".join(map(lambda x: '\t{{ {}, 0x{:x}ull }},'.format(x[0], x[1]), ilconsts)))
+	print("""};
+
+/* local variables and goto labels */
+static const char *il_names[] = {""")
+	print("\n".join(map(lambda x: '\t"{}",'.format(x), ilnames)))
+	print("""};
+
+static const RISCVILCode il_code[] = {""")
+	last = None
+	for op, arg, name in ilcode:
+		comment = ' /* {} */'.format(name) if name != last else ''
+		last = name
+		print('\t{{ {}, {} }},{}'.format(op, arg, comment))
+	print("""};
+
+/* offset in il_code[] of the template of each instruction, 0 when it cannot be lifted */
+static const ut16 il_templates[RISCV_INS_COUNT] = {""")
+	print("\n".join(map(lambda x: '\t{}, /* {} */'.format(x._il, x._mnemonic), instrtbl)))
+	print("""};
+
+/* dyn uses rne since frm is not modeled */
+static RzFloatRMode riscv_il_rmode(ut32 data) {
+	switch ((data >> 12) & 7) {
+	case 1:
+		return RZ_FLOAT_RMODE_RTZ;
+	case 2:
+		return RZ_FLOAT_RMODE_RTN;
+	case 3:
+		return RZ_FLOAT_RMODE_RTP;
+	case 4:
+		return RZ_FLOAT_RMODE_RNA;
+	default:
+		return RZ_FLOAT_RMODE_RNE;
+	}
+}
+
+static RzFloatFormat riscv_il_format(ut8 bits) {
+	return bits == 32 ? RZ_FLOAT_IEEE754_BIN_32 : RZ_FLOAT_IEEE754_BIN_64;
+}
+
+static RzILOpPure *riscv_il_gpr(ut8 reg) {
+	if (reg == RISCV_REG_ZERO) {
+		return rz_il_op_new_bitv_from_ut64(64, 0);
+	}
+	return rz_il_op_new_var(registers_std[reg], RZ_IL_VAR_KIND_GLOBAL);
+}
+
+static void riscv_il_free(void **stack, const bool *effect, ut32 sp) {
+	while (sp > 0) {
+		sp--;
+		if (effect[sp]) {
+			rz_il_op_effect_free(stack[sp]);
+		} else {
+			rz_il_op_pure_free(stack[sp]);
+		}
+	}
+}
+
+/**
+ * Lifts the decoded instruction to RzIL by instantiating its template:
+ * the code is shared by all the instructions with the same semantics and
+ * only the operands (registers, immediate, pc) are patched in.
+ * Returns NULL when the instruction has no template.
+ */
+RzILOpEffect *riscv_il(const RISCVDecoded *dec, ut64 pc) {
+	rz_return_val_if_fail(dec && dec->id < RISCV_INS_COUNT, NULL);
+	void *stack[RISCV_IL_STACK];
+	bool effect[RISCV_IL_STACK];
+	ut32 sp = 0;
+	RzFloatRMode mode = riscv_il_rmode(dec->data);
+
+	for (const RISCVILCode *code = il_code + il_templates[dec->id]; code->op != RISCV_IL_END; ++code) {
+		/* operands are consumed by the constructors, x[] points to the popped ones */
+		sp -= il_arity[code->op];
+		void **x = stack + sp;
+		void *op = NULL;
+		switch (code->op) {
+		case RISCV_IL_RS1:
+			op = riscv_il_gpr(dec->rs1);
+			break;
+		case RISCV_IL_RS2:
+			op = riscv_il_gpr(dec->rs2);
+			break;
+		case RISCV_IL_FS1:
+			op = rz_il_op_new_var(registers_flt[dec->rs1], RZ_IL_VAR_KIND_GLOBAL);
+			break;
+		case RISCV_IL_FS2:
+			op = rz_il_op_new_var(registers_flt[dec->rs2], RZ_IL_VAR_KIND_GLOBAL);
+			break;
+		case RISCV_IL_FS3:
+			op = rz_il_op_new_var(registers_flt[dec->rs3], RZ_IL_VAR_KIND_GLOBAL);
+			break;
+		case RISCV_IL_IMM:
+			op = rz_il_op_new_bitv_from_st64(64, dec->imm);
+			break;
+		case RISCV_IL_NEXT:
+			op = rz_il_op_new_bitv_from_ut64(64, pc + dec->size);
+			break;
+		case RISCV_IL_TARGET:
+			op = rz_il_op_new_bitv_from_ut64(64, pc + dec->imm);
+			break;
+		case RISCV_IL_CONST:
+			op = rz_il_op_new_bitv_from_ut64(il_consts[code->arg].bits, il_consts[code->arg].value);
+			break;
+		case RISCV_IL_VAR:
+			op = rz_il_op_new_var(il_names[code->arg], RZ_IL_VAR_KIND_LOCAL);
+			break;
+		case RISCV_IL_SIGNED:
+			op = rz_il_op_new_signed(code->arg, x[0]);
+			break;
+		case RISCV_IL_UNSIGNED:
+			op = rz_il_op_new_unsigned(code->arg, x[0]);
+			break;
+		case RISCV_IL_LOAD:
+			op = rz_il_op_new_loadw(0, x[0], code->arg);
+			break;
+		case RISCV_IL_NOT:
+			op = rz_il_op_new_log_not(x[0]);
+			break;
+		case RISCV_IL_NEG:
+			op = rz_il_op_new_neg(x[0]);
+			break;
+		case RISCV_IL_INV:
+			op = rz_il_op_new_bool_inv(x[0]);
+			break;
+		case RISCV_IL_BOOL:
+			op = rz_il_op_new_ite(x[0], rz_il_op_new_bitv_from_ut64(64, 1), rz_il_op_new_bitv_from_ut64(64, 0));
+			break;
+		case RISCV_IL_FLOAT:
+			op = rz_il_op_new_float(riscv_il_format(code->arg), x[0]);
+			break;
+		case RISCV_IL_FBITS:
+			op = rz_il_op_new_fbits(x[0]);
+			break;
+		case RISCV_IL_FNEG:
+			op = rz_il_op_new_fneg(x[0]);
+			break;
+		case RISCV_IL_FSQRT:
+			op = rz_il_op_new_fsqrt(mode, x[0]);
+			break;
+		case RISCV_IL_FTOINT:
+			op = rz_il_op_new_fcast_int(code->arg, mode, x[0]);
+			break;
+		case RISCV_IL_FTOSINT:
+			op = rz_il_op_new_fcast_sint(code->arg, mode, x[0]);
+			break;
+		case RISCV_IL_ITOF:
+			op = rz_il_op_new_fcast_float(riscv_il_format(code->arg), mode, x[0]);
+			break;
+		case RISCV_IL_SITOF:
+			op = rz_il_op_new_fcast_sfloat(riscv_il_format(code->arg), mode, x[0]);
+			break;
+		case RISCV_IL_FCONV:
+			op = rz_il_op_new_fconvert(riscv_il_format(code->arg), mode, x[0]);
+			break;
+		case RISCV_IL_ADD:
+			op = rz_il_op_new_add(x[0], x[1]);
+			break;
+		case RISCV_IL_SUB:
+			op = rz_il_op_new_sub(x[0], x[1]);
+			break;
+		case RISCV_IL_MUL:
+			op = rz_il_op_new_mul(x[0], x[1]);
+			break;
+		case RISCV_IL_DIV:
+			op = rz_il_op_new_div(x[0], x[1]);
+			break;
+		case RISCV_IL_SDIV:
+			op = rz_il_op_new_sdiv(x[0], x[1]);
+			break;
+		case RISCV_IL_MOD:
+			op = rz_il_op_new_mod(x[0], x[1]);
+			break;
+		case RISCV_IL_SMOD:
+			op = rz_il_op_new_smod(x[0], x[1]);
+			break;
+		case RISCV_IL_AND:
+			op = rz_il_op_new_log_and(x[0], x[1]);
+			break;
+		case RISCV_IL_OR:
+			op = rz_il_op_new_log_or(x[0], x[1]);
+			break;
+		case RISCV_IL_XOR:
+			op = rz_il_op_new_log_xor(x[0], x[1]);
+			break;
+		case RISCV_IL_SHL:
+			op = rz_il_op_new_shiftl(rz_il_op_new_b0(), x[0], x[1]);
+			break;
+		case RISCV_IL_SHR:
+			op = rz_il_op_new_shiftr(rz_il_op_new_b0(), x[0], x[1]);
+			break;
+		case RISCV_IL_SAR:
+			op = rz_il_op_new_shiftr_arith(x[0], x[1]);
+			break;
+		case RISCV_IL_EQ:
+			op = rz_il_op_new_eq(x[0], x[1]);
+			break;
+		case RISCV_IL_ULT:
+			op = rz_il_op_new_ult(x[0], x[1]);
+			break;
+		case RISCV_IL_SLT:
+			op = rz_il_op_new_slt(x[0], x[1]);
+			break;
+		case RISCV_IL_FADD:
+			op = rz_il_op_new_fadd(mode, x[0], x[1]);
+			break;
+		case RISCV_IL_FSUB:
+			op = rz_il_op_new_fsub(mode, x[0], x[1]);
+			break;
+		case RISCV_IL_FMUL:
+			op = rz_il_op_new_fmul(mode, x[0], x[1]);
+			break;
+		case RISCV_IL_FDIV:
+			op = rz_il_op_new_fdiv(mode, x[0], x[1]);
+			break;
+		case RISCV_IL_FLT:
+			op = rz_il_op_new_flt(x[0], x[1]);
+			break;
+		case RISCV_IL_FLE:
+			op = rz_il_op_new_fle(x[0], x[1]);
+			break;
+		case RISCV_IL_FEQ:
+			op = rz_il_op_new_feq(x[0], x[1]);
+			break;
+		case RISCV_IL_ITE:
+			op = rz_il_op_new_ite(x[0], x[1], x[2]);
+			break;
+		case RISCV_IL_FMAD:
+			op = rz_il_op_new_fmad(mode, x[0], x[1], x[2]);
+			break;
+		case RISCV_IL_SETRD:
+			/* writes to x0 are discarded */
+			if (dec->rd == RISCV_REG_ZERO) {
+				rz_il_op_pure_free(x[0]);
+				op = rz_il_op_new_nop();
+				break;
+			}
+			op = rz_il_op_new_set(registers_std[dec->rd], false, x[0]);
+			break;
+		case RISCV_IL_SETFD:
+			op = rz_il_op_new_set(registers_flt[dec->rd], false, x[0]);
+			break;
+		case RISCV_IL_SETL:
+			op = rz_il_op_new_set(il_names[code->arg], true, x[0]);
+			break;
+		case RISCV_IL_STORE:
+			op = rz_il_op_new_storew(0, x[0], x[1]);
+			break;
+		case RISCV_IL_JMP:
+			op = rz_il_op_new_jmp(x[0]);
+			break;
+		case RISCV_IL_BRANCH:
+			op = rz_il_op_new_branch(x[0], rz_il_op_new_jmp(rz_il_op_new_bitv_from_ut64(64, pc + dec->imm)), rz_il_op_new_nop());
+			break;
+		case RISCV_IL_SEQ:
+			op = rz_il_op_new_seq(x[0], x[1]);
+			break;
+		case RISCV_IL_NOP:
+			op = rz_il_op_new_nop();
+			break;
+		case RISCV_IL_GOTO:
+			op = rz_il_op_new_goto(il_names[code->arg]);
+			break;
+		default:
+			break;
+		}
+		if (!op) {
+			riscv_il_free(stack, effect, sp);
+			return NULL;
+		}
+		effect[sp] = code->op >= RISCV_IL_SETRD;
+		stack[sp++] = op;
+	}
+	if (sp != 1) {
+		riscv_il_free(stack, effect, sp);
+		return NULL;
+	}
+	return stack[0];
+}""")
+	sys.exit(0)
+
+if len(sys.argv) > 1 and sys.argv[1] == '--header':
+	print("""
+#ifndef RISCV_DECODE_H
+#define RISCV_DECODE_H
+
+/* exported functions, the rest of the library is built with hidden visibility */
+#if defined(__GNUC__) && !defined(_WIN32)
+#define RISCV_API __attribute__((visibility("default")))
+#else
+#define RISCV_API
+#endif
+
+#ifdef RISCV_STANDALONE
+#include "riscv_shim.h"
+#else
 #include <rz_types.h>
 #include <rz_util.h>
+#include <rz_analysis.h>
+#include <rz_il.h>
+#endif
 
 #define RISCV_INVALID_SIZE 0
 
+#define RISCV_REG_ZERO 0
+#define RISCV_REG_RA   1
+#define RISCV_REG_SP   2
+#define RISCV_REG_GP   3
+#define RISCV_REG_TP   4
+
+/* size of the register names, "zero" included */
+#define RISCV_REG_NAME_SIZE 5
+
+typedef enum {
+	RISCV_IMM_NONE = 0,
+	RISCV_IMM_I, /*      imm12 (sign extended) */
+	RISCV_IMM_S, /*      imm12hi + imm12lo (sign extended) */
+	RISCV_IMM_B, /*      bimm12hi + bimm12lo (sign extended, pc relative) */
+	RISCV_IMM_U, /*      imm20 << 12 (sign extended) */
+	RISCV_IMM_J, /*      jimm20 (sign extended, pc relative) */
+	RISCV_IMM_CSR, /*    imm12 as csr number */
+	RISCV_IMM_UIMM2, /*  bits 21:20 */
+	RISCV_IMM_UIMM3, /*  bits 22:20 */
+	RISCV_IMM_UIMM4, /*  bits 23:20 */
+	RISCV_IMM_UIMM5, /*  bits 24:20 */
+	RISCV_IMM_UIMM6, /*  bits 25:20 */
+	RISCV_IMM_ZIMM, /*   bits 19:15 */
+	RISCV_IMM_SIMM5, /*  bits 19:15 (sign extended) */
+	RISCV_IMM_ZIMM10, /* bits 29:20 */
+	RISCV_IMM_ZIMM11, /* bits 30:20 */
+	RISCV_IMM_BS, /*     bits 31:30 */
+} RISCVImmediate;
+
+/* register operand roles, used by riscv_registers() to build the masks */
+#define RISCV_REGS_GPR_RD     (1 << 0)
+#define RISCV_REGS_GPR_RS1    (1 << 1)
+#define RISCV_REGS_GPR_RS2    (1 << 2)
+#define RISCV_REGS_GPR_RS3    (1 << 3)
+#define RISCV_REGS_FPR_RD     (1 << 4)
+#define RISCV_REGS_FPR_RS1    (1 << 5)
+#define RISCV_REGS_FPR_RS2    (1 << 6)
+#define RISCV_REGS_FPR_RS3    (1 << 7)
+#define RISCV_REGS_VEC_RD     (1 << 8)
+#define RISCV_REGS_VEC_RS1    (1 << 9)
+#define RISCV_REGS_VEC_RS2    (1 << 10)
+#define RISCV_REGS_VEC_RD_USE (1 << 11) /* vd/vs3 is read (stores and accumulators) */
+#define RISCV_REGS_VEC_VM     (1 << 12) /* v0 is read when the vm bit is clear */
+
+typedef enum {""")
+	print("\n".join(csrenum))
+	print("""} RISCVCsr;
+
+typedef enum {""")
+	print("\n".join(identifiers))
+	print("""	RISCV_INS_COUNT,
+} RISCVInsId;
+
+typedef struct riscv_decoded_t {
+	ut32 data; /* raw instruction */
+	ut16 id; /*   RISCVInsId */
+	ut8 size; /*  instruction size in bytes */
+	ut8 rd; /*    register fields, always extracted */
+	ut8 rs1;
+	ut8 rs2;
+	ut8 rs3;
+	st64 imm; /*  immediate built as described by RISCVImmediate */
+} RISCVDecoded;
+
+/* registers read (use) and written (def) by an instruction, bit N is register N */
+typedef struct riscv_registers_t {
+	ut32 gpr_use;
+	ut32 gpr_def;
+	ut32 fpr_use;
+	ut32 fpr_def;
+	ut32 vec_use;
+	ut32 vec_def;
+} RISCVRegisters;
+
+/* stack pointer update and memory access of an instruction */
+typedef struct riscv_stack_effect_t {
+	st32 delta; /*   added to sp by addi sp, sp, imm */
+	bool clobber; /* sp is written with a value that is not sp + imm */
+	ut8 base; /*     base register of the memory access */
+	st32 offset; /*  offset of the access from base */
+	ut8 size; /*     bytes accessed, 0 when there is no memory access */
+	bool write; /*   the access is a store */
+} RISCVStackEffect;
+
+/* vector configuration set by the last vsetvli or vsetivli */
+typedef struct riscv_vector_state_t {
+	ut16 sew; /* element width in bits, 0 when the configuration is not known */
+	st8 lmul; /* log2 of the register group multiplier, -3 (mf8) to 3 (m8) */
+	bool ta; /*  tail agnostic */
+	bool ma; /*  mask agnostic */
+} RISCVVectorState;
+
+/* vector instruction annotated with the configuration it executes with */
+typedef struct riscv_vector_op_t {
+	RISCVVectorState vtype;
+	bool masked; /*  executed under the v0.t mask */
+	ut16 eew; /*     element width encoded in the instruction, 0 when none */
+	ut8 nf; /*       fields of segment loads and stores, 1 otherwise */
+	ut32 vec_use; /* vector registers read, whole groups included */
+	ut32 vec_def; /* vector registers written, whole groups included */
+} RISCVVectorOp;
+
+RISCV_API cchar *riscv_mnemonic(RISCVInsId id);
+RISCV_API bool riscv_op_class(RISCVInsId id, ut32 *type, st8 *family);
+RISCV_API cchar *riscv_csr_name(ut16 csr);
+RISCV_API st64 riscv_immediate(RISCVImmediate kind, ut32 data);
+RISCV_API bool riscv_alias(const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb);
+RISCV_API void riscv_registers_roles(ut32 roles, const RISCVDecoded *dec, RISCVRegisters *regs);
+RISCV_API void riscv_registers(const RISCVDecoded *dec, RISCVRegisters *regs);
+RISCV_API bool riscv_stack_effect(const RISCVDecoded *dec, RISCVStackEffect *effect);
+RISCV_API void riscv_vector_reset(RISCVVectorState *state);
+RISCV_API bool riscv_vector_op(RISCVVectorState *state, const RISCVDecoded *dec, RISCVVectorOp *op);
+RISCV_API bool riscv_decode_word(ut32 data, RISCVDecoded *dec);
+RISCV_API bool riscv_decode(const ut8 *buffer, const ut32 size, bool be, RISCVDecoded *dec);
+RISCV_API ut32 riscv_disassembler(const ut8 *buffer, const ut32 size, ut64 pc, bool be, RzStrBuf *sb);
+
+#ifndef RISCV_STANDALONE
+/* rizin only, the standalone library has no RzAnalysisOp nor RzIL */
+RISCV_API RzILOpEffect *riscv_il(const RISCVDecoded *dec, ut64 pc);
+RISCV_API ut32 riscv_analyze(const ut8 *buffer, const ut32 size, ut64 pc, bool be, RzAnalysisOp *op);
+#endif
+
+#endif /* RISCV_DECODE_H */""")
+	sys.exit(0)
+
+print("""
+#include "riscv_decode_private.h"
+
 typedef ut32 (*Decode)(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb);
+""")
 
-const char *registers_std[32] = {
-	\"zero\", \"ra\", \"sp\", \"gp\", \"tp\", \"t0\", \"t1\", \"t2\", \"s0\",
-	\"s1\", \"a0\", \"a1\", \"a2\", \"a3\", \"a4\", \"a5\", \"a6\", \"a7\",
-	\"s2\", \"s3\", \"s4\", \"s5\", \"s6\", \"s7\", \"s8\", \"s9\", \"s10\",
-	\"s11\", \"t3\", \"t4\", \"t5\", \"t6\"
-	\"v0\", \"v1\", \"v2\", \"v3\", \"v4\", \"v5\", \"v6\", \"v7\", \"v8\",
-};
-
-const char *registers_vec[32] = {
-	\"v9\", \"v10\", \"v11\", \"v12\", \"v13\", \"v14\", \"v15\", \"v16\",
-	\"v17\", \"v18\", \"v19\", \"v20\", \"v21\", \"v22\", \"v23\", \"v24\",
-	\"v25\", \"v26\", \"v27\", \"v28\", \"v29\", \"v30\", \"v31\"
-};
-
-const char *registers_flt[32] = {
-	\"f0\", \"f1\", \"f2\", \"f3\", \"f4\", \"f5\", \"f6\", \"f7\", \"f8\",
-	\"f9\", \"f10\", \"f11\", \"f12\", \"f13\", \"f14\", \"f15\", \"f16\",
-	\"f17\", \"f18\", \"f19\", \"f20\", \"f21\", \"f22\", \"f23\", \"f24\",
-	\"f25\", \"f26\", \"f27\", \"f28\", \"f29\", \"f30\", \"f31\"
-};
-
-typedef struct riscv_decoder_t {
-	cchar* name; /*  instruction name */
-	ut16 cbits; /*   constant bits */
-	ut16 mbits; /*   mask to compare with constant bits */
-	ut32 opsize; /*  instruction size */
-	Decode decode;
+# fixed size names, the register tables hold no pointers
+for table, names in [('std', register_names_std), ('vec', register_names_vec), ('flt', register_names_flt)]:
+	print("const char registers_{}[32][RISCV_REG_NAME_SIZE] = {{".format(table))
+	for i in range(0, 32, 8):
+		print("\t" + " ".join(map(lambda x: '"{}",'.format(x), names[i:i + 8])))
+	print("};\n")
+
+print("""typedef struct riscv_decoder_t {
+	ut32 cbits; /*   constant bits */
+	ut32 mbits; /*   mask to compare with constant bits */
+	ut16 regs; /*    RISCV_REGS_* roles of the register operands */
+	ut8 imm; /*      RISCVImmediate */
 } RISCVInstruction;
+""")
+
+print("""typedef struct riscv_standard_t {
+	ut16 first; /*   RISCVInsId of the first instruction */
+	ut16 count;
+	const char *names;
+	const RISCVDescription *descriptions;
+	const RISCVAnalysis *analysis;
+} RISCVStandard;
+
+typedef void (*Render)(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb);
+
+typedef struct riscv_alias_t {
+	ut16 id; /*      RISCVInsId of the aliased instruction */
+	bool same; /*    rs1 must be equal to rs2 */
+	ut32 mask; /*    fields checked by the alias */
+	ut32 bits; /*    expected value of the checked fields */
+	ut16 name; /*    offset of the pseudo instruction name in alias_names */
+	ut8 render; /*   index of the renderer in renders */
+} RISCVAlias;
+
+typedef enum {
+	RISCV_VGROUP_LMUL = 0,
+	RISCV_VGROUP_ONE,
+	RISCV_VGROUP_MASK,
+	RISCV_VGROUP_WIDE,
+	RISCV_VGROUP_FRAC2,
+	RISCV_VGROUP_FRAC4,
+	RISCV_VGROUP_FRAC8,
+	RISCV_VGROUP_EEW,
+	RISCV_VGROUP_WHOLE,
+} RISCVVectorGroup;
+
+#define RISCV_VSHAPE_SEGMENT (1 << 0) /* the data group is repeated nf + 1 times */
+#define RISCV_VSHAPE_CARRY   (1 << 1) /* v0 is always read (carry in and merge) */
+
+typedef struct riscv_vector_shape_t {
+	ut16 id; /*    RISCVInsId of the vector instruction */
+	ut8 vd; /*     RISCVVectorGroup of vd or vs3 */
+	ut8 vs1; /*    RISCVVectorGroup of vs1 */
+	ut8 vs2; /*    RISCVVectorGroup of vs2 */
+	ut16 eew; /*   element width encoded in the mnemonic, 0 when none */
+	ut8 count; /*  registers moved by whole register instructions, 0 when set by simm5 */
+	ut8 flags; /*  RISCV_VSHAPE_* */
+} RISCVVectorShape;
+
+/* csr names, csr_index holds the offset of each name in the pool */
+static const char csr_pool[] =
+	"\\0\"""")
+print("\n".join(csrpool))
+print(""";
+
+static const ut16 csr_index[4096] = {""")
+print("\n".join(csrindex))
+print("""};
+
+/**
+ * Returns the name of the csr or NULL when the number is not known
+ */
+cchar *riscv_csr_name(ut16 csr) {
+	if (csr >= RZ_ARRAY_SIZE(csr_index) || !csr_index[csr]) {
+		return NULL;
+	}
+	return csr_pool + csr_index[csr];
+}
+
+/* csr name or its number when not known, hex must hold at least 8 bytes */
+static cchar *riscv_csr_operand(ut16 csr, char *hex) {
+	cchar *name = riscv_csr_name(csr);
+	if (name) {
+		return name;
+	}
+	snprintf(hex, 8, "0x%03x", csr);
+	return hex;
+}
 
 static ut32 riscv_unique(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	rz_strbuf_set(sb, name);
 	return 4;
 }""")
 
+for table, names in sorted(choicetables.items()):
+	size = max(map(len, names)) + 1
+	print("\nstatic const char {}[{}][{}] = {{".format(table, len(names), size))
+	for i in range(0, len(names), 8):
+		print("\t" + " ".join(map(lambda x: '"{}",'.format(x), names[i:i + 8])))
+	print("};")
+
 print("\n".join(decoders))
 
-print("""static const RISCVInstruction instructions[] = {""")
+print("\n".join(renderers))
+
+print("""/* text decoders and alias renderers, referenced by index */
+static const Decode decoders[] = {""")
+print("\n".join(map(lambda x: '\t{},'.format(x), decodertbl)))
+print("""};
+
+static const Render renders[] = {""")
+print("\n".join(map(lambda x: '\t{},'.format(x), rendertbl)))
+print("""};
+
+/* pseudo instruction names, aliases[].name is the offset of each name in the pool */
+static const char alias_names[] =""")
+print("\n".join(aliaspool) + ";")
+print("""
+static const RISCVInstruction instructions[] = {""")
 
 print("\n".join(stucttbl))
 
-print("""}
+print("""};
+
+/* the tables of each standard are defined by riscv_decode_<standard>.c */
+static const RISCVStandard standards[] = {""")
+for standard in standards:
+	members = [i for i, x in enumerate(instrtbl) if x._standard == standard]
+	print("\t{{ {0}, {1}, riscv_{2}_names, riscv_{2}_descriptions, riscv_{2}_analysis }},".format(instrtbl[members[0]].identifier(), len(members), standard_name(standard)))
+print("""};
+
+/* index in standards[] of each instruction */
+static const ut8 instruction_standards[RISCV_INS_COUNT] = {""")
+indices = list(map(lambda x: standards.index(x._standard), instrtbl))
+for i in range(0, len(indices), 32):
+	print('\t' + ' '.join(map(lambda x: '{},'.format(x), indices[i:i + 32])))
+print("""};
+
+static const RISCVStandard *riscv_standard(RISCVInsId id) {
+	return &standards[instruction_standards[id]];
+}
+
+static const RISCVAnalysis *riscv_analysis(RISCVInsId id) {
+	const RISCVStandard *standard = riscv_standard(id);
+	return &standard->analysis[id - standard->first];
+}
+
+/* sorted by RISCVInsId, the first matching alias of an instruction is used */
+static const RISCVAlias aliases[] = {""")
+
+print("\n".join(map(lambda x: x[1].struct(aliasoffsets[x[0]]), enumerate(aliastbl))))
+
+print("""};
+
+/* register groups of the vector instructions, sorted by RISCVInsId */
+static const RISCVVectorShape vector_shapes[] = {""")
+
+print("\n".join(vshapetbl))
+
+print("""};
+
+""")
+
+print("\n".join(subtabledefs))
+
+print("""
+/* first instruction of the list matching data, the list ends with UT16_MAX */
+static st32 riscv_lookup_list(ut32 data, const ut16 *list) {
+	for (; *list != UT16_MAX; ++list) {
+		const RISCVInstruction *ins = &instructions[*list];
+		if ((data & ins->mbits) == ins->cbits) {
+			return *list;
+		}
+	}
+	return -1;
+}
+
+static st32 riscv_lookup(ut32 data) {
+	switch (data & 0x7f) {""")
+
+print("\n".join(subtablecases))
+
+print("""	default:
+		return riscv_lookup_list(data, scanned_candidates);
+	}
+}
+
+st64 riscv_immediate(RISCVImmediate kind, ut32 data) {
+	st32 imm = 0;
+	switch (kind) {""")
+
+print("\n".join(immediate_cases))
+
+print("""	default:
+		break;
+	}
+	return imm;
+}
+
+cchar *riscv_mnemonic(RISCVInsId id) {
+	if (id >= RISCV_INS_COUNT) {
+		return NULL;
+	}
+	const RISCVStandard *standard = riscv_standard(id);
+	return standard->names + standard->descriptions[id - standard->first].name;
+}
+
+/**
+ * Sets the RZ_ANALYSIS_OP_TYPE_* and RZ_ANALYSIS_OP_FAMILY_* of the instruction
+ */
+bool riscv_op_class(RISCVInsId id, ut32 *type, st8 *family) {
+	rz_return_val_if_fail(type && family, false);
+	if (id >= RISCV_INS_COUNT) {
+		return false;
+	}
+	const RISCVAnalysis *info = riscv_analysis(id);
+	*type = info->type;
+	*family = info->family;
+	return true;
+}
+
+/**
+ * Renders the pseudo instruction matching the decoded one, if any.
+ * Returns false when the instruction has no alias and sb is left untouched.
+ */
+bool riscv_alias(const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_return_val_if_fail(dec && sb, false);
+	ut32 lo = 0, hi = RZ_ARRAY_SIZE(aliases);
+	while (lo < hi) {
+		ut32 mid = lo + (hi - lo) / 2;
+		if (aliases[mid].id < dec->id) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	for (; lo < RZ_ARRAY_SIZE(aliases) && aliases[lo].id == dec->id; ++lo) {
+		const RISCVAlias *alias = &aliases[lo];
+		if ((dec->data & alias->mask) != alias->bits || (alias->same && dec->rs1 != dec->rs2)) {
+			continue;
+		}
+		renders[alias->render](alias_names + alias->name, dec, pc, sb);
+		return true;
+	}
+	return false;
+}
+
+/* moves the role flag to bit 0 (roles are powers of two) and then to the register bit */
+#define riscv_role(roles, role, reg) ((((roles) / (role)) & 1) << (reg))
+
+/**
+ * Fills regs from the RISCV_REGS_* roles of the register operands of dec
+ */
+void riscv_registers_roles(ut32 roles, const RISCVDecoded *dec, RISCVRegisters *regs) {
+	rz_return_if_fail(dec && regs);
+	/* x0 is hardwired to zero, it is never a real use or def */
+	regs->gpr_def = riscv_role(roles, RISCV_REGS_GPR_RD, dec->rd) & ~1u;
+	regs->gpr_use = (riscv_role(roles, RISCV_REGS_GPR_RS1, dec->rs1) |
+				riscv_role(roles, RISCV_REGS_GPR_RS2, dec->rs2) |
+				riscv_role(roles, RISCV_REGS_GPR_RS3, dec->rs3)) &
+		~1u;
+	regs->fpr_def = riscv_role(roles, RISCV_REGS_FPR_RD, dec->rd);
+	regs->fpr_use = riscv_role(roles, RISCV_REGS_FPR_RS1, dec->rs1) |
+		riscv_role(roles, RISCV_REGS_FPR_RS2, dec->rs2) |
+		riscv_role(roles, RISCV_REGS_FPR_RS3, dec->rs3);
+	regs->vec_def = riscv_role(roles, RISCV_REGS_VEC_RD, dec->rd);
+	regs->vec_use = riscv_role(roles, RISCV_REGS_VEC_RS1, dec->rs1) |
+		riscv_role(roles, RISCV_REGS_VEC_RS2, dec->rs2) |
+		riscv_role(roles, RISCV_REGS_VEC_RD_USE, dec->rd) |
+		/* the vm bit (25) shifted onto RISCV_REGS_VEC_VM (12), v0 is the mask */
+		riscv_role(roles & ~(dec->data >> 13), RISCV_REGS_VEC_VM, 0);
+}
+
+void riscv_registers(const RISCVDecoded *dec, RISCVRegisters *regs) {
+	rz_return_if_fail(dec && regs && dec->id < RISCV_INS_COUNT);
+	riscv_registers_roles(instructions[dec->id].regs, dec, regs);
+}
+
+/**
+ * Fills effect with the sp adjustment and the memory access of the instruction.
+ * Returns false when the instruction neither writes sp nor accesses memory.
+ */
+bool riscv_stack_effect(const RISCVDecoded *dec, RISCVStackEffect *effect) {
+	rz_return_val_if_fail(dec && effect && dec->id < RISCV_INS_COUNT, false);
+	const RISCVAnalysis *info = riscv_analysis(dec->id);
+	RISCVRegisters regs = { 0 };
+
+	memset(effect, 0, sizeof(RISCVStackEffect));
+	riscv_registers(dec, &regs);
+	if (dec->id == RISCV_INS_ADDI && dec->rd == RISCV_REG_SP && dec->rs1 == RISCV_REG_SP) {
+		effect->delta = dec->imm;
+	} else if (regs.gpr_def & (1u << RISCV_REG_SP)) {
+		effect->clobber = true;
+	}
+	if (info->memsize && instructions[dec->id].imm != RISCV_IMM_NONE &&
+		(info->type == RZ_ANALYSIS_OP_TYPE_LOAD || info->type == RZ_ANALYSIS_OP_TYPE_STORE)) {
+		effect->base = dec->rs1;
+		effect->offset = dec->imm;
+		effect->size = info->memsize;
+		effect->write = info->type == RZ_ANALYSIS_OP_TYPE_STORE;
+	}
+	return effect->delta || effect->clobber || effect->size;
+}
+
+/**
+ * Marks the vector configuration as not known, as at the start of a block
+ */
+void riscv_vector_reset(RISCVVectorState *state) {
+	rz_return_if_fail(state);
+	memset(state, 0, sizeof(RISCVVectorState));
+}
+
+/* applies the vtype bits: vlmul[2:0], vsew[5:3], vta[6], vma[7] */
+static void riscv_vector_vtype(RISCVVectorState *state, ut64 vtype) {
+	ut32 vlmul = vtype & 7;
+	ut32 vsew = (vtype >> 3) & 7;
+	if (vlmul == 4 || vsew > 3) {
+		/* reserved values set vill */
+		riscv_vector_reset(state);
+		return;
+	}
+	state->sew = 8 << vsew;
+	state->lmul = vlmul < 4 ? (st32)vlmul : (st32)vlmul - 8;
+	state->ta = vtype & (1 << 6);
+	state->ma = vtype & (1 << 7);
+}
+
+static const RISCVVectorShape *riscv_vector_shape(ut16 id) {
+	ut32 lo = 0, hi = RZ_ARRAY_SIZE(vector_shapes);
+	while (lo < hi) {
+		ut32 mid = lo + (hi - lo) / 2;
+		if (vector_shapes[mid].id < id) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo < RZ_ARRAY_SIZE(vector_shapes) && vector_shapes[lo].id == id ? &vector_shapes[lo] : NULL;
+}
+
+static st32 riscv_log2(ut32 x) {
+	st32 n = 0;
+	while (x > 1) {
+		x >>= 1;
+		n++;
+	}
+	return n;
+}
+
+/* registers of the group starting at reg, one register when the configuration is not known */
+static ut32 riscv_vector_group(const RISCVVectorState *state, const RISCVVectorShape *shape, ut32 whole, ut8 group, ut8 reg, ut32 fields) {
+	st32 emul = 0;
+	if (group == RISCV_VGROUP_WHOLE) {
+		emul = riscv_log2(whole);
+	} else if (state->sew) {
+		switch (group) {
+		case RISCV_VGROUP_LMUL:
+			emul = state->lmul;
+			break;
+		case RISCV_VGROUP_WIDE:
+			emul = state->lmul + 1;
+			break;
+		case RISCV_VGROUP_FRAC2:
+			emul = state->lmul - 1;
+			break;
+		case RISCV_VGROUP_FRAC4:
+			emul = state->lmul - 2;
+			break;
+		case RISCV_VGROUP_FRAC8:
+			emul = state->lmul - 3;
+			break;
+		case RISCV_VGROUP_EEW:
+			emul = state->lmul + riscv_log2(shape->eew) - riscv_log2(state->sew);
+			break;
+		default:
+			break;
+		}
+	}
+	/* fractional groups still take a whole register, groups are at most 8 registers */
+	ut32 n = (emul > 0 ? 1u << RZ_MIN(emul, 3) : 1) * fields;
+	if (n >= 32) {
+		return UT32_MAX << reg;
+	}
+	return (ut32)(((1ull << n) - 1) << reg);
+}
+
+/**
+ * Tracks vsetvli/vsetivli/vsetvl in state and annotates the vector instruction
+ * with the configuration it executes with and the registers of its groups.
+ * When the configuration is not known every group is assumed to be a single
+ * register and the tail and mask policies to be undisturbed.
+ * Returns false and leaves state untouched when the instruction is not a vector one.
+ */
+bool riscv_vector_op(RISCVVectorState *state, const RISCVDecoded *dec, RISCVVectorOp *op) {
+	rz_return_val_if_fail(state && dec && op && dec->id < RISCV_INS_COUNT, false);
+	memset(op, 0, sizeof(RISCVVectorOp));
+	op->nf = 1;
+	switch (dec->id) {
+	case RISCV_INS_VSETVLI:
+	case RISCV_INS_VSETIVLI:
+		riscv_vector_vtype(state, dec->imm);
+		op->vtype = *state;
+		return true;
+	case RISCV_INS_VSETVL:
+		/* vtype is read from rs2 */
+		riscv_vector_reset(state);
+		return true;
+	default:
+		break;
+	}
+
+	const RISCVVectorShape *shape = riscv_vector_shape(dec->id);
+	if (!shape) {
+		return false;
+	}
+	ut32 roles = instructions[dec->id].regs;
+	op->vtype = *state;
+	op->masked = (roles & RISCV_REGS_VEC_VM) && !(dec->data & (1 << 25));
+	op->eew = shape->eew;
+	if (shape->flags & RISCV_VSHAPE_SEGMENT) {
+		op->nf = (dec->data >> 29) + 1;
+	}
+
+	/* vmvnfr.v encodes the registers count minus one in simm5 */
+	ut32 whole = shape->count ? shape->count : (dec->rs1 & 7) + 1;
+	ut32 vd = riscv_vector_group(state, shape, whole, shape->vd, dec->rd, op->nf);
+	if (roles & RISCV_REGS_VEC_RD) {
+		op->vec_def = vd;
+		/* undisturbed elements keep the old value of vd, mask destinations are always tail agnostic */
+		bool tail = shape->vd != RISCV_VGROUP_MASK && shape->vd != RISCV_VGROUP_WHOLE && !state->ta;
+		if (tail || (op->masked && !state->ma)) {
+			op->vec_use |= vd;
+		}
+	}
+	if (roles & RISCV_REGS_VEC_RD_USE) {
+		op->vec_use |= vd;
+	}
+	if (roles & RISCV_REGS_VEC_RS1) {
+		op->vec_use |= riscv_vector_group(state, shape, whole, shape->vs1, dec->rs1, 1);
+	}
+	if (roles & RISCV_REGS_VEC_RS2) {
+		op->vec_use |= riscv_vector_group(state, shape, whole, shape->vs2, dec->rs2, 1);
+	}
+	if (op->masked || (shape->flags & RISCV_VSHAPE_CARRY)) {
+		op->vec_use |= 1;
+	}
+	return true;
+}
+
+bool riscv_decode_word(ut32 data, RISCVDecoded *dec) {
+	rz_return_val_if_fail(dec, false);
+	st32 id = riscv_lookup(data);
+	if (id < 0) {
+		return false;
+	}
+	dec->data = data;
+	dec->id = id;
+	dec->size = 4;
+	dec->rd = (data >> 7) & 0x1f;
+	dec->rs1 = (data >> 15) & 0x1f;
+	dec->rs2 = (data >> 20) & 0x1f;
+	dec->rs3 = data >> 27;
+	dec->imm = riscv_immediate(instructions[id].imm, data);
+	return true;
+}
+
+bool riscv_decode(const ut8 *buffer, const ut32 size, bool be, RISCVDecoded *dec) {
+	rz_return_val_if_fail(buffer && dec, false);
+	if (size < 4) {
+		return false;
+	}
+	return riscv_decode_word(rz_read_ble32(buffer, be), dec);
+}
 
 ut32 riscv_disassembler(const ut8 *buffer, const ut32 size, ut64 pc, bool be, RzStrBuf *sb) {
 	rz_return_val_if_fail(buffer && size && sb, false);
-	if (size < 2) {
+	if (size < 4) {
 		return RISCV_INVALID_SIZE;
 	}
 
-	ut32 masked;
-	ut32 data = rz_read_ble16(buffer, be);
+	RISCVDecoded dec;
+	if (!riscv_decode(buffer, size, be, &dec)) {
+		return RISCV_INVALID_SIZE;
+	}
+	if (riscv_alias(&dec, pc, sb)) {
+		return dec.size;
+	}
+	const RISCVStandard *standard = riscv_standard(dec.id);
+	const RISCVDescription *desc = &standard->descriptions[dec.id - standard->first];
+	return decoders[desc->decode](standard->names + desc->name, dec.data, pc, sb);
+}
+
+#ifndef RISCV_STANDALONE
+ut32 riscv_analyze(const ut8 *buffer, const ut32 size, ut64 pc, bool be, RzAnalysisOp *op) {
+	rz_return_val_if_fail(buffer && size && op, RISCV_INVALID_SIZE);
+	RISCVDecoded dec;
+
+	op->addr = pc;
+	op->jump = UT64_MAX;
+	op->fail = UT64_MAX;
+	op->ptr = UT64_MAX;
+	op->val = UT64_MAX;
+	if (!riscv_decode(buffer, size, be, &dec)) {
+		op->type = RZ_ANALYSIS_OP_TYPE_ILL;
+		op->size = size < 4 ? size : 4;
+		return RISCV_INVALID_SIZE;
+	}
 
-	for (ut32 i = 0; i < RZ_ARRAY_SIZE(instructions); ++i) {
-		masked = data & instructions[i].mbits;
-		if (masked == instructions[i].cbits) {
-			return instructions[i].decode(instructions[i].name, data, pc, sb);
+	const RISCVAnalysis *info = riscv_analysis(dec.id);
+	op->id = dec.id;
+	op->size = dec.size;
+	op->type = info->type;
+	op->family = info->family;
+	op->cond = info->cond;
+
+	switch (info->type) {
+	case RZ_ANALYSIS_OP_TYPE_JMP:
+		/* jal, any link register other than zero makes it a call */
+		op->jump = pc + dec.imm;
+		if (dec.rd != RISCV_REG_ZERO) {
+			op->type = RZ_ANALYSIS_OP_TYPE_CALL;
+			op->fail = pc + dec.size;
+		}
+		break;
+	case RZ_ANALYSIS_OP_TYPE_RJMP:
+		/* jalr */
+		if (dec.rd == RISCV_REG_ZERO && dec.rs1 == RISCV_REG_RA && !dec.imm) {
+			op->type = RZ_ANALYSIS_OP_TYPE_RET;
+			op->eob = true;
+		} else if (dec.rs1 == RISCV_REG_ZERO) {
+			op->type = dec.rd == RISCV_REG_ZERO ? RZ_ANALYSIS_OP_TYPE_JMP : RZ_ANALYSIS_OP_TYPE_CALL;
+			op->jump = (ut64)dec.imm;
+		} else if (dec.rd != RISCV_REG_ZERO) {
+			op->type = RZ_ANALYSIS_OP_TYPE_RCALL;
+		}
+		if (dec.rd != RISCV_REG_ZERO) {
+			op->fail = pc + dec.size;
+		}
+		break;
+	case RZ_ANALYSIS_OP_TYPE_CJMP:
+		op->jump = pc + dec.imm;
+		op->fail = pc + dec.size;
+		break;
+	case RZ_ANALYSIS_OP_TYPE_RET:
+		op->eob = true;
+		break;
+	case RZ_ANALYSIS_OP_TYPE_LOAD:
+	case RZ_ANALYSIS_OP_TYPE_STORE:
+	case RZ_ANALYSIS_OP_TYPE_XCHG:
+		op->refptr = info->memsize;
+		op->ptrsize = info->memsize;
+		if (dec.rs1 == RISCV_REG_SP && instructions[dec.id].imm != RISCV_IMM_NONE) {
+			op->stackop = info->type == RZ_ANALYSIS_OP_TYPE_LOAD ? RZ_ANALYSIS_STACK_GET : RZ_ANALYSIS_STACK_SET;
+			op->ptr = dec.imm;
+		} else if (dec.rs1 == RISCV_REG_ZERO) {
+			op->ptr = dec.imm;
 		}
+		break;
+	case RZ_ANALYSIS_OP_TYPE_LEA:
+		/* auipc */
+		op->ptr = pc + dec.imm;
+		break;
+	case RZ_ANALYSIS_OP_TYPE_ADD:
+		if (instructions[dec.id].imm != RISCV_IMM_I || info->family != RZ_ANALYSIS_OP_FAMILY_CPU) {
+			break;
+		}
+		op->val = dec.imm;
+		if (dec.rd == RISCV_REG_SP && dec.rs1 == RISCV_REG_SP) {
+			op->stackop = RZ_ANALYSIS_STACK_INC;
+			op->stackptr = -dec.imm;
+		}
+		break;
+	default:
+		if (instructions[dec.id].imm != RISCV_IMM_NONE) {
+			op->val = dec.imm;
+		}
+		break;
 	}
-	return RISCV_INVALID_SIZE;
+	return dec.size;
 }
+#endif /* RISCV_STANDALONE */
 """)
-
@@ -14,6 +14,7 @@ mask = OrderedDict()
 pseudos = {}
 arguments = {}
 standard = {}
+csrs = OrderedDict()
 
 # operands begin/end in bits (needs to be reversed)
 operand_pos = {
@@ -36,6 +37,7 @@ operand_pos = {
   'imm20': (31,12),
   'jimm20': (31,12),
   'imm12': (31,20),
+  'csr': (31,20),
   'imm12hi': (31,25),
   'bimm12hi': (31,25),
   'imm12lo': (11,7),
@@ -101,6 +103,7 @@ operand_mask = {
   'imm20': "l" * (1 + 31 - 12),
   'jimm20': "m" * (1 + 31 - 12),
   'imm12': "n" * (1 + 31 - 20),
+  'csr': "n" * (1 + 31 - 20),
   'imm12hi': "o" * (1 + 31 - 25),
   'bimm12hi': "p" * (1 + 31 - 25),
   'imm12lo': "q" * (1 + 11 - 7),
@@ -145,8 +148,8 @@ operand_mask = {
   'cjimm': "Z" * (1 + 12 - 2),
 }
 
-# these are sorted on purpose
-r_type_operands = ['wd', 'vd', 'vs1', 'vs2', 'vs3', 'rd', 'rs1', 'rs2', 'rs3', 'fd', 'fs1', 'fs2', 'fs3', 'rm']
+# these are sorted on purpose (destinations first)
+r_type_operands = ['wd', 'vd', 'rd', 'fd', 'vs1', 'vs2', 'vs3', 'rs1', 'rs2', 'rs3', 'fs1', 'fs2', 'fs3', 'rm']
 
 registers_flt = {
   'rd': 'fd',
@@ -155,6 +158,13 @@ registers_flt = {
   'rs3': 'fs3',
 }
 
+float_standards = [
+  'rv32f', 'rv64f', 'rv32d', 'rv64d', 'rv32q', 'rv64q',
+  'rv32zfh', 'rv64zfh', 'rv32d-zfh', 'rv32q-zfh',
+]
+
+integer_formats = ['x', 'w', 'wu', 'l', 'lu']
+
 def mask_arg(s, n):
   beg, end = operand_pos[n]
   beg = 31 - beg
@@ -198,6 +208,9 @@ def operand_type(name):
 
   if name in ['pred', 'succ', 'rm']:
     return 'choice'
+
+  if name == 'csr':
+    return 'csr'
   
   if name in r_type_operands:
     return 'register'
@@ -217,14 +230,14 @@ def operand_choice(name):
   if name == 'aqrl':
     return [
       ['', 0b00 ],
-      ['.lr', 0b01 ],
+      ['.rl', 0b01 ],
       ['.aq', 0b10 ],
-      ['.aqlr', 0b11 ],
+      ['.aqrl', 0b11 ],
     ]
 
   if name in ['pred', 'succ']:
     return [
-      ['', 0b0000 ],
+      ['0', 0b0000 ],
       ['w', 0b0001 ],
       ['r', 0b0010 ],
       ['rw', 0b0011 ],
@@ -270,7 +283,7 @@ def create_exec_env_type(name, cbits, operands):
   }
 
 def create_fence_type(name, cbits, operands):
-  fmt = " {pred}, {succ}"
+  fmt = "{suffix} {pred}, {succ}"
   if name in pseudos:
     fmt = ""
   return {
@@ -287,7 +300,8 @@ def create_fence_i_type(name, cbits, operands):
   }
 
 def create_amo_type(name, cbits, operands):
-  fmt = "{suffix} {rd}, {rs1}, ({rs2})" if 'rs2' in operands else "{suffix} {rd}, ({rs1})"
+  # isa order, the address is the last operand
+  fmt = "{suffix} {rd}, {rs2}, ({rs1})" if 'rs2' in operands else "{suffix} {rd}, ({rs1})"
   return {
     'format': "{name}" + fmt,
     'type': 'amo',
@@ -295,7 +309,9 @@ def create_amo_type(name, cbits, operands):
   }
 
 def create_ish_type(name, cbits, operands):
-  if 'rd' in operands:
+  if 'rs3' in operands:
+    fmt = " {rd}, {rs1}, {rs3}, {shamt}"
+  elif 'rd' in operands:
     fmt = " {rd}, {rs1}, {shamt}" if 'rs1' in operands else " {rd}, {shamt}"
   elif 'fd' in operands:
     fmt = " {fd}, {fs1}, {shamt}" if 'fs1' in operands else " {fd}, {shamt}"
@@ -306,7 +322,12 @@ def create_ish_type(name, cbits, operands):
   }
 
 def create_ishw_type(name, cbits, operands):
-  fmt = "{name} {fd}, {shamtw}" if "fd" in operands else "{name} {rd}, {shamtw}"
+  if 'rs3' in operands:
+    fmt = "{name} {rd}, {rs1}, {rs3}, {shamtw}"
+  elif 'rs1' in operands:
+    fmt = "{name} {rd}, {rs1}, {shamtw}"
+  else:
+    fmt = "{name} {fd}, {shamtw}" if "fd" in operands else "{name} {rd}, {shamtw}"
   return {
     'format': fmt,
     'type': 'ishw',
@@ -328,14 +349,19 @@ def create_uj_type(name, cbits, operands):
   }
 
 def create_csr_type(name, cbits, operands):
+  fmt = "{name} {rd}, {csr}, {rs1}" if 'rs1' in operands else "{name} {rd}, {csr}, {zimm}"
   return {
-    'format': "{name} {rd}, {rs1}, {imm12}",
+    'format': fmt,
     'type': 'csr',
     'bitfields': list(map(create_operand, operands)),
   }
 
 def create_i_type(name, cbits, operands):
-  fmt = "{name} {fd}, {fs1}, {imm12}" if "fd" in operands else "{name} {rd}, {rs1}, {imm12}"
+  # loads and jalr address memory like the stores: imm12(rs1)
+  if cbits & 0x7f in [0x03, 0x07, 0x67]:
+    fmt = "{name} {fd}, {imm12}({rs1})" if "fd" in operands else "{name} {rd}, {imm12}({rs1})"
+  else:
+    fmt = "{name} {fd}, {rs1}, {imm12}" if "fd" in operands else "{name} {rd}, {rs1}, {imm12}"
   return {
     'format': fmt,
     'type': 'i',
@@ -343,7 +369,7 @@ def create_i_type(name, cbits, operands):
   }
 
 def create_s3_type(name, cbits, operands):
-  fmt = "{name} {fs1}, {imm12}({fs2})" if "fs1" in operands else "{name} {rs1}, {imm12}({rs2})"
+  fmt = "{name} {fs2}, {imm12}({rs1})" if "fs2" in operands else "{name} {rs2}, {imm12}({rs1})"
   return {
     'format': fmt,
     'type': 's3',
@@ -442,6 +468,31 @@ def make_json():
     })
   print(json.dumps(obj, sort_keys=True, indent=4))
 
+def float_arguments(name, operands):
+  if standard[name] not in float_standards and not name.startswith('fmv.'):
+    return operands
+  parts = name.split('.')
+  if len(parts) < 2:
+    # loads and stores use an integer base address
+    return [ registers_flt[a] if a in registers_flt and a != 'rs1' else a for a in operands]
+  # fcvt.<dest>.<source>, fmv.x.<fmt>, fmv.<fmt>.x and comparisons move data between register files
+  formats = integer_formats if parts[0] == 'fcvt' else ['x']
+  integer_rd = parts[0] in ['fclass', 'feq', 'flt', 'fle'] or (parts[0] in ['fcvt', 'fmv'] and parts[1] in formats)
+  integer_rs1 = parts[0] in ['fcvt', 'fmv'] and parts[-1] in formats
+  def convert(a):
+    if a not in registers_flt or (a == 'rd' and integer_rd) or (a == 'rs1' and integer_rs1):
+      return a
+    return registers_flt[a]
+  return list(map(convert, operands))
+
+def immediate_arguments(name, operands):
+  if name in ['csrrwi', 'csrrsi', 'csrrci']:
+    # rs1 holds the 5 bits zero extended immediate
+    operands = [ 'zimm' if a == 'rs1' else a for a in operands]
+  if name in ['csrrw', 'csrrs', 'csrrc', 'csrrwi', 'csrrsi', 'csrrci']:
+    operands = [ 'csr' if a == 'imm12' else a for a in operands]
+  return operands
+
 def parse_inputs(args):
   for fn in args:
     f = open(fn)
@@ -512,20 +563,41 @@ def parse_inputs(args):
 
 
       # convert reg arguments to floating point reg arguments
-      if name[0] == 'f':
-        if name in ['fcvt.w.s', 'fcvt.wu.s', 'fcvt.l.s', 'fcvt.lu.s', 'fcvt.w.q', 'fcvt.wu.q', 'fcvt.l.q', 'fcvt.lu.q']:
-          arguments[name] = [ registers_flt[a] if a == 'rs1' else a for a in arguments[name]]
-        elif name in ['fcvt.s.w', 'fcvt.s.wu', 'fcvt.s.l', 'fcvt.s.lu', 'fcvt.q.w', 'fcvt.q.wu', 'fcvt.q.l', 'fcvt.q.lu']:
-          arguments[name] = [ registers_flt[a] if a == 'rd' else a for a in arguments[name]]
-        else:
-          arguments[name] = [ registers_flt[a] if a in registers_flt else a for a in arguments[name]]
+      arguments[name] = float_arguments(name, arguments[name])
+      arguments[name] = immediate_arguments(name, arguments[name])
 
       namelist.append(name)
 
     f.close()
   return (namelist, pseudos, mask, match, arguments)
 
+def parse_csrs(args):
+  # each line is <number>, "<name>"; csrs32.csv holds the rv32 only high halves
+  for fn in args:
+    rv32 = os.path.basename(fn).startswith('csrs32')
+    f = open(fn)
+    for line in f:
+      tokens = [ t.strip().strip('"') for t in line.partition('#')[0].split(',') ]
+      if len(tokens) < 2:
+        continue
+      number = int(tokens[0], 0)
+      if number >= (1 << 12):
+        sys.exit("%s: bad csr number 0x%x" % (tokens[1], number))
+      if number in csrs:
+        sys.exit("%s and %s overlap" % (tokens[1], csrs[number]['name']))
+      csrs[number] = { 'csr': number, 'name': tokens[1], 'rv32': rv32 }
+    f.close()
+  return csrs
+
+def make_csrs_json():
+  obj = [ csrs[n] for n in sorted(csrs.keys()) ]
+  print(json.dumps(obj, sort_keys=True, indent=4))
+
 if __name__ == "__main__":
+  if len(sys.argv) > 2 and sys.argv[1] == '--csr':
+    parse_csrs(sys.argv[2:])
+    make_csrs_json()
+    sys.exit(0)
   if len(sys.argv) < 2:
     sys.exit("{} riscv-opcodes/opcodes-*".format(sys.argv[0]))
   parse_inputs(sys.argv[1:])
@@ -0,0 +1,276 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_blob.h"
+
+/* bits of the widest key, the index of a node has 1 << bits entries */
+#define BLOB_KEY_BITS 16
+
+static ut16 blob_table(const RISCVBlob *blob, ut64 index) {
+	if (index >= blob->sizes[RISCV_BLOB_TABLE] / sizeof(ut16)) {
+		return UT16_MAX;
+	}
+	return rz_read_le16(blob->sections[RISCV_BLOB_TABLE] + index * sizeof(ut16));
+}
+
+static cchar *blob_string(const RISCVBlob *blob, ut32 offset) {
+	if (offset >= blob->sizes[RISCV_BLOB_POOL]) {
+		return NULL;
+	}
+	return (cchar *)blob->sections[RISCV_BLOB_POOL] + offset;
+}
+
+static const RISCVBlobInsn *blob_insn(const RISCVBlob *blob, ut32 id) {
+	if (id >= blob->n_insns) {
+		return NULL;
+	}
+	return (const RISCVBlobInsn *)blob->sections[RISCV_BLOB_INSNS] + id;
+}
+
+/**
+ * Uses the blob stored in buffer in place, the buffer must be 4 bytes aligned
+ * and outlive the returned object. Only the header is checked, every access
+ * to the tables is bounds checked.
+ */
+RISCVBlob *riscv_blob_new(const ut8 *buffer, ut64 size) {
+	rz_return_val_if_fail(buffer, NULL);
+	const RISCVBlobHeader *header = (const RISCVBlobHeader *)buffer;
+	if (((size_t)buffer & 3) || size < sizeof(RISCVBlobHeader) || memcmp(header->magic, RISCV_BLOB_MAGIC, 4) ||
+		rz_read_le16(&header->version) != RISCV_BLOB_VERSION ||
+		rz_read_le16(&header->n_sections) != RISCV_BLOB_SECTIONS ||
+		rz_read_le32(&header->size) != size) {
+		return NULL;
+	}
+
+	RISCVBlob *blob = RZ_NEW0(RISCVBlob);
+	if (!blob) {
+		return NULL;
+	}
+	blob->buffer = buffer;
+	blob->n_insns = rz_read_le32(&header->n_insns);
+	for (ut32 i = 0; i < RISCV_BLOB_SECTIONS; ++i) {
+		ut64 offset = rz_read_le32(&header->sections[i].offset);
+		ut64 length = rz_read_le32(&header->sections[i].size);
+		if (offset < sizeof(RISCVBlobHeader) || (offset & 3) || offset + length > size) {
+			goto fail;
+		}
+		blob->sections[i] = buffer + offset;
+		blob->sizes[i] = length;
+	}
+
+	/* the fixed size sections, the pool must end with a NUL */
+	const ut32 *sizes = blob->sizes;
+	if (blob->n_insns >= UT16_MAX ||
+		sizes[RISCV_BLOB_INSNS] < (ut64)blob->n_insns * sizeof(RISCVBlobInsn) ||
+		sizes[RISCV_BLOB_NODES] < 128 * sizeof(RISCVBlobNode) ||
+		sizes[RISCV_BLOB_REGISTERS] < 96 * sizeof(ut16) ||
+		sizes[RISCV_BLOB_CSRS] < 4096 * sizeof(ut16) ||
+		!sizes[RISCV_BLOB_POOL] || blob->sections[RISCV_BLOB_POOL][sizes[RISCV_BLOB_POOL] - 1]) {
+		goto fail;
+	}
+	return blob;
+
+fail:
+	free(blob);
+	return NULL;
+}
+
+/**
+ * Maps the blob stored in the file, the tables are used without copying them.
+ */
+RISCVBlob *riscv_blob_open(const char *path) {
+	rz_return_val_if_fail(path, NULL);
+	RzMmap *map = rz_file_mmap(path, RZ_PERM_R, 0, 0);
+	if (!map) {
+		return NULL;
+	}
+	RISCVBlob *blob = riscv_blob_new(map->buf, map->len);
+	if (!blob) {
+		rz_file_mmap_free(map);
+		return NULL;
+	}
+	blob->map = map;
+	return blob;
+}
+
+void riscv_blob_free(RISCVBlob *blob) {
+	if (!blob) {
+		return;
+	}
+	rz_file_mmap_free(blob->map);
+	free(blob);
+}
+
+/* concatenates the (shift, width) fields of data, the first one in the low bits */
+static ut32 blob_key(const ut8 fields[][2], ut32 n_fields, ut32 data, ut32 *bits) {
+	ut32 key = 0;
+	*bits = 0;
+	for (ut32 i = 0; i < n_fields && fields[i][1]; ++i) {
+		ut32 shift = fields[i][0], width = fields[i][1];
+		if (shift > 31 || *bits + width > BLOB_KEY_BITS) {
+			break;
+		}
+		key |= ((data >> shift) & ((1u << width) - 1)) << *bits;
+		*bits += width;
+	}
+	return key;
+}
+
+static st64 blob_immediate(const RISCVBlob *blob, ut8 kind, ut32 data) {
+	if (kind >= blob->sizes[RISCV_BLOB_IMMEDIATES] / sizeof(RISCVBlobImmediate)) {
+		return 0;
+	}
+	const RISCVBlobImmediate *imm = (const RISCVBlobImmediate *)blob->sections[RISCV_BLOB_IMMEDIATES] + kind;
+	ut32 value = 0;
+	for (ut32 i = 0; i < imm->n_pieces && i < 4; ++i) {
+		const ut8 *piece = imm->pieces[i];
+		if (piece[0] > 31 || piece[1] > 31 || piece[2] > 31) {
+			break;
+		}
+		value |= ((data >> piece[0]) & ((1u << piece[1]) - 1)) << piece[2];
+	}
+	if (imm->sign && imm->sign <= 32) {
+		ut32 shift = 32 - imm->sign;
+		return (st32)(value << shift) >> shift;
+	}
+	return value;
+}
+
+/**
+ * Decodes the instruction with the blob tables, the ids are the positions
+ * in the blob and match RISCVInsId only when generated from the same tables.
+ */
+bool riscv_blob_decode_word(const RISCVBlob *blob, ut32 data, RISCVDecoded *dec) {
+	rz_return_val_if_fail(blob && dec, false);
+	const RISCVBlobNode *node = (const RISCVBlobNode *)blob->sections[RISCV_BLOB_NODES] + (data & 0x7f);
+	ut32 bits;
+	ut32 key = blob_key(node->key, 4, data, &bits);
+	ut16 entry = blob_table(blob, (ut64)rz_read_le32(&node->index) + key);
+	if (entry != UT16_MAX && (entry & RISCV_BLOB_NESTED)) {
+		key = blob_key(node->nested, 2, data, &bits);
+		entry = blob_table(blob, (ut64)rz_read_le32(&node->blocks) + (((ut64)(entry & ~RISCV_BLOB_NESTED) << bits) | key));
+	}
+	if (entry == UT16_MAX) {
+		return false;
+	}
+
+	for (ut64 i = (ut64)rz_read_le32(&node->candidates) + entry;; ++i) {
+		ut16 id = blob_table(blob, i);
+		const RISCVBlobInsn *insn = blob_insn(blob, id);
+		if (!insn) {
+			return false;
+		} else if ((data & rz_read_le32(&insn->mask)) != rz_read_le32(&insn->match)) {
+			continue;
+		}
+		dec->data = data;
+		dec->id = id;
+		dec->size = insn->size;
+		dec->rd = (data >> 7) & 0x1f;
+		dec->rs1 = (data >> 15) & 0x1f;
+		dec->rs2 = (data >> 20) & 0x1f;
+		dec->rs3 = data >> 27;
+		dec->imm = blob_immediate(blob, insn->imm, data);
+		return true;
+	}
+}
+
+bool riscv_blob_decode(const RISCVBlob *blob, const ut8 *buffer, const ut32 size, bool be, RISCVDecoded *dec) {
+	rz_return_val_if_fail(buffer && dec, false);
+	if (size < 4) {
+		return false;
+	}
+	return riscv_blob_decode_word(blob, rz_read_ble32(buffer, be), dec);
+}
+
+cchar *riscv_blob_mnemonic(const RISCVBlob *blob, ut16 id) {
+	rz_return_val_if_fail(blob, NULL);
+	const RISCVBlobInsn *insn = blob_insn(blob, id);
+	return insn ? blob_string(blob, rz_read_le16(&insn->name)) : NULL;
+}
+
+/**
+ * Returns the RISCV_REGS_* roles of the instruction, to be used with riscv_registers_roles()
+ */
+ut16 riscv_blob_roles(const RISCVBlob *blob, ut16 id) {
+	rz_return_val_if_fail(blob, 0);
+	const RISCVBlobInsn *insn = blob_insn(blob, id);
+	return insn ? rz_read_le16(&insn->regs) : 0;
+}
+
+static void blob_operand(const RISCVBlob *blob, ut8 index, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	if (index >= blob->sizes[RISCV_BLOB_OPERANDS] / sizeof(RISCVBlobOperand)) {
+		return;
+	}
+	const RISCVBlobOperand *op = (const RISCVBlobOperand *)blob->sections[RISCV_BLOB_OPERANDS] + index;
+	ut32 field = op->shift < 32 && op->width < 32 ? (dec->data >> op->shift) & ((1u << op->width) - 1) : 0;
+	cchar *name = NULL;
+	switch (op->kind) {
+	case RISCV_BLOB_OP_GPR:
+	case RISCV_BLOB_OP_FPR:
+	case RISCV_BLOB_OP_VEC:
+		name = blob_string(blob, rz_read_le16(blob->sections[RISCV_BLOB_REGISTERS] + ((op->kind * 32) + (field & 0x1f)) * sizeof(ut16)));
+		break;
+	case RISCV_BLOB_OP_IMM:
+		rz_strbuf_appendf(sb, "%" PFMT64d, dec->imm);
+		return;
+	case RISCV_BLOB_OP_TARGET:
+		rz_strbuf_appendf(sb, "0x%" PFMT64x, pc + dec->imm);
+		return;
+	case RISCV_BLOB_OP_HEX:
+		rz_strbuf_appendf(sb, "0x%x", field);
+		return;
+	case RISCV_BLOB_OP_CSR: {
+		ut16 offset = rz_read_le16(blob->sections[RISCV_BLOB_CSRS] + (field & 0xfff) * sizeof(ut16));
+		name = offset ? blob_string(blob, offset) : NULL;
+		if (!name) {
+			rz_strbuf_appendf(sb, "0x%03x", field);
+			return;
+		}
+		break;
+	}
+	case RISCV_BLOB_OP_CHOICE: {
+		ut16 offset = blob_table(blob, (ut64)rz_read_le32(&op->choices) + field);
+		name = offset != UT16_MAX ? blob_string(blob, offset) : NULL;
+		if (!name) {
+			rz_strbuf_appendf(sb, "%u", field);
+			return;
+		}
+		break;
+	}
+	default:
+		return;
+	}
+	if (name) {
+		rz_strbuf_append(sb, name);
+	}
+}
+
+ut32 riscv_blob_disassembler(const RISCVBlob *blob, const ut8 *buffer, const ut32 size, ut64 pc, bool be, RzStrBuf *sb) {
+	rz_return_val_if_fail(blob && buffer && size && sb, RISCV_INVALID_SIZE);
+	RISCVDecoded dec;
+	if (!riscv_blob_decode(blob, buffer, size, be, &dec)) {
+		return RISCV_INVALID_SIZE;
+	}
+	const RISCVBlobInsn *insn = blob_insn(blob, dec.id);
+	cchar *name = blob_string(blob, rz_read_le16(&insn->name));
+	cchar *format = blob_string(blob, rz_read_le16(&insn->format));
+	if (!name || !format) {
+		return RISCV_INVALID_SIZE;
+	}
+
+	/* the format bytes below 0x20 select the operands, the others are copied */
+	rz_strbuf_set(sb, name);
+	for (cchar *p = format; *p;) {
+		cchar *end = p;
+		while ((ut8)*end > 0x1f) {
+			end++;
+		}
+		if (end == p) {
+			blob_operand(blob, (ut8)*p++, &dec, pc, sb);
+			continue;
+		}
+		rz_strbuf_appendf(sb, "%.*s", (int)(end - p), p);
+		p = end;
+	}
+	return dec.size;
+}
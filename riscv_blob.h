@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_BLOB_H
+#define RISCV_BLOB_H
+
+#include "riscv_decode.h"
+
+/**
+ * Binary decode tables written by `generate_riscv_disassembler.py --blob`.
+ * The blob is position independent: all the fields are little endian and
+ * the offsets are relative to the start of the blob, so it is used in place.
+ */
+#define RISCV_BLOB_MAGIC   "RVDB"
+#define RISCV_BLOB_VERSION 1
+
+/* index entries with this bit set select a block of the nested table */
+#define RISCV_BLOB_NESTED 0x8000
+
+typedef enum {
+	RISCV_BLOB_INSNS = 0, /*  RISCVBlobInsn, the position is the id */
+	RISCV_BLOB_NODES, /*      RISCVBlobNode, one per major opcode */
+	RISCV_BLOB_TABLE, /*      ut16 candidate lists, indices and nested blocks */
+	RISCV_BLOB_OPERANDS, /*   RISCVBlobOperand, selected by the format bytes 0x01 to 0x1f */
+	RISCV_BLOB_IMMEDIATES, /* RISCVBlobImmediate, indexed by RISCVImmediate */
+	RISCV_BLOB_REGISTERS, /*  ut16 string offsets of the gpr, fpr and vector names */
+	RISCV_BLOB_CSRS, /*       ut16 string offsets of the csr names, 0 when unknown */
+	RISCV_BLOB_POOL, /*       NUL terminated strings, offset 0 is the empty string */
+	RISCV_BLOB_SECTIONS,
+} RISCVBlobSection;
+
+typedef enum {
+	RISCV_BLOB_OP_GPR = 0, /* register name of the field */
+	RISCV_BLOB_OP_FPR,
+	RISCV_BLOB_OP_VEC,
+	RISCV_BLOB_OP_IMM, /*    immediate, decimal */
+	RISCV_BLOB_OP_TARGET, /* pc + immediate */
+	RISCV_BLOB_OP_HEX, /*    raw field, hexadecimal */
+	RISCV_BLOB_OP_CSR, /*    csr name or number */
+	RISCV_BLOB_OP_CHOICE, /* string offsets in the table indexed by the field */
+} RISCVBlobOperandKind;
+
+typedef struct riscv_blob_header_t {
+	char magic[4];
+	ut16 version;
+	ut16 n_sections; /* RISCV_BLOB_SECTIONS */
+	ut32 size; /*       whole blob */
+	ut32 n_insns;
+	struct {
+		ut32 offset;
+		ut32 size;
+	} sections[RISCV_BLOB_SECTIONS];
+} RISCVBlobHeader;
+
+typedef struct riscv_blob_insn_t {
+	ut32 mask; /*   checked bits */
+	ut32 match; /*  expected value of the checked bits */
+	ut16 name; /*   string offset of the mnemonic */
+	ut16 format; /* string offset of the operands */
+	ut16 regs; /*   RISCV_REGS_* roles of the register operands */
+	ut8 imm; /*     RISCVImmediate */
+	ut8 size; /*    instruction size in bytes */
+} RISCVBlobInsn;
+
+/* the (shift, width) key fields index the candidate lists, width 0 ends the fields */
+typedef struct riscv_blob_node_t {
+	ut8 key[4][2];
+	ut8 nested[2][2];
+	ut32 candidates; /* table offset of the candidate lists */
+	ut32 index; /*      table offset of the index, entries are relative to candidates */
+	ut32 blocks; /*     table offset of the nested blocks */
+} RISCVBlobNode;
+
+typedef struct riscv_blob_operand_t {
+	ut8 kind; /*    RISCVBlobOperandKind */
+	ut8 shift; /*   field position */
+	ut8 width; /*   field width */
+	ut8 reserved;
+	ut32 choices; /* table offset of the choice names, UT16_MAX when a value has none */
+} RISCVBlobOperand;
+
+/* (shift, width, position) pieces of the immediate, sign extended from bit sign - 1 */
+typedef struct riscv_blob_immediate_t {
+	ut8 sign; /*  bits of the signed immediate, 0 when unsigned */
+	ut8 n_pieces;
+	ut8 pieces[4][3];
+	ut8 reserved[2];
+} RISCVBlobImmediate;
+
+typedef struct riscv_blob_t {
+	RzMmap *map; /* NULL when the memory is owned by the caller */
+	const ut8 *buffer;
+	const ut8 *sections[RISCV_BLOB_SECTIONS];
+	ut32 sizes[RISCV_BLOB_SECTIONS];
+	ut32 n_insns;
+} RISCVBlob;
+
+RISCV_API RISCVBlob *riscv_blob_new(const ut8 *buffer, ut64 size);
+RISCV_API RISCVBlob *riscv_blob_open(const char *path);
+RISCV_API void riscv_blob_free(RISCVBlob *blob);
+RISCV_API bool riscv_blob_decode_word(const RISCVBlob *blob, ut32 data, RISCVDecoded *dec);
+RISCV_API bool riscv_blob_decode(const RISCVBlob *blob, const ut8 *buffer, const ut32 size, bool be, RISCVDecoded *dec);
+RISCV_API cchar *riscv_blob_mnemonic(const RISCVBlob *blob, ut16 id);
+RISCV_API ut16 riscv_blob_roles(const RISCVBlob *blob, ut16 id);
+RISCV_API ut32 riscv_blob_disassembler(const RISCVBlob *blob, const ut8 *buffer, const ut32 size, ut64 pc, bool be, RzStrBuf *sb);
+
+#endif /* RISCV_BLOB_H */
@@ -0,0 +1,227 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_cfg.h"
+
+#define bit_get(set, i) ((set)[(i) >> 3] & (1u << ((i)&7)))
+#define bit_set(set, i) ((set)[(i) >> 3] |= (1u << ((i)&7)))
+
+/* state of the exploration, one bit per 32 bits word of the buffer */
+typedef struct cfg_builder_t {
+	const ut8 *buffer;
+	ut64 size;
+	ut64 base;
+	bool be;
+	ut64 n_words;
+	ut8 *visited; /* word decoded as part of a block */
+	ut8 *leader; /*  word starting a block */
+	ut8 *last; /*    word ending a block (branches, jumps and returns) */
+	RzVector /*<ut64>*/ todo;
+} CfgBuilder;
+
+static bool cfg_analyze(const CfgBuilder *b, ut64 word, RzAnalysisOp *op) {
+	memset(op, 0, sizeof(RzAnalysisOp));
+	ut64 offset = word * 4;
+	return riscv_analyze(b->buffer + offset, b->size - offset, b->base + offset, b->be, op) != RISCV_INVALID_SIZE;
+}
+
+static bool cfg_is_last(const RzAnalysisOp *op) {
+	switch (op->type) {
+	case RZ_ANALYSIS_OP_TYPE_JMP:
+	case RZ_ANALYSIS_OP_TYPE_CJMP:
+	case RZ_ANALYSIS_OP_TYPE_RJMP:
+	case RZ_ANALYSIS_OP_TYPE_RET:
+		return true;
+	default:
+		return false;
+	}
+}
+
+/* converts addr to a word index, false when outside of the buffer */
+static bool cfg_word(const CfgBuilder *b, ut64 addr, ut64 *word) {
+	if (addr < b->base || (addr - b->base) & 3 || (addr - b->base) / 4 >= b->n_words) {
+		return false;
+	}
+	*word = (addr - b->base) / 4;
+	return true;
+}
+
+static bool cfg_push(CfgBuilder *b, ut64 addr) {
+	ut64 word;
+	if (!cfg_word(b, addr, &word)) {
+		return true;
+	}
+	bit_set(b->leader, word);
+	return rz_vector_push(&b->todo, &word);
+}
+
+/* marks every reachable word, calls are not followed */
+static bool cfg_explore(CfgBuilder *b) {
+	RzAnalysisOp op;
+	ut64 word;
+	while (!rz_vector_empty(&b->todo)) {
+		rz_vector_pop(&b->todo, &word);
+		for (; word < b->n_words; ++word) {
+			if (bit_get(b->visited, word)) {
+				/* reached code already explored, which begins a block */
+				bit_set(b->leader, word);
+				break;
+			} else if (!cfg_analyze(b, word, &op)) {
+				break;
+			}
+			bit_set(b->visited, word);
+			if (!cfg_is_last(&op)) {
+				continue;
+			}
+			bit_set(b->last, word);
+			if (op.jump != UT64_MAX && !cfg_push(b, op.jump)) {
+				return false;
+			}
+			if (op.type == RZ_ANALYSIS_OP_TYPE_CJMP && !cfg_push(b, op.fail)) {
+				return false;
+			}
+			break;
+		}
+	}
+	return true;
+}
+
+static bool cfg_alloc(RISCVCfg *cfg, ut32 n_blocks) {
+	cfg->n_blocks = n_blocks;
+	cfg->addr = RZ_NEWS0(ut64, n_blocks + 1);
+	cfg->size = RZ_NEWS0(ut32, n_blocks + 1);
+	cfg->edge_offset = RZ_NEWS0(ut32, n_blocks + 1);
+	/* at most two successors per block */
+	cfg->edges = RZ_NEWS0(ut32, 2 * n_blocks + 1);
+	return cfg->addr && cfg->size && cfg->edge_offset && cfg->edges;
+}
+
+static void cfg_add_edge(RISCVCfg *cfg, ut64 addr) {
+	ut32 succ = riscv_cfg_block_at(cfg, addr);
+	if (succ != RISCV_CFG_INVALID && cfg->addr[succ] == addr) {
+		cfg->edges[cfg->n_edges++] = succ;
+	}
+}
+
+static bool cfg_build(CfgBuilder *b, RISCVCfg *cfg) {
+	/* a block begins at a leader or after a gap, and ends at a last word or before a leader */
+	ut32 n_blocks = 0;
+	for (ut64 w = 0; w < b->n_words; ++w) {
+		if (bit_get(b->visited, w) && (bit_get(b->leader, w) || !w || !bit_get(b->visited, w - 1) || bit_get(b->last, w - 1))) {
+			n_blocks++;
+		}
+	}
+	if (!cfg_alloc(cfg, n_blocks)) {
+		return false;
+	}
+
+	ut32 index = 0;
+	for (ut64 w = 0; w < b->n_words; ++w) {
+		if (!bit_get(b->visited, w)) {
+			continue;
+		}
+		if (bit_get(b->leader, w) || !w || !bit_get(b->visited, w - 1) || bit_get(b->last, w - 1)) {
+			cfg->addr[index++] = b->base + w * 4;
+		}
+		cfg->size[index - 1] += 4;
+	}
+
+	RzAnalysisOp op;
+	for (ut32 i = 0; i < n_blocks; ++i) {
+		ut64 end = cfg->addr[i] + cfg->size[i];
+		ut64 word = (end - b->base) / 4 - 1;
+		cfg->edge_offset[i] = cfg->n_edges;
+		if (!bit_get(b->last, word)) {
+			/* falls through into the next block */
+			cfg_add_edge(cfg, end);
+			continue;
+		}
+		if (!cfg_analyze(b, word, &op)) {
+			continue;
+		}
+		if (op.jump != UT64_MAX) {
+			cfg_add_edge(cfg, op.jump);
+		}
+		if (op.type == RZ_ANALYSIS_OP_TYPE_CJMP && op.fail != op.jump) {
+			cfg_add_edge(cfg, op.fail);
+		}
+	}
+	cfg->edge_offset[n_blocks] = cfg->n_edges;
+	return true;
+}
+
+/**
+ * Builds the control flow graph of the code reachable from the entries.
+ * Calls are not followed (their targets should be given as entries of
+ * their own graph) and indirect jumps end a block without successors.
+ */
+RISCVCfg *riscv_cfg_new(const ut8 *buffer, ut64 size, ut64 base, bool be, const ut64 *entries, ut32 n_entries) {
+	rz_return_val_if_fail(buffer && entries, NULL);
+	CfgBuilder b = { 0 };
+	b.buffer = buffer;
+	b.size = size;
+	b.base = base;
+	b.be = be;
+	b.n_words = size / 4;
+	b.visited = RZ_NEWS0(ut8, b.n_words / 8 + 1);
+	b.leader = RZ_NEWS0(ut8, b.n_words / 8 + 1);
+	b.last = RZ_NEWS0(ut8, b.n_words / 8 + 1);
+	rz_vector_init(&b.todo, sizeof(ut64), NULL, NULL);
+
+	RISCVCfg *cfg = RZ_NEW0(RISCVCfg);
+	if (!cfg || !b.visited || !b.leader || !b.last) {
+		goto fail;
+	}
+	for (ut32 i = 0; i < n_entries; ++i) {
+		if (!cfg_push(&b, entries[i])) {
+			goto fail;
+		}
+	}
+	if (!cfg_explore(&b) || !cfg_build(&b, cfg)) {
+		goto fail;
+	}
+
+	free(b.visited);
+	free(b.leader);
+	free(b.last);
+	rz_vector_fini(&b.todo);
+	return cfg;
+
+fail:
+	free(b.visited);
+	free(b.leader);
+	free(b.last);
+	rz_vector_fini(&b.todo);
+	riscv_cfg_free(cfg);
+	return NULL;
+}
+
+void riscv_cfg_free(RISCVCfg *cfg) {
+	if (!cfg) {
+		return;
+	}
+	free(cfg->addr);
+	free(cfg->size);
+	free(cfg->edge_offset);
+	free(cfg->edges);
+	free(cfg);
+}
+
+/**
+ * Returns the index of the block containing addr or RISCV_CFG_INVALID
+ */
+ut32 riscv_cfg_block_at(const RISCVCfg *cfg, ut64 addr) {
+	rz_return_val_if_fail(cfg, RISCV_CFG_INVALID);
+	ut32 lo = 0, hi = cfg->n_blocks;
+	while (lo < hi) {
+		ut32 mid = lo + (hi - lo) / 2;
+		if (addr < cfg->addr[mid]) {
+			hi = mid;
+		} else if (addr >= cfg->addr[mid] + cfg->size[mid]) {
+			lo = mid + 1;
+		} else {
+			return mid;
+		}
+	}
+	return RISCV_CFG_INVALID;
+}
@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_CFG_H
+#define RISCV_CFG_H
+
+#include "riscv_decode.h"
+
+#define RISCV_CFG_INVALID UT32_MAX
+
+/*
+ * blocks sorted by address, stored as flat arrays;
+ * the successors of block i are edges[edge_offset[i]] .. edges[edge_offset[i + 1] - 1]
+ */
+typedef struct riscv_cfg_t {
+	ut32 n_blocks;
+	ut32 n_edges;
+	ut64 *addr; /*        address of the first instruction of each block */
+	ut32 *size; /*        size in bytes of each block */
+	ut32 *edge_offset; /* n_blocks + 1 entries */
+	ut32 *edges; /*       successors as block indexes */
+} RISCVCfg;
+
+RISCV_API RISCVCfg *riscv_cfg_new(const ut8 *buffer, ut64 size, ut64 base, bool be, const ut64 *entries, ut32 n_entries);
+RISCV_API void riscv_cfg_free(RISCVCfg *cfg);
+RISCV_API ut32 riscv_cfg_block_at(const RISCVCfg *cfg, ut64 addr);
+
+#endif /* RISCV_CFG_H */
@@ -0,0 +1,297 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_cost.h"
+
+/* iterations simulated to find the loop carried dependency chains */
+#define LOOP_WARMUP     4
+#define LOOP_ITERATIONS 4
+
+typedef enum {
+	COST_ALU = 0,
+	COST_LOAD,
+	COST_STORE,
+	COST_MUL,
+	COST_DIV,
+	COST_BRANCH,
+	COST_JUMP,
+	COST_ATOMIC,
+	COST_SYSTEM,
+	COST_FPU,
+	COST_FDIV,
+	COST_VECTOR,
+} RISCVCostClass;
+
+/* generic single issue in-order core */
+static const struct {
+	cchar *name;
+	RISCVCost cost;
+} cost_classes[] = {
+	{ "@alu", { 1, 1 } },
+	{ "@load", { 3, 1 } },
+	{ "@store", { 1, 1 } },
+	{ "@mul", { 3, 1 } },
+	{ "@div", { 20, 20 } },
+	{ "@branch", { 1, 1 } },
+	{ "@jump", { 2, 1 } },
+	{ "@atomic", { 10, 10 } },
+	{ "@system", { 10, 10 } },
+	{ "@fpu", { 4, 1 } },
+	{ "@fdiv", { 20, 20 } },
+	{ "@vector", { 4, 1 } },
+};
+
+static RISCVCostClass cost_class(RISCVInsId id) {
+	ut32 type;
+	st8 family;
+	if (!riscv_op_class(id, &type, &family)) {
+		return COST_ALU;
+	}
+	switch (type) {
+	case RZ_ANALYSIS_OP_TYPE_LOAD:
+		return COST_LOAD;
+	case RZ_ANALYSIS_OP_TYPE_STORE:
+		return COST_STORE;
+	case RZ_ANALYSIS_OP_TYPE_XCHG:
+		return COST_ATOMIC;
+	case RZ_ANALYSIS_OP_TYPE_CJMP:
+		return COST_BRANCH;
+	case RZ_ANALYSIS_OP_TYPE_JMP:
+	case RZ_ANALYSIS_OP_TYPE_RJMP:
+		return COST_JUMP;
+	case RZ_ANALYSIS_OP_TYPE_SWI:
+	case RZ_ANALYSIS_OP_TYPE_TRAP:
+	case RZ_ANALYSIS_OP_TYPE_SYNC:
+	case RZ_ANALYSIS_OP_TYPE_RET:
+		return COST_SYSTEM;
+	default:
+		break;
+	}
+	switch (family) {
+	case RZ_ANALYSIS_OP_FAMILY_FPU:
+		if (type == RZ_ANALYSIS_OP_TYPE_DIV || !strncmp(riscv_mnemonic(id), "fsqrt", 5)) {
+			return COST_FDIV;
+		}
+		return COST_FPU;
+	case RZ_ANALYSIS_OP_FAMILY_SSE:
+	case RZ_ANALYSIS_OP_FAMILY_MMX:
+		return COST_VECTOR;
+	case RZ_ANALYSIS_OP_FAMILY_PRIV:
+		return COST_SYSTEM;
+	default:
+		break;
+	}
+	switch (type) {
+	case RZ_ANALYSIS_OP_TYPE_MUL:
+		return COST_MUL;
+	case RZ_ANALYSIS_OP_TYPE_DIV:
+	case RZ_ANALYSIS_OP_TYPE_MOD:
+		return COST_DIV;
+	default:
+		return COST_ALU;
+	}
+}
+
+/**
+ * Returns a model of a generic single issue in-order core
+ */
+RISCVCostModel *riscv_cost_model_new(void) {
+	RISCVCostModel *model = RZ_NEW0(RISCVCostModel);
+	if (!model) {
+		return NULL;
+	}
+	model->issue_width = 1;
+	for (ut32 id = 0; id < RISCV_INS_COUNT; ++id) {
+		model->cost[id] = cost_classes[cost_class(id)].cost;
+	}
+	return model;
+}
+
+void riscv_cost_model_free(RISCVCostModel *model) {
+	free(model);
+}
+
+static bool cost_set(RISCVCostModel *model, cchar *name, ut32 latency, ut32 throughput) {
+	RISCVCost cost = { latency, throughput };
+	if (name[0] != '@') {
+		for (ut32 id = 0; id < RISCV_INS_COUNT; ++id) {
+			if (!strcmp(riscv_mnemonic(id), name)) {
+				model->cost[id] = cost;
+				return true;
+			}
+		}
+		return false;
+	}
+	for (ut32 c = 0; c < RZ_ARRAY_SIZE(cost_classes); ++c) {
+		if (strcmp(cost_classes[c].name, name)) {
+			continue;
+		}
+		for (ut32 id = 0; id < RISCV_INS_COUNT; ++id) {
+			if (cost_class(id) == c) {
+				model->cost[id] = cost;
+			}
+		}
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Applies a core profile to the model, one entry per line:
+ *   issue <instructions per cycle>
+ *   @<class> <latency> [throughput]   (alu, load, store, mul, div, branch,
+ *                                      jump, atomic, system, fpu, fdiv, vector)
+ *   <mnemonic> <latency> [throughput]
+ * Entries are applied in order, so classes should come before the mnemonics.
+ * '#' starts a comment. On error the model is left untouched.
+ */
+bool riscv_cost_model_parse(RISCVCostModel *model, const char *profile) {
+	rz_return_val_if_fail(model && profile, false);
+	RISCVCostModel *copy = RZ_NEW(RISCVCostModel);
+	if (!copy) {
+		return false;
+	}
+	memcpy(copy, model, sizeof(RISCVCostModel));
+
+	for (const char *line = profile; *line;) {
+		const char *end = strchr(line, '\n');
+		size_t length = end ? (size_t)(end - line) : strlen(line);
+		char buffer[128], name[64];
+		ut32 latency, throughput = 1;
+
+		if (length >= sizeof(buffer)) {
+			goto fail;
+		}
+		memcpy(buffer, line, length);
+		buffer[length] = 0;
+		line += length + (end ? 1 : 0);
+
+		char *comment = strchr(buffer, '#');
+		if (comment) {
+			*comment = 0;
+		}
+		int n = sscanf(buffer, "%63s %u %u", name, &latency, &throughput);
+		if (n <= 0) {
+			/* empty line */
+			continue;
+		} else if (n < 2 || latency > UT8_MAX || throughput > UT8_MAX) {
+			goto fail;
+		}
+		if (!strcmp(name, "issue")) {
+			if (!latency || n > 2) {
+				goto fail;
+			}
+			copy->issue_width = latency;
+		} else if (!cost_set(copy, name, latency, throughput)) {
+			goto fail;
+		}
+	}
+	memcpy(model, copy, sizeof(RISCVCostModel));
+	free(copy);
+	return true;
+
+fail:
+	free(copy);
+	return false;
+}
+
+/**
+ * Applies the core profile stored in the file, see riscv_cost_model_parse()
+ */
+bool riscv_cost_model_load(RISCVCostModel *model, const char *path) {
+	rz_return_val_if_fail(model && path, false);
+	char *profile = rz_file_slurp(path, NULL);
+	if (!profile) {
+		return false;
+	}
+	bool ret = riscv_cost_model_parse(model, profile);
+	free(profile);
+	return ret;
+}
+
+/* cycle at which each register is written, bit N of each set is at index N, 32 + N and 64 + N */
+#define READY_REGS 96
+
+static ut64 ready_max(const ut64 *ready, ut32 set, ut64 start) {
+	for (ut32 reg = 0; set; ++reg, set >>= 1) {
+		if ((set & 1) && ready[reg] > start) {
+			start = ready[reg];
+		}
+	}
+	return start;
+}
+
+static void ready_set(ut64 *ready, ut32 set, ut64 cycle) {
+	for (ut32 reg = 0; set; ++reg, set >>= 1) {
+		if (set & 1) {
+			ready[reg] = cycle;
+		}
+	}
+}
+
+/* one pass over the code, returns the cycle at which the last result is ready */
+static ut64 cost_walk(const RISCVCostModel *model, const ut8 *buffer, ut64 size, bool be, ut64 *ready, RISCVCostEstimate *estimate) {
+	RISCVDecoded dec;
+	RISCVRegisters regs;
+	ut64 throughput = 0, last = 0;
+
+	memset(estimate, 0, sizeof(RISCVCostEstimate));
+	for (ut64 offset = 0; offset + 4 <= size; offset += dec.size) {
+		if (!riscv_decode(buffer + offset, RZ_MIN(size - offset, 4), be, &dec)) {
+			/* the decoder handles only 32 bits instructions */
+			dec.size = 4;
+			continue;
+		}
+		const RISCVCost *cost = &model->cost[dec.id];
+		riscv_registers(&dec, &regs);
+		ut64 start = ready_max(ready, regs.gpr_use, 0);
+		start = ready_max(ready + 32, regs.fpr_use, start);
+		start = ready_max(ready + 64, regs.vec_use, start);
+		ut64 done = start + cost->latency;
+		ready_set(ready, regs.gpr_def, done);
+		ready_set(ready + 32, regs.fpr_def, done);
+		ready_set(ready + 64, regs.vec_def, done);
+
+		last = RZ_MAX(last, done);
+		estimate->n_insns++;
+		estimate->latency += cost->latency;
+		throughput += cost->throughput;
+	}
+	estimate->resources = (throughput + model->issue_width - 1) / model->issue_width;
+	return last;
+}
+
+/**
+ * Estimates the cycles needed to execute the basic block once.
+ * Only register dependencies are considered, memory is assumed to never alias.
+ */
+bool riscv_cost_block(const RISCVCostModel *model, const ut8 *buffer, ut64 size, bool be, RISCVCostEstimate *estimate) {
+	rz_return_val_if_fail(model && buffer && estimate, false);
+	ut64 ready[READY_REGS] = { 0 };
+
+	estimate->critical = cost_walk(model, buffer, size, be, ready, estimate);
+	estimate->cycles = RZ_MAX(estimate->resources, estimate->critical);
+	return estimate->n_insns > 0;
+}
+
+/**
+ * Estimates the cycles of one iteration of a loop body in steady state:
+ * the critical path is the growth per iteration of the dependency chains
+ * carried from one iteration to the next one.
+ */
+bool riscv_cost_loop(const RISCVCostModel *model, const ut8 *buffer, ut64 size, bool be, RISCVCostEstimate *estimate) {
+	rz_return_val_if_fail(model && buffer && estimate, false);
+	ut64 ready[READY_REGS] = { 0 };
+	ut64 warm = 0, last = 0;
+
+	for (ut32 i = 0; i < LOOP_WARMUP + LOOP_ITERATIONS; ++i) {
+		if (i == LOOP_WARMUP) {
+			warm = last;
+		}
+		ut64 done = cost_walk(model, buffer, size, be, ready, estimate);
+		last = RZ_MAX(last, done);
+	}
+	estimate->critical = (last - warm + LOOP_ITERATIONS - 1) / LOOP_ITERATIONS;
+	estimate->cycles = RZ_MAX(estimate->resources, estimate->critical);
+	return estimate->n_insns > 0;
+}
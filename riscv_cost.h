@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_COST_H
+#define RISCV_COST_H
+
+#include "riscv_decode.h"
+
+typedef struct riscv_cost_t {
+	ut8 latency; /*    cycles before the result can be used */
+	ut8 throughput; /* cycles between two issues of the instruction */
+} RISCVCost;
+
+/* per core profile, indexed by RISCVInsId */
+typedef struct riscv_cost_model_t {
+	RISCVCost cost[RISCV_INS_COUNT];
+	ut8 issue_width; /* instructions issued per cycle */
+} RISCVCostModel;
+
+typedef struct riscv_cost_estimate_t {
+	ut32 n_insns;
+	ut64 latency; /*   sum of the latencies, fully serialized execution */
+	ut64 resources; /* cycles needed to issue all the instructions */
+	ut64 critical; /*  longest register dependency chain, per iteration for loops */
+	ut64 cycles; /*    estimate, the largest of resources and critical */
+} RISCVCostEstimate;
+
+RISCV_API RISCVCostModel *riscv_cost_model_new(void);
+RISCV_API void riscv_cost_model_free(RISCVCostModel *model);
+RISCV_API bool riscv_cost_model_parse(RISCVCostModel *model, const char *profile);
+RISCV_API bool riscv_cost_model_load(RISCVCostModel *model, const char *path);
+RISCV_API bool riscv_cost_block(const RISCVCostModel *model, const ut8 *buffer, ut64 size, bool be, RISCVCostEstimate *estimate);
+RISCV_API bool riscv_cost_loop(const RISCVCostModel *model, const ut8 *buffer, ut64 size, bool be, RISCVCostEstimate *estimate);
+
+#endif /* RISCV_COST_H */
@@ -1,11608 +1,4072 @@
-// SPDX-FileCopyrightText: 2022 deroad <wargio@libero.it>
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
 // SPDX-License-Identifier: LGPL-3.0-only
 
-#include <rz_types.h>
-#include <rz_util.h>
-
-#define RISCV_INVALID_SIZE 0
+#include "riscv_decode_private.h"
 
 typedef ut32 (*Decode)(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb);
 
-const char *registers_std[32] = {
-	"zero", "ra", "sp", "gp", "tp", "t0", "t1", "t2", "s0",
-	"s1", "a0", "a1", "a2", "a3", "a4", "a5", "a6", "a7",
-	"s2", "s3", "s4", "s5", "s6", "s7", "s8", "s9", "s10",
-	"s11", "t3", "t4", "t5", "t6"
-	"v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7", "v8",
+const char registers_std[32][RISCV_REG_NAME_SIZE] = {
+	"zero", "ra", "sp", "gp", "tp", "t0", "t1", "t2",
+	"s0", "s1", "a0", "a1", "a2", "a3", "a4", "a5",
+	"a6", "a7", "s2", "s3", "s4", "s5", "s6", "s7",
+	"s8", "s9", "s10", "s11", "t3", "t4", "t5", "t6",
 };
 
-const char *registers_vec[32] = {
-	"v9", "v10", "v11", "v12", "v13", "v14", "v15", "v16",
-	"v17", "v18", "v19", "v20", "v21", "v22", "v23", "v24",
-	"v25", "v26", "v27", "v28", "v29", "v30", "v31"
+const char registers_vec[32][RISCV_REG_NAME_SIZE] = {
+	"v0", "v1", "v2", "v3", "v4", "v5", "v6", "v7",
+	"v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15",
+	"v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23",
+	"v24", "v25", "v26", "v27", "v28", "v29", "v30", "v31",
 };
 
-const char *registers_flt[32] = {
-	"f0", "f1", "f2", "f3", "f4", "f5", "f6", "f7", "f8",
-	"f9", "f10", "f11", "f12", "f13", "f14", "f15", "f16",
-	"f17", "f18", "f19", "f20", "f21", "f22", "f23", "f24",
-	"f25", "f26", "f27", "f28", "f29", "f30", "f31"
+const char registers_flt[32][RISCV_REG_NAME_SIZE] = {
+	"f0", "f1", "f2", "f3", "f4", "f5", "f6", "f7",
+	"f8", "f9", "f10", "f11", "f12", "f13", "f14", "f15",
+	"f16", "f17", "f18", "f19", "f20", "f21", "f22", "f23",
+	"f24", "f25", "f26", "f27", "f28", "f29", "f30", "f31",
 };
 
 typedef struct riscv_decoder_t {
-	cchar* name; /*  instruction name */
-	ut16 cbits; /*   constant bits */
-	ut16 mbits; /*   mask to compare with constant bits */
-	ut32 opsize; /*  instruction size */
-	Decode decode;
+	ut32 cbits; /*   constant bits */
+	ut32 mbits; /*   mask to compare with constant bits */
+	ut16 regs; /*    RISCV_REGS_* roles of the register operands */
+	ut8 imm; /*      RISCVImmediate */
 } RISCVInstruction;
 
-static ut32 riscv_unique(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	rz_strbuf_set(sb, name);
-	return 4;
-}
+typedef struct riscv_standard_t {
+	ut16 first; /*   RISCVInsId of the first instruction */
+	ut16 count;
+	const char *names;
+	const RISCVDescription *descriptions;
+	const RISCVAnalysis *analysis;
+} RISCVStandard;
+
+typedef void (*Render)(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb);
+
+typedef struct riscv_alias_t {
+	ut16 id; /*      RISCVInsId of the aliased instruction */
+	bool same; /*    rs1 must be equal to rs2 */
+	ut32 mask; /*    fields checked by the alias */
+	ut32 bits; /*    expected value of the checked fields */
+	ut16 name; /*    offset of the pseudo instruction name in alias_names */
+	ut8 render; /*   index of the renderer in renders */
+} RISCVAlias;
+
+typedef enum {
+	RISCV_VGROUP_LMUL = 0,
+	RISCV_VGROUP_ONE,
+	RISCV_VGROUP_MASK,
+	RISCV_VGROUP_WIDE,
+	RISCV_VGROUP_FRAC2,
+	RISCV_VGROUP_FRAC4,
+	RISCV_VGROUP_FRAC8,
+	RISCV_VGROUP_EEW,
+	RISCV_VGROUP_WHOLE,
+} RISCVVectorGroup;
+
+#define RISCV_VSHAPE_SEGMENT (1 << 0) /* the data group is repeated nf + 1 times */
+#define RISCV_VSHAPE_CARRY   (1 << 1) /* v0 is always read (carry in and merge) */
+
+typedef struct riscv_vector_shape_t {
+	ut16 id; /*    RISCVInsId of the vector instruction */
+	ut8 vd; /*     RISCVVectorGroup of vd or vs3 */
+	ut8 vs1; /*    RISCVVectorGroup of vs1 */
+	ut8 vs2; /*    RISCVVectorGroup of vs2 */
+	ut16 eew; /*   element width encoded in the mnemonic, 0 when none */
+	ut8 count; /*  registers moved by whole register instructions, 0 when set by simm5 */
+	ut8 flags; /*  RISCV_VSHAPE_* */
+} RISCVVectorShape;
+
+/* csr names, csr_index holds the offset of each name in the pool */
+static const char csr_pool[] =
+	"\0"
+	"ustatus\0" /* 0x000 */
+	"fflags\0" /* 0x001 */
+	"frm\0" /* 0x002 */
+	"fcsr\0" /* 0x003 */
+	"uie\0" /* 0x004 */
+	"utvec\0" /* 0x005 */
+	"vstart\0" /* 0x008 */
+	"vxsat\0" /* 0x009 */
+	"vxrm\0" /* 0x00a */
+	"vcsr\0" /* 0x00f */
+	"seed\0" /* 0x015 */
+	"uscratch\0" /* 0x040 */
+	"uepc\0" /* 0x041 */
+	"ucause\0" /* 0x042 */
+	"utval\0" /* 0x043 */
+	"uip\0" /* 0x044 */
+	"sstatus\0" /* 0x100 */
+	"sedeleg\0" /* 0x102 */
+	"sideleg\0" /* 0x103 */
+	"sie\0" /* 0x104 */
+	"stvec\0" /* 0x105 */
+	"scounteren\0" /* 0x106 */
+	"senvcfg\0" /* 0x10a */
+	"sscratch\0" /* 0x140 */
+	"sepc\0" /* 0x141 */
+	"scause\0" /* 0x142 */
+	"stval\0" /* 0x143 */
+	"sip\0" /* 0x144 */
+	"stimecmp\0" /* 0x14d */
+	"stimecmph\0" /* 0x15d */
+	"satp\0" /* 0x180 */
+	"vsstatus\0" /* 0x200 */
+	"vsie\0" /* 0x204 */
+	"vstvec\0" /* 0x205 */
+	"vsscratch\0" /* 0x240 */
+	"vsepc\0" /* 0x241 */
+	"vscause\0" /* 0x242 */
+	"vstval\0" /* 0x243 */
+	"vsip\0" /* 0x244 */
+	"vstimecmp\0" /* 0x24d */
+	"vstimecmph\0" /* 0x25d */
+	"vsatp\0" /* 0x280 */
+	"mstatus\0" /* 0x300 */
+	"misa\0" /* 0x301 */
+	"medeleg\0" /* 0x302 */
+	"mideleg\0" /* 0x303 */
+	"mie\0" /* 0x304 */
+	"mtvec\0" /* 0x305 */
+	"mcounteren\0" /* 0x306 */
+	"menvcfg\0" /* 0x30a */
+	"mstatush\0" /* 0x310 */
+	"menvcfgh\0" /* 0x31a */
+	"mcountinhibit\0" /* 0x320 */
+	"mhpmevent3\0" /* 0x323 */
+	"mhpmevent4\0" /* 0x324 */
+	"mhpmevent5\0" /* 0x325 */
+	"mhpmevent6\0" /* 0x326 */
+	"mhpmevent7\0" /* 0x327 */
+	"mhpmevent8\0" /* 0x328 */
+	"mhpmevent9\0" /* 0x329 */
+	"mhpmevent10\0" /* 0x32a */
+	"mhpmevent11\0" /* 0x32b */
+	"mhpmevent12\0" /* 0x32c */
+	"mhpmevent13\0" /* 0x32d */
+	"mhpmevent14\0" /* 0x32e */
+	"mhpmevent15\0" /* 0x32f */
+	"mhpmevent16\0" /* 0x330 */
+	"mhpmevent17\0" /* 0x331 */
+	"mhpmevent18\0" /* 0x332 */
+	"mhpmevent19\0" /* 0x333 */
+	"mhpmevent20\0" /* 0x334 */
+	"mhpmevent21\0" /* 0x335 */
+	"mhpmevent22\0" /* 0x336 */
+	"mhpmevent23\0" /* 0x337 */
+	"mhpmevent24\0" /* 0x338 */
+	"mhpmevent25\0" /* 0x339 */
+	"mhpmevent26\0" /* 0x33a */
+	"mhpmevent27\0" /* 0x33b */
+	"mhpmevent28\0" /* 0x33c */
+	"mhpmevent29\0" /* 0x33d */
+	"mhpmevent30\0" /* 0x33e */
+	"mhpmevent31\0" /* 0x33f */
+	"mscratch\0" /* 0x340 */
+	"mepc\0" /* 0x341 */
+	"mcause\0" /* 0x342 */
+	"mtval\0" /* 0x343 */
+	"mip\0" /* 0x344 */
+	"mtinst\0" /* 0x34a */
+	"mtval2\0" /* 0x34b */
+	"pmpcfg0\0" /* 0x3a0 */
+	"pmpcfg1\0" /* 0x3a1 */
+	"pmpcfg2\0" /* 0x3a2 */
+	"pmpcfg3\0" /* 0x3a3 */
+	"pmpcfg4\0" /* 0x3a4 */
+	"pmpcfg5\0" /* 0x3a5 */
+	"pmpcfg6\0" /* 0x3a6 */
+	"pmpcfg7\0" /* 0x3a7 */
+	"pmpcfg8\0" /* 0x3a8 */
+	"pmpcfg9\0" /* 0x3a9 */
+	"pmpcfg10\0" /* 0x3aa */
+	"pmpcfg11\0" /* 0x3ab */
+	"pmpcfg12\0" /* 0x3ac */
+	"pmpcfg13\0" /* 0x3ad */
+	"pmpcfg14\0" /* 0x3ae */
+	"pmpcfg15\0" /* 0x3af */
+	"pmpaddr0\0" /* 0x3b0 */
+	"pmpaddr1\0" /* 0x3b1 */
+	"pmpaddr2\0" /* 0x3b2 */
+	"pmpaddr3\0" /* 0x3b3 */
+	"pmpaddr4\0" /* 0x3b4 */
+	"pmpaddr5\0" /* 0x3b5 */
+	"pmpaddr6\0" /* 0x3b6 */
+	"pmpaddr7\0" /* 0x3b7 */
+	"pmpaddr8\0" /* 0x3b8 */
+	"pmpaddr9\0" /* 0x3b9 */
+	"pmpaddr10\0" /* 0x3ba */
+	"pmpaddr11\0" /* 0x3bb */
+	"pmpaddr12\0" /* 0x3bc */
+	"pmpaddr13\0" /* 0x3bd */
+	"pmpaddr14\0" /* 0x3be */
+	"pmpaddr15\0" /* 0x3bf */
+	"pmpaddr16\0" /* 0x3c0 */
+	"pmpaddr17\0" /* 0x3c1 */
+	"pmpaddr18\0" /* 0x3c2 */
+	"pmpaddr19\0" /* 0x3c3 */
+	"pmpaddr20\0" /* 0x3c4 */
+	"pmpaddr21\0" /* 0x3c5 */
+	"pmpaddr22\0" /* 0x3c6 */
+	"pmpaddr23\0" /* 0x3c7 */
+	"pmpaddr24\0" /* 0x3c8 */
+	"pmpaddr25\0" /* 0x3c9 */
+	"pmpaddr26\0" /* 0x3ca */
+	"pmpaddr27\0" /* 0x3cb */
+	"pmpaddr28\0" /* 0x3cc */
+	"pmpaddr29\0" /* 0x3cd */
+	"pmpaddr30\0" /* 0x3ce */
+	"pmpaddr31\0" /* 0x3cf */
+	"pmpaddr32\0" /* 0x3d0 */
+	"pmpaddr33\0" /* 0x3d1 */
+	"pmpaddr34\0" /* 0x3d2 */
+	"pmpaddr35\0" /* 0x3d3 */
+	"pmpaddr36\0" /* 0x3d4 */
+	"pmpaddr37\0" /* 0x3d5 */
+	"pmpaddr38\0" /* 0x3d6 */
+	"pmpaddr39\0" /* 0x3d7 */
+	"pmpaddr40\0" /* 0x3d8 */
+	"pmpaddr41\0" /* 0x3d9 */
+	"pmpaddr42\0" /* 0x3da */
+	"pmpaddr43\0" /* 0x3db */
+	"pmpaddr44\0" /* 0x3dc */
+	"pmpaddr45\0" /* 0x3dd */
+	"pmpaddr46\0" /* 0x3de */
+	"pmpaddr47\0" /* 0x3df */
+	"pmpaddr48\0" /* 0x3e0 */
+	"pmpaddr49\0" /* 0x3e1 */
+	"pmpaddr50\0" /* 0x3e2 */
+	"pmpaddr51\0" /* 0x3e3 */
+	"pmpaddr52\0" /* 0x3e4 */
+	"pmpaddr53\0" /* 0x3e5 */
+	"pmpaddr54\0" /* 0x3e6 */
+	"pmpaddr55\0" /* 0x3e7 */
+	"pmpaddr56\0" /* 0x3e8 */
+	"pmpaddr57\0" /* 0x3e9 */
+	"pmpaddr58\0" /* 0x3ea */
+	"pmpaddr59\0" /* 0x3eb */
+	"pmpaddr60\0" /* 0x3ec */
+	"pmpaddr61\0" /* 0x3ed */
+	"pmpaddr62\0" /* 0x3ee */
+	"pmpaddr63\0" /* 0x3ef */
+	"scontext\0" /* 0x5a8 */
+	"hstatus\0" /* 0x600 */
+	"hedeleg\0" /* 0x602 */
+	"hideleg\0" /* 0x603 */
+	"hie\0" /* 0x604 */
+	"htimedelta\0" /* 0x605 */
+	"hcounteren\0" /* 0x606 */
+	"hgeie\0" /* 0x607 */
+	"henvcfg\0" /* 0x60a */
+	"htimedeltah\0" /* 0x615 */
+	"henvcfgh\0" /* 0x61a */
+	"htval\0" /* 0x643 */
+	"hip\0" /* 0x644 */
+	"hvip\0" /* 0x645 */
+	"htinst\0" /* 0x64a */
+	"hgatp\0" /* 0x680 */
+	"hcontext\0" /* 0x6a8 */
+	"mseccfg\0" /* 0x747 */
+	"mseccfgh\0" /* 0x757 */
+	"tselect\0" /* 0x7a0 */
+	"tdata1\0" /* 0x7a1 */
+	"tdata2\0" /* 0x7a2 */
+	"tdata3\0" /* 0x7a3 */
+	"tinfo\0" /* 0x7a4 */
+	"tcontrol\0" /* 0x7a5 */
+	"mcontext\0" /* 0x7a8 */
+	"mscontext\0" /* 0x7aa */
+	"dcsr\0" /* 0x7b0 */
+	"dpc\0" /* 0x7b1 */
+	"dscratch0\0" /* 0x7b2 */
+	"dscratch1\0" /* 0x7b3 */
+	"mcycle\0" /* 0xb00 */
+	"minstret\0" /* 0xb02 */
+	"mhpmcounter3\0" /* 0xb03 */
+	"mhpmcounter4\0" /* 0xb04 */
+	"mhpmcounter5\0" /* 0xb05 */
+	"mhpmcounter6\0" /* 0xb06 */
+	"mhpmcounter7\0" /* 0xb07 */
+	"mhpmcounter8\0" /* 0xb08 */
+	"mhpmcounter9\0" /* 0xb09 */
+	"mhpmcounter10\0" /* 0xb0a */
+	"mhpmcounter11\0" /* 0xb0b */
+	"mhpmcounter12\0" /* 0xb0c */
+	"mhpmcounter13\0" /* 0xb0d */
+	"mhpmcounter14\0" /* 0xb0e */
+	"mhpmcounter15\0" /* 0xb0f */
+	"mhpmcounter16\0" /* 0xb10 */
+	"mhpmcounter17\0" /* 0xb11 */
+	"mhpmcounter18\0" /* 0xb12 */
+	"mhpmcounter19\0" /* 0xb13 */
+	"mhpmcounter20\0" /* 0xb14 */
+	"mhpmcounter21\0" /* 0xb15 */
+	"mhpmcounter22\0" /* 0xb16 */
+	"mhpmcounter23\0" /* 0xb17 */
+	"mhpmcounter24\0" /* 0xb18 */
+	"mhpmcounter25\0" /* 0xb19 */
+	"mhpmcounter26\0" /* 0xb1a */
+	"mhpmcounter27\0" /* 0xb1b */
+	"mhpmcounter28\0" /* 0xb1c */
+	"mhpmcounter29\0" /* 0xb1d */
+	"mhpmcounter30\0" /* 0xb1e */
+	"mhpmcounter31\0" /* 0xb1f */
+	"mcycleh\0" /* 0xb80 */
+	"minstreth\0" /* 0xb82 */
+	"mhpmcounter3h\0" /* 0xb83 */
+	"mhpmcounter4h\0" /* 0xb84 */
+	"mhpmcounter5h\0" /* 0xb85 */
+	"mhpmcounter6h\0" /* 0xb86 */
+	"mhpmcounter7h\0" /* 0xb87 */
+	"mhpmcounter8h\0" /* 0xb88 */
+	"mhpmcounter9h\0" /* 0xb89 */
+	"mhpmcounter10h\0" /* 0xb8a */
+	"mhpmcounter11h\0" /* 0xb8b */
+	"mhpmcounter12h\0" /* 0xb8c */
+	"mhpmcounter13h\0" /* 0xb8d */
+	"mhpmcounter14h\0" /* 0xb8e */
+	"mhpmcounter15h\0" /* 0xb8f */
+	"mhpmcounter16h\0" /* 0xb90 */
+	"mhpmcounter17h\0" /* 0xb91 */
+	"mhpmcounter18h\0" /* 0xb92 */
+	"mhpmcounter19h\0" /* 0xb93 */
+	"mhpmcounter20h\0" /* 0xb94 */
+	"mhpmcounter21h\0" /* 0xb95 */
+	"mhpmcounter22h\0" /* 0xb96 */
+	"mhpmcounter23h\0" /* 0xb97 */
+	"mhpmcounter24h\0" /* 0xb98 */
+	"mhpmcounter25h\0" /* 0xb99 */
+	"mhpmcounter26h\0" /* 0xb9a */
+	"mhpmcounter27h\0" /* 0xb9b */
+	"mhpmcounter28h\0" /* 0xb9c */
+	"mhpmcounter29h\0" /* 0xb9d */
+	"mhpmcounter30h\0" /* 0xb9e */
+	"mhpmcounter31h\0" /* 0xb9f */
+	"cycle\0" /* 0xc00 */
+	"time\0" /* 0xc01 */
+	"instret\0" /* 0xc02 */
+	"hpmcounter3\0" /* 0xc03 */
+	"hpmcounter4\0" /* 0xc04 */
+	"hpmcounter5\0" /* 0xc05 */
+	"hpmcounter6\0" /* 0xc06 */
+	"hpmcounter7\0" /* 0xc07 */
+	"hpmcounter8\0" /* 0xc08 */
+	"hpmcounter9\0" /* 0xc09 */
+	"hpmcounter10\0" /* 0xc0a */
+	"hpmcounter11\0" /* 0xc0b */
+	"hpmcounter12\0" /* 0xc0c */
+	"hpmcounter13\0" /* 0xc0d */
+	"hpmcounter14\0" /* 0xc0e */
+	"hpmcounter15\0" /* 0xc0f */
+	"hpmcounter16\0" /* 0xc10 */
+	"hpmcounter17\0" /* 0xc11 */
+	"hpmcounter18\0" /* 0xc12 */
+	"hpmcounter19\0" /* 0xc13 */
+	"hpmcounter20\0" /* 0xc14 */
+	"hpmcounter21\0" /* 0xc15 */
+	"hpmcounter22\0" /* 0xc16 */
+	"hpmcounter23\0" /* 0xc17 */
+	"hpmcounter24\0" /* 0xc18 */
+	"hpmcounter25\0" /* 0xc19 */
+	"hpmcounter26\0" /* 0xc1a */
+	"hpmcounter27\0" /* 0xc1b */
+	"hpmcounter28\0" /* 0xc1c */
+	"hpmcounter29\0" /* 0xc1d */
+	"hpmcounter30\0" /* 0xc1e */
+	"hpmcounter31\0" /* 0xc1f */
+	"vl\0" /* 0xc20 */
+	"vtype\0" /* 0xc21 */
+	"vlenb\0" /* 0xc22 */
+	"cycleh\0" /* 0xc80 */
+	"timeh\0" /* 0xc81 */
+	"instreth\0" /* 0xc82 */
+	"hpmcounter3h\0" /* 0xc83 */
+	"hpmcounter4h\0" /* 0xc84 */
+	"hpmcounter5h\0" /* 0xc85 */
+	"hpmcounter6h\0" /* 0xc86 */
+	"hpmcounter7h\0" /* 0xc87 */
+	"hpmcounter8h\0" /* 0xc88 */
+	"hpmcounter9h\0" /* 0xc89 */
+	"hpmcounter10h\0" /* 0xc8a */
+	"hpmcounter11h\0" /* 0xc8b */
+	"hpmcounter12h\0" /* 0xc8c */
+	"hpmcounter13h\0" /* 0xc8d */
+	"hpmcounter14h\0" /* 0xc8e */
+	"hpmcounter15h\0" /* 0xc8f */
+	"hpmcounter16h\0" /* 0xc90 */
+	"hpmcounter17h\0" /* 0xc91 */
+	"hpmcounter18h\0" /* 0xc92 */
+	"hpmcounter19h\0" /* 0xc93 */
+	"hpmcounter20h\0" /* 0xc94 */
+	"hpmcounter21h\0" /* 0xc95 */
+	"hpmcounter22h\0" /* 0xc96 */
+	"hpmcounter23h\0" /* 0xc97 */
+	"hpmcounter24h\0" /* 0xc98 */
+	"hpmcounter25h\0" /* 0xc99 */
+	"hpmcounter26h\0" /* 0xc9a */
+	"hpmcounter27h\0" /* 0xc9b */
+	"hpmcounter28h\0" /* 0xc9c */
+	"hpmcounter29h\0" /* 0xc9d */
+	"hpmcounter30h\0" /* 0xc9e */
+	"hpmcounter31h\0" /* 0xc9f */
+	"hgeip\0" /* 0xe12 */
+	"mvendorid\0" /* 0xf11 */
+	"marchid\0" /* 0xf12 */
+	"mimpid\0" /* 0xf13 */
+	"mhartid\0" /* 0xf14 */
+	"mconfigptr\0" /* 0xf15 */
+;
+
+static const ut16 csr_index[4096] = {
+	1, 9, 16, 20, 25, 29, 0, 0, 35, 42, 48, 0, 0, 0, 0, 53,
+	0, 0, 0, 0, 0, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	63, 72, 77, 84, 90, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	94, 0, 102, 110, 118, 122, 128, 0, 0, 0, 139, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	147, 156, 161, 168, 174, 0, 0, 0, 0, 0, 0, 0, 0, 178, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 187, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	197, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	202, 0, 0, 0, 211, 216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	223, 233, 239, 247, 254, 0, 0, 0, 0, 0, 0, 0, 0, 259, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 269, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	286, 294, 299, 307, 315, 319, 325, 0, 0, 0, 336, 0, 0, 0, 0, 0,
+	344, 0, 0, 0, 0, 0, 0, 0, 0, 0, 353, 0, 0, 0, 0, 0,
+	362, 0, 0, 376, 387, 398, 409, 420, 431, 442, 453, 465, 477, 489, 501, 513,
+	525, 537, 549, 561, 573, 585, 597, 609, 621, 633, 645, 657, 669, 681, 693, 705,
+	717, 726, 731, 738, 744, 0, 0, 0, 0, 0, 748, 755, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	762, 770, 778, 786, 794, 802, 810, 818, 826, 834, 842, 851, 860, 869, 878, 887,
+	896, 905, 914, 923, 932, 941, 950, 959, 968, 977, 986, 996, 1006, 1016, 1026, 1036,
+	1046, 1056, 1066, 1076, 1086, 1096, 1106, 1116, 1126, 1136, 1146, 1156, 1166, 1176, 1186, 1196,
+	1206, 1216, 1226, 1236, 1246, 1256, 1266, 1276, 1286, 1296, 1306, 1316, 1326, 1336, 1346, 1356,
+	1366, 1376, 1386, 1396, 1406, 1416, 1426, 1436, 1446, 1456, 1466, 1476, 1486, 1496, 1506, 1516,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1526, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1535, 0, 1543, 1551, 1559, 1563, 1574, 1585, 0, 0, 1591, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 1599, 0, 0, 0, 0, 1611, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 1620, 1626, 1630, 0, 0, 0, 0, 1635, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1642, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1648, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1657, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 1665, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1674, 1682, 1689, 1696, 1703, 1709, 0, 0, 1718, 0, 1727, 0, 0, 0, 0, 0,
+	1737, 1742, 1746, 1756, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	1766, 0, 1773, 1782, 1795, 1808, 1821, 1834, 1847, 1860, 1873, 1887, 1901, 1915, 1929, 1943,
+	1957, 1971, 1985, 1999, 2013, 2027, 2041, 2055, 2069, 2083, 2097, 2111, 2125, 2139, 2153, 2167,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2181, 0, 2189, 2199, 2213, 2227, 2241, 2255, 2269, 2283, 2297, 2312, 2327, 2342, 2357, 2372,
+	2387, 2402, 2417, 2432, 2447, 2462, 2477, 2492, 2507, 2522, 2537, 2552, 2567, 2582, 2597, 2612,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	2627, 2633, 2638, 2646, 2658, 2670, 2682, 2694, 2706, 2718, 2730, 2743, 2756, 2769, 2782, 2795,
+	2808, 2821, 2834, 2847, 2860, 2873, 2886, 2899, 2912, 2925, 2938, 2951, 2964, 2977, 2990, 3003,
+	3016, 3019, 3025, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	3031, 3038, 3044, 3053, 3066, 3079, 3092, 3105, 3118, 3131, 3144, 3158, 3172, 3186, 3200, 3214,
+	3228, 3242, 3256, 3270, 3284, 3298, 3312, 3326, 3340, 3354, 3368, 3382, 3396, 3410, 3424, 3438,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 3452, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 3458, 3468, 3476, 3483, 3491, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
 
-static ut32 riscv_pseudo_00000000000100000010aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_flt[fd]);
-	return 4;
+/**
+ * Returns the name of the csr or NULL when the number is not known
+ */
+cchar *riscv_csr_name(ut16 csr) {
+	if (csr >= RZ_ARRAY_SIZE(csr_index) || !csr_index[csr]) {
+		return NULL;
+	}
+	return csr_pool + csr_index[csr];
 }
 
-static ut32 riscv_pseudo_000000000001ccccc001aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
+/* csr name or its number when not known, hex must hold at least 8 bytes */
+static cchar *riscv_csr_operand(ut16 csr, char *hex) {
+	cchar *name = riscv_csr_name(csr);
+	if (name) {
+		return name;
+	}
+	snprintf(hex, 8, "0x%03x", csr);
+	return hex;
 }
 
-static ut32 riscv_pseudo_000000000001sssss101aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
+static ut32 riscv_unique(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_flt[fd]);
 	return 4;
 }
 
-static ut32 riscv_pseudo_00000000001000000010aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_flt[fd]);
-	return 4;
-}
+static const char choices_aqrl[4][6] = {
+	"", ".rl", ".aq", ".aqrl",
+};
+
+static const char choices_fm[16][5] = {
+	"", "", "", "", "", "", "", "",
+	".tso", "", "", "", "", "", "", "",
+};
 
-static ut32 riscv_pseudo_000000000010ccccc001aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static const char choices_pred[16][5] = {
+	"0", "w", "r", "rw", "o", "ow", "or", "orw",
+	"i", "iw", "ir", "irw", "io", "iow", "ior", "iorw",
+};
+
+static const char choices_rm_sep[8][6] = {
+	", rne", ", rtz", ", rdn", ", rup", ", rmm", ", 5", ", 6", "",
+};
+
+static const char choices_succ_sep[16][7] = {
+	", 0", ", w", ", r", ", rw", ", o", ", ow", ", or", ", orw",
+	", i", ", iw", ", ir", ", irw", ", io", ", iow", ", ior", ", iorw",
+};
+
+static ut32 riscv_fmt_fd_fs1_fs2(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 fd = (data & 0xf80) >> 7;
 	ut32 fs1 = (data & 0xf8000) >> 15;
+	ut32 fs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
+	rz_strbuf_appendf(sb, " %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
 	return 4;
 }
 
-static ut32 riscv_pseudo_000000000010sssss101aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_fd_fs1_fs2_fs3_rm(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 fd = (data & 0xf80) >> 7;
+	ut32 fs1 = (data & 0xf8000) >> 15;
+	ut32 fs2 = (data & 0x1f00000) >> 20;
+	ut32 fs3 = (data & 0xf8000000) >> 27;
+	ut32 rm = (data & 0x7000) >> 12;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_flt[fd]);
+	rz_strbuf_appendf(sb, " %s, %s, %s, %s%s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], choices_rm_sep[rm]);
 	return 4;
 }
 
-static ut32 riscv_pseudo_00000000001100000010aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_fd_fs1_fs2_rm(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 fd = (data & 0xf80) >> 7;
+	ut32 fs1 = (data & 0xf8000) >> 15;
+	ut32 fs2 = (data & 0x1f00000) >> 20;
+	ut32 rm = (data & 0x7000) >> 12;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_flt[fd]);
+	rz_strbuf_appendf(sb, " %s, %s, %s%s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], choices_rm_sep[rm]);
 	return 4;
 }
 
-static ut32 riscv_pseudo_000000000011ccccc001aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_fd_fs1_rm(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 fd = (data & 0xf80) >> 7;
 	ut32 fs1 = (data & 0xf8000) >> 15;
+	ut32 rm = (data & 0x7000) >> 12;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
+	rz_strbuf_appendf(sb, " %s, %s%s", registers_flt[fd], registers_flt[fs1], choices_rm_sep[rm]);
 	return 4;
 }
 
-static ut32 riscv_pseudo_0000000uuuuuccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_fd_imm12_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 fd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
+	st32 imm12 = (st32)data >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
+	rz_strbuf_appendf(sb, " %s, %d(%s)", registers_flt[fd], imm12, registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_pseudo_0000000uuuuuccccc101aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_fd_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 fd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
+	rz_strbuf_appendf(sb, " %s, %s", registers_flt[fd], registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_pseudo_0100000uuuuuccccc101aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_fd_rs1_rm(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 fd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
+	ut32 rm = (data & 0x7000) >> 12;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
+	rz_strbuf_appendf(sb, " %s, %s%s", registers_flt[fd], registers_std[rs1], choices_rm_sep[rm]);
 	return 4;
 }
 
-static ut32 riscv_pseudo_11000000000000000010aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_fs2_imm12_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	st32 imm12 = ((st32)(data & 0xfe000000) >> 20) | ((data >> 7) & 0x1f);
+	ut32 rs1 = (data & 0xf8000) >> 15;
+	ut32 fs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_std[rd]);
+	rz_strbuf_appendf(sb, " %s, %d(%s)", registers_flt[fs2], imm12, registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_pseudo_11000000000100000010aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_pred_succ(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 fm = (data & 0xf0000000) >> 28;
+	ut32 pred = (data & 0xf000000) >> 24;
+	ut32 succ = (data & 0xf00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_std[rd]);
+	rz_strbuf_appendf(sb, "%s %s%s", choices_fm[fm], choices_pred[pred], choices_succ_sep[succ]);
 	return 4;
 }
 
-static ut32 riscv_pseudo_11000000001000000010aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_std[rd]);
+	rz_strbuf_appendf(sb, " %s", registers_std[rd]);
 	return 4;
 }
 
-static ut32 riscv_pseudo_11001000000000000010aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_csr_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
+	ut32 rs1 = (data & 0xf8000) >> 15;
+	ut32 csr = (data & 0xfff00000) >> 20;
+	char csr_hex[8];
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_std[rd]);
+	rz_strbuf_appendf(sb, " %s, %s, %s", registers_std[rd], riscv_csr_operand(csr, csr_hex), registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_pseudo_11001000000100000010aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_csr_zimm(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
+	ut32 zimm = (data & 0xf8000) >> 15;
+	ut32 csr = (data & 0xfff00000) >> 20;
+	char csr_hex[8];
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_std[rd]);
+	rz_strbuf_appendf(sb, " %s, %s, 0x%x", registers_std[rd], riscv_csr_operand(csr, csr_hex), zimm);
 	return 4;
 }
 
-static ut32 riscv_pseudo_11001000001000000010aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_fs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_std[rd]);
-	return 4;
-}
-
-static ut32 riscv_pseudo_111000000000ccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
-}
-
-static ut32 riscv_pseudo_111100000000ccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
 	ut32 fs1 = (data & 0xf8000) >> 15;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32a_00000ffdddddccccc010aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s", registers_std[rd], registers_flt[fs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32a_00001ffdddddccccc010aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_fs1_fs2(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
+	ut32 fs1 = (data & 0xf8000) >> 15;
+	ut32 fs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, %s", registers_std[rd], registers_flt[fs1], registers_flt[fs2]);
 	return 4;
 }
 
-static ut32 riscv_rv32a_00010ff00000ccccc010aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_fs1_rm(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 aqrl = (data & 0x6000000) >> 25;
+	ut32 fs1 = (data & 0xf8000) >> 15;
+	ut32 rm = (data & 0x7000) >> 12;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, (%s)", registers_std[rd], registers_std[rs1]);
+	rz_strbuf_appendf(sb, " %s, %s%s", registers_std[rd], registers_flt[fs1], choices_rm_sep[rm]);
 	return 4;
 }
 
-static ut32 riscv_rv32a_00011ffdddddccccc010aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_imm12_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
+	st32 imm12 = (st32)data >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %d(%s)", registers_std[rd], imm12, registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32a_00100ffdddddccccc010aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_imm20(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
+	ut32 imm20 = (data & 0xfffff000) >> 12;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, 0x%x", registers_std[rd], imm20);
 	return 4;
 }
 
-static ut32 riscv_rv32a_01000ffdddddccccc010aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_jimm20(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
+	st32 jimm20 = ((st32)(data & 0x80000000) >> 11) | (data & 0xff000) | ((data >> 9) & 0x800) | ((data >> 20) & 0x7fe);
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, 0x%" PFMT64x "", registers_std[rd], pc + jimm20);
 	return 4;
 }
 
-static ut32 riscv_rv32a_01100ffdddddccccc010aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s", registers_std[rd], registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32a_10000ffdddddccccc010aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_rs1_2(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
 	ut32 aqrl = (data & 0x6000000) >> 25;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, "%s %s, (%s)", choices_aqrl[aqrl], registers_std[rd], registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32a_10100ffdddddccccc010aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_rs1_imm12(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
+	st32 imm12 = (st32)data >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, %d", registers_std[rd], registers_std[rs1], imm12);
 	return 4;
 }
 
-static ut32 riscv_rv32a_11000ffdddddccccc010aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_rs1_rs2(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
 	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
 	return 4;
 }
 
-static ut32 riscv_rv32a_11100ffdddddccccc010aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_rs1_rs2_rs3(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
 	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
+	ut32 rs3 = (data & 0xf8000000) >> 27;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2], registers_std[rs3]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0000100dddddccccc001aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
+static ut32 riscv_fmt_rd_rs1_rs2_rs3_2(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 rs3 = (data & 0xf8000000) >> 27;
 	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_0000100dddddccccc100aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_0000100dddddccccc101aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2], registers_std[rs3]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0000100dddddccccc110aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_rs1_rs3_shamt(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
+	ut32 shamt = (data & 0x3f00000) >> 20;
+	ut32 rs3 = (data & 0xf8000000) >> 27;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, %s, 0x%x", registers_std[rd], registers_std[rs1], registers_std[rs3], shamt);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0000100dddddccccc111aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_rs1_rs3_shamtw(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
+	ut32 shamtw = (data & 0x1f00000) >> 20;
+	ut32 rs3 = (data & 0xf8000000) >> 27;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, %s, 0x%x", registers_std[rd], registers_std[rs1], registers_std[rs3], shamtw);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0000100uuuuuccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_rs1_shamt(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
+	ut32 shamt = (data & 0x3f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
+	rz_strbuf_appendf(sb, " %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0000100uuuuuccccc101aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_rs1_shamtw(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
 	ut32 shamtw = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
+	rz_strbuf_appendf(sb, " %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamtw);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0000101dddddccccc001aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_rs2_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
 	ut32 rs2 = (data & 0x1f00000) >> 20;
+	ut32 aqrl = (data & 0x6000000) >> 25;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, "%s %s, %s, (%s)", choices_aqrl[aqrl], registers_std[rd], registers_std[rs2], registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0000101dddddccccc010aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+static ut32 riscv_fmt_rd_vs2(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
+	ut32 vs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s", registers_std[rd], registers_vec[vs2]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0000101dddddccccc011aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s", registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0000101dddddccccc100aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_rs1_imm12(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
+	st32 imm12 = ((st32)(data & 0xfe000000) >> 20) | ((data >> 7) & 0x1f);
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %d", registers_std[rs1], imm12);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0000101dddddccccc101aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_rs1_rs2(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
 	ut32 rs1 = (data & 0xf8000) >> 15;
 	ut32 rs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s", registers_std[rs1], registers_std[rs2]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0000101dddddccccc110aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_rs1_rs2_bimm12(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	st32 bimm12 = ((st32)(data & 0x80000000) >> 19) | ((data & 0x80) << 4) | ((data >> 20) & 0x7e0) | ((data >> 7) & 0x1e);
 	ut32 rs1 = (data & 0xf8000) >> 15;
 	ut32 rs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, 0x%" PFMT64x "", registers_std[rs1], registers_std[rs2], pc + bimm12);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0000101dddddccccc111aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_rs2_imm12_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	st32 imm12 = ((st32)(data & 0xfe000000) >> 20) | ((data >> 7) & 0x1f);
 	ut32 rs1 = (data & 0xf8000) >> 15;
 	ut32 rs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %d(%s)", registers_std[rs2], imm12, registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0010000dddddccccc001aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
+static ut32 riscv_fmt_vd(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 vd = (data & 0xf80) >> 7;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s", registers_vec[vd]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0010000dddddccccc010aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_vd_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 vd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s", registers_vec[vd], registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0010000dddddccccc100aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_vd_rs1_rs2(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 vd = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
 	ut32 rs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, %s", registers_vec[vd], registers_std[rs1], registers_std[rs2]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0010000dddddccccc101aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
+static ut32 riscv_fmt_vd_vs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 vd = (data & 0xf80) >> 7;
+	ut32 vs1 = (data & 0xf8000) >> 15;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s", registers_vec[vd], registers_vec[vs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0010000dddddccccc110aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
+static ut32 riscv_fmt_vd_vs1_vs2(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 vd = (data & 0xf80) >> 7;
+	ut32 vs1 = (data & 0xf8000) >> 15;
+	ut32 vs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_001000ttttttccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
+static ut32 riscv_fmt_vd_vs2(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 vd = (data & 0xf80) >> 7;
+	ut32 vs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
+	rz_strbuf_appendf(sb, " %s, %s", registers_vec[vd], registers_vec[vs2]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_001000ttttttccccc101aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_vd_vs2_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 vd = (data & 0xf80) >> 7;
+	ut32 vs2 = (data & 0x1f00000) >> 20;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
+	rz_strbuf_appendf(sb, " %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0010100dddddccccc001aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_vs2_vs3_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 vs2 = (data & 0x1f00000) >> 20;
+	ut32 vs3 = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0010100dddddccccc010aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_vs3_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 vs3 = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s", registers_vec[vs3], registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0010100dddddccccc100aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_vs3_rs1_rs2(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 vs3 = (data & 0xf80) >> 7;
 	ut32 rs1 = (data & 0xf8000) >> 15;
 	ut32 rs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, %s", registers_vec[vs3], registers_std[rs1], registers_std[rs2]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0010100dddddccccc101aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
+static ut32 riscv_fmt_wd_vd_vs2_rs1(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
+	ut32 wd = (data & 0x4000000) >> 26;
+	ut32 vd = (data & 0xf80) >> 7;
+	ut32 vs2 = (data & 0x1f00000) >> 20;
 	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
+	rz_strbuf_appendf(sb, " %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
 	return 4;
 }
 
-static ut32 riscv_rv32b_0010100dddddccccc110aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
+static void riscv_alias_csr_rs1(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	char csr_hex[8];
+	rz_strbuf_setf(sb, "%s %s, %s", name, riscv_csr_operand(dec->imm, csr_hex), registers_std[dec->rs1]);
 }
 
-static ut32 riscv_rv32b_001010ttttttccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
-	return 4;
+static void riscv_alias_csr_zimm(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	char csr_hex[8];
+	rz_strbuf_setf(sb, "%s %s, 0x%x", name, riscv_csr_operand(dec->imm, csr_hex), dec->rs1);
 }
 
-static ut32 riscv_rv32b_001010ttttttccccc101aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
-	return 4;
+static void riscv_alias_fd_fs1(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_strbuf_setf(sb, "%s %s, %s", name, registers_flt[dec->rd], registers_flt[dec->rs1]);
 }
 
-static ut32 riscv_rv32b_0100000dddddccccc100aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
+static void riscv_alias_none(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
 	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
 }
 
-static ut32 riscv_rv32b_0100000dddddccccc110aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
+static void riscv_alias_rd(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_strbuf_setf(sb, "%s %s", name, registers_std[dec->rd]);
 }
 
-static ut32 riscv_rv32b_0100000dddddccccc111aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
+static void riscv_alias_rd_csr(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	char csr_hex[8];
+	rz_strbuf_setf(sb, "%s %s, %s", name, registers_std[dec->rd], riscv_csr_operand(dec->imm, csr_hex));
 }
 
-static ut32 riscv_rv32b_0100100dddddccccc001aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
+static void riscv_alias_rd_imm(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_strbuf_setf(sb, "%s %s, %" PFMT64d "", name, registers_std[dec->rd], dec->imm);
 }
 
-static ut32 riscv_rv32b_0100100dddddccccc100aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
+static void riscv_alias_rd_rs1(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_strbuf_setf(sb, "%s %s, %s", name, registers_std[dec->rd], registers_std[dec->rs1]);
 }
 
-static ut32 riscv_rv32b_0100100dddddccccc101aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
+static void riscv_alias_rd_rs2(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_strbuf_setf(sb, "%s %s, %s", name, registers_std[dec->rd], registers_std[dec->rs2]);
 }
 
-static ut32 riscv_rv32b_0100100dddddccccc110aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
+static void riscv_alias_rd_zimm(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_strbuf_setf(sb, "%s %s, 0x%x", name, registers_std[dec->rd], dec->rs1);
 }
 
-static ut32 riscv_rv32b_0100100dddddccccc111aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
+static void riscv_alias_rs1(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_strbuf_setf(sb, "%s %s", name, registers_std[dec->rs1]);
 }
 
-static ut32 riscv_rv32b_010010ttttttccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
-	return 4;
+static void riscv_alias_rs1_target(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_strbuf_setf(sb, "%s %s, 0x%" PFMT64x "", name, registers_std[dec->rs1], pc + dec->imm);
 }
 
-static ut32 riscv_rv32b_010010ttttttccccc101aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
-	return 4;
+static void riscv_alias_rs2_target(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_strbuf_setf(sb, "%s %s, 0x%" PFMT64x "", name, registers_std[dec->rs2], pc + dec->imm);
 }
 
-static ut32 riscv_rv32b_011000000000ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
+static void riscv_alias_target(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_strbuf_setf(sb, "%s 0x%" PFMT64x "", name, pc + dec->imm);
 }
 
-static ut32 riscv_rv32b_011000000001ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
+static void riscv_alias_zimm(cchar *name, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_strbuf_setf(sb, "%s 0x%x", name, dec->rs1);
 }
 
-static ut32 riscv_rv32b_011000000010ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_011000000100ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_011000000101ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_011000010000ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_011000010001ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_011000010010ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_011000011000ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_011000011001ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_011000011010ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_0110000dddddccccc001aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_0110000dddddccccc101aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_011000ttttttccccc101aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
-	return 4;
-}
-
-static ut32 riscv_rv32b_0110100dddddccccc001aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_0110100dddddccccc101aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_011010ttttttccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
-	return 4;
-}
-
-static ut32 riscv_rv32b_011010ttttttccccc101aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
-	return 4;
-}
-
-static ut32 riscv_rv32b_eeeee10dddddccccc001aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_eeeee10dddddccccc101aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_eeeee11dddddccccc001aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 rs3 = (data & 0xf8000000) >> 27;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2], registers_std[rs3]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_eeeee11dddddccccc101aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 rs3 = (data & 0xf8000000) >> 27;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2], registers_std[rs3]);
-	return 4;
-}
-
-static ut32 riscv_rv32b_eeeee1ttttttccccc101aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_flt[fd], registers_flt[fs1], shamt);
-	return 4;
-}
-
-static ut32 riscv_rv32d-zfh_010000100010cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d-zfh_010001000001cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_0000001dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_0000101dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_0001001dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_0001101dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_0010001dddddccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32d_0010001dddddccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32d_0010001dddddccccc010aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32d_0010101dddddccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32d_0010101dddddccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32d_010000000001cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_010000100000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_010110100000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_1010001dddddccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32d_1010001dddddccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32d_1010001dddddccccc010aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32d_110000100000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_110000100001cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_110100100000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_110100100001cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_111000100000ccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32d_eeeee01dddddcccccjjjaaaaa1000011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_eeeee01dddddcccccjjjaaaaa1000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_eeeee01dddddcccccjjjaaaaa1001011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_eeeee01dddddcccccjjjaaaaa1001111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32d_nnnnnnnnnnnnccccc011aaaaa0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_flt[fd], registers_flt[fs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32d_ooooooodddddccccc011qqqqq0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 imm12hi = (data & 0xfe000000) >> 25;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 imm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x(%s)", imm12, registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32f_0000000dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_0000100dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_0001000dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_0001100dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_0010000dddddccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32f_0010000dddddccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32f_0010000dddddccccc010aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32f_0010100dddddccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32f_0010100dddddccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32f_010110000000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_1010000dddddccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32f_1010000dddddccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32f_1010000dddddccccc010aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32f_110000000000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_110000000001cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_110100000000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rs1], registers_flt[fd], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_110100000001cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rs1], registers_flt[fd], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_111000000000ccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32f_111000000000ccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32f_111100000000ccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32f_eeeee00dddddcccccjjjaaaaa1000011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_eeeee00dddddcccccjjjaaaaa1000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_eeeee00dddddcccccjjjaaaaa1001011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_eeeee00dddddcccccjjjaaaaa1001111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32f_nnnnnnnnnnnnccccc010aaaaa0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_flt[fd], registers_flt[fs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32f_ooooooodddddccccc010qqqqq0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 imm12hi = (data & 0xfe000000) >> 25;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 imm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x(%s)", imm12, registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32h_0010001dddddccccc000000001110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32h_011000000000ccccc100aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32h_011000000001ccccc100aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32h_0110001dddddccccc000000001110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32h_0110001dddddccccc100000001110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32h_011001000000ccccc100aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32h_011001000001ccccc100aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32h_011001000011ccccc100aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32h_0110011dddddccccc100000001110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32h_011010000000ccccc100aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32h_011010000011ccccc100aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32h_0110101dddddccccc100000001110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_0000000dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_0000000dddddccccc001aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_0000000dddddccccc010aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_0000000dddddccccc011aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_0000000dddddccccc100aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_0000000dddddccccc101aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_0000000dddddccccc110aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_0000000dddddccccc111aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_0100000dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_0100000dddddccccc101aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_gggghhhhiiiiccccc000aaaaa0001111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fm = (data & 0xf0000000) >> 28;
-	ut32 pred = (data & 0xf000000) >> 24;
-	ut32 succ = (data & 0xf00000) >> 20;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fd = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", pred, succ);
-	return 4;
-}
-
-static ut32 riscv_rv32i_llllllllllllllllllllaaaaa0010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 imm20 = (data & 0xfffff000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], imm20);
-	return 4;
-}
-
-static ut32 riscv_rv32i_llllllllllllllllllllaaaaa0110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 imm20 = (data & 0xfffff000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], imm20);
-	return 4;
-}
-
-static ut32 riscv_rv32i_mmmmmmmmmmmmmmmmmmmmaaaaa1101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 jimm20 = (data & 0xfffff000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%" PFMT64x "", registers_std[rd], pc + jimm20);
-	return 4;
-}
-
-static ut32 riscv_rv32i_nnnnnnnnnnnnccccc000aaaaa0000011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32i_nnnnnnnnnnnnccccc000aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32i_nnnnnnnnnnnnccccc000aaaaa1100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32i_nnnnnnnnnnnnccccc001aaaaa0000011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32i_nnnnnnnnnnnnccccc010aaaaa0000011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32i_nnnnnnnnnnnnccccc010aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32i_nnnnnnnnnnnnccccc011aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32i_nnnnnnnnnnnnccccc100aaaaa0000011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32i_nnnnnnnnnnnnccccc100aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32i_nnnnnnnnnnnnccccc101aaaaa0000011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32i_nnnnnnnnnnnnccccc110aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32i_nnnnnnnnnnnnccccc111aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32i_ooooooodddddccccc000qqqqq0100011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 imm12hi = (data & 0xfe000000) >> 25;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 imm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x(%s)", imm12, registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_ooooooodddddccccc001qqqqq0100011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 imm12hi = (data & 0xfe000000) >> 25;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 imm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x(%s)", imm12, registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_ooooooodddddccccc010qqqqq0100011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 imm12hi = (data & 0xfe000000) >> 25;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 imm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x(%s)", imm12, registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_pppppppdddddccccc000rrrrr1100011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 bimm12hi = (data & 0xfe000000) >> 25;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 bimm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", bimm12, registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_pppppppdddddccccc001rrrrr1100011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 bimm12hi = (data & 0xfe000000) >> 25;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 bimm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", bimm12, registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_pppppppdddddccccc100rrrrr1100011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 bimm12hi = (data & 0xfe000000) >> 25;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 bimm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", bimm12, registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_pppppppdddddccccc101rrrrr1100011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 bimm12hi = (data & 0xfe000000) >> 25;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 bimm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", bimm12, registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_pppppppdddddccccc110rrrrr1100011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 bimm12hi = (data & 0xfe000000) >> 25;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 bimm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", bimm12, registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32i_pppppppdddddccccc111rrrrr1100011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 bimm12hi = (data & 0xfe000000) >> 25;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 bimm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", bimm12, registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32k_0101000dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32k_0101001dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32k_0101010dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32k_0101011dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32k_0101110dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32k_0101111dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32k_vv10001dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32k_vv10011dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32k_vv10101dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32k_vv10111dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32m_0000001dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32m_0000001dddddccccc001aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32m_0000001dddddccccc010aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32m_0000001dddddccccc011aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32m_0000001dddddccccc100aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32m_0000001dddddccccc101aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32m_0000001dddddccccc110aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32m_0000001dddddccccc111aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32q-zfh_010001000011cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q-zfh_010001100010cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_0000011dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_0000111dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_0001011dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_0001111dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_0010011dddddccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32q_0010011dddddccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32q_0010011dddddccccc010aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32q_0010111dddddccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32q_0010111dddddccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32q_010000000011cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_010000100011cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_010001100000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_010001100001cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_010111100000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_1010011dddddccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32q_1010011dddddccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32q_1010011dddddccccc010aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32q_110001100000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_110001100001cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_110101100000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rs1], registers_flt[fd], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_110101100001cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rs1], registers_flt[fd], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_111001100000ccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32q_eeeee11dddddcccccjjjaaaaa1000011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_eeeee11dddddcccccjjjaaaaa1000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_eeeee11dddddcccccjjjaaaaa1001011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_eeeee11dddddcccccjjjaaaaa1001111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32q_nnnnnnnnnnnnccccc100aaaaa0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_flt[fd], registers_flt[fs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32q_ooooooodddddccccc100qqqqq0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 imm12hi = (data & 0xfe000000) >> 25;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 imm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x(%s)", imm12, registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_0000010dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_0000110dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_0001010dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_0001110dddddcccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_0010010dddddccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_0010010dddddccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_0010010dddddccccc010aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_0010110dddddccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_0010110dddddccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_010000000010cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_010001000000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_010111000000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_1010010dddddccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_1010010dddddccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_1010010dddddccccc010aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_110001000000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_110001000001cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_110101000000cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_110101000001cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_111001000000ccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_111001000000ccccc001aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_111101000000ccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_eeeee10dddddcccccjjjaaaaa1000011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_eeeee10dddddcccccjjjaaaaa1000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_eeeee10dddddcccccjjjaaaaa1001011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_eeeee10dddddcccccjjjaaaaa1001111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3], rm);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_nnnnnnnnnnnnccccc001aaaaa0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_flt[fd], registers_flt[fs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv32zfh_ooooooodddddccccc001qqqqq0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 imm12hi = (data & 0xfe000000) >> 25;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 imm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x(%s)", imm12, registers_flt[fs1], registers_flt[fs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64a_00000ffdddddccccc011aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64a_00001ffdddddccccc011aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64a_00010ff00000ccccc011aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 aqrl = (data & 0x6000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, (%s)", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64a_00011ffdddddccccc011aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64a_00100ffdddddccccc011aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64a_01000ffdddddccccc011aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64a_01100ffdddddccccc011aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64a_10000ffdddddccccc011aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64a_10100ffdddddccccc011aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64a_11000ffdddddccccc011aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64a_11100ffdddddccccc011aaaaa0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 aqrl = (data & 0x6000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf("%s %s, %s, (%s)", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0000100dddddccccc000aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0000100dddddccccc001aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0000100dddddccccc011aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0000100dddddccccc100aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0000100dddddccccc101aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0000100dddddccccc110aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_000010ttttttccccc001aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0010000dddddccccc001aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0010000dddddccccc010aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0010000dddddccccc100aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0010000dddddccccc101aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0010000dddddccccc110aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0010000uuuuuccccc001aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0010000uuuuuccccc101aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0010100dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0010100dddddccccc101aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0010100uuuuuccccc101aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0100100dddddccccc011aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0100100dddddccccc100aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0100100dddddccccc110aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0100100dddddccccc111aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_011000000000ccccc001aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_011000000001ccccc001aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_011000000010ccccc001aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_011000000011ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_011000010011ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_011000011011ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0110000dddddccccc001aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0110000dddddccccc101aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0110000uuuuuccccc101aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0110100dddddccccc101aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_0110100uuuuuccccc101aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
-	return 4;
-}
-
-static ut32 riscv_rv64b_eeeee10dddddccccc001aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_eeeee10dddddccccc101aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 fs2 = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_flt[fd], registers_flt[fs1], registers_flt[fs2], registers_flt[fs3]);
-	return 4;
-}
-
-static ut32 riscv_rv64b_eeeee10uuuuuccccc101aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
-	ut32 fs3 = (data & 0xf8000000) >> 27;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_flt[fd], shamtw);
-	return 4;
-}
-
-static ut32 riscv_rv64d_110000100010cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64d_110000100011cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64d_110100100010cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64d_110100100011cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64d_111000100000ccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64d_111100100000ccccc000aaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_flt[fd], registers_flt[fs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64f_110000000010cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64f_110000000011cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64f_110100000010cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rs1], registers_flt[fd], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64f_110100000011cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rs1], registers_flt[fd], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64h_011010000001ccccc100aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64h_011011000000ccccc100aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64h_0110111dddddccccc100000001110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64i_0000000dddddccccc000aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64i_0000000dddddccccc001aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64i_0000000dddddccccc101aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64i_0000000uuuuuccccc001aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
-	return 4;
-}
-
-static ut32 riscv_rv64i_0000000uuuuuccccc101aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
-	return 4;
-}
-
-static ut32 riscv_rv64i_000000ttttttccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
-	return 4;
-}
-
-static ut32 riscv_rv64i_000000ttttttccccc101aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
-	return 4;
-}
-
-static ut32 riscv_rv64i_0100000dddddccccc000aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64i_0100000dddddccccc101aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64i_0100000uuuuuccccc101aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamtw = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rd], shamtw);
-	return 4;
-}
-
-static ut32 riscv_rv64i_010000ttttttccccc101aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 shamt = (data & 0x3f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], shamt);
-	return 4;
-}
-
-static ut32 riscv_rv64i_nnnnnnnnnnnnccccc000aaaaa0011011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv64i_nnnnnnnnnnnnccccc011aaaaa0000011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv64i_nnnnnnnnnnnnccccc110aaaaa0000011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
-
-static ut32 riscv_rv64i_ooooooodddddccccc011qqqqq0100011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 imm12hi = (data & 0xfe000000) >> 25;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 imm12lo = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x(%s)", imm12, registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64k_000100000100ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64k_000100000101ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64k_000100000110ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64k_000100000111ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64k_001100000000ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64k_00110001wwwwccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rv64k_0011001dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64k_0011011dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64k_0011101dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64k_0011111dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64k_0111111dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64m_0000001dddddccccc000aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64m_0000001dddddccccc100aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64m_0000001dddddccccc101aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64m_0000001dddddccccc110aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64m_0000001dddddccccc111aaaaa0111011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rv64q_110001100010cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64q_110001100011cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64q_110101100010cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rs1], registers_flt[fd], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64q_110101100011cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rs1], registers_flt[fd], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64zfh_110001000010cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64zfh_110001000011cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64zfh_110101000010cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rv64zfh_110101000011cccccjjjaaaaa1010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 fd = (data & 0xf80) >> 7;
-	ut32 fs1 = (data & 0xf8000) >> 15;
-	ut32 rm = (data & 0x7000) >> 12;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_flt[fd], registers_flt[fs1], rm);
-	return 4;
-}
-
-static ut32 riscv_rvk_000100000000ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvk_000100000001ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvk_000100000010ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvk_000100000011ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvk_000100001000ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvk_000100001001ccccc001aaaaa0010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvk_vv11000dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvk_vv11010dddddccccc000aaaaa0110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000001dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000010dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000010dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000010dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000011dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000011dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000011dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000100dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000101dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000110dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000111dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0000111dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001001dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001010dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001010dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001010dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001011dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001011dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001011dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001100dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001100dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001101dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001110dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001111dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0001111dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010001dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010010dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010010dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010010dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010011dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010011dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010011dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010100dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010100dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010101dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010110dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010111dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0010111dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011001dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011010BBBBBccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011010dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011010dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011011BBBBBccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011011dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011011dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011100dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011100dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011101dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011101dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011110dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011111dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0011111dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100001dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100010dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100010dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100010dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100011dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100011dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100011dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100100dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100101dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100101dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100110dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100110dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100111dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0100111dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101001dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101010dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101010dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101010dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101011dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101011dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101011dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101100dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101100dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101101dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101101dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101110dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101110dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101111dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0101111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110001dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110010dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110010dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110010dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110011dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110011dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110011dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110100dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110100dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110101dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110101dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110110dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110110dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110111dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0110111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_01110000AAAAccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_01110001AAAAccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111000BBBBBccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_01110010AAAAccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_01110011AAAAccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111001BBBBBccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_01110100AAAAccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_01110101AAAAccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111010BBBBBccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111010dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111011dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_011110000zzzccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_011110001zzzccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111100dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_011110100zzzccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_011110101zzzccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111101dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_011111000zzzccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_011111001zzzccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111110dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_0111111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000000BBBBBccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000001BBBBBccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000001dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_10000100AAAAccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_10000101AAAAccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000010BBBBBccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000010dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000011dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000011dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000100dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000101dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_100011000zzzccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_100011010zzzccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000111dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1000111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001001dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001010dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001011dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001011dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001100dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001101dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001111dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1001111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010001dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010010dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010011dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010100dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010101dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011000zzzccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011001000ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011001001ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011001010ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011001011ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011001100ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011001101ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011001110ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011001111ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011010000ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011010001ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011010010ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011010011ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011010100ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011010111ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011011000ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011100000ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011100001ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011100011ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011101000ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011101001ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011101011ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011111000ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011111001ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_101011111011ccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1010111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011001dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011010dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011010dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011011dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011011dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011100dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011101dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1011111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100010dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100010dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100011dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100011dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100100dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100101dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100110dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100111dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1100111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1101000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1101001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1101001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1101010dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1101011dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_110101CCCCCCccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1101100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1101101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1101110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1101111BBBBBccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1101111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110010BBBBBccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110010dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110011dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110011dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_111010CCCCCCccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1110111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111000dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111000dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111000dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111001dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111001dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111001dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111010BBBBBccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111010dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111011dddddccccc010aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111100dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111101dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111110dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111110dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111111dddddccccc000aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_1111111dddddccccc001aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvp_eeeee00dddddccccc011aaaaa1110111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs3 = (data & 0xf8000000) >> 27;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rd = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[rs3], registers_std[rs2], registers_std[rs1], registers_std[rd]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000101000ccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000101000ccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000101000ccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000101000ccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000101000ccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000101011ccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000101011ccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000000HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000001101000ccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000001HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000001HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_00000IHGGGGGccccc000DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_00000IHGGGGGccccc101DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_00000IHGGGGGccccc110DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_00000IHGGGGGccccc111DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000010HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000010HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000010HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000010HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000010HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000011101000ccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000011HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000011HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000011HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000011HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_00001IHGGGGGccccc000DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_00001IHGGGGGccccc101DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_00001IHGGGGGccccc110DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_00001IHGGGGGccccc111DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000100HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000100HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000100HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000100HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000100HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000101HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000101HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000101HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000101HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000110HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000110HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000110HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000110HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000110HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000111101000ccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000111HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000111HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000111HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_000111HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001000101000ccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001000101000ccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001000101000ccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001000101000ccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001000101000ccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001000HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001000HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001000HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001000HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001001HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001001HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001001HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001001HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001001HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001001HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001001HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_00100IHGGGGGccccc000DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_00100IHGGGGGccccc101DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_00100IHGGGGGccccc110DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_00100IHGGGGGccccc111DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001010HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001010HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001010HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001010HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001010HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001010HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001010HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001011HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001011HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001011HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001011HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001011HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001100HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001100HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001100HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001110HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001110HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001110HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001110HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001110HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001111HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001111HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001111HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_001111HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100000GGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100000GGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100000GGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010000100000ccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010000100000ccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100001GGGGG00000001aaaaa1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rd = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs2], registers_std[rd]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100001GGGGG00000010aaaaa1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rd = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs2], registers_std[rd]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010000HGGGGG10000010aaaaa1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rd = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs2], registers_std[rd]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010000HGGGGG10001010aaaaa1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rd = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs2], registers_std[rd]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100010GGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100010GGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100010GGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100011GGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100011GGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100011GGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_01000IHGGGGGccccc000DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_01000IHGGGGGccccc101DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_01000IHGGGGGccccc110DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_01000IHGGGGGccccc111DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100100GGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100100GGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG00000001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG00001001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG00010001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG00010010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG00011001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG00011010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG00100010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG00101010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG00110001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG00110010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG00111001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG00111010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG01000001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG01001001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG01010001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG01011001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG01100001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG01110001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG01111001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG10000001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG10001001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG10010001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG10011001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG10100001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG10101001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG10110001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010010HGGGGG10111001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100110GGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100110GGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100111GGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0100111GGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010011HGGGGG00000001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010011HGGGGG00100001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010011HGGGGG00101001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010011HGGGGG10000001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010100H0000010001010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_vec[vd]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010100HGGGGG00001010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010100HGGGGG00010010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010100HGGGGG00011010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010100HGGGGG10000010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0101110GGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0101110GGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0101110GGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0101110GGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010111100000FFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010111100000LLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_vec[vd]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010111100000ccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_010111100000ccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0101111GGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011000101000ccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011000101000ccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011000101000ccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011000101000ccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011000101000ccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011000HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011000HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011000HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011000HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011000HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011000HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011001HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011001HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011001HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011001HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011001HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011001HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_01100IHGGGGGccccc000DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_01100IHGGGGGccccc101DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_01100IHGGGGGccccc110DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_01100IHGGGGGccccc111DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011010HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011010HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011010HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011011HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011011HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011011HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011011HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011011HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011100HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011100HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011100HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011100HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011100HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011100HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011101HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011101HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011101HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011101HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011101HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011110HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011110HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011110HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011111HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011111HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011111HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_011111HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_0NNNNNNNNNNNccccc111aaaaa1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_1000000dddddccccc111aaaaa1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_std[rd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100000HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100000HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100000HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100000HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100000HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100000HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100000HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100001HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100001HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100001HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100001HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100001HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100001HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_10000IHGGGGGccccc000DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_10000IHGGGGGccccc101DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_10000IHGGGGGccccc110DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_10000IHGGGGGccccc111DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100010HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100010HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100010HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100010HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100011HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100011HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100011HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100011HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100100HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100100HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100100HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100100HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100101HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100101HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100101HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100101HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100101HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100110HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100110HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_1001111GGGGG00000011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_1001111GGGGG00001011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_1001111GGGGG00011011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_1001111GGGGG00111011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_1001111GGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100111HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100111HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100111HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100111HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_100111HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101000HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101000HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101000HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101000HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101000HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101001HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101001HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101001HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101001HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101001HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101001HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101001HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_10100IHGGGGGccccc000DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_10100IHGGGGGccccc101DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_10100IHGGGGGccccc110DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_10100IHGGGGGccccc111DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101010HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101010HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101010HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101010HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101010HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101011HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101011HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101011HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101011HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101011HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101011HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101011HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101100HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101100HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101100HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101100HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101100HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101101HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101101HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101101HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101101HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101101HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101101HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101101HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101110HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101110HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101110HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101110HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101110HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101111HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101111HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101111HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101111HGGGGGLLLLL011DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101111HGGGGGccccc100DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101111HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_101111HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110000HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110000HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110000HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110000HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110000HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110001HGGGGGFFFFF000DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110001HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110001HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110001HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_11000IHGGGGGccccc000DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_11000IHGGGGGccccc101DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_11000IHGGGGGccccc110DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_11000IHGGGGGccccc111DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110010HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110010HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110010HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110010HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110011HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110011HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110011HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110100HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110100HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110100HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110100HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110101HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110101HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110110HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110110HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110110HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110110HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110111HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_110111HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111000101000ccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111000101000ccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111000101000ccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111000101000ccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111000101000ccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111000HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111000HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111000HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111000HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_11100IHGGGGGccccc000DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_11100IHGGGGGccccc101DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_11100IHGGGGGccccc110DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_11100IHGGGGGccccc111DDDDD0101111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 wd = (data & 0x4000000) >> 26;
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s, %s", registers_std[wd], registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111010HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111010HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111011HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111011HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111100HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111100HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111100HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111100HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111101HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111101HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111101HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111101HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111110HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111110HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111110HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111111HGGGGGFFFFF001DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111111HGGGGGFFFFF010DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs1 = (data & 0xf8000) >> 15;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs1], registers_vec[vs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111111HGGGGGccccc101DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_111111HGGGGGccccc110DDDDD1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_11MMMMMMMMMMsssss111aaaaa1010111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_std[rd]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK000H00000ccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK000H00000ccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK000H00000ccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK000H00000ccccc101EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK000H00000ccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK000H00000ccccc110EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK000H00000ccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK000H00000ccccc111EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK000H10000ccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK000H10000ccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK000H10000ccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK000H10000ccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK001HGGGGGccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK001HGGGGGccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK001HGGGGGccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK001HGGGGGccccc101EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK001HGGGGGccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK001HGGGGGccccc110EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK001HGGGGGccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK001HGGGGGccccc111EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK010Hdddddccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK010Hdddddccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs3], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK010Hdddddccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK010Hdddddccccc101EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs3], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK010Hdddddccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK010Hdddddccccc110EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs3], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK010Hdddddccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK010Hdddddccccc111EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs3], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK011HGGGGGccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK011HGGGGGccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK011HGGGGGccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK011HGGGGGccccc101EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK011HGGGGGccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK011HGGGGGccccc110EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK011HGGGGGccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK011HGGGGGccccc111EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK100H00000ccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK100H00000ccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK100H00000ccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK100H00000ccccc101EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK100H00000ccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK100H00000ccccc110EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK100H00000ccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK100H00000ccccc111EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK100H10000ccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK100H10000ccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK100H10000ccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK100H10000ccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_vec[vd], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK101HGGGGGccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK101HGGGGGccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK101HGGGGGccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK101HGGGGGccccc101EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK101HGGGGGccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK101HGGGGGccccc110EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK101HGGGGGccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK101HGGGGGccccc111EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK110Hdddddccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK110Hdddddccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs3], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK110Hdddddccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK110Hdddddccccc101EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs3], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK110Hdddddccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK110Hdddddccccc110EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs3], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
-
-static ut32 riscv_rvv_KKK110Hdddddccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
+/* text decoders and alias renderers, referenced by index */
+static const Decode decoders[] = {
+	riscv_unique,
+	riscv_fmt_fd_fs1_fs2,
+	riscv_fmt_fd_fs1_fs2_fs3_rm,
+	riscv_fmt_fd_fs1_fs2_rm,
+	riscv_fmt_fd_fs1_rm,
+	riscv_fmt_fd_imm12_rs1,
+	riscv_fmt_fd_rs1,
+	riscv_fmt_fd_rs1_rm,
+	riscv_fmt_fs2_imm12_rs1,
+	riscv_fmt_pred_succ,
+	riscv_fmt_rd,
+	riscv_fmt_rd_csr_rs1,
+	riscv_fmt_rd_csr_zimm,
+	riscv_fmt_rd_fs1,
+	riscv_fmt_rd_fs1_fs2,
+	riscv_fmt_rd_fs1_rm,
+	riscv_fmt_rd_imm12_rs1,
+	riscv_fmt_rd_imm20,
+	riscv_fmt_rd_jimm20,
+	riscv_fmt_rd_rs1,
+	riscv_fmt_rd_rs1_2,
+	riscv_fmt_rd_rs1_imm12,
+	riscv_fmt_rd_rs1_rs2,
+	riscv_fmt_rd_rs1_rs2_rs3,
+	riscv_fmt_rd_rs1_rs2_rs3_2,
+	riscv_fmt_rd_rs1_rs3_shamt,
+	riscv_fmt_rd_rs1_rs3_shamtw,
+	riscv_fmt_rd_rs1_shamt,
+	riscv_fmt_rd_rs1_shamtw,
+	riscv_fmt_rd_rs2_rs1,
+	riscv_fmt_rd_vs2,
+	riscv_fmt_rs1,
+	riscv_fmt_rs1_imm12,
+	riscv_fmt_rs1_rs2,
+	riscv_fmt_rs1_rs2_bimm12,
+	riscv_fmt_rs2_imm12_rs1,
+	riscv_fmt_vd,
+	riscv_fmt_vd_rs1,
+	riscv_fmt_vd_rs1_rs2,
+	riscv_fmt_vd_vs1,
+	riscv_fmt_vd_vs1_vs2,
+	riscv_fmt_vd_vs2,
+	riscv_fmt_vd_vs2_rs1,
+	riscv_fmt_vs2_vs3_rs1,
+	riscv_fmt_vs3_rs1,
+	riscv_fmt_vs3_rs1_rs2,
+	riscv_fmt_wd_vd_vs2_rs1,
+};
 
-static ut32 riscv_rvv_KKK110Hdddddccccc111EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs3], registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
+static const Render renders[] = {
+	riscv_alias_csr_rs1,
+	riscv_alias_csr_zimm,
+	riscv_alias_fd_fs1,
+	riscv_alias_none,
+	riscv_alias_rd,
+	riscv_alias_rd_csr,
+	riscv_alias_rd_imm,
+	riscv_alias_rd_rs1,
+	riscv_alias_rd_rs2,
+	riscv_alias_rd_zimm,
+	riscv_alias_rs1,
+	riscv_alias_rs1_target,
+	riscv_alias_rs2_target,
+	riscv_alias_target,
+	riscv_alias_zimm,
+};
 
-static ut32 riscv_rvv_KKK111HGGGGGccccc000DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
+/* pseudo instruction names, aliases[].name is the offset of each name in the pool */
+static const char alias_names[] =
+	"j\0"
+	"jal\0"
+	"beqz\0"
+	"bnez\0"
+	"bltz\0"
+	"bgtz\0"
+	"blez\0"
+	"bgez\0"
+	"ret\0"
+	"jr\0"
+	"jalr\0"
+	"nop\0"
+	"li\0"
+	"mv\0"
+	"seqz\0"
+	"not\0"
+	"fence.tso\0"
+	"pause\0"
+	"neg\0"
+	"sltz\0"
+	"sgtz\0"
+	"snez\0"
+	"fmv.d\0"
+	"fneg.d\0"
+	"fabs.d\0"
+	"fmv.s\0"
+	"fneg.s\0"
+	"fabs.s\0"
+	"sext.w\0"
+	"negw\0"
+	"fsflags\0"
+	"fsflags\0"
+	"fsrm\0"
+	"fsrm\0"
+	"fscsr\0"
+	"fscsr\0"
+	"csrw\0"
+	"rdcycle\0"
+	"rdtime\0"
+	"rdinstret\0"
+	"rdcycleh\0"
+	"rdtimeh\0"
+	"rdinstreth\0"
+	"frflags\0"
+	"frrm\0"
+	"frcsr\0"
+	"csrr\0"
+	"csrs\0"
+	"csrc\0"
+	"fsflagsi\0"
+	"fsflagsi\0"
+	"fsrmi\0"
+	"fsrmi\0"
+	"csrwi\0"
+	"csrsi\0"
+	"csrci\0";
 
-static ut32 riscv_rvv_KKK111HGGGGGccccc000EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
+static const RISCVInstruction instructions[] = {
+	{ 0x0000006f, 0x0000007f, RISCV_REGS_GPR_RD, RISCV_IMM_J }, /* jal              mmmmmmmmmmmmmmmmmmmmaaaaa1101111 */
+	{ 0x00000037, 0x0000007f, RISCV_REGS_GPR_RD, RISCV_IMM_U }, /* lui              llllllllllllllllllllaaaaa0110111 */
+	{ 0x00000017, 0x0000007f, RISCV_REGS_GPR_RD, RISCV_IMM_U }, /* auipc            llllllllllllllllllllaaaaa0010111 */
+	{ 0x00000063, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_B }, /* beq              pppppppdddddccccc000rrrrr1100011 */
+	{ 0x00001063, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_B }, /* bne              pppppppdddddccccc001rrrrr1100011 */
+	{ 0x00004063, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_B }, /* blt              pppppppdddddccccc100rrrrr1100011 */
+	{ 0x00005063, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_B }, /* bge              pppppppdddddccccc101rrrrr1100011 */
+	{ 0x00006063, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_B }, /* bltu             pppppppdddddccccc110rrrrr1100011 */
+	{ 0x00007063, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_B }, /* bgeu             pppppppdddddccccc111rrrrr1100011 */
+	{ 0x00000067, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* jalr             nnnnnnnnnnnnccccc000aaaaa1100111 */
+	{ 0x00000013, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* addi             nnnnnnnnnnnnccccc000aaaaa0010011 */
+	{ 0x00002013, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* slti             nnnnnnnnnnnnccccc010aaaaa0010011 */
+	{ 0x00003013, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* sltiu            nnnnnnnnnnnnccccc011aaaaa0010011 */
+	{ 0x00004013, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* xori             nnnnnnnnnnnnccccc100aaaaa0010011 */
+	{ 0x00006013, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* ori              nnnnnnnnnnnnccccc110aaaaa0010011 */
+	{ 0x00007013, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* andi             nnnnnnnnnnnnccccc111aaaaa0010011 */
+	{ 0x00000003, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* lb               nnnnnnnnnnnnccccc000aaaaa0000011 */
+	{ 0x00001003, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* lh               nnnnnnnnnnnnccccc001aaaaa0000011 */
+	{ 0x00002003, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* lw               nnnnnnnnnnnnccccc010aaaaa0000011 */
+	{ 0x00004003, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* lbu              nnnnnnnnnnnnccccc100aaaaa0000011 */
+	{ 0x00005003, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* lhu              nnnnnnnnnnnnccccc101aaaaa0000011 */
+	{ 0x00000023, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_S }, /* sb               ooooooodddddccccc000qqqqq0100011 */
+	{ 0x00001023, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_S }, /* sh               ooooooodddddccccc001qqqqq0100011 */
+	{ 0x00002023, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_S }, /* sw               ooooooodddddccccc010qqqqq0100011 */
+	{ 0x0000000f, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* fence            gggghhhhiiiiccccc000aaaaa0001111 */
+	{ 0x0000100f, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_I }, /* fence.i          nnnnnnnnnnnnccccc001aaaaa0001111 */
+	{ 0x00000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* add              0000000dddddccccc000aaaaa0110011 */
+	{ 0x40000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sub              0100000dddddccccc000aaaaa0110011 */
+	{ 0x00001033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sll              0000000dddddccccc001aaaaa0110011 */
+	{ 0x00002033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* slt              0000000dddddccccc010aaaaa0110011 */
+	{ 0x00003033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sltu             0000000dddddccccc011aaaaa0110011 */
+	{ 0x00004033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* xor              0000000dddddccccc100aaaaa0110011 */
+	{ 0x00005033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* srl              0000000dddddccccc101aaaaa0110011 */
+	{ 0x40005033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sra              0100000dddddccccc101aaaaa0110011 */
+	{ 0x00006033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* or               0000000dddddccccc110aaaaa0110011 */
+	{ 0x00007033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* and              0000000dddddccccc111aaaaa0110011 */
+	{ 0x00003007, 0x0000707f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* fld              nnnnnnnnnnnnccccc011aaaaa0000111 */
+	{ 0x00003027, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_S }, /* fsd              ooooooodddddccccc011qqqqq0100111 */
+	{ 0x02000043, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fmadd.d          eeeee01dddddcccccjjjaaaaa1000011 */
+	{ 0x02000047, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fmsub.d          eeeee01dddddcccccjjjaaaaa1000111 */
+	{ 0x0200004b, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fnmsub.d         eeeee01dddddcccccjjjaaaaa1001011 */
+	{ 0x0200004f, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fnmadd.d         eeeee01dddddcccccjjjaaaaa1001111 */
+	{ 0x02000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fadd.d           0000001dddddcccccjjjaaaaa1010011 */
+	{ 0x0a000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsub.d           0000101dddddcccccjjjaaaaa1010011 */
+	{ 0x12000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fmul.d           0001001dddddcccccjjjaaaaa1010011 */
+	{ 0x1a000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fdiv.d           0001101dddddcccccjjjaaaaa1010011 */
+	{ 0x22000053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsgnj.d          0010001dddddccccc000aaaaa1010011 */
+	{ 0x22001053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsgnjn.d         0010001dddddccccc001aaaaa1010011 */
+	{ 0x22002053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsgnjx.d         0010001dddddccccc010aaaaa1010011 */
+	{ 0x2a000053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fmin.d           0010101dddddccccc000aaaaa1010011 */
+	{ 0x2a001053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fmax.d           0010101dddddccccc001aaaaa1010011 */
+	{ 0xa2000053, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fle.d            1010001dddddccccc000aaaaa1010011 */
+	{ 0xa2001053, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* flt.d            1010001dddddccccc001aaaaa1010011 */
+	{ 0xa2002053, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* feq.d            1010001dddddccccc010aaaaa1010011 */
+	{ 0x40100053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.s.d         010000000001cccccjjjaaaaa1010011 */
+	{ 0x42000053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.d.s         010000100000cccccjjjaaaaa1010011 */
+	{ 0x5a000053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fsqrt.d          010110100000cccccjjjaaaaa1010011 */
+	{ 0xc2000053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.w.d         110000100000cccccjjjaaaaa1010011 */
+	{ 0xc2100053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.wu.d        110000100001cccccjjjaaaaa1010011 */
+	{ 0xd2000053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.d.w         110100100000cccccjjjaaaaa1010011 */
+	{ 0xd2100053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.d.wu        110100100001cccccjjjaaaaa1010011 */
+	{ 0xe2001053, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fclass.d         111000100000ccccc001aaaaa1010011 */
+	{ 0x00002007, 0x0000707f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* flw              nnnnnnnnnnnnccccc010aaaaa0000111 */
+	{ 0x00002027, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_S }, /* fsw              ooooooodddddccccc010qqqqq0100111 */
+	{ 0x00000043, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fmadd.s          eeeee00dddddcccccjjjaaaaa1000011 */
+	{ 0x00000047, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fmsub.s          eeeee00dddddcccccjjjaaaaa1000111 */
+	{ 0x0000004b, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fnmsub.s         eeeee00dddddcccccjjjaaaaa1001011 */
+	{ 0x0000004f, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fnmadd.s         eeeee00dddddcccccjjjaaaaa1001111 */
+	{ 0x00000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fadd.s           0000000dddddcccccjjjaaaaa1010011 */
+	{ 0x08000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsub.s           0000100dddddcccccjjjaaaaa1010011 */
+	{ 0x10000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fmul.s           0001000dddddcccccjjjaaaaa1010011 */
+	{ 0x18000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fdiv.s           0001100dddddcccccjjjaaaaa1010011 */
+	{ 0x20000053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsgnj.s          0010000dddddccccc000aaaaa1010011 */
+	{ 0x20001053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsgnjn.s         0010000dddddccccc001aaaaa1010011 */
+	{ 0x20002053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsgnjx.s         0010000dddddccccc010aaaaa1010011 */
+	{ 0x28000053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fmin.s           0010100dddddccccc000aaaaa1010011 */
+	{ 0x28001053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fmax.s           0010100dddddccccc001aaaaa1010011 */
+	{ 0xa0000053, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fle.s            1010000dddddccccc000aaaaa1010011 */
+	{ 0xa0001053, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* flt.s            1010000dddddccccc001aaaaa1010011 */
+	{ 0xa0002053, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* feq.s            1010000dddddccccc010aaaaa1010011 */
+	{ 0x58000053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fsqrt.s          010110000000cccccjjjaaaaa1010011 */
+	{ 0xc0000053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.w.s         110000000000cccccjjjaaaaa1010011 */
+	{ 0xc0100053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.wu.s        110000000001cccccjjjaaaaa1010011 */
+	{ 0xd0000053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.s.w         110100000000cccccjjjaaaaa1010011 */
+	{ 0xd0100053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.s.wu        110100000001cccccjjjaaaaa1010011 */
+	{ 0xe0000053, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fmv.x.w          111000000000ccccc000aaaaa1010011 */
+	{ 0xe0001053, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fclass.s         111000000000ccccc001aaaaa1010011 */
+	{ 0xf0000053, 0xfff0707f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fmv.w.x          111100000000ccccc000aaaaa1010011 */
+	{ 0x00004007, 0x0000707f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* flq              nnnnnnnnnnnnccccc100aaaaa0000111 */
+	{ 0x00004027, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_S }, /* fsq              ooooooodddddccccc100qqqqq0100111 */
+	{ 0x06000043, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fmadd.q          eeeee11dddddcccccjjjaaaaa1000011 */
+	{ 0x06000047, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fmsub.q          eeeee11dddddcccccjjjaaaaa1000111 */
+	{ 0x0600004b, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fnmsub.q         eeeee11dddddcccccjjjaaaaa1001011 */
+	{ 0x0600004f, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fnmadd.q         eeeee11dddddcccccjjjaaaaa1001111 */
+	{ 0x06000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fadd.q           0000011dddddcccccjjjaaaaa1010011 */
+	{ 0x0e000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsub.q           0000111dddddcccccjjjaaaaa1010011 */
+	{ 0x16000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fmul.q           0001011dddddcccccjjjaaaaa1010011 */
+	{ 0x1e000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fdiv.q           0001111dddddcccccjjjaaaaa1010011 */
+	{ 0x26000053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsgnj.q          0010011dddddccccc000aaaaa1010011 */
+	{ 0x26001053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsgnjn.q         0010011dddddccccc001aaaaa1010011 */
+	{ 0x26002053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsgnjx.q         0010011dddddccccc010aaaaa1010011 */
+	{ 0x2e000053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fmin.q           0010111dddddccccc000aaaaa1010011 */
+	{ 0x2e001053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fmax.q           0010111dddddccccc001aaaaa1010011 */
+	{ 0xa6000053, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fle.q            1010011dddddccccc000aaaaa1010011 */
+	{ 0xa6001053, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* flt.q            1010011dddddccccc001aaaaa1010011 */
+	{ 0xa6002053, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* feq.q            1010011dddddccccc010aaaaa1010011 */
+	{ 0x40300053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.s.q         010000000011cccccjjjaaaaa1010011 */
+	{ 0x46000053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.q.s         010001100000cccccjjjaaaaa1010011 */
+	{ 0x42300053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.d.q         010000100011cccccjjjaaaaa1010011 */
+	{ 0x46100053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.q.d         010001100001cccccjjjaaaaa1010011 */
+	{ 0x5e000053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fsqrt.q          010111100000cccccjjjaaaaa1010011 */
+	{ 0xc6000053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.w.q         110001100000cccccjjjaaaaa1010011 */
+	{ 0xc6100053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.wu.q        110001100001cccccjjjaaaaa1010011 */
+	{ 0xd6000053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.q.w         110101100000cccccjjjaaaaa1010011 */
+	{ 0xd6100053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.q.wu        110101100001cccccjjjaaaaa1010011 */
+	{ 0xe6001053, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fclass.q         111001100000ccccc001aaaaa1010011 */
+	{ 0x00001007, 0x0000707f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* flh              nnnnnnnnnnnnccccc001aaaaa0000111 */
+	{ 0x00001027, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_S }, /* fsh              ooooooodddddccccc001qqqqq0100111 */
+	{ 0x04000043, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fmadd.h          eeeee10dddddcccccjjjaaaaa1000011 */
+	{ 0x04000047, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fmsub.h          eeeee10dddddcccccjjjaaaaa1000111 */
+	{ 0x0400004b, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fnmsub.h         eeeee10dddddcccccjjjaaaaa1001011 */
+	{ 0x0400004f, 0x0600007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2 | RISCV_REGS_FPR_RS3, RISCV_IMM_NONE }, /* fnmadd.h         eeeee10dddddcccccjjjaaaaa1001111 */
+	{ 0x04000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fadd.h           0000010dddddcccccjjjaaaaa1010011 */
+	{ 0x0c000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsub.h           0000110dddddcccccjjjaaaaa1010011 */
+	{ 0x14000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fmul.h           0001010dddddcccccjjjaaaaa1010011 */
+	{ 0x1c000053, 0xfe00007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fdiv.h           0001110dddddcccccjjjaaaaa1010011 */
+	{ 0x24000053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsgnj.h          0010010dddddccccc000aaaaa1010011 */
+	{ 0x24001053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsgnjn.h         0010010dddddccccc001aaaaa1010011 */
+	{ 0x24002053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fsgnjx.h         0010010dddddccccc010aaaaa1010011 */
+	{ 0x2c000053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fmin.h           0010110dddddccccc000aaaaa1010011 */
+	{ 0x2c001053, 0xfe00707f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fmax.h           0010110dddddccccc001aaaaa1010011 */
+	{ 0xa4000053, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* fle.h            1010010dddddccccc000aaaaa1010011 */
+	{ 0xa4001053, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* flt.h            1010010dddddccccc001aaaaa1010011 */
+	{ 0xa4002053, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1 | RISCV_REGS_FPR_RS2, RISCV_IMM_NONE }, /* feq.h            1010010dddddccccc010aaaaa1010011 */
+	{ 0x44000053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.h.s         010001000000cccccjjjaaaaa1010011 */
+	{ 0x40200053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.s.h         010000000010cccccjjjaaaaa1010011 */
+	{ 0x5c000053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fsqrt.h          010111000000cccccjjjaaaaa1010011 */
+	{ 0xc4000053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.w.h         110001000000cccccjjjaaaaa1010011 */
+	{ 0xc4100053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.wu.h        110001000001cccccjjjaaaaa1010011 */
+	{ 0xd4000053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.h.w         110101000000cccccjjjaaaaa1010011 */
+	{ 0xd4100053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.h.wu        110101000001cccccjjjaaaaa1010011 */
+	{ 0xe4000053, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fmv.x.h          111001000000ccccc000aaaaa1010011 */
+	{ 0xe4001053, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fclass.h         111001000000ccccc001aaaaa1010011 */
+	{ 0xf4000053, 0xfff0707f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fmv.h.x          111101000000ccccc000aaaaa1010011 */
+	{ 0x0000001b, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* addiw            nnnnnnnnnnnnccccc000aaaaa0011011 */
+	{ 0x00003003, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* ld               nnnnnnnnnnnnccccc011aaaaa0000011 */
+	{ 0x00006003, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_I }, /* lwu              nnnnnnnnnnnnccccc110aaaaa0000011 */
+	{ 0x00003023, 0x0000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_S }, /* sd               ooooooodddddccccc011qqqqq0100011 */
+	{ 0x00001013, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* slli             000000ttttttccccc001aaaaa0010011 */
+	{ 0x00005013, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* srli             000000ttttttccccc101aaaaa0010011 */
+	{ 0x40005013, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* srai             010000ttttttccccc101aaaaa0010011 */
+	{ 0x0000101b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM5 }, /* slliw            0000000uuuuuccccc001aaaaa0011011 */
+	{ 0x0000501b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM5 }, /* srliw            0000000uuuuuccccc101aaaaa0011011 */
+	{ 0x4000501b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM5 }, /* sraiw            0100000uuuuuccccc101aaaaa0011011 */
+	{ 0x0000003b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* addw             0000000dddddccccc000aaaaa0111011 */
+	{ 0x4000003b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* subw             0100000dddddccccc000aaaaa0111011 */
+	{ 0x0000103b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sllw             0000000dddddccccc001aaaaa0111011 */
+	{ 0x0000503b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* srlw             0000000dddddccccc101aaaaa0111011 */
+	{ 0x4000503b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sraw             0100000dddddccccc101aaaaa0111011 */
+	{ 0x00001073, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_CSR }, /* csrrw            nnnnnnnnnnnnccccc001aaaaa1110011 */
+	{ 0x00002073, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_CSR }, /* csrrs            nnnnnnnnnnnnccccc010aaaaa1110011 */
+	{ 0x00003073, 0x0000707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_CSR }, /* csrrc            nnnnnnnnnnnnccccc011aaaaa1110011 */
+	{ 0x00005073, 0x0000707f, RISCV_REGS_GPR_RD, RISCV_IMM_CSR }, /* csrrwi           nnnnnnnnnnnnsssss101aaaaa1110011 */
+	{ 0x00006073, 0x0000707f, RISCV_REGS_GPR_RD, RISCV_IMM_CSR }, /* csrrsi           nnnnnnnnnnnnsssss110aaaaa1110011 */
+	{ 0x00007073, 0x0000707f, RISCV_REGS_GPR_RD, RISCV_IMM_CSR }, /* csrrci           nnnnnnnnnnnnsssss111aaaaa1110011 */
+	{ 0x12000073, 0xfe007fff, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sfence.vma       0001001dddddccccc000000001110011 */
+	{ 0x00000073, 0xffffffff, 0, RISCV_IMM_NONE }, /* ecall            00000000000000000000000001110011 */
+	{ 0x00100073, 0xffffffff, 0, RISCV_IMM_NONE }, /* ebreak           00000000000100000000000001110011 */
+	{ 0x10200073, 0xffffffff, 0, RISCV_IMM_NONE }, /* sret             00010000001000000000000001110011 */
+	{ 0x30200073, 0xffffffff, 0, RISCV_IMM_NONE }, /* mret             00110000001000000000000001110011 */
+	{ 0x7b200073, 0xffffffff, 0, RISCV_IMM_NONE }, /* dret             01111011001000000000000001110011 */
+	{ 0x10500073, 0xffffffff, 0, RISCV_IMM_NONE }, /* wfi              00010000010100000000000001110011 */
+	{ 0x00006013, 0x01f07fff, RISCV_REGS_GPR_RS1, RISCV_IMM_S }, /* prefetch.i       ooooooo00000ccccc110000000010011 */
+	{ 0x00106013, 0x01f07fff, RISCV_REGS_GPR_RS1, RISCV_IMM_S }, /* prefetch.r       ooooooo00001ccccc110000000010011 */
+	{ 0x00306013, 0x01f07fff, RISCV_REGS_GPR_RS1, RISCV_IMM_S }, /* prefetch.w       ooooooo00011ccccc110000000010011 */
+	{ 0x0010200f, 0xfff07fff, RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* cbo.clean        000000000001ccccc010000000001111 */
+	{ 0x0020200f, 0xfff07fff, RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* cbo.flush        000000000010ccccc010000000001111 */
+	{ 0x0000200f, 0xfff07fff, RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* cbo.inval        000000000000ccccc010000000001111 */
+	{ 0x0040200f, 0xfff07fff, RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* cbo.zero         000000000100ccccc010000000001111 */
+	{ 0x04005013, 0x0400707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS3, RISCV_IMM_UIMM6 }, /* fsri             eeeee1ttttttccccc101aaaaa0010011 */
+	{ 0x06001033, 0x0600707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS3, RISCV_IMM_NONE }, /* cmix             eeeee11dddddccccc001aaaaa0110011 */
+	{ 0x06005033, 0x0600707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS3, RISCV_IMM_NONE }, /* cmov             eeeee11dddddccccc101aaaaa0110011 */
+	{ 0x04001033, 0x0600707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS3, RISCV_IMM_NONE }, /* fsl              eeeee10dddddccccc001aaaaa0110011 */
+	{ 0x04005033, 0x0600707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS3, RISCV_IMM_NONE }, /* fsr              eeeee10dddddccccc101aaaaa0110011 */
+	{ 0x20001013, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* sloi             001000ttttttccccc001aaaaa0010011 */
+	{ 0x20005013, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* sroi             001000ttttttccccc101aaaaa0010011 */
+	{ 0x60005013, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* rori             011000ttttttccccc101aaaaa0010011 */
+	{ 0x48001013, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* bclri            010010ttttttccccc001aaaaa0010011 */
+	{ 0x28001013, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* bseti            001010ttttttccccc001aaaaa0010011 */
+	{ 0x68001013, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* binvi            011010ttttttccccc001aaaaa0010011 */
+	{ 0x48005013, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* bexti            010010ttttttccccc101aaaaa0010011 */
+	{ 0x28005013, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* gorci            001010ttttttccccc101aaaaa0010011 */
+	{ 0x68005013, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* grevi            011010ttttttccccc101aaaaa0010011 */
+	{ 0x40007033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* andn             0100000dddddccccc111aaaaa0110011 */
+	{ 0x40006033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* orn              0100000dddddccccc110aaaaa0110011 */
+	{ 0x40004033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* xnor             0100000dddddccccc100aaaaa0110011 */
+	{ 0x20001033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* slo              0010000dddddccccc001aaaaa0110011 */
+	{ 0x20005033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sro              0010000dddddccccc101aaaaa0110011 */
+	{ 0x60001033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* rol              0110000dddddccccc001aaaaa0110011 */
+	{ 0x60005033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* ror              0110000dddddccccc101aaaaa0110011 */
+	{ 0x48001033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* bclr             0100100dddddccccc001aaaaa0110011 */
+	{ 0x28001033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* bset             0010100dddddccccc001aaaaa0110011 */
+	{ 0x68001033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* binv             0110100dddddccccc001aaaaa0110011 */
+	{ 0x48005033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* bext             0100100dddddccccc101aaaaa0110011 */
+	{ 0x28005033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* gorc             0010100dddddccccc101aaaaa0110011 */
+	{ 0x68005033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* grev             0110100dddddccccc101aaaaa0110011 */
+	{ 0x20002033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sh1add           0010000dddddccccc010aaaaa0110011 */
+	{ 0x20004033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sh2add           0010000dddddccccc100aaaaa0110011 */
+	{ 0x20006033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sh3add           0010000dddddccccc110aaaaa0110011 */
+	{ 0x0a001033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* clmul            0000101dddddccccc001aaaaa0110011 */
+	{ 0x0a002033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* clmulr           0000101dddddccccc010aaaaa0110011 */
+	{ 0x0a003033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* clmulh           0000101dddddccccc011aaaaa0110011 */
+	{ 0x0a004033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* min              0000101dddddccccc100aaaaa0110011 */
+	{ 0x0a005033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* minu             0000101dddddccccc101aaaaa0110011 */
+	{ 0x0a006033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* max              0000101dddddccccc110aaaaa0110011 */
+	{ 0x0a007033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* maxu             0000101dddddccccc111aaaaa0110011 */
+	{ 0x08001033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* shfl             0000100dddddccccc001aaaaa0110011 */
+	{ 0x08005033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* unshfl           0000100dddddccccc101aaaaa0110011 */
+	{ 0x08006033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* bcompress        0000100dddddccccc110aaaaa0110011 */
+	{ 0x48006033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* bdecompress      0100100dddddccccc110aaaaa0110011 */
+	{ 0x08004033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* pack             0000100dddddccccc100aaaaa0110011 */
+	{ 0x48004033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* packu            0100100dddddccccc100aaaaa0110011 */
+	{ 0x08007033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* packh            0000100dddddccccc111aaaaa0110011 */
+	{ 0x48007033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* bfp              0100100dddddccccc111aaaaa0110011 */
+	{ 0x08001013, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM5 }, /* shfli            0000100uuuuuccccc001aaaaa0010011 */
+	{ 0x08005013, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM5 }, /* unshfli          0000100uuuuuccccc101aaaaa0010011 */
+	{ 0x28002033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* xperm4           0010100dddddccccc010aaaaa0110011 */
+	{ 0x28004033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* xperm8           0010100dddddccccc100aaaaa0110011 */
+	{ 0x28006033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* xperm16          0010100dddddccccc110aaaaa0110011 */
+	{ 0x60001013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* clz              011000000000ccccc001aaaaa0010011 */
+	{ 0x60101013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* ctz              011000000001ccccc001aaaaa0010011 */
+	{ 0x60201013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* cpop             011000000010ccccc001aaaaa0010011 */
+	{ 0x60401013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* sext.b           011000000100ccccc001aaaaa0010011 */
+	{ 0x60501013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* sext.h           011000000101ccccc001aaaaa0010011 */
+	{ 0x61001013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* crc32.b          011000010000ccccc001aaaaa0010011 */
+	{ 0x61101013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* crc32.h          011000010001ccccc001aaaaa0010011 */
+	{ 0x61201013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* crc32.w          011000010010ccccc001aaaaa0010011 */
+	{ 0x61801013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* crc32c.b         011000011000ccccc001aaaaa0010011 */
+	{ 0x61901013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* crc32c.h         011000011001ccccc001aaaaa0010011 */
+	{ 0x61a01013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* crc32c.w         011000011010ccccc001aaaaa0010011 */
+	{ 0x0400103b, 0x0600707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS3, RISCV_IMM_NONE }, /* fslw             eeeee10dddddccccc001aaaaa0111011 */
+	{ 0x0400503b, 0x0600707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS3, RISCV_IMM_NONE }, /* fsrw             eeeee10dddddccccc101aaaaa0111011 */
+	{ 0x0400501b, 0x0600707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS3, RISCV_IMM_UIMM5 }, /* fsriw            eeeee10uuuuuccccc101aaaaa0011011 */
+	{ 0x0800101b, 0xfc00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM6 }, /* slli.uw          000010ttttttccccc001aaaaa0011011 */
+	{ 0x08003033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* bmator           0000100dddddccccc011aaaaa0110011 */
+	{ 0x48003033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* bmatxor          0100100dddddccccc011aaaaa0110011 */
+	{ 0x0800003b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* add.uw           0000100dddddccccc000aaaaa0111011 */
+	{ 0x2000103b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* slow             0010000dddddccccc001aaaaa0111011 */
+	{ 0x2000503b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* srow             0010000dddddccccc101aaaaa0111011 */
+	{ 0x6000103b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* rolw             0110000dddddccccc001aaaaa0111011 */
+	{ 0x6000503b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* rorw             0110000dddddccccc101aaaaa0111011 */
+	{ 0x2800503b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* gorcw            0010100dddddccccc101aaaaa0111011 */
+	{ 0x6800503b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* grevw            0110100dddddccccc101aaaaa0111011 */
+	{ 0x2000101b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM5 }, /* sloiw            0010000uuuuuccccc001aaaaa0011011 */
+	{ 0x2000501b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM5 }, /* sroiw            0010000uuuuuccccc101aaaaa0011011 */
+	{ 0x6000501b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM5 }, /* roriw            0110000uuuuuccccc101aaaaa0011011 */
+	{ 0x2800501b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM5 }, /* gorciw           0010100uuuuuccccc101aaaaa0011011 */
+	{ 0x6800501b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM5 }, /* greviw           0110100uuuuuccccc101aaaaa0011011 */
+	{ 0x2000203b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sh1add.uw        0010000dddddccccc010aaaaa0111011 */
+	{ 0x2000403b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sh2add.uw        0010000dddddccccc100aaaaa0111011 */
+	{ 0x2000603b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sh3add.uw        0010000dddddccccc110aaaaa0111011 */
+	{ 0x0800103b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* shflw            0000100dddddccccc001aaaaa0111011 */
+	{ 0x0800503b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* unshflw          0000100dddddccccc101aaaaa0111011 */
+	{ 0x0800603b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* bcompressw       0000100dddddccccc110aaaaa0111011 */
+	{ 0x4800603b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* bdecompressw     0100100dddddccccc110aaaaa0111011 */
+	{ 0x0800403b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* packw            0000100dddddccccc100aaaaa0111011 */
+	{ 0x4800403b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* packuw           0100100dddddccccc100aaaaa0111011 */
+	{ 0x4800703b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* bfpw             0100100dddddccccc111aaaaa0111011 */
+	{ 0x28000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* xperm32          0010100dddddccccc000aaaaa0110011 */
+	{ 0x60301013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* bmatflip         011000000011ccccc001aaaaa0010011 */
+	{ 0x61301013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* crc32.d          011000010011ccccc001aaaaa0010011 */
+	{ 0x61b01013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* crc32c.d         011000011011ccccc001aaaaa0010011 */
+	{ 0x6000101b, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* clzw             011000000000ccccc001aaaaa0011011 */
+	{ 0x6010101b, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* ctzw             011000000001ccccc001aaaaa0011011 */
+	{ 0x6020101b, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* cpopw            011000000010ccccc001aaaaa0011011 */
+	{ 0x00003077, 0x0600707f, RISCV_REGS_GPR_RS3 | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* bpick            eeeee00dddddccccc011aaaaa1110111 */
+	{ 0xe8000077, 0xfc00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM6 }, /* bitrevi          111010CCCCCCccccc000aaaaa1110111 */
+	{ 0xd4001077, 0xfc00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM6 }, /* srai.u           110101CCCCCCccccc001aaaaa1110111 */
+	{ 0x48000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* add8             0100100dddddccccc000aaaaa1110111 */
+	{ 0x40000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* add16            0100000dddddccccc000aaaaa1110111 */
+	{ 0xc0001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* add64            1100000dddddccccc001aaaaa1110111 */
+	{ 0xe0000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ave              1110000dddddccccc000aaaaa1110111 */
+	{ 0xe6000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* bitrev           1110011dddddccccc000aaaaa1110111 */
+	{ 0x4e000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* cmpeq8           0100111dddddccccc000aaaaa1110111 */
+	{ 0x4c000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* cmpeq16          0100110dddddccccc000aaaaa1110111 */
+	{ 0x44000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* cras16           0100010dddddccccc000aaaaa1110111 */
+	{ 0x46000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* crsa16           0100011dddddccccc000aaaaa1110111 */
+	{ 0x18000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kadd8            0001100dddddccccc000aaaaa1110111 */
+	{ 0x10000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kadd16           0001000dddddccccc000aaaaa1110111 */
+	{ 0x90001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kadd64           1001000dddddccccc001aaaaa1110111 */
+	{ 0x04001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kaddh            0000010dddddccccc001aaaaa1110111 */
+	{ 0x00001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kaddw            0000000dddddccccc001aaaaa1110111 */
+	{ 0x14000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kcras16          0001010dddddccccc000aaaaa1110111 */
+	{ 0x16000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kcrsa16          0001011dddddccccc000aaaaa1110111 */
+	{ 0x0a001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kdmbb            0000101dddddccccc001aaaaa1110111 */
+	{ 0x1a001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kdmbt            0001101dddddccccc001aaaaa1110111 */
+	{ 0x2a001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kdmtt            0010101dddddccccc001aaaaa1110111 */
+	{ 0xd2001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kdmabb           1101001dddddccccc001aaaaa1110111 */
+	{ 0xe2001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kdmabt           1110001dddddccccc001aaaaa1110111 */
+	{ 0xf2001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kdmatt           1111001dddddccccc001aaaaa1110111 */
+	{ 0x8e000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* khm8             1000111dddddccccc000aaaaa1110111 */
+	{ 0x9e000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* khmx8            1001111dddddccccc000aaaaa1110111 */
+	{ 0x86000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* khm16            1000011dddddccccc000aaaaa1110111 */
+	{ 0x96000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* khmx16           1001011dddddccccc000aaaaa1110111 */
+	{ 0x0c001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* khmbb            0000110dddddccccc001aaaaa1110111 */
+	{ 0x1c001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* khmbt            0001110dddddccccc001aaaaa1110111 */
+	{ 0x2c001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* khmtt            0010110dddddccccc001aaaaa1110111 */
+	{ 0x5a001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmabb            0101101dddddccccc001aaaaa1110111 */
+	{ 0x6a001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmabt            0110101dddddccccc001aaaaa1110111 */
+	{ 0x7a001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmatt            0111101dddddccccc001aaaaa1110111 */
+	{ 0x48001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmada            0100100dddddccccc001aaaaa1110111 */
+	{ 0x4a001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmaxda           0100101dddddccccc001aaaaa1110111 */
+	{ 0x5c001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmads            0101110dddddccccc001aaaaa1110111 */
+	{ 0x6c001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmadrs           0110110dddddccccc001aaaaa1110111 */
+	{ 0x7c001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmaxds           0111110dddddccccc001aaaaa1110111 */
+	{ 0x94001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmar64           1001010dddddccccc001aaaaa1110111 */
+	{ 0x38001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmda             0011100dddddccccc001aaaaa1110111 */
+	{ 0x3a001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmxda            0011101dddddccccc001aaaaa1110111 */
+	{ 0x60001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmac            0110000dddddccccc001aaaaa1110111 */
+	{ 0x70001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmac.u          0111000dddddccccc001aaaaa1110111 */
+	{ 0x46001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmawb           0100011dddddccccc001aaaaa1110111 */
+	{ 0x56001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmawb.u         0101011dddddccccc001aaaaa1110111 */
+	{ 0xce001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmawb2          1100111dddddccccc001aaaaa1110111 */
+	{ 0xde001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmawb2.u        1101111dddddccccc001aaaaa1110111 */
+	{ 0x66001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmawt           0110011dddddccccc001aaaaa1110111 */
+	{ 0x76001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmawt.u         0111011dddddccccc001aaaaa1110111 */
+	{ 0xee001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmawt2          1110111dddddccccc001aaaaa1110111 */
+	{ 0xfe001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmawt2.u        1111111dddddccccc001aaaaa1110111 */
+	{ 0x42001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmsb            0100001dddddccccc001aaaaa1110111 */
+	{ 0x52001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmsb.u          0101001dddddccccc001aaaaa1110111 */
+	{ 0x8e001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmwb2           1000111dddddccccc001aaaaa1110111 */
+	{ 0x9e001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmwb2.u         1001111dddddccccc001aaaaa1110111 */
+	{ 0xae001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmwt2           1010111dddddccccc001aaaaa1110111 */
+	{ 0xbe001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmmwt2.u         1011111dddddccccc001aaaaa1110111 */
+	{ 0x4c001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmsda            0100110dddddccccc001aaaaa1110111 */
+	{ 0x4e001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmsxda           0100111dddddccccc001aaaaa1110111 */
+	{ 0x96001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmsr64           1001011dddddccccc001aaaaa1110111 */
+	{ 0x26001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ksllw            0010011dddddccccc001aaaaa1110111 */
+	{ 0x36001077, 0xfe00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM5 }, /* kslliw           0011011BBBBBccccc001aaaaa1110111 */
+	{ 0x6c000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ksll8            0110110dddddccccc000aaaaa1110111 */
+	{ 0x64000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ksll16           0110010dddddccccc000aaaaa1110111 */
+	{ 0x5e000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kslra8           0101111dddddccccc000aaaaa1110111 */
+	{ 0x6e000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kslra8.u         0110111dddddccccc000aaaaa1110111 */
+	{ 0x56000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kslra16          0101011dddddccccc000aaaaa1110111 */
+	{ 0x66000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kslra16.u        0110011dddddccccc000aaaaa1110111 */
+	{ 0x6e001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kslraw           0110111dddddccccc001aaaaa1110111 */
+	{ 0x7e001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kslraw.u         0111111dddddccccc001aaaaa1110111 */
+	{ 0xc4002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kstas16          1100010dddddccccc010aaaaa1110111 */
+	{ 0xc6002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kstsa16          1100011dddddccccc010aaaaa1110111 */
+	{ 0x1a000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ksub8            0001101dddddccccc000aaaaa1110111 */
+	{ 0x12000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ksub16           0001001dddddccccc000aaaaa1110111 */
+	{ 0x92001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ksub64           1001001dddddccccc001aaaaa1110111 */
+	{ 0x06001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ksubh            0000011dddddccccc001aaaaa1110111 */
+	{ 0x02001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ksubw            0000001dddddccccc001aaaaa1110111 */
+	{ 0x62001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kwmmul           0110001dddddccccc001aaaaa1110111 */
+	{ 0x72001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kwmmul.u         0111001dddddccccc001aaaaa1110111 */
+	{ 0xc4001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* maddr32          1100010dddddccccc001aaaaa1110111 */
+	{ 0xf2000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* maxw             1111001dddddccccc000aaaaa1110111 */
+	{ 0xf0000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* minw             1111000dddddccccc000aaaaa1110111 */
+	{ 0xc6001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* msubr32          1100011dddddccccc001aaaaa1110111 */
+	{ 0xf0001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* mulr64           1111000dddddccccc001aaaaa1110111 */
+	{ 0xe0001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* mulsr64          1110000dddddccccc001aaaaa1110111 */
+	{ 0xfc000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* pbsad            1111110dddddccccc000aaaaa1110111 */
+	{ 0xfe000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* pbsada           1111111dddddccccc000aaaaa1110111 */
+	{ 0x0e001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* pkbb16           0000111dddddccccc001aaaaa1110111 */
+	{ 0x1e001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* pkbt16           0001111dddddccccc001aaaaa1110111 */
+	{ 0x2e001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* pktt16           0010111dddddccccc001aaaaa1110111 */
+	{ 0x3e001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* pktb16           0011111dddddccccc001aaaaa1110111 */
+	{ 0x08000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* radd8            0000100dddddccccc000aaaaa1110111 */
+	{ 0x00000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* radd16           0000000dddddccccc000aaaaa1110111 */
+	{ 0x80001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* radd64           1000000dddddccccc001aaaaa1110111 */
+	{ 0x20001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* raddw            0010000dddddccccc001aaaaa1110111 */
+	{ 0x04000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rcras16          0000010dddddccccc000aaaaa1110111 */
+	{ 0x06000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rcrsa16          0000011dddddccccc000aaaaa1110111 */
+	{ 0xb4002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rstas16          1011010dddddccccc010aaaaa1110111 */
+	{ 0xb6002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rstsa16          1011011dddddccccc010aaaaa1110111 */
+	{ 0x0a000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rsub8            0000101dddddccccc000aaaaa1110111 */
+	{ 0x02000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rsub16           0000001dddddccccc000aaaaa1110111 */
+	{ 0x82001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rsub64           1000001dddddccccc001aaaaa1110111 */
+	{ 0x22001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rsubw            0010001dddddccccc001aaaaa1110111 */
+	{ 0xe4000077, 0xfe00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM5 }, /* sclip32          1110010BBBBBccccc000aaaaa1110111 */
+	{ 0x1e000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* scmple8          0001111dddddccccc000aaaaa1110111 */
+	{ 0x1c000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* scmple16         0001110dddddccccc000aaaaa1110111 */
+	{ 0x0e000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* scmplt8          0000111dddddccccc000aaaaa1110111 */
+	{ 0x0c000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* scmplt16         0000110dddddccccc000aaaaa1110111 */
+	{ 0x5c000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sll8             0101110dddddccccc000aaaaa1110111 */
+	{ 0x54000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sll16            0101010dddddccccc000aaaaa1110111 */
+	{ 0x5e001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smal             0101111dddddccccc001aaaaa1110111 */
+	{ 0x88001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smalbb           1000100dddddccccc001aaaaa1110111 */
+	{ 0x98001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smalbt           1001100dddddccccc001aaaaa1110111 */
+	{ 0xa8001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smaltt           1010100dddddccccc001aaaaa1110111 */
+	{ 0x8c001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smalda           1000110dddddccccc001aaaaa1110111 */
+	{ 0x9c001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smalxda          1001110dddddccccc001aaaaa1110111 */
+	{ 0x8a001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smalds           1000101dddddccccc001aaaaa1110111 */
+	{ 0x9a001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smaldrs          1001101dddddccccc001aaaaa1110111 */
+	{ 0xaa001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smalxds          1010101dddddccccc001aaaaa1110111 */
+	{ 0x84001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smar64           1000010dddddccccc001aaaaa1110111 */
+	{ 0xc8000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smaqa            1100100dddddccccc000aaaaa1110111 */
+	{ 0xca000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smaqa.su         1100101dddddccccc000aaaaa1110111 */
+	{ 0x8a000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smax8            1000101dddddccccc000aaaaa1110111 */
+	{ 0x82000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smax16           1000001dddddccccc000aaaaa1110111 */
+	{ 0x08001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smbb16           0000100dddddccccc001aaaaa1110111 */
+	{ 0x18001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smbt16           0001100dddddccccc001aaaaa1110111 */
+	{ 0x28001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smtt16           0010100dddddccccc001aaaaa1110111 */
+	{ 0x58001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smds             0101100dddddccccc001aaaaa1110111 */
+	{ 0x68001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smdrs            0110100dddddccccc001aaaaa1110111 */
+	{ 0x78001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smxds            0111100dddddccccc001aaaaa1110111 */
+	{ 0x88000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smin8            1000100dddddccccc000aaaaa1110111 */
+	{ 0x80000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smin16           1000000dddddccccc000aaaaa1110111 */
+	{ 0x40001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smmul            0100000dddddccccc001aaaaa1110111 */
+	{ 0x50001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smmul.u          0101000dddddccccc001aaaaa1110111 */
+	{ 0x44001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smmwb            0100010dddddccccc001aaaaa1110111 */
+	{ 0x54001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smmwb.u          0101010dddddccccc001aaaaa1110111 */
+	{ 0x64001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smmwt            0110010dddddccccc001aaaaa1110111 */
+	{ 0x74001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smmwt.u          0111010dddddccccc001aaaaa1110111 */
+	{ 0xac001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smslda           1010110dddddccccc001aaaaa1110111 */
+	{ 0xbc001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smslxda          1011110dddddccccc001aaaaa1110111 */
+	{ 0x86001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smsr64           1000011dddddccccc001aaaaa1110111 */
+	{ 0xa8000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smul8            1010100dddddccccc000aaaaa1110111 */
+	{ 0xaa000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smulx8           1010101dddddccccc000aaaaa1110111 */
+	{ 0xa0000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smul16           1010000dddddccccc000aaaaa1110111 */
+	{ 0xa2000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smulx16          1010001dddddccccc000aaaaa1110111 */
+	{ 0x24001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sra.u            0010010dddddccccc001aaaaa1110111 */
+	{ 0x58000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sra8             0101100dddddccccc000aaaaa1110111 */
+	{ 0x68000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sra8.u           0110100dddddccccc000aaaaa1110111 */
+	{ 0x50000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sra16            0101000dddddccccc000aaaaa1110111 */
+	{ 0x60000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sra16.u          0110000dddddccccc000aaaaa1110111 */
+	{ 0x5a000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* srl8             0101101dddddccccc000aaaaa1110111 */
+	{ 0x6a000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* srl8.u           0110101dddddccccc000aaaaa1110111 */
+	{ 0x52000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* srl16            0101001dddddccccc000aaaaa1110111 */
+	{ 0x62000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* srl16.u          0110001dddddccccc000aaaaa1110111 */
+	{ 0xf4002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* stas16           1111010dddddccccc010aaaaa1110111 */
+	{ 0xf6002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* stsa16           1111011dddddccccc010aaaaa1110111 */
+	{ 0x4a000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sub8             0100101dddddccccc000aaaaa1110111 */
+	{ 0x42000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sub16            0100001dddddccccc000aaaaa1110111 */
+	{ 0xc2001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sub64            1100001dddddccccc001aaaaa1110111 */
+	{ 0xf4000077, 0xfe00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM5 }, /* uclip32          1111010BBBBBccccc000aaaaa1110111 */
+	{ 0x3e000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ucmple8          0011111dddddccccc000aaaaa1110111 */
+	{ 0x3c000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ucmple16         0011110dddddccccc000aaaaa1110111 */
+	{ 0x2e000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ucmplt8          0010111dddddccccc000aaaaa1110111 */
+	{ 0x2c000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ucmplt16         0010110dddddccccc000aaaaa1110111 */
+	{ 0x38000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukadd8           0011100dddddccccc000aaaaa1110111 */
+	{ 0x30000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukadd16          0011000dddddccccc000aaaaa1110111 */
+	{ 0xb0001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukadd64          1011000dddddccccc001aaaaa1110111 */
+	{ 0x14001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukaddh           0001010dddddccccc001aaaaa1110111 */
+	{ 0x10001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukaddw           0001000dddddccccc001aaaaa1110111 */
+	{ 0x34000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukcras16         0011010dddddccccc000aaaaa1110111 */
+	{ 0x36000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukcrsa16         0011011dddddccccc000aaaaa1110111 */
+	{ 0xb4001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukmar64          1011010dddddccccc001aaaaa1110111 */
+	{ 0xb6001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukmsr64          1011011dddddccccc001aaaaa1110111 */
+	{ 0xe4002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukstas16         1110010dddddccccc010aaaaa1110111 */
+	{ 0xe6002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukstsa16         1110011dddddccccc010aaaaa1110111 */
+	{ 0x3a000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* uksub8           0011101dddddccccc000aaaaa1110111 */
+	{ 0x32000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* uksub16          0011001dddddccccc000aaaaa1110111 */
+	{ 0xb2001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* uksub64          1011001dddddccccc001aaaaa1110111 */
+	{ 0x16001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* uksubh           0001011dddddccccc001aaaaa1110111 */
+	{ 0x12001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* uksubw           0001001dddddccccc001aaaaa1110111 */
+	{ 0xa4001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umar64           1010010dddddccccc001aaaaa1110111 */
+	{ 0xcc000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umaqa            1100110dddddccccc000aaaaa1110111 */
+	{ 0x9a000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umax8            1001101dddddccccc000aaaaa1110111 */
+	{ 0x92000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umax16           1001001dddddccccc000aaaaa1110111 */
+	{ 0x98000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umin8            1001100dddddccccc000aaaaa1110111 */
+	{ 0x90000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umin16           1001000dddddccccc000aaaaa1110111 */
+	{ 0xa6001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umsr64           1010011dddddccccc001aaaaa1110111 */
+	{ 0xb8000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umul8            1011100dddddccccc000aaaaa1110111 */
+	{ 0xba000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umulx8           1011101dddddccccc000aaaaa1110111 */
+	{ 0xb0000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umul16           1011000dddddccccc000aaaaa1110111 */
+	{ 0xb2000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umulx16          1011001dddddccccc000aaaaa1110111 */
+	{ 0x28000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* uradd8           0010100dddddccccc000aaaaa1110111 */
+	{ 0x20000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* uradd16          0010000dddddccccc000aaaaa1110111 */
+	{ 0xa0001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* uradd64          1010000dddddccccc001aaaaa1110111 */
+	{ 0x30001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* uraddw           0011000dddddccccc001aaaaa1110111 */
+	{ 0x24000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* urcras16         0010010dddddccccc000aaaaa1110111 */
+	{ 0x26000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* urcrsa16         0010011dddddccccc000aaaaa1110111 */
+	{ 0xd4002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* urstas16         1101010dddddccccc010aaaaa1110111 */
+	{ 0xd6002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* urstsa16         1101011dddddccccc010aaaaa1110111 */
+	{ 0x2a000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ursub8           0010101dddddccccc000aaaaa1110111 */
+	{ 0x22000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ursub16          0010001dddddccccc000aaaaa1110111 */
+	{ 0xa2001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ursub64          1010001dddddccccc001aaaaa1110111 */
+	{ 0x32001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ursubw           0011001dddddccccc001aaaaa1110111 */
+	{ 0xde000077, 0xfe00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM5 }, /* wexti            1101111BBBBBccccc000aaaaa1110111 */
+	{ 0xce000077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* wext             1100111dddddccccc000aaaaa1110111 */
+	{ 0x40002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* add32            0100000dddddccccc010aaaaa1110111 */
+	{ 0x44002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* cras32           0100010dddddccccc010aaaaa1110111 */
+	{ 0x46002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* crsa32           0100011dddddccccc010aaaaa1110111 */
+	{ 0x10002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kadd32           0001000dddddccccc010aaaaa1110111 */
+	{ 0x14002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kcras32          0001010dddddccccc010aaaaa1110111 */
+	{ 0x16002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kcrsa32          0001011dddddccccc010aaaaa1110111 */
+	{ 0xda001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kdmbb16          1101101dddddccccc001aaaaa1110111 */
+	{ 0xea001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kdmbt16          1110101dddddccccc001aaaaa1110111 */
+	{ 0xfa001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kdmtt16          1111101dddddccccc001aaaaa1110111 */
+	{ 0xd8001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kdmabb16         1101100dddddccccc001aaaaa1110111 */
+	{ 0xe8001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kdmabt16         1110100dddddccccc001aaaaa1110111 */
+	{ 0xf8001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kdmatt16         1111100dddddccccc001aaaaa1110111 */
+	{ 0xdc001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* khmbb16          1101110dddddccccc001aaaaa1110111 */
+	{ 0xec001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* khmbt16          1110110dddddccccc001aaaaa1110111 */
+	{ 0xfc001077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* khmtt16          1111110dddddccccc001aaaaa1110111 */
+	{ 0x5a002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmabb32          0101101dddddccccc010aaaaa1110111 */
+	{ 0x6a002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmabt32          0110101dddddccccc010aaaaa1110111 */
+	{ 0x7a002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmatt32          0111101dddddccccc010aaaaa1110111 */
+	{ 0x4a002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmaxda32         0100101dddddccccc010aaaaa1110111 */
+	{ 0x38002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmda32           0011100dddddccccc010aaaaa1110111 */
+	{ 0x3a002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmxda32          0011101dddddccccc010aaaaa1110111 */
+	{ 0x5c002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmads32          0101110dddddccccc010aaaaa1110111 */
+	{ 0x6c002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmadrs32         0110110dddddccccc010aaaaa1110111 */
+	{ 0x7c002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmaxds32         0111110dddddccccc010aaaaa1110111 */
+	{ 0x4c002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmsda32          0100110dddddccccc010aaaaa1110111 */
+	{ 0x4e002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kmsxda32         0100111dddddccccc010aaaaa1110111 */
+	{ 0x64002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ksll32           0110010dddddccccc010aaaaa1110111 */
+	{ 0x84002077, 0xfe00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM5 }, /* kslli32          1000010BBBBBccccc010aaaaa1110111 */
+	{ 0x56002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kslra32          0101011dddddccccc010aaaaa1110111 */
+	{ 0x66002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kslra32.u        0110011dddddccccc010aaaaa1110111 */
+	{ 0xc0002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kstas32          1100000dddddccccc010aaaaa1110111 */
+	{ 0xc2002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kstsa32          1100001dddddccccc010aaaaa1110111 */
+	{ 0x12002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ksub32           0001001dddddccccc010aaaaa1110111 */
+	{ 0x0e002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* pkbb32           0000111dddddccccc010aaaaa1110111 */
+	{ 0x1e002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* pkbt32           0001111dddddccccc010aaaaa1110111 */
+	{ 0x2e002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* pktt32           0010111dddddccccc010aaaaa1110111 */
+	{ 0x3e002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* pktb32           0011111dddddccccc010aaaaa1110111 */
+	{ 0x00002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* radd32           0000000dddddccccc010aaaaa1110111 */
+	{ 0x04002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rcras32          0000010dddddccccc010aaaaa1110111 */
+	{ 0x06002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rcrsa32          0000011dddddccccc010aaaaa1110111 */
+	{ 0xb0002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rstas32          1011000dddddccccc010aaaaa1110111 */
+	{ 0xb2002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rstsa32          1011001dddddccccc010aaaaa1110111 */
+	{ 0x02002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* rsub32           0000001dddddccccc010aaaaa1110111 */
+	{ 0x54002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sll32            0101010dddddccccc010aaaaa1110111 */
+	{ 0x74002077, 0xfe00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM5 }, /* slli32           0111010BBBBBccccc010aaaaa1110111 */
+	{ 0x92002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smax32           1001001dddddccccc010aaaaa1110111 */
+	{ 0x18002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smbt32           0001100dddddccccc010aaaaa1110111 */
+	{ 0x28002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smtt32           0010100dddddccccc010aaaaa1110111 */
+	{ 0x58002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smds32           0101100dddddccccc010aaaaa1110111 */
+	{ 0x68002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smdrs32          0110100dddddccccc010aaaaa1110111 */
+	{ 0x78002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smxds32          0111100dddddccccc010aaaaa1110111 */
+	{ 0x90002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* smin32           1001000dddddccccc010aaaaa1110111 */
+	{ 0x50002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sra32            0101000dddddccccc010aaaaa1110111 */
+	{ 0x60002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sra32.u          0110000dddddccccc010aaaaa1110111 */
+	{ 0x70002077, 0xfe00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM5 }, /* srai32           0111000BBBBBccccc010aaaaa1110111 */
+	{ 0x80002077, 0xfe00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM5 }, /* srai32.u         1000000BBBBBccccc010aaaaa1110111 */
+	{ 0x34001077, 0xfe00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM5 }, /* sraiw.u          0011010BBBBBccccc001aaaaa1110111 */
+	{ 0x52002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* srl32            0101001dddddccccc010aaaaa1110111 */
+	{ 0x62002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* srl32.u          0110001dddddccccc010aaaaa1110111 */
+	{ 0x72002077, 0xfe00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM5 }, /* srli32           0111001BBBBBccccc010aaaaa1110111 */
+	{ 0x82002077, 0xfe00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM5 }, /* srli32.u         1000001BBBBBccccc010aaaaa1110111 */
+	{ 0xf0002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* stas32           1111000dddddccccc010aaaaa1110111 */
+	{ 0xf2002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* stsa32           1111001dddddccccc010aaaaa1110111 */
+	{ 0x42002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sub32            0100001dddddccccc010aaaaa1110111 */
+	{ 0x30002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukadd32          0011000dddddccccc010aaaaa1110111 */
+	{ 0x34002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukcras32         0011010dddddccccc010aaaaa1110111 */
+	{ 0x36002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukcrsa32         0011011dddddccccc010aaaaa1110111 */
+	{ 0xe0002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukstas32         1110000dddddccccc010aaaaa1110111 */
+	{ 0xe2002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ukstsa32         1110001dddddccccc010aaaaa1110111 */
+	{ 0x32002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* uksub32          0011001dddddccccc010aaaaa1110111 */
+	{ 0xa2002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umax32           1010001dddddccccc010aaaaa1110111 */
+	{ 0xa0002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* umin32           1010000dddddccccc010aaaaa1110111 */
+	{ 0x20002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* uradd32          0010000dddddccccc010aaaaa1110111 */
+	{ 0x24002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* urcras32         0010010dddddccccc010aaaaa1110111 */
+	{ 0x26002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* urcrsa32         0010011dddddccccc010aaaaa1110111 */
+	{ 0xd0002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* urstas32         1101000dddddccccc010aaaaa1110111 */
+	{ 0xd2002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* urstsa32         1101001dddddccccc010aaaaa1110111 */
+	{ 0x22002077, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* ursub32          0010001dddddccccc010aaaaa1110111 */
+	{ 0x75000077, 0xff00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM4 }, /* kslli16          01110101AAAAccccc000aaaaa1110111 */
+	{ 0x84000077, 0xff00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM4 }, /* sclip16          10000100AAAAccccc000aaaaa1110111 */
+	{ 0x74000077, 0xff00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM4 }, /* slli16           01110100AAAAccccc000aaaaa1110111 */
+	{ 0x70000077, 0xff00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM4 }, /* srai16           01110000AAAAccccc000aaaaa1110111 */
+	{ 0x71000077, 0xff00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM4 }, /* srai16.u         01110001AAAAccccc000aaaaa1110111 */
+	{ 0x72000077, 0xff00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM4 }, /* srli16           01110010AAAAccccc000aaaaa1110111 */
+	{ 0x73000077, 0xff00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM4 }, /* srli16.u         01110011AAAAccccc000aaaaa1110111 */
+	{ 0x85000077, 0xff00707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM4 }, /* uclip16          10000101AAAAccccc000aaaaa1110111 */
+	{ 0xac000077, 0xff80707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM3 }, /* insb             101011000zzzccccc000aaaaa1110111 */
+	{ 0x7c800077, 0xff80707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM3 }, /* kslli8           011111001zzzccccc000aaaaa1110111 */
+	{ 0x8c000077, 0xff80707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM3 }, /* sclip8           100011000zzzccccc000aaaaa1110111 */
+	{ 0x7c000077, 0xff80707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM3 }, /* slli8            011111000zzzccccc000aaaaa1110111 */
+	{ 0x78000077, 0xff80707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM3 }, /* srai8            011110000zzzccccc000aaaaa1110111 */
+	{ 0x78800077, 0xff80707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM3 }, /* srai8.u          011110001zzzccccc000aaaaa1110111 */
+	{ 0x7a000077, 0xff80707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM3 }, /* srli8            011110100zzzccccc000aaaaa1110111 */
+	{ 0x7a800077, 0xff80707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM3 }, /* srli8.u          011110101zzzccccc000aaaaa1110111 */
+	{ 0x8d000077, 0xff80707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_UIMM3 }, /* uclip8           100011010zzzccccc000aaaaa1110111 */
+	{ 0xae000077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* clrs8            101011100000ccccc000aaaaa1110111 */
+	{ 0xae800077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* clrs16           101011101000ccccc000aaaaa1110111 */
+	{ 0xaf800077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* clrs32           101011111000ccccc000aaaaa1110111 */
+	{ 0xae300077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* clo8             101011100011ccccc000aaaaa1110111 */
+	{ 0xaeb00077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* clo16            101011101011ccccc000aaaaa1110111 */
+	{ 0xafb00077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* clo32            101011111011ccccc000aaaaa1110111 */
+	{ 0xae100077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* clz8             101011100001ccccc000aaaaa1110111 */
+	{ 0xae900077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* clz16            101011101001ccccc000aaaaa1110111 */
+	{ 0xaf900077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* clz32            101011111001ccccc000aaaaa1110111 */
+	{ 0xad000077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kabs8            101011010000ccccc000aaaaa1110111 */
+	{ 0xad100077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kabs16           101011010001ccccc000aaaaa1110111 */
+	{ 0xad400077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kabsw            101011010100ccccc000aaaaa1110111 */
+	{ 0xac800077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sunpkd810        101011001000ccccc000aaaaa1110111 */
+	{ 0xac900077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sunpkd820        101011001001ccccc000aaaaa1110111 */
+	{ 0xaca00077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sunpkd830        101011001010ccccc000aaaaa1110111 */
+	{ 0xacb00077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sunpkd831        101011001011ccccc000aaaaa1110111 */
+	{ 0xad300077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* sunpkd832        101011010011ccccc000aaaaa1110111 */
+	{ 0xad800077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* swap8            101011011000ccccc000aaaaa1110111 */
+	{ 0xacc00077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* zunpkd810        101011001100ccccc000aaaaa1110111 */
+	{ 0xacd00077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* zunpkd820        101011001101ccccc000aaaaa1110111 */
+	{ 0xace00077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* zunpkd830        101011001110ccccc000aaaaa1110111 */
+	{ 0xacf00077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* zunpkd831        101011001111ccccc000aaaaa1110111 */
+	{ 0xad700077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* zunpkd832        101011010111ccccc000aaaaa1110111 */
+	{ 0xad200077, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* kabs32           101011010010ccccc000aaaaa1110111 */
+	{ 0x04000007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vluxei8.v        KKK001HGGGGGccccc000DDDDD0000111 */
+	{ 0x04005007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vluxei16.v       KKK001HGGGGGccccc101DDDDD0000111 */
+	{ 0x04006007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vluxei32.v       KKK001HGGGGGccccc110DDDDD0000111 */
+	{ 0x04007007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vluxei64.v       KKK001HGGGGGccccc111DDDDD0000111 */
+	{ 0x14000007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vluxei128.v      KKK101HGGGGGccccc000DDDDD0000111 */
+	{ 0x14005007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vluxei256.v      KKK101HGGGGGccccc101DDDDD0000111 */
+	{ 0x14006007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vluxei512.v      KKK101HGGGGGccccc110DDDDD0000111 */
+	{ 0x14007007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vluxei1024.v     KKK101HGGGGGccccc111DDDDD0000111 */
+	{ 0x04000027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsuxei8.v        KKK001HGGGGGccccc000EEEEE0100111 */
+	{ 0x04005027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsuxei16.v       KKK001HGGGGGccccc101EEEEE0100111 */
+	{ 0x04006027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsuxei32.v       KKK001HGGGGGccccc110EEEEE0100111 */
+	{ 0x04007027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsuxei64.v       KKK001HGGGGGccccc111EEEEE0100111 */
+	{ 0x14000027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsuxei128.v      KKK101HGGGGGccccc000EEEEE0100111 */
+	{ 0x14005027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsuxei256.v      KKK101HGGGGGccccc101EEEEE0100111 */
+	{ 0x14006027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsuxei512.v      KKK101HGGGGGccccc110EEEEE0100111 */
+	{ 0x14007027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsuxei1024.v     KKK101HGGGGGccccc111EEEEE0100111 */
+	{ 0x08000007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vlse8.v          KKK010Hdddddccccc000DDDDD0000111 */
+	{ 0x08005007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vlse16.v         KKK010Hdddddccccc101DDDDD0000111 */
+	{ 0x08006007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vlse32.v         KKK010Hdddddccccc110DDDDD0000111 */
+	{ 0x08007007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vlse64.v         KKK010Hdddddccccc111DDDDD0000111 */
+	{ 0x18000007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vlse128.v        KKK110Hdddddccccc000DDDDD0000111 */
+	{ 0x18005007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vlse256.v        KKK110Hdddddccccc101DDDDD0000111 */
+	{ 0x18006007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vlse512.v        KKK110Hdddddccccc110DDDDD0000111 */
+	{ 0x18007007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vlse1024.v       KKK110Hdddddccccc111DDDDD0000111 */
+	{ 0x08000027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsse8.v          KKK010Hdddddccccc000EEEEE0100111 */
+	{ 0x08005027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsse16.v         KKK010Hdddddccccc101EEEEE0100111 */
+	{ 0x08006027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsse32.v         KKK010Hdddddccccc110EEEEE0100111 */
+	{ 0x08007027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsse64.v         KKK010Hdddddccccc111EEEEE0100111 */
+	{ 0x18000027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsse128.v        KKK110Hdddddccccc000EEEEE0100111 */
+	{ 0x18005027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsse256.v        KKK110Hdddddccccc101EEEEE0100111 */
+	{ 0x18006027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsse512.v        KKK110Hdddddccccc110EEEEE0100111 */
+	{ 0x18007027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsse1024.v       KKK110Hdddddccccc111EEEEE0100111 */
+	{ 0x0c000007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vloxei8.v        KKK011HGGGGGccccc000DDDDD0000111 */
+	{ 0x0c005007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vloxei16.v       KKK011HGGGGGccccc101DDDDD0000111 */
+	{ 0x0c006007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vloxei32.v       KKK011HGGGGGccccc110DDDDD0000111 */
+	{ 0x0c007007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vloxei64.v       KKK011HGGGGGccccc111DDDDD0000111 */
+	{ 0x1c000007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vloxei128.v      KKK111HGGGGGccccc000DDDDD0000111 */
+	{ 0x1c005007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vloxei256.v      KKK111HGGGGGccccc101DDDDD0000111 */
+	{ 0x1c006007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vloxei512.v      KKK111HGGGGGccccc110DDDDD0000111 */
+	{ 0x1c007007, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vloxei1024.v     KKK111HGGGGGccccc111DDDDD0000111 */
+	{ 0x0c000027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsoxei8.v        KKK011HGGGGGccccc000EEEEE0100111 */
+	{ 0x0c005027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsoxei16.v       KKK011HGGGGGccccc101EEEEE0100111 */
+	{ 0x0c006027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsoxei32.v       KKK011HGGGGGccccc110EEEEE0100111 */
+	{ 0x0c007027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsoxei64.v       KKK011HGGGGGccccc111EEEEE0100111 */
+	{ 0x1c000027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsoxei128.v      KKK111HGGGGGccccc000EEEEE0100111 */
+	{ 0x1c005027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsoxei256.v      KKK111HGGGGGccccc101EEEEE0100111 */
+	{ 0x1c006027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsoxei512.v      KKK111HGGGGGccccc110EEEEE0100111 */
+	{ 0x1c007027, 0x1c00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsoxei1024.v     KKK111HGGGGGccccc111EEEEE0100111 */
+	{ 0x00000007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle8.v           KKK000H00000ccccc000DDDDD0000111 */
+	{ 0x00005007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle16.v          KKK000H00000ccccc101DDDDD0000111 */
+	{ 0x00006007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle32.v          KKK000H00000ccccc110DDDDD0000111 */
+	{ 0x00007007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle64.v          KKK000H00000ccccc111DDDDD0000111 */
+	{ 0x10000007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle128.v         KKK100H00000ccccc000DDDDD0000111 */
+	{ 0x10005007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle256.v         KKK100H00000ccccc101DDDDD0000111 */
+	{ 0x10006007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle512.v         KKK100H00000ccccc110DDDDD0000111 */
+	{ 0x10007007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle1024.v        KKK100H00000ccccc111DDDDD0000111 */
+	{ 0x00000027, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vse8.v           KKK000H00000ccccc000EEEEE0100111 */
+	{ 0x00005027, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vse16.v          KKK000H00000ccccc101EEEEE0100111 */
+	{ 0x00006027, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vse32.v          KKK000H00000ccccc110EEEEE0100111 */
+	{ 0x00007027, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vse64.v          KKK000H00000ccccc111EEEEE0100111 */
+	{ 0x10000027, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vse128.v         KKK100H00000ccccc000EEEEE0100111 */
+	{ 0x10005027, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vse256.v         KKK100H00000ccccc101EEEEE0100111 */
+	{ 0x10006027, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vse512.v         KKK100H00000ccccc110EEEEE0100111 */
+	{ 0x10007027, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vse1024.v        KKK100H00000ccccc111EEEEE0100111 */
+	{ 0x01000007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle8ff.v         KKK000H10000ccccc000DDDDD0000111 */
+	{ 0x01005007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle16ff.v        KKK000H10000ccccc101DDDDD0000111 */
+	{ 0x01006007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle32ff.v        KKK000H10000ccccc110DDDDD0000111 */
+	{ 0x01007007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle64ff.v        KKK000H10000ccccc111DDDDD0000111 */
+	{ 0x11000007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle128ff.v       KKK100H10000ccccc000DDDDD0000111 */
+	{ 0x11005007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle256ff.v       KKK100H10000ccccc101DDDDD0000111 */
+	{ 0x11006007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle512ff.v       KKK100H10000ccccc110DDDDD0000111 */
+	{ 0x11007007, 0x1df0707f, RISCV_REGS_VEC_VM | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle1024ff.v      KKK100H10000ccccc111DDDDD0000111 */
+	{ 0x00007057, 0x8000707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_ZIMM11 }, /* vsetvli          0NNNNNNNNNNNccccc111aaaaa1010111 */
+	{ 0xc0007057, 0xc000707f, RISCV_REGS_GPR_RD, RISCV_IMM_ZIMM10 }, /* vsetivli         11MMMMMMMMMMsssss111aaaaa1010111 */
+	{ 0x0800002f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoswapei8.v    00001IHGGGGGccccc000DDDDD0101111 */
+	{ 0x0000002f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoaddei8.v     00000IHGGGGGccccc000DDDDD0101111 */
+	{ 0x2000002f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoxorei8.v     00100IHGGGGGccccc000DDDDD0101111 */
+	{ 0x6000002f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoandei8.v     01100IHGGGGGccccc000DDDDD0101111 */
+	{ 0x4000002f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoorei8.v      01000IHGGGGGccccc000DDDDD0101111 */
+	{ 0x8000002f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamominei8.v     10000IHGGGGGccccc000DDDDD0101111 */
+	{ 0xa000002f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamomaxei8.v     10100IHGGGGGccccc000DDDDD0101111 */
+	{ 0xc000002f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamominuei8.v    11000IHGGGGGccccc000DDDDD0101111 */
+	{ 0xe000002f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamomaxuei8.v    11100IHGGGGGccccc000DDDDD0101111 */
+	{ 0x0800502f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoswapei16.v   00001IHGGGGGccccc101DDDDD0101111 */
+	{ 0x0000502f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoaddei16.v    00000IHGGGGGccccc101DDDDD0101111 */
+	{ 0x2000502f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoxorei16.v    00100IHGGGGGccccc101DDDDD0101111 */
+	{ 0x6000502f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoandei16.v    01100IHGGGGGccccc101DDDDD0101111 */
+	{ 0x4000502f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoorei16.v     01000IHGGGGGccccc101DDDDD0101111 */
+	{ 0x8000502f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamominei16.v    10000IHGGGGGccccc101DDDDD0101111 */
+	{ 0xa000502f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamomaxei16.v    10100IHGGGGGccccc101DDDDD0101111 */
+	{ 0xc000502f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamominuei16.v   11000IHGGGGGccccc101DDDDD0101111 */
+	{ 0xe000502f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamomaxuei16.v   11100IHGGGGGccccc101DDDDD0101111 */
+	{ 0x0800602f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoswapei32.v   00001IHGGGGGccccc110DDDDD0101111 */
+	{ 0x0000602f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoaddei32.v    00000IHGGGGGccccc110DDDDD0101111 */
+	{ 0x2000602f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoxorei32.v    00100IHGGGGGccccc110DDDDD0101111 */
+	{ 0x6000602f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoandei32.v    01100IHGGGGGccccc110DDDDD0101111 */
+	{ 0x4000602f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoorei32.v     01000IHGGGGGccccc110DDDDD0101111 */
+	{ 0x8000602f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamominei32.v    10000IHGGGGGccccc110DDDDD0101111 */
+	{ 0xa000602f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamomaxei32.v    10100IHGGGGGccccc110DDDDD0101111 */
+	{ 0xc000602f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamominuei32.v   11000IHGGGGGccccc110DDDDD0101111 */
+	{ 0xe000602f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamomaxuei32.v   11100IHGGGGGccccc110DDDDD0101111 */
+	{ 0x0800702f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoswapei64.v   00001IHGGGGGccccc111DDDDD0101111 */
+	{ 0x0000702f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoaddei64.v    00000IHGGGGGccccc111DDDDD0101111 */
+	{ 0x2000702f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoxorei64.v    00100IHGGGGGccccc111DDDDD0101111 */
+	{ 0x6000702f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoandei64.v    01100IHGGGGGccccc111DDDDD0101111 */
+	{ 0x4000702f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamoorei64.v     01000IHGGGGGccccc111DDDDD0101111 */
+	{ 0x8000702f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamominei64.v    10000IHGGGGGccccc111DDDDD0101111 */
+	{ 0xa000702f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamomaxei64.v    10100IHGGGGGccccc111DDDDD0101111 */
+	{ 0xc000702f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamominuei64.v   11000IHGGGGGccccc111DDDDD0101111 */
+	{ 0xe000702f, 0xf800707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vamomaxuei64.v   11100IHGGGGGccccc111DDDDD0101111 */
+	{ 0x00005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfadd.vf         000000HGGGGGccccc101DDDDD1010111 */
+	{ 0x08005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfsub.vf         000010HGGGGGccccc101DDDDD1010111 */
+	{ 0x10005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfmin.vf         000100HGGGGGccccc101DDDDD1010111 */
+	{ 0x18005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfmax.vf         000110HGGGGGccccc101DDDDD1010111 */
+	{ 0x20005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfsgnj.vf        001000HGGGGGccccc101DDDDD1010111 */
+	{ 0x24005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfsgnjn.vf       001001HGGGGGccccc101DDDDD1010111 */
+	{ 0x28005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfsgnjx.vf       001010HGGGGGccccc101DDDDD1010111 */
+	{ 0x38005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfslide1up.vf    001110HGGGGGccccc101DDDDD1010111 */
+	{ 0x3c005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfslide1down.vf  001111HGGGGGccccc101DDDDD1010111 */
+	{ 0x60005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmfeq.vf         011000HGGGGGccccc101DDDDD1010111 */
+	{ 0x64005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmfle.vf         011001HGGGGGccccc101DDDDD1010111 */
+	{ 0x6c005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmflt.vf         011011HGGGGGccccc101DDDDD1010111 */
+	{ 0x70005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmfne.vf         011100HGGGGGccccc101DDDDD1010111 */
+	{ 0x74005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmfgt.vf         011101HGGGGGccccc101DDDDD1010111 */
+	{ 0x7c005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmfge.vf         011111HGGGGGccccc101DDDDD1010111 */
+	{ 0x80005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfdiv.vf         100000HGGGGGccccc101DDDDD1010111 */
+	{ 0x84005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfrdiv.vf        100001HGGGGGccccc101DDDDD1010111 */
+	{ 0x90005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfmul.vf         100100HGGGGGccccc101DDDDD1010111 */
+	{ 0x9c005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfrsub.vf        100111HGGGGGccccc101DDDDD1010111 */
+	{ 0xa0005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfmadd.vf        101000HGGGGGccccc101DDDDD1010111 */
+	{ 0xa4005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfnmadd.vf       101001HGGGGGccccc101DDDDD1010111 */
+	{ 0xa8005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfmsub.vf        101010HGGGGGccccc101DDDDD1010111 */
+	{ 0xac005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfnmsub.vf       101011HGGGGGccccc101DDDDD1010111 */
+	{ 0xb0005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfmacc.vf        101100HGGGGGccccc101DDDDD1010111 */
+	{ 0xb4005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfnmacc.vf       101101HGGGGGccccc101DDDDD1010111 */
+	{ 0xb8005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfmsac.vf        101110HGGGGGccccc101DDDDD1010111 */
+	{ 0xbc005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfnmsac.vf       101111HGGGGGccccc101DDDDD1010111 */
+	{ 0xc0005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwadd.vf        110000HGGGGGccccc101DDDDD1010111 */
+	{ 0xc8005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwsub.vf        110010HGGGGGccccc101DDDDD1010111 */
+	{ 0xd0005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwadd.wf        110100HGGGGGccccc101DDDDD1010111 */
+	{ 0xd8005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwsub.wf        110110HGGGGGccccc101DDDDD1010111 */
+	{ 0xe0005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwmul.vf        111000HGGGGGccccc101DDDDD1010111 */
+	{ 0xf0005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfwmacc.vf       111100HGGGGGccccc101DDDDD1010111 */
+	{ 0xf4005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfwnmacc.vf      111101HGGGGGccccc101DDDDD1010111 */
+	{ 0xf8005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfwmsac.vf       111110HGGGGGccccc101DDDDD1010111 */
+	{ 0xfc005057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfwnmsac.vf      111111HGGGGGccccc101DDDDD1010111 */
+	{ 0x00001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfadd.vv         000000HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x04001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfredusum.vs     000001HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x08001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfsub.vv         000010HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x0c001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfredosum.vs     000011HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x10001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfmin.vv         000100HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x14001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfredmin.vs      000101HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x18001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfmax.vv         000110HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x1c001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfredmax.vs      000111HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x20001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfsgnj.vv        001000HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x24001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfsgnjn.vv       001001HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x28001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfsgnjx.vv       001010HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x60001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmfeq.vv         011000HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x64001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmfle.vv         011001HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x6c001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmflt.vv         011011HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x70001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmfne.vv         011100HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x80001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfdiv.vv         100000HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x90001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfmul.vv         100100HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xa0001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfmadd.vv        101000HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xa4001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfnmadd.vv       101001HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xa8001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfmsub.vv        101010HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xac001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfnmsub.vv       101011HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xb0001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfmacc.vv        101100HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xb4001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfnmacc.vv       101101HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xb8001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfmsac.vv        101110HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xbc001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfnmsac.vv       101111HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xc0001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwadd.vv        110000HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xc4001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwredusum.vs    110001HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xc8001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwsub.vv        110010HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xcc001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwredosum.vs    110011HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xd0001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwadd.wv        110100HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xd8001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwsub.wv        110110HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xe0001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwmul.vv        111000HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xf0001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfwmacc.vv       111100HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xf4001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfwnmacc.vv      111101HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xf8001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfwmsac.vv       111110HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xfc001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vfwnmsac.vv      111111HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x00004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vadd.vx          000000HGGGGGccccc100DDDDD1010111 */
+	{ 0x08004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsub.vx          000010HGGGGGccccc100DDDDD1010111 */
+	{ 0x0c004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vrsub.vx         000011HGGGGGccccc100DDDDD1010111 */
+	{ 0x10004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vminu.vx         000100HGGGGGccccc100DDDDD1010111 */
+	{ 0x14004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmin.vx          000101HGGGGGccccc100DDDDD1010111 */
+	{ 0x18004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmaxu.vx         000110HGGGGGccccc100DDDDD1010111 */
+	{ 0x1c004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmax.vx          000111HGGGGGccccc100DDDDD1010111 */
+	{ 0x24004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vand.vx          001001HGGGGGccccc100DDDDD1010111 */
+	{ 0x28004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vor.vx           001010HGGGGGccccc100DDDDD1010111 */
+	{ 0x2c004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vxor.vx          001011HGGGGGccccc100DDDDD1010111 */
+	{ 0x30004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vrgather.vx      001100HGGGGGccccc100DDDDD1010111 */
+	{ 0x38004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vslideup.vx      001110HGGGGGccccc100DDDDD1010111 */
+	{ 0x3c004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vslidedown.vx    001111HGGGGGccccc100DDDDD1010111 */
+	{ 0x60004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmseq.vx         011000HGGGGGccccc100DDDDD1010111 */
+	{ 0x64004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsne.vx         011001HGGGGGccccc100DDDDD1010111 */
+	{ 0x68004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsltu.vx        011010HGGGGGccccc100DDDDD1010111 */
+	{ 0x6c004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmslt.vx         011011HGGGGGccccc100DDDDD1010111 */
+	{ 0x70004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsleu.vx        011100HGGGGGccccc100DDDDD1010111 */
+	{ 0x74004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsle.vx         011101HGGGGGccccc100DDDDD1010111 */
+	{ 0x78004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsgtu.vx        011110HGGGGGccccc100DDDDD1010111 */
+	{ 0x7c004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsgt.vx         011111HGGGGGccccc100DDDDD1010111 */
+	{ 0x80004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsaddu.vx        100000HGGGGGccccc100DDDDD1010111 */
+	{ 0x84004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsadd.vx         100001HGGGGGccccc100DDDDD1010111 */
+	{ 0x88004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vssubu.vx        100010HGGGGGccccc100DDDDD1010111 */
+	{ 0x8c004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vssub.vx         100011HGGGGGccccc100DDDDD1010111 */
+	{ 0x94004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsll.vx          100101HGGGGGccccc100DDDDD1010111 */
+	{ 0x9c004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsmul.vx         100111HGGGGGccccc100DDDDD1010111 */
+	{ 0xa0004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsrl.vx          101000HGGGGGccccc100DDDDD1010111 */
+	{ 0xa4004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsra.vx          101001HGGGGGccccc100DDDDD1010111 */
+	{ 0xa8004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vssrl.vx         101010HGGGGGccccc100DDDDD1010111 */
+	{ 0xac004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vssra.vx         101011HGGGGGccccc100DDDDD1010111 */
+	{ 0xb0004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vnsrl.wx         101100HGGGGGccccc100DDDDD1010111 */
+	{ 0xb4004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vnsra.wx         101101HGGGGGccccc100DDDDD1010111 */
+	{ 0xb8004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vnclipu.wx       101110HGGGGGccccc100DDDDD1010111 */
+	{ 0xbc004057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vnclip.wx        101111HGGGGGccccc100DDDDD1010111 */
+	{ 0x00000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vadd.vv          000000HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x08000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsub.vv          000010HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x10000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vminu.vv         000100HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x14000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmin.vv          000101HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x18000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmaxu.vv         000110HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x1c000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmax.vv          000111HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x24000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vand.vv          001001HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x28000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vor.vv           001010HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x2c000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vxor.vv          001011HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x30000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vrgather.vv      001100HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x38000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vrgatherei16.vv  001110HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x60000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmseq.vv         011000HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x64000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsne.vv         011001HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x68000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsltu.vv        011010HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x6c000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmslt.vv         011011HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x70000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsleu.vv        011100HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x74000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsle.vv         011101HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x80000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsaddu.vv        100000HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x84000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsadd.vv         100001HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x88000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vssubu.vv        100010HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x8c000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vssub.vv         100011HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x94000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsll.vv          100101HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x9c000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsmul.vv         100111HGGGGGFFFFF000DDDDD1010111 */
+	{ 0xa0000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsrl.vv          101000HGGGGGFFFFF000DDDDD1010111 */
+	{ 0xa4000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsra.vv          101001HGGGGGFFFFF000DDDDD1010111 */
+	{ 0xa8000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vssrl.vv         101010HGGGGGFFFFF000DDDDD1010111 */
+	{ 0xac000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vssra.vv         101011HGGGGGFFFFF000DDDDD1010111 */
+	{ 0xb0000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vnsrl.wv         101100HGGGGGFFFFF000DDDDD1010111 */
+	{ 0xb4000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vnsra.wv         101101HGGGGGFFFFF000DDDDD1010111 */
+	{ 0xb8000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vnclipu.wv       101110HGGGGGFFFFF000DDDDD1010111 */
+	{ 0xbc000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vnclip.wv        101111HGGGGGFFFFF000DDDDD1010111 */
+	{ 0xc0000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwredsumu.vs     110000HGGGGGFFFFF000DDDDD1010111 */
+	{ 0xc4000057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwredsum.vs      110001HGGGGGFFFFF000DDDDD1010111 */
+	{ 0x00003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vadd.vi          000000HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x0c003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vrsub.vi         000011HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x24003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vand.vi          001001HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x28003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vor.vi           001010HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x2c003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vxor.vi          001011HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x30003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vrgather.vi      001100HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x38003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vslideup.vi      001110HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x3c003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vslidedown.vi    001111HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x60003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vmseq.vi         011000HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x64003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vmsne.vi         011001HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x70003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vmsleu.vi        011100HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x74003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vmsle.vi         011101HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x78003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vmsgtu.vi        011110HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x7c003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vmsgt.vi         011111HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x80003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vsaddu.vi        100000HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x84003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vsadd.vi         100001HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x94003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vsll.vi          100101HGGGGGLLLLL011DDDDD1010111 */
+	{ 0xa0003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vsrl.vi          101000HGGGGGLLLLL011DDDDD1010111 */
+	{ 0xa4003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vsra.vi          101001HGGGGGLLLLL011DDDDD1010111 */
+	{ 0xa8003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vssrl.vi         101010HGGGGGLLLLL011DDDDD1010111 */
+	{ 0xac003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vssra.vi         101011HGGGGGLLLLL011DDDDD1010111 */
+	{ 0xb0003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vnsrl.wi         101100HGGGGGLLLLL011DDDDD1010111 */
+	{ 0xb4003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vnsra.wi         101101HGGGGGLLLLL011DDDDD1010111 */
+	{ 0xb8003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vnclipu.wi       101110HGGGGGLLLLL011DDDDD1010111 */
+	{ 0xbc003057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vnclip.wi        101111HGGGGGLLLLL011DDDDD1010111 */
+	{ 0x00002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vredsum.vs       000000HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x04002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vredand.vs       000001HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x08002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vredor.vs        000010HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x0c002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vredxor.vs       000011HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x10002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vredminu.vs      000100HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x14002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vredmin.vs       000101HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x18002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vredmaxu.vs      000110HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x1c002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vredmax.vs       000111HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x20002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vaaddu.vv        001000HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x24002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vaadd.vv         001001HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x28002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vasubu.vv        001010HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x2c002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vasub.vv         001011HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x60002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmandn.mm        011000HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x64002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmand.mm         011001HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x68002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmor.mm          011010HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x6c002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmxor.mm         011011HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x70002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmorn.mm         011100HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x74002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmnand.mm        011101HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x78002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmnor.mm         011110HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x7c002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmxnor.mm        011111HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x80002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vdivu.vv         100000HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x84002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vdiv.vv          100001HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x88002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vremu.vv         100010HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x8c002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vrem.vv          100011HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x90002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmulhu.vv        100100HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x94002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmul.vv          100101HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x98002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmulhsu.vv       100110HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x9c002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmulh.vv         100111HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xa4002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vmadd.vv         101001HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xac002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vnmsub.vv        101011HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xb4002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vmacc.vv         101101HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xbc002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vnmsac.vv        101111HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xc0002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwaddu.vv        110000HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xc4002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwadd.vv         110001HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xc8002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwsubu.vv        110010HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xcc002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwsub.vv         110011HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xd0002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwaddu.wv        110100HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xd4002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwadd.wv         110101HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xd8002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwsubu.wv        110110HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xdc002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwsub.wv         110111HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xe0002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwmulu.vv        111000HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xe8002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwmulsu.vv       111010HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xec002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwmul.vv         111011HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xf0002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vwmaccu.vv       111100HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xf4002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vwmacc.vv        111101HGGGGGFFFFF010DDDDD1010111 */
+	{ 0xfc002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vwmaccsu.vv      111111HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x20006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vaaddu.vx        001000HGGGGGccccc110DDDDD1010111 */
+	{ 0x24006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vaadd.vx         001001HGGGGGccccc110DDDDD1010111 */
+	{ 0x28006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vasubu.vx        001010HGGGGGccccc110DDDDD1010111 */
+	{ 0x2c006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vasub.vx         001011HGGGGGccccc110DDDDD1010111 */
+	{ 0x38006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vslide1up.vx     001110HGGGGGccccc110DDDDD1010111 */
+	{ 0x3c006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vslide1down.vx   001111HGGGGGccccc110DDDDD1010111 */
+	{ 0x80006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vdivu.vx         100000HGGGGGccccc110DDDDD1010111 */
+	{ 0x84006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vdiv.vx          100001HGGGGGccccc110DDDDD1010111 */
+	{ 0x88006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vremu.vx         100010HGGGGGccccc110DDDDD1010111 */
+	{ 0x8c006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vrem.vx          100011HGGGGGccccc110DDDDD1010111 */
+	{ 0x90006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmulhu.vx        100100HGGGGGccccc110DDDDD1010111 */
+	{ 0x94006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmul.vx          100101HGGGGGccccc110DDDDD1010111 */
+	{ 0x98006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmulhsu.vx       100110HGGGGGccccc110DDDDD1010111 */
+	{ 0x9c006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmulh.vx         100111HGGGGGccccc110DDDDD1010111 */
+	{ 0xa4006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vmadd.vx         101001HGGGGGccccc110DDDDD1010111 */
+	{ 0xac006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vnmsub.vx        101011HGGGGGccccc110DDDDD1010111 */
+	{ 0xb4006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vmacc.vx         101101HGGGGGccccc110DDDDD1010111 */
+	{ 0xbc006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vnmsac.vx        101111HGGGGGccccc110DDDDD1010111 */
+	{ 0xc0006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwaddu.vx        110000HGGGGGccccc110DDDDD1010111 */
+	{ 0xc4006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwadd.vx         110001HGGGGGccccc110DDDDD1010111 */
+	{ 0xc8006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwsubu.vx        110010HGGGGGccccc110DDDDD1010111 */
+	{ 0xcc006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwsub.vx         110011HGGGGGccccc110DDDDD1010111 */
+	{ 0xd0006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwaddu.wx        110100HGGGGGccccc110DDDDD1010111 */
+	{ 0xd4006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwadd.wx         110101HGGGGGccccc110DDDDD1010111 */
+	{ 0xd8006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwsubu.wx        110110HGGGGGccccc110DDDDD1010111 */
+	{ 0xdc006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwsub.wx         110111HGGGGGccccc110DDDDD1010111 */
+	{ 0xe0006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwmulu.vx        111000HGGGGGccccc110DDDDD1010111 */
+	{ 0xe8006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwmulsu.vx       111010HGGGGGccccc110DDDDD1010111 */
+	{ 0xec006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vwmul.vx         111011HGGGGGccccc110DDDDD1010111 */
+	{ 0xf0006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vwmaccu.vx       111100HGGGGGccccc110DDDDD1010111 */
+	{ 0xf4006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vwmacc.vx        111101HGGGGGccccc110DDDDD1010111 */
+	{ 0xf8006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vwmaccus.vx      111110HGGGGGccccc110DDDDD1010111 */
+	{ 0xfc006057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vwmaccsu.vx      111111HGGGGGccccc110DDDDD1010111 */
+	{ 0x04001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfredsum.vs      000001HGGGGGFFFFF001DDDDD1010111 */
+	{ 0xc4001057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwredsum.vs     110001HGGGGGFFFFF001DDDDD1010111 */
+	{ 0x70002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmornot.mm       011100HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x60002057, 0xfc00707f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmandnot.mm      011000HGGGGGFFFFF010DDDDD1010111 */
+	{ 0x48001057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfcvt.xu.f.v     010010HGGGGG00000001DDDDD1010111 */
+	{ 0x48009057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfcvt.x.f.v      010010HGGGGG00001001DDDDD1010111 */
+	{ 0x48011057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfcvt.f.xu.v     010010HGGGGG00010001DDDDD1010111 */
+	{ 0x48019057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfcvt.f.x.v      010010HGGGGG00011001DDDDD1010111 */
+	{ 0x48031057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfcvt.rtz.xu.f.v 010010HGGGGG00110001DDDDD1010111 */
+	{ 0x48039057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfcvt.rtz.x.f.v  010010HGGGGG00111001DDDDD1010111 */
+	{ 0x48041057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwcvt.xu.f.v    010010HGGGGG01000001DDDDD1010111 */
+	{ 0x48049057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwcvt.x.f.v     010010HGGGGG01001001DDDDD1010111 */
+	{ 0x48051057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwcvt.f.xu.v    010010HGGGGG01010001DDDDD1010111 */
+	{ 0x48059057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwcvt.f.x.v     010010HGGGGG01011001DDDDD1010111 */
+	{ 0x48061057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwcvt.f.f.v     010010HGGGGG01100001DDDDD1010111 */
+	{ 0x48071057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwcvt.rtz.xu.f.v 010010HGGGGG01110001DDDDD1010111 */
+	{ 0x48079057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfwcvt.rtz.x.f.v 010010HGGGGG01111001DDDDD1010111 */
+	{ 0x48081057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfncvt.xu.f.w    010010HGGGGG10000001DDDDD1010111 */
+	{ 0x48089057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfncvt.x.f.w     010010HGGGGG10001001DDDDD1010111 */
+	{ 0x48091057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfncvt.f.xu.w    010010HGGGGG10010001DDDDD1010111 */
+	{ 0x48099057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfncvt.f.x.w     010010HGGGGG10011001DDDDD1010111 */
+	{ 0x480a1057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfncvt.f.f.w     010010HGGGGG10100001DDDDD1010111 */
+	{ 0x480a9057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfncvt.rod.f.f.w 010010HGGGGG10101001DDDDD1010111 */
+	{ 0x480b1057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfncvt.rtz.xu.f.w 010010HGGGGG10110001DDDDD1010111 */
+	{ 0x480b9057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfncvt.rtz.x.f.w 010010HGGGGG10111001DDDDD1010111 */
+	{ 0x4c001057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfsqrt.v         010011HGGGGG00000001DDDDD1010111 */
+	{ 0x4c021057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfrsqrt7.v       010011HGGGGG00100001DDDDD1010111 */
+	{ 0x4c029057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfrec7.v         010011HGGGGG00101001DDDDD1010111 */
+	{ 0x4c081057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfclass.v        010011HGGGGG10000001DDDDD1010111 */
+	{ 0x48012057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vzext.vf8        010010HGGGGG00010010DDDDD1010111 */
+	{ 0x4801a057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsext.vf8        010010HGGGGG00011010DDDDD1010111 */
+	{ 0x48022057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vzext.vf4        010010HGGGGG00100010DDDDD1010111 */
+	{ 0x4802a057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsext.vf4        010010HGGGGG00101010DDDDD1010111 */
+	{ 0x48032057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vzext.vf2        010010HGGGGG00110010DDDDD1010111 */
+	{ 0x4803a057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsext.vf2        010010HGGGGG00111010DDDDD1010111 */
+	{ 0x5000a057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsbf.m          010100HGGGGG00001010DDDDD1010111 */
+	{ 0x50012057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsof.m          010100HGGGGG00010010DDDDD1010111 */
+	{ 0x5001a057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsif.m          010100HGGGGG00011010DDDDD1010111 */
+	{ 0x50082057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* viota.m          010100HGGGGG10000010DDDDD1010111 */
+	{ 0x40082057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* vcpop.m          010000HGGGGG10000010aaaaa1010111 */
+	{ 0x4008a057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* vfirst.m         010000HGGGGG10001010aaaaa1010111 */
+	{ 0x40082057, 0xfc0ff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* vpopc.m          010000HGGGGG10000010aaaaa1010111 */
+	{ 0x5008a057, 0xfdfff07f, RISCV_REGS_VEC_VM | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vid.v            010100H0000010001010DDDDD1010111 */
+	{ 0x80007057, 0xfe00707f, RISCV_REGS_GPR_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* vsetvl           1000000dddddccccc111aaaaa1010111 */
+	{ 0x5c005057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfmerge.vfm      0101110GGGGGccccc101DDDDD1010111 */
+	{ 0x40004057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vadc.vxm         0100000GGGGGccccc100DDDDD1010111 */
+	{ 0x44004057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmadc.vxm        0100010GGGGGccccc100DDDDD1010111 */
+	{ 0x46004057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmadc.vx         0100011GGGGGccccc100DDDDD1010111 */
+	{ 0x48004057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsbc.vxm         0100100GGGGGccccc100DDDDD1010111 */
+	{ 0x4c004057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsbc.vxm        0100110GGGGGccccc100DDDDD1010111 */
+	{ 0x4e004057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsbc.vx         0100111GGGGGccccc100DDDDD1010111 */
+	{ 0x5c004057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmerge.vxm       0101110GGGGGccccc100DDDDD1010111 */
+	{ 0x40000057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vadc.vvm         0100000GGGGGFFFFF000DDDDD1010111 */
+	{ 0x44000057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmadc.vvm        0100010GGGGGFFFFF000DDDDD1010111 */
+	{ 0x46000057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmadc.vv         0100011GGGGGFFFFF000DDDDD1010111 */
+	{ 0x48000057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vsbc.vvm         0100100GGGGGFFFFF000DDDDD1010111 */
+	{ 0x4c000057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsbc.vvm        0100110GGGGGFFFFF000DDDDD1010111 */
+	{ 0x4e000057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmsbc.vv         0100111GGGGGFFFFF000DDDDD1010111 */
+	{ 0x5c000057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmerge.vvm       0101110GGGGGFFFFF000DDDDD1010111 */
+	{ 0x40003057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vadc.vim         0100000GGGGGLLLLL011DDDDD1010111 */
+	{ 0x44003057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vmadc.vim        0100010GGGGGLLLLL011DDDDD1010111 */
+	{ 0x46003057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vmadc.vi         0100011GGGGGLLLLL011DDDDD1010111 */
+	{ 0x5c003057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vmerge.vim       0101110GGGGGLLLLL011DDDDD1010111 */
+	{ 0x5e002057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vcompress.vm     0101111GGGGGFFFFF010DDDDD1010111 */
+	{ 0x9e003057, 0xfe00707f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vmvnfr.v         1001111GGGGGLLLLL011DDDDD1010111 */
+	{ 0x42001057, 0xfe0ff07f, RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* vfmv.f.s         0100001GGGGG00000001aaaaa1010111 */
+	{ 0x9e003057, 0xfe0ff07f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmv1r.v          1001111GGGGG00000011DDDDD1010111 */
+	{ 0x9e00b057, 0xfe0ff07f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmv2r.v          1001111GGGGG00001011DDDDD1010111 */
+	{ 0x9e01b057, 0xfe0ff07f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmv4r.v          1001111GGGGG00011011DDDDD1010111 */
+	{ 0x9e03b057, 0xfe0ff07f, RISCV_REGS_VEC_RS2 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmv8r.v          1001111GGGGG00111011DDDDD1010111 */
+	{ 0x42002057, 0xfe0ff07f, RISCV_REGS_VEC_RS2 | RISCV_REGS_GPR_RD, RISCV_IMM_NONE }, /* vmv.x.s          0100001GGGGG00000010aaaaa1010111 */
+	{ 0x02b00007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vlm.v            000000101011ccccc000DDDDD0000111 */
+	{ 0x02b00027, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vsm.v            000000101011ccccc000EEEEE0100111 */
+	{ 0x02800007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl1re8.v         000000101000ccccc000DDDDD0000111 */
+	{ 0x02805007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl1re16.v        000000101000ccccc101DDDDD0000111 */
+	{ 0x02806007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl1re32.v        000000101000ccccc110DDDDD0000111 */
+	{ 0x02807007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl1re64.v        000000101000ccccc111DDDDD0000111 */
+	{ 0x22800007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl2re8.v         001000101000ccccc000DDDDD0000111 */
+	{ 0x22805007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl2re16.v        001000101000ccccc101DDDDD0000111 */
+	{ 0x22806007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl2re32.v        001000101000ccccc110DDDDD0000111 */
+	{ 0x22807007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl2re64.v        001000101000ccccc111DDDDD0000111 */
+	{ 0x62800007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl4re8.v         011000101000ccccc000DDDDD0000111 */
+	{ 0x62805007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl4re16.v        011000101000ccccc101DDDDD0000111 */
+	{ 0x62806007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl4re32.v        011000101000ccccc110DDDDD0000111 */
+	{ 0x62807007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl4re64.v        011000101000ccccc111DDDDD0000111 */
+	{ 0xe2800007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl8re8.v         111000101000ccccc000DDDDD0000111 */
+	{ 0xe2805007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl8re16.v        111000101000ccccc101DDDDD0000111 */
+	{ 0xe2806007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl8re32.v        111000101000ccccc110DDDDD0000111 */
+	{ 0xe2807007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl8re64.v        111000101000ccccc111DDDDD0000111 */
+	{ 0x02800027, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vs1r.v           000000101000ccccc000EEEEE0100111 */
+	{ 0x22800027, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vs2r.v           001000101000ccccc000EEEEE0100111 */
+	{ 0x62800027, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vs4r.v           011000101000ccccc000EEEEE0100111 */
+	{ 0xe2800027, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vs8r.v           111000101000ccccc000EEEEE0100111 */
+	{ 0x42005057, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfmv.s.f         010000100000ccccc101DDDDD1010111 */
+	{ 0x5e005057, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vfmv.v.f         010111100000ccccc101DDDDD1010111 */
+	{ 0x5e004057, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmv.v.x          010111100000ccccc100DDDDD1010111 */
+	{ 0x5e000057, 0xfff0707f, RISCV_REGS_VEC_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmv.v.v          010111100000FFFFF000DDDDD1010111 */
+	{ 0x5e003057, 0xfff0707f, RISCV_REGS_VEC_RD, RISCV_IMM_SIMM5 }, /* vmv.v.i          010111100000LLLLL011DDDDD1010111 */
+	{ 0x42006057, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vmv.s.x          010000100000ccccc110DDDDD1010111 */
+	{ 0x02800007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl1r.v           000000101000ccccc000DDDDD0000111 */
+	{ 0x06805007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl2r.v           000001101000ccccc101DDDDD0000111 */
+	{ 0x0e806007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl4r.v           000011101000ccccc110DDDDD0000111 */
+	{ 0x1e807007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vl8r.v           000111101000ccccc111DDDDD0000111 */
+	{ 0x02b00007, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD, RISCV_IMM_NONE }, /* vle1.v           000000101011ccccc000DDDDD0000111 */
+	{ 0x02b00027, 0xfff0707f, RISCV_REGS_GPR_RS1 | RISCV_REGS_VEC_RD_USE, RISCV_IMM_NONE }, /* vse1.v           000000101011ccccc000EEEEE0100111 */
+	{ 0x26000033, 0x3e00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_BS }, /* aes32esmi        vv10011dddddccccc000aaaaa0110011 */
+	{ 0x22000033, 0x3e00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_BS }, /* aes32esi         vv10001dddddccccc000aaaaa0110011 */
+	{ 0x2e000033, 0x3e00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_BS }, /* aes32dsmi        vv10111dddddccccc000aaaaa0110011 */
+	{ 0x2a000033, 0x3e00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_BS }, /* aes32dsi         vv10101dddddccccc000aaaaa0110011 */
+	{ 0x50000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sha512sum0r      0101000dddddccccc000aaaaa0110011 */
+	{ 0x52000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sha512sum1r      0101001dddddccccc000aaaaa0110011 */
+	{ 0x54000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sha512sig0l      0101010dddddccccc000aaaaa0110011 */
+	{ 0x5c000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sha512sig0h      0101110dddddccccc000aaaaa0110011 */
+	{ 0x56000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sha512sig1l      0101011dddddccccc000aaaaa0110011 */
+	{ 0x5e000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sha512sig1h      0101111dddddccccc000aaaaa0110011 */
+	{ 0x30000033, 0x3e00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_BS }, /* sm4ed            vv11000dddddccccc000aaaaa0110011 */
+	{ 0x34000033, 0x3e00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_BS }, /* sm4ks            vv11010dddddccccc000aaaaa0110011 */
+	{ 0x10801013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* sm3p0            000100001000ccccc001aaaaa0010011 */
+	{ 0x10901013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* sm3p1            000100001001ccccc001aaaaa0010011 */
+	{ 0x10001013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* sha256sum0       000100000000ccccc001aaaaa0010011 */
+	{ 0x10101013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* sha256sum1       000100000001ccccc001aaaaa0010011 */
+	{ 0x10201013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* sha256sig0       000100000010ccccc001aaaaa0010011 */
+	{ 0x10301013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* sha256sig1       000100000011ccccc001aaaaa0010011 */
+	{ 0x0000202f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amoadd.w         00000ffdddddccccc010aaaaa0101111 */
+	{ 0x2000202f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amoxor.w         00100ffdddddccccc010aaaaa0101111 */
+	{ 0x4000202f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amoor.w          01000ffdddddccccc010aaaaa0101111 */
+	{ 0x6000202f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amoand.w         01100ffdddddccccc010aaaaa0101111 */
+	{ 0x8000202f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amomin.w         10000ffdddddccccc010aaaaa0101111 */
+	{ 0xa000202f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amomax.w         10100ffdddddccccc010aaaaa0101111 */
+	{ 0xc000202f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amominu.w        11000ffdddddccccc010aaaaa0101111 */
+	{ 0xe000202f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amomaxu.w        11100ffdddddccccc010aaaaa0101111 */
+	{ 0x0800202f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amoswap.w        00001ffdddddccccc010aaaaa0101111 */
+	{ 0x1800202f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sc.w             00011ffdddddccccc010aaaaa0101111 */
+	{ 0x1000202f, 0xf9f0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* lr.w             00010ff00000ccccc010aaaaa0101111 */
+	{ 0x0000302f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amoadd.d         00000ffdddddccccc011aaaaa0101111 */
+	{ 0x2000302f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amoxor.d         00100ffdddddccccc011aaaaa0101111 */
+	{ 0x4000302f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amoor.d          01000ffdddddccccc011aaaaa0101111 */
+	{ 0x6000302f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amoand.d         01100ffdddddccccc011aaaaa0101111 */
+	{ 0x8000302f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amomin.d         10000ffdddddccccc011aaaaa0101111 */
+	{ 0xa000302f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amomax.d         10100ffdddddccccc011aaaaa0101111 */
+	{ 0xc000302f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amominu.d        11000ffdddddccccc011aaaaa0101111 */
+	{ 0xe000302f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amomaxu.d        11100ffdddddccccc011aaaaa0101111 */
+	{ 0x0800302f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* amoswap.d        00001ffdddddccccc011aaaaa0101111 */
+	{ 0x1800302f, 0xf800707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sc.d             00011ffdddddccccc011aaaaa0101111 */
+	{ 0x1000302f, 0xf9f0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* lr.d             00010ff00000ccccc011aaaaa0101111 */
+	{ 0x02000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* mul              0000001dddddccccc000aaaaa0110011 */
+	{ 0x02001033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* mulh             0000001dddddccccc001aaaaa0110011 */
+	{ 0x02002033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* mulhsu           0000001dddddccccc010aaaaa0110011 */
+	{ 0x02003033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* mulhu            0000001dddddccccc011aaaaa0110011 */
+	{ 0x02004033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* div              0000001dddddccccc100aaaaa0110011 */
+	{ 0x02005033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* divu             0000001dddddccccc101aaaaa0110011 */
+	{ 0x02006033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* rem              0000001dddddccccc110aaaaa0110011 */
+	{ 0x02007033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* remu             0000001dddddccccc111aaaaa0110011 */
+	{ 0x7e000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* aes64ks2         0111111dddddccccc000aaaaa0110011 */
+	{ 0x36000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* aes64esm         0011011dddddccccc000aaaaa0110011 */
+	{ 0x32000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* aes64es          0011001dddddccccc000aaaaa0110011 */
+	{ 0x3e000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* aes64dsm         0011111dddddccccc000aaaaa0110011 */
+	{ 0x3a000033, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* aes64ds          0011101dddddccccc000aaaaa0110011 */
+	{ 0x31001013, 0xff00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_UIMM4 }, /* aes64ks1i        00110001wwwwccccc001aaaaa0010011 */
+	{ 0x30001013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* aes64im          001100000000ccccc001aaaaa0010011 */
+	{ 0x10401013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* sha512sum0       000100000100ccccc001aaaaa0010011 */
+	{ 0x10501013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* sha512sum1       000100000101ccccc001aaaaa0010011 */
+	{ 0x10601013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* sha512sig0       000100000110ccccc001aaaaa0010011 */
+	{ 0x10701013, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* sha512sig1       000100000111ccccc001aaaaa0010011 */
+	{ 0x0200003b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* mulw             0000001dddddccccc000aaaaa0111011 */
+	{ 0x0200403b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* divw             0000001dddddccccc100aaaaa0111011 */
+	{ 0x0200503b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* divuw            0000001dddddccccc101aaaaa0111011 */
+	{ 0x0200603b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* remw             0000001dddddccccc110aaaaa0111011 */
+	{ 0x0200703b, 0xfe00707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* remuw            0000001dddddccccc111aaaaa0111011 */
+	{ 0x22000073, 0xfe007fff, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* hfence.vvma      0010001dddddccccc000000001110011 */
+	{ 0x62000073, 0xfe007fff, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* hfence.gvma      0110001dddddccccc000000001110011 */
+	{ 0x62004073, 0xfe007fff, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* hsv.b            0110001dddddccccc100000001110011 */
+	{ 0x66004073, 0xfe007fff, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* hsv.h            0110011dddddccccc100000001110011 */
+	{ 0x6a004073, 0xfe007fff, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* hsv.w            0110101dddddccccc100000001110011 */
+	{ 0x60004073, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* hlv.b            011000000000ccccc100aaaaa1110011 */
+	{ 0x60104073, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* hlv.bu           011000000001ccccc100aaaaa1110011 */
+	{ 0x64004073, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* hlv.h            011001000000ccccc100aaaaa1110011 */
+	{ 0x64104073, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* hlv.hu           011001000001ccccc100aaaaa1110011 */
+	{ 0x64304073, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* hlvx.hu          011001000011ccccc100aaaaa1110011 */
+	{ 0x68004073, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* hlv.w            011010000000ccccc100aaaaa1110011 */
+	{ 0x68304073, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* hlvx.wu          011010000011ccccc100aaaaa1110011 */
+	{ 0x6e004073, 0xfe007fff, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* hsv.d            0110111dddddccccc100000001110011 */
+	{ 0x68104073, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* hlv.wu           011010000001ccccc100aaaaa1110011 */
+	{ 0x6c004073, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* hlv.d            011011000000ccccc100aaaaa1110011 */
+	{ 0x16000073, 0xfe007fff, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* sinval.vma       0001011dddddccccc000000001110011 */
+	{ 0x26000073, 0xfe007fff, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* hinval.vvma      0010011dddddccccc000000001110011 */
+	{ 0x66000073, 0xfe007fff, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, RISCV_IMM_NONE }, /* hinval.gvma      0110011dddddccccc000000001110011 */
+	{ 0x18000073, 0xffffffff, 0, RISCV_IMM_NONE }, /* sfence.w.inval   00011000000000000000000001110011 */
+	{ 0x18100073, 0xffffffff, 0, RISCV_IMM_NONE }, /* sfence.inval.ir  00011000000100000000000001110011 */
+	{ 0x44100053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.h.d         010001000001cccccjjjaaaaa1010011 */
+	{ 0x42200053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.d.h         010000100010cccccjjjaaaaa1010011 */
+	{ 0x44300053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.h.q         010001000011cccccjjjaaaaa1010011 */
+	{ 0x46200053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.q.h         010001100010cccccjjjaaaaa1010011 */
+	{ 0xc2200053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.l.d         110000100010cccccjjjaaaaa1010011 */
+	{ 0xc2300053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.lu.d        110000100011cccccjjjaaaaa1010011 */
+	{ 0xd2200053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.d.l         110100100010cccccjjjaaaaa1010011 */
+	{ 0xd2300053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.d.lu        110100100011cccccjjjaaaaa1010011 */
+	{ 0xe2000053, 0xfff0707f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fmv.x.d          111000100000ccccc000aaaaa1010011 */
+	{ 0xf2000053, 0xfff0707f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fmv.d.x          111100100000ccccc000aaaaa1010011 */
+	{ 0xc0200053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.l.s         110000000010cccccjjjaaaaa1010011 */
+	{ 0xc0300053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.lu.s        110000000011cccccjjjaaaaa1010011 */
+	{ 0xd0200053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.s.l         110100000010cccccjjjaaaaa1010011 */
+	{ 0xd0300053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.s.lu        110100000011cccccjjjaaaaa1010011 */
+	{ 0xc6200053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.l.q         110001100010cccccjjjaaaaa1010011 */
+	{ 0xc6300053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.lu.q        110001100011cccccjjjaaaaa1010011 */
+	{ 0xd6200053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.q.l         110101100010cccccjjjaaaaa1010011 */
+	{ 0xd6300053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.q.lu        110101100011cccccjjjaaaaa1010011 */
+	{ 0xc4200053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.l.h         110001000010cccccjjjaaaaa1010011 */
+	{ 0xc4300053, 0xfff0007f, RISCV_REGS_GPR_RD | RISCV_REGS_FPR_RS1, RISCV_IMM_NONE }, /* fcvt.lu.h        110001000011cccccjjjaaaaa1010011 */
+	{ 0xd4200053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.h.l         110101000010cccccjjjaaaaa1010011 */
+	{ 0xd4300053, 0xfff0007f, RISCV_REGS_FPR_RD | RISCV_REGS_GPR_RS1, RISCV_IMM_NONE }, /* fcvt.h.lu        110101000011cccccjjjaaaaa1010011 */
+};
 
-static ut32 riscv_rvv_KKK111HGGGGGccccc101DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
+/* the tables of each standard are defined by riscv_decode_<standard>.c */
+static const RISCVStandard standards[] = {
+	{ RISCV_INS_JAL, 36, riscv_rv32i_names, riscv_rv32i_descriptions, riscv_rv32i_analysis },
+	{ RISCV_INS_FLD, 26, riscv_rv32d_names, riscv_rv32d_descriptions, riscv_rv32d_analysis },
+	{ RISCV_INS_FLW, 26, riscv_rv32f_names, riscv_rv32f_descriptions, riscv_rv32f_analysis },
+	{ RISCV_INS_FLQ, 28, riscv_rv32q_names, riscv_rv32q_descriptions, riscv_rv32q_analysis },
+	{ RISCV_INS_FLH, 28, riscv_rv32zfh_names, riscv_rv32zfh_descriptions, riscv_rv32zfh_analysis },
+	{ RISCV_INS_ADDIW, 15, riscv_rv64i_names, riscv_rv64i_descriptions, riscv_rv64i_analysis },
+	{ RISCV_INS_CSRRW, 13, riscv_system_names, riscv_system_descriptions, riscv_system_analysis },
+	{ RISCV_INS_PREFETCH_I, 7, riscv_zicbo_names, riscv_zicbo_descriptions, riscv_zicbo_analysis },
+	{ RISCV_INS_FSRI, 61, riscv_rv32b_names, riscv_rv32b_descriptions, riscv_rv32b_analysis },
+	{ RISCV_INS_FSLW, 35, riscv_rv64b_names, riscv_rv64b_descriptions, riscv_rv64b_analysis },
+	{ RISCV_INS_BPICK, 326, riscv_rvp_names, riscv_rvp_descriptions, riscv_rvp_analysis },
+	{ RISCV_INS_VLUXEI8_V, 459, riscv_rvv_names, riscv_rvv_descriptions, riscv_rvv_analysis },
+	{ RISCV_INS_AES32ESMI, 10, riscv_rv32k_names, riscv_rv32k_descriptions, riscv_rv32k_analysis },
+	{ RISCV_INS_SM4ED, 8, riscv_rvk_names, riscv_rvk_descriptions, riscv_rvk_analysis },
+	{ RISCV_INS_AMOADD_W, 11, riscv_rv32a_names, riscv_rv32a_descriptions, riscv_rv32a_analysis },
+	{ RISCV_INS_AMOADD_D, 11, riscv_rv64a_names, riscv_rv64a_descriptions, riscv_rv64a_analysis },
+	{ RISCV_INS_MUL, 8, riscv_rv32m_names, riscv_rv32m_descriptions, riscv_rv32m_analysis },
+	{ RISCV_INS_AES64KS2, 11, riscv_rv64k_names, riscv_rv64k_descriptions, riscv_rv64k_analysis },
+	{ RISCV_INS_MULW, 5, riscv_rv64m_names, riscv_rv64m_descriptions, riscv_rv64m_analysis },
+	{ RISCV_INS_HFENCE_VVMA, 12, riscv_rv32h_names, riscv_rv32h_descriptions, riscv_rv32h_analysis },
+	{ RISCV_INS_HSV_D, 3, riscv_rv64h_names, riscv_rv64h_descriptions, riscv_rv64h_analysis },
+	{ RISCV_INS_SINVAL_VMA, 5, riscv_svinval_names, riscv_svinval_descriptions, riscv_svinval_analysis },
+	{ RISCV_INS_FCVT_H_D, 2, riscv_rv32d_zfh_names, riscv_rv32d_zfh_descriptions, riscv_rv32d_zfh_analysis },
+	{ RISCV_INS_FCVT_H_Q, 2, riscv_rv32q_zfh_names, riscv_rv32q_zfh_descriptions, riscv_rv32q_zfh_analysis },
+	{ RISCV_INS_FCVT_L_D, 6, riscv_rv64d_names, riscv_rv64d_descriptions, riscv_rv64d_analysis },
+	{ RISCV_INS_FCVT_L_S, 4, riscv_rv64f_names, riscv_rv64f_descriptions, riscv_rv64f_analysis },
+	{ RISCV_INS_FCVT_L_Q, 4, riscv_rv64q_names, riscv_rv64q_descriptions, riscv_rv64q_analysis },
+	{ RISCV_INS_FCVT_L_H, 4, riscv_rv64zfh_names, riscv_rv64zfh_descriptions, riscv_rv64zfh_analysis },
+};
 
-static ut32 riscv_rvv_KKK111HGGGGGccccc101EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
+/* index in standards[] of each instruction */
+static const ut8 instruction_standards[RISCV_INS_COUNT] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 6,
+	6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+	9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+	10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	11, 11, 11, 11, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+	14, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 18,
+	18, 18, 18, 18, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 20, 20, 20, 21, 21, 21, 21, 21, 22, 22, 23, 23, 24, 24, 24, 24,
+	24, 24, 25, 25, 25, 25, 26, 26, 26, 26, 27, 27, 27, 27,
+};
 
-static ut32 riscv_rvv_KKK111HGGGGGccccc110DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
+static const RISCVStandard *riscv_standard(RISCVInsId id) {
+	return &standards[instruction_standards[id]];
+}
+
+static const RISCVAnalysis *riscv_analysis(RISCVInsId id) {
+	const RISCVStandard *standard = riscv_standard(id);
+	return &standard->analysis[id - standard->first];
+}
+
+/* sorted by RISCVInsId, the first matching alias of an instruction is used */
+static const RISCVAlias aliases[] = {
+	{ RISCV_INS_JAL, false, 0x00000f80, 0x00000000, 0, 13 }, /* j */
+	{ RISCV_INS_JAL, false, 0x00000f80, 0x00000080, 2, 13 }, /* jal */
+	{ RISCV_INS_BEQ, false, 0x01f00000, 0x00000000, 6, 11 }, /* beqz */
+	{ RISCV_INS_BNE, false, 0x01f00000, 0x00000000, 11, 11 }, /* bnez */
+	{ RISCV_INS_BLT, false, 0x01f00000, 0x00000000, 16, 11 }, /* bltz */
+	{ RISCV_INS_BLT, false, 0x000f8000, 0x00000000, 21, 12 }, /* bgtz */
+	{ RISCV_INS_BGE, false, 0x000f8000, 0x00000000, 26, 12 }, /* blez */
+	{ RISCV_INS_BGE, false, 0x01f00000, 0x00000000, 31, 11 }, /* bgez */
+	{ RISCV_INS_JALR, false, 0xffff8f80, 0x00008000, 36, 3 }, /* ret */
+	{ RISCV_INS_JALR, false, 0xfff00f80, 0x00000000, 40, 10 }, /* jr */
+	{ RISCV_INS_JALR, false, 0xfff00f80, 0x00000080, 43, 10 }, /* jalr */
+	{ RISCV_INS_ADDI, false, 0xffff8f80, 0x00000000, 48, 3 }, /* nop */
+	{ RISCV_INS_ADDI, false, 0x000f8000, 0x00000000, 52, 6 }, /* li */
+	{ RISCV_INS_ADDI, false, 0xfff00000, 0x00000000, 55, 7 }, /* mv */
+	{ RISCV_INS_SLTIU, false, 0xfff00000, 0x00100000, 58, 7 }, /* seqz */
+	{ RISCV_INS_XORI, false, 0xfff00000, 0xfff00000, 63, 7 }, /* not */
+	{ RISCV_INS_FENCE, false, 0xfff00000, 0x83300000, 67, 3 }, /* fence.tso */
+	{ RISCV_INS_FENCE, false, 0xffff8f80, 0x01000000, 77, 3 }, /* pause */
+	{ RISCV_INS_SUB, false, 0x000f8000, 0x00000000, 83, 8 }, /* neg */
+	{ RISCV_INS_SLT, false, 0x01f00000, 0x00000000, 87, 7 }, /* sltz */
+	{ RISCV_INS_SLT, false, 0x000f8000, 0x00000000, 92, 8 }, /* sgtz */
+	{ RISCV_INS_SLTU, false, 0x000f8000, 0x00000000, 97, 8 }, /* snez */
+	{ RISCV_INS_FSGNJ_D, true, 0x00000000, 0x00000000, 102, 2 }, /* fmv.d */
+	{ RISCV_INS_FSGNJN_D, true, 0x00000000, 0x00000000, 108, 2 }, /* fneg.d */
+	{ RISCV_INS_FSGNJX_D, true, 0x00000000, 0x00000000, 115, 2 }, /* fabs.d */
+	{ RISCV_INS_FSGNJ_S, true, 0x00000000, 0x00000000, 122, 2 }, /* fmv.s */
+	{ RISCV_INS_FSGNJN_S, true, 0x00000000, 0x00000000, 128, 2 }, /* fneg.s */
+	{ RISCV_INS_FSGNJX_S, true, 0x00000000, 0x00000000, 135, 2 }, /* fabs.s */
+	{ RISCV_INS_ADDIW, false, 0xfff00000, 0x00000000, 142, 7 }, /* sext.w */
+	{ RISCV_INS_SUBW, false, 0x000f8000, 0x00000000, 149, 8 }, /* negw */
+	{ RISCV_INS_CSRRW, false, 0xfff00f80, 0x00100000, 154, 10 }, /* fsflags */
+	{ RISCV_INS_CSRRW, false, 0xfff00000, 0x00100000, 162, 7 }, /* fsflags */
+	{ RISCV_INS_CSRRW, false, 0xfff00f80, 0x00200000, 170, 10 }, /* fsrm */
+	{ RISCV_INS_CSRRW, false, 0xfff00000, 0x00200000, 175, 7 }, /* fsrm */
+	{ RISCV_INS_CSRRW, false, 0xfff00f80, 0x00300000, 180, 10 }, /* fscsr */
+	{ RISCV_INS_CSRRW, false, 0xfff00000, 0x00300000, 186, 7 }, /* fscsr */
+	{ RISCV_INS_CSRRW, false, 0x00000f80, 0x00000000, 192, 0 }, /* csrw */
+	{ RISCV_INS_CSRRS, false, 0xffff8000, 0xc0000000, 197, 4 }, /* rdcycle */
+	{ RISCV_INS_CSRRS, false, 0xffff8000, 0xc0100000, 205, 4 }, /* rdtime */
+	{ RISCV_INS_CSRRS, false, 0xffff8000, 0xc0200000, 212, 4 }, /* rdinstret */
+	{ RISCV_INS_CSRRS, false, 0xffff8000, 0xc8000000, 222, 4 }, /* rdcycleh */
+	{ RISCV_INS_CSRRS, false, 0xffff8000, 0xc8100000, 231, 4 }, /* rdtimeh */
+	{ RISCV_INS_CSRRS, false, 0xffff8000, 0xc8200000, 239, 4 }, /* rdinstreth */
+	{ RISCV_INS_CSRRS, false, 0xffff8000, 0x00100000, 250, 4 }, /* frflags */
+	{ RISCV_INS_CSRRS, false, 0xffff8000, 0x00200000, 258, 4 }, /* frrm */
+	{ RISCV_INS_CSRRS, false, 0xffff8000, 0x00300000, 263, 4 }, /* frcsr */
+	{ RISCV_INS_CSRRS, false, 0x000f8000, 0x00000000, 269, 5 }, /* csrr */
+	{ RISCV_INS_CSRRS, false, 0x00000f80, 0x00000000, 274, 0 }, /* csrs */
+	{ RISCV_INS_CSRRC, false, 0x00000f80, 0x00000000, 279, 0 }, /* csrc */
+	{ RISCV_INS_CSRRWI, false, 0xfff00f80, 0x00100000, 284, 14 }, /* fsflagsi */
+	{ RISCV_INS_CSRRWI, false, 0xfff00000, 0x00100000, 293, 9 }, /* fsflagsi */
+	{ RISCV_INS_CSRRWI, false, 0xfff00f80, 0x00200000, 302, 14 }, /* fsrmi */
+	{ RISCV_INS_CSRRWI, false, 0xfff00000, 0x00200000, 308, 9 }, /* fsrmi */
+	{ RISCV_INS_CSRRWI, false, 0x00000f80, 0x00000000, 314, 1 }, /* csrwi */
+	{ RISCV_INS_CSRRSI, false, 0x00000f80, 0x00000000, 320, 1 }, /* csrsi */
+	{ RISCV_INS_CSRRCI, false, 0x00000f80, 0x00000000, 326, 1 }, /* csrci */
+};
 
-static ut32 riscv_rvv_KKK111HGGGGGccccc110EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
+/* register groups of the vector instructions, sorted by RISCVInsId */
+static const RISCVVectorShape vector_shapes[] = {
+	{ RISCV_INS_VLUXEI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, RISCV_VSHAPE_SEGMENT }, /* vluxei8.v */
+	{ RISCV_INS_VLUXEI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, RISCV_VSHAPE_SEGMENT }, /* vluxei16.v */
+	{ RISCV_INS_VLUXEI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, RISCV_VSHAPE_SEGMENT }, /* vluxei32.v */
+	{ RISCV_INS_VLUXEI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, RISCV_VSHAPE_SEGMENT }, /* vluxei64.v */
+	{ RISCV_INS_VLUXEI128_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 128, 0, RISCV_VSHAPE_SEGMENT }, /* vluxei128.v */
+	{ RISCV_INS_VLUXEI256_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 256, 0, RISCV_VSHAPE_SEGMENT }, /* vluxei256.v */
+	{ RISCV_INS_VLUXEI512_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 512, 0, RISCV_VSHAPE_SEGMENT }, /* vluxei512.v */
+	{ RISCV_INS_VLUXEI1024_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 1024, 0, RISCV_VSHAPE_SEGMENT }, /* vluxei1024.v */
+	{ RISCV_INS_VSUXEI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, RISCV_VSHAPE_SEGMENT }, /* vsuxei8.v */
+	{ RISCV_INS_VSUXEI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, RISCV_VSHAPE_SEGMENT }, /* vsuxei16.v */
+	{ RISCV_INS_VSUXEI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, RISCV_VSHAPE_SEGMENT }, /* vsuxei32.v */
+	{ RISCV_INS_VSUXEI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, RISCV_VSHAPE_SEGMENT }, /* vsuxei64.v */
+	{ RISCV_INS_VSUXEI128_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 128, 0, RISCV_VSHAPE_SEGMENT }, /* vsuxei128.v */
+	{ RISCV_INS_VSUXEI256_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 256, 0, RISCV_VSHAPE_SEGMENT }, /* vsuxei256.v */
+	{ RISCV_INS_VSUXEI512_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 512, 0, RISCV_VSHAPE_SEGMENT }, /* vsuxei512.v */
+	{ RISCV_INS_VSUXEI1024_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 1024, 0, RISCV_VSHAPE_SEGMENT }, /* vsuxei1024.v */
+	{ RISCV_INS_VLSE8_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 8, 0, RISCV_VSHAPE_SEGMENT }, /* vlse8.v */
+	{ RISCV_INS_VLSE16_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 16, 0, RISCV_VSHAPE_SEGMENT }, /* vlse16.v */
+	{ RISCV_INS_VLSE32_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 32, 0, RISCV_VSHAPE_SEGMENT }, /* vlse32.v */
+	{ RISCV_INS_VLSE64_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 64, 0, RISCV_VSHAPE_SEGMENT }, /* vlse64.v */
+	{ RISCV_INS_VLSE128_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 128, 0, RISCV_VSHAPE_SEGMENT }, /* vlse128.v */
+	{ RISCV_INS_VLSE256_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 256, 0, RISCV_VSHAPE_SEGMENT }, /* vlse256.v */
+	{ RISCV_INS_VLSE512_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 512, 0, RISCV_VSHAPE_SEGMENT }, /* vlse512.v */
+	{ RISCV_INS_VLSE1024_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 1024, 0, RISCV_VSHAPE_SEGMENT }, /* vlse1024.v */
+	{ RISCV_INS_VSSE8_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 8, 0, RISCV_VSHAPE_SEGMENT }, /* vsse8.v */
+	{ RISCV_INS_VSSE16_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 16, 0, RISCV_VSHAPE_SEGMENT }, /* vsse16.v */
+	{ RISCV_INS_VSSE32_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 32, 0, RISCV_VSHAPE_SEGMENT }, /* vsse32.v */
+	{ RISCV_INS_VSSE64_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 64, 0, RISCV_VSHAPE_SEGMENT }, /* vsse64.v */
+	{ RISCV_INS_VSSE128_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 128, 0, RISCV_VSHAPE_SEGMENT }, /* vsse128.v */
+	{ RISCV_INS_VSSE256_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 256, 0, RISCV_VSHAPE_SEGMENT }, /* vsse256.v */
+	{ RISCV_INS_VSSE512_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 512, 0, RISCV_VSHAPE_SEGMENT }, /* vsse512.v */
+	{ RISCV_INS_VSSE1024_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 1024, 0, RISCV_VSHAPE_SEGMENT }, /* vsse1024.v */
+	{ RISCV_INS_VLOXEI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, RISCV_VSHAPE_SEGMENT }, /* vloxei8.v */
+	{ RISCV_INS_VLOXEI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, RISCV_VSHAPE_SEGMENT }, /* vloxei16.v */
+	{ RISCV_INS_VLOXEI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, RISCV_VSHAPE_SEGMENT }, /* vloxei32.v */
+	{ RISCV_INS_VLOXEI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, RISCV_VSHAPE_SEGMENT }, /* vloxei64.v */
+	{ RISCV_INS_VLOXEI128_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 128, 0, RISCV_VSHAPE_SEGMENT }, /* vloxei128.v */
+	{ RISCV_INS_VLOXEI256_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 256, 0, RISCV_VSHAPE_SEGMENT }, /* vloxei256.v */
+	{ RISCV_INS_VLOXEI512_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 512, 0, RISCV_VSHAPE_SEGMENT }, /* vloxei512.v */
+	{ RISCV_INS_VLOXEI1024_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 1024, 0, RISCV_VSHAPE_SEGMENT }, /* vloxei1024.v */
+	{ RISCV_INS_VSOXEI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, RISCV_VSHAPE_SEGMENT }, /* vsoxei8.v */
+	{ RISCV_INS_VSOXEI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, RISCV_VSHAPE_SEGMENT }, /* vsoxei16.v */
+	{ RISCV_INS_VSOXEI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, RISCV_VSHAPE_SEGMENT }, /* vsoxei32.v */
+	{ RISCV_INS_VSOXEI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, RISCV_VSHAPE_SEGMENT }, /* vsoxei64.v */
+	{ RISCV_INS_VSOXEI128_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 128, 0, RISCV_VSHAPE_SEGMENT }, /* vsoxei128.v */
+	{ RISCV_INS_VSOXEI256_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 256, 0, RISCV_VSHAPE_SEGMENT }, /* vsoxei256.v */
+	{ RISCV_INS_VSOXEI512_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 512, 0, RISCV_VSHAPE_SEGMENT }, /* vsoxei512.v */
+	{ RISCV_INS_VSOXEI1024_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 1024, 0, RISCV_VSHAPE_SEGMENT }, /* vsoxei1024.v */
+	{ RISCV_INS_VLE8_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 8, 0, RISCV_VSHAPE_SEGMENT }, /* vle8.v */
+	{ RISCV_INS_VLE16_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 16, 0, RISCV_VSHAPE_SEGMENT }, /* vle16.v */
+	{ RISCV_INS_VLE32_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 32, 0, RISCV_VSHAPE_SEGMENT }, /* vle32.v */
+	{ RISCV_INS_VLE64_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 64, 0, RISCV_VSHAPE_SEGMENT }, /* vle64.v */
+	{ RISCV_INS_VLE128_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 128, 0, RISCV_VSHAPE_SEGMENT }, /* vle128.v */
+	{ RISCV_INS_VLE256_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 256, 0, RISCV_VSHAPE_SEGMENT }, /* vle256.v */
+	{ RISCV_INS_VLE512_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 512, 0, RISCV_VSHAPE_SEGMENT }, /* vle512.v */
+	{ RISCV_INS_VLE1024_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 1024, 0, RISCV_VSHAPE_SEGMENT }, /* vle1024.v */
+	{ RISCV_INS_VSE8_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 8, 0, RISCV_VSHAPE_SEGMENT }, /* vse8.v */
+	{ RISCV_INS_VSE16_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 16, 0, RISCV_VSHAPE_SEGMENT }, /* vse16.v */
+	{ RISCV_INS_VSE32_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 32, 0, RISCV_VSHAPE_SEGMENT }, /* vse32.v */
+	{ RISCV_INS_VSE64_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 64, 0, RISCV_VSHAPE_SEGMENT }, /* vse64.v */
+	{ RISCV_INS_VSE128_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 128, 0, RISCV_VSHAPE_SEGMENT }, /* vse128.v */
+	{ RISCV_INS_VSE256_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 256, 0, RISCV_VSHAPE_SEGMENT }, /* vse256.v */
+	{ RISCV_INS_VSE512_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 512, 0, RISCV_VSHAPE_SEGMENT }, /* vse512.v */
+	{ RISCV_INS_VSE1024_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 1024, 0, RISCV_VSHAPE_SEGMENT }, /* vse1024.v */
+	{ RISCV_INS_VLE8FF_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 8, 0, RISCV_VSHAPE_SEGMENT }, /* vle8ff.v */
+	{ RISCV_INS_VLE16FF_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 16, 0, RISCV_VSHAPE_SEGMENT }, /* vle16ff.v */
+	{ RISCV_INS_VLE32FF_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 32, 0, RISCV_VSHAPE_SEGMENT }, /* vle32ff.v */
+	{ RISCV_INS_VLE64FF_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 64, 0, RISCV_VSHAPE_SEGMENT }, /* vle64ff.v */
+	{ RISCV_INS_VLE128FF_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 128, 0, RISCV_VSHAPE_SEGMENT }, /* vle128ff.v */
+	{ RISCV_INS_VLE256FF_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 256, 0, RISCV_VSHAPE_SEGMENT }, /* vle256ff.v */
+	{ RISCV_INS_VLE512FF_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 512, 0, RISCV_VSHAPE_SEGMENT }, /* vle512ff.v */
+	{ RISCV_INS_VLE1024FF_V, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 1024, 0, RISCV_VSHAPE_SEGMENT }, /* vle1024ff.v */
+	{ RISCV_INS_VAMOSWAPEI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, 0 }, /* vamoswapei8.v */
+	{ RISCV_INS_VAMOADDEI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, 0 }, /* vamoaddei8.v */
+	{ RISCV_INS_VAMOXOREI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, 0 }, /* vamoxorei8.v */
+	{ RISCV_INS_VAMOANDEI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, 0 }, /* vamoandei8.v */
+	{ RISCV_INS_VAMOOREI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, 0 }, /* vamoorei8.v */
+	{ RISCV_INS_VAMOMINEI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, 0 }, /* vamominei8.v */
+	{ RISCV_INS_VAMOMAXEI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, 0 }, /* vamomaxei8.v */
+	{ RISCV_INS_VAMOMINUEI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, 0 }, /* vamominuei8.v */
+	{ RISCV_INS_VAMOMAXUEI8_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 8, 0, 0 }, /* vamomaxuei8.v */
+	{ RISCV_INS_VAMOSWAPEI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, 0 }, /* vamoswapei16.v */
+	{ RISCV_INS_VAMOADDEI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, 0 }, /* vamoaddei16.v */
+	{ RISCV_INS_VAMOXOREI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, 0 }, /* vamoxorei16.v */
+	{ RISCV_INS_VAMOANDEI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, 0 }, /* vamoandei16.v */
+	{ RISCV_INS_VAMOOREI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, 0 }, /* vamoorei16.v */
+	{ RISCV_INS_VAMOMINEI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, 0 }, /* vamominei16.v */
+	{ RISCV_INS_VAMOMAXEI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, 0 }, /* vamomaxei16.v */
+	{ RISCV_INS_VAMOMINUEI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, 0 }, /* vamominuei16.v */
+	{ RISCV_INS_VAMOMAXUEI16_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 16, 0, 0 }, /* vamomaxuei16.v */
+	{ RISCV_INS_VAMOSWAPEI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, 0 }, /* vamoswapei32.v */
+	{ RISCV_INS_VAMOADDEI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, 0 }, /* vamoaddei32.v */
+	{ RISCV_INS_VAMOXOREI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, 0 }, /* vamoxorei32.v */
+	{ RISCV_INS_VAMOANDEI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, 0 }, /* vamoandei32.v */
+	{ RISCV_INS_VAMOOREI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, 0 }, /* vamoorei32.v */
+	{ RISCV_INS_VAMOMINEI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, 0 }, /* vamominei32.v */
+	{ RISCV_INS_VAMOMAXEI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, 0 }, /* vamomaxei32.v */
+	{ RISCV_INS_VAMOMINUEI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, 0 }, /* vamominuei32.v */
+	{ RISCV_INS_VAMOMAXUEI32_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 32, 0, 0 }, /* vamomaxuei32.v */
+	{ RISCV_INS_VAMOSWAPEI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, 0 }, /* vamoswapei64.v */
+	{ RISCV_INS_VAMOADDEI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, 0 }, /* vamoaddei64.v */
+	{ RISCV_INS_VAMOXOREI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, 0 }, /* vamoxorei64.v */
+	{ RISCV_INS_VAMOANDEI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, 0 }, /* vamoandei64.v */
+	{ RISCV_INS_VAMOOREI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, 0 }, /* vamoorei64.v */
+	{ RISCV_INS_VAMOMINEI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, 0 }, /* vamominei64.v */
+	{ RISCV_INS_VAMOMAXEI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, 0 }, /* vamomaxei64.v */
+	{ RISCV_INS_VAMOMINUEI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, 0 }, /* vamominuei64.v */
+	{ RISCV_INS_VAMOMAXUEI64_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, 64, 0, 0 }, /* vamomaxuei64.v */
+	{ RISCV_INS_VFADD_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfadd.vf */
+	{ RISCV_INS_VFSUB_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfsub.vf */
+	{ RISCV_INS_VFMIN_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmin.vf */
+	{ RISCV_INS_VFMAX_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmax.vf */
+	{ RISCV_INS_VFSGNJ_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfsgnj.vf */
+	{ RISCV_INS_VFSGNJN_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfsgnjn.vf */
+	{ RISCV_INS_VFSGNJX_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfsgnjx.vf */
+	{ RISCV_INS_VFSLIDE1UP_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfslide1up.vf */
+	{ RISCV_INS_VFSLIDE1DOWN_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfslide1down.vf */
+	{ RISCV_INS_VMFEQ_VF, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmfeq.vf */
+	{ RISCV_INS_VMFLE_VF, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmfle.vf */
+	{ RISCV_INS_VMFLT_VF, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmflt.vf */
+	{ RISCV_INS_VMFNE_VF, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmfne.vf */
+	{ RISCV_INS_VMFGT_VF, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmfgt.vf */
+	{ RISCV_INS_VMFGE_VF, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmfge.vf */
+	{ RISCV_INS_VFDIV_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfdiv.vf */
+	{ RISCV_INS_VFRDIV_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfrdiv.vf */
+	{ RISCV_INS_VFMUL_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmul.vf */
+	{ RISCV_INS_VFRSUB_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfrsub.vf */
+	{ RISCV_INS_VFMADD_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmadd.vf */
+	{ RISCV_INS_VFNMADD_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfnmadd.vf */
+	{ RISCV_INS_VFMSUB_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmsub.vf */
+	{ RISCV_INS_VFNMSUB_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfnmsub.vf */
+	{ RISCV_INS_VFMACC_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmacc.vf */
+	{ RISCV_INS_VFNMACC_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfnmacc.vf */
+	{ RISCV_INS_VFMSAC_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmsac.vf */
+	{ RISCV_INS_VFNMSAC_VF, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfnmsac.vf */
+	{ RISCV_INS_VFWADD_VF, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwadd.vf */
+	{ RISCV_INS_VFWSUB_VF, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwsub.vf */
+	{ RISCV_INS_VFWADD_WF, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vfwadd.wf */
+	{ RISCV_INS_VFWSUB_WF, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vfwsub.wf */
+	{ RISCV_INS_VFWMUL_VF, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwmul.vf */
+	{ RISCV_INS_VFWMACC_VF, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwmacc.vf */
+	{ RISCV_INS_VFWNMACC_VF, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwnmacc.vf */
+	{ RISCV_INS_VFWMSAC_VF, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwmsac.vf */
+	{ RISCV_INS_VFWNMSAC_VF, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwnmsac.vf */
+	{ RISCV_INS_VFADD_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfadd.vv */
+	{ RISCV_INS_VFREDUSUM_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfredusum.vs */
+	{ RISCV_INS_VFSUB_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfsub.vv */
+	{ RISCV_INS_VFREDOSUM_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfredosum.vs */
+	{ RISCV_INS_VFMIN_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmin.vv */
+	{ RISCV_INS_VFREDMIN_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfredmin.vs */
+	{ RISCV_INS_VFMAX_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmax.vv */
+	{ RISCV_INS_VFREDMAX_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfredmax.vs */
+	{ RISCV_INS_VFSGNJ_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfsgnj.vv */
+	{ RISCV_INS_VFSGNJN_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfsgnjn.vv */
+	{ RISCV_INS_VFSGNJX_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfsgnjx.vv */
+	{ RISCV_INS_VMFEQ_VV, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmfeq.vv */
+	{ RISCV_INS_VMFLE_VV, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmfle.vv */
+	{ RISCV_INS_VMFLT_VV, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmflt.vv */
+	{ RISCV_INS_VMFNE_VV, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmfne.vv */
+	{ RISCV_INS_VFDIV_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfdiv.vv */
+	{ RISCV_INS_VFMUL_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmul.vv */
+	{ RISCV_INS_VFMADD_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmadd.vv */
+	{ RISCV_INS_VFNMADD_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfnmadd.vv */
+	{ RISCV_INS_VFMSUB_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmsub.vv */
+	{ RISCV_INS_VFNMSUB_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfnmsub.vv */
+	{ RISCV_INS_VFMACC_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmacc.vv */
+	{ RISCV_INS_VFNMACC_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfnmacc.vv */
+	{ RISCV_INS_VFMSAC_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmsac.vv */
+	{ RISCV_INS_VFNMSAC_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfnmsac.vv */
+	{ RISCV_INS_VFWADD_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwadd.vv */
+	{ RISCV_INS_VFWREDUSUM_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwredusum.vs */
+	{ RISCV_INS_VFWSUB_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwsub.vv */
+	{ RISCV_INS_VFWREDOSUM_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwredosum.vs */
+	{ RISCV_INS_VFWADD_WV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vfwadd.wv */
+	{ RISCV_INS_VFWSUB_WV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vfwsub.wv */
+	{ RISCV_INS_VFWMUL_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwmul.vv */
+	{ RISCV_INS_VFWMACC_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwmacc.vv */
+	{ RISCV_INS_VFWNMACC_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwnmacc.vv */
+	{ RISCV_INS_VFWMSAC_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwmsac.vv */
+	{ RISCV_INS_VFWNMSAC_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwnmsac.vv */
+	{ RISCV_INS_VADD_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vadd.vx */
+	{ RISCV_INS_VSUB_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsub.vx */
+	{ RISCV_INS_VRSUB_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vrsub.vx */
+	{ RISCV_INS_VMINU_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vminu.vx */
+	{ RISCV_INS_VMIN_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmin.vx */
+	{ RISCV_INS_VMAXU_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmaxu.vx */
+	{ RISCV_INS_VMAX_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmax.vx */
+	{ RISCV_INS_VAND_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vand.vx */
+	{ RISCV_INS_VOR_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vor.vx */
+	{ RISCV_INS_VXOR_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vxor.vx */
+	{ RISCV_INS_VRGATHER_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vrgather.vx */
+	{ RISCV_INS_VSLIDEUP_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vslideup.vx */
+	{ RISCV_INS_VSLIDEDOWN_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vslidedown.vx */
+	{ RISCV_INS_VMSEQ_VX, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmseq.vx */
+	{ RISCV_INS_VMSNE_VX, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsne.vx */
+	{ RISCV_INS_VMSLTU_VX, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsltu.vx */
+	{ RISCV_INS_VMSLT_VX, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmslt.vx */
+	{ RISCV_INS_VMSLEU_VX, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsleu.vx */
+	{ RISCV_INS_VMSLE_VX, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsle.vx */
+	{ RISCV_INS_VMSGTU_VX, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsgtu.vx */
+	{ RISCV_INS_VMSGT_VX, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsgt.vx */
+	{ RISCV_INS_VSADDU_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsaddu.vx */
+	{ RISCV_INS_VSADD_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsadd.vx */
+	{ RISCV_INS_VSSUBU_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vssubu.vx */
+	{ RISCV_INS_VSSUB_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vssub.vx */
+	{ RISCV_INS_VSLL_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsll.vx */
+	{ RISCV_INS_VSMUL_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsmul.vx */
+	{ RISCV_INS_VSRL_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsrl.vx */
+	{ RISCV_INS_VSRA_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsra.vx */
+	{ RISCV_INS_VSSRL_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vssrl.vx */
+	{ RISCV_INS_VSSRA_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vssra.vx */
+	{ RISCV_INS_VNSRL_WX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vnsrl.wx */
+	{ RISCV_INS_VNSRA_WX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vnsra.wx */
+	{ RISCV_INS_VNCLIPU_WX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vnclipu.wx */
+	{ RISCV_INS_VNCLIP_WX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vnclip.wx */
+	{ RISCV_INS_VADD_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vadd.vv */
+	{ RISCV_INS_VSUB_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsub.vv */
+	{ RISCV_INS_VMINU_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vminu.vv */
+	{ RISCV_INS_VMIN_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmin.vv */
+	{ RISCV_INS_VMAXU_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmaxu.vv */
+	{ RISCV_INS_VMAX_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmax.vv */
+	{ RISCV_INS_VAND_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vand.vv */
+	{ RISCV_INS_VOR_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vor.vv */
+	{ RISCV_INS_VXOR_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vxor.vv */
+	{ RISCV_INS_VRGATHER_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vrgather.vv */
+	{ RISCV_INS_VRGATHEREI16_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_EEW, RISCV_VGROUP_LMUL, 16, 0, 0 }, /* vrgatherei16.vv */
+	{ RISCV_INS_VMSEQ_VV, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmseq.vv */
+	{ RISCV_INS_VMSNE_VV, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsne.vv */
+	{ RISCV_INS_VMSLTU_VV, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsltu.vv */
+	{ RISCV_INS_VMSLT_VV, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmslt.vv */
+	{ RISCV_INS_VMSLEU_VV, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsleu.vv */
+	{ RISCV_INS_VMSLE_VV, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsle.vv */
+	{ RISCV_INS_VSADDU_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsaddu.vv */
+	{ RISCV_INS_VSADD_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsadd.vv */
+	{ RISCV_INS_VSSUBU_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vssubu.vv */
+	{ RISCV_INS_VSSUB_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vssub.vv */
+	{ RISCV_INS_VSLL_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsll.vv */
+	{ RISCV_INS_VSMUL_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsmul.vv */
+	{ RISCV_INS_VSRL_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsrl.vv */
+	{ RISCV_INS_VSRA_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsra.vv */
+	{ RISCV_INS_VSSRL_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vssrl.vv */
+	{ RISCV_INS_VSSRA_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vssra.vv */
+	{ RISCV_INS_VNSRL_WV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vnsrl.wv */
+	{ RISCV_INS_VNSRA_WV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vnsra.wv */
+	{ RISCV_INS_VNCLIPU_WV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vnclipu.wv */
+	{ RISCV_INS_VNCLIP_WV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vnclip.wv */
+	{ RISCV_INS_VWREDSUMU_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwredsumu.vs */
+	{ RISCV_INS_VWREDSUM_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwredsum.vs */
+	{ RISCV_INS_VADD_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vadd.vi */
+	{ RISCV_INS_VRSUB_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vrsub.vi */
+	{ RISCV_INS_VAND_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vand.vi */
+	{ RISCV_INS_VOR_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vor.vi */
+	{ RISCV_INS_VXOR_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vxor.vi */
+	{ RISCV_INS_VRGATHER_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vrgather.vi */
+	{ RISCV_INS_VSLIDEUP_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vslideup.vi */
+	{ RISCV_INS_VSLIDEDOWN_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vslidedown.vi */
+	{ RISCV_INS_VMSEQ_VI, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmseq.vi */
+	{ RISCV_INS_VMSNE_VI, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsne.vi */
+	{ RISCV_INS_VMSLEU_VI, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsleu.vi */
+	{ RISCV_INS_VMSLE_VI, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsle.vi */
+	{ RISCV_INS_VMSGTU_VI, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsgtu.vi */
+	{ RISCV_INS_VMSGT_VI, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsgt.vi */
+	{ RISCV_INS_VSADDU_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsaddu.vi */
+	{ RISCV_INS_VSADD_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsadd.vi */
+	{ RISCV_INS_VSLL_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsll.vi */
+	{ RISCV_INS_VSRL_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsrl.vi */
+	{ RISCV_INS_VSRA_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsra.vi */
+	{ RISCV_INS_VSSRL_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vssrl.vi */
+	{ RISCV_INS_VSSRA_VI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vssra.vi */
+	{ RISCV_INS_VNSRL_WI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vnsrl.wi */
+	{ RISCV_INS_VNSRA_WI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vnsra.wi */
+	{ RISCV_INS_VNCLIPU_WI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vnclipu.wi */
+	{ RISCV_INS_VNCLIP_WI, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vnclip.wi */
+	{ RISCV_INS_VREDSUM_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vredsum.vs */
+	{ RISCV_INS_VREDAND_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vredand.vs */
+	{ RISCV_INS_VREDOR_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vredor.vs */
+	{ RISCV_INS_VREDXOR_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vredxor.vs */
+	{ RISCV_INS_VREDMINU_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vredminu.vs */
+	{ RISCV_INS_VREDMIN_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vredmin.vs */
+	{ RISCV_INS_VREDMAXU_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vredmaxu.vs */
+	{ RISCV_INS_VREDMAX_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vredmax.vs */
+	{ RISCV_INS_VAADDU_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vaaddu.vv */
+	{ RISCV_INS_VAADD_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vaadd.vv */
+	{ RISCV_INS_VASUBU_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vasubu.vv */
+	{ RISCV_INS_VASUB_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vasub.vv */
+	{ RISCV_INS_VMANDN_MM, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmandn.mm */
+	{ RISCV_INS_VMAND_MM, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmand.mm */
+	{ RISCV_INS_VMOR_MM, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmor.mm */
+	{ RISCV_INS_VMXOR_MM, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmxor.mm */
+	{ RISCV_INS_VMORN_MM, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmorn.mm */
+	{ RISCV_INS_VMNAND_MM, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmnand.mm */
+	{ RISCV_INS_VMNOR_MM, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmnor.mm */
+	{ RISCV_INS_VMXNOR_MM, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmxnor.mm */
+	{ RISCV_INS_VDIVU_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vdivu.vv */
+	{ RISCV_INS_VDIV_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vdiv.vv */
+	{ RISCV_INS_VREMU_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vremu.vv */
+	{ RISCV_INS_VREM_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vrem.vv */
+	{ RISCV_INS_VMULHU_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmulhu.vv */
+	{ RISCV_INS_VMUL_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmul.vv */
+	{ RISCV_INS_VMULHSU_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmulhsu.vv */
+	{ RISCV_INS_VMULH_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmulh.vv */
+	{ RISCV_INS_VMADD_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmadd.vv */
+	{ RISCV_INS_VNMSUB_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vnmsub.vv */
+	{ RISCV_INS_VMACC_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmacc.vv */
+	{ RISCV_INS_VNMSAC_VV, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vnmsac.vv */
+	{ RISCV_INS_VWADDU_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwaddu.vv */
+	{ RISCV_INS_VWADD_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwadd.vv */
+	{ RISCV_INS_VWSUBU_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwsubu.vv */
+	{ RISCV_INS_VWSUB_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwsub.vv */
+	{ RISCV_INS_VWADDU_WV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vwaddu.wv */
+	{ RISCV_INS_VWADD_WV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vwadd.wv */
+	{ RISCV_INS_VWSUBU_WV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vwsubu.wv */
+	{ RISCV_INS_VWSUB_WV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vwsub.wv */
+	{ RISCV_INS_VWMULU_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmulu.vv */
+	{ RISCV_INS_VWMULSU_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmulsu.vv */
+	{ RISCV_INS_VWMUL_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmul.vv */
+	{ RISCV_INS_VWMACCU_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmaccu.vv */
+	{ RISCV_INS_VWMACC_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmacc.vv */
+	{ RISCV_INS_VWMACCSU_VV, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmaccsu.vv */
+	{ RISCV_INS_VAADDU_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vaaddu.vx */
+	{ RISCV_INS_VAADD_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vaadd.vx */
+	{ RISCV_INS_VASUBU_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vasubu.vx */
+	{ RISCV_INS_VASUB_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vasub.vx */
+	{ RISCV_INS_VSLIDE1UP_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vslide1up.vx */
+	{ RISCV_INS_VSLIDE1DOWN_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vslide1down.vx */
+	{ RISCV_INS_VDIVU_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vdivu.vx */
+	{ RISCV_INS_VDIV_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vdiv.vx */
+	{ RISCV_INS_VREMU_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vremu.vx */
+	{ RISCV_INS_VREM_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vrem.vx */
+	{ RISCV_INS_VMULHU_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmulhu.vx */
+	{ RISCV_INS_VMUL_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmul.vx */
+	{ RISCV_INS_VMULHSU_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmulhsu.vx */
+	{ RISCV_INS_VMULH_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmulh.vx */
+	{ RISCV_INS_VMADD_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmadd.vx */
+	{ RISCV_INS_VNMSUB_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vnmsub.vx */
+	{ RISCV_INS_VMACC_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmacc.vx */
+	{ RISCV_INS_VNMSAC_VX, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vnmsac.vx */
+	{ RISCV_INS_VWADDU_VX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwaddu.vx */
+	{ RISCV_INS_VWADD_VX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwadd.vx */
+	{ RISCV_INS_VWSUBU_VX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwsubu.vx */
+	{ RISCV_INS_VWSUB_VX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwsub.vx */
+	{ RISCV_INS_VWADDU_WX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vwaddu.wx */
+	{ RISCV_INS_VWADD_WX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vwadd.wx */
+	{ RISCV_INS_VWSUBU_WX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vwsubu.wx */
+	{ RISCV_INS_VWSUB_WX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vwsub.wx */
+	{ RISCV_INS_VWMULU_VX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmulu.vx */
+	{ RISCV_INS_VWMULSU_VX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmulsu.vx */
+	{ RISCV_INS_VWMUL_VX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmul.vx */
+	{ RISCV_INS_VWMACCU_VX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmaccu.vx */
+	{ RISCV_INS_VWMACC_VX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmacc.vx */
+	{ RISCV_INS_VWMACCUS_VX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmaccus.vx */
+	{ RISCV_INS_VWMACCSU_VX, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vwmaccsu.vx */
+	{ RISCV_INS_VFREDSUM_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfredsum.vs */
+	{ RISCV_INS_VFWREDSUM_VS, RISCV_VGROUP_ONE, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwredsum.vs */
+	{ RISCV_INS_VMORNOT_MM, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmornot.mm */
+	{ RISCV_INS_VMANDNOT_MM, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmandnot.mm */
+	{ RISCV_INS_VFCVT_XU_F_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfcvt.xu.f.v */
+	{ RISCV_INS_VFCVT_X_F_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfcvt.x.f.v */
+	{ RISCV_INS_VFCVT_F_XU_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfcvt.f.xu.v */
+	{ RISCV_INS_VFCVT_F_X_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfcvt.f.x.v */
+	{ RISCV_INS_VFCVT_RTZ_XU_F_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfcvt.rtz.xu.f.v */
+	{ RISCV_INS_VFCVT_RTZ_X_F_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfcvt.rtz.x.f.v */
+	{ RISCV_INS_VFWCVT_XU_F_V, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwcvt.xu.f.v */
+	{ RISCV_INS_VFWCVT_X_F_V, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwcvt.x.f.v */
+	{ RISCV_INS_VFWCVT_F_XU_V, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwcvt.f.xu.v */
+	{ RISCV_INS_VFWCVT_F_X_V, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwcvt.f.x.v */
+	{ RISCV_INS_VFWCVT_F_F_V, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwcvt.f.f.v */
+	{ RISCV_INS_VFWCVT_RTZ_XU_F_V, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwcvt.rtz.xu.f.v */
+	{ RISCV_INS_VFWCVT_RTZ_X_F_V, RISCV_VGROUP_WIDE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfwcvt.rtz.x.f.v */
+	{ RISCV_INS_VFNCVT_XU_F_W, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vfncvt.xu.f.w */
+	{ RISCV_INS_VFNCVT_X_F_W, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vfncvt.x.f.w */
+	{ RISCV_INS_VFNCVT_F_XU_W, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vfncvt.f.xu.w */
+	{ RISCV_INS_VFNCVT_F_X_W, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vfncvt.f.x.w */
+	{ RISCV_INS_VFNCVT_F_F_W, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vfncvt.f.f.w */
+	{ RISCV_INS_VFNCVT_ROD_F_F_W, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vfncvt.rod.f.f.w */
+	{ RISCV_INS_VFNCVT_RTZ_XU_F_W, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vfncvt.rtz.xu.f.w */
+	{ RISCV_INS_VFNCVT_RTZ_X_F_W, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_WIDE, 0, 0, 0 }, /* vfncvt.rtz.x.f.w */
+	{ RISCV_INS_VFSQRT_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfsqrt.v */
+	{ RISCV_INS_VFRSQRT7_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfrsqrt7.v */
+	{ RISCV_INS_VFREC7_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfrec7.v */
+	{ RISCV_INS_VFCLASS_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfclass.v */
+	{ RISCV_INS_VZEXT_VF8, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_FRAC8, 0, 0, 0 }, /* vzext.vf8 */
+	{ RISCV_INS_VSEXT_VF8, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_FRAC8, 0, 0, 0 }, /* vsext.vf8 */
+	{ RISCV_INS_VZEXT_VF4, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_FRAC4, 0, 0, 0 }, /* vzext.vf4 */
+	{ RISCV_INS_VSEXT_VF4, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_FRAC4, 0, 0, 0 }, /* vsext.vf4 */
+	{ RISCV_INS_VZEXT_VF2, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_FRAC2, 0, 0, 0 }, /* vzext.vf2 */
+	{ RISCV_INS_VSEXT_VF2, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_FRAC2, 0, 0, 0 }, /* vsext.vf2 */
+	{ RISCV_INS_VMSBF_M, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmsbf.m */
+	{ RISCV_INS_VMSOF_M, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmsof.m */
+	{ RISCV_INS_VMSIF_M, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vmsif.m */
+	{ RISCV_INS_VIOTA_M, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_MASK, 0, 0, 0 }, /* viota.m */
+	{ RISCV_INS_VCPOP_M, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vcpop.m */
+	{ RISCV_INS_VFIRST_M, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_MASK, 0, 0, 0 }, /* vfirst.m */
+	{ RISCV_INS_VPOPC_M, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vpopc.m */
+	{ RISCV_INS_VID_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vid.v */
+	{ RISCV_INS_VFMERGE_VFM, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vfmerge.vfm */
+	{ RISCV_INS_VADC_VXM, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vadc.vxm */
+	{ RISCV_INS_VMADC_VXM, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vmadc.vxm */
+	{ RISCV_INS_VMADC_VX, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmadc.vx */
+	{ RISCV_INS_VSBC_VXM, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vsbc.vxm */
+	{ RISCV_INS_VMSBC_VXM, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vmsbc.vxm */
+	{ RISCV_INS_VMSBC_VX, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsbc.vx */
+	{ RISCV_INS_VMERGE_VXM, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vmerge.vxm */
+	{ RISCV_INS_VADC_VVM, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vadc.vvm */
+	{ RISCV_INS_VMADC_VVM, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vmadc.vvm */
+	{ RISCV_INS_VMADC_VV, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmadc.vv */
+	{ RISCV_INS_VSBC_VVM, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vsbc.vvm */
+	{ RISCV_INS_VMSBC_VVM, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vmsbc.vvm */
+	{ RISCV_INS_VMSBC_VV, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmsbc.vv */
+	{ RISCV_INS_VMERGE_VVM, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vmerge.vvm */
+	{ RISCV_INS_VADC_VIM, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vadc.vim */
+	{ RISCV_INS_VMADC_VIM, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vmadc.vim */
+	{ RISCV_INS_VMADC_VI, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmadc.vi */
+	{ RISCV_INS_VMERGE_VIM, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, RISCV_VSHAPE_CARRY }, /* vmerge.vim */
+	{ RISCV_INS_VCOMPRESS_VM, RISCV_VGROUP_LMUL, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vcompress.vm */
+	{ RISCV_INS_VMVNFR_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WHOLE, 0, 0, 0 }, /* vmvnfr.v */
+	{ RISCV_INS_VFMV_F_S, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_ONE, 0, 0, 0 }, /* vfmv.f.s */
+	{ RISCV_INS_VMV1R_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WHOLE, 0, 1, 0 }, /* vmv1r.v */
+	{ RISCV_INS_VMV2R_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WHOLE, 0, 2, 0 }, /* vmv2r.v */
+	{ RISCV_INS_VMV4R_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WHOLE, 0, 4, 0 }, /* vmv4r.v */
+	{ RISCV_INS_VMV8R_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_WHOLE, 0, 8, 0 }, /* vmv8r.v */
+	{ RISCV_INS_VMV_X_S, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_ONE, 0, 0, 0 }, /* vmv.x.s */
+	{ RISCV_INS_VLM_V, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vlm.v */
+	{ RISCV_INS_VSM_V, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vsm.v */
+	{ RISCV_INS_VL1RE8_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 8, 1, 0 }, /* vl1re8.v */
+	{ RISCV_INS_VL1RE16_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 16, 1, 0 }, /* vl1re16.v */
+	{ RISCV_INS_VL1RE32_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 32, 1, 0 }, /* vl1re32.v */
+	{ RISCV_INS_VL1RE64_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 64, 1, 0 }, /* vl1re64.v */
+	{ RISCV_INS_VL2RE8_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 8, 2, 0 }, /* vl2re8.v */
+	{ RISCV_INS_VL2RE16_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 16, 2, 0 }, /* vl2re16.v */
+	{ RISCV_INS_VL2RE32_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 32, 2, 0 }, /* vl2re32.v */
+	{ RISCV_INS_VL2RE64_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 64, 2, 0 }, /* vl2re64.v */
+	{ RISCV_INS_VL4RE8_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 8, 4, 0 }, /* vl4re8.v */
+	{ RISCV_INS_VL4RE16_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 16, 4, 0 }, /* vl4re16.v */
+	{ RISCV_INS_VL4RE32_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 32, 4, 0 }, /* vl4re32.v */
+	{ RISCV_INS_VL4RE64_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 64, 4, 0 }, /* vl4re64.v */
+	{ RISCV_INS_VL8RE8_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 8, 8, 0 }, /* vl8re8.v */
+	{ RISCV_INS_VL8RE16_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 16, 8, 0 }, /* vl8re16.v */
+	{ RISCV_INS_VL8RE32_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 32, 8, 0 }, /* vl8re32.v */
+	{ RISCV_INS_VL8RE64_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 64, 8, 0 }, /* vl8re64.v */
+	{ RISCV_INS_VS1R_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 1, 0 }, /* vs1r.v */
+	{ RISCV_INS_VS2R_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 2, 0 }, /* vs2r.v */
+	{ RISCV_INS_VS4R_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 4, 0 }, /* vs4r.v */
+	{ RISCV_INS_VS8R_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 8, 0 }, /* vs8r.v */
+	{ RISCV_INS_VFMV_S_F, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmv.s.f */
+	{ RISCV_INS_VFMV_V_F, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vfmv.v.f */
+	{ RISCV_INS_VMV_V_X, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmv.v.x */
+	{ RISCV_INS_VMV_V_V, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmv.v.v */
+	{ RISCV_INS_VMV_V_I, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmv.v.i */
+	{ RISCV_INS_VMV_S_X, RISCV_VGROUP_ONE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vmv.s.x */
+	{ RISCV_INS_VL1R_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 1, 0 }, /* vl1r.v */
+	{ RISCV_INS_VL2R_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 2, 0 }, /* vl2r.v */
+	{ RISCV_INS_VL4R_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 4, 0 }, /* vl4r.v */
+	{ RISCV_INS_VL8R_V, RISCV_VGROUP_WHOLE, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 8, 0 }, /* vl8r.v */
+	{ RISCV_INS_VLE1_V, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vle1.v */
+	{ RISCV_INS_VSE1_V, RISCV_VGROUP_MASK, RISCV_VGROUP_LMUL, RISCV_VGROUP_LMUL, 0, 0, 0 }, /* vse1.v */
+};
 
-static ut32 riscv_rvv_KKK111HGGGGGccccc111DDDDD0000111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vd = (data & 0xf80) >> 7;
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vd], registers_vec[vs2], registers_std[rs1]);
-	return 4;
-}
 
-static ut32 riscv_rvv_KKK111HGGGGGccccc111EEEEE0100111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 vs2 = (data & 0x1f00000) >> 20;
-	ut32 vs3 = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, %s", registers_vec[vs2], registers_vec[vs3], registers_std[rs1]);
-	return 4;
-}
+/* index entries with this bit set select a block of the nested table */
+#define RISCV_SUBTABLE_NESTED 0x8000
+
+/* OP-V, keyed by funct3 (OPIVV..OPCFG) and funct6 */
+static const ut16 rvv_arith_candidates[595] = {
+	818, UT16_MAX, 747, UT16_MAX, 876, UT16_MAX, 851, UT16_MAX, 783, UT16_MAX, 711, UT16_MAX, UT16_MAX, 673, UT16_MAX, 748,
+	955, UT16_MAX, 877, UT16_MAX, 819, UT16_MAX, 749, UT16_MAX, 878, UT16_MAX, 784, UT16_MAX, 712, UT16_MAX, 750, UT16_MAX,
+	879, UT16_MAX, 852, UT16_MAX, 785, UT16_MAX, 820, UT16_MAX, 751, UT16_MAX, 880, UT16_MAX, 786, UT16_MAX, 713, UT16_MAX,
+	821, UT16_MAX, 752, UT16_MAX, 881, UT16_MAX, 787, UT16_MAX, 822, UT16_MAX, 753, UT16_MAX, 882, UT16_MAX, 788, UT16_MAX,
+	714, UT16_MAX, 823, UT16_MAX, 754, UT16_MAX, 883, UT16_MAX, 789, UT16_MAX, 755, UT16_MAX, 884, UT16_MAX, 715, UT16_MAX,
+	922, UT16_MAX, 824, UT16_MAX, 756, UT16_MAX, 885, UT16_MAX, 853, UT16_MAX, 790, UT16_MAX, 716, UT16_MAX, 923, UT16_MAX,
+	825, UT16_MAX, 757, UT16_MAX, 886, UT16_MAX, 854, UT16_MAX, 791, UT16_MAX, 717, UT16_MAX, 924, UT16_MAX, 826, UT16_MAX,
+	887, UT16_MAX, 855, UT16_MAX, 792, UT16_MAX, 925, UT16_MAX, 827, UT16_MAX, 856, UT16_MAX, 793, UT16_MAX, 828, UT16_MAX,
+	857, UT16_MAX, 794, UT16_MAX, 718, UT16_MAX, 926, UT16_MAX, 858, UT16_MAX, 795, UT16_MAX, 719, UT16_MAX, 927, UT16_MAX,
+	1007, UT16_MAX, 1020, UT16_MAX, 994, 995, 996, 1025, UT16_MAX, 1014, UT16_MAX, 1000, UT16_MAX, 1048, UT16_MAX, 1053,
+	UT16_MAX, 1008, 1009, UT16_MAX, 1015, 1016, UT16_MAX, 1001, 1002, UT16_MAX, 1010, UT16_MAX, 959, 960, 961, 962,
+	963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976, 977, 978,
+	979, UT16_MAX, 984, 985, 986, 987, 988, 989, UT16_MAX, 1003, UT16_MAX, 1011, 1012, UT16_MAX, 980, 981,
+	982, 983, UT16_MAX, 1004, 1005, UT16_MAX, 990, 991, 992, 993, 997, UT16_MAX, 1013, 1051, UT16_MAX, 1018,
+	UT16_MAX, 1017, 1052, UT16_MAX, 1006, 1050, UT16_MAX, 999, 1049, UT16_MAX, 829, UT16_MAX, 758, UT16_MAX, 888, 958,
+	UT16_MAX, 859, UT16_MAX, 796, UT16_MAX, 720, UT16_MAX, 830, UT16_MAX, 759, UT16_MAX, 889, UT16_MAX, 860, UT16_MAX, 797,
+	UT16_MAX, 721, UT16_MAX, 831, UT16_MAX, 890, UT16_MAX, 798, UT16_MAX, 832, UT16_MAX, 760, UT16_MAX, 891, UT16_MAX, 799,
+	UT16_MAX, 722, UT16_MAX, 833, UT16_MAX, 761, UT16_MAX, 892, 957, UT16_MAX, 861, UT16_MAX, 800, UT16_MAX, 723, UT16_MAX,
+	834, UT16_MAX, 893, UT16_MAX, 862, UT16_MAX, 801, UT16_MAX, 724, UT16_MAX, 894, UT16_MAX, 863, UT16_MAX, 802, UT16_MAX,
+	895, UT16_MAX, 864, UT16_MAX, 803, UT16_MAX, 725, UT16_MAX, 835, UT16_MAX, 762, UT16_MAX, 896, UT16_MAX, 865, UT16_MAX,
+	804, UT16_MAX, 726, UT16_MAX, 928, UT16_MAX, 998, UT16_MAX, 836, UT16_MAX, 897, UT16_MAX, 866, UT16_MAX, 805, UT16_MAX,
+	727, UT16_MAX, 929, UT16_MAX, 837, UT16_MAX, 898, UT16_MAX, 806, UT16_MAX, 930, UT16_MAX, 838, UT16_MAX, 899, UT16_MAX,
+	807, UT16_MAX, 931, UT16_MAX, 763, UT16_MAX, 900, UT16_MAX, 728, UT16_MAX, 932, UT16_MAX, 839, UT16_MAX, 901, UT16_MAX,
+	867, UT16_MAX, 808, UT16_MAX, 933, UT16_MAX, 902, UT16_MAX, 934, UT16_MAX, 840, UT16_MAX, 903, UT16_MAX, 1019, 1021,
+	1022, 1023, 1024, UT16_MAX, 809, UT16_MAX, 729, UT16_MAX, 935, UT16_MAX, 841, UT16_MAX, 764, UT16_MAX, 868, UT16_MAX,
+	810, UT16_MAX, 730, UT16_MAX, 842, UT16_MAX, 765, UT16_MAX, 904, UT16_MAX, 869, UT16_MAX, 811, UT16_MAX, 731, UT16_MAX,
+	936, UT16_MAX, 843, UT16_MAX, 766, UT16_MAX, 870, UT16_MAX, 812, UT16_MAX, 732, UT16_MAX, 844, UT16_MAX, 767, UT16_MAX,
+	905, UT16_MAX, 871, UT16_MAX, 813, UT16_MAX, 733, UT16_MAX, 937, UT16_MAX, 845, UT16_MAX, 768, UT16_MAX, 872, UT16_MAX,
+	814, UT16_MAX, 734, UT16_MAX, 846, UT16_MAX, 769, UT16_MAX, 906, UT16_MAX, 873, UT16_MAX, 815, UT16_MAX, 735, UT16_MAX,
+	938, UT16_MAX, 847, UT16_MAX, 770, UT16_MAX, 874, UT16_MAX, 816, UT16_MAX, 736, UT16_MAX, 848, UT16_MAX, 771, UT16_MAX,
+	907, UT16_MAX, 875, UT16_MAX, 817, UT16_MAX, 737, UT16_MAX, 939, UT16_MAX, 849, UT16_MAX, 772, UT16_MAX, 908, UT16_MAX,
+	738, UT16_MAX, 940, UT16_MAX, 674, UT16_MAX, 850, UT16_MAX, 773, 956, UT16_MAX, 909, UT16_MAX, 941, UT16_MAX, 774,
+	UT16_MAX, 910, UT16_MAX, 739, UT16_MAX, 942, UT16_MAX, 775, UT16_MAX, 911, UT16_MAX, 943, UT16_MAX, 776, UT16_MAX, 912,
+	UT16_MAX, 740, UT16_MAX, 944, UT16_MAX, 913, UT16_MAX, 945, UT16_MAX, 777, UT16_MAX, 914, UT16_MAX, 741, UT16_MAX, 946,
+	UT16_MAX, 915, UT16_MAX, 947, UT16_MAX, 778, UT16_MAX, 916, UT16_MAX, 742, UT16_MAX, 948, UT16_MAX, 917, UT16_MAX, 949,
+	UT16_MAX, 918, UT16_MAX, 950, UT16_MAX, 779, UT16_MAX, 919, UT16_MAX, 743, UT16_MAX, 951, UT16_MAX, 780, UT16_MAX, 920,
+	UT16_MAX, 744, UT16_MAX, 952, UT16_MAX, 781, UT16_MAX, 745, UT16_MAX, 953, UT16_MAX, 782, UT16_MAX, 921, UT16_MAX, 746,
+	UT16_MAX, 954, UT16_MAX,
+};
 
-static ut32 riscv_svinval_0001011dddddccccc000000001110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
+static const ut16 rvv_arith_index[512] = {
+	0, 2, 4, 6, 8, 10, 12, 13, 12, 15, 18, 12, 12, 12, 12, 13,
+	20, 22, 24, 12, 26, 28, 12, 13, 12, 30, 32, 34, 36, 12, 12, 13,
+	38, 40, 42, 12, 44, 46, 12, 13, 48, 50, 52, 12, 54, 12, 12, 13,
+	56, 58, 60, 12, 62, 64, 12, 13, 66, 68, 70, 12, 72, 12, 12, 13,
+	12, 74, 76, 12, 12, 78, 80, 13, 82, 84, 86, 88, 90, 92, 94, 13,
+	96, 98, 100, 102, 104, 106, 108, 13, 110, 12, 112, 114, 116, 12, 118, 13,
+	120, 12, 12, 122, 124, 12, 12, 13, 12, 12, 12, 12, 12, 12, 12, 13,
+	126, 12, 12, 128, 130, 132, 134, 13, 12, 12, 12, 136, 138, 140, 142, 13,
+	144, 146, 148, 153, 155, 157, 159, 13, 161, 12, 12, 164, 167, 12, 12, 13,
+	170, 172, 194, 12, 201, 12, 12, 13, 203, 206, 12, 12, 211, 12, 12, 13,
+	12, 12, 214, 12, 12, 12, 12, 13, 12, 12, 12, 12, 12, 12, 12, 13,
+	12, 12, 12, 12, 12, 12, 12, 13, 220, 12, 223, 225, 228, 231, 12, 13,
+	234, 236, 238, 241, 243, 245, 12, 13, 247, 249, 251, 253, 255, 257, 12, 13,
+	259, 12, 261, 12, 263, 12, 12, 13, 265, 267, 269, 12, 271, 273, 12, 13,
+	275, 277, 279, 282, 284, 286, 12, 13, 288, 12, 290, 292, 294, 296, 12, 13,
+	12, 12, 298, 300, 302, 12, 12, 13, 12, 12, 304, 306, 308, 310, 12, 13,
+	312, 314, 316, 318, 320, 322, 324, 326, 328, 12, 330, 332, 334, 336, 338, 12,
+	340, 12, 342, 12, 344, 12, 346, 12, 348, 12, 350, 12, 352, 12, 354, 12,
+	12, 356, 358, 12, 12, 360, 362, 12, 364, 12, 366, 368, 370, 12, 372, 12,
+	12, 12, 374, 12, 12, 12, 376, 12, 378, 12, 380, 382, 388, 390, 392, 12,
+	394, 396, 12, 398, 400, 402, 12, 12, 404, 406, 408, 410, 412, 414, 416, 12,
+	418, 420, 12, 422, 424, 426, 12, 12, 428, 430, 432, 434, 436, 438, 440, 12,
+	442, 444, 12, 446, 448, 450, 12, 12, 452, 454, 456, 458, 460, 462, 464, 12,
+	466, 468, 12, 470, 472, 474, 12, 12, 476, 478, 480, 482, 484, 486, 488, 12,
+	490, 492, 494, 12, 12, 496, 498, 500, 502, 504, 507, 12, 12, 12, 509, 500,
+	12, 511, 513, 12, 12, 515, 517, 500, 12, 519, 521, 12, 12, 12, 523, 500,
+	12, 525, 527, 12, 12, 529, 531, 500, 12, 12, 533, 12, 12, 12, 535, 500,
+	12, 537, 539, 12, 12, 541, 543, 500, 12, 12, 545, 12, 12, 12, 547, 500,
+	12, 549, 551, 12, 12, 553, 555, 500, 12, 12, 12, 12, 12, 12, 12, 500,
+	12, 12, 557, 12, 12, 12, 559, 500, 12, 12, 561, 12, 12, 12, 563, 500,
+	12, 565, 567, 12, 12, 569, 571, 500, 12, 573, 575, 12, 12, 577, 579, 500,
+	12, 581, 12, 12, 12, 583, 585, 500, 12, 587, 589, 12, 12, 591, 593, 500,
+};
 
-static ut32 riscv_svinval_0010011dddddccccc000000001110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
+/* LOAD-FP/STORE-FP, keyed by load/store, width, lumop/sumop and mew/mop */
+static const ut16 rvv_memory_candidates[202] = {
+	649, UT16_MAX, 657, UT16_MAX, 116, UT16_MAX, 117, UT16_MAX, 62, UT16_MAX, 63, UT16_MAX, 36, UT16_MAX, 37, UT16_MAX,
+	88, UT16_MAX, 89, UT16_MAX, 650, UT16_MAX, 658, UT16_MAX, 651, UT16_MAX, 659, UT16_MAX, 652, UT16_MAX, 660, UT16_MAX,
+	UT16_MAX, 1028, 1032, 1036, 1040, 1054, UT16_MAX, 1044, 1045, 1046, 1047, UT16_MAX, 1029, 1033, 1037, 1041,
+	UT16_MAX, 1030, 1034, 1038, 1042, UT16_MAX, 1031, 1035, 1039, 1043, UT16_MAX, 1026, 1058, UT16_MAX, 1027, 1059,
+	UT16_MAX, 665, UT16_MAX, 666, UT16_MAX, 667, UT16_MAX, 668, UT16_MAX, 601, UT16_MAX, 609, UT16_MAX, 602, UT16_MAX, 610,
+	UT16_MAX, 603, UT16_MAX, 611, UT16_MAX, 604, UT16_MAX, 612, UT16_MAX, 602, 1055, UT16_MAX, 617, UT16_MAX, 625, UT16_MAX,
+	618, UT16_MAX, 626, UT16_MAX, 619, UT16_MAX, 627, UT16_MAX, 620, UT16_MAX, 628, UT16_MAX, 633, UT16_MAX, 641, UT16_MAX,
+	634, UT16_MAX, 642, UT16_MAX, 635, UT16_MAX, 643, UT16_MAX, 636, UT16_MAX, 644, UT16_MAX, 635, 1056, UT16_MAX, 653,
+	UT16_MAX, 661, UT16_MAX, 654, UT16_MAX, 662, UT16_MAX, 655, UT16_MAX, 663, UT16_MAX, 656, UT16_MAX, 664, UT16_MAX, 669,
+	UT16_MAX, 670, UT16_MAX, 671, UT16_MAX, 672, UT16_MAX, 605, UT16_MAX, 613, UT16_MAX, 606, UT16_MAX, 614, UT16_MAX, 607,
+	UT16_MAX, 615, UT16_MAX, 608, UT16_MAX, 616, UT16_MAX, 621, UT16_MAX, 629, UT16_MAX, 622, UT16_MAX, 630, UT16_MAX, 623,
+	UT16_MAX, 631, UT16_MAX, 624, UT16_MAX, 632, UT16_MAX, 637, UT16_MAX, 645, UT16_MAX, 638, UT16_MAX, 646, UT16_MAX, 639,
+	UT16_MAX, 647, UT16_MAX, 640, UT16_MAX, 648, UT16_MAX, 640, 1057, UT16_MAX,
+};
 
-static ut32 riscv_svinval_0110011dddddccccc000000001110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
+static const ut16 rvv_memory_index[4096] = {
+	0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	33, 39, 4, 6, 8, 10, 12, 14, 16, 18, 44, 32, 49, 32, 54, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	59, 62, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	65, 32, 4, 6, 8, 10, 12, 14, 16, 18, 67, 32, 69, 32, 71, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 89, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	73, 75, 4, 6, 8, 10, 12, 14, 16, 18, 77, 79, 81, 83, 85, 87,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	92, 94, 4, 6, 8, 10, 12, 14, 16, 18, 96, 98, 100, 102, 104, 106,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 124, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	108, 110, 4, 6, 8, 10, 12, 14, 16, 18, 112, 114, 116, 118, 120, 122,
+	127, 129, 4, 6, 8, 10, 12, 14, 16, 18, 131, 133, 135, 137, 139, 141,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	143, 32, 4, 6, 8, 10, 12, 14, 16, 18, 145, 32, 147, 32, 149, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	32, 32, 4, 6, 8, 10, 12, 14, 16, 18, 32, 32, 32, 32, 32, 32,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	151, 153, 4, 6, 8, 10, 12, 14, 16, 18, 155, 157, 159, 161, 163, 165,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	167, 169, 4, 6, 8, 10, 12, 14, 16, 18, 171, 173, 175, 177, 179, 181,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 199, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+	183, 185, 4, 6, 8, 10, 12, 14, 16, 18, 187, 189, 191, 193, 195, 197,
+};
 
-static ut32 riscv_system_0001001dddddccccc000000001110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 rs2 = (data & 0x1f00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s", registers_std[rs1], registers_std[rs2]);
-	return 4;
-}
+/* OP-P, keyed by funct3 and funct7, unary operations by funct5 */
+static const ut16 rvp_candidates[645] = {
+	369, UT16_MAX, 291, UT16_MAX, 519, UT16_MAX, 275, UT16_MAX, UT16_MAX, 377, UT16_MAX, 353, UT16_MAX, 524, UT16_MAX, 372,
+	UT16_MAX, 290, UT16_MAX, 520, UT16_MAX, 373, UT16_MAX, 352, UT16_MAX, 521, UT16_MAX, 368, UT16_MAX, 401, UT16_MAX, 376,
+	UT16_MAX, 294, UT16_MAX, 384, UT16_MAX, 304, UT16_MAX, 383, UT16_MAX, 364, UT16_MAX, 515, UT16_MAX, 288, UT16_MAX, 445,
+	UT16_MAX, 485, UT16_MAX, 350, UT16_MAX, 456, UT16_MAX, 514, UT16_MAX, 292, UT16_MAX, 444, UT16_MAX, 486, UT16_MAX, 293,
+	UT16_MAX, 455, UT16_MAX, 487, UT16_MAX, 287, UT16_MAX, 402, UT16_MAX, 528, UT16_MAX, 349, UT16_MAX, 295, UT16_MAX, 382,
+	UT16_MAX, 305, UT16_MAX, 381, UT16_MAX, 365, UT16_MAX, 516, UT16_MAX, 469, UT16_MAX, 371, UT16_MAX, 554, UT16_MAX, 477,
+	UT16_MAX, 379, UT16_MAX, 559, UT16_MAX, 472, UT16_MAX, 422, UT16_MAX, 555, UT16_MAX, 473, UT16_MAX, 337, UT16_MAX, 556,
+	UT16_MAX, 468, UT16_MAX, 403, UT16_MAX, 529, UT16_MAX, 476, UT16_MAX, 296, UT16_MAX, 440, UT16_MAX, 306, UT16_MAX, 439,
+	UT16_MAX, 366, UT16_MAX, 517, UT16_MAX, 442, UT16_MAX, 471, UT16_MAX, 546, UT16_MAX, 453, UT16_MAX, 479, UT16_MAX, 551,
+	UT16_MAX, 446, UT16_MAX, 538, UT16_MAX, 547, UT16_MAX, 447, UT16_MAX, 338, UT16_MAX, 548, UT16_MAX, 441, UT16_MAX, 316,
+	UT16_MAX, 501, UT16_MAX, 452, UT16_MAX, 317, UT16_MAX, 502, UT16_MAX, 438, UT16_MAX, 437, UT16_MAX, 367, UT16_MAX, 518,
+	UT16_MAX, 279, UT16_MAX, 409, UT16_MAX, 482, UT16_MAX, 434, UT16_MAX, 328, UT16_MAX, 545, UT16_MAX, 285, UT16_MAX, 411,
+	UT16_MAX, 483, UT16_MAX, 286, UT16_MAX, 320, UT16_MAX, 484, UT16_MAX, 278, UT16_MAX, 310, UT16_MAX, 433, UT16_MAX, 311,
+	UT16_MAX, 500, UT16_MAX, 284, UT16_MAX, 334, UT16_MAX, 506, UT16_MAX, 283, UT16_MAX, 335, UT16_MAX, 507, UT16_MAX, 425,
+	UT16_MAX, 410, UT16_MAX, 534, UT16_MAX, 429, UT16_MAX, 329, UT16_MAX, 539, UT16_MAX, 386, UT16_MAX, 412, UT16_MAX, 525,
+	UT16_MAX, 343, UT16_MAX, 321, UT16_MAX, 510, UT16_MAX, 423, UT16_MAX, 404, UT16_MAX, 530, UT16_MAX, 427, UT16_MAX, 307,
+	UT16_MAX, 497, UT16_MAX, 385, UT16_MAX, 312, UT16_MAX, 503, UT16_MAX, 341, UT16_MAX, 387, UT16_MAX, 426, UT16_MAX, 318,
+	UT16_MAX, 535, UT16_MAX, 430, UT16_MAX, 354, UT16_MAX, 540, UT16_MAX, 340, UT16_MAX, 413, UT16_MAX, 508, UT16_MAX, 344,
+	UT16_MAX, 324, UT16_MAX, 511, UT16_MAX, 424, UT16_MAX, 405, UT16_MAX, 531, UT16_MAX, 428, UT16_MAX, 308, UT16_MAX, 498,
+	UT16_MAX, 339, UT16_MAX, 313, UT16_MAX, 504, UT16_MAX, 342, UT16_MAX, 345, UT16_MAX, 563, 564, UT16_MAX, 319, UT16_MAX,
+	536, UT16_MAX, 565, 566, UT16_MAX, 355, UT16_MAX, 541, UT16_MAX, 560, 562, UT16_MAX, 414, UT16_MAX, 526, UT16_MAX,
+	325, UT16_MAX, 572, 573, UT16_MAX, 406, UT16_MAX, 532, UT16_MAX, 574, 575, UT16_MAX, 309, UT16_MAX, 499, UT16_MAX,
+	569, 571, UT16_MAX, 314, UT16_MAX, 505, UT16_MAX, 346, UT16_MAX, 408, UT16_MAX, 370, UT16_MAX, 537, UT16_MAX, 400,
+	UT16_MAX, 378, UT16_MAX, 542, UT16_MAX, 561, 567, UT16_MAX, 396, UT16_MAX, 509, UT16_MAX, 302, UT16_MAX, 417, UT16_MAX,
+	407, UT16_MAX, 388, UT16_MAX, 399, UT16_MAX, 393, UT16_MAX, 570, 576, UT16_MAX, 391, UT16_MAX, 300, UT16_MAX, 330,
+	UT16_MAX, 462, UT16_MAX, 289, UT16_MAX, 533, UT16_MAX, 460, UT16_MAX, 351, UT16_MAX, 527, UT16_MAX, 315, UT16_MAX, 303,
+	UT16_MAX, 336, UT16_MAX, 461, UT16_MAX, 389, UT16_MAX, 459, UT16_MAX, 394, UT16_MAX, 392, UT16_MAX, 301, UT16_MAX, 331,
+	UT16_MAX, 420, UT16_MAX, 470, UT16_MAX, 553, UT16_MAX, 421, UT16_MAX, 478, UT16_MAX, 552, UT16_MAX, 457, UT16_MAX, 463,
+	UT16_MAX, 418, UT16_MAX, 390, UT16_MAX, 419, UT16_MAX, 395, UT16_MAX, 568, UT16_MAX, 589, UT16_MAX, 590, UT16_MAX, 591,
+	UT16_MAX, 592, UT16_MAX, 595, UT16_MAX, 596, UT16_MAX, 597, UT16_MAX, 598, UT16_MAX, 586, UT16_MAX, 587, UT16_MAX, 600,
+	UT16_MAX, 593, UT16_MAX, 588, UT16_MAX, 599, UT16_MAX, 594, UT16_MAX, 415, UT16_MAX, 577, UT16_MAX, 583, UT16_MAX, 580,
+	UT16_MAX, 578, UT16_MAX, 584, UT16_MAX, 581, UT16_MAX, 579, UT16_MAX, 585, UT16_MAX, 582, UT16_MAX, 332, UT16_MAX, 466,
+	UT16_MAX, 443, UT16_MAX, 522, UT16_MAX, 467, UT16_MAX, 454, UT16_MAX, 523, UT16_MAX, 448, UT16_MAX, 374, UT16_MAX, 449,
+	UT16_MAX, 375, UT16_MAX, 464, UT16_MAX, 465, UT16_MAX, 416, UT16_MAX, 333, UT16_MAX, 280, UT16_MAX, 512, UT16_MAX, 435,
+	UT16_MAX, 513, UT16_MAX, 356, UT16_MAX, 347, UT16_MAX, 359, UT16_MAX, 348, UT16_MAX, 397, UT16_MAX, 398, UT16_MAX, 458,
+	UT16_MAX, 481, UT16_MAX, 322, UT16_MAX, 557, UT16_MAX, 297, UT16_MAX, 558, UT16_MAX, 277, UT16_MAX, 474, UT16_MAX, 475,
+	UT16_MAX, 491, UT16_MAX, 488, UT16_MAX, 494, UT16_MAX, 480, UT16_MAX, 323, UT16_MAX, 281, UT16_MAX, 361, UT16_MAX, 549,
+	UT16_MAX, 298, UT16_MAX, 550, UT16_MAX, 380, UT16_MAX, 450, UT16_MAX, 282, UT16_MAX, 451, UT16_MAX, 276, UT16_MAX, 492,
+	UT16_MAX, 489, UT16_MAX, 495, UT16_MAX, 326, UT16_MAX, 358, UT16_MAX, 360, UT16_MAX, 543, UT16_MAX, 357, UT16_MAX, 299,
+	UT16_MAX, 544, UT16_MAX, 436, UT16_MAX, 431, UT16_MAX, 432, UT16_MAX, 493, UT16_MAX, 490, UT16_MAX, 362, UT16_MAX, 496,
+	UT16_MAX, 363, UT16_MAX, 327, UT16_MAX,
+};
 
-static ut32 riscv_system_nnnnnnnnnnnnccccc001aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
+static const ut16 rvp_index[1024] = {
+	0, 2, 4, 6, 8, 8, 8, 8, 9, 11, 13, 8, 8, 8, 8, 8,
+	15, 17, 19, 8, 8, 8, 8, 8, 21, 23, 25, 8, 8, 8, 8, 8,
+	27, 29, 8, 6, 8, 8, 8, 8, 31, 33, 8, 8, 8, 8, 8, 8,
+	35, 37, 8, 8, 8, 8, 8, 8, 39, 41, 43, 8, 8, 8, 8, 8,
+	45, 47, 49, 6, 8, 8, 8, 8, 51, 53, 55, 8, 8, 8, 8, 8,
+	57, 59, 61, 8, 8, 8, 8, 8, 63, 65, 67, 8, 8, 8, 8, 8,
+	69, 71, 73, 6, 8, 8, 8, 8, 75, 77, 8, 8, 8, 8, 8, 8,
+	79, 81, 8, 8, 8, 8, 8, 8, 83, 85, 87, 8, 8, 8, 8, 8,
+	89, 91, 93, 6, 8, 8, 8, 8, 95, 97, 99, 8, 8, 8, 8, 8,
+	101, 103, 105, 8, 8, 8, 8, 8, 107, 109, 111, 8, 8, 8, 8, 8,
+	113, 115, 117, 6, 8, 8, 8, 8, 119, 121, 8, 8, 8, 8, 8, 8,
+	123, 125, 8, 8, 8, 8, 8, 8, 127, 129, 131, 8, 8, 8, 8, 8,
+	133, 135, 137, 6, 8, 8, 8, 8, 139, 141, 143, 8, 8, 8, 8, 8,
+	145, 147, 149, 8, 8, 8, 8, 8, 151, 153, 155, 8, 8, 8, 8, 8,
+	157, 159, 161, 6, 8, 8, 8, 8, 163, 165, 167, 8, 8, 8, 8, 8,
+	169, 8, 8, 8, 8, 8, 8, 8, 171, 173, 175, 8, 8, 8, 8, 8,
+	177, 179, 181, 6, 8, 8, 8, 8, 183, 185, 187, 8, 8, 8, 8, 8,
+	189, 191, 193, 8, 8, 8, 8, 8, 195, 197, 199, 8, 8, 8, 8, 8,
+	201, 203, 8, 6, 8, 8, 8, 8, 205, 207, 209, 8, 8, 8, 8, 8,
+	211, 213, 215, 8, 8, 8, 8, 8, 217, 219, 221, 8, 8, 8, 8, 8,
+	223, 225, 227, 6, 8, 8, 8, 8, 229, 231, 233, 8, 8, 8, 8, 8,
+	235, 237, 239, 8, 8, 8, 8, 8, 241, 243, 245, 8, 8, 8, 8, 8,
+	247, 249, 251, 6, 8, 8, 8, 8, 253, 255, 257, 8, 8, 8, 8, 8,
+	259, 261, 263, 8, 8, 8, 8, 8, 265, 267, 8, 8, 8, 8, 8, 8,
+	269, 271, 273, 6, 8, 8, 8, 8, 275, 277, 279, 8, 8, 8, 8, 8,
+	281, 283, 285, 8, 8, 8, 8, 8, 287, 289, 291, 8, 8, 8, 8, 8,
+	293, 295, 297, 6, 8, 8, 8, 8, 299, 301, 303, 8, 8, 8, 8, 8,
+	305, 307, 309, 8, 8, 8, 8, 8, 311, 313, 8, 8, 8, 8, 8, 8,
+	315, 318, 320, 6, 8, 8, 8, 8, 322, 325, 327, 8, 8, 8, 8, 8,
+	329, 332, 334, 8, 8, 8, 8, 8, 8, 336, 8, 8, 8, 8, 8, 8,
+	338, 341, 343, 6, 8, 8, 8, 8, 345, 348, 350, 8, 8, 8, 8, 8,
+	352, 355, 357, 8, 8, 8, 8, 8, 8, 359, 8, 8, 8, 8, 8, 8,
+	361, 363, 365, 6, 8, 8, 8, 8, 367, 369, 371, 8, 8, 8, 8, 8,
+	373, 376, 378, 8, 8, 8, 8, 8, 380, 382, 8, 8, 8, 8, 8, 8,
+	384, 386, 8, 6, 8, 8, 8, 8, 388, 390, 8, 8, 8, 8, 8, 8,
+	392, 395, 8, 8, 8, 8, 8, 8, 397, 399, 8, 8, 8, 8, 8, 8,
+	401, 403, 405, 6, 8, 8, 8, 8, 407, 409, 411, 8, 8, 8, 8, 8,
+	8, 413, 8, 8, 8, 8, 8, 8, 415, 417, 8, 8, 8, 8, 8, 8,
+	419, 421, 8, 6, 8, 8, 8, 8, 423, 425, 8, 8, 8, 8, 8, 8,
+	8, 427, 8, 8, 8, 8, 8, 8, 429, 431, 8, 8, 8, 8, 8, 8,
+	433, 435, 437, 6, 8, 8, 8, 8, 439, 441, 443, 8, 8, 8, 8, 8,
+	8, 445, 8, 8, 8, 8, 8, 8, 8, 447, 8, 8, 8, 8, 8, 8,
+	449, 451, 8, 6, 8, 8, 8, 8, 453, 455, 8, 8, 8, 8, 8, 8,
+	32768, 489, 8, 8, 8, 8, 8, 8, 32769, 509, 8, 8, 8, 8, 8, 8,
+	511, 513, 515, 6, 8, 8, 8, 8, 517, 519, 521, 8, 8, 8, 8, 8,
+	8, 523, 525, 8, 8, 8, 8, 8, 8, 527, 529, 8, 8, 8, 8, 8,
+	531, 8, 8, 6, 8, 8, 8, 8, 533, 8, 8, 8, 8, 8, 8, 8,
+	8, 535, 8, 8, 8, 8, 8, 8, 8, 537, 8, 8, 8, 8, 8, 8,
+	8, 539, 541, 6, 8, 8, 8, 8, 8, 543, 545, 8, 8, 8, 8, 8,
+	8, 547, 549, 8, 8, 8, 8, 8, 8, 551, 553, 8, 8, 8, 8, 8,
+	555, 8, 8, 6, 8, 8, 8, 8, 557, 8, 8, 8, 8, 8, 8, 8,
+	559, 8, 8, 8, 8, 8, 8, 8, 561, 563, 8, 8, 8, 8, 8, 8,
+	8, 8, 565, 6, 8, 8, 8, 8, 8, 567, 569, 8, 8, 8, 8, 8,
+	8, 571, 573, 8, 8, 8, 8, 8, 8, 571, 575, 8, 8, 8, 8, 8,
+	8, 577, 8, 6, 8, 8, 8, 8, 8, 579, 8, 8, 8, 8, 8, 8,
+	8, 581, 8, 8, 8, 8, 8, 8, 583, 585, 8, 8, 8, 8, 8, 8,
+	587, 589, 591, 6, 8, 8, 8, 8, 8, 593, 595, 8, 8, 8, 8, 8,
+	597, 8, 599, 8, 8, 8, 8, 8, 601, 8, 603, 8, 8, 8, 8, 8,
+	605, 607, 8, 6, 8, 8, 8, 8, 605, 609, 8, 8, 8, 8, 8, 8,
+	8, 611, 8, 8, 8, 8, 8, 8, 8, 613, 8, 8, 8, 8, 8, 8,
+	615, 617, 619, 6, 8, 8, 8, 8, 621, 623, 625, 8, 8, 8, 8, 8,
+	627, 8, 629, 8, 8, 8, 8, 8, 8, 8, 631, 8, 8, 8, 8, 8,
+	8, 633, 8, 6, 8, 8, 8, 8, 8, 635, 8, 8, 8, 8, 8, 8,
+	637, 639, 8, 8, 8, 8, 8, 8, 641, 643, 8, 8, 8, 8, 8, 8,
+};
 
-static ut32 riscv_system_nnnnnnnnnnnnccccc010aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
+static const ut16 rvp_nested[64] = {
+	457, 457, 457, 457, 457, 457, 457, 457, 459, 461, 463, 465, 467, 469, 471, 473,
+	475, 477, 479, 481, 483, 8, 8, 485, 487, 8, 8, 8, 8, 8, 8, 8,
+	491, 493, 8, 495, 8, 8, 8, 8, 497, 499, 8, 501, 8, 8, 8, 8,
+	8, 8, 8, 8, 8, 8, 8, 8, 503, 505, 8, 507, 8, 8, 8, 8,
+};
 
-static ut32 riscv_system_nnnnnnnnnnnnccccc011aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
+/* instructions outside the sub-tables */
+static const ut16 scanned_candidates[410] = {
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 144, 145, 146, 147, 159, 160,
+	161, 162, 163, 164, 172, 173, 174, 179, 38, 39, 40, 41, 64, 65, 66, 67,
+	90, 91, 92, 93, 118, 119, 120, 121, 180, 181, 182, 183, 240, 241, 242, 1060,
+	1061, 1062, 1063, 1070, 1071, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1089,
+	1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 675, 676, 677, 678, 679, 680, 681,
+	682, 683, 684, 685, 686, 687, 688, 689, 690, 691, 692, 693, 694, 695, 696, 697,
+	698, 699, 700, 701, 702, 703, 704, 705, 706, 707, 708, 709, 710, 1088, 1099, 184,
+	185, 186, 187, 188, 189, 190, 191, 192, 243, 148, 149, 150, 42, 43, 44, 45,
+	68, 69, 70, 71, 94, 95, 96, 97, 122, 123, 124, 125, 193, 194, 195, 196,
+	197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212,
+	213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+	46, 47, 48, 49, 50, 51, 52, 53, 72, 73, 74, 75, 76, 77, 78, 79,
+	26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 1064, 1065, 1066, 1067, 1068, 1069,
+	1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 98, 99, 100, 101, 102, 103, 104, 105,
+	126, 127, 128, 129, 130, 131, 132, 133, 244, 245, 246, 247, 248, 249, 250, 251,
+	252, 253, 254, 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267,
+	268, 151, 152, 153, 154, 155, 156, 157, 158, 1108, 1109, 1110, 1111, 1112, 1119, 1120,
+	1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1136, 1139, 1140, 1141, 165, 1113, 54, 55,
+	56, 57, 58, 59, 60, 1144, 1145, 80, 81, 82, 83, 84, 106, 107, 108, 109,
+	110, 111, 112, 113, 114, 1146, 1147, 134, 135, 136, 137, 138, 139, 140, 1148, 1149,
+	1150, 1151, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 229, 230,
+	231, 232, 233, 234, 235, 236, 237, 238, 239, 61, 85, 86, 87, 1129, 1130, 1131,
+	1132, 1133, 1134, 1135, 115, 141, 142, 143, 269, 270, 271, 272, 273, 274, 1152, 1153,
+	1137, 1138, 1114, 1115, 1116, 1117, 1118, 1072, 1073, 1074, 1075, 1076, 1077, 175, 176, 177,
+	178, 1142, 1143, 166, 167, 168, 169, 170, 171, UT16_MAX,
+};
 
-static ut32 riscv_system_nnnnnnnnnnnnccccc101aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
-}
 
-static ut32 riscv_system_nnnnnnnnnnnnccccc110aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
+/* first instruction of the list matching data, the list ends with UT16_MAX */
+static st32 riscv_lookup_list(ut32 data, const ut16 *list) {
+	for (; *list != UT16_MAX; ++list) {
+		const RISCVInstruction *ins = &instructions[*list];
+		if ((data & ins->mbits) == ins->cbits) {
+			return *list;
+		}
+	}
+	return -1;
+}
+
+static st32 riscv_lookup(ut32 data) {
+	switch (data & 0x7f) {
+	case 0x57:
+		return riscv_lookup_list(data, rvv_arith_candidates + rvv_arith_index[((data >> 12) & 0x7) | ((data >> 23) & 0x1f8)]);
+	case 0x07:
+	case 0x27:
+		return riscv_lookup_list(data, rvv_memory_candidates + rvv_memory_index[((data >> 5) & 0x1) | ((data >> 11) & 0xe) | ((data >> 16) & 0x1f0) | ((data >> 17) & 0xe00)]);
+	case 0x77: {
+		ut16 entry = rvp_index[((data >> 12) & 0x7) | ((data >> 22) & 0x3f8)];
+		if (entry & RISCV_SUBTABLE_NESTED) {
+			entry = rvp_nested[((entry & ~RISCV_SUBTABLE_NESTED) << 5) | ((data >> 20) & 0x1f)];
+		}
+		return riscv_lookup_list(data, rvp_candidates + entry);
+	}
+	default:
+		return riscv_lookup_list(data, scanned_candidates);
+	}
 }
 
-static ut32 riscv_system_nnnnnnnnnnnnccccc111aaaaa1110011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rd = (data & 0xf80) >> 7;
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12 = (data & 0xfff00000) >> 20;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, %s, 0x%x", registers_std[rd], registers_std[rs1], imm12);
-	return 4;
+st64 riscv_immediate(RISCVImmediate kind, ut32 data) {
+	st32 imm = 0;
+	switch (kind) {
+	case RISCV_IMM_I:
+		imm = (st32)data >> 20;
+		break;
+	case RISCV_IMM_S:
+		imm = ((st32)(data & 0xfe000000) >> 20) | ((data >> 7) & 0x1f);
+		break;
+	case RISCV_IMM_B:
+		imm = ((st32)(data & 0x80000000) >> 19) | ((data & 0x80) << 4) | ((data >> 20) & 0x7e0) | ((data >> 7) & 0x1e);
+		break;
+	case RISCV_IMM_U:
+		imm = (st32)(data & 0xfffff000);
+		break;
+	case RISCV_IMM_J:
+		imm = ((st32)(data & 0x80000000) >> 11) | (data & 0xff000) | ((data >> 9) & 0x800) | ((data >> 20) & 0x7fe);
+		break;
+	case RISCV_IMM_CSR:
+		imm = data >> 20;
+		break;
+	case RISCV_IMM_UIMM2:
+		imm = (data >> 20) & 0x3;
+		break;
+	case RISCV_IMM_UIMM3:
+		imm = (data >> 20) & 0x7;
+		break;
+	case RISCV_IMM_UIMM4:
+		imm = (data >> 20) & 0xf;
+		break;
+	case RISCV_IMM_UIMM5:
+		imm = (data >> 20) & 0x1f;
+		break;
+	case RISCV_IMM_UIMM6:
+		imm = (data >> 20) & 0x3f;
+		break;
+	case RISCV_IMM_ZIMM:
+		imm = (data >> 15) & 0x1f;
+		break;
+	case RISCV_IMM_SIMM5:
+		imm = (st32)(data << 12) >> 27;
+		break;
+	case RISCV_IMM_ZIMM10:
+		imm = (data >> 20) & 0x3ff;
+		break;
+	case RISCV_IMM_ZIMM11:
+		imm = (data >> 20) & 0x7ff;
+		break;
+	case RISCV_IMM_BS:
+		imm = data >> 30;
+		break;
+	default:
+		break;
+	}
+	return imm;
 }
 
-static ut32 riscv_zicbo_000000000000ccccc010000000001111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_std[rs1]);
-	return 4;
+cchar *riscv_mnemonic(RISCVInsId id) {
+	if (id >= RISCV_INS_COUNT) {
+		return NULL;
+	}
+	const RISCVStandard *standard = riscv_standard(id);
+	return standard->names + standard->descriptions[id - standard->first].name;
 }
 
-static ut32 riscv_zicbo_000000000001ccccc010000000001111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_std[rs1]);
-	return 4;
+/**
+ * Sets the RZ_ANALYSIS_OP_TYPE_* and RZ_ANALYSIS_OP_FAMILY_* of the instruction
+ */
+bool riscv_op_class(RISCVInsId id, ut32 *type, st8 *family) {
+	rz_return_val_if_fail(type && family, false);
+	if (id >= RISCV_INS_COUNT) {
+		return false;
+	}
+	const RISCVAnalysis *info = riscv_analysis(id);
+	*type = info->type;
+	*family = info->family;
+	return true;
+}
+
+/**
+ * Renders the pseudo instruction matching the decoded one, if any.
+ * Returns false when the instruction has no alias and sb is left untouched.
+ */
+bool riscv_alias(const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	rz_return_val_if_fail(dec && sb, false);
+	ut32 lo = 0, hi = RZ_ARRAY_SIZE(aliases);
+	while (lo < hi) {
+		ut32 mid = lo + (hi - lo) / 2;
+		if (aliases[mid].id < dec->id) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	for (; lo < RZ_ARRAY_SIZE(aliases) && aliases[lo].id == dec->id; ++lo) {
+		const RISCVAlias *alias = &aliases[lo];
+		if ((dec->data & alias->mask) != alias->bits || (alias->same && dec->rs1 != dec->rs2)) {
+			continue;
+		}
+		renders[alias->render](alias_names + alias->name, dec, pc, sb);
+		return true;
+	}
+	return false;
+}
+
+/* moves the role flag to bit 0 (roles are powers of two) and then to the register bit */
+#define riscv_role(roles, role, reg) ((((roles) / (role)) & 1) << (reg))
+
+/**
+ * Fills regs from the RISCV_REGS_* roles of the register operands of dec
+ */
+void riscv_registers_roles(ut32 roles, const RISCVDecoded *dec, RISCVRegisters *regs) {
+	rz_return_if_fail(dec && regs);
+	/* x0 is hardwired to zero, it is never a real use or def */
+	regs->gpr_def = riscv_role(roles, RISCV_REGS_GPR_RD, dec->rd) & ~1u;
+	regs->gpr_use = (riscv_role(roles, RISCV_REGS_GPR_RS1, dec->rs1) |
+				riscv_role(roles, RISCV_REGS_GPR_RS2, dec->rs2) |
+				riscv_role(roles, RISCV_REGS_GPR_RS3, dec->rs3)) &
+		~1u;
+	regs->fpr_def = riscv_role(roles, RISCV_REGS_FPR_RD, dec->rd);
+	regs->fpr_use = riscv_role(roles, RISCV_REGS_FPR_RS1, dec->rs1) |
+		riscv_role(roles, RISCV_REGS_FPR_RS2, dec->rs2) |
+		riscv_role(roles, RISCV_REGS_FPR_RS3, dec->rs3);
+	regs->vec_def = riscv_role(roles, RISCV_REGS_VEC_RD, dec->rd);
+	regs->vec_use = riscv_role(roles, RISCV_REGS_VEC_RS1, dec->rs1) |
+		riscv_role(roles, RISCV_REGS_VEC_RS2, dec->rs2) |
+		riscv_role(roles, RISCV_REGS_VEC_RD_USE, dec->rd) |
+		/* the vm bit (25) shifted onto RISCV_REGS_VEC_VM (12), v0 is the mask */
+		riscv_role(roles & ~(dec->data >> 13), RISCV_REGS_VEC_VM, 0);
+}
+
+void riscv_registers(const RISCVDecoded *dec, RISCVRegisters *regs) {
+	rz_return_if_fail(dec && regs && dec->id < RISCV_INS_COUNT);
+	riscv_registers_roles(instructions[dec->id].regs, dec, regs);
+}
+
+/**
+ * Fills effect with the sp adjustment and the memory access of the instruction.
+ * Returns false when the instruction neither writes sp nor accesses memory.
+ */
+bool riscv_stack_effect(const RISCVDecoded *dec, RISCVStackEffect *effect) {
+	rz_return_val_if_fail(dec && effect && dec->id < RISCV_INS_COUNT, false);
+	const RISCVAnalysis *info = riscv_analysis(dec->id);
+	RISCVRegisters regs = { 0 };
+
+	memset(effect, 0, sizeof(RISCVStackEffect));
+	riscv_registers(dec, &regs);
+	if (dec->id == RISCV_INS_ADDI && dec->rd == RISCV_REG_SP && dec->rs1 == RISCV_REG_SP) {
+		effect->delta = dec->imm;
+	} else if (regs.gpr_def & (1u << RISCV_REG_SP)) {
+		effect->clobber = true;
+	}
+	if (info->memsize && instructions[dec->id].imm != RISCV_IMM_NONE &&
+		(info->type == RZ_ANALYSIS_OP_TYPE_LOAD || info->type == RZ_ANALYSIS_OP_TYPE_STORE)) {
+		effect->base = dec->rs1;
+		effect->offset = dec->imm;
+		effect->size = info->memsize;
+		effect->write = info->type == RZ_ANALYSIS_OP_TYPE_STORE;
+	}
+	return effect->delta || effect->clobber || effect->size;
 }
 
-static ut32 riscv_zicbo_000000000010ccccc010000000001111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_std[rs1]);
-	return 4;
+/**
+ * Marks the vector configuration as not known, as at the start of a block
+ */
+void riscv_vector_reset(RISCVVectorState *state) {
+	rz_return_if_fail(state);
+	memset(state, 0, sizeof(RISCVVectorState));
 }
 
-static ut32 riscv_zicbo_000000000100ccccc010000000001111(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s", registers_std[rs1]);
-	return 4;
+/* applies the vtype bits: vlmul[2:0], vsew[5:3], vta[6], vma[7] */
+static void riscv_vector_vtype(RISCVVectorState *state, ut64 vtype) {
+	ut32 vlmul = vtype & 7;
+	ut32 vsew = (vtype >> 3) & 7;
+	if (vlmul == 4 || vsew > 3) {
+		/* reserved values set vill */
+		riscv_vector_reset(state);
+		return;
+	}
+	state->sew = 8 << vsew;
+	state->lmul = vlmul < 4 ? (st32)vlmul : (st32)vlmul - 8;
+	state->ta = vtype & (1 << 6);
+	state->ma = vtype & (1 << 7);
+}
+
+static const RISCVVectorShape *riscv_vector_shape(ut16 id) {
+	ut32 lo = 0, hi = RZ_ARRAY_SIZE(vector_shapes);
+	while (lo < hi) {
+		ut32 mid = lo + (hi - lo) / 2;
+		if (vector_shapes[mid].id < id) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo < RZ_ARRAY_SIZE(vector_shapes) && vector_shapes[lo].id == id ? &vector_shapes[lo] : NULL;
 }
 
-static ut32 riscv_zicbo_ooooooo00000ccccc110000000010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12hi = (data & 0xfe000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rs1], imm12);
-	return 4;
-}
+static st32 riscv_log2(ut32 x) {
+	st32 n = 0;
+	while (x > 1) {
+		x >>= 1;
+		n++;
+	}
+	return n;
+}
+
+/* registers of the group starting at reg, one register when the configuration is not known */
+static ut32 riscv_vector_group(const RISCVVectorState *state, const RISCVVectorShape *shape, ut32 whole, ut8 group, ut8 reg, ut32 fields) {
+	st32 emul = 0;
+	if (group == RISCV_VGROUP_WHOLE) {
+		emul = riscv_log2(whole);
+	} else if (state->sew) {
+		switch (group) {
+		case RISCV_VGROUP_LMUL:
+			emul = state->lmul;
+			break;
+		case RISCV_VGROUP_WIDE:
+			emul = state->lmul + 1;
+			break;
+		case RISCV_VGROUP_FRAC2:
+			emul = state->lmul - 1;
+			break;
+		case RISCV_VGROUP_FRAC4:
+			emul = state->lmul - 2;
+			break;
+		case RISCV_VGROUP_FRAC8:
+			emul = state->lmul - 3;
+			break;
+		case RISCV_VGROUP_EEW:
+			emul = state->lmul + riscv_log2(shape->eew) - riscv_log2(state->sew);
+			break;
+		default:
+			break;
+		}
+	}
+	/* fractional groups still take a whole register, groups are at most 8 registers */
+	ut32 n = (emul > 0 ? 1u << RZ_MIN(emul, 3) : 1) * fields;
+	if (n >= 32) {
+		return UT32_MAX << reg;
+	}
+	return (ut32)(((1ull << n) - 1) << reg);
+}
+
+/**
+ * Tracks vsetvli/vsetivli/vsetvl in state and annotates the vector instruction
+ * with the configuration it executes with and the registers of its groups.
+ * When the configuration is not known every group is assumed to be a single
+ * register and the tail and mask policies to be undisturbed.
+ * Returns false and leaves state untouched when the instruction is not a vector one.
+ */
+bool riscv_vector_op(RISCVVectorState *state, const RISCVDecoded *dec, RISCVVectorOp *op) {
+	rz_return_val_if_fail(state && dec && op && dec->id < RISCV_INS_COUNT, false);
+	memset(op, 0, sizeof(RISCVVectorOp));
+	op->nf = 1;
+	switch (dec->id) {
+	case RISCV_INS_VSETVLI:
+	case RISCV_INS_VSETIVLI:
+		riscv_vector_vtype(state, dec->imm);
+		op->vtype = *state;
+		return true;
+	case RISCV_INS_VSETVL:
+		/* vtype is read from rs2 */
+		riscv_vector_reset(state);
+		return true;
+	default:
+		break;
+	}
 
-static ut32 riscv_zicbo_ooooooo00001ccccc110000000010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12hi = (data & 0xfe000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rs1], imm12);
-	return 4;
-}
+	const RISCVVectorShape *shape = riscv_vector_shape(dec->id);
+	if (!shape) {
+		return false;
+	}
+	ut32 roles = instructions[dec->id].regs;
+	op->vtype = *state;
+	op->masked = (roles & RISCV_REGS_VEC_VM) && !(dec->data & (1 << 25));
+	op->eew = shape->eew;
+	if (shape->flags & RISCV_VSHAPE_SEGMENT) {
+		op->nf = (dec->data >> 29) + 1;
+	}
 
-static ut32 riscv_zicbo_ooooooo00011ccccc110000000010011(cchar* name, ut32 data, ut64 pc, RzStrBuf *sb) {
-	ut32 rs1 = (data & 0xf8000) >> 15;
-	ut32 imm12hi = (data & 0xfe000000) >> 25;
-	rz_strbuf_set(sb, name);
-	rz_str_buf_appendf(" %s, 0x%x", registers_std[rs1], imm12);
-	return 4;
+	/* vmvnfr.v encodes the registers count minus one in simm5 */
+	ut32 whole = shape->count ? shape->count : (dec->rs1 & 7) + 1;
+	ut32 vd = riscv_vector_group(state, shape, whole, shape->vd, dec->rd, op->nf);
+	if (roles & RISCV_REGS_VEC_RD) {
+		op->vec_def = vd;
+		/* undisturbed elements keep the old value of vd, mask destinations are always tail agnostic */
+		bool tail = shape->vd != RISCV_VGROUP_MASK && shape->vd != RISCV_VGROUP_WHOLE && !state->ta;
+		if (tail || (op->masked && !state->ma)) {
+			op->vec_use |= vd;
+		}
+	}
+	if (roles & RISCV_REGS_VEC_RD_USE) {
+		op->vec_use |= vd;
+	}
+	if (roles & RISCV_REGS_VEC_RS1) {
+		op->vec_use |= riscv_vector_group(state, shape, whole, shape->vs1, dec->rs1, 1);
+	}
+	if (roles & RISCV_REGS_VEC_RS2) {
+		op->vec_use |= riscv_vector_group(state, shape, whole, shape->vs2, dec->rs2, 1);
+	}
+	if (op->masked || (shape->flags & RISCV_VSHAPE_CARRY)) {
+		op->vec_use |= 1;
+	}
+	return true;
 }
 
-static const RISCVInstruction instructions[] = {
-	{ "jal", /*              mmmmmmmmmmmmmmmmmmmmaaaaa1101111 */ 0x0000006f, 0x0000007f, riscv_rv32i_mmmmmmmmmmmmmmmmmmmmaaaaa1101111 },
-	{ "lui", /*              llllllllllllllllllllaaaaa0110111 */ 0x00000037, 0x0000007f, riscv_rv32i_llllllllllllllllllllaaaaa0110111 },
-	{ "auipc", /*            llllllllllllllllllllaaaaa0010111 */ 0x00000017, 0x0000007f, riscv_rv32i_llllllllllllllllllllaaaaa0010111 },
-	{ "fld", /*              nnnnnnnnnnnnccccc011aaaaa0000111 */ 0x00003007, 0x0000707f, riscv_rv32d_nnnnnnnnnnnnccccc011aaaaa0000111 },
-	{ "fsd", /*              ooooooodddddccccc011qqqqq0100111 */ 0x00003027, 0x0000707f, riscv_rv32d_ooooooodddddccccc011qqqqq0100111 },
-	{ "flw", /*              nnnnnnnnnnnnccccc010aaaaa0000111 */ 0x00002007, 0x0000707f, riscv_rv32f_nnnnnnnnnnnnccccc010aaaaa0000111 },
-	{ "fsw", /*              ooooooodddddccccc010qqqqq0100111 */ 0x00002027, 0x0000707f, riscv_rv32f_ooooooodddddccccc010qqqqq0100111 },
-	{ "beq", /*              pppppppdddddccccc000rrrrr1100011 */ 0x00000063, 0x0000707f, riscv_rv32i_pppppppdddddccccc000rrrrr1100011 },
-	{ "bne", /*              pppppppdddddccccc001rrrrr1100011 */ 0x00001063, 0x0000707f, riscv_rv32i_pppppppdddddccccc001rrrrr1100011 },
-	{ "blt", /*              pppppppdddddccccc100rrrrr1100011 */ 0x00004063, 0x0000707f, riscv_rv32i_pppppppdddddccccc100rrrrr1100011 },
-	{ "bge", /*              pppppppdddddccccc101rrrrr1100011 */ 0x00005063, 0x0000707f, riscv_rv32i_pppppppdddddccccc101rrrrr1100011 },
-	{ "bltu", /*             pppppppdddddccccc110rrrrr1100011 */ 0x00006063, 0x0000707f, riscv_rv32i_pppppppdddddccccc110rrrrr1100011 },
-	{ "bgeu", /*             pppppppdddddccccc111rrrrr1100011 */ 0x00007063, 0x0000707f, riscv_rv32i_pppppppdddddccccc111rrrrr1100011 },
-	{ "jalr", /*             nnnnnnnnnnnnccccc000aaaaa1100111 */ 0x00000067, 0x0000707f, riscv_rv32i_nnnnnnnnnnnnccccc000aaaaa1100111 },
-	{ "addi", /*             nnnnnnnnnnnnccccc000aaaaa0010011 */ 0x00000013, 0x0000707f, riscv_rv32i_nnnnnnnnnnnnccccc000aaaaa0010011 },
-	{ "slti", /*             nnnnnnnnnnnnccccc010aaaaa0010011 */ 0x00002013, 0x0000707f, riscv_rv32i_nnnnnnnnnnnnccccc010aaaaa0010011 },
-	{ "sltiu", /*            nnnnnnnnnnnnccccc011aaaaa0010011 */ 0x00003013, 0x0000707f, riscv_rv32i_nnnnnnnnnnnnccccc011aaaaa0010011 },
-	{ "xori", /*             nnnnnnnnnnnnccccc100aaaaa0010011 */ 0x00004013, 0x0000707f, riscv_rv32i_nnnnnnnnnnnnccccc100aaaaa0010011 },
-	{ "ori", /*              nnnnnnnnnnnnccccc110aaaaa0010011 */ 0x00006013, 0x0000707f, riscv_rv32i_nnnnnnnnnnnnccccc110aaaaa0010011 },
-	{ "andi", /*             nnnnnnnnnnnnccccc111aaaaa0010011 */ 0x00007013, 0x0000707f, riscv_rv32i_nnnnnnnnnnnnccccc111aaaaa0010011 },
-	{ "lb", /*               nnnnnnnnnnnnccccc000aaaaa0000011 */ 0x00000003, 0x0000707f, riscv_rv32i_nnnnnnnnnnnnccccc000aaaaa0000011 },
-	{ "lh", /*               nnnnnnnnnnnnccccc001aaaaa0000011 */ 0x00001003, 0x0000707f, riscv_rv32i_nnnnnnnnnnnnccccc001aaaaa0000011 },
-	{ "lw", /*               nnnnnnnnnnnnccccc010aaaaa0000011 */ 0x00002003, 0x0000707f, riscv_rv32i_nnnnnnnnnnnnccccc010aaaaa0000011 },
-	{ "lbu", /*              nnnnnnnnnnnnccccc100aaaaa0000011 */ 0x00004003, 0x0000707f, riscv_rv32i_nnnnnnnnnnnnccccc100aaaaa0000011 },
-	{ "lhu", /*              nnnnnnnnnnnnccccc101aaaaa0000011 */ 0x00005003, 0x0000707f, riscv_rv32i_nnnnnnnnnnnnccccc101aaaaa0000011 },
-	{ "sb", /*               ooooooodddddccccc000qqqqq0100011 */ 0x00000023, 0x0000707f, riscv_rv32i_ooooooodddddccccc000qqqqq0100011 },
-	{ "sh", /*               ooooooodddddccccc001qqqqq0100011 */ 0x00001023, 0x0000707f, riscv_rv32i_ooooooodddddccccc001qqqqq0100011 },
-	{ "sw", /*               ooooooodddddccccc010qqqqq0100011 */ 0x00002023, 0x0000707f, riscv_rv32i_ooooooodddddccccc010qqqqq0100011 },
-	{ "fence", /*            gggghhhhiiiiccccc000aaaaa0001111 */ 0x0000000f, 0x0000707f, riscv_rv32i_gggghhhhiiiiccccc000aaaaa0001111 },
-	{ "fence.i", /*          nnnnnnnnnnnnccccc001aaaaa0001111 */ 0x0000100f, 0x0000707f, riscv_unique },
-	{ "flq", /*              nnnnnnnnnnnnccccc100aaaaa0000111 */ 0x00004007, 0x0000707f, riscv_rv32q_nnnnnnnnnnnnccccc100aaaaa0000111 },
-	{ "fsq", /*              ooooooodddddccccc100qqqqq0100111 */ 0x00004027, 0x0000707f, riscv_rv32q_ooooooodddddccccc100qqqqq0100111 },
-	{ "flh", /*              nnnnnnnnnnnnccccc001aaaaa0000111 */ 0x00001007, 0x0000707f, riscv_rv32zfh_nnnnnnnnnnnnccccc001aaaaa0000111 },
-	{ "fsh", /*              ooooooodddddccccc001qqqqq0100111 */ 0x00001027, 0x0000707f, riscv_rv32zfh_ooooooodddddccccc001qqqqq0100111 },
-	{ "addiw", /*            nnnnnnnnnnnnccccc000aaaaa0011011 */ 0x0000001b, 0x0000707f, riscv_rv64i_nnnnnnnnnnnnccccc000aaaaa0011011 },
-	{ "ld", /*               nnnnnnnnnnnnccccc011aaaaa0000011 */ 0x00003003, 0x0000707f, riscv_rv64i_nnnnnnnnnnnnccccc011aaaaa0000011 },
-	{ "lwu", /*              nnnnnnnnnnnnccccc110aaaaa0000011 */ 0x00006003, 0x0000707f, riscv_rv64i_nnnnnnnnnnnnccccc110aaaaa0000011 },
-	{ "sd", /*               ooooooodddddccccc011qqqqq0100011 */ 0x00003023, 0x0000707f, riscv_rv64i_ooooooodddddccccc011qqqqq0100011 },
-	{ "csrrw", /*            nnnnnnnnnnnnccccc001aaaaa1110011 */ 0x00001073, 0x0000707f, riscv_system_nnnnnnnnnnnnccccc001aaaaa1110011 },
-	{ "csrrs", /*            nnnnnnnnnnnnccccc010aaaaa1110011 */ 0x00002073, 0x0000707f, riscv_system_nnnnnnnnnnnnccccc010aaaaa1110011 },
-	{ "csrrc", /*            nnnnnnnnnnnnccccc011aaaaa1110011 */ 0x00003073, 0x0000707f, riscv_system_nnnnnnnnnnnnccccc011aaaaa1110011 },
-	{ "csrrwi", /*           nnnnnnnnnnnnccccc101aaaaa1110011 */ 0x00005073, 0x0000707f, riscv_system_nnnnnnnnnnnnccccc101aaaaa1110011 },
-	{ "csrrsi", /*           nnnnnnnnnnnnccccc110aaaaa1110011 */ 0x00006073, 0x0000707f, riscv_system_nnnnnnnnnnnnccccc110aaaaa1110011 },
-	{ "csrrci", /*           nnnnnnnnnnnnccccc111aaaaa1110011 */ 0x00007073, 0x0000707f, riscv_system_nnnnnnnnnnnnccccc111aaaaa1110011 },
-	{ "prefetch.i", /*       ooooooo00000ccccc110000000010011 */ 0x00006013, 0x01f07fff, riscv_zicbo_ooooooo00000ccccc110000000010011 },
-	{ "prefetch.r", /*       ooooooo00001ccccc110000000010011 */ 0x00106013, 0x01f07fff, riscv_zicbo_ooooooo00001ccccc110000000010011 },
-	{ "prefetch.w", /*       ooooooo00011ccccc110000000010011 */ 0x00306013, 0x01f07fff, riscv_zicbo_ooooooo00011ccccc110000000010011 },
-	{ "fsri", /*             eeeee1ttttttccccc101aaaaa0010011 */ 0x04005013, 0x0400707f, riscv_rv32b_eeeee1ttttttccccc101aaaaa0010011 },
-	{ "fmadd.d", /*          eeeee01dddddcccccjjjaaaaa1000011 */ 0x02000043, 0x0600007f, riscv_rv32d_eeeee01dddddcccccjjjaaaaa1000011 },
-	{ "fmsub.d", /*          eeeee01dddddcccccjjjaaaaa1000111 */ 0x02000047, 0x0600007f, riscv_rv32d_eeeee01dddddcccccjjjaaaaa1000111 },
-	{ "fnmsub.d", /*         eeeee01dddddcccccjjjaaaaa1001011 */ 0x0200004b, 0x0600007f, riscv_rv32d_eeeee01dddddcccccjjjaaaaa1001011 },
-	{ "fnmadd.d", /*         eeeee01dddddcccccjjjaaaaa1001111 */ 0x0200004f, 0x0600007f, riscv_rv32d_eeeee01dddddcccccjjjaaaaa1001111 },
-	{ "fmadd.s", /*          eeeee00dddddcccccjjjaaaaa1000011 */ 0x00000043, 0x0600007f, riscv_rv32f_eeeee00dddddcccccjjjaaaaa1000011 },
-	{ "fmsub.s", /*          eeeee00dddddcccccjjjaaaaa1000111 */ 0x00000047, 0x0600007f, riscv_rv32f_eeeee00dddddcccccjjjaaaaa1000111 },
-	{ "fnmsub.s", /*         eeeee00dddddcccccjjjaaaaa1001011 */ 0x0000004b, 0x0600007f, riscv_rv32f_eeeee00dddddcccccjjjaaaaa1001011 },
-	{ "fnmadd.s", /*         eeeee00dddddcccccjjjaaaaa1001111 */ 0x0000004f, 0x0600007f, riscv_rv32f_eeeee00dddddcccccjjjaaaaa1001111 },
-	{ "fmadd.q", /*          eeeee11dddddcccccjjjaaaaa1000011 */ 0x06000043, 0x0600007f, riscv_rv32q_eeeee11dddddcccccjjjaaaaa1000011 },
-	{ "fmsub.q", /*          eeeee11dddddcccccjjjaaaaa1000111 */ 0x06000047, 0x0600007f, riscv_rv32q_eeeee11dddddcccccjjjaaaaa1000111 },
-	{ "fnmsub.q", /*         eeeee11dddddcccccjjjaaaaa1001011 */ 0x0600004b, 0x0600007f, riscv_rv32q_eeeee11dddddcccccjjjaaaaa1001011 },
-	{ "fnmadd.q", /*         eeeee11dddddcccccjjjaaaaa1001111 */ 0x0600004f, 0x0600007f, riscv_rv32q_eeeee11dddddcccccjjjaaaaa1001111 },
-	{ "fmadd.h", /*          eeeee10dddddcccccjjjaaaaa1000011 */ 0x04000043, 0x0600007f, riscv_rv32zfh_eeeee10dddddcccccjjjaaaaa1000011 },
-	{ "fmsub.h", /*          eeeee10dddddcccccjjjaaaaa1000111 */ 0x04000047, 0x0600007f, riscv_rv32zfh_eeeee10dddddcccccjjjaaaaa1000111 },
-	{ "fnmsub.h", /*         eeeee10dddddcccccjjjaaaaa1001011 */ 0x0400004b, 0x0600007f, riscv_rv32zfh_eeeee10dddddcccccjjjaaaaa1001011 },
-	{ "fnmadd.h", /*         eeeee10dddddcccccjjjaaaaa1001111 */ 0x0400004f, 0x0600007f, riscv_rv32zfh_eeeee10dddddcccccjjjaaaaa1001111 },
-	{ "cmix", /*             eeeee11dddddccccc001aaaaa0110011 */ 0x06001033, 0x0600707f, riscv_rv32b_eeeee11dddddccccc001aaaaa0110011 },
-	{ "cmov", /*             eeeee11dddddccccc101aaaaa0110011 */ 0x06005033, 0x0600707f, riscv_rv32b_eeeee11dddddccccc101aaaaa0110011 },
-	{ "fsl", /*              eeeee10dddddccccc001aaaaa0110011 */ 0x04001033, 0x0600707f, riscv_rv32b_eeeee10dddddccccc001aaaaa0110011 },
-	{ "fsr", /*              eeeee10dddddccccc101aaaaa0110011 */ 0x04005033, 0x0600707f, riscv_rv32b_eeeee10dddddccccc101aaaaa0110011 },
-	{ "fslw", /*             eeeee10dddddccccc001aaaaa0111011 */ 0x0400103b, 0x0600707f, riscv_rv64b_eeeee10dddddccccc001aaaaa0111011 },
-	{ "fsrw", /*             eeeee10dddddccccc101aaaaa0111011 */ 0x0400503b, 0x0600707f, riscv_rv64b_eeeee10dddddccccc101aaaaa0111011 },
-	{ "fsriw", /*            eeeee10uuuuuccccc101aaaaa0011011 */ 0x0400501b, 0x0600707f, riscv_rv64b_eeeee10uuuuuccccc101aaaaa0011011 },
-	{ "bpick", /*            eeeee00dddddccccc011aaaaa1110111 */ 0x00003077, 0x0600707f, riscv_rvp_eeeee00dddddccccc011aaaaa1110111 },
-	{ "vluxei8.v", /*        KKK001HGGGGGccccc000DDDDD0000111 */ 0x04000007, 0x1c00707f, riscv_rvv_KKK001HGGGGGccccc000DDDDD0000111 },
-	{ "vluxei16.v", /*       KKK001HGGGGGccccc101DDDDD0000111 */ 0x04005007, 0x1c00707f, riscv_rvv_KKK001HGGGGGccccc101DDDDD0000111 },
-	{ "vluxei32.v", /*       KKK001HGGGGGccccc110DDDDD0000111 */ 0x04006007, 0x1c00707f, riscv_rvv_KKK001HGGGGGccccc110DDDDD0000111 },
-	{ "vluxei64.v", /*       KKK001HGGGGGccccc111DDDDD0000111 */ 0x04007007, 0x1c00707f, riscv_rvv_KKK001HGGGGGccccc111DDDDD0000111 },
-	{ "vluxei128.v", /*      KKK101HGGGGGccccc000DDDDD0000111 */ 0x14000007, 0x1c00707f, riscv_rvv_KKK101HGGGGGccccc000DDDDD0000111 },
-	{ "vluxei256.v", /*      KKK101HGGGGGccccc101DDDDD0000111 */ 0x14005007, 0x1c00707f, riscv_rvv_KKK101HGGGGGccccc101DDDDD0000111 },
-	{ "vluxei512.v", /*      KKK101HGGGGGccccc110DDDDD0000111 */ 0x14006007, 0x1c00707f, riscv_rvv_KKK101HGGGGGccccc110DDDDD0000111 },
-	{ "vluxei1024.v", /*     KKK101HGGGGGccccc111DDDDD0000111 */ 0x14007007, 0x1c00707f, riscv_rvv_KKK101HGGGGGccccc111DDDDD0000111 },
-	{ "vsuxei8.v", /*        KKK001HGGGGGccccc000EEEEE0100111 */ 0x04000027, 0x1c00707f, riscv_rvv_KKK001HGGGGGccccc000EEEEE0100111 },
-	{ "vsuxei16.v", /*       KKK001HGGGGGccccc101EEEEE0100111 */ 0x04005027, 0x1c00707f, riscv_rvv_KKK001HGGGGGccccc101EEEEE0100111 },
-	{ "vsuxei32.v", /*       KKK001HGGGGGccccc110EEEEE0100111 */ 0x04006027, 0x1c00707f, riscv_rvv_KKK001HGGGGGccccc110EEEEE0100111 },
-	{ "vsuxei64.v", /*       KKK001HGGGGGccccc111EEEEE0100111 */ 0x04007027, 0x1c00707f, riscv_rvv_KKK001HGGGGGccccc111EEEEE0100111 },
-	{ "vsuxei128.v", /*      KKK101HGGGGGccccc000EEEEE0100111 */ 0x14000027, 0x1c00707f, riscv_rvv_KKK101HGGGGGccccc000EEEEE0100111 },
-	{ "vsuxei256.v", /*      KKK101HGGGGGccccc101EEEEE0100111 */ 0x14005027, 0x1c00707f, riscv_rvv_KKK101HGGGGGccccc101EEEEE0100111 },
-	{ "vsuxei512.v", /*      KKK101HGGGGGccccc110EEEEE0100111 */ 0x14006027, 0x1c00707f, riscv_rvv_KKK101HGGGGGccccc110EEEEE0100111 },
-	{ "vsuxei1024.v", /*     KKK101HGGGGGccccc111EEEEE0100111 */ 0x14007027, 0x1c00707f, riscv_rvv_KKK101HGGGGGccccc111EEEEE0100111 },
-	{ "vlse8.v", /*          KKK010Hdddddccccc000DDDDD0000111 */ 0x08000007, 0x1c00707f, riscv_rvv_KKK010Hdddddccccc000DDDDD0000111 },
-	{ "vlse16.v", /*         KKK010Hdddddccccc101DDDDD0000111 */ 0x08005007, 0x1c00707f, riscv_rvv_KKK010Hdddddccccc101DDDDD0000111 },
-	{ "vlse32.v", /*         KKK010Hdddddccccc110DDDDD0000111 */ 0x08006007, 0x1c00707f, riscv_rvv_KKK010Hdddddccccc110DDDDD0000111 },
-	{ "vlse64.v", /*         KKK010Hdddddccccc111DDDDD0000111 */ 0x08007007, 0x1c00707f, riscv_rvv_KKK010Hdddddccccc111DDDDD0000111 },
-	{ "vlse128.v", /*        KKK110Hdddddccccc000DDDDD0000111 */ 0x18000007, 0x1c00707f, riscv_rvv_KKK110Hdddddccccc000DDDDD0000111 },
-	{ "vlse256.v", /*        KKK110Hdddddccccc101DDDDD0000111 */ 0x18005007, 0x1c00707f, riscv_rvv_KKK110Hdddddccccc101DDDDD0000111 },
-	{ "vlse512.v", /*        KKK110Hdddddccccc110DDDDD0000111 */ 0x18006007, 0x1c00707f, riscv_rvv_KKK110Hdddddccccc110DDDDD0000111 },
-	{ "vlse1024.v", /*       KKK110Hdddddccccc111DDDDD0000111 */ 0x18007007, 0x1c00707f, riscv_rvv_KKK110Hdddddccccc111DDDDD0000111 },
-	{ "vsse8.v", /*          KKK010Hdddddccccc000EEEEE0100111 */ 0x08000027, 0x1c00707f, riscv_rvv_KKK010Hdddddccccc000EEEEE0100111 },
-	{ "vsse16.v", /*         KKK010Hdddddccccc101EEEEE0100111 */ 0x08005027, 0x1c00707f, riscv_rvv_KKK010Hdddddccccc101EEEEE0100111 },
-	{ "vsse32.v", /*         KKK010Hdddddccccc110EEEEE0100111 */ 0x08006027, 0x1c00707f, riscv_rvv_KKK010Hdddddccccc110EEEEE0100111 },
-	{ "vsse64.v", /*         KKK010Hdddddccccc111EEEEE0100111 */ 0x08007027, 0x1c00707f, riscv_rvv_KKK010Hdddddccccc111EEEEE0100111 },
-	{ "vsse128.v", /*        KKK110Hdddddccccc000EEEEE0100111 */ 0x18000027, 0x1c00707f, riscv_rvv_KKK110Hdddddccccc000EEEEE0100111 },
-	{ "vsse256.v", /*        KKK110Hdddddccccc101EEEEE0100111 */ 0x18005027, 0x1c00707f, riscv_rvv_KKK110Hdddddccccc101EEEEE0100111 },
-	{ "vsse512.v", /*        KKK110Hdddddccccc110EEEEE0100111 */ 0x18006027, 0x1c00707f, riscv_rvv_KKK110Hdddddccccc110EEEEE0100111 },
-	{ "vsse1024.v", /*       KKK110Hdddddccccc111EEEEE0100111 */ 0x18007027, 0x1c00707f, riscv_rvv_KKK110Hdddddccccc111EEEEE0100111 },
-	{ "vloxei8.v", /*        KKK011HGGGGGccccc000DDDDD0000111 */ 0x0c000007, 0x1c00707f, riscv_rvv_KKK011HGGGGGccccc000DDDDD0000111 },
-	{ "vloxei16.v", /*       KKK011HGGGGGccccc101DDDDD0000111 */ 0x0c005007, 0x1c00707f, riscv_rvv_KKK011HGGGGGccccc101DDDDD0000111 },
-	{ "vloxei32.v", /*       KKK011HGGGGGccccc110DDDDD0000111 */ 0x0c006007, 0x1c00707f, riscv_rvv_KKK011HGGGGGccccc110DDDDD0000111 },
-	{ "vloxei64.v", /*       KKK011HGGGGGccccc111DDDDD0000111 */ 0x0c007007, 0x1c00707f, riscv_rvv_KKK011HGGGGGccccc111DDDDD0000111 },
-	{ "vloxei128.v", /*      KKK111HGGGGGccccc000DDDDD0000111 */ 0x1c000007, 0x1c00707f, riscv_rvv_KKK111HGGGGGccccc000DDDDD0000111 },
-	{ "vloxei256.v", /*      KKK111HGGGGGccccc101DDDDD0000111 */ 0x1c005007, 0x1c00707f, riscv_rvv_KKK111HGGGGGccccc101DDDDD0000111 },
-	{ "vloxei512.v", /*      KKK111HGGGGGccccc110DDDDD0000111 */ 0x1c006007, 0x1c00707f, riscv_rvv_KKK111HGGGGGccccc110DDDDD0000111 },
-	{ "vloxei1024.v", /*     KKK111HGGGGGccccc111DDDDD0000111 */ 0x1c007007, 0x1c00707f, riscv_rvv_KKK111HGGGGGccccc111DDDDD0000111 },
-	{ "vsoxei8.v", /*        KKK011HGGGGGccccc000EEEEE0100111 */ 0x0c000027, 0x1c00707f, riscv_rvv_KKK011HGGGGGccccc000EEEEE0100111 },
-	{ "vsoxei16.v", /*       KKK011HGGGGGccccc101EEEEE0100111 */ 0x0c005027, 0x1c00707f, riscv_rvv_KKK011HGGGGGccccc101EEEEE0100111 },
-	{ "vsoxei32.v", /*       KKK011HGGGGGccccc110EEEEE0100111 */ 0x0c006027, 0x1c00707f, riscv_rvv_KKK011HGGGGGccccc110EEEEE0100111 },
-	{ "vsoxei64.v", /*       KKK011HGGGGGccccc111EEEEE0100111 */ 0x0c007027, 0x1c00707f, riscv_rvv_KKK011HGGGGGccccc111EEEEE0100111 },
-	{ "vsoxei128.v", /*      KKK111HGGGGGccccc000EEEEE0100111 */ 0x1c000027, 0x1c00707f, riscv_rvv_KKK111HGGGGGccccc000EEEEE0100111 },
-	{ "vsoxei256.v", /*      KKK111HGGGGGccccc101EEEEE0100111 */ 0x1c005027, 0x1c00707f, riscv_rvv_KKK111HGGGGGccccc101EEEEE0100111 },
-	{ "vsoxei512.v", /*      KKK111HGGGGGccccc110EEEEE0100111 */ 0x1c006027, 0x1c00707f, riscv_rvv_KKK111HGGGGGccccc110EEEEE0100111 },
-	{ "vsoxei1024.v", /*     KKK111HGGGGGccccc111EEEEE0100111 */ 0x1c007027, 0x1c00707f, riscv_rvv_KKK111HGGGGGccccc111EEEEE0100111 },
-	{ "vle8.v", /*           KKK000H00000ccccc000DDDDD0000111 */ 0x00000007, 0x1df0707f, riscv_rvv_KKK000H00000ccccc000DDDDD0000111 },
-	{ "vle16.v", /*          KKK000H00000ccccc101DDDDD0000111 */ 0x00005007, 0x1df0707f, riscv_rvv_KKK000H00000ccccc101DDDDD0000111 },
-	{ "vle32.v", /*          KKK000H00000ccccc110DDDDD0000111 */ 0x00006007, 0x1df0707f, riscv_rvv_KKK000H00000ccccc110DDDDD0000111 },
-	{ "vle64.v", /*          KKK000H00000ccccc111DDDDD0000111 */ 0x00007007, 0x1df0707f, riscv_rvv_KKK000H00000ccccc111DDDDD0000111 },
-	{ "vle128.v", /*         KKK100H00000ccccc000DDDDD0000111 */ 0x10000007, 0x1df0707f, riscv_rvv_KKK100H00000ccccc000DDDDD0000111 },
-	{ "vle256.v", /*         KKK100H00000ccccc101DDDDD0000111 */ 0x10005007, 0x1df0707f, riscv_rvv_KKK100H00000ccccc101DDDDD0000111 },
-	{ "vle512.v", /*         KKK100H00000ccccc110DDDDD0000111 */ 0x10006007, 0x1df0707f, riscv_rvv_KKK100H00000ccccc110DDDDD0000111 },
-	{ "vle1024.v", /*        KKK100H00000ccccc111DDDDD0000111 */ 0x10007007, 0x1df0707f, riscv_rvv_KKK100H00000ccccc111DDDDD0000111 },
-	{ "vse8.v", /*           KKK000H00000ccccc000EEEEE0100111 */ 0x00000027, 0x1df0707f, riscv_rvv_KKK000H00000ccccc000EEEEE0100111 },
-	{ "vse16.v", /*          KKK000H00000ccccc101EEEEE0100111 */ 0x00005027, 0x1df0707f, riscv_rvv_KKK000H00000ccccc101EEEEE0100111 },
-	{ "vse32.v", /*          KKK000H00000ccccc110EEEEE0100111 */ 0x00006027, 0x1df0707f, riscv_rvv_KKK000H00000ccccc110EEEEE0100111 },
-	{ "vse64.v", /*          KKK000H00000ccccc111EEEEE0100111 */ 0x00007027, 0x1df0707f, riscv_rvv_KKK000H00000ccccc111EEEEE0100111 },
-	{ "vse128.v", /*         KKK100H00000ccccc000EEEEE0100111 */ 0x10000027, 0x1df0707f, riscv_rvv_KKK100H00000ccccc000EEEEE0100111 },
-	{ "vse256.v", /*         KKK100H00000ccccc101EEEEE0100111 */ 0x10005027, 0x1df0707f, riscv_rvv_KKK100H00000ccccc101EEEEE0100111 },
-	{ "vse512.v", /*         KKK100H00000ccccc110EEEEE0100111 */ 0x10006027, 0x1df0707f, riscv_rvv_KKK100H00000ccccc110EEEEE0100111 },
-	{ "vse1024.v", /*        KKK100H00000ccccc111EEEEE0100111 */ 0x10007027, 0x1df0707f, riscv_rvv_KKK100H00000ccccc111EEEEE0100111 },
-	{ "vle8ff.v", /*         KKK000H10000ccccc000DDDDD0000111 */ 0x01000007, 0x1df0707f, riscv_rvv_KKK000H10000ccccc000DDDDD0000111 },
-	{ "vle16ff.v", /*        KKK000H10000ccccc101DDDDD0000111 */ 0x01005007, 0x1df0707f, riscv_rvv_KKK000H10000ccccc101DDDDD0000111 },
-	{ "vle32ff.v", /*        KKK000H10000ccccc110DDDDD0000111 */ 0x01006007, 0x1df0707f, riscv_rvv_KKK000H10000ccccc110DDDDD0000111 },
-	{ "vle64ff.v", /*        KKK000H10000ccccc111DDDDD0000111 */ 0x01007007, 0x1df0707f, riscv_rvv_KKK000H10000ccccc111DDDDD0000111 },
-	{ "vle128ff.v", /*       KKK100H10000ccccc000DDDDD0000111 */ 0x11000007, 0x1df0707f, riscv_rvv_KKK100H10000ccccc000DDDDD0000111 },
-	{ "vle256ff.v", /*       KKK100H10000ccccc101DDDDD0000111 */ 0x11005007, 0x1df0707f, riscv_rvv_KKK100H10000ccccc101DDDDD0000111 },
-	{ "vle512ff.v", /*       KKK100H10000ccccc110DDDDD0000111 */ 0x11006007, 0x1df0707f, riscv_rvv_KKK100H10000ccccc110DDDDD0000111 },
-	{ "vle1024ff.v", /*      KKK100H10000ccccc111DDDDD0000111 */ 0x11007007, 0x1df0707f, riscv_rvv_KKK100H10000ccccc111DDDDD0000111 },
-	{ "aes32esmi", /*        vv10011dddddccccc000aaaaa0110011 */ 0x26000033, 0x3e00707f, riscv_rv32k_vv10011dddddccccc000aaaaa0110011 },
-	{ "aes32esi", /*         vv10001dddddccccc000aaaaa0110011 */ 0x22000033, 0x3e00707f, riscv_rv32k_vv10001dddddccccc000aaaaa0110011 },
-	{ "aes32dsmi", /*        vv10111dddddccccc000aaaaa0110011 */ 0x2e000033, 0x3e00707f, riscv_rv32k_vv10111dddddccccc000aaaaa0110011 },
-	{ "aes32dsi", /*         vv10101dddddccccc000aaaaa0110011 */ 0x2a000033, 0x3e00707f, riscv_rv32k_vv10101dddddccccc000aaaaa0110011 },
-	{ "sm4ed", /*            vv11000dddddccccc000aaaaa0110011 */ 0x30000033, 0x3e00707f, riscv_rvk_vv11000dddddccccc000aaaaa0110011 },
-	{ "sm4ks", /*            vv11010dddddccccc000aaaaa0110011 */ 0x34000033, 0x3e00707f, riscv_rvk_vv11010dddddccccc000aaaaa0110011 },
-	{ "vsetvli", /*          0NNNNNNNNNNNccccc111aaaaa1010111 */ 0x00007057, 0x8000707f, riscv_rvv_0NNNNNNNNNNNccccc111aaaaa1010111 },
-	{ "vsetivli", /*         11MMMMMMMMMMsssss111aaaaa1010111 */ 0xc0007057, 0xc000707f, riscv_rvv_11MMMMMMMMMMsssss111aaaaa1010111 },
-	{ "amoadd.w", /*         00000ffdddddccccc010aaaaa0101111 */ 0x0000202f, 0xf800707f, riscv_rv32a_00000ffdddddccccc010aaaaa0101111 },
-	{ "amoxor.w", /*         00100ffdddddccccc010aaaaa0101111 */ 0x2000202f, 0xf800707f, riscv_rv32a_00100ffdddddccccc010aaaaa0101111 },
-	{ "amoor.w", /*          01000ffdddddccccc010aaaaa0101111 */ 0x4000202f, 0xf800707f, riscv_rv32a_01000ffdddddccccc010aaaaa0101111 },
-	{ "amoand.w", /*         01100ffdddddccccc010aaaaa0101111 */ 0x6000202f, 0xf800707f, riscv_rv32a_01100ffdddddccccc010aaaaa0101111 },
-	{ "amomin.w", /*         10000ffdddddccccc010aaaaa0101111 */ 0x8000202f, 0xf800707f, riscv_rv32a_10000ffdddddccccc010aaaaa0101111 },
-	{ "amomax.w", /*         10100ffdddddccccc010aaaaa0101111 */ 0xa000202f, 0xf800707f, riscv_rv32a_10100ffdddddccccc010aaaaa0101111 },
-	{ "amominu.w", /*        11000ffdddddccccc010aaaaa0101111 */ 0xc000202f, 0xf800707f, riscv_rv32a_11000ffdddddccccc010aaaaa0101111 },
-	{ "amomaxu.w", /*        11100ffdddddccccc010aaaaa0101111 */ 0xe000202f, 0xf800707f, riscv_rv32a_11100ffdddddccccc010aaaaa0101111 },
-	{ "amoswap.w", /*        00001ffdddddccccc010aaaaa0101111 */ 0x0800202f, 0xf800707f, riscv_rv32a_00001ffdddddccccc010aaaaa0101111 },
-	{ "sc.w", /*             00011ffdddddccccc010aaaaa0101111 */ 0x1800202f, 0xf800707f, riscv_rv32a_00011ffdddddccccc010aaaaa0101111 },
-	{ "amoadd.d", /*         00000ffdddddccccc011aaaaa0101111 */ 0x0000302f, 0xf800707f, riscv_rv64a_00000ffdddddccccc011aaaaa0101111 },
-	{ "amoxor.d", /*         00100ffdddddccccc011aaaaa0101111 */ 0x2000302f, 0xf800707f, riscv_rv64a_00100ffdddddccccc011aaaaa0101111 },
-	{ "amoor.d", /*          01000ffdddddccccc011aaaaa0101111 */ 0x4000302f, 0xf800707f, riscv_rv64a_01000ffdddddccccc011aaaaa0101111 },
-	{ "amoand.d", /*         01100ffdddddccccc011aaaaa0101111 */ 0x6000302f, 0xf800707f, riscv_rv64a_01100ffdddddccccc011aaaaa0101111 },
-	{ "amomin.d", /*         10000ffdddddccccc011aaaaa0101111 */ 0x8000302f, 0xf800707f, riscv_rv64a_10000ffdddddccccc011aaaaa0101111 },
-	{ "amomax.d", /*         10100ffdddddccccc011aaaaa0101111 */ 0xa000302f, 0xf800707f, riscv_rv64a_10100ffdddddccccc011aaaaa0101111 },
-	{ "amominu.d", /*        11000ffdddddccccc011aaaaa0101111 */ 0xc000302f, 0xf800707f, riscv_rv64a_11000ffdddddccccc011aaaaa0101111 },
-	{ "amomaxu.d", /*        11100ffdddddccccc011aaaaa0101111 */ 0xe000302f, 0xf800707f, riscv_rv64a_11100ffdddddccccc011aaaaa0101111 },
-	{ "amoswap.d", /*        00001ffdddddccccc011aaaaa0101111 */ 0x0800302f, 0xf800707f, riscv_rv64a_00001ffdddddccccc011aaaaa0101111 },
-	{ "sc.d", /*             00011ffdddddccccc011aaaaa0101111 */ 0x1800302f, 0xf800707f, riscv_rv64a_00011ffdddddccccc011aaaaa0101111 },
-	{ "vamoswapei8.v", /*    00001IHGGGGGccccc000DDDDD0101111 */ 0x0800002f, 0xf800707f, riscv_rvv_00001IHGGGGGccccc000DDDDD0101111 },
-	{ "vamoaddei8.v", /*     00000IHGGGGGccccc000DDDDD0101111 */ 0x0000002f, 0xf800707f, riscv_rvv_00000IHGGGGGccccc000DDDDD0101111 },
-	{ "vamoxorei8.v", /*     00100IHGGGGGccccc000DDDDD0101111 */ 0x2000002f, 0xf800707f, riscv_rvv_00100IHGGGGGccccc000DDDDD0101111 },
-	{ "vamoandei8.v", /*     01100IHGGGGGccccc000DDDDD0101111 */ 0x6000002f, 0xf800707f, riscv_rvv_01100IHGGGGGccccc000DDDDD0101111 },
-	{ "vamoorei8.v", /*      01000IHGGGGGccccc000DDDDD0101111 */ 0x4000002f, 0xf800707f, riscv_rvv_01000IHGGGGGccccc000DDDDD0101111 },
-	{ "vamominei8.v", /*     10000IHGGGGGccccc000DDDDD0101111 */ 0x8000002f, 0xf800707f, riscv_rvv_10000IHGGGGGccccc000DDDDD0101111 },
-	{ "vamomaxei8.v", /*     10100IHGGGGGccccc000DDDDD0101111 */ 0xa000002f, 0xf800707f, riscv_rvv_10100IHGGGGGccccc000DDDDD0101111 },
-	{ "vamominuei8.v", /*    11000IHGGGGGccccc000DDDDD0101111 */ 0xc000002f, 0xf800707f, riscv_rvv_11000IHGGGGGccccc000DDDDD0101111 },
-	{ "vamomaxuei8.v", /*    11100IHGGGGGccccc000DDDDD0101111 */ 0xe000002f, 0xf800707f, riscv_rvv_11100IHGGGGGccccc000DDDDD0101111 },
-	{ "vamoswapei16.v", /*   00001IHGGGGGccccc101DDDDD0101111 */ 0x0800502f, 0xf800707f, riscv_rvv_00001IHGGGGGccccc101DDDDD0101111 },
-	{ "vamoaddei16.v", /*    00000IHGGGGGccccc101DDDDD0101111 */ 0x0000502f, 0xf800707f, riscv_rvv_00000IHGGGGGccccc101DDDDD0101111 },
-	{ "vamoxorei16.v", /*    00100IHGGGGGccccc101DDDDD0101111 */ 0x2000502f, 0xf800707f, riscv_rvv_00100IHGGGGGccccc101DDDDD0101111 },
-	{ "vamoandei16.v", /*    01100IHGGGGGccccc101DDDDD0101111 */ 0x6000502f, 0xf800707f, riscv_rvv_01100IHGGGGGccccc101DDDDD0101111 },
-	{ "vamoorei16.v", /*     01000IHGGGGGccccc101DDDDD0101111 */ 0x4000502f, 0xf800707f, riscv_rvv_01000IHGGGGGccccc101DDDDD0101111 },
-	{ "vamominei16.v", /*    10000IHGGGGGccccc101DDDDD0101111 */ 0x8000502f, 0xf800707f, riscv_rvv_10000IHGGGGGccccc101DDDDD0101111 },
-	{ "vamomaxei16.v", /*    10100IHGGGGGccccc101DDDDD0101111 */ 0xa000502f, 0xf800707f, riscv_rvv_10100IHGGGGGccccc101DDDDD0101111 },
-	{ "vamominuei16.v", /*   11000IHGGGGGccccc101DDDDD0101111 */ 0xc000502f, 0xf800707f, riscv_rvv_11000IHGGGGGccccc101DDDDD0101111 },
-	{ "vamomaxuei16.v", /*   11100IHGGGGGccccc101DDDDD0101111 */ 0xe000502f, 0xf800707f, riscv_rvv_11100IHGGGGGccccc101DDDDD0101111 },
-	{ "vamoswapei32.v", /*   00001IHGGGGGccccc110DDDDD0101111 */ 0x0800602f, 0xf800707f, riscv_rvv_00001IHGGGGGccccc110DDDDD0101111 },
-	{ "vamoaddei32.v", /*    00000IHGGGGGccccc110DDDDD0101111 */ 0x0000602f, 0xf800707f, riscv_rvv_00000IHGGGGGccccc110DDDDD0101111 },
-	{ "vamoxorei32.v", /*    00100IHGGGGGccccc110DDDDD0101111 */ 0x2000602f, 0xf800707f, riscv_rvv_00100IHGGGGGccccc110DDDDD0101111 },
-	{ "vamoandei32.v", /*    01100IHGGGGGccccc110DDDDD0101111 */ 0x6000602f, 0xf800707f, riscv_rvv_01100IHGGGGGccccc110DDDDD0101111 },
-	{ "vamoorei32.v", /*     01000IHGGGGGccccc110DDDDD0101111 */ 0x4000602f, 0xf800707f, riscv_rvv_01000IHGGGGGccccc110DDDDD0101111 },
-	{ "vamominei32.v", /*    10000IHGGGGGccccc110DDDDD0101111 */ 0x8000602f, 0xf800707f, riscv_rvv_10000IHGGGGGccccc110DDDDD0101111 },
-	{ "vamomaxei32.v", /*    10100IHGGGGGccccc110DDDDD0101111 */ 0xa000602f, 0xf800707f, riscv_rvv_10100IHGGGGGccccc110DDDDD0101111 },
-	{ "vamominuei32.v", /*   11000IHGGGGGccccc110DDDDD0101111 */ 0xc000602f, 0xf800707f, riscv_rvv_11000IHGGGGGccccc110DDDDD0101111 },
-	{ "vamomaxuei32.v", /*   11100IHGGGGGccccc110DDDDD0101111 */ 0xe000602f, 0xf800707f, riscv_rvv_11100IHGGGGGccccc110DDDDD0101111 },
-	{ "vamoswapei64.v", /*   00001IHGGGGGccccc111DDDDD0101111 */ 0x0800702f, 0xf800707f, riscv_rvv_00001IHGGGGGccccc111DDDDD0101111 },
-	{ "vamoaddei64.v", /*    00000IHGGGGGccccc111DDDDD0101111 */ 0x0000702f, 0xf800707f, riscv_rvv_00000IHGGGGGccccc111DDDDD0101111 },
-	{ "vamoxorei64.v", /*    00100IHGGGGGccccc111DDDDD0101111 */ 0x2000702f, 0xf800707f, riscv_rvv_00100IHGGGGGccccc111DDDDD0101111 },
-	{ "vamoandei64.v", /*    01100IHGGGGGccccc111DDDDD0101111 */ 0x6000702f, 0xf800707f, riscv_rvv_01100IHGGGGGccccc111DDDDD0101111 },
-	{ "vamoorei64.v", /*     01000IHGGGGGccccc111DDDDD0101111 */ 0x4000702f, 0xf800707f, riscv_rvv_01000IHGGGGGccccc111DDDDD0101111 },
-	{ "vamominei64.v", /*    10000IHGGGGGccccc111DDDDD0101111 */ 0x8000702f, 0xf800707f, riscv_rvv_10000IHGGGGGccccc111DDDDD0101111 },
-	{ "vamomaxei64.v", /*    10100IHGGGGGccccc111DDDDD0101111 */ 0xa000702f, 0xf800707f, riscv_rvv_10100IHGGGGGccccc111DDDDD0101111 },
-	{ "vamominuei64.v", /*   11000IHGGGGGccccc111DDDDD0101111 */ 0xc000702f, 0xf800707f, riscv_rvv_11000IHGGGGGccccc111DDDDD0101111 },
-	{ "vamomaxuei64.v", /*   11100IHGGGGGccccc111DDDDD0101111 */ 0xe000702f, 0xf800707f, riscv_rvv_11100IHGGGGGccccc111DDDDD0101111 },
-	{ "lr.w", /*             00010ff00000ccccc010aaaaa0101111 */ 0x1000202f, 0xf9f0707f, riscv_rv32a_00010ff00000ccccc010aaaaa0101111 },
-	{ "lr.d", /*             00010ff00000ccccc011aaaaa0101111 */ 0x1000302f, 0xf9f0707f, riscv_rv64a_00010ff00000ccccc011aaaaa0101111 },
-	{ "sloi", /*             001000ttttttccccc001aaaaa0010011 */ 0x20001013, 0xfc00707f, riscv_rv32b_001000ttttttccccc001aaaaa0010011 },
-	{ "sroi", /*             001000ttttttccccc101aaaaa0010011 */ 0x20005013, 0xfc00707f, riscv_rv32b_001000ttttttccccc101aaaaa0010011 },
-	{ "rori", /*             011000ttttttccccc101aaaaa0010011 */ 0x60005013, 0xfc00707f, riscv_rv32b_011000ttttttccccc101aaaaa0010011 },
-	{ "bclri", /*            010010ttttttccccc001aaaaa0010011 */ 0x48001013, 0xfc00707f, riscv_rv32b_010010ttttttccccc001aaaaa0010011 },
-	{ "bseti", /*            001010ttttttccccc001aaaaa0010011 */ 0x28001013, 0xfc00707f, riscv_rv32b_001010ttttttccccc001aaaaa0010011 },
-	{ "binvi", /*            011010ttttttccccc001aaaaa0010011 */ 0x68001013, 0xfc00707f, riscv_rv32b_011010ttttttccccc001aaaaa0010011 },
-	{ "bexti", /*            010010ttttttccccc101aaaaa0010011 */ 0x48005013, 0xfc00707f, riscv_rv32b_010010ttttttccccc101aaaaa0010011 },
-	{ "gorci", /*            001010ttttttccccc101aaaaa0010011 */ 0x28005013, 0xfc00707f, riscv_rv32b_001010ttttttccccc101aaaaa0010011 },
-	{ "grevi", /*            011010ttttttccccc101aaaaa0010011 */ 0x68005013, 0xfc00707f, riscv_rv32b_011010ttttttccccc101aaaaa0010011 },
-	{ "slli.uw", /*          000010ttttttccccc001aaaaa0011011 */ 0x0800101b, 0xfc00707f, riscv_rv64b_000010ttttttccccc001aaaaa0011011 },
-	{ "slli", /*             000000ttttttccccc001aaaaa0010011 */ 0x00001013, 0xfc00707f, riscv_rv64i_000000ttttttccccc001aaaaa0010011 },
-	{ "srli", /*             000000ttttttccccc101aaaaa0010011 */ 0x00005013, 0xfc00707f, riscv_rv64i_000000ttttttccccc101aaaaa0010011 },
-	{ "srai", /*             010000ttttttccccc101aaaaa0010011 */ 0x40005013, 0xfc00707f, riscv_rv64i_010000ttttttccccc101aaaaa0010011 },
-	{ "bitrevi", /*          111010CCCCCCccccc000aaaaa1110111 */ 0xe8000077, 0xfc00707f, riscv_rvp_111010CCCCCCccccc000aaaaa1110111 },
-	{ "srai.u", /*           110101CCCCCCccccc001aaaaa1110111 */ 0xd4001077, 0xfc00707f, riscv_rvp_110101CCCCCCccccc001aaaaa1110111 },
-	{ "vfadd.vf", /*         000000HGGGGGccccc101DDDDD1010111 */ 0x00005057, 0xfc00707f, riscv_rvv_000000HGGGGGccccc101DDDDD1010111 },
-	{ "vfsub.vf", /*         000010HGGGGGccccc101DDDDD1010111 */ 0x08005057, 0xfc00707f, riscv_rvv_000010HGGGGGccccc101DDDDD1010111 },
-	{ "vfmin.vf", /*         000100HGGGGGccccc101DDDDD1010111 */ 0x10005057, 0xfc00707f, riscv_rvv_000100HGGGGGccccc101DDDDD1010111 },
-	{ "vfmax.vf", /*         000110HGGGGGccccc101DDDDD1010111 */ 0x18005057, 0xfc00707f, riscv_rvv_000110HGGGGGccccc101DDDDD1010111 },
-	{ "vfsgnj.vf", /*        001000HGGGGGccccc101DDDDD1010111 */ 0x20005057, 0xfc00707f, riscv_rvv_001000HGGGGGccccc101DDDDD1010111 },
-	{ "vfsgnjn.vf", /*       001001HGGGGGccccc101DDDDD1010111 */ 0x24005057, 0xfc00707f, riscv_rvv_001001HGGGGGccccc101DDDDD1010111 },
-	{ "vfsgnjx.vf", /*       001010HGGGGGccccc101DDDDD1010111 */ 0x28005057, 0xfc00707f, riscv_rvv_001010HGGGGGccccc101DDDDD1010111 },
-	{ "vfslide1up.vf", /*    001110HGGGGGccccc101DDDDD1010111 */ 0x38005057, 0xfc00707f, riscv_rvv_001110HGGGGGccccc101DDDDD1010111 },
-	{ "vfslide1down.vf", /*  001111HGGGGGccccc101DDDDD1010111 */ 0x3c005057, 0xfc00707f, riscv_rvv_001111HGGGGGccccc101DDDDD1010111 },
-	{ "vmfeq.vf", /*         011000HGGGGGccccc101DDDDD1010111 */ 0x60005057, 0xfc00707f, riscv_rvv_011000HGGGGGccccc101DDDDD1010111 },
-	{ "vmfle.vf", /*         011001HGGGGGccccc101DDDDD1010111 */ 0x64005057, 0xfc00707f, riscv_rvv_011001HGGGGGccccc101DDDDD1010111 },
-	{ "vmflt.vf", /*         011011HGGGGGccccc101DDDDD1010111 */ 0x6c005057, 0xfc00707f, riscv_rvv_011011HGGGGGccccc101DDDDD1010111 },
-	{ "vmfne.vf", /*         011100HGGGGGccccc101DDDDD1010111 */ 0x70005057, 0xfc00707f, riscv_rvv_011100HGGGGGccccc101DDDDD1010111 },
-	{ "vmfgt.vf", /*         011101HGGGGGccccc101DDDDD1010111 */ 0x74005057, 0xfc00707f, riscv_rvv_011101HGGGGGccccc101DDDDD1010111 },
-	{ "vmfge.vf", /*         011111HGGGGGccccc101DDDDD1010111 */ 0x7c005057, 0xfc00707f, riscv_rvv_011111HGGGGGccccc101DDDDD1010111 },
-	{ "vfdiv.vf", /*         100000HGGGGGccccc101DDDDD1010111 */ 0x80005057, 0xfc00707f, riscv_rvv_100000HGGGGGccccc101DDDDD1010111 },
-	{ "vfrdiv.vf", /*        100001HGGGGGccccc101DDDDD1010111 */ 0x84005057, 0xfc00707f, riscv_rvv_100001HGGGGGccccc101DDDDD1010111 },
-	{ "vfmul.vf", /*         100100HGGGGGccccc101DDDDD1010111 */ 0x90005057, 0xfc00707f, riscv_rvv_100100HGGGGGccccc101DDDDD1010111 },
-	{ "vfrsub.vf", /*        100111HGGGGGccccc101DDDDD1010111 */ 0x9c005057, 0xfc00707f, riscv_rvv_100111HGGGGGccccc101DDDDD1010111 },
-	{ "vfmadd.vf", /*        101000HGGGGGccccc101DDDDD1010111 */ 0xa0005057, 0xfc00707f, riscv_rvv_101000HGGGGGccccc101DDDDD1010111 },
-	{ "vfnmadd.vf", /*       101001HGGGGGccccc101DDDDD1010111 */ 0xa4005057, 0xfc00707f, riscv_rvv_101001HGGGGGccccc101DDDDD1010111 },
-	{ "vfmsub.vf", /*        101010HGGGGGccccc101DDDDD1010111 */ 0xa8005057, 0xfc00707f, riscv_rvv_101010HGGGGGccccc101DDDDD1010111 },
-	{ "vfnmsub.vf", /*       101011HGGGGGccccc101DDDDD1010111 */ 0xac005057, 0xfc00707f, riscv_rvv_101011HGGGGGccccc101DDDDD1010111 },
-	{ "vfmacc.vf", /*        101100HGGGGGccccc101DDDDD1010111 */ 0xb0005057, 0xfc00707f, riscv_rvv_101100HGGGGGccccc101DDDDD1010111 },
-	{ "vfnmacc.vf", /*       101101HGGGGGccccc101DDDDD1010111 */ 0xb4005057, 0xfc00707f, riscv_rvv_101101HGGGGGccccc101DDDDD1010111 },
-	{ "vfmsac.vf", /*        101110HGGGGGccccc101DDDDD1010111 */ 0xb8005057, 0xfc00707f, riscv_rvv_101110HGGGGGccccc101DDDDD1010111 },
-	{ "vfnmsac.vf", /*       101111HGGGGGccccc101DDDDD1010111 */ 0xbc005057, 0xfc00707f, riscv_rvv_101111HGGGGGccccc101DDDDD1010111 },
-	{ "vfwadd.vf", /*        110000HGGGGGccccc101DDDDD1010111 */ 0xc0005057, 0xfc00707f, riscv_rvv_110000HGGGGGccccc101DDDDD1010111 },
-	{ "vfwsub.vf", /*        110010HGGGGGccccc101DDDDD1010111 */ 0xc8005057, 0xfc00707f, riscv_rvv_110010HGGGGGccccc101DDDDD1010111 },
-	{ "vfwadd.wf", /*        110100HGGGGGccccc101DDDDD1010111 */ 0xd0005057, 0xfc00707f, riscv_rvv_110100HGGGGGccccc101DDDDD1010111 },
-	{ "vfwsub.wf", /*        110110HGGGGGccccc101DDDDD1010111 */ 0xd8005057, 0xfc00707f, riscv_rvv_110110HGGGGGccccc101DDDDD1010111 },
-	{ "vfwmul.vf", /*        111000HGGGGGccccc101DDDDD1010111 */ 0xe0005057, 0xfc00707f, riscv_rvv_111000HGGGGGccccc101DDDDD1010111 },
-	{ "vfwmacc.vf", /*       111100HGGGGGccccc101DDDDD1010111 */ 0xf0005057, 0xfc00707f, riscv_rvv_111100HGGGGGccccc101DDDDD1010111 },
-	{ "vfwnmacc.vf", /*      111101HGGGGGccccc101DDDDD1010111 */ 0xf4005057, 0xfc00707f, riscv_rvv_111101HGGGGGccccc101DDDDD1010111 },
-	{ "vfwmsac.vf", /*       111110HGGGGGccccc101DDDDD1010111 */ 0xf8005057, 0xfc00707f, riscv_rvv_111110HGGGGGccccc101DDDDD1010111 },
-	{ "vfwnmsac.vf", /*      111111HGGGGGccccc101DDDDD1010111 */ 0xfc005057, 0xfc00707f, riscv_rvv_111111HGGGGGccccc101DDDDD1010111 },
-	{ "vfadd.vv", /*         000000HGGGGGFFFFF001DDDDD1010111 */ 0x00001057, 0xfc00707f, riscv_rvv_000000HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfredusum.vs", /*     000001HGGGGGFFFFF001DDDDD1010111 */ 0x04001057, 0xfc00707f, riscv_rvv_000001HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfsub.vv", /*         000010HGGGGGFFFFF001DDDDD1010111 */ 0x08001057, 0xfc00707f, riscv_rvv_000010HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfredosum.vs", /*     000011HGGGGGFFFFF001DDDDD1010111 */ 0x0c001057, 0xfc00707f, riscv_rvv_000011HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfmin.vv", /*         000100HGGGGGFFFFF001DDDDD1010111 */ 0x10001057, 0xfc00707f, riscv_rvv_000100HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfredmin.vs", /*      000101HGGGGGFFFFF001DDDDD1010111 */ 0x14001057, 0xfc00707f, riscv_rvv_000101HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfmax.vv", /*         000110HGGGGGFFFFF001DDDDD1010111 */ 0x18001057, 0xfc00707f, riscv_rvv_000110HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfredmax.vs", /*      000111HGGGGGFFFFF001DDDDD1010111 */ 0x1c001057, 0xfc00707f, riscv_rvv_000111HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfsgnj.vv", /*        001000HGGGGGFFFFF001DDDDD1010111 */ 0x20001057, 0xfc00707f, riscv_rvv_001000HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfsgnjn.vv", /*       001001HGGGGGFFFFF001DDDDD1010111 */ 0x24001057, 0xfc00707f, riscv_rvv_001001HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfsgnjx.vv", /*       001010HGGGGGFFFFF001DDDDD1010111 */ 0x28001057, 0xfc00707f, riscv_rvv_001010HGGGGGFFFFF001DDDDD1010111 },
-	{ "vmfeq.vv", /*         011000HGGGGGFFFFF001DDDDD1010111 */ 0x60001057, 0xfc00707f, riscv_rvv_011000HGGGGGFFFFF001DDDDD1010111 },
-	{ "vmfle.vv", /*         011001HGGGGGFFFFF001DDDDD1010111 */ 0x64001057, 0xfc00707f, riscv_rvv_011001HGGGGGFFFFF001DDDDD1010111 },
-	{ "vmflt.vv", /*         011011HGGGGGFFFFF001DDDDD1010111 */ 0x6c001057, 0xfc00707f, riscv_rvv_011011HGGGGGFFFFF001DDDDD1010111 },
-	{ "vmfne.vv", /*         011100HGGGGGFFFFF001DDDDD1010111 */ 0x70001057, 0xfc00707f, riscv_rvv_011100HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfdiv.vv", /*         100000HGGGGGFFFFF001DDDDD1010111 */ 0x80001057, 0xfc00707f, riscv_rvv_100000HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfmul.vv", /*         100100HGGGGGFFFFF001DDDDD1010111 */ 0x90001057, 0xfc00707f, riscv_rvv_100100HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfmadd.vv", /*        101000HGGGGGFFFFF001DDDDD1010111 */ 0xa0001057, 0xfc00707f, riscv_rvv_101000HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfnmadd.vv", /*       101001HGGGGGFFFFF001DDDDD1010111 */ 0xa4001057, 0xfc00707f, riscv_rvv_101001HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfmsub.vv", /*        101010HGGGGGFFFFF001DDDDD1010111 */ 0xa8001057, 0xfc00707f, riscv_rvv_101010HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfnmsub.vv", /*       101011HGGGGGFFFFF001DDDDD1010111 */ 0xac001057, 0xfc00707f, riscv_rvv_101011HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfmacc.vv", /*        101100HGGGGGFFFFF001DDDDD1010111 */ 0xb0001057, 0xfc00707f, riscv_rvv_101100HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfnmacc.vv", /*       101101HGGGGGFFFFF001DDDDD1010111 */ 0xb4001057, 0xfc00707f, riscv_rvv_101101HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfmsac.vv", /*        101110HGGGGGFFFFF001DDDDD1010111 */ 0xb8001057, 0xfc00707f, riscv_rvv_101110HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfnmsac.vv", /*       101111HGGGGGFFFFF001DDDDD1010111 */ 0xbc001057, 0xfc00707f, riscv_rvv_101111HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfwadd.vv", /*        110000HGGGGGFFFFF001DDDDD1010111 */ 0xc0001057, 0xfc00707f, riscv_rvv_110000HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfwredusum.vs", /*    110001HGGGGGFFFFF001DDDDD1010111 */ 0xc4001057, 0xfc00707f, riscv_rvv_110001HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfwsub.vv", /*        110010HGGGGGFFFFF001DDDDD1010111 */ 0xc8001057, 0xfc00707f, riscv_rvv_110010HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfwredosum.vs", /*    110011HGGGGGFFFFF001DDDDD1010111 */ 0xcc001057, 0xfc00707f, riscv_rvv_110011HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfwadd.wv", /*        110100HGGGGGFFFFF001DDDDD1010111 */ 0xd0001057, 0xfc00707f, riscv_rvv_110100HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfwsub.wv", /*        110110HGGGGGFFFFF001DDDDD1010111 */ 0xd8001057, 0xfc00707f, riscv_rvv_110110HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfwmul.vv", /*        111000HGGGGGFFFFF001DDDDD1010111 */ 0xe0001057, 0xfc00707f, riscv_rvv_111000HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfwmacc.vv", /*       111100HGGGGGFFFFF001DDDDD1010111 */ 0xf0001057, 0xfc00707f, riscv_rvv_111100HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfwnmacc.vv", /*      111101HGGGGGFFFFF001DDDDD1010111 */ 0xf4001057, 0xfc00707f, riscv_rvv_111101HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfwmsac.vv", /*       111110HGGGGGFFFFF001DDDDD1010111 */ 0xf8001057, 0xfc00707f, riscv_rvv_111110HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfwnmsac.vv", /*      111111HGGGGGFFFFF001DDDDD1010111 */ 0xfc001057, 0xfc00707f, riscv_rvv_111111HGGGGGFFFFF001DDDDD1010111 },
-	{ "vadd.vx", /*          000000HGGGGGccccc100DDDDD1010111 */ 0x00004057, 0xfc00707f, riscv_rvv_000000HGGGGGccccc100DDDDD1010111 },
-	{ "vsub.vx", /*          000010HGGGGGccccc100DDDDD1010111 */ 0x08004057, 0xfc00707f, riscv_rvv_000010HGGGGGccccc100DDDDD1010111 },
-	{ "vrsub.vx", /*         000011HGGGGGccccc100DDDDD1010111 */ 0x0c004057, 0xfc00707f, riscv_rvv_000011HGGGGGccccc100DDDDD1010111 },
-	{ "vminu.vx", /*         000100HGGGGGccccc100DDDDD1010111 */ 0x10004057, 0xfc00707f, riscv_rvv_000100HGGGGGccccc100DDDDD1010111 },
-	{ "vmin.vx", /*          000101HGGGGGccccc100DDDDD1010111 */ 0x14004057, 0xfc00707f, riscv_rvv_000101HGGGGGccccc100DDDDD1010111 },
-	{ "vmaxu.vx", /*         000110HGGGGGccccc100DDDDD1010111 */ 0x18004057, 0xfc00707f, riscv_rvv_000110HGGGGGccccc100DDDDD1010111 },
-	{ "vmax.vx", /*          000111HGGGGGccccc100DDDDD1010111 */ 0x1c004057, 0xfc00707f, riscv_rvv_000111HGGGGGccccc100DDDDD1010111 },
-	{ "vand.vx", /*          001001HGGGGGccccc100DDDDD1010111 */ 0x24004057, 0xfc00707f, riscv_rvv_001001HGGGGGccccc100DDDDD1010111 },
-	{ "vor.vx", /*           001010HGGGGGccccc100DDDDD1010111 */ 0x28004057, 0xfc00707f, riscv_rvv_001010HGGGGGccccc100DDDDD1010111 },
-	{ "vxor.vx", /*          001011HGGGGGccccc100DDDDD1010111 */ 0x2c004057, 0xfc00707f, riscv_rvv_001011HGGGGGccccc100DDDDD1010111 },
-	{ "vrgather.vx", /*      001100HGGGGGccccc100DDDDD1010111 */ 0x30004057, 0xfc00707f, riscv_rvv_001100HGGGGGccccc100DDDDD1010111 },
-	{ "vslideup.vx", /*      001110HGGGGGccccc100DDDDD1010111 */ 0x38004057, 0xfc00707f, riscv_rvv_001110HGGGGGccccc100DDDDD1010111 },
-	{ "vslidedown.vx", /*    001111HGGGGGccccc100DDDDD1010111 */ 0x3c004057, 0xfc00707f, riscv_rvv_001111HGGGGGccccc100DDDDD1010111 },
-	{ "vmseq.vx", /*         011000HGGGGGccccc100DDDDD1010111 */ 0x60004057, 0xfc00707f, riscv_rvv_011000HGGGGGccccc100DDDDD1010111 },
-	{ "vmsne.vx", /*         011001HGGGGGccccc100DDDDD1010111 */ 0x64004057, 0xfc00707f, riscv_rvv_011001HGGGGGccccc100DDDDD1010111 },
-	{ "vmsltu.vx", /*        011010HGGGGGccccc100DDDDD1010111 */ 0x68004057, 0xfc00707f, riscv_rvv_011010HGGGGGccccc100DDDDD1010111 },
-	{ "vmslt.vx", /*         011011HGGGGGccccc100DDDDD1010111 */ 0x6c004057, 0xfc00707f, riscv_rvv_011011HGGGGGccccc100DDDDD1010111 },
-	{ "vmsleu.vx", /*        011100HGGGGGccccc100DDDDD1010111 */ 0x70004057, 0xfc00707f, riscv_rvv_011100HGGGGGccccc100DDDDD1010111 },
-	{ "vmsle.vx", /*         011101HGGGGGccccc100DDDDD1010111 */ 0x74004057, 0xfc00707f, riscv_rvv_011101HGGGGGccccc100DDDDD1010111 },
-	{ "vmsgtu.vx", /*        011110HGGGGGccccc100DDDDD1010111 */ 0x78004057, 0xfc00707f, riscv_rvv_011110HGGGGGccccc100DDDDD1010111 },
-	{ "vmsgt.vx", /*         011111HGGGGGccccc100DDDDD1010111 */ 0x7c004057, 0xfc00707f, riscv_rvv_011111HGGGGGccccc100DDDDD1010111 },
-	{ "vsaddu.vx", /*        100000HGGGGGccccc100DDDDD1010111 */ 0x80004057, 0xfc00707f, riscv_rvv_100000HGGGGGccccc100DDDDD1010111 },
-	{ "vsadd.vx", /*         100001HGGGGGccccc100DDDDD1010111 */ 0x84004057, 0xfc00707f, riscv_rvv_100001HGGGGGccccc100DDDDD1010111 },
-	{ "vssubu.vx", /*        100010HGGGGGccccc100DDDDD1010111 */ 0x88004057, 0xfc00707f, riscv_rvv_100010HGGGGGccccc100DDDDD1010111 },
-	{ "vssub.vx", /*         100011HGGGGGccccc100DDDDD1010111 */ 0x8c004057, 0xfc00707f, riscv_rvv_100011HGGGGGccccc100DDDDD1010111 },
-	{ "vsll.vx", /*          100101HGGGGGccccc100DDDDD1010111 */ 0x94004057, 0xfc00707f, riscv_rvv_100101HGGGGGccccc100DDDDD1010111 },
-	{ "vsmul.vx", /*         100111HGGGGGccccc100DDDDD1010111 */ 0x9c004057, 0xfc00707f, riscv_rvv_100111HGGGGGccccc100DDDDD1010111 },
-	{ "vsrl.vx", /*          101000HGGGGGccccc100DDDDD1010111 */ 0xa0004057, 0xfc00707f, riscv_rvv_101000HGGGGGccccc100DDDDD1010111 },
-	{ "vsra.vx", /*          101001HGGGGGccccc100DDDDD1010111 */ 0xa4004057, 0xfc00707f, riscv_rvv_101001HGGGGGccccc100DDDDD1010111 },
-	{ "vssrl.vx", /*         101010HGGGGGccccc100DDDDD1010111 */ 0xa8004057, 0xfc00707f, riscv_rvv_101010HGGGGGccccc100DDDDD1010111 },
-	{ "vssra.vx", /*         101011HGGGGGccccc100DDDDD1010111 */ 0xac004057, 0xfc00707f, riscv_rvv_101011HGGGGGccccc100DDDDD1010111 },
-	{ "vnsrl.wx", /*         101100HGGGGGccccc100DDDDD1010111 */ 0xb0004057, 0xfc00707f, riscv_rvv_101100HGGGGGccccc100DDDDD1010111 },
-	{ "vnsra.wx", /*         101101HGGGGGccccc100DDDDD1010111 */ 0xb4004057, 0xfc00707f, riscv_rvv_101101HGGGGGccccc100DDDDD1010111 },
-	{ "vnclipu.wx", /*       101110HGGGGGccccc100DDDDD1010111 */ 0xb8004057, 0xfc00707f, riscv_rvv_101110HGGGGGccccc100DDDDD1010111 },
-	{ "vnclip.wx", /*        101111HGGGGGccccc100DDDDD1010111 */ 0xbc004057, 0xfc00707f, riscv_rvv_101111HGGGGGccccc100DDDDD1010111 },
-	{ "vadd.vv", /*          000000HGGGGGFFFFF000DDDDD1010111 */ 0x00000057, 0xfc00707f, riscv_rvv_000000HGGGGGFFFFF000DDDDD1010111 },
-	{ "vsub.vv", /*          000010HGGGGGFFFFF000DDDDD1010111 */ 0x08000057, 0xfc00707f, riscv_rvv_000010HGGGGGFFFFF000DDDDD1010111 },
-	{ "vminu.vv", /*         000100HGGGGGFFFFF000DDDDD1010111 */ 0x10000057, 0xfc00707f, riscv_rvv_000100HGGGGGFFFFF000DDDDD1010111 },
-	{ "vmin.vv", /*          000101HGGGGGFFFFF000DDDDD1010111 */ 0x14000057, 0xfc00707f, riscv_rvv_000101HGGGGGFFFFF000DDDDD1010111 },
-	{ "vmaxu.vv", /*         000110HGGGGGFFFFF000DDDDD1010111 */ 0x18000057, 0xfc00707f, riscv_rvv_000110HGGGGGFFFFF000DDDDD1010111 },
-	{ "vmax.vv", /*          000111HGGGGGFFFFF000DDDDD1010111 */ 0x1c000057, 0xfc00707f, riscv_rvv_000111HGGGGGFFFFF000DDDDD1010111 },
-	{ "vand.vv", /*          001001HGGGGGFFFFF000DDDDD1010111 */ 0x24000057, 0xfc00707f, riscv_rvv_001001HGGGGGFFFFF000DDDDD1010111 },
-	{ "vor.vv", /*           001010HGGGGGFFFFF000DDDDD1010111 */ 0x28000057, 0xfc00707f, riscv_rvv_001010HGGGGGFFFFF000DDDDD1010111 },
-	{ "vxor.vv", /*          001011HGGGGGFFFFF000DDDDD1010111 */ 0x2c000057, 0xfc00707f, riscv_rvv_001011HGGGGGFFFFF000DDDDD1010111 },
-	{ "vrgather.vv", /*      001100HGGGGGFFFFF000DDDDD1010111 */ 0x30000057, 0xfc00707f, riscv_rvv_001100HGGGGGFFFFF000DDDDD1010111 },
-	{ "vrgatherei16.vv", /*  001110HGGGGGFFFFF000DDDDD1010111 */ 0x38000057, 0xfc00707f, riscv_rvv_001110HGGGGGFFFFF000DDDDD1010111 },
-	{ "vmseq.vv", /*         011000HGGGGGFFFFF000DDDDD1010111 */ 0x60000057, 0xfc00707f, riscv_rvv_011000HGGGGGFFFFF000DDDDD1010111 },
-	{ "vmsne.vv", /*         011001HGGGGGFFFFF000DDDDD1010111 */ 0x64000057, 0xfc00707f, riscv_rvv_011001HGGGGGFFFFF000DDDDD1010111 },
-	{ "vmsltu.vv", /*        011010HGGGGGFFFFF000DDDDD1010111 */ 0x68000057, 0xfc00707f, riscv_rvv_011010HGGGGGFFFFF000DDDDD1010111 },
-	{ "vmslt.vv", /*         011011HGGGGGFFFFF000DDDDD1010111 */ 0x6c000057, 0xfc00707f, riscv_rvv_011011HGGGGGFFFFF000DDDDD1010111 },
-	{ "vmsleu.vv", /*        011100HGGGGGFFFFF000DDDDD1010111 */ 0x70000057, 0xfc00707f, riscv_rvv_011100HGGGGGFFFFF000DDDDD1010111 },
-	{ "vmsle.vv", /*         011101HGGGGGFFFFF000DDDDD1010111 */ 0x74000057, 0xfc00707f, riscv_rvv_011101HGGGGGFFFFF000DDDDD1010111 },
-	{ "vsaddu.vv", /*        100000HGGGGGFFFFF000DDDDD1010111 */ 0x80000057, 0xfc00707f, riscv_rvv_100000HGGGGGFFFFF000DDDDD1010111 },
-	{ "vsadd.vv", /*         100001HGGGGGFFFFF000DDDDD1010111 */ 0x84000057, 0xfc00707f, riscv_rvv_100001HGGGGGFFFFF000DDDDD1010111 },
-	{ "vssubu.vv", /*        100010HGGGGGFFFFF000DDDDD1010111 */ 0x88000057, 0xfc00707f, riscv_rvv_100010HGGGGGFFFFF000DDDDD1010111 },
-	{ "vssub.vv", /*         100011HGGGGGFFFFF000DDDDD1010111 */ 0x8c000057, 0xfc00707f, riscv_rvv_100011HGGGGGFFFFF000DDDDD1010111 },
-	{ "vsll.vv", /*          100101HGGGGGFFFFF000DDDDD1010111 */ 0x94000057, 0xfc00707f, riscv_rvv_100101HGGGGGFFFFF000DDDDD1010111 },
-	{ "vsmul.vv", /*         100111HGGGGGFFFFF000DDDDD1010111 */ 0x9c000057, 0xfc00707f, riscv_rvv_100111HGGGGGFFFFF000DDDDD1010111 },
-	{ "vsrl.vv", /*          101000HGGGGGFFFFF000DDDDD1010111 */ 0xa0000057, 0xfc00707f, riscv_rvv_101000HGGGGGFFFFF000DDDDD1010111 },
-	{ "vsra.vv", /*          101001HGGGGGFFFFF000DDDDD1010111 */ 0xa4000057, 0xfc00707f, riscv_rvv_101001HGGGGGFFFFF000DDDDD1010111 },
-	{ "vssrl.vv", /*         101010HGGGGGFFFFF000DDDDD1010111 */ 0xa8000057, 0xfc00707f, riscv_rvv_101010HGGGGGFFFFF000DDDDD1010111 },
-	{ "vssra.vv", /*         101011HGGGGGFFFFF000DDDDD1010111 */ 0xac000057, 0xfc00707f, riscv_rvv_101011HGGGGGFFFFF000DDDDD1010111 },
-	{ "vnsrl.wv", /*         101100HGGGGGFFFFF000DDDDD1010111 */ 0xb0000057, 0xfc00707f, riscv_rvv_101100HGGGGGFFFFF000DDDDD1010111 },
-	{ "vnsra.wv", /*         101101HGGGGGFFFFF000DDDDD1010111 */ 0xb4000057, 0xfc00707f, riscv_rvv_101101HGGGGGFFFFF000DDDDD1010111 },
-	{ "vnclipu.wv", /*       101110HGGGGGFFFFF000DDDDD1010111 */ 0xb8000057, 0xfc00707f, riscv_rvv_101110HGGGGGFFFFF000DDDDD1010111 },
-	{ "vnclip.wv", /*        101111HGGGGGFFFFF000DDDDD1010111 */ 0xbc000057, 0xfc00707f, riscv_rvv_101111HGGGGGFFFFF000DDDDD1010111 },
-	{ "vwredsumu.vs", /*     110000HGGGGGFFFFF000DDDDD1010111 */ 0xc0000057, 0xfc00707f, riscv_rvv_110000HGGGGGFFFFF000DDDDD1010111 },
-	{ "vwredsum.vs", /*      110001HGGGGGFFFFF000DDDDD1010111 */ 0xc4000057, 0xfc00707f, riscv_rvv_110001HGGGGGFFFFF000DDDDD1010111 },
-	{ "vadd.vi", /*          000000HGGGGGLLLLL011DDDDD1010111 */ 0x00003057, 0xfc00707f, riscv_rvv_000000HGGGGGLLLLL011DDDDD1010111 },
-	{ "vrsub.vi", /*         000011HGGGGGLLLLL011DDDDD1010111 */ 0x0c003057, 0xfc00707f, riscv_rvv_000011HGGGGGLLLLL011DDDDD1010111 },
-	{ "vand.vi", /*          001001HGGGGGLLLLL011DDDDD1010111 */ 0x24003057, 0xfc00707f, riscv_rvv_001001HGGGGGLLLLL011DDDDD1010111 },
-	{ "vor.vi", /*           001010HGGGGGLLLLL011DDDDD1010111 */ 0x28003057, 0xfc00707f, riscv_rvv_001010HGGGGGLLLLL011DDDDD1010111 },
-	{ "vxor.vi", /*          001011HGGGGGLLLLL011DDDDD1010111 */ 0x2c003057, 0xfc00707f, riscv_rvv_001011HGGGGGLLLLL011DDDDD1010111 },
-	{ "vrgather.vi", /*      001100HGGGGGLLLLL011DDDDD1010111 */ 0x30003057, 0xfc00707f, riscv_rvv_001100HGGGGGLLLLL011DDDDD1010111 },
-	{ "vslideup.vi", /*      001110HGGGGGLLLLL011DDDDD1010111 */ 0x38003057, 0xfc00707f, riscv_rvv_001110HGGGGGLLLLL011DDDDD1010111 },
-	{ "vslidedown.vi", /*    001111HGGGGGLLLLL011DDDDD1010111 */ 0x3c003057, 0xfc00707f, riscv_rvv_001111HGGGGGLLLLL011DDDDD1010111 },
-	{ "vmseq.vi", /*         011000HGGGGGLLLLL011DDDDD1010111 */ 0x60003057, 0xfc00707f, riscv_rvv_011000HGGGGGLLLLL011DDDDD1010111 },
-	{ "vmsne.vi", /*         011001HGGGGGLLLLL011DDDDD1010111 */ 0x64003057, 0xfc00707f, riscv_rvv_011001HGGGGGLLLLL011DDDDD1010111 },
-	{ "vmsleu.vi", /*        011100HGGGGGLLLLL011DDDDD1010111 */ 0x70003057, 0xfc00707f, riscv_rvv_011100HGGGGGLLLLL011DDDDD1010111 },
-	{ "vmsle.vi", /*         011101HGGGGGLLLLL011DDDDD1010111 */ 0x74003057, 0xfc00707f, riscv_rvv_011101HGGGGGLLLLL011DDDDD1010111 },
-	{ "vmsgtu.vi", /*        011110HGGGGGLLLLL011DDDDD1010111 */ 0x78003057, 0xfc00707f, riscv_rvv_011110HGGGGGLLLLL011DDDDD1010111 },
-	{ "vmsgt.vi", /*         011111HGGGGGLLLLL011DDDDD1010111 */ 0x7c003057, 0xfc00707f, riscv_rvv_011111HGGGGGLLLLL011DDDDD1010111 },
-	{ "vsaddu.vi", /*        100000HGGGGGLLLLL011DDDDD1010111 */ 0x80003057, 0xfc00707f, riscv_rvv_100000HGGGGGLLLLL011DDDDD1010111 },
-	{ "vsadd.vi", /*         100001HGGGGGLLLLL011DDDDD1010111 */ 0x84003057, 0xfc00707f, riscv_rvv_100001HGGGGGLLLLL011DDDDD1010111 },
-	{ "vsll.vi", /*          100101HGGGGGLLLLL011DDDDD1010111 */ 0x94003057, 0xfc00707f, riscv_rvv_100101HGGGGGLLLLL011DDDDD1010111 },
-	{ "vsrl.vi", /*          101000HGGGGGLLLLL011DDDDD1010111 */ 0xa0003057, 0xfc00707f, riscv_rvv_101000HGGGGGLLLLL011DDDDD1010111 },
-	{ "vsra.vi", /*          101001HGGGGGLLLLL011DDDDD1010111 */ 0xa4003057, 0xfc00707f, riscv_rvv_101001HGGGGGLLLLL011DDDDD1010111 },
-	{ "vssrl.vi", /*         101010HGGGGGLLLLL011DDDDD1010111 */ 0xa8003057, 0xfc00707f, riscv_rvv_101010HGGGGGLLLLL011DDDDD1010111 },
-	{ "vssra.vi", /*         101011HGGGGGLLLLL011DDDDD1010111 */ 0xac003057, 0xfc00707f, riscv_rvv_101011HGGGGGLLLLL011DDDDD1010111 },
-	{ "vnsrl.wi", /*         101100HGGGGGLLLLL011DDDDD1010111 */ 0xb0003057, 0xfc00707f, riscv_rvv_101100HGGGGGLLLLL011DDDDD1010111 },
-	{ "vnsra.wi", /*         101101HGGGGGLLLLL011DDDDD1010111 */ 0xb4003057, 0xfc00707f, riscv_rvv_101101HGGGGGLLLLL011DDDDD1010111 },
-	{ "vnclipu.wi", /*       101110HGGGGGLLLLL011DDDDD1010111 */ 0xb8003057, 0xfc00707f, riscv_rvv_101110HGGGGGLLLLL011DDDDD1010111 },
-	{ "vnclip.wi", /*        101111HGGGGGLLLLL011DDDDD1010111 */ 0xbc003057, 0xfc00707f, riscv_rvv_101111HGGGGGLLLLL011DDDDD1010111 },
-	{ "vredsum.vs", /*       000000HGGGGGFFFFF010DDDDD1010111 */ 0x00002057, 0xfc00707f, riscv_rvv_000000HGGGGGFFFFF010DDDDD1010111 },
-	{ "vredand.vs", /*       000001HGGGGGFFFFF010DDDDD1010111 */ 0x04002057, 0xfc00707f, riscv_rvv_000001HGGGGGFFFFF010DDDDD1010111 },
-	{ "vredor.vs", /*        000010HGGGGGFFFFF010DDDDD1010111 */ 0x08002057, 0xfc00707f, riscv_rvv_000010HGGGGGFFFFF010DDDDD1010111 },
-	{ "vredxor.vs", /*       000011HGGGGGFFFFF010DDDDD1010111 */ 0x0c002057, 0xfc00707f, riscv_rvv_000011HGGGGGFFFFF010DDDDD1010111 },
-	{ "vredminu.vs", /*      000100HGGGGGFFFFF010DDDDD1010111 */ 0x10002057, 0xfc00707f, riscv_rvv_000100HGGGGGFFFFF010DDDDD1010111 },
-	{ "vredmin.vs", /*       000101HGGGGGFFFFF010DDDDD1010111 */ 0x14002057, 0xfc00707f, riscv_rvv_000101HGGGGGFFFFF010DDDDD1010111 },
-	{ "vredmaxu.vs", /*      000110HGGGGGFFFFF010DDDDD1010111 */ 0x18002057, 0xfc00707f, riscv_rvv_000110HGGGGGFFFFF010DDDDD1010111 },
-	{ "vredmax.vs", /*       000111HGGGGGFFFFF010DDDDD1010111 */ 0x1c002057, 0xfc00707f, riscv_rvv_000111HGGGGGFFFFF010DDDDD1010111 },
-	{ "vaaddu.vv", /*        001000HGGGGGFFFFF010DDDDD1010111 */ 0x20002057, 0xfc00707f, riscv_rvv_001000HGGGGGFFFFF010DDDDD1010111 },
-	{ "vaadd.vv", /*         001001HGGGGGFFFFF010DDDDD1010111 */ 0x24002057, 0xfc00707f, riscv_rvv_001001HGGGGGFFFFF010DDDDD1010111 },
-	{ "vasubu.vv", /*        001010HGGGGGFFFFF010DDDDD1010111 */ 0x28002057, 0xfc00707f, riscv_rvv_001010HGGGGGFFFFF010DDDDD1010111 },
-	{ "vasub.vv", /*         001011HGGGGGFFFFF010DDDDD1010111 */ 0x2c002057, 0xfc00707f, riscv_rvv_001011HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmandn.mm", /*        011000HGGGGGFFFFF010DDDDD1010111 */ 0x60002057, 0xfc00707f, riscv_rvv_011000HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmand.mm", /*         011001HGGGGGFFFFF010DDDDD1010111 */ 0x64002057, 0xfc00707f, riscv_rvv_011001HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmor.mm", /*          011010HGGGGGFFFFF010DDDDD1010111 */ 0x68002057, 0xfc00707f, riscv_rvv_011010HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmxor.mm", /*         011011HGGGGGFFFFF010DDDDD1010111 */ 0x6c002057, 0xfc00707f, riscv_rvv_011011HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmorn.mm", /*         011100HGGGGGFFFFF010DDDDD1010111 */ 0x70002057, 0xfc00707f, riscv_rvv_011100HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmnand.mm", /*        011101HGGGGGFFFFF010DDDDD1010111 */ 0x74002057, 0xfc00707f, riscv_rvv_011101HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmnor.mm", /*         011110HGGGGGFFFFF010DDDDD1010111 */ 0x78002057, 0xfc00707f, riscv_rvv_011110HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmxnor.mm", /*        011111HGGGGGFFFFF010DDDDD1010111 */ 0x7c002057, 0xfc00707f, riscv_rvv_011111HGGGGGFFFFF010DDDDD1010111 },
-	{ "vdivu.vv", /*         100000HGGGGGFFFFF010DDDDD1010111 */ 0x80002057, 0xfc00707f, riscv_rvv_100000HGGGGGFFFFF010DDDDD1010111 },
-	{ "vdiv.vv", /*          100001HGGGGGFFFFF010DDDDD1010111 */ 0x84002057, 0xfc00707f, riscv_rvv_100001HGGGGGFFFFF010DDDDD1010111 },
-	{ "vremu.vv", /*         100010HGGGGGFFFFF010DDDDD1010111 */ 0x88002057, 0xfc00707f, riscv_rvv_100010HGGGGGFFFFF010DDDDD1010111 },
-	{ "vrem.vv", /*          100011HGGGGGFFFFF010DDDDD1010111 */ 0x8c002057, 0xfc00707f, riscv_rvv_100011HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmulhu.vv", /*        100100HGGGGGFFFFF010DDDDD1010111 */ 0x90002057, 0xfc00707f, riscv_rvv_100100HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmul.vv", /*          100101HGGGGGFFFFF010DDDDD1010111 */ 0x94002057, 0xfc00707f, riscv_rvv_100101HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmulhsu.vv", /*       100110HGGGGGFFFFF010DDDDD1010111 */ 0x98002057, 0xfc00707f, riscv_rvv_100110HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmulh.vv", /*         100111HGGGGGFFFFF010DDDDD1010111 */ 0x9c002057, 0xfc00707f, riscv_rvv_100111HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmadd.vv", /*         101001HGGGGGFFFFF010DDDDD1010111 */ 0xa4002057, 0xfc00707f, riscv_rvv_101001HGGGGGFFFFF010DDDDD1010111 },
-	{ "vnmsub.vv", /*        101011HGGGGGFFFFF010DDDDD1010111 */ 0xac002057, 0xfc00707f, riscv_rvv_101011HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmacc.vv", /*         101101HGGGGGFFFFF010DDDDD1010111 */ 0xb4002057, 0xfc00707f, riscv_rvv_101101HGGGGGFFFFF010DDDDD1010111 },
-	{ "vnmsac.vv", /*        101111HGGGGGFFFFF010DDDDD1010111 */ 0xbc002057, 0xfc00707f, riscv_rvv_101111HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwaddu.vv", /*        110000HGGGGGFFFFF010DDDDD1010111 */ 0xc0002057, 0xfc00707f, riscv_rvv_110000HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwadd.vv", /*         110001HGGGGGFFFFF010DDDDD1010111 */ 0xc4002057, 0xfc00707f, riscv_rvv_110001HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwsubu.vv", /*        110010HGGGGGFFFFF010DDDDD1010111 */ 0xc8002057, 0xfc00707f, riscv_rvv_110010HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwsub.vv", /*         110011HGGGGGFFFFF010DDDDD1010111 */ 0xcc002057, 0xfc00707f, riscv_rvv_110011HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwaddu.wv", /*        110100HGGGGGFFFFF010DDDDD1010111 */ 0xd0002057, 0xfc00707f, riscv_rvv_110100HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwadd.wv", /*         110101HGGGGGFFFFF010DDDDD1010111 */ 0xd4002057, 0xfc00707f, riscv_rvv_110101HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwsubu.wv", /*        110110HGGGGGFFFFF010DDDDD1010111 */ 0xd8002057, 0xfc00707f, riscv_rvv_110110HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwsub.wv", /*         110111HGGGGGFFFFF010DDDDD1010111 */ 0xdc002057, 0xfc00707f, riscv_rvv_110111HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwmulu.vv", /*        111000HGGGGGFFFFF010DDDDD1010111 */ 0xe0002057, 0xfc00707f, riscv_rvv_111000HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwmulsu.vv", /*       111010HGGGGGFFFFF010DDDDD1010111 */ 0xe8002057, 0xfc00707f, riscv_rvv_111010HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwmul.vv", /*         111011HGGGGGFFFFF010DDDDD1010111 */ 0xec002057, 0xfc00707f, riscv_rvv_111011HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwmaccu.vv", /*       111100HGGGGGFFFFF010DDDDD1010111 */ 0xf0002057, 0xfc00707f, riscv_rvv_111100HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwmacc.vv", /*        111101HGGGGGFFFFF010DDDDD1010111 */ 0xf4002057, 0xfc00707f, riscv_rvv_111101HGGGGGFFFFF010DDDDD1010111 },
-	{ "vwmaccsu.vv", /*      111111HGGGGGFFFFF010DDDDD1010111 */ 0xfc002057, 0xfc00707f, riscv_rvv_111111HGGGGGFFFFF010DDDDD1010111 },
-	{ "vaaddu.vx", /*        001000HGGGGGccccc110DDDDD1010111 */ 0x20006057, 0xfc00707f, riscv_rvv_001000HGGGGGccccc110DDDDD1010111 },
-	{ "vaadd.vx", /*         001001HGGGGGccccc110DDDDD1010111 */ 0x24006057, 0xfc00707f, riscv_rvv_001001HGGGGGccccc110DDDDD1010111 },
-	{ "vasubu.vx", /*        001010HGGGGGccccc110DDDDD1010111 */ 0x28006057, 0xfc00707f, riscv_rvv_001010HGGGGGccccc110DDDDD1010111 },
-	{ "vasub.vx", /*         001011HGGGGGccccc110DDDDD1010111 */ 0x2c006057, 0xfc00707f, riscv_rvv_001011HGGGGGccccc110DDDDD1010111 },
-	{ "vslide1up.vx", /*     001110HGGGGGccccc110DDDDD1010111 */ 0x38006057, 0xfc00707f, riscv_rvv_001110HGGGGGccccc110DDDDD1010111 },
-	{ "vslide1down.vx", /*   001111HGGGGGccccc110DDDDD1010111 */ 0x3c006057, 0xfc00707f, riscv_rvv_001111HGGGGGccccc110DDDDD1010111 },
-	{ "vdivu.vx", /*         100000HGGGGGccccc110DDDDD1010111 */ 0x80006057, 0xfc00707f, riscv_rvv_100000HGGGGGccccc110DDDDD1010111 },
-	{ "vdiv.vx", /*          100001HGGGGGccccc110DDDDD1010111 */ 0x84006057, 0xfc00707f, riscv_rvv_100001HGGGGGccccc110DDDDD1010111 },
-	{ "vremu.vx", /*         100010HGGGGGccccc110DDDDD1010111 */ 0x88006057, 0xfc00707f, riscv_rvv_100010HGGGGGccccc110DDDDD1010111 },
-	{ "vrem.vx", /*          100011HGGGGGccccc110DDDDD1010111 */ 0x8c006057, 0xfc00707f, riscv_rvv_100011HGGGGGccccc110DDDDD1010111 },
-	{ "vmulhu.vx", /*        100100HGGGGGccccc110DDDDD1010111 */ 0x90006057, 0xfc00707f, riscv_rvv_100100HGGGGGccccc110DDDDD1010111 },
-	{ "vmul.vx", /*          100101HGGGGGccccc110DDDDD1010111 */ 0x94006057, 0xfc00707f, riscv_rvv_100101HGGGGGccccc110DDDDD1010111 },
-	{ "vmulhsu.vx", /*       100110HGGGGGccccc110DDDDD1010111 */ 0x98006057, 0xfc00707f, riscv_rvv_100110HGGGGGccccc110DDDDD1010111 },
-	{ "vmulh.vx", /*         100111HGGGGGccccc110DDDDD1010111 */ 0x9c006057, 0xfc00707f, riscv_rvv_100111HGGGGGccccc110DDDDD1010111 },
-	{ "vmadd.vx", /*         101001HGGGGGccccc110DDDDD1010111 */ 0xa4006057, 0xfc00707f, riscv_rvv_101001HGGGGGccccc110DDDDD1010111 },
-	{ "vnmsub.vx", /*        101011HGGGGGccccc110DDDDD1010111 */ 0xac006057, 0xfc00707f, riscv_rvv_101011HGGGGGccccc110DDDDD1010111 },
-	{ "vmacc.vx", /*         101101HGGGGGccccc110DDDDD1010111 */ 0xb4006057, 0xfc00707f, riscv_rvv_101101HGGGGGccccc110DDDDD1010111 },
-	{ "vnmsac.vx", /*        101111HGGGGGccccc110DDDDD1010111 */ 0xbc006057, 0xfc00707f, riscv_rvv_101111HGGGGGccccc110DDDDD1010111 },
-	{ "vwaddu.vx", /*        110000HGGGGGccccc110DDDDD1010111 */ 0xc0006057, 0xfc00707f, riscv_rvv_110000HGGGGGccccc110DDDDD1010111 },
-	{ "vwadd.vx", /*         110001HGGGGGccccc110DDDDD1010111 */ 0xc4006057, 0xfc00707f, riscv_rvv_110001HGGGGGccccc110DDDDD1010111 },
-	{ "vwsubu.vx", /*        110010HGGGGGccccc110DDDDD1010111 */ 0xc8006057, 0xfc00707f, riscv_rvv_110010HGGGGGccccc110DDDDD1010111 },
-	{ "vwsub.vx", /*         110011HGGGGGccccc110DDDDD1010111 */ 0xcc006057, 0xfc00707f, riscv_rvv_110011HGGGGGccccc110DDDDD1010111 },
-	{ "vwaddu.wx", /*        110100HGGGGGccccc110DDDDD1010111 */ 0xd0006057, 0xfc00707f, riscv_rvv_110100HGGGGGccccc110DDDDD1010111 },
-	{ "vwadd.wx", /*         110101HGGGGGccccc110DDDDD1010111 */ 0xd4006057, 0xfc00707f, riscv_rvv_110101HGGGGGccccc110DDDDD1010111 },
-	{ "vwsubu.wx", /*        110110HGGGGGccccc110DDDDD1010111 */ 0xd8006057, 0xfc00707f, riscv_rvv_110110HGGGGGccccc110DDDDD1010111 },
-	{ "vwsub.wx", /*         110111HGGGGGccccc110DDDDD1010111 */ 0xdc006057, 0xfc00707f, riscv_rvv_110111HGGGGGccccc110DDDDD1010111 },
-	{ "vwmulu.vx", /*        111000HGGGGGccccc110DDDDD1010111 */ 0xe0006057, 0xfc00707f, riscv_rvv_111000HGGGGGccccc110DDDDD1010111 },
-	{ "vwmulsu.vx", /*       111010HGGGGGccccc110DDDDD1010111 */ 0xe8006057, 0xfc00707f, riscv_rvv_111010HGGGGGccccc110DDDDD1010111 },
-	{ "vwmul.vx", /*         111011HGGGGGccccc110DDDDD1010111 */ 0xec006057, 0xfc00707f, riscv_rvv_111011HGGGGGccccc110DDDDD1010111 },
-	{ "vwmaccu.vx", /*       111100HGGGGGccccc110DDDDD1010111 */ 0xf0006057, 0xfc00707f, riscv_rvv_111100HGGGGGccccc110DDDDD1010111 },
-	{ "vwmacc.vx", /*        111101HGGGGGccccc110DDDDD1010111 */ 0xf4006057, 0xfc00707f, riscv_rvv_111101HGGGGGccccc110DDDDD1010111 },
-	{ "vwmaccus.vx", /*      111110HGGGGGccccc110DDDDD1010111 */ 0xf8006057, 0xfc00707f, riscv_rvv_111110HGGGGGccccc110DDDDD1010111 },
-	{ "vwmaccsu.vx", /*      111111HGGGGGccccc110DDDDD1010111 */ 0xfc006057, 0xfc00707f, riscv_rvv_111111HGGGGGccccc110DDDDD1010111 },
-	{ "vfredsum.vs", /*      000001HGGGGGFFFFF001DDDDD1010111 */ 0x04001057, 0xfc00707f, riscv_rvv_000001HGGGGGFFFFF001DDDDD1010111 },
-	{ "vfwredsum.vs", /*     110001HGGGGGFFFFF001DDDDD1010111 */ 0xc4001057, 0xfc00707f, riscv_rvv_110001HGGGGGFFFFF001DDDDD1010111 },
-	{ "vmornot.mm", /*       011100HGGGGGFFFFF010DDDDD1010111 */ 0x70002057, 0xfc00707f, riscv_rvv_011100HGGGGGFFFFF010DDDDD1010111 },
-	{ "vmandnot.mm", /*      011000HGGGGGFFFFF010DDDDD1010111 */ 0x60002057, 0xfc00707f, riscv_rvv_011000HGGGGGFFFFF010DDDDD1010111 },
-	{ "vfcvt.xu.f.v", /*     010010HGGGGG00000001DDDDD1010111 */ 0x48001057, 0xfc0ff07f, riscv_rvv_010010HGGGGG00000001DDDDD1010111 },
-	{ "vfcvt.x.f.v", /*      010010HGGGGG00001001DDDDD1010111 */ 0x48009057, 0xfc0ff07f, riscv_rvv_010010HGGGGG00001001DDDDD1010111 },
-	{ "vfcvt.f.xu.v", /*     010010HGGGGG00010001DDDDD1010111 */ 0x48011057, 0xfc0ff07f, riscv_rvv_010010HGGGGG00010001DDDDD1010111 },
-	{ "vfcvt.f.x.v", /*      010010HGGGGG00011001DDDDD1010111 */ 0x48019057, 0xfc0ff07f, riscv_rvv_010010HGGGGG00011001DDDDD1010111 },
-	{ "vfcvt.rtz.xu.f.v", /* 010010HGGGGG00110001DDDDD1010111 */ 0x48031057, 0xfc0ff07f, riscv_rvv_010010HGGGGG00110001DDDDD1010111 },
-	{ "vfcvt.rtz.x.f.v", /*  010010HGGGGG00111001DDDDD1010111 */ 0x48039057, 0xfc0ff07f, riscv_rvv_010010HGGGGG00111001DDDDD1010111 },
-	{ "vfwcvt.xu.f.v", /*    010010HGGGGG01000001DDDDD1010111 */ 0x48041057, 0xfc0ff07f, riscv_rvv_010010HGGGGG01000001DDDDD1010111 },
-	{ "vfwcvt.x.f.v", /*     010010HGGGGG01001001DDDDD1010111 */ 0x48049057, 0xfc0ff07f, riscv_rvv_010010HGGGGG01001001DDDDD1010111 },
-	{ "vfwcvt.f.xu.v", /*    010010HGGGGG01010001DDDDD1010111 */ 0x48051057, 0xfc0ff07f, riscv_rvv_010010HGGGGG01010001DDDDD1010111 },
-	{ "vfwcvt.f.x.v", /*     010010HGGGGG01011001DDDDD1010111 */ 0x48059057, 0xfc0ff07f, riscv_rvv_010010HGGGGG01011001DDDDD1010111 },
-	{ "vfwcvt.f.f.v", /*     010010HGGGGG01100001DDDDD1010111 */ 0x48061057, 0xfc0ff07f, riscv_rvv_010010HGGGGG01100001DDDDD1010111 },
-	{ "vfwcvt.rtz.xu.f.v", /* 010010HGGGGG01110001DDDDD1010111 */ 0x48071057, 0xfc0ff07f, riscv_rvv_010010HGGGGG01110001DDDDD1010111 },
-	{ "vfwcvt.rtz.x.f.v", /* 010010HGGGGG01111001DDDDD1010111 */ 0x48079057, 0xfc0ff07f, riscv_rvv_010010HGGGGG01111001DDDDD1010111 },
-	{ "vfncvt.xu.f.w", /*    010010HGGGGG10000001DDDDD1010111 */ 0x48081057, 0xfc0ff07f, riscv_rvv_010010HGGGGG10000001DDDDD1010111 },
-	{ "vfncvt.x.f.w", /*     010010HGGGGG10001001DDDDD1010111 */ 0x48089057, 0xfc0ff07f, riscv_rvv_010010HGGGGG10001001DDDDD1010111 },
-	{ "vfncvt.f.xu.w", /*    010010HGGGGG10010001DDDDD1010111 */ 0x48091057, 0xfc0ff07f, riscv_rvv_010010HGGGGG10010001DDDDD1010111 },
-	{ "vfncvt.f.x.w", /*     010010HGGGGG10011001DDDDD1010111 */ 0x48099057, 0xfc0ff07f, riscv_rvv_010010HGGGGG10011001DDDDD1010111 },
-	{ "vfncvt.f.f.w", /*     010010HGGGGG10100001DDDDD1010111 */ 0x480a1057, 0xfc0ff07f, riscv_rvv_010010HGGGGG10100001DDDDD1010111 },
-	{ "vfncvt.rod.f.f.w", /* 010010HGGGGG10101001DDDDD1010111 */ 0x480a9057, 0xfc0ff07f, riscv_rvv_010010HGGGGG10101001DDDDD1010111 },
-	{ "vfncvt.rtz.xu.f.w", /* 010010HGGGGG10110001DDDDD1010111 */ 0x480b1057, 0xfc0ff07f, riscv_rvv_010010HGGGGG10110001DDDDD1010111 },
-	{ "vfncvt.rtz.x.f.w", /* 010010HGGGGG10111001DDDDD1010111 */ 0x480b9057, 0xfc0ff07f, riscv_rvv_010010HGGGGG10111001DDDDD1010111 },
-	{ "vfsqrt.v", /*         010011HGGGGG00000001DDDDD1010111 */ 0x4c001057, 0xfc0ff07f, riscv_rvv_010011HGGGGG00000001DDDDD1010111 },
-	{ "vfrsqrt7.v", /*       010011HGGGGG00100001DDDDD1010111 */ 0x4c021057, 0xfc0ff07f, riscv_rvv_010011HGGGGG00100001DDDDD1010111 },
-	{ "vfrec7.v", /*         010011HGGGGG00101001DDDDD1010111 */ 0x4c029057, 0xfc0ff07f, riscv_rvv_010011HGGGGG00101001DDDDD1010111 },
-	{ "vfclass.v", /*        010011HGGGGG10000001DDDDD1010111 */ 0x4c081057, 0xfc0ff07f, riscv_rvv_010011HGGGGG10000001DDDDD1010111 },
-	{ "vzext.vf8", /*        010010HGGGGG00010010DDDDD1010111 */ 0x48012057, 0xfc0ff07f, riscv_rvv_010010HGGGGG00010010DDDDD1010111 },
-	{ "vsext.vf8", /*        010010HGGGGG00011010DDDDD1010111 */ 0x4801a057, 0xfc0ff07f, riscv_rvv_010010HGGGGG00011010DDDDD1010111 },
-	{ "vzext.vf4", /*        010010HGGGGG00100010DDDDD1010111 */ 0x48022057, 0xfc0ff07f, riscv_rvv_010010HGGGGG00100010DDDDD1010111 },
-	{ "vsext.vf4", /*        010010HGGGGG00101010DDDDD1010111 */ 0x4802a057, 0xfc0ff07f, riscv_rvv_010010HGGGGG00101010DDDDD1010111 },
-	{ "vzext.vf2", /*        010010HGGGGG00110010DDDDD1010111 */ 0x48032057, 0xfc0ff07f, riscv_rvv_010010HGGGGG00110010DDDDD1010111 },
-	{ "vsext.vf2", /*        010010HGGGGG00111010DDDDD1010111 */ 0x4803a057, 0xfc0ff07f, riscv_rvv_010010HGGGGG00111010DDDDD1010111 },
-	{ "vmsbf.m", /*          010100HGGGGG00001010DDDDD1010111 */ 0x5000a057, 0xfc0ff07f, riscv_rvv_010100HGGGGG00001010DDDDD1010111 },
-	{ "vmsof.m", /*          010100HGGGGG00010010DDDDD1010111 */ 0x50012057, 0xfc0ff07f, riscv_rvv_010100HGGGGG00010010DDDDD1010111 },
-	{ "vmsif.m", /*          010100HGGGGG00011010DDDDD1010111 */ 0x5001a057, 0xfc0ff07f, riscv_rvv_010100HGGGGG00011010DDDDD1010111 },
-	{ "viota.m", /*          010100HGGGGG10000010DDDDD1010111 */ 0x50082057, 0xfc0ff07f, riscv_rvv_010100HGGGGG10000010DDDDD1010111 },
-	{ "vcpop.m", /*          010000HGGGGG10000010aaaaa1010111 */ 0x40082057, 0xfc0ff07f, riscv_rvv_010000HGGGGG10000010aaaaa1010111 },
-	{ "vfirst.m", /*         010000HGGGGG10001010aaaaa1010111 */ 0x4008a057, 0xfc0ff07f, riscv_rvv_010000HGGGGG10001010aaaaa1010111 },
-	{ "vpopc.m", /*          010000HGGGGG10000010aaaaa1010111 */ 0x40082057, 0xfc0ff07f, riscv_rvv_010000HGGGGG10000010aaaaa1010111 },
-	{ "vid.v", /*            010100H0000010001010DDDDD1010111 */ 0x5008a057, 0xfdfff07f, riscv_rvv_010100H0000010001010DDDDD1010111 },
-	{ "fadd.d", /*           0000001dddddcccccjjjaaaaa1010011 */ 0x02000053, 0xfe00007f, riscv_rv32d_0000001dddddcccccjjjaaaaa1010011 },
-	{ "fsub.d", /*           0000101dddddcccccjjjaaaaa1010011 */ 0x0a000053, 0xfe00007f, riscv_rv32d_0000101dddddcccccjjjaaaaa1010011 },
-	{ "fmul.d", /*           0001001dddddcccccjjjaaaaa1010011 */ 0x12000053, 0xfe00007f, riscv_rv32d_0001001dddddcccccjjjaaaaa1010011 },
-	{ "fdiv.d", /*           0001101dddddcccccjjjaaaaa1010011 */ 0x1a000053, 0xfe00007f, riscv_rv32d_0001101dddddcccccjjjaaaaa1010011 },
-	{ "fadd.s", /*           0000000dddddcccccjjjaaaaa1010011 */ 0x00000053, 0xfe00007f, riscv_rv32f_0000000dddddcccccjjjaaaaa1010011 },
-	{ "fsub.s", /*           0000100dddddcccccjjjaaaaa1010011 */ 0x08000053, 0xfe00007f, riscv_rv32f_0000100dddddcccccjjjaaaaa1010011 },
-	{ "fmul.s", /*           0001000dddddcccccjjjaaaaa1010011 */ 0x10000053, 0xfe00007f, riscv_rv32f_0001000dddddcccccjjjaaaaa1010011 },
-	{ "fdiv.s", /*           0001100dddddcccccjjjaaaaa1010011 */ 0x18000053, 0xfe00007f, riscv_rv32f_0001100dddddcccccjjjaaaaa1010011 },
-	{ "fadd.q", /*           0000011dddddcccccjjjaaaaa1010011 */ 0x06000053, 0xfe00007f, riscv_rv32q_0000011dddddcccccjjjaaaaa1010011 },
-	{ "fsub.q", /*           0000111dddddcccccjjjaaaaa1010011 */ 0x0e000053, 0xfe00007f, riscv_rv32q_0000111dddddcccccjjjaaaaa1010011 },
-	{ "fmul.q", /*           0001011dddddcccccjjjaaaaa1010011 */ 0x16000053, 0xfe00007f, riscv_rv32q_0001011dddddcccccjjjaaaaa1010011 },
-	{ "fdiv.q", /*           0001111dddddcccccjjjaaaaa1010011 */ 0x1e000053, 0xfe00007f, riscv_rv32q_0001111dddddcccccjjjaaaaa1010011 },
-	{ "fadd.h", /*           0000010dddddcccccjjjaaaaa1010011 */ 0x04000053, 0xfe00007f, riscv_rv32zfh_0000010dddddcccccjjjaaaaa1010011 },
-	{ "fsub.h", /*           0000110dddddcccccjjjaaaaa1010011 */ 0x0c000053, 0xfe00007f, riscv_rv32zfh_0000110dddddcccccjjjaaaaa1010011 },
-	{ "fmul.h", /*           0001010dddddcccccjjjaaaaa1010011 */ 0x14000053, 0xfe00007f, riscv_rv32zfh_0001010dddddcccccjjjaaaaa1010011 },
-	{ "fdiv.h", /*           0001110dddddcccccjjjaaaaa1010011 */ 0x1c000053, 0xfe00007f, riscv_rv32zfh_0001110dddddcccccjjjaaaaa1010011 },
-	{ "slli.rv32", /*        0000000uuuuuccccc001aaaaa0010011 */ 0x00001013, 0xfe00707f, riscv_pseudo_0000000uuuuuccccc001aaaaa0010011 },
-	{ "srli.rv32", /*        0000000uuuuuccccc101aaaaa0010011 */ 0x00005013, 0xfe00707f, riscv_pseudo_0000000uuuuuccccc101aaaaa0010011 },
-	{ "srai.rv32", /*        0100000uuuuuccccc101aaaaa0010011 */ 0x40005013, 0xfe00707f, riscv_pseudo_0100000uuuuuccccc101aaaaa0010011 },
-	{ "andn", /*             0100000dddddccccc111aaaaa0110011 */ 0x40007033, 0xfe00707f, riscv_rv32b_0100000dddddccccc111aaaaa0110011 },
-	{ "orn", /*              0100000dddddccccc110aaaaa0110011 */ 0x40006033, 0xfe00707f, riscv_rv32b_0100000dddddccccc110aaaaa0110011 },
-	{ "xnor", /*             0100000dddddccccc100aaaaa0110011 */ 0x40004033, 0xfe00707f, riscv_rv32b_0100000dddddccccc100aaaaa0110011 },
-	{ "slo", /*              0010000dddddccccc001aaaaa0110011 */ 0x20001033, 0xfe00707f, riscv_rv32b_0010000dddddccccc001aaaaa0110011 },
-	{ "sro", /*              0010000dddddccccc101aaaaa0110011 */ 0x20005033, 0xfe00707f, riscv_rv32b_0010000dddddccccc101aaaaa0110011 },
-	{ "rol", /*              0110000dddddccccc001aaaaa0110011 */ 0x60001033, 0xfe00707f, riscv_rv32b_0110000dddddccccc001aaaaa0110011 },
-	{ "ror", /*              0110000dddddccccc101aaaaa0110011 */ 0x60005033, 0xfe00707f, riscv_rv32b_0110000dddddccccc101aaaaa0110011 },
-	{ "bclr", /*             0100100dddddccccc001aaaaa0110011 */ 0x48001033, 0xfe00707f, riscv_rv32b_0100100dddddccccc001aaaaa0110011 },
-	{ "bset", /*             0010100dddddccccc001aaaaa0110011 */ 0x28001033, 0xfe00707f, riscv_rv32b_0010100dddddccccc001aaaaa0110011 },
-	{ "binv", /*             0110100dddddccccc001aaaaa0110011 */ 0x68001033, 0xfe00707f, riscv_rv32b_0110100dddddccccc001aaaaa0110011 },
-	{ "bext", /*             0100100dddddccccc101aaaaa0110011 */ 0x48005033, 0xfe00707f, riscv_rv32b_0100100dddddccccc101aaaaa0110011 },
-	{ "gorc", /*             0010100dddddccccc101aaaaa0110011 */ 0x28005033, 0xfe00707f, riscv_rv32b_0010100dddddccccc101aaaaa0110011 },
-	{ "grev", /*             0110100dddddccccc101aaaaa0110011 */ 0x68005033, 0xfe00707f, riscv_rv32b_0110100dddddccccc101aaaaa0110011 },
-	{ "sh1add", /*           0010000dddddccccc010aaaaa0110011 */ 0x20002033, 0xfe00707f, riscv_rv32b_0010000dddddccccc010aaaaa0110011 },
-	{ "sh2add", /*           0010000dddddccccc100aaaaa0110011 */ 0x20004033, 0xfe00707f, riscv_rv32b_0010000dddddccccc100aaaaa0110011 },
-	{ "sh3add", /*           0010000dddddccccc110aaaaa0110011 */ 0x20006033, 0xfe00707f, riscv_rv32b_0010000dddddccccc110aaaaa0110011 },
-	{ "clmul", /*            0000101dddddccccc001aaaaa0110011 */ 0x0a001033, 0xfe00707f, riscv_rv32b_0000101dddddccccc001aaaaa0110011 },
-	{ "clmulr", /*           0000101dddddccccc010aaaaa0110011 */ 0x0a002033, 0xfe00707f, riscv_rv32b_0000101dddddccccc010aaaaa0110011 },
-	{ "clmulh", /*           0000101dddddccccc011aaaaa0110011 */ 0x0a003033, 0xfe00707f, riscv_rv32b_0000101dddddccccc011aaaaa0110011 },
-	{ "min", /*              0000101dddddccccc100aaaaa0110011 */ 0x0a004033, 0xfe00707f, riscv_rv32b_0000101dddddccccc100aaaaa0110011 },
-	{ "minu", /*             0000101dddddccccc101aaaaa0110011 */ 0x0a005033, 0xfe00707f, riscv_rv32b_0000101dddddccccc101aaaaa0110011 },
-	{ "max", /*              0000101dddddccccc110aaaaa0110011 */ 0x0a006033, 0xfe00707f, riscv_rv32b_0000101dddddccccc110aaaaa0110011 },
-	{ "maxu", /*             0000101dddddccccc111aaaaa0110011 */ 0x0a007033, 0xfe00707f, riscv_rv32b_0000101dddddccccc111aaaaa0110011 },
-	{ "shfl", /*             0000100dddddccccc001aaaaa0110011 */ 0x08001033, 0xfe00707f, riscv_rv32b_0000100dddddccccc001aaaaa0110011 },
-	{ "unshfl", /*           0000100dddddccccc101aaaaa0110011 */ 0x08005033, 0xfe00707f, riscv_rv32b_0000100dddddccccc101aaaaa0110011 },
-	{ "bcompress", /*        0000100dddddccccc110aaaaa0110011 */ 0x08006033, 0xfe00707f, riscv_rv32b_0000100dddddccccc110aaaaa0110011 },
-	{ "bdecompress", /*      0100100dddddccccc110aaaaa0110011 */ 0x48006033, 0xfe00707f, riscv_rv32b_0100100dddddccccc110aaaaa0110011 },
-	{ "pack", /*             0000100dddddccccc100aaaaa0110011 */ 0x08004033, 0xfe00707f, riscv_rv32b_0000100dddddccccc100aaaaa0110011 },
-	{ "packu", /*            0100100dddddccccc100aaaaa0110011 */ 0x48004033, 0xfe00707f, riscv_rv32b_0100100dddddccccc100aaaaa0110011 },
-	{ "packh", /*            0000100dddddccccc111aaaaa0110011 */ 0x08007033, 0xfe00707f, riscv_rv32b_0000100dddddccccc111aaaaa0110011 },
-	{ "bfp", /*              0100100dddddccccc111aaaaa0110011 */ 0x48007033, 0xfe00707f, riscv_rv32b_0100100dddddccccc111aaaaa0110011 },
-	{ "shfli", /*            0000100uuuuuccccc001aaaaa0010011 */ 0x08001013, 0xfe00707f, riscv_rv32b_0000100uuuuuccccc001aaaaa0010011 },
-	{ "unshfli", /*          0000100uuuuuccccc101aaaaa0010011 */ 0x08005013, 0xfe00707f, riscv_rv32b_0000100uuuuuccccc101aaaaa0010011 },
-	{ "xperm4", /*           0010100dddddccccc010aaaaa0110011 */ 0x28002033, 0xfe00707f, riscv_rv32b_0010100dddddccccc010aaaaa0110011 },
-	{ "xperm8", /*           0010100dddddccccc100aaaaa0110011 */ 0x28004033, 0xfe00707f, riscv_rv32b_0010100dddddccccc100aaaaa0110011 },
-	{ "xperm16", /*          0010100dddddccccc110aaaaa0110011 */ 0x28006033, 0xfe00707f, riscv_rv32b_0010100dddddccccc110aaaaa0110011 },
-	{ "fsgnj.d", /*          0010001dddddccccc000aaaaa1010011 */ 0x22000053, 0xfe00707f, riscv_rv32d_0010001dddddccccc000aaaaa1010011 },
-	{ "fsgnjn.d", /*         0010001dddddccccc001aaaaa1010011 */ 0x22001053, 0xfe00707f, riscv_rv32d_0010001dddddccccc001aaaaa1010011 },
-	{ "fsgnjx.d", /*         0010001dddddccccc010aaaaa1010011 */ 0x22002053, 0xfe00707f, riscv_rv32d_0010001dddddccccc010aaaaa1010011 },
-	{ "fmin.d", /*           0010101dddddccccc000aaaaa1010011 */ 0x2a000053, 0xfe00707f, riscv_rv32d_0010101dddddccccc000aaaaa1010011 },
-	{ "fmax.d", /*           0010101dddddccccc001aaaaa1010011 */ 0x2a001053, 0xfe00707f, riscv_rv32d_0010101dddddccccc001aaaaa1010011 },
-	{ "fle.d", /*            1010001dddddccccc000aaaaa1010011 */ 0xa2000053, 0xfe00707f, riscv_rv32d_1010001dddddccccc000aaaaa1010011 },
-	{ "flt.d", /*            1010001dddddccccc001aaaaa1010011 */ 0xa2001053, 0xfe00707f, riscv_rv32d_1010001dddddccccc001aaaaa1010011 },
-	{ "feq.d", /*            1010001dddddccccc010aaaaa1010011 */ 0xa2002053, 0xfe00707f, riscv_rv32d_1010001dddddccccc010aaaaa1010011 },
-	{ "fsgnj.s", /*          0010000dddddccccc000aaaaa1010011 */ 0x20000053, 0xfe00707f, riscv_rv32f_0010000dddddccccc000aaaaa1010011 },
-	{ "fsgnjn.s", /*         0010000dddddccccc001aaaaa1010011 */ 0x20001053, 0xfe00707f, riscv_rv32f_0010000dddddccccc001aaaaa1010011 },
-	{ "fsgnjx.s", /*         0010000dddddccccc010aaaaa1010011 */ 0x20002053, 0xfe00707f, riscv_rv32f_0010000dddddccccc010aaaaa1010011 },
-	{ "fmin.s", /*           0010100dddddccccc000aaaaa1010011 */ 0x28000053, 0xfe00707f, riscv_rv32f_0010100dddddccccc000aaaaa1010011 },
-	{ "fmax.s", /*           0010100dddddccccc001aaaaa1010011 */ 0x28001053, 0xfe00707f, riscv_rv32f_0010100dddddccccc001aaaaa1010011 },
-	{ "fle.s", /*            1010000dddddccccc000aaaaa1010011 */ 0xa0000053, 0xfe00707f, riscv_rv32f_1010000dddddccccc000aaaaa1010011 },
-	{ "flt.s", /*            1010000dddddccccc001aaaaa1010011 */ 0xa0001053, 0xfe00707f, riscv_rv32f_1010000dddddccccc001aaaaa1010011 },
-	{ "feq.s", /*            1010000dddddccccc010aaaaa1010011 */ 0xa0002053, 0xfe00707f, riscv_rv32f_1010000dddddccccc010aaaaa1010011 },
-	{ "add", /*              0000000dddddccccc000aaaaa0110011 */ 0x00000033, 0xfe00707f, riscv_rv32i_0000000dddddccccc000aaaaa0110011 },
-	{ "sub", /*              0100000dddddccccc000aaaaa0110011 */ 0x40000033, 0xfe00707f, riscv_rv32i_0100000dddddccccc000aaaaa0110011 },
-	{ "sll", /*              0000000dddddccccc001aaaaa0110011 */ 0x00001033, 0xfe00707f, riscv_rv32i_0000000dddddccccc001aaaaa0110011 },
-	{ "slt", /*              0000000dddddccccc010aaaaa0110011 */ 0x00002033, 0xfe00707f, riscv_rv32i_0000000dddddccccc010aaaaa0110011 },
-	{ "sltu", /*             0000000dddddccccc011aaaaa0110011 */ 0x00003033, 0xfe00707f, riscv_rv32i_0000000dddddccccc011aaaaa0110011 },
-	{ "xor", /*              0000000dddddccccc100aaaaa0110011 */ 0x00004033, 0xfe00707f, riscv_rv32i_0000000dddddccccc100aaaaa0110011 },
-	{ "srl", /*              0000000dddddccccc101aaaaa0110011 */ 0x00005033, 0xfe00707f, riscv_rv32i_0000000dddddccccc101aaaaa0110011 },
-	{ "sra", /*              0100000dddddccccc101aaaaa0110011 */ 0x40005033, 0xfe00707f, riscv_rv32i_0100000dddddccccc101aaaaa0110011 },
-	{ "or", /*               0000000dddddccccc110aaaaa0110011 */ 0x00006033, 0xfe00707f, riscv_rv32i_0000000dddddccccc110aaaaa0110011 },
-	{ "and", /*              0000000dddddccccc111aaaaa0110011 */ 0x00007033, 0xfe00707f, riscv_rv32i_0000000dddddccccc111aaaaa0110011 },
-	{ "sha512sum0r", /*      0101000dddddccccc000aaaaa0110011 */ 0x50000033, 0xfe00707f, riscv_rv32k_0101000dddddccccc000aaaaa0110011 },
-	{ "sha512sum1r", /*      0101001dddddccccc000aaaaa0110011 */ 0x52000033, 0xfe00707f, riscv_rv32k_0101001dddddccccc000aaaaa0110011 },
-	{ "sha512sig0l", /*      0101010dddddccccc000aaaaa0110011 */ 0x54000033, 0xfe00707f, riscv_rv32k_0101010dddddccccc000aaaaa0110011 },
-	{ "sha512sig0h", /*      0101110dddddccccc000aaaaa0110011 */ 0x5c000033, 0xfe00707f, riscv_rv32k_0101110dddddccccc000aaaaa0110011 },
-	{ "sha512sig1l", /*      0101011dddddccccc000aaaaa0110011 */ 0x56000033, 0xfe00707f, riscv_rv32k_0101011dddddccccc000aaaaa0110011 },
-	{ "sha512sig1h", /*      0101111dddddccccc000aaaaa0110011 */ 0x5e000033, 0xfe00707f, riscv_rv32k_0101111dddddccccc000aaaaa0110011 },
-	{ "mul", /*              0000001dddddccccc000aaaaa0110011 */ 0x02000033, 0xfe00707f, riscv_rv32m_0000001dddddccccc000aaaaa0110011 },
-	{ "mulh", /*             0000001dddddccccc001aaaaa0110011 */ 0x02001033, 0xfe00707f, riscv_rv32m_0000001dddddccccc001aaaaa0110011 },
-	{ "mulhsu", /*           0000001dddddccccc010aaaaa0110011 */ 0x02002033, 0xfe00707f, riscv_rv32m_0000001dddddccccc010aaaaa0110011 },
-	{ "mulhu", /*            0000001dddddccccc011aaaaa0110011 */ 0x02003033, 0xfe00707f, riscv_rv32m_0000001dddddccccc011aaaaa0110011 },
-	{ "div", /*              0000001dddddccccc100aaaaa0110011 */ 0x02004033, 0xfe00707f, riscv_rv32m_0000001dddddccccc100aaaaa0110011 },
-	{ "divu", /*             0000001dddddccccc101aaaaa0110011 */ 0x02005033, 0xfe00707f, riscv_rv32m_0000001dddddccccc101aaaaa0110011 },
-	{ "rem", /*              0000001dddddccccc110aaaaa0110011 */ 0x02006033, 0xfe00707f, riscv_rv32m_0000001dddddccccc110aaaaa0110011 },
-	{ "remu", /*             0000001dddddccccc111aaaaa0110011 */ 0x02007033, 0xfe00707f, riscv_rv32m_0000001dddddccccc111aaaaa0110011 },
-	{ "fsgnj.q", /*          0010011dddddccccc000aaaaa1010011 */ 0x26000053, 0xfe00707f, riscv_rv32q_0010011dddddccccc000aaaaa1010011 },
-	{ "fsgnjn.q", /*         0010011dddddccccc001aaaaa1010011 */ 0x26001053, 0xfe00707f, riscv_rv32q_0010011dddddccccc001aaaaa1010011 },
-	{ "fsgnjx.q", /*         0010011dddddccccc010aaaaa1010011 */ 0x26002053, 0xfe00707f, riscv_rv32q_0010011dddddccccc010aaaaa1010011 },
-	{ "fmin.q", /*           0010111dddddccccc000aaaaa1010011 */ 0x2e000053, 0xfe00707f, riscv_rv32q_0010111dddddccccc000aaaaa1010011 },
-	{ "fmax.q", /*           0010111dddddccccc001aaaaa1010011 */ 0x2e001053, 0xfe00707f, riscv_rv32q_0010111dddddccccc001aaaaa1010011 },
-	{ "fle.q", /*            1010011dddddccccc000aaaaa1010011 */ 0xa6000053, 0xfe00707f, riscv_rv32q_1010011dddddccccc000aaaaa1010011 },
-	{ "flt.q", /*            1010011dddddccccc001aaaaa1010011 */ 0xa6001053, 0xfe00707f, riscv_rv32q_1010011dddddccccc001aaaaa1010011 },
-	{ "feq.q", /*            1010011dddddccccc010aaaaa1010011 */ 0xa6002053, 0xfe00707f, riscv_rv32q_1010011dddddccccc010aaaaa1010011 },
-	{ "fsgnj.h", /*          0010010dddddccccc000aaaaa1010011 */ 0x24000053, 0xfe00707f, riscv_rv32zfh_0010010dddddccccc000aaaaa1010011 },
-	{ "fsgnjn.h", /*         0010010dddddccccc001aaaaa1010011 */ 0x24001053, 0xfe00707f, riscv_rv32zfh_0010010dddddccccc001aaaaa1010011 },
-	{ "fsgnjx.h", /*         0010010dddddccccc010aaaaa1010011 */ 0x24002053, 0xfe00707f, riscv_rv32zfh_0010010dddddccccc010aaaaa1010011 },
-	{ "fmin.h", /*           0010110dddddccccc000aaaaa1010011 */ 0x2c000053, 0xfe00707f, riscv_rv32zfh_0010110dddddccccc000aaaaa1010011 },
-	{ "fmax.h", /*           0010110dddddccccc001aaaaa1010011 */ 0x2c001053, 0xfe00707f, riscv_rv32zfh_0010110dddddccccc001aaaaa1010011 },
-	{ "fle.h", /*            1010010dddddccccc000aaaaa1010011 */ 0xa4000053, 0xfe00707f, riscv_rv32zfh_1010010dddddccccc000aaaaa1010011 },
-	{ "flt.h", /*            1010010dddddccccc001aaaaa1010011 */ 0xa4001053, 0xfe00707f, riscv_rv32zfh_1010010dddddccccc001aaaaa1010011 },
-	{ "feq.h", /*            1010010dddddccccc010aaaaa1010011 */ 0xa4002053, 0xfe00707f, riscv_rv32zfh_1010010dddddccccc010aaaaa1010011 },
-	{ "bmator", /*           0000100dddddccccc011aaaaa0110011 */ 0x08003033, 0xfe00707f, riscv_rv64b_0000100dddddccccc011aaaaa0110011 },
-	{ "bmatxor", /*          0100100dddddccccc011aaaaa0110011 */ 0x48003033, 0xfe00707f, riscv_rv64b_0100100dddddccccc011aaaaa0110011 },
-	{ "add.uw", /*           0000100dddddccccc000aaaaa0111011 */ 0x0800003b, 0xfe00707f, riscv_rv64b_0000100dddddccccc000aaaaa0111011 },
-	{ "slow", /*             0010000dddddccccc001aaaaa0111011 */ 0x2000103b, 0xfe00707f, riscv_rv64b_0010000dddddccccc001aaaaa0111011 },
-	{ "srow", /*             0010000dddddccccc101aaaaa0111011 */ 0x2000503b, 0xfe00707f, riscv_rv64b_0010000dddddccccc101aaaaa0111011 },
-	{ "rolw", /*             0110000dddddccccc001aaaaa0111011 */ 0x6000103b, 0xfe00707f, riscv_rv64b_0110000dddddccccc001aaaaa0111011 },
-	{ "rorw", /*             0110000dddddccccc101aaaaa0111011 */ 0x6000503b, 0xfe00707f, riscv_rv64b_0110000dddddccccc101aaaaa0111011 },
-	{ "gorcw", /*            0010100dddddccccc101aaaaa0111011 */ 0x2800503b, 0xfe00707f, riscv_rv64b_0010100dddddccccc101aaaaa0111011 },
-	{ "grevw", /*            0110100dddddccccc101aaaaa0111011 */ 0x6800503b, 0xfe00707f, riscv_rv64b_0110100dddddccccc101aaaaa0111011 },
-	{ "sloiw", /*            0010000uuuuuccccc001aaaaa0011011 */ 0x2000101b, 0xfe00707f, riscv_rv64b_0010000uuuuuccccc001aaaaa0011011 },
-	{ "sroiw", /*            0010000uuuuuccccc101aaaaa0011011 */ 0x2000501b, 0xfe00707f, riscv_rv64b_0010000uuuuuccccc101aaaaa0011011 },
-	{ "roriw", /*            0110000uuuuuccccc101aaaaa0011011 */ 0x6000501b, 0xfe00707f, riscv_rv64b_0110000uuuuuccccc101aaaaa0011011 },
-	{ "gorciw", /*           0010100uuuuuccccc101aaaaa0011011 */ 0x2800501b, 0xfe00707f, riscv_rv64b_0010100uuuuuccccc101aaaaa0011011 },
-	{ "greviw", /*           0110100uuuuuccccc101aaaaa0011011 */ 0x6800501b, 0xfe00707f, riscv_rv64b_0110100uuuuuccccc101aaaaa0011011 },
-	{ "sh1add.uw", /*        0010000dddddccccc010aaaaa0111011 */ 0x2000203b, 0xfe00707f, riscv_rv64b_0010000dddddccccc010aaaaa0111011 },
-	{ "sh2add.uw", /*        0010000dddddccccc100aaaaa0111011 */ 0x2000403b, 0xfe00707f, riscv_rv64b_0010000dddddccccc100aaaaa0111011 },
-	{ "sh3add.uw", /*        0010000dddddccccc110aaaaa0111011 */ 0x2000603b, 0xfe00707f, riscv_rv64b_0010000dddddccccc110aaaaa0111011 },
-	{ "shflw", /*            0000100dddddccccc001aaaaa0111011 */ 0x0800103b, 0xfe00707f, riscv_rv64b_0000100dddddccccc001aaaaa0111011 },
-	{ "unshflw", /*          0000100dddddccccc101aaaaa0111011 */ 0x0800503b, 0xfe00707f, riscv_rv64b_0000100dddddccccc101aaaaa0111011 },
-	{ "bcompressw", /*       0000100dddddccccc110aaaaa0111011 */ 0x0800603b, 0xfe00707f, riscv_rv64b_0000100dddddccccc110aaaaa0111011 },
-	{ "bdecompressw", /*     0100100dddddccccc110aaaaa0111011 */ 0x4800603b, 0xfe00707f, riscv_rv64b_0100100dddddccccc110aaaaa0111011 },
-	{ "packw", /*            0000100dddddccccc100aaaaa0111011 */ 0x0800403b, 0xfe00707f, riscv_rv64b_0000100dddddccccc100aaaaa0111011 },
-	{ "packuw", /*           0100100dddddccccc100aaaaa0111011 */ 0x4800403b, 0xfe00707f, riscv_rv64b_0100100dddddccccc100aaaaa0111011 },
-	{ "bfpw", /*             0100100dddddccccc111aaaaa0111011 */ 0x4800703b, 0xfe00707f, riscv_rv64b_0100100dddddccccc111aaaaa0111011 },
-	{ "xperm32", /*          0010100dddddccccc000aaaaa0110011 */ 0x28000033, 0xfe00707f, riscv_rv64b_0010100dddddccccc000aaaaa0110011 },
-	{ "slliw", /*            0000000uuuuuccccc001aaaaa0011011 */ 0x0000101b, 0xfe00707f, riscv_rv64i_0000000uuuuuccccc001aaaaa0011011 },
-	{ "srliw", /*            0000000uuuuuccccc101aaaaa0011011 */ 0x0000501b, 0xfe00707f, riscv_rv64i_0000000uuuuuccccc101aaaaa0011011 },
-	{ "sraiw", /*            0100000uuuuuccccc101aaaaa0011011 */ 0x4000501b, 0xfe00707f, riscv_rv64i_0100000uuuuuccccc101aaaaa0011011 },
-	{ "addw", /*             0000000dddddccccc000aaaaa0111011 */ 0x0000003b, 0xfe00707f, riscv_rv64i_0000000dddddccccc000aaaaa0111011 },
-	{ "subw", /*             0100000dddddccccc000aaaaa0111011 */ 0x4000003b, 0xfe00707f, riscv_rv64i_0100000dddddccccc000aaaaa0111011 },
-	{ "sllw", /*             0000000dddddccccc001aaaaa0111011 */ 0x0000103b, 0xfe00707f, riscv_rv64i_0000000dddddccccc001aaaaa0111011 },
-	{ "srlw", /*             0000000dddddccccc101aaaaa0111011 */ 0x0000503b, 0xfe00707f, riscv_rv64i_0000000dddddccccc101aaaaa0111011 },
-	{ "sraw", /*             0100000dddddccccc101aaaaa0111011 */ 0x4000503b, 0xfe00707f, riscv_rv64i_0100000dddddccccc101aaaaa0111011 },
-	{ "aes64ks2", /*         0111111dddddccccc000aaaaa0110011 */ 0x7e000033, 0xfe00707f, riscv_rv64k_0111111dddddccccc000aaaaa0110011 },
-	{ "aes64esm", /*         0011011dddddccccc000aaaaa0110011 */ 0x36000033, 0xfe00707f, riscv_rv64k_0011011dddddccccc000aaaaa0110011 },
-	{ "aes64es", /*          0011001dddddccccc000aaaaa0110011 */ 0x32000033, 0xfe00707f, riscv_rv64k_0011001dddddccccc000aaaaa0110011 },
-	{ "aes64dsm", /*         0011111dddddccccc000aaaaa0110011 */ 0x3e000033, 0xfe00707f, riscv_rv64k_0011111dddddccccc000aaaaa0110011 },
-	{ "aes64ds", /*          0011101dddddccccc000aaaaa0110011 */ 0x3a000033, 0xfe00707f, riscv_rv64k_0011101dddddccccc000aaaaa0110011 },
-	{ "mulw", /*             0000001dddddccccc000aaaaa0111011 */ 0x0200003b, 0xfe00707f, riscv_rv64m_0000001dddddccccc000aaaaa0111011 },
-	{ "divw", /*             0000001dddddccccc100aaaaa0111011 */ 0x0200403b, 0xfe00707f, riscv_rv64m_0000001dddddccccc100aaaaa0111011 },
-	{ "divuw", /*            0000001dddddccccc101aaaaa0111011 */ 0x0200503b, 0xfe00707f, riscv_rv64m_0000001dddddccccc101aaaaa0111011 },
-	{ "remw", /*             0000001dddddccccc110aaaaa0111011 */ 0x0200603b, 0xfe00707f, riscv_rv64m_0000001dddddccccc110aaaaa0111011 },
-	{ "remuw", /*            0000001dddddccccc111aaaaa0111011 */ 0x0200703b, 0xfe00707f, riscv_rv64m_0000001dddddccccc111aaaaa0111011 },
-	{ "add8", /*             0100100dddddccccc000aaaaa1110111 */ 0x48000077, 0xfe00707f, riscv_rvp_0100100dddddccccc000aaaaa1110111 },
-	{ "add16", /*            0100000dddddccccc000aaaaa1110111 */ 0x40000077, 0xfe00707f, riscv_rvp_0100000dddddccccc000aaaaa1110111 },
-	{ "add64", /*            1100000dddddccccc001aaaaa1110111 */ 0xc0001077, 0xfe00707f, riscv_rvp_1100000dddddccccc001aaaaa1110111 },
-	{ "ave", /*              1110000dddddccccc000aaaaa1110111 */ 0xe0000077, 0xfe00707f, riscv_rvp_1110000dddddccccc000aaaaa1110111 },
-	{ "bitrev", /*           1110011dddddccccc000aaaaa1110111 */ 0xe6000077, 0xfe00707f, riscv_rvp_1110011dddddccccc000aaaaa1110111 },
-	{ "cmpeq8", /*           0100111dddddccccc000aaaaa1110111 */ 0x4e000077, 0xfe00707f, riscv_rvp_0100111dddddccccc000aaaaa1110111 },
-	{ "cmpeq16", /*          0100110dddddccccc000aaaaa1110111 */ 0x4c000077, 0xfe00707f, riscv_rvp_0100110dddddccccc000aaaaa1110111 },
-	{ "cras16", /*           0100010dddddccccc000aaaaa1110111 */ 0x44000077, 0xfe00707f, riscv_rvp_0100010dddddccccc000aaaaa1110111 },
-	{ "crsa16", /*           0100011dddddccccc000aaaaa1110111 */ 0x46000077, 0xfe00707f, riscv_rvp_0100011dddddccccc000aaaaa1110111 },
-	{ "kadd8", /*            0001100dddddccccc000aaaaa1110111 */ 0x18000077, 0xfe00707f, riscv_rvp_0001100dddddccccc000aaaaa1110111 },
-	{ "kadd16", /*           0001000dddddccccc000aaaaa1110111 */ 0x10000077, 0xfe00707f, riscv_rvp_0001000dddddccccc000aaaaa1110111 },
-	{ "kadd64", /*           1001000dddddccccc001aaaaa1110111 */ 0x90001077, 0xfe00707f, riscv_rvp_1001000dddddccccc001aaaaa1110111 },
-	{ "kaddh", /*            0000010dddddccccc001aaaaa1110111 */ 0x04001077, 0xfe00707f, riscv_rvp_0000010dddddccccc001aaaaa1110111 },
-	{ "kaddw", /*            0000000dddddccccc001aaaaa1110111 */ 0x00001077, 0xfe00707f, riscv_rvp_0000000dddddccccc001aaaaa1110111 },
-	{ "kcras16", /*          0001010dddddccccc000aaaaa1110111 */ 0x14000077, 0xfe00707f, riscv_rvp_0001010dddddccccc000aaaaa1110111 },
-	{ "kcrsa16", /*          0001011dddddccccc000aaaaa1110111 */ 0x16000077, 0xfe00707f, riscv_rvp_0001011dddddccccc000aaaaa1110111 },
-	{ "kdmbb", /*            0000101dddddccccc001aaaaa1110111 */ 0x0a001077, 0xfe00707f, riscv_rvp_0000101dddddccccc001aaaaa1110111 },
-	{ "kdmbt", /*            0001101dddddccccc001aaaaa1110111 */ 0x1a001077, 0xfe00707f, riscv_rvp_0001101dddddccccc001aaaaa1110111 },
-	{ "kdmtt", /*            0010101dddddccccc001aaaaa1110111 */ 0x2a001077, 0xfe00707f, riscv_rvp_0010101dddddccccc001aaaaa1110111 },
-	{ "kdmabb", /*           1101001dddddccccc001aaaaa1110111 */ 0xd2001077, 0xfe00707f, riscv_rvp_1101001dddddccccc001aaaaa1110111 },
-	{ "kdmabt", /*           1110001dddddccccc001aaaaa1110111 */ 0xe2001077, 0xfe00707f, riscv_rvp_1110001dddddccccc001aaaaa1110111 },
-	{ "kdmatt", /*           1111001dddddccccc001aaaaa1110111 */ 0xf2001077, 0xfe00707f, riscv_rvp_1111001dddddccccc001aaaaa1110111 },
-	{ "khm8", /*             1000111dddddccccc000aaaaa1110111 */ 0x8e000077, 0xfe00707f, riscv_rvp_1000111dddddccccc000aaaaa1110111 },
-	{ "khmx8", /*            1001111dddddccccc000aaaaa1110111 */ 0x9e000077, 0xfe00707f, riscv_rvp_1001111dddddccccc000aaaaa1110111 },
-	{ "khm16", /*            1000011dddddccccc000aaaaa1110111 */ 0x86000077, 0xfe00707f, riscv_rvp_1000011dddddccccc000aaaaa1110111 },
-	{ "khmx16", /*           1001011dddddccccc000aaaaa1110111 */ 0x96000077, 0xfe00707f, riscv_rvp_1001011dddddccccc000aaaaa1110111 },
-	{ "khmbb", /*            0000110dddddccccc001aaaaa1110111 */ 0x0c001077, 0xfe00707f, riscv_rvp_0000110dddddccccc001aaaaa1110111 },
-	{ "khmbt", /*            0001110dddddccccc001aaaaa1110111 */ 0x1c001077, 0xfe00707f, riscv_rvp_0001110dddddccccc001aaaaa1110111 },
-	{ "khmtt", /*            0010110dddddccccc001aaaaa1110111 */ 0x2c001077, 0xfe00707f, riscv_rvp_0010110dddddccccc001aaaaa1110111 },
-	{ "kmabb", /*            0101101dddddccccc001aaaaa1110111 */ 0x5a001077, 0xfe00707f, riscv_rvp_0101101dddddccccc001aaaaa1110111 },
-	{ "kmabt", /*            0110101dddddccccc001aaaaa1110111 */ 0x6a001077, 0xfe00707f, riscv_rvp_0110101dddddccccc001aaaaa1110111 },
-	{ "kmatt", /*            0111101dddddccccc001aaaaa1110111 */ 0x7a001077, 0xfe00707f, riscv_rvp_0111101dddddccccc001aaaaa1110111 },
-	{ "kmada", /*            0100100dddddccccc001aaaaa1110111 */ 0x48001077, 0xfe00707f, riscv_rvp_0100100dddddccccc001aaaaa1110111 },
-	{ "kmaxda", /*           0100101dddddccccc001aaaaa1110111 */ 0x4a001077, 0xfe00707f, riscv_rvp_0100101dddddccccc001aaaaa1110111 },
-	{ "kmads", /*            0101110dddddccccc001aaaaa1110111 */ 0x5c001077, 0xfe00707f, riscv_rvp_0101110dddddccccc001aaaaa1110111 },
-	{ "kmadrs", /*           0110110dddddccccc001aaaaa1110111 */ 0x6c001077, 0xfe00707f, riscv_rvp_0110110dddddccccc001aaaaa1110111 },
-	{ "kmaxds", /*           0111110dddddccccc001aaaaa1110111 */ 0x7c001077, 0xfe00707f, riscv_rvp_0111110dddddccccc001aaaaa1110111 },
-	{ "kmar64", /*           1001010dddddccccc001aaaaa1110111 */ 0x94001077, 0xfe00707f, riscv_rvp_1001010dddddccccc001aaaaa1110111 },
-	{ "kmda", /*             0011100dddddccccc001aaaaa1110111 */ 0x38001077, 0xfe00707f, riscv_rvp_0011100dddddccccc001aaaaa1110111 },
-	{ "kmxda", /*            0011101dddddccccc001aaaaa1110111 */ 0x3a001077, 0xfe00707f, riscv_rvp_0011101dddddccccc001aaaaa1110111 },
-	{ "kmmac", /*            0110000dddddccccc001aaaaa1110111 */ 0x60001077, 0xfe00707f, riscv_rvp_0110000dddddccccc001aaaaa1110111 },
-	{ "kmmac.u", /*          0111000dddddccccc001aaaaa1110111 */ 0x70001077, 0xfe00707f, riscv_rvp_0111000dddddccccc001aaaaa1110111 },
-	{ "kmmawb", /*           0100011dddddccccc001aaaaa1110111 */ 0x46001077, 0xfe00707f, riscv_rvp_0100011dddddccccc001aaaaa1110111 },
-	{ "kmmawb.u", /*         0101011dddddccccc001aaaaa1110111 */ 0x56001077, 0xfe00707f, riscv_rvp_0101011dddddccccc001aaaaa1110111 },
-	{ "kmmawb2", /*          1100111dddddccccc001aaaaa1110111 */ 0xce001077, 0xfe00707f, riscv_rvp_1100111dddddccccc001aaaaa1110111 },
-	{ "kmmawb2.u", /*        1101111dddddccccc001aaaaa1110111 */ 0xde001077, 0xfe00707f, riscv_rvp_1101111dddddccccc001aaaaa1110111 },
-	{ "kmmawt", /*           0110011dddddccccc001aaaaa1110111 */ 0x66001077, 0xfe00707f, riscv_rvp_0110011dddddccccc001aaaaa1110111 },
-	{ "kmmawt.u", /*         0111011dddddccccc001aaaaa1110111 */ 0x76001077, 0xfe00707f, riscv_rvp_0111011dddddccccc001aaaaa1110111 },
-	{ "kmmawt2", /*          1110111dddddccccc001aaaaa1110111 */ 0xee001077, 0xfe00707f, riscv_rvp_1110111dddddccccc001aaaaa1110111 },
-	{ "kmmawt2.u", /*        1111111dddddccccc001aaaaa1110111 */ 0xfe001077, 0xfe00707f, riscv_rvp_1111111dddddccccc001aaaaa1110111 },
-	{ "kmmsb", /*            0100001dddddccccc001aaaaa1110111 */ 0x42001077, 0xfe00707f, riscv_rvp_0100001dddddccccc001aaaaa1110111 },
-	{ "kmmsb.u", /*          0101001dddddccccc001aaaaa1110111 */ 0x52001077, 0xfe00707f, riscv_rvp_0101001dddddccccc001aaaaa1110111 },
-	{ "kmmwb2", /*           1000111dddddccccc001aaaaa1110111 */ 0x8e001077, 0xfe00707f, riscv_rvp_1000111dddddccccc001aaaaa1110111 },
-	{ "kmmwb2.u", /*         1001111dddddccccc001aaaaa1110111 */ 0x9e001077, 0xfe00707f, riscv_rvp_1001111dddddccccc001aaaaa1110111 },
-	{ "kmmwt2", /*           1010111dddddccccc001aaaaa1110111 */ 0xae001077, 0xfe00707f, riscv_rvp_1010111dddddccccc001aaaaa1110111 },
-	{ "kmmwt2.u", /*         1011111dddddccccc001aaaaa1110111 */ 0xbe001077, 0xfe00707f, riscv_rvp_1011111dddddccccc001aaaaa1110111 },
-	{ "kmsda", /*            0100110dddddccccc001aaaaa1110111 */ 0x4c001077, 0xfe00707f, riscv_rvp_0100110dddddccccc001aaaaa1110111 },
-	{ "kmsxda", /*           0100111dddddccccc001aaaaa1110111 */ 0x4e001077, 0xfe00707f, riscv_rvp_0100111dddddccccc001aaaaa1110111 },
-	{ "kmsr64", /*           1001011dddddccccc001aaaaa1110111 */ 0x96001077, 0xfe00707f, riscv_rvp_1001011dddddccccc001aaaaa1110111 },
-	{ "ksllw", /*            0010011dddddccccc001aaaaa1110111 */ 0x26001077, 0xfe00707f, riscv_rvp_0010011dddddccccc001aaaaa1110111 },
-	{ "kslliw", /*           0011011BBBBBccccc001aaaaa1110111 */ 0x36001077, 0xfe00707f, riscv_rvp_0011011BBBBBccccc001aaaaa1110111 },
-	{ "ksll8", /*            0110110dddddccccc000aaaaa1110111 */ 0x6c000077, 0xfe00707f, riscv_rvp_0110110dddddccccc000aaaaa1110111 },
-	{ "ksll16", /*           0110010dddddccccc000aaaaa1110111 */ 0x64000077, 0xfe00707f, riscv_rvp_0110010dddddccccc000aaaaa1110111 },
-	{ "kslra8", /*           0101111dddddccccc000aaaaa1110111 */ 0x5e000077, 0xfe00707f, riscv_rvp_0101111dddddccccc000aaaaa1110111 },
-	{ "kslra8.u", /*         0110111dddddccccc000aaaaa1110111 */ 0x6e000077, 0xfe00707f, riscv_rvp_0110111dddddccccc000aaaaa1110111 },
-	{ "kslra16", /*          0101011dddddccccc000aaaaa1110111 */ 0x56000077, 0xfe00707f, riscv_rvp_0101011dddddccccc000aaaaa1110111 },
-	{ "kslra16.u", /*        0110011dddddccccc000aaaaa1110111 */ 0x66000077, 0xfe00707f, riscv_rvp_0110011dddddccccc000aaaaa1110111 },
-	{ "kslraw", /*           0110111dddddccccc001aaaaa1110111 */ 0x6e001077, 0xfe00707f, riscv_rvp_0110111dddddccccc001aaaaa1110111 },
-	{ "kslraw.u", /*         0111111dddddccccc001aaaaa1110111 */ 0x7e001077, 0xfe00707f, riscv_rvp_0111111dddddccccc001aaaaa1110111 },
-	{ "kstas16", /*          1100010dddddccccc010aaaaa1110111 */ 0xc4002077, 0xfe00707f, riscv_rvp_1100010dddddccccc010aaaaa1110111 },
-	{ "kstsa16", /*          1100011dddddccccc010aaaaa1110111 */ 0xc6002077, 0xfe00707f, riscv_rvp_1100011dddddccccc010aaaaa1110111 },
-	{ "ksub8", /*            0001101dddddccccc000aaaaa1110111 */ 0x1a000077, 0xfe00707f, riscv_rvp_0001101dddddccccc000aaaaa1110111 },
-	{ "ksub16", /*           0001001dddddccccc000aaaaa1110111 */ 0x12000077, 0xfe00707f, riscv_rvp_0001001dddddccccc000aaaaa1110111 },
-	{ "ksub64", /*           1001001dddddccccc001aaaaa1110111 */ 0x92001077, 0xfe00707f, riscv_rvp_1001001dddddccccc001aaaaa1110111 },
-	{ "ksubh", /*            0000011dddddccccc001aaaaa1110111 */ 0x06001077, 0xfe00707f, riscv_rvp_0000011dddddccccc001aaaaa1110111 },
-	{ "ksubw", /*            0000001dddddccccc001aaaaa1110111 */ 0x02001077, 0xfe00707f, riscv_rvp_0000001dddddccccc001aaaaa1110111 },
-	{ "kwmmul", /*           0110001dddddccccc001aaaaa1110111 */ 0x62001077, 0xfe00707f, riscv_rvp_0110001dddddccccc001aaaaa1110111 },
-	{ "kwmmul.u", /*         0111001dddddccccc001aaaaa1110111 */ 0x72001077, 0xfe00707f, riscv_rvp_0111001dddddccccc001aaaaa1110111 },
-	{ "maddr32", /*          1100010dddddccccc001aaaaa1110111 */ 0xc4001077, 0xfe00707f, riscv_rvp_1100010dddddccccc001aaaaa1110111 },
-	{ "maxw", /*             1111001dddddccccc000aaaaa1110111 */ 0xf2000077, 0xfe00707f, riscv_rvp_1111001dddddccccc000aaaaa1110111 },
-	{ "minw", /*             1111000dddddccccc000aaaaa1110111 */ 0xf0000077, 0xfe00707f, riscv_rvp_1111000dddddccccc000aaaaa1110111 },
-	{ "msubr32", /*          1100011dddddccccc001aaaaa1110111 */ 0xc6001077, 0xfe00707f, riscv_rvp_1100011dddddccccc001aaaaa1110111 },
-	{ "mulr64", /*           1111000dddddccccc001aaaaa1110111 */ 0xf0001077, 0xfe00707f, riscv_rvp_1111000dddddccccc001aaaaa1110111 },
-	{ "mulsr64", /*          1110000dddddccccc001aaaaa1110111 */ 0xe0001077, 0xfe00707f, riscv_rvp_1110000dddddccccc001aaaaa1110111 },
-	{ "pbsad", /*            1111110dddddccccc000aaaaa1110111 */ 0xfc000077, 0xfe00707f, riscv_rvp_1111110dddddccccc000aaaaa1110111 },
-	{ "pbsada", /*           1111111dddddccccc000aaaaa1110111 */ 0xfe000077, 0xfe00707f, riscv_rvp_1111111dddddccccc000aaaaa1110111 },
-	{ "pkbb16", /*           0000111dddddccccc001aaaaa1110111 */ 0x0e001077, 0xfe00707f, riscv_rvp_0000111dddddccccc001aaaaa1110111 },
-	{ "pkbt16", /*           0001111dddddccccc001aaaaa1110111 */ 0x1e001077, 0xfe00707f, riscv_rvp_0001111dddddccccc001aaaaa1110111 },
-	{ "pktt16", /*           0010111dddddccccc001aaaaa1110111 */ 0x2e001077, 0xfe00707f, riscv_rvp_0010111dddddccccc001aaaaa1110111 },
-	{ "pktb16", /*           0011111dddddccccc001aaaaa1110111 */ 0x3e001077, 0xfe00707f, riscv_rvp_0011111dddddccccc001aaaaa1110111 },
-	{ "radd8", /*            0000100dddddccccc000aaaaa1110111 */ 0x08000077, 0xfe00707f, riscv_rvp_0000100dddddccccc000aaaaa1110111 },
-	{ "radd16", /*           0000000dddddccccc000aaaaa1110111 */ 0x00000077, 0xfe00707f, riscv_rvp_0000000dddddccccc000aaaaa1110111 },
-	{ "radd64", /*           1000000dddddccccc001aaaaa1110111 */ 0x80001077, 0xfe00707f, riscv_rvp_1000000dddddccccc001aaaaa1110111 },
-	{ "raddw", /*            0010000dddddccccc001aaaaa1110111 */ 0x20001077, 0xfe00707f, riscv_rvp_0010000dddddccccc001aaaaa1110111 },
-	{ "rcras16", /*          0000010dddddccccc000aaaaa1110111 */ 0x04000077, 0xfe00707f, riscv_rvp_0000010dddddccccc000aaaaa1110111 },
-	{ "rcrsa16", /*          0000011dddddccccc000aaaaa1110111 */ 0x06000077, 0xfe00707f, riscv_rvp_0000011dddddccccc000aaaaa1110111 },
-	{ "rstas16", /*          1011010dddddccccc010aaaaa1110111 */ 0xb4002077, 0xfe00707f, riscv_rvp_1011010dddddccccc010aaaaa1110111 },
-	{ "rstsa16", /*          1011011dddddccccc010aaaaa1110111 */ 0xb6002077, 0xfe00707f, riscv_rvp_1011011dddddccccc010aaaaa1110111 },
-	{ "rsub8", /*            0000101dddddccccc000aaaaa1110111 */ 0x0a000077, 0xfe00707f, riscv_rvp_0000101dddddccccc000aaaaa1110111 },
-	{ "rsub16", /*           0000001dddddccccc000aaaaa1110111 */ 0x02000077, 0xfe00707f, riscv_rvp_0000001dddddccccc000aaaaa1110111 },
-	{ "rsub64", /*           1000001dddddccccc001aaaaa1110111 */ 0x82001077, 0xfe00707f, riscv_rvp_1000001dddddccccc001aaaaa1110111 },
-	{ "rsubw", /*            0010001dddddccccc001aaaaa1110111 */ 0x22001077, 0xfe00707f, riscv_rvp_0010001dddddccccc001aaaaa1110111 },
-	{ "sclip32", /*          1110010BBBBBccccc000aaaaa1110111 */ 0xe4000077, 0xfe00707f, riscv_rvp_1110010BBBBBccccc000aaaaa1110111 },
-	{ "scmple8", /*          0001111dddddccccc000aaaaa1110111 */ 0x1e000077, 0xfe00707f, riscv_rvp_0001111dddddccccc000aaaaa1110111 },
-	{ "scmple16", /*         0001110dddddccccc000aaaaa1110111 */ 0x1c000077, 0xfe00707f, riscv_rvp_0001110dddddccccc000aaaaa1110111 },
-	{ "scmplt8", /*          0000111dddddccccc000aaaaa1110111 */ 0x0e000077, 0xfe00707f, riscv_rvp_0000111dddddccccc000aaaaa1110111 },
-	{ "scmplt16", /*         0000110dddddccccc000aaaaa1110111 */ 0x0c000077, 0xfe00707f, riscv_rvp_0000110dddddccccc000aaaaa1110111 },
-	{ "sll8", /*             0101110dddddccccc000aaaaa1110111 */ 0x5c000077, 0xfe00707f, riscv_rvp_0101110dddddccccc000aaaaa1110111 },
-	{ "sll16", /*            0101010dddddccccc000aaaaa1110111 */ 0x54000077, 0xfe00707f, riscv_rvp_0101010dddddccccc000aaaaa1110111 },
-	{ "smal", /*             0101111dddddccccc001aaaaa1110111 */ 0x5e001077, 0xfe00707f, riscv_rvp_0101111dddddccccc001aaaaa1110111 },
-	{ "smalbb", /*           1000100dddddccccc001aaaaa1110111 */ 0x88001077, 0xfe00707f, riscv_rvp_1000100dddddccccc001aaaaa1110111 },
-	{ "smalbt", /*           1001100dddddccccc001aaaaa1110111 */ 0x98001077, 0xfe00707f, riscv_rvp_1001100dddddccccc001aaaaa1110111 },
-	{ "smaltt", /*           1010100dddddccccc001aaaaa1110111 */ 0xa8001077, 0xfe00707f, riscv_rvp_1010100dddddccccc001aaaaa1110111 },
-	{ "smalda", /*           1000110dddddccccc001aaaaa1110111 */ 0x8c001077, 0xfe00707f, riscv_rvp_1000110dddddccccc001aaaaa1110111 },
-	{ "smalxda", /*          1001110dddddccccc001aaaaa1110111 */ 0x9c001077, 0xfe00707f, riscv_rvp_1001110dddddccccc001aaaaa1110111 },
-	{ "smalds", /*           1000101dddddccccc001aaaaa1110111 */ 0x8a001077, 0xfe00707f, riscv_rvp_1000101dddddccccc001aaaaa1110111 },
-	{ "smaldrs", /*          1001101dddddccccc001aaaaa1110111 */ 0x9a001077, 0xfe00707f, riscv_rvp_1001101dddddccccc001aaaaa1110111 },
-	{ "smalxds", /*          1010101dddddccccc001aaaaa1110111 */ 0xaa001077, 0xfe00707f, riscv_rvp_1010101dddddccccc001aaaaa1110111 },
-	{ "smar64", /*           1000010dddddccccc001aaaaa1110111 */ 0x84001077, 0xfe00707f, riscv_rvp_1000010dddddccccc001aaaaa1110111 },
-	{ "smaqa", /*            1100100dddddccccc000aaaaa1110111 */ 0xc8000077, 0xfe00707f, riscv_rvp_1100100dddddccccc000aaaaa1110111 },
-	{ "smaqa.su", /*         1100101dddddccccc000aaaaa1110111 */ 0xca000077, 0xfe00707f, riscv_rvp_1100101dddddccccc000aaaaa1110111 },
-	{ "smax8", /*            1000101dddddccccc000aaaaa1110111 */ 0x8a000077, 0xfe00707f, riscv_rvp_1000101dddddccccc000aaaaa1110111 },
-	{ "smax16", /*           1000001dddddccccc000aaaaa1110111 */ 0x82000077, 0xfe00707f, riscv_rvp_1000001dddddccccc000aaaaa1110111 },
-	{ "smbb16", /*           0000100dddddccccc001aaaaa1110111 */ 0x08001077, 0xfe00707f, riscv_rvp_0000100dddddccccc001aaaaa1110111 },
-	{ "smbt16", /*           0001100dddddccccc001aaaaa1110111 */ 0x18001077, 0xfe00707f, riscv_rvp_0001100dddddccccc001aaaaa1110111 },
-	{ "smtt16", /*           0010100dddddccccc001aaaaa1110111 */ 0x28001077, 0xfe00707f, riscv_rvp_0010100dddddccccc001aaaaa1110111 },
-	{ "smds", /*             0101100dddddccccc001aaaaa1110111 */ 0x58001077, 0xfe00707f, riscv_rvp_0101100dddddccccc001aaaaa1110111 },
-	{ "smdrs", /*            0110100dddddccccc001aaaaa1110111 */ 0x68001077, 0xfe00707f, riscv_rvp_0110100dddddccccc001aaaaa1110111 },
-	{ "smxds", /*            0111100dddddccccc001aaaaa1110111 */ 0x78001077, 0xfe00707f, riscv_rvp_0111100dddddccccc001aaaaa1110111 },
-	{ "smin8", /*            1000100dddddccccc000aaaaa1110111 */ 0x88000077, 0xfe00707f, riscv_rvp_1000100dddddccccc000aaaaa1110111 },
-	{ "smin16", /*           1000000dddddccccc000aaaaa1110111 */ 0x80000077, 0xfe00707f, riscv_rvp_1000000dddddccccc000aaaaa1110111 },
-	{ "smmul", /*            0100000dddddccccc001aaaaa1110111 */ 0x40001077, 0xfe00707f, riscv_rvp_0100000dddddccccc001aaaaa1110111 },
-	{ "smmul.u", /*          0101000dddddccccc001aaaaa1110111 */ 0x50001077, 0xfe00707f, riscv_rvp_0101000dddddccccc001aaaaa1110111 },
-	{ "smmwb", /*            0100010dddddccccc001aaaaa1110111 */ 0x44001077, 0xfe00707f, riscv_rvp_0100010dddddccccc001aaaaa1110111 },
-	{ "smmwb.u", /*          0101010dddddccccc001aaaaa1110111 */ 0x54001077, 0xfe00707f, riscv_rvp_0101010dddddccccc001aaaaa1110111 },
-	{ "smmwt", /*            0110010dddddccccc001aaaaa1110111 */ 0x64001077, 0xfe00707f, riscv_rvp_0110010dddddccccc001aaaaa1110111 },
-	{ "smmwt.u", /*          0111010dddddccccc001aaaaa1110111 */ 0x74001077, 0xfe00707f, riscv_rvp_0111010dddddccccc001aaaaa1110111 },
-	{ "smslda", /*           1010110dddddccccc001aaaaa1110111 */ 0xac001077, 0xfe00707f, riscv_rvp_1010110dddddccccc001aaaaa1110111 },
-	{ "smslxda", /*          1011110dddddccccc001aaaaa1110111 */ 0xbc001077, 0xfe00707f, riscv_rvp_1011110dddddccccc001aaaaa1110111 },
-	{ "smsr64", /*           1000011dddddccccc001aaaaa1110111 */ 0x86001077, 0xfe00707f, riscv_rvp_1000011dddddccccc001aaaaa1110111 },
-	{ "smul8", /*            1010100dddddccccc000aaaaa1110111 */ 0xa8000077, 0xfe00707f, riscv_rvp_1010100dddddccccc000aaaaa1110111 },
-	{ "smulx8", /*           1010101dddddccccc000aaaaa1110111 */ 0xaa000077, 0xfe00707f, riscv_rvp_1010101dddddccccc000aaaaa1110111 },
-	{ "smul16", /*           1010000dddddccccc000aaaaa1110111 */ 0xa0000077, 0xfe00707f, riscv_rvp_1010000dddddccccc000aaaaa1110111 },
-	{ "smulx16", /*          1010001dddddccccc000aaaaa1110111 */ 0xa2000077, 0xfe00707f, riscv_rvp_1010001dddddccccc000aaaaa1110111 },
-	{ "sra.u", /*            0010010dddddccccc001aaaaa1110111 */ 0x24001077, 0xfe00707f, riscv_rvp_0010010dddddccccc001aaaaa1110111 },
-	{ "sra8", /*             0101100dddddccccc000aaaaa1110111 */ 0x58000077, 0xfe00707f, riscv_rvp_0101100dddddccccc000aaaaa1110111 },
-	{ "sra8.u", /*           0110100dddddccccc000aaaaa1110111 */ 0x68000077, 0xfe00707f, riscv_rvp_0110100dddddccccc000aaaaa1110111 },
-	{ "sra16", /*            0101000dddddccccc000aaaaa1110111 */ 0x50000077, 0xfe00707f, riscv_rvp_0101000dddddccccc000aaaaa1110111 },
-	{ "sra16.u", /*          0110000dddddccccc000aaaaa1110111 */ 0x60000077, 0xfe00707f, riscv_rvp_0110000dddddccccc000aaaaa1110111 },
-	{ "srl8", /*             0101101dddddccccc000aaaaa1110111 */ 0x5a000077, 0xfe00707f, riscv_rvp_0101101dddddccccc000aaaaa1110111 },
-	{ "srl8.u", /*           0110101dddddccccc000aaaaa1110111 */ 0x6a000077, 0xfe00707f, riscv_rvp_0110101dddddccccc000aaaaa1110111 },
-	{ "srl16", /*            0101001dddddccccc000aaaaa1110111 */ 0x52000077, 0xfe00707f, riscv_rvp_0101001dddddccccc000aaaaa1110111 },
-	{ "srl16.u", /*          0110001dddddccccc000aaaaa1110111 */ 0x62000077, 0xfe00707f, riscv_rvp_0110001dddddccccc000aaaaa1110111 },
-	{ "stas16", /*           1111010dddddccccc010aaaaa1110111 */ 0xf4002077, 0xfe00707f, riscv_rvp_1111010dddddccccc010aaaaa1110111 },
-	{ "stsa16", /*           1111011dddddccccc010aaaaa1110111 */ 0xf6002077, 0xfe00707f, riscv_rvp_1111011dddddccccc010aaaaa1110111 },
-	{ "sub8", /*             0100101dddddccccc000aaaaa1110111 */ 0x4a000077, 0xfe00707f, riscv_rvp_0100101dddddccccc000aaaaa1110111 },
-	{ "sub16", /*            0100001dddddccccc000aaaaa1110111 */ 0x42000077, 0xfe00707f, riscv_rvp_0100001dddddccccc000aaaaa1110111 },
-	{ "sub64", /*            1100001dddddccccc001aaaaa1110111 */ 0xc2001077, 0xfe00707f, riscv_rvp_1100001dddddccccc001aaaaa1110111 },
-	{ "uclip32", /*          1111010BBBBBccccc000aaaaa1110111 */ 0xf4000077, 0xfe00707f, riscv_rvp_1111010BBBBBccccc000aaaaa1110111 },
-	{ "ucmple8", /*          0011111dddddccccc000aaaaa1110111 */ 0x3e000077, 0xfe00707f, riscv_rvp_0011111dddddccccc000aaaaa1110111 },
-	{ "ucmple16", /*         0011110dddddccccc000aaaaa1110111 */ 0x3c000077, 0xfe00707f, riscv_rvp_0011110dddddccccc000aaaaa1110111 },
-	{ "ucmplt8", /*          0010111dddddccccc000aaaaa1110111 */ 0x2e000077, 0xfe00707f, riscv_rvp_0010111dddddccccc000aaaaa1110111 },
-	{ "ucmplt16", /*         0010110dddddccccc000aaaaa1110111 */ 0x2c000077, 0xfe00707f, riscv_rvp_0010110dddddccccc000aaaaa1110111 },
-	{ "ukadd8", /*           0011100dddddccccc000aaaaa1110111 */ 0x38000077, 0xfe00707f, riscv_rvp_0011100dddddccccc000aaaaa1110111 },
-	{ "ukadd16", /*          0011000dddddccccc000aaaaa1110111 */ 0x30000077, 0xfe00707f, riscv_rvp_0011000dddddccccc000aaaaa1110111 },
-	{ "ukadd64", /*          1011000dddddccccc001aaaaa1110111 */ 0xb0001077, 0xfe00707f, riscv_rvp_1011000dddddccccc001aaaaa1110111 },
-	{ "ukaddh", /*           0001010dddddccccc001aaaaa1110111 */ 0x14001077, 0xfe00707f, riscv_rvp_0001010dddddccccc001aaaaa1110111 },
-	{ "ukaddw", /*           0001000dddddccccc001aaaaa1110111 */ 0x10001077, 0xfe00707f, riscv_rvp_0001000dddddccccc001aaaaa1110111 },
-	{ "ukcras16", /*         0011010dddddccccc000aaaaa1110111 */ 0x34000077, 0xfe00707f, riscv_rvp_0011010dddddccccc000aaaaa1110111 },
-	{ "ukcrsa16", /*         0011011dddddccccc000aaaaa1110111 */ 0x36000077, 0xfe00707f, riscv_rvp_0011011dddddccccc000aaaaa1110111 },
-	{ "ukmar64", /*          1011010dddddccccc001aaaaa1110111 */ 0xb4001077, 0xfe00707f, riscv_rvp_1011010dddddccccc001aaaaa1110111 },
-	{ "ukmsr64", /*          1011011dddddccccc001aaaaa1110111 */ 0xb6001077, 0xfe00707f, riscv_rvp_1011011dddddccccc001aaaaa1110111 },
-	{ "ukstas16", /*         1110010dddddccccc010aaaaa1110111 */ 0xe4002077, 0xfe00707f, riscv_rvp_1110010dddddccccc010aaaaa1110111 },
-	{ "ukstsa16", /*         1110011dddddccccc010aaaaa1110111 */ 0xe6002077, 0xfe00707f, riscv_rvp_1110011dddddccccc010aaaaa1110111 },
-	{ "uksub8", /*           0011101dddddccccc000aaaaa1110111 */ 0x3a000077, 0xfe00707f, riscv_rvp_0011101dddddccccc000aaaaa1110111 },
-	{ "uksub16", /*          0011001dddddccccc000aaaaa1110111 */ 0x32000077, 0xfe00707f, riscv_rvp_0011001dddddccccc000aaaaa1110111 },
-	{ "uksub64", /*          1011001dddddccccc001aaaaa1110111 */ 0xb2001077, 0xfe00707f, riscv_rvp_1011001dddddccccc001aaaaa1110111 },
-	{ "uksubh", /*           0001011dddddccccc001aaaaa1110111 */ 0x16001077, 0xfe00707f, riscv_rvp_0001011dddddccccc001aaaaa1110111 },
-	{ "uksubw", /*           0001001dddddccccc001aaaaa1110111 */ 0x12001077, 0xfe00707f, riscv_rvp_0001001dddddccccc001aaaaa1110111 },
-	{ "umar64", /*           1010010dddddccccc001aaaaa1110111 */ 0xa4001077, 0xfe00707f, riscv_rvp_1010010dddddccccc001aaaaa1110111 },
-	{ "umaqa", /*            1100110dddddccccc000aaaaa1110111 */ 0xcc000077, 0xfe00707f, riscv_rvp_1100110dddddccccc000aaaaa1110111 },
-	{ "umax8", /*            1001101dddddccccc000aaaaa1110111 */ 0x9a000077, 0xfe00707f, riscv_rvp_1001101dddddccccc000aaaaa1110111 },
-	{ "umax16", /*           1001001dddddccccc000aaaaa1110111 */ 0x92000077, 0xfe00707f, riscv_rvp_1001001dddddccccc000aaaaa1110111 },
-	{ "umin8", /*            1001100dddddccccc000aaaaa1110111 */ 0x98000077, 0xfe00707f, riscv_rvp_1001100dddddccccc000aaaaa1110111 },
-	{ "umin16", /*           1001000dddddccccc000aaaaa1110111 */ 0x90000077, 0xfe00707f, riscv_rvp_1001000dddddccccc000aaaaa1110111 },
-	{ "umsr64", /*           1010011dddddccccc001aaaaa1110111 */ 0xa6001077, 0xfe00707f, riscv_rvp_1010011dddddccccc001aaaaa1110111 },
-	{ "umul8", /*            1011100dddddccccc000aaaaa1110111 */ 0xb8000077, 0xfe00707f, riscv_rvp_1011100dddddccccc000aaaaa1110111 },
-	{ "umulx8", /*           1011101dddddccccc000aaaaa1110111 */ 0xba000077, 0xfe00707f, riscv_rvp_1011101dddddccccc000aaaaa1110111 },
-	{ "umul16", /*           1011000dddddccccc000aaaaa1110111 */ 0xb0000077, 0xfe00707f, riscv_rvp_1011000dddddccccc000aaaaa1110111 },
-	{ "umulx16", /*          1011001dddddccccc000aaaaa1110111 */ 0xb2000077, 0xfe00707f, riscv_rvp_1011001dddddccccc000aaaaa1110111 },
-	{ "uradd8", /*           0010100dddddccccc000aaaaa1110111 */ 0x28000077, 0xfe00707f, riscv_rvp_0010100dddddccccc000aaaaa1110111 },
-	{ "uradd16", /*          0010000dddddccccc000aaaaa1110111 */ 0x20000077, 0xfe00707f, riscv_rvp_0010000dddddccccc000aaaaa1110111 },
-	{ "uradd64", /*          1010000dddddccccc001aaaaa1110111 */ 0xa0001077, 0xfe00707f, riscv_rvp_1010000dddddccccc001aaaaa1110111 },
-	{ "uraddw", /*           0011000dddddccccc001aaaaa1110111 */ 0x30001077, 0xfe00707f, riscv_rvp_0011000dddddccccc001aaaaa1110111 },
-	{ "urcras16", /*         0010010dddddccccc000aaaaa1110111 */ 0x24000077, 0xfe00707f, riscv_rvp_0010010dddddccccc000aaaaa1110111 },
-	{ "urcrsa16", /*         0010011dddddccccc000aaaaa1110111 */ 0x26000077, 0xfe00707f, riscv_rvp_0010011dddddccccc000aaaaa1110111 },
-	{ "urstas16", /*         1101010dddddccccc010aaaaa1110111 */ 0xd4002077, 0xfe00707f, riscv_rvp_1101010dddddccccc010aaaaa1110111 },
-	{ "urstsa16", /*         1101011dddddccccc010aaaaa1110111 */ 0xd6002077, 0xfe00707f, riscv_rvp_1101011dddddccccc010aaaaa1110111 },
-	{ "ursub8", /*           0010101dddddccccc000aaaaa1110111 */ 0x2a000077, 0xfe00707f, riscv_rvp_0010101dddddccccc000aaaaa1110111 },
-	{ "ursub16", /*          0010001dddddccccc000aaaaa1110111 */ 0x22000077, 0xfe00707f, riscv_rvp_0010001dddddccccc000aaaaa1110111 },
-	{ "ursub64", /*          1010001dddddccccc001aaaaa1110111 */ 0xa2001077, 0xfe00707f, riscv_rvp_1010001dddddccccc001aaaaa1110111 },
-	{ "ursubw", /*           0011001dddddccccc001aaaaa1110111 */ 0x32001077, 0xfe00707f, riscv_rvp_0011001dddddccccc001aaaaa1110111 },
-	{ "wexti", /*            1101111BBBBBccccc000aaaaa1110111 */ 0xde000077, 0xfe00707f, riscv_rvp_1101111BBBBBccccc000aaaaa1110111 },
-	{ "wext", /*             1100111dddddccccc000aaaaa1110111 */ 0xce000077, 0xfe00707f, riscv_rvp_1100111dddddccccc000aaaaa1110111 },
-	{ "add32", /*            0100000dddddccccc010aaaaa1110111 */ 0x40002077, 0xfe00707f, riscv_rvp_0100000dddddccccc010aaaaa1110111 },
-	{ "cras32", /*           0100010dddddccccc010aaaaa1110111 */ 0x44002077, 0xfe00707f, riscv_rvp_0100010dddddccccc010aaaaa1110111 },
-	{ "crsa32", /*           0100011dddddccccc010aaaaa1110111 */ 0x46002077, 0xfe00707f, riscv_rvp_0100011dddddccccc010aaaaa1110111 },
-	{ "kadd32", /*           0001000dddddccccc010aaaaa1110111 */ 0x10002077, 0xfe00707f, riscv_rvp_0001000dddddccccc010aaaaa1110111 },
-	{ "kcras32", /*          0001010dddddccccc010aaaaa1110111 */ 0x14002077, 0xfe00707f, riscv_rvp_0001010dddddccccc010aaaaa1110111 },
-	{ "kcrsa32", /*          0001011dddddccccc010aaaaa1110111 */ 0x16002077, 0xfe00707f, riscv_rvp_0001011dddddccccc010aaaaa1110111 },
-	{ "kdmbb16", /*          1101101dddddccccc001aaaaa1110111 */ 0xda001077, 0xfe00707f, riscv_rvp_1101101dddddccccc001aaaaa1110111 },
-	{ "kdmbt16", /*          1110101dddddccccc001aaaaa1110111 */ 0xea001077, 0xfe00707f, riscv_rvp_1110101dddddccccc001aaaaa1110111 },
-	{ "kdmtt16", /*          1111101dddddccccc001aaaaa1110111 */ 0xfa001077, 0xfe00707f, riscv_rvp_1111101dddddccccc001aaaaa1110111 },
-	{ "kdmabb16", /*         1101100dddddccccc001aaaaa1110111 */ 0xd8001077, 0xfe00707f, riscv_rvp_1101100dddddccccc001aaaaa1110111 },
-	{ "kdmabt16", /*         1110100dddddccccc001aaaaa1110111 */ 0xe8001077, 0xfe00707f, riscv_rvp_1110100dddddccccc001aaaaa1110111 },
-	{ "kdmatt16", /*         1111100dddddccccc001aaaaa1110111 */ 0xf8001077, 0xfe00707f, riscv_rvp_1111100dddddccccc001aaaaa1110111 },
-	{ "khmbb16", /*          1101110dddddccccc001aaaaa1110111 */ 0xdc001077, 0xfe00707f, riscv_rvp_1101110dddddccccc001aaaaa1110111 },
-	{ "khmbt16", /*          1110110dddddccccc001aaaaa1110111 */ 0xec001077, 0xfe00707f, riscv_rvp_1110110dddddccccc001aaaaa1110111 },
-	{ "khmtt16", /*          1111110dddddccccc001aaaaa1110111 */ 0xfc001077, 0xfe00707f, riscv_rvp_1111110dddddccccc001aaaaa1110111 },
-	{ "kmabb32", /*          0101101dddddccccc010aaaaa1110111 */ 0x5a002077, 0xfe00707f, riscv_rvp_0101101dddddccccc010aaaaa1110111 },
-	{ "kmabt32", /*          0110101dddddccccc010aaaaa1110111 */ 0x6a002077, 0xfe00707f, riscv_rvp_0110101dddddccccc010aaaaa1110111 },
-	{ "kmatt32", /*          0111101dddddccccc010aaaaa1110111 */ 0x7a002077, 0xfe00707f, riscv_rvp_0111101dddddccccc010aaaaa1110111 },
-	{ "kmaxda32", /*         0100101dddddccccc010aaaaa1110111 */ 0x4a002077, 0xfe00707f, riscv_rvp_0100101dddddccccc010aaaaa1110111 },
-	{ "kmda32", /*           0011100dddddccccc010aaaaa1110111 */ 0x38002077, 0xfe00707f, riscv_rvp_0011100dddddccccc010aaaaa1110111 },
-	{ "kmxda32", /*          0011101dddddccccc010aaaaa1110111 */ 0x3a002077, 0xfe00707f, riscv_rvp_0011101dddddccccc010aaaaa1110111 },
-	{ "kmads32", /*          0101110dddddccccc010aaaaa1110111 */ 0x5c002077, 0xfe00707f, riscv_rvp_0101110dddddccccc010aaaaa1110111 },
-	{ "kmadrs32", /*         0110110dddddccccc010aaaaa1110111 */ 0x6c002077, 0xfe00707f, riscv_rvp_0110110dddddccccc010aaaaa1110111 },
-	{ "kmaxds32", /*         0111110dddddccccc010aaaaa1110111 */ 0x7c002077, 0xfe00707f, riscv_rvp_0111110dddddccccc010aaaaa1110111 },
-	{ "kmsda32", /*          0100110dddddccccc010aaaaa1110111 */ 0x4c002077, 0xfe00707f, riscv_rvp_0100110dddddccccc010aaaaa1110111 },
-	{ "kmsxda32", /*         0100111dddddccccc010aaaaa1110111 */ 0x4e002077, 0xfe00707f, riscv_rvp_0100111dddddccccc010aaaaa1110111 },
-	{ "ksll32", /*           0110010dddddccccc010aaaaa1110111 */ 0x64002077, 0xfe00707f, riscv_rvp_0110010dddddccccc010aaaaa1110111 },
-	{ "kslli32", /*          1000010BBBBBccccc010aaaaa1110111 */ 0x84002077, 0xfe00707f, riscv_rvp_1000010BBBBBccccc010aaaaa1110111 },
-	{ "kslra32", /*          0101011dddddccccc010aaaaa1110111 */ 0x56002077, 0xfe00707f, riscv_rvp_0101011dddddccccc010aaaaa1110111 },
-	{ "kslra32.u", /*        0110011dddddccccc010aaaaa1110111 */ 0x66002077, 0xfe00707f, riscv_rvp_0110011dddddccccc010aaaaa1110111 },
-	{ "kstas32", /*          1100000dddddccccc010aaaaa1110111 */ 0xc0002077, 0xfe00707f, riscv_rvp_1100000dddddccccc010aaaaa1110111 },
-	{ "kstsa32", /*          1100001dddddccccc010aaaaa1110111 */ 0xc2002077, 0xfe00707f, riscv_rvp_1100001dddddccccc010aaaaa1110111 },
-	{ "ksub32", /*           0001001dddddccccc010aaaaa1110111 */ 0x12002077, 0xfe00707f, riscv_rvp_0001001dddddccccc010aaaaa1110111 },
-	{ "pkbb32", /*           0000111dddddccccc010aaaaa1110111 */ 0x0e002077, 0xfe00707f, riscv_rvp_0000111dddddccccc010aaaaa1110111 },
-	{ "pkbt32", /*           0001111dddddccccc010aaaaa1110111 */ 0x1e002077, 0xfe00707f, riscv_rvp_0001111dddddccccc010aaaaa1110111 },
-	{ "pktt32", /*           0010111dddddccccc010aaaaa1110111 */ 0x2e002077, 0xfe00707f, riscv_rvp_0010111dddddccccc010aaaaa1110111 },
-	{ "pktb32", /*           0011111dddddccccc010aaaaa1110111 */ 0x3e002077, 0xfe00707f, riscv_rvp_0011111dddddccccc010aaaaa1110111 },
-	{ "radd32", /*           0000000dddddccccc010aaaaa1110111 */ 0x00002077, 0xfe00707f, riscv_rvp_0000000dddddccccc010aaaaa1110111 },
-	{ "rcras32", /*          0000010dddddccccc010aaaaa1110111 */ 0x04002077, 0xfe00707f, riscv_rvp_0000010dddddccccc010aaaaa1110111 },
-	{ "rcrsa32", /*          0000011dddddccccc010aaaaa1110111 */ 0x06002077, 0xfe00707f, riscv_rvp_0000011dddddccccc010aaaaa1110111 },
-	{ "rstas32", /*          1011000dddddccccc010aaaaa1110111 */ 0xb0002077, 0xfe00707f, riscv_rvp_1011000dddddccccc010aaaaa1110111 },
-	{ "rstsa32", /*          1011001dddddccccc010aaaaa1110111 */ 0xb2002077, 0xfe00707f, riscv_rvp_1011001dddddccccc010aaaaa1110111 },
-	{ "rsub32", /*           0000001dddddccccc010aaaaa1110111 */ 0x02002077, 0xfe00707f, riscv_rvp_0000001dddddccccc010aaaaa1110111 },
-	{ "sll32", /*            0101010dddddccccc010aaaaa1110111 */ 0x54002077, 0xfe00707f, riscv_rvp_0101010dddddccccc010aaaaa1110111 },
-	{ "slli32", /*           0111010BBBBBccccc010aaaaa1110111 */ 0x74002077, 0xfe00707f, riscv_rvp_0111010BBBBBccccc010aaaaa1110111 },
-	{ "smax32", /*           1001001dddddccccc010aaaaa1110111 */ 0x92002077, 0xfe00707f, riscv_rvp_1001001dddddccccc010aaaaa1110111 },
-	{ "smbt32", /*           0001100dddddccccc010aaaaa1110111 */ 0x18002077, 0xfe00707f, riscv_rvp_0001100dddddccccc010aaaaa1110111 },
-	{ "smtt32", /*           0010100dddddccccc010aaaaa1110111 */ 0x28002077, 0xfe00707f, riscv_rvp_0010100dddddccccc010aaaaa1110111 },
-	{ "smds32", /*           0101100dddddccccc010aaaaa1110111 */ 0x58002077, 0xfe00707f, riscv_rvp_0101100dddddccccc010aaaaa1110111 },
-	{ "smdrs32", /*          0110100dddddccccc010aaaaa1110111 */ 0x68002077, 0xfe00707f, riscv_rvp_0110100dddddccccc010aaaaa1110111 },
-	{ "smxds32", /*          0111100dddddccccc010aaaaa1110111 */ 0x78002077, 0xfe00707f, riscv_rvp_0111100dddddccccc010aaaaa1110111 },
-	{ "smin32", /*           1001000dddddccccc010aaaaa1110111 */ 0x90002077, 0xfe00707f, riscv_rvp_1001000dddddccccc010aaaaa1110111 },
-	{ "sra32", /*            0101000dddddccccc010aaaaa1110111 */ 0x50002077, 0xfe00707f, riscv_rvp_0101000dddddccccc010aaaaa1110111 },
-	{ "sra32.u", /*          0110000dddddccccc010aaaaa1110111 */ 0x60002077, 0xfe00707f, riscv_rvp_0110000dddddccccc010aaaaa1110111 },
-	{ "srai32", /*           0111000BBBBBccccc010aaaaa1110111 */ 0x70002077, 0xfe00707f, riscv_rvp_0111000BBBBBccccc010aaaaa1110111 },
-	{ "srai32.u", /*         1000000BBBBBccccc010aaaaa1110111 */ 0x80002077, 0xfe00707f, riscv_rvp_1000000BBBBBccccc010aaaaa1110111 },
-	{ "sraiw.u", /*          0011010BBBBBccccc001aaaaa1110111 */ 0x34001077, 0xfe00707f, riscv_rvp_0011010BBBBBccccc001aaaaa1110111 },
-	{ "srl32", /*            0101001dddddccccc010aaaaa1110111 */ 0x52002077, 0xfe00707f, riscv_rvp_0101001dddddccccc010aaaaa1110111 },
-	{ "srl32.u", /*          0110001dddddccccc010aaaaa1110111 */ 0x62002077, 0xfe00707f, riscv_rvp_0110001dddddccccc010aaaaa1110111 },
-	{ "srli32", /*           0111001BBBBBccccc010aaaaa1110111 */ 0x72002077, 0xfe00707f, riscv_rvp_0111001BBBBBccccc010aaaaa1110111 },
-	{ "srli32.u", /*         1000001BBBBBccccc010aaaaa1110111 */ 0x82002077, 0xfe00707f, riscv_rvp_1000001BBBBBccccc010aaaaa1110111 },
-	{ "stas32", /*           1111000dddddccccc010aaaaa1110111 */ 0xf0002077, 0xfe00707f, riscv_rvp_1111000dddddccccc010aaaaa1110111 },
-	{ "stsa32", /*           1111001dddddccccc010aaaaa1110111 */ 0xf2002077, 0xfe00707f, riscv_rvp_1111001dddddccccc010aaaaa1110111 },
-	{ "sub32", /*            0100001dddddccccc010aaaaa1110111 */ 0x42002077, 0xfe00707f, riscv_rvp_0100001dddddccccc010aaaaa1110111 },
-	{ "ukadd32", /*          0011000dddddccccc010aaaaa1110111 */ 0x30002077, 0xfe00707f, riscv_rvp_0011000dddddccccc010aaaaa1110111 },
-	{ "ukcras32", /*         0011010dddddccccc010aaaaa1110111 */ 0x34002077, 0xfe00707f, riscv_rvp_0011010dddddccccc010aaaaa1110111 },
-	{ "ukcrsa32", /*         0011011dddddccccc010aaaaa1110111 */ 0x36002077, 0xfe00707f, riscv_rvp_0011011dddddccccc010aaaaa1110111 },
-	{ "ukstas32", /*         1110000dddddccccc010aaaaa1110111 */ 0xe0002077, 0xfe00707f, riscv_rvp_1110000dddddccccc010aaaaa1110111 },
-	{ "ukstsa32", /*         1110001dddddccccc010aaaaa1110111 */ 0xe2002077, 0xfe00707f, riscv_rvp_1110001dddddccccc010aaaaa1110111 },
-	{ "uksub32", /*          0011001dddddccccc010aaaaa1110111 */ 0x32002077, 0xfe00707f, riscv_rvp_0011001dddddccccc010aaaaa1110111 },
-	{ "umax32", /*           1010001dddddccccc010aaaaa1110111 */ 0xa2002077, 0xfe00707f, riscv_rvp_1010001dddddccccc010aaaaa1110111 },
-	{ "umin32", /*           1010000dddddccccc010aaaaa1110111 */ 0xa0002077, 0xfe00707f, riscv_rvp_1010000dddddccccc010aaaaa1110111 },
-	{ "uradd32", /*          0010000dddddccccc010aaaaa1110111 */ 0x20002077, 0xfe00707f, riscv_rvp_0010000dddddccccc010aaaaa1110111 },
-	{ "urcras32", /*         0010010dddddccccc010aaaaa1110111 */ 0x24002077, 0xfe00707f, riscv_rvp_0010010dddddccccc010aaaaa1110111 },
-	{ "urcrsa32", /*         0010011dddddccccc010aaaaa1110111 */ 0x26002077, 0xfe00707f, riscv_rvp_0010011dddddccccc010aaaaa1110111 },
-	{ "urstas32", /*         1101000dddddccccc010aaaaa1110111 */ 0xd0002077, 0xfe00707f, riscv_rvp_1101000dddddccccc010aaaaa1110111 },
-	{ "urstsa32", /*         1101001dddddccccc010aaaaa1110111 */ 0xd2002077, 0xfe00707f, riscv_rvp_1101001dddddccccc010aaaaa1110111 },
-	{ "ursub32", /*          0010001dddddccccc010aaaaa1110111 */ 0x22002077, 0xfe00707f, riscv_rvp_0010001dddddccccc010aaaaa1110111 },
-	{ "vsetvl", /*           1000000dddddccccc111aaaaa1010111 */ 0x80007057, 0xfe00707f, riscv_rvv_1000000dddddccccc111aaaaa1010111 },
-	{ "vfmerge.vfm", /*      0101110GGGGGccccc101DDDDD1010111 */ 0x5c005057, 0xfe00707f, riscv_rvv_0101110GGGGGccccc101DDDDD1010111 },
-	{ "vadc.vxm", /*         0100000GGGGGccccc100DDDDD1010111 */ 0x40004057, 0xfe00707f, riscv_rvv_0100000GGGGGccccc100DDDDD1010111 },
-	{ "vmadc.vxm", /*        0100010GGGGGccccc100DDDDD1010111 */ 0x44004057, 0xfe00707f, riscv_rvv_0100010GGGGGccccc100DDDDD1010111 },
-	{ "vmadc.vx", /*         0100011GGGGGccccc100DDDDD1010111 */ 0x46004057, 0xfe00707f, riscv_rvv_0100011GGGGGccccc100DDDDD1010111 },
-	{ "vsbc.vxm", /*         0100100GGGGGccccc100DDDDD1010111 */ 0x48004057, 0xfe00707f, riscv_rvv_0100100GGGGGccccc100DDDDD1010111 },
-	{ "vmsbc.vxm", /*        0100110GGGGGccccc100DDDDD1010111 */ 0x4c004057, 0xfe00707f, riscv_rvv_0100110GGGGGccccc100DDDDD1010111 },
-	{ "vmsbc.vx", /*         0100111GGGGGccccc100DDDDD1010111 */ 0x4e004057, 0xfe00707f, riscv_rvv_0100111GGGGGccccc100DDDDD1010111 },
-	{ "vmerge.vxm", /*       0101110GGGGGccccc100DDDDD1010111 */ 0x5c004057, 0xfe00707f, riscv_rvv_0101110GGGGGccccc100DDDDD1010111 },
-	{ "vadc.vvm", /*         0100000GGGGGFFFFF000DDDDD1010111 */ 0x40000057, 0xfe00707f, riscv_rvv_0100000GGGGGFFFFF000DDDDD1010111 },
-	{ "vmadc.vvm", /*        0100010GGGGGFFFFF000DDDDD1010111 */ 0x44000057, 0xfe00707f, riscv_rvv_0100010GGGGGFFFFF000DDDDD1010111 },
-	{ "vmadc.vv", /*         0100011GGGGGFFFFF000DDDDD1010111 */ 0x46000057, 0xfe00707f, riscv_rvv_0100011GGGGGFFFFF000DDDDD1010111 },
-	{ "vsbc.vvm", /*         0100100GGGGGFFFFF000DDDDD1010111 */ 0x48000057, 0xfe00707f, riscv_rvv_0100100GGGGGFFFFF000DDDDD1010111 },
-	{ "vmsbc.vvm", /*        0100110GGGGGFFFFF000DDDDD1010111 */ 0x4c000057, 0xfe00707f, riscv_rvv_0100110GGGGGFFFFF000DDDDD1010111 },
-	{ "vmsbc.vv", /*         0100111GGGGGFFFFF000DDDDD1010111 */ 0x4e000057, 0xfe00707f, riscv_rvv_0100111GGGGGFFFFF000DDDDD1010111 },
-	{ "vmerge.vvm", /*       0101110GGGGGFFFFF000DDDDD1010111 */ 0x5c000057, 0xfe00707f, riscv_rvv_0101110GGGGGFFFFF000DDDDD1010111 },
-	{ "vadc.vim", /*         0100000GGGGGLLLLL011DDDDD1010111 */ 0x40003057, 0xfe00707f, riscv_rvv_0100000GGGGGLLLLL011DDDDD1010111 },
-	{ "vmadc.vim", /*        0100010GGGGGLLLLL011DDDDD1010111 */ 0x44003057, 0xfe00707f, riscv_rvv_0100010GGGGGLLLLL011DDDDD1010111 },
-	{ "vmadc.vi", /*         0100011GGGGGLLLLL011DDDDD1010111 */ 0x46003057, 0xfe00707f, riscv_rvv_0100011GGGGGLLLLL011DDDDD1010111 },
-	{ "vmerge.vim", /*       0101110GGGGGLLLLL011DDDDD1010111 */ 0x5c003057, 0xfe00707f, riscv_rvv_0101110GGGGGLLLLL011DDDDD1010111 },
-	{ "vcompress.vm", /*     0101111GGGGGFFFFF010DDDDD1010111 */ 0x5e002057, 0xfe00707f, riscv_rvv_0101111GGGGGFFFFF010DDDDD1010111 },
-	{ "vmvnfr.v", /*         1001111GGGGGLLLLL011DDDDD1010111 */ 0x9e003057, 0xfe00707f, riscv_rvv_1001111GGGGGLLLLL011DDDDD1010111 },
-	{ "hfence.vvma", /*      0010001dddddccccc000000001110011 */ 0x22000073, 0xfe007fff, riscv_rv32h_0010001dddddccccc000000001110011 },
-	{ "hfence.gvma", /*      0110001dddddccccc000000001110011 */ 0x62000073, 0xfe007fff, riscv_rv32h_0110001dddddccccc000000001110011 },
-	{ "hsv.b", /*            0110001dddddccccc100000001110011 */ 0x62004073, 0xfe007fff, riscv_rv32h_0110001dddddccccc100000001110011 },
-	{ "hsv.h", /*            0110011dddddccccc100000001110011 */ 0x66004073, 0xfe007fff, riscv_rv32h_0110011dddddccccc100000001110011 },
-	{ "hsv.w", /*            0110101dddddccccc100000001110011 */ 0x6a004073, 0xfe007fff, riscv_rv32h_0110101dddddccccc100000001110011 },
-	{ "hsv.d", /*            0110111dddddccccc100000001110011 */ 0x6e004073, 0xfe007fff, riscv_rv64h_0110111dddddccccc100000001110011 },
-	{ "sinval.vma", /*       0001011dddddccccc000000001110011 */ 0x16000073, 0xfe007fff, riscv_svinval_0001011dddddccccc000000001110011 },
-	{ "hinval.vvma", /*      0010011dddddccccc000000001110011 */ 0x26000073, 0xfe007fff, riscv_svinval_0010011dddddccccc000000001110011 },
-	{ "hinval.gvma", /*      0110011dddddccccc000000001110011 */ 0x66000073, 0xfe007fff, riscv_svinval_0110011dddddccccc000000001110011 },
-	{ "sfence.vma", /*       0001001dddddccccc000000001110011 */ 0x12000073, 0xfe007fff, riscv_system_0001001dddddccccc000000001110011 },
-	{ "vfmv.f.s", /*         0100001GGGGG00000001aaaaa1010111 */ 0x42001057, 0xfe0ff07f, riscv_rvv_0100001GGGGG00000001aaaaa1010111 },
-	{ "vmv1r.v", /*          1001111GGGGG00000011DDDDD1010111 */ 0x9e003057, 0xfe0ff07f, riscv_rvv_1001111GGGGG00000011DDDDD1010111 },
-	{ "vmv2r.v", /*          1001111GGGGG00001011DDDDD1010111 */ 0x9e00b057, 0xfe0ff07f, riscv_rvv_1001111GGGGG00001011DDDDD1010111 },
-	{ "vmv4r.v", /*          1001111GGGGG00011011DDDDD1010111 */ 0x9e01b057, 0xfe0ff07f, riscv_rvv_1001111GGGGG00011011DDDDD1010111 },
-	{ "vmv8r.v", /*          1001111GGGGG00111011DDDDD1010111 */ 0x9e03b057, 0xfe0ff07f, riscv_rvv_1001111GGGGG00111011DDDDD1010111 },
-	{ "vmv.x.s", /*          0100001GGGGG00000010aaaaa1010111 */ 0x42002057, 0xfe0ff07f, riscv_rvv_0100001GGGGG00000010aaaaa1010111 },
-	{ "aes64ks1i", /*        00110001wwwwccccc001aaaaa0010011 */ 0x31001013, 0xff00707f, riscv_rv64k_00110001wwwwccccc001aaaaa0010011 },
-	{ "kslli16", /*          01110101AAAAccccc000aaaaa1110111 */ 0x75000077, 0xff00707f, riscv_rvp_01110101AAAAccccc000aaaaa1110111 },
-	{ "sclip16", /*          10000100AAAAccccc000aaaaa1110111 */ 0x84000077, 0xff00707f, riscv_rvp_10000100AAAAccccc000aaaaa1110111 },
-	{ "slli16", /*           01110100AAAAccccc000aaaaa1110111 */ 0x74000077, 0xff00707f, riscv_rvp_01110100AAAAccccc000aaaaa1110111 },
-	{ "srai16", /*           01110000AAAAccccc000aaaaa1110111 */ 0x70000077, 0xff00707f, riscv_rvp_01110000AAAAccccc000aaaaa1110111 },
-	{ "srai16.u", /*         01110001AAAAccccc000aaaaa1110111 */ 0x71000077, 0xff00707f, riscv_rvp_01110001AAAAccccc000aaaaa1110111 },
-	{ "srli16", /*           01110010AAAAccccc000aaaaa1110111 */ 0x72000077, 0xff00707f, riscv_rvp_01110010AAAAccccc000aaaaa1110111 },
-	{ "srli16.u", /*         01110011AAAAccccc000aaaaa1110111 */ 0x73000077, 0xff00707f, riscv_rvp_01110011AAAAccccc000aaaaa1110111 },
-	{ "uclip16", /*          10000101AAAAccccc000aaaaa1110111 */ 0x85000077, 0xff00707f, riscv_rvp_10000101AAAAccccc000aaaaa1110111 },
-	{ "insb", /*             101011000zzzccccc000aaaaa1110111 */ 0xac000077, 0xff80707f, riscv_rvp_101011000zzzccccc000aaaaa1110111 },
-	{ "kslli8", /*           011111001zzzccccc000aaaaa1110111 */ 0x7c800077, 0xff80707f, riscv_rvp_011111001zzzccccc000aaaaa1110111 },
-	{ "sclip8", /*           100011000zzzccccc000aaaaa1110111 */ 0x8c000077, 0xff80707f, riscv_rvp_100011000zzzccccc000aaaaa1110111 },
-	{ "slli8", /*            011111000zzzccccc000aaaaa1110111 */ 0x7c000077, 0xff80707f, riscv_rvp_011111000zzzccccc000aaaaa1110111 },
-	{ "srai8", /*            011110000zzzccccc000aaaaa1110111 */ 0x78000077, 0xff80707f, riscv_rvp_011110000zzzccccc000aaaaa1110111 },
-	{ "srai8.u", /*          011110001zzzccccc000aaaaa1110111 */ 0x78800077, 0xff80707f, riscv_rvp_011110001zzzccccc000aaaaa1110111 },
-	{ "srli8", /*            011110100zzzccccc000aaaaa1110111 */ 0x7a000077, 0xff80707f, riscv_rvp_011110100zzzccccc000aaaaa1110111 },
-	{ "srli8.u", /*          011110101zzzccccc000aaaaa1110111 */ 0x7a800077, 0xff80707f, riscv_rvp_011110101zzzccccc000aaaaa1110111 },
-	{ "uclip8", /*           100011010zzzccccc000aaaaa1110111 */ 0x8d000077, 0xff80707f, riscv_rvp_100011010zzzccccc000aaaaa1110111 },
-	{ "fcvt.s.d", /*         010000000001cccccjjjaaaaa1010011 */ 0x40100053, 0xfff0007f, riscv_rv32d_010000000001cccccjjjaaaaa1010011 },
-	{ "fcvt.d.s", /*         010000100000cccccjjjaaaaa1010011 */ 0x42000053, 0xfff0007f, riscv_rv32d_010000100000cccccjjjaaaaa1010011 },
-	{ "fsqrt.d", /*          010110100000cccccjjjaaaaa1010011 */ 0x5a000053, 0xfff0007f, riscv_rv32d_010110100000cccccjjjaaaaa1010011 },
-	{ "fcvt.w.d", /*         110000100000cccccjjjaaaaa1010011 */ 0xc2000053, 0xfff0007f, riscv_rv32d_110000100000cccccjjjaaaaa1010011 },
-	{ "fcvt.wu.d", /*        110000100001cccccjjjaaaaa1010011 */ 0xc2100053, 0xfff0007f, riscv_rv32d_110000100001cccccjjjaaaaa1010011 },
-	{ "fcvt.d.w", /*         110100100000cccccjjjaaaaa1010011 */ 0xd2000053, 0xfff0007f, riscv_rv32d_110100100000cccccjjjaaaaa1010011 },
-	{ "fcvt.d.wu", /*        110100100001cccccjjjaaaaa1010011 */ 0xd2100053, 0xfff0007f, riscv_rv32d_110100100001cccccjjjaaaaa1010011 },
-	{ "fcvt.h.d", /*         010001000001cccccjjjaaaaa1010011 */ 0x44100053, 0xfff0007f, riscv_rv32d-zfh_010001000001cccccjjjaaaaa1010011 },
-	{ "fcvt.d.h", /*         010000100010cccccjjjaaaaa1010011 */ 0x42200053, 0xfff0007f, riscv_rv32d-zfh_010000100010cccccjjjaaaaa1010011 },
-	{ "fsqrt.s", /*          010110000000cccccjjjaaaaa1010011 */ 0x58000053, 0xfff0007f, riscv_rv32f_010110000000cccccjjjaaaaa1010011 },
-	{ "fcvt.w.s", /*         110000000000cccccjjjaaaaa1010011 */ 0xc0000053, 0xfff0007f, riscv_rv32f_110000000000cccccjjjaaaaa1010011 },
-	{ "fcvt.wu.s", /*        110000000001cccccjjjaaaaa1010011 */ 0xc0100053, 0xfff0007f, riscv_rv32f_110000000001cccccjjjaaaaa1010011 },
-	{ "fcvt.s.w", /*         110100000000cccccjjjaaaaa1010011 */ 0xd0000053, 0xfff0007f, riscv_rv32f_110100000000cccccjjjaaaaa1010011 },
-	{ "fcvt.s.wu", /*        110100000001cccccjjjaaaaa1010011 */ 0xd0100053, 0xfff0007f, riscv_rv32f_110100000001cccccjjjaaaaa1010011 },
-	{ "fcvt.s.q", /*         010000000011cccccjjjaaaaa1010011 */ 0x40300053, 0xfff0007f, riscv_rv32q_010000000011cccccjjjaaaaa1010011 },
-	{ "fcvt.q.s", /*         010001100000cccccjjjaaaaa1010011 */ 0x46000053, 0xfff0007f, riscv_rv32q_010001100000cccccjjjaaaaa1010011 },
-	{ "fcvt.d.q", /*         010000100011cccccjjjaaaaa1010011 */ 0x42300053, 0xfff0007f, riscv_rv32q_010000100011cccccjjjaaaaa1010011 },
-	{ "fcvt.q.d", /*         010001100001cccccjjjaaaaa1010011 */ 0x46100053, 0xfff0007f, riscv_rv32q_010001100001cccccjjjaaaaa1010011 },
-	{ "fsqrt.q", /*          010111100000cccccjjjaaaaa1010011 */ 0x5e000053, 0xfff0007f, riscv_rv32q_010111100000cccccjjjaaaaa1010011 },
-	{ "fcvt.w.q", /*         110001100000cccccjjjaaaaa1010011 */ 0xc6000053, 0xfff0007f, riscv_rv32q_110001100000cccccjjjaaaaa1010011 },
-	{ "fcvt.wu.q", /*        110001100001cccccjjjaaaaa1010011 */ 0xc6100053, 0xfff0007f, riscv_rv32q_110001100001cccccjjjaaaaa1010011 },
-	{ "fcvt.q.w", /*         110101100000cccccjjjaaaaa1010011 */ 0xd6000053, 0xfff0007f, riscv_rv32q_110101100000cccccjjjaaaaa1010011 },
-	{ "fcvt.q.wu", /*        110101100001cccccjjjaaaaa1010011 */ 0xd6100053, 0xfff0007f, riscv_rv32q_110101100001cccccjjjaaaaa1010011 },
-	{ "fcvt.h.q", /*         010001000011cccccjjjaaaaa1010011 */ 0x44300053, 0xfff0007f, riscv_rv32q-zfh_010001000011cccccjjjaaaaa1010011 },
-	{ "fcvt.q.h", /*         010001100010cccccjjjaaaaa1010011 */ 0x46200053, 0xfff0007f, riscv_rv32q-zfh_010001100010cccccjjjaaaaa1010011 },
-	{ "fcvt.h.s", /*         010001000000cccccjjjaaaaa1010011 */ 0x44000053, 0xfff0007f, riscv_rv32zfh_010001000000cccccjjjaaaaa1010011 },
-	{ "fcvt.s.h", /*         010000000010cccccjjjaaaaa1010011 */ 0x40200053, 0xfff0007f, riscv_rv32zfh_010000000010cccccjjjaaaaa1010011 },
-	{ "fsqrt.h", /*          010111000000cccccjjjaaaaa1010011 */ 0x5c000053, 0xfff0007f, riscv_rv32zfh_010111000000cccccjjjaaaaa1010011 },
-	{ "fcvt.w.h", /*         110001000000cccccjjjaaaaa1010011 */ 0xc4000053, 0xfff0007f, riscv_rv32zfh_110001000000cccccjjjaaaaa1010011 },
-	{ "fcvt.wu.h", /*        110001000001cccccjjjaaaaa1010011 */ 0xc4100053, 0xfff0007f, riscv_rv32zfh_110001000001cccccjjjaaaaa1010011 },
-	{ "fcvt.h.w", /*         110101000000cccccjjjaaaaa1010011 */ 0xd4000053, 0xfff0007f, riscv_rv32zfh_110101000000cccccjjjaaaaa1010011 },
-	{ "fcvt.h.wu", /*        110101000001cccccjjjaaaaa1010011 */ 0xd4100053, 0xfff0007f, riscv_rv32zfh_110101000001cccccjjjaaaaa1010011 },
-	{ "fcvt.l.d", /*         110000100010cccccjjjaaaaa1010011 */ 0xc2200053, 0xfff0007f, riscv_rv64d_110000100010cccccjjjaaaaa1010011 },
-	{ "fcvt.lu.d", /*        110000100011cccccjjjaaaaa1010011 */ 0xc2300053, 0xfff0007f, riscv_rv64d_110000100011cccccjjjaaaaa1010011 },
-	{ "fcvt.d.l", /*         110100100010cccccjjjaaaaa1010011 */ 0xd2200053, 0xfff0007f, riscv_rv64d_110100100010cccccjjjaaaaa1010011 },
-	{ "fcvt.d.lu", /*        110100100011cccccjjjaaaaa1010011 */ 0xd2300053, 0xfff0007f, riscv_rv64d_110100100011cccccjjjaaaaa1010011 },
-	{ "fcvt.l.s", /*         110000000010cccccjjjaaaaa1010011 */ 0xc0200053, 0xfff0007f, riscv_rv64f_110000000010cccccjjjaaaaa1010011 },
-	{ "fcvt.lu.s", /*        110000000011cccccjjjaaaaa1010011 */ 0xc0300053, 0xfff0007f, riscv_rv64f_110000000011cccccjjjaaaaa1010011 },
-	{ "fcvt.s.l", /*         110100000010cccccjjjaaaaa1010011 */ 0xd0200053, 0xfff0007f, riscv_rv64f_110100000010cccccjjjaaaaa1010011 },
-	{ "fcvt.s.lu", /*        110100000011cccccjjjaaaaa1010011 */ 0xd0300053, 0xfff0007f, riscv_rv64f_110100000011cccccjjjaaaaa1010011 },
-	{ "fcvt.l.q", /*         110001100010cccccjjjaaaaa1010011 */ 0xc6200053, 0xfff0007f, riscv_rv64q_110001100010cccccjjjaaaaa1010011 },
-	{ "fcvt.lu.q", /*        110001100011cccccjjjaaaaa1010011 */ 0xc6300053, 0xfff0007f, riscv_rv64q_110001100011cccccjjjaaaaa1010011 },
-	{ "fcvt.q.l", /*         110101100010cccccjjjaaaaa1010011 */ 0xd6200053, 0xfff0007f, riscv_rv64q_110101100010cccccjjjaaaaa1010011 },
-	{ "fcvt.q.lu", /*        110101100011cccccjjjaaaaa1010011 */ 0xd6300053, 0xfff0007f, riscv_rv64q_110101100011cccccjjjaaaaa1010011 },
-	{ "fcvt.l.h", /*         110001000010cccccjjjaaaaa1010011 */ 0xc4200053, 0xfff0007f, riscv_rv64zfh_110001000010cccccjjjaaaaa1010011 },
-	{ "fcvt.lu.h", /*        110001000011cccccjjjaaaaa1010011 */ 0xc4300053, 0xfff0007f, riscv_rv64zfh_110001000011cccccjjjaaaaa1010011 },
-	{ "fcvt.h.l", /*         110101000010cccccjjjaaaaa1010011 */ 0xd4200053, 0xfff0007f, riscv_rv64zfh_110101000010cccccjjjaaaaa1010011 },
-	{ "fcvt.h.lu", /*        110101000011cccccjjjaaaaa1010011 */ 0xd4300053, 0xfff0007f, riscv_rv64zfh_110101000011cccccjjjaaaaa1010011 },
-	{ "fsflags", /*          000000000001ccccc001aaaaa1110011 */ 0x00101073, 0xfff0707f, riscv_pseudo_000000000001ccccc001aaaaa1110011 },
-	{ "fsflagsi", /*         000000000001sssss101aaaaa1110011 */ 0x00105073, 0xfff0707f, riscv_pseudo_000000000001sssss101aaaaa1110011 },
-	{ "fsrm", /*             000000000010ccccc001aaaaa1110011 */ 0x00201073, 0xfff0707f, riscv_pseudo_000000000010ccccc001aaaaa1110011 },
-	{ "fsrmi", /*            000000000010sssss101aaaaa1110011 */ 0x00205073, 0xfff0707f, riscv_pseudo_000000000010sssss101aaaaa1110011 },
-	{ "fscsr", /*            000000000011ccccc001aaaaa1110011 */ 0x00301073, 0xfff0707f, riscv_pseudo_000000000011ccccc001aaaaa1110011 },
-	{ "fmv.x.s", /*          111000000000ccccc000aaaaa1010011 */ 0xe0000053, 0xfff0707f, riscv_pseudo_111000000000ccccc000aaaaa1010011 },
-	{ "fmv.s.x", /*          111100000000ccccc000aaaaa1010011 */ 0xf0000053, 0xfff0707f, riscv_pseudo_111100000000ccccc000aaaaa1010011 },
-	{ "fence.tso", /*        10000011001100000000000000001111 */ 0x8330000f, 0xfff0707f, riscv_unique },
-	{ "clz", /*              011000000000ccccc001aaaaa0010011 */ 0x60001013, 0xfff0707f, riscv_rv32b_011000000000ccccc001aaaaa0010011 },
-	{ "ctz", /*              011000000001ccccc001aaaaa0010011 */ 0x60101013, 0xfff0707f, riscv_rv32b_011000000001ccccc001aaaaa0010011 },
-	{ "cpop", /*             011000000010ccccc001aaaaa0010011 */ 0x60201013, 0xfff0707f, riscv_rv32b_011000000010ccccc001aaaaa0010011 },
-	{ "sext.b", /*           011000000100ccccc001aaaaa0010011 */ 0x60401013, 0xfff0707f, riscv_rv32b_011000000100ccccc001aaaaa0010011 },
-	{ "sext.h", /*           011000000101ccccc001aaaaa0010011 */ 0x60501013, 0xfff0707f, riscv_rv32b_011000000101ccccc001aaaaa0010011 },
-	{ "crc32.b", /*          011000010000ccccc001aaaaa0010011 */ 0x61001013, 0xfff0707f, riscv_rv32b_011000010000ccccc001aaaaa0010011 },
-	{ "crc32.h", /*          011000010001ccccc001aaaaa0010011 */ 0x61101013, 0xfff0707f, riscv_rv32b_011000010001ccccc001aaaaa0010011 },
-	{ "crc32.w", /*          011000010010ccccc001aaaaa0010011 */ 0x61201013, 0xfff0707f, riscv_rv32b_011000010010ccccc001aaaaa0010011 },
-	{ "crc32c.b", /*         011000011000ccccc001aaaaa0010011 */ 0x61801013, 0xfff0707f, riscv_rv32b_011000011000ccccc001aaaaa0010011 },
-	{ "crc32c.h", /*         011000011001ccccc001aaaaa0010011 */ 0x61901013, 0xfff0707f, riscv_rv32b_011000011001ccccc001aaaaa0010011 },
-	{ "crc32c.w", /*         011000011010ccccc001aaaaa0010011 */ 0x61a01013, 0xfff0707f, riscv_rv32b_011000011010ccccc001aaaaa0010011 },
-	{ "fclass.d", /*         111000100000ccccc001aaaaa1010011 */ 0xe2001053, 0xfff0707f, riscv_rv32d_111000100000ccccc001aaaaa1010011 },
-	{ "fmv.x.w", /*          111000000000ccccc000aaaaa1010011 */ 0xe0000053, 0xfff0707f, riscv_rv32f_111000000000ccccc000aaaaa1010011 },
-	{ "fclass.s", /*         111000000000ccccc001aaaaa1010011 */ 0xe0001053, 0xfff0707f, riscv_rv32f_111000000000ccccc001aaaaa1010011 },
-	{ "fmv.w.x", /*          111100000000ccccc000aaaaa1010011 */ 0xf0000053, 0xfff0707f, riscv_rv32f_111100000000ccccc000aaaaa1010011 },
-	{ "hlv.b", /*            011000000000ccccc100aaaaa1110011 */ 0x60004073, 0xfff0707f, riscv_rv32h_011000000000ccccc100aaaaa1110011 },
-	{ "hlv.bu", /*           011000000001ccccc100aaaaa1110011 */ 0x60104073, 0xfff0707f, riscv_rv32h_011000000001ccccc100aaaaa1110011 },
-	{ "hlv.h", /*            011001000000ccccc100aaaaa1110011 */ 0x64004073, 0xfff0707f, riscv_rv32h_011001000000ccccc100aaaaa1110011 },
-	{ "hlv.hu", /*           011001000001ccccc100aaaaa1110011 */ 0x64104073, 0xfff0707f, riscv_rv32h_011001000001ccccc100aaaaa1110011 },
-	{ "hlvx.hu", /*          011001000011ccccc100aaaaa1110011 */ 0x64304073, 0xfff0707f, riscv_rv32h_011001000011ccccc100aaaaa1110011 },
-	{ "hlv.w", /*            011010000000ccccc100aaaaa1110011 */ 0x68004073, 0xfff0707f, riscv_rv32h_011010000000ccccc100aaaaa1110011 },
-	{ "hlvx.wu", /*          011010000011ccccc100aaaaa1110011 */ 0x68304073, 0xfff0707f, riscv_rv32h_011010000011ccccc100aaaaa1110011 },
-	{ "fclass.q", /*         111001100000ccccc001aaaaa1010011 */ 0xe6001053, 0xfff0707f, riscv_rv32q_111001100000ccccc001aaaaa1010011 },
-	{ "fmv.x.h", /*          111001000000ccccc000aaaaa1010011 */ 0xe4000053, 0xfff0707f, riscv_rv32zfh_111001000000ccccc000aaaaa1010011 },
-	{ "fclass.h", /*         111001000000ccccc001aaaaa1010011 */ 0xe4001053, 0xfff0707f, riscv_rv32zfh_111001000000ccccc001aaaaa1010011 },
-	{ "fmv.h.x", /*          111101000000ccccc000aaaaa1010011 */ 0xf4000053, 0xfff0707f, riscv_rv32zfh_111101000000ccccc000aaaaa1010011 },
-	{ "bmatflip", /*         011000000011ccccc001aaaaa0010011 */ 0x60301013, 0xfff0707f, riscv_rv64b_011000000011ccccc001aaaaa0010011 },
-	{ "crc32.d", /*          011000010011ccccc001aaaaa0010011 */ 0x61301013, 0xfff0707f, riscv_rv64b_011000010011ccccc001aaaaa0010011 },
-	{ "crc32c.d", /*         011000011011ccccc001aaaaa0010011 */ 0x61b01013, 0xfff0707f, riscv_rv64b_011000011011ccccc001aaaaa0010011 },
-	{ "clzw", /*             011000000000ccccc001aaaaa0011011 */ 0x6000101b, 0xfff0707f, riscv_rv64b_011000000000ccccc001aaaaa0011011 },
-	{ "ctzw", /*             011000000001ccccc001aaaaa0011011 */ 0x6010101b, 0xfff0707f, riscv_rv64b_011000000001ccccc001aaaaa0011011 },
-	{ "cpopw", /*            011000000010ccccc001aaaaa0011011 */ 0x6020101b, 0xfff0707f, riscv_rv64b_011000000010ccccc001aaaaa0011011 },
-	{ "fmv.x.d", /*          111000100000ccccc000aaaaa1010011 */ 0xe2000053, 0xfff0707f, riscv_rv64d_111000100000ccccc000aaaaa1010011 },
-	{ "fmv.d.x", /*          111100100000ccccc000aaaaa1010011 */ 0xf2000053, 0xfff0707f, riscv_rv64d_111100100000ccccc000aaaaa1010011 },
-	{ "hlv.wu", /*           011010000001ccccc100aaaaa1110011 */ 0x68104073, 0xfff0707f, riscv_rv64h_011010000001ccccc100aaaaa1110011 },
-	{ "hlv.d", /*            011011000000ccccc100aaaaa1110011 */ 0x6c004073, 0xfff0707f, riscv_rv64h_011011000000ccccc100aaaaa1110011 },
-	{ "aes64im", /*          001100000000ccccc001aaaaa0010011 */ 0x30001013, 0xfff0707f, riscv_rv64k_001100000000ccccc001aaaaa0010011 },
-	{ "sha512sum0", /*       000100000100ccccc001aaaaa0010011 */ 0x10401013, 0xfff0707f, riscv_rv64k_000100000100ccccc001aaaaa0010011 },
-	{ "sha512sum1", /*       000100000101ccccc001aaaaa0010011 */ 0x10501013, 0xfff0707f, riscv_rv64k_000100000101ccccc001aaaaa0010011 },
-	{ "sha512sig0", /*       000100000110ccccc001aaaaa0010011 */ 0x10601013, 0xfff0707f, riscv_rv64k_000100000110ccccc001aaaaa0010011 },
-	{ "sha512sig1", /*       000100000111ccccc001aaaaa0010011 */ 0x10701013, 0xfff0707f, riscv_rv64k_000100000111ccccc001aaaaa0010011 },
-	{ "sm3p0", /*            000100001000ccccc001aaaaa0010011 */ 0x10801013, 0xfff0707f, riscv_rvk_000100001000ccccc001aaaaa0010011 },
-	{ "sm3p1", /*            000100001001ccccc001aaaaa0010011 */ 0x10901013, 0xfff0707f, riscv_rvk_000100001001ccccc001aaaaa0010011 },
-	{ "sha256sum0", /*       000100000000ccccc001aaaaa0010011 */ 0x10001013, 0xfff0707f, riscv_rvk_000100000000ccccc001aaaaa0010011 },
-	{ "sha256sum1", /*       000100000001ccccc001aaaaa0010011 */ 0x10101013, 0xfff0707f, riscv_rvk_000100000001ccccc001aaaaa0010011 },
-	{ "sha256sig0", /*       000100000010ccccc001aaaaa0010011 */ 0x10201013, 0xfff0707f, riscv_rvk_000100000010ccccc001aaaaa0010011 },
-	{ "sha256sig1", /*       000100000011ccccc001aaaaa0010011 */ 0x10301013, 0xfff0707f, riscv_rvk_000100000011ccccc001aaaaa0010011 },
-	{ "clrs8", /*            101011100000ccccc000aaaaa1110111 */ 0xae000077, 0xfff0707f, riscv_rvp_101011100000ccccc000aaaaa1110111 },
-	{ "clrs16", /*           101011101000ccccc000aaaaa1110111 */ 0xae800077, 0xfff0707f, riscv_rvp_101011101000ccccc000aaaaa1110111 },
-	{ "clrs32", /*           101011111000ccccc000aaaaa1110111 */ 0xaf800077, 0xfff0707f, riscv_rvp_101011111000ccccc000aaaaa1110111 },
-	{ "clo8", /*             101011100011ccccc000aaaaa1110111 */ 0xae300077, 0xfff0707f, riscv_rvp_101011100011ccccc000aaaaa1110111 },
-	{ "clo16", /*            101011101011ccccc000aaaaa1110111 */ 0xaeb00077, 0xfff0707f, riscv_rvp_101011101011ccccc000aaaaa1110111 },
-	{ "clo32", /*            101011111011ccccc000aaaaa1110111 */ 0xafb00077, 0xfff0707f, riscv_rvp_101011111011ccccc000aaaaa1110111 },
-	{ "clz8", /*             101011100001ccccc000aaaaa1110111 */ 0xae100077, 0xfff0707f, riscv_rvp_101011100001ccccc000aaaaa1110111 },
-	{ "clz16", /*            101011101001ccccc000aaaaa1110111 */ 0xae900077, 0xfff0707f, riscv_rvp_101011101001ccccc000aaaaa1110111 },
-	{ "clz32", /*            101011111001ccccc000aaaaa1110111 */ 0xaf900077, 0xfff0707f, riscv_rvp_101011111001ccccc000aaaaa1110111 },
-	{ "kabs8", /*            101011010000ccccc000aaaaa1110111 */ 0xad000077, 0xfff0707f, riscv_rvp_101011010000ccccc000aaaaa1110111 },
-	{ "kabs16", /*           101011010001ccccc000aaaaa1110111 */ 0xad100077, 0xfff0707f, riscv_rvp_101011010001ccccc000aaaaa1110111 },
-	{ "kabsw", /*            101011010100ccccc000aaaaa1110111 */ 0xad400077, 0xfff0707f, riscv_rvp_101011010100ccccc000aaaaa1110111 },
-	{ "sunpkd810", /*        101011001000ccccc000aaaaa1110111 */ 0xac800077, 0xfff0707f, riscv_rvp_101011001000ccccc000aaaaa1110111 },
-	{ "sunpkd820", /*        101011001001ccccc000aaaaa1110111 */ 0xac900077, 0xfff0707f, riscv_rvp_101011001001ccccc000aaaaa1110111 },
-	{ "sunpkd830", /*        101011001010ccccc000aaaaa1110111 */ 0xaca00077, 0xfff0707f, riscv_rvp_101011001010ccccc000aaaaa1110111 },
-	{ "sunpkd831", /*        101011001011ccccc000aaaaa1110111 */ 0xacb00077, 0xfff0707f, riscv_rvp_101011001011ccccc000aaaaa1110111 },
-	{ "sunpkd832", /*        101011010011ccccc000aaaaa1110111 */ 0xad300077, 0xfff0707f, riscv_rvp_101011010011ccccc000aaaaa1110111 },
-	{ "swap8", /*            101011011000ccccc000aaaaa1110111 */ 0xad800077, 0xfff0707f, riscv_rvp_101011011000ccccc000aaaaa1110111 },
-	{ "zunpkd810", /*        101011001100ccccc000aaaaa1110111 */ 0xacc00077, 0xfff0707f, riscv_rvp_101011001100ccccc000aaaaa1110111 },
-	{ "zunpkd820", /*        101011001101ccccc000aaaaa1110111 */ 0xacd00077, 0xfff0707f, riscv_rvp_101011001101ccccc000aaaaa1110111 },
-	{ "zunpkd830", /*        101011001110ccccc000aaaaa1110111 */ 0xace00077, 0xfff0707f, riscv_rvp_101011001110ccccc000aaaaa1110111 },
-	{ "zunpkd831", /*        101011001111ccccc000aaaaa1110111 */ 0xacf00077, 0xfff0707f, riscv_rvp_101011001111ccccc000aaaaa1110111 },
-	{ "zunpkd832", /*        101011010111ccccc000aaaaa1110111 */ 0xad700077, 0xfff0707f, riscv_rvp_101011010111ccccc000aaaaa1110111 },
-	{ "kabs32", /*           101011010010ccccc000aaaaa1110111 */ 0xad200077, 0xfff0707f, riscv_rvp_101011010010ccccc000aaaaa1110111 },
-	{ "vlm.v", /*            000000101011ccccc000DDDDD0000111 */ 0x02b00007, 0xfff0707f, riscv_rvv_000000101011ccccc000DDDDD0000111 },
-	{ "vsm.v", /*            000000101011ccccc000EEEEE0100111 */ 0x02b00027, 0xfff0707f, riscv_rvv_000000101011ccccc000EEEEE0100111 },
-	{ "vl1re8.v", /*         000000101000ccccc000DDDDD0000111 */ 0x02800007, 0xfff0707f, riscv_rvv_000000101000ccccc000DDDDD0000111 },
-	{ "vl1re16.v", /*        000000101000ccccc101DDDDD0000111 */ 0x02805007, 0xfff0707f, riscv_rvv_000000101000ccccc101DDDDD0000111 },
-	{ "vl1re32.v", /*        000000101000ccccc110DDDDD0000111 */ 0x02806007, 0xfff0707f, riscv_rvv_000000101000ccccc110DDDDD0000111 },
-	{ "vl1re64.v", /*        000000101000ccccc111DDDDD0000111 */ 0x02807007, 0xfff0707f, riscv_rvv_000000101000ccccc111DDDDD0000111 },
-	{ "vl2re8.v", /*         001000101000ccccc000DDDDD0000111 */ 0x22800007, 0xfff0707f, riscv_rvv_001000101000ccccc000DDDDD0000111 },
-	{ "vl2re16.v", /*        001000101000ccccc101DDDDD0000111 */ 0x22805007, 0xfff0707f, riscv_rvv_001000101000ccccc101DDDDD0000111 },
-	{ "vl2re32.v", /*        001000101000ccccc110DDDDD0000111 */ 0x22806007, 0xfff0707f, riscv_rvv_001000101000ccccc110DDDDD0000111 },
-	{ "vl2re64.v", /*        001000101000ccccc111DDDDD0000111 */ 0x22807007, 0xfff0707f, riscv_rvv_001000101000ccccc111DDDDD0000111 },
-	{ "vl4re8.v", /*         011000101000ccccc000DDDDD0000111 */ 0x62800007, 0xfff0707f, riscv_rvv_011000101000ccccc000DDDDD0000111 },
-	{ "vl4re16.v", /*        011000101000ccccc101DDDDD0000111 */ 0x62805007, 0xfff0707f, riscv_rvv_011000101000ccccc101DDDDD0000111 },
-	{ "vl4re32.v", /*        011000101000ccccc110DDDDD0000111 */ 0x62806007, 0xfff0707f, riscv_rvv_011000101000ccccc110DDDDD0000111 },
-	{ "vl4re64.v", /*        011000101000ccccc111DDDDD0000111 */ 0x62807007, 0xfff0707f, riscv_rvv_011000101000ccccc111DDDDD0000111 },
-	{ "vl8re8.v", /*         111000101000ccccc000DDDDD0000111 */ 0xe2800007, 0xfff0707f, riscv_rvv_111000101000ccccc000DDDDD0000111 },
-	{ "vl8re16.v", /*        111000101000ccccc101DDDDD0000111 */ 0xe2805007, 0xfff0707f, riscv_rvv_111000101000ccccc101DDDDD0000111 },
-	{ "vl8re32.v", /*        111000101000ccccc110DDDDD0000111 */ 0xe2806007, 0xfff0707f, riscv_rvv_111000101000ccccc110DDDDD0000111 },
-	{ "vl8re64.v", /*        111000101000ccccc111DDDDD0000111 */ 0xe2807007, 0xfff0707f, riscv_rvv_111000101000ccccc111DDDDD0000111 },
-	{ "vs1r.v", /*           000000101000ccccc000EEEEE0100111 */ 0x02800027, 0xfff0707f, riscv_rvv_000000101000ccccc000EEEEE0100111 },
-	{ "vs2r.v", /*           001000101000ccccc000EEEEE0100111 */ 0x22800027, 0xfff0707f, riscv_rvv_001000101000ccccc000EEEEE0100111 },
-	{ "vs4r.v", /*           011000101000ccccc000EEEEE0100111 */ 0x62800027, 0xfff0707f, riscv_rvv_011000101000ccccc000EEEEE0100111 },
-	{ "vs8r.v", /*           111000101000ccccc000EEEEE0100111 */ 0xe2800027, 0xfff0707f, riscv_rvv_111000101000ccccc000EEEEE0100111 },
-	{ "vfmv.s.f", /*         010000100000ccccc101DDDDD1010111 */ 0x42005057, 0xfff0707f, riscv_rvv_010000100000ccccc101DDDDD1010111 },
-	{ "vfmv.v.f", /*         010111100000ccccc101DDDDD1010111 */ 0x5e005057, 0xfff0707f, riscv_rvv_010111100000ccccc101DDDDD1010111 },
-	{ "vmv.v.x", /*          010111100000ccccc100DDDDD1010111 */ 0x5e004057, 0xfff0707f, riscv_rvv_010111100000ccccc100DDDDD1010111 },
-	{ "vmv.v.v", /*          010111100000FFFFF000DDDDD1010111 */ 0x5e000057, 0xfff0707f, riscv_rvv_010111100000FFFFF000DDDDD1010111 },
-	{ "vmv.v.i", /*          010111100000LLLLL011DDDDD1010111 */ 0x5e003057, 0xfff0707f, riscv_rvv_010111100000LLLLL011DDDDD1010111 },
-	{ "vmv.s.x", /*          010000100000ccccc110DDDDD1010111 */ 0x42006057, 0xfff0707f, riscv_rvv_010000100000ccccc110DDDDD1010111 },
-	{ "vl1r.v", /*           000000101000ccccc000DDDDD0000111 */ 0x02800007, 0xfff0707f, riscv_rvv_000000101000ccccc000DDDDD0000111 },
-	{ "vl2r.v", /*           000001101000ccccc101DDDDD0000111 */ 0x06805007, 0xfff0707f, riscv_rvv_000001101000ccccc101DDDDD0000111 },
-	{ "vl4r.v", /*           000011101000ccccc110DDDDD0000111 */ 0x0e806007, 0xfff0707f, riscv_rvv_000011101000ccccc110DDDDD0000111 },
-	{ "vl8r.v", /*           000111101000ccccc111DDDDD0000111 */ 0x1e807007, 0xfff0707f, riscv_rvv_000111101000ccccc111DDDDD0000111 },
-	{ "vle1.v", /*           000000101011ccccc000DDDDD0000111 */ 0x02b00007, 0xfff0707f, riscv_rvv_000000101011ccccc000DDDDD0000111 },
-	{ "vse1.v", /*           000000101011ccccc000EEEEE0100111 */ 0x02b00027, 0xfff0707f, riscv_rvv_000000101011ccccc000EEEEE0100111 },
-	{ "cbo.clean", /*        000000000001ccccc010000000001111 */ 0x0010200f, 0xfff07fff, riscv_zicbo_000000000001ccccc010000000001111 },
-	{ "cbo.flush", /*        000000000010ccccc010000000001111 */ 0x0020200f, 0xfff07fff, riscv_zicbo_000000000010ccccc010000000001111 },
-	{ "cbo.inval", /*        000000000000ccccc010000000001111 */ 0x0000200f, 0xfff07fff, riscv_zicbo_000000000000ccccc010000000001111 },
-	{ "cbo.zero", /*         000000000100ccccc010000000001111 */ 0x0040200f, 0xfff07fff, riscv_zicbo_000000000100ccccc010000000001111 },
-	{ "frflags", /*          00000000000100000010aaaaa1110011 */ 0x00102073, 0xfffff07f, riscv_pseudo_00000000000100000010aaaaa1110011 },
-	{ "frrm", /*             00000000001000000010aaaaa1110011 */ 0x00202073, 0xfffff07f, riscv_pseudo_00000000001000000010aaaaa1110011 },
-	{ "frcsr", /*            00000000001100000010aaaaa1110011 */ 0x00302073, 0xfffff07f, riscv_pseudo_00000000001100000010aaaaa1110011 },
-	{ "rdcycle", /*          11000000000000000010aaaaa1110011 */ 0xc0002073, 0xfffff07f, riscv_pseudo_11000000000000000010aaaaa1110011 },
-	{ "rdtime", /*           11000000000100000010aaaaa1110011 */ 0xc0102073, 0xfffff07f, riscv_pseudo_11000000000100000010aaaaa1110011 },
-	{ "rdinstret", /*        11000000001000000010aaaaa1110011 */ 0xc0202073, 0xfffff07f, riscv_pseudo_11000000001000000010aaaaa1110011 },
-	{ "rdcycleh", /*         11001000000000000010aaaaa1110011 */ 0xc8002073, 0xfffff07f, riscv_pseudo_11001000000000000010aaaaa1110011 },
-	{ "rdtimeh", /*          11001000000100000010aaaaa1110011 */ 0xc8102073, 0xfffff07f, riscv_pseudo_11001000000100000010aaaaa1110011 },
-	{ "rdinstreth", /*       11001000001000000010aaaaa1110011 */ 0xc8202073, 0xfffff07f, riscv_pseudo_11001000001000000010aaaaa1110011 },
-	{ "scall", /*            00000000000000000000000001110011 */ 0x00000073, 0xffffffff, riscv_unique },
-	{ "sbreak", /*           00000000000100000000000001110011 */ 0x00100073, 0xffffffff, riscv_unique },
-	{ "pause", /*            00000001000000000000000000001111 */ 0x0100000f, 0xffffffff, riscv_unique },
-	{ "sfence.w.inval", /*   00011000000000000000000001110011 */ 0x18000073, 0xffffffff, riscv_unique },
-	{ "sfence.inval.ir", /*  00011000000100000000000001110011 */ 0x18100073, 0xffffffff, riscv_unique },
-	{ "ecall", /*            00000000000000000000000001110011 */ 0x00000073, 0xffffffff, riscv_unique },
-	{ "ebreak", /*           00000000000100000000000001110011 */ 0x00100073, 0xffffffff, riscv_unique },
-	{ "sret", /*             00010000001000000000000001110011 */ 0x10200073, 0xffffffff, riscv_unique },
-	{ "mret", /*             00110000001000000000000001110011 */ 0x30200073, 0xffffffff, riscv_unique },
-	{ "dret", /*             01111011001000000000000001110011 */ 0x7b200073, 0xffffffff, riscv_unique },
-	{ "wfi", /*              00010000010100000000000001110011 */ 0x10500073, 0xffffffff, riscv_unique },
+bool riscv_decode_word(ut32 data, RISCVDecoded *dec) {
+	rz_return_val_if_fail(dec, false);
+	st32 id = riscv_lookup(data);
+	if (id < 0) {
+		return false;
+	}
+	dec->data = data;
+	dec->id = id;
+	dec->size = 4;
+	dec->rd = (data >> 7) & 0x1f;
+	dec->rs1 = (data >> 15) & 0x1f;
+	dec->rs2 = (data >> 20) & 0x1f;
+	dec->rs3 = data >> 27;
+	dec->imm = riscv_immediate(instructions[id].imm, data);
+	return true;
+}
+
+bool riscv_decode(const ut8 *buffer, const ut32 size, bool be, RISCVDecoded *dec) {
+	rz_return_val_if_fail(buffer && dec, false);
+	if (size < 4) {
+		return false;
+	}
+	return riscv_decode_word(rz_read_ble32(buffer, be), dec);
 }
 
 ut32 riscv_disassembler(const ut8 *buffer, const ut32 size, ut64 pc, bool be, RzStrBuf *sb) {
 	rz_return_val_if_fail(buffer && size && sb, false);
-	if (size < 2) {
+	if (size < 4) {
 		return RISCV_INVALID_SIZE;
 	}
 
-	ut32 masked;
-	ut32 data = rz_read_ble16(buffer, be);
+	RISCVDecoded dec;
+	if (!riscv_decode(buffer, size, be, &dec)) {
+		return RISCV_INVALID_SIZE;
+	}
+	if (riscv_alias(&dec, pc, sb)) {
+		return dec.size;
+	}
+	const RISCVStandard *standard = riscv_standard(dec.id);
+	const RISCVDescription *desc = &standard->descriptions[dec.id - standard->first];
+	return decoders[desc->decode](standard->names + desc->name, dec.data, pc, sb);
+}
+
+#ifndef RISCV_STANDALONE
+ut32 riscv_analyze(const ut8 *buffer, const ut32 size, ut64 pc, bool be, RzAnalysisOp *op) {
+	rz_return_val_if_fail(buffer && size && op, RISCV_INVALID_SIZE);
+	RISCVDecoded dec;
+
+	op->addr = pc;
+	op->jump = UT64_MAX;
+	op->fail = UT64_MAX;
+	op->ptr = UT64_MAX;
+	op->val = UT64_MAX;
+	if (!riscv_decode(buffer, size, be, &dec)) {
+		op->type = RZ_ANALYSIS_OP_TYPE_ILL;
+		op->size = size < 4 ? size : 4;
+		return RISCV_INVALID_SIZE;
+	}
 
-	for (ut32 i = 0; i < RZ_ARRAY_SIZE(instructions); ++i) {
-		masked = data & instructions[i].mbits;
-		if (masked == instructions[i].cbits) {
-			return instructions[i].decode(instructions[i].name, data, pc, sb);
+	const RISCVAnalysis *info = riscv_analysis(dec.id);
+	op->id = dec.id;
+	op->size = dec.size;
+	op->type = info->type;
+	op->family = info->family;
+	op->cond = info->cond;
+
+	switch (info->type) {
+	case RZ_ANALYSIS_OP_TYPE_JMP:
+		/* jal, any link register other than zero makes it a call */
+		op->jump = pc + dec.imm;
+		if (dec.rd != RISCV_REG_ZERO) {
+			op->type = RZ_ANALYSIS_OP_TYPE_CALL;
+			op->fail = pc + dec.size;
+		}
+		break;
+	case RZ_ANALYSIS_OP_TYPE_RJMP:
+		/* jalr */
+		if (dec.rd == RISCV_REG_ZERO && dec.rs1 == RISCV_REG_RA && !dec.imm) {
+			op->type = RZ_ANALYSIS_OP_TYPE_RET;
+			op->eob = true;
+		} else if (dec.rs1 == RISCV_REG_ZERO) {
+			op->type = dec.rd == RISCV_REG_ZERO ? RZ_ANALYSIS_OP_TYPE_JMP : RZ_ANALYSIS_OP_TYPE_CALL;
+			op->jump = (ut64)dec.imm;
+		} else if (dec.rd != RISCV_REG_ZERO) {
+			op->type = RZ_ANALYSIS_OP_TYPE_RCALL;
+		}
+		if (dec.rd != RISCV_REG_ZERO) {
+			op->fail = pc + dec.size;
+		}
+		break;
+	case RZ_ANALYSIS_OP_TYPE_CJMP:
+		op->jump = pc + dec.imm;
+		op->fail = pc + dec.size;
+		break;
+	case RZ_ANALYSIS_OP_TYPE_RET:
+		op->eob = true;
+		break;
+	case RZ_ANALYSIS_OP_TYPE_LOAD:
+	case RZ_ANALYSIS_OP_TYPE_STORE:
+	case RZ_ANALYSIS_OP_TYPE_XCHG:
+		op->refptr = info->memsize;
+		op->ptrsize = info->memsize;
+		if (dec.rs1 == RISCV_REG_SP && instructions[dec.id].imm != RISCV_IMM_NONE) {
+			op->stackop = info->type == RZ_ANALYSIS_OP_TYPE_LOAD ? RZ_ANALYSIS_STACK_GET : RZ_ANALYSIS_STACK_SET;
+			op->ptr = dec.imm;
+		} else if (dec.rs1 == RISCV_REG_ZERO) {
+			op->ptr = dec.imm;
+		}
+		break;
+	case RZ_ANALYSIS_OP_TYPE_LEA:
+		/* auipc */
+		op->ptr = pc + dec.imm;
+		break;
+	case RZ_ANALYSIS_OP_TYPE_ADD:
+		if (instructions[dec.id].imm != RISCV_IMM_I || info->family != RZ_ANALYSIS_OP_FAMILY_CPU) {
+			break;
+		}
+		op->val = dec.imm;
+		if (dec.rd == RISCV_REG_SP && dec.rs1 == RISCV_REG_SP) {
+			op->stackop = RZ_ANALYSIS_STACK_INC;
+			op->stackptr = -dec.imm;
+		}
+		break;
+	default:
+		if (instructions[dec.id].imm != RISCV_IMM_NONE) {
+			op->val = dec.imm;
 		}
+		break;
 	}
-	return RISCV_INVALID_SIZE;
+	return dec.size;
 }
+#endif /* RISCV_STANDALONE */
 
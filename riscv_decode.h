@@ -0,0 +1,1646 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_DECODE_H
+#define RISCV_DECODE_H
+
+/* exported functions, the rest of the library is built with hidden visibility */
+#if defined(__GNUC__) && !defined(_WIN32)
+#define RISCV_API __attribute__((visibility("default")))
+#else
+#define RISCV_API
+#endif
+
+#ifdef RISCV_STANDALONE
+#include "riscv_shim.h"
+#else
+#include <rz_types.h>
+#include <rz_util.h>
+#include <rz_analysis.h>
+#include <rz_il.h>
+#endif
+
+#define RISCV_INVALID_SIZE 0
+
+#define RISCV_REG_ZERO 0
+#define RISCV_REG_RA   1
+#define RISCV_REG_SP   2
+#define RISCV_REG_GP   3
+#define RISCV_REG_TP   4
+
+/* size of the register names, "zero" included */
+#define RISCV_REG_NAME_SIZE 5
+
+typedef enum {
+	RISCV_IMM_NONE = 0,
+	RISCV_IMM_I, /*      imm12 (sign extended) */
+	RISCV_IMM_S, /*      imm12hi + imm12lo (sign extended) */
+	RISCV_IMM_B, /*      bimm12hi + bimm12lo (sign extended, pc relative) */
+	RISCV_IMM_U, /*      imm20 << 12 (sign extended) */
+	RISCV_IMM_J, /*      jimm20 (sign extended, pc relative) */
+	RISCV_IMM_CSR, /*    imm12 as csr number */
+	RISCV_IMM_UIMM2, /*  bits 21:20 */
+	RISCV_IMM_UIMM3, /*  bits 22:20 */
+	RISCV_IMM_UIMM4, /*  bits 23:20 */
+	RISCV_IMM_UIMM5, /*  bits 24:20 */
+	RISCV_IMM_UIMM6, /*  bits 25:20 */
+	RISCV_IMM_ZIMM, /*   bits 19:15 */
+	RISCV_IMM_SIMM5, /*  bits 19:15 (sign extended) */
+	RISCV_IMM_ZIMM10, /* bits 29:20 */
+	RISCV_IMM_ZIMM11, /* bits 30:20 */
+	RISCV_IMM_BS, /*     bits 31:30 */
+} RISCVImmediate;
+
+/* register operand roles, used by riscv_registers() to build the masks */
+#define RISCV_REGS_GPR_RD     (1 << 0)
+#define RISCV_REGS_GPR_RS1    (1 << 1)
+#define RISCV_REGS_GPR_RS2    (1 << 2)
+#define RISCV_REGS_GPR_RS3    (1 << 3)
+#define RISCV_REGS_FPR_RD     (1 << 4)
+#define RISCV_REGS_FPR_RS1    (1 << 5)
+#define RISCV_REGS_FPR_RS2    (1 << 6)
+#define RISCV_REGS_FPR_RS3    (1 << 7)
+#define RISCV_REGS_VEC_RD     (1 << 8)
+#define RISCV_REGS_VEC_RS1    (1 << 9)
+#define RISCV_REGS_VEC_RS2    (1 << 10)
+#define RISCV_REGS_VEC_RD_USE (1 << 11) /* vd/vs3 is read (stores and accumulators) */
+#define RISCV_REGS_VEC_VM     (1 << 12) /* v0 is read when the vm bit is clear */
+
+typedef enum {
+	RISCV_CSR_USTATUS = 0x000,
+	RISCV_CSR_FFLAGS = 0x001,
+	RISCV_CSR_FRM = 0x002,
+	RISCV_CSR_FCSR = 0x003,
+	RISCV_CSR_UIE = 0x004,
+	RISCV_CSR_UTVEC = 0x005,
+	RISCV_CSR_VSTART = 0x008,
+	RISCV_CSR_VXSAT = 0x009,
+	RISCV_CSR_VXRM = 0x00a,
+	RISCV_CSR_VCSR = 0x00f,
+	RISCV_CSR_SEED = 0x015,
+	RISCV_CSR_USCRATCH = 0x040,
+	RISCV_CSR_UEPC = 0x041,
+	RISCV_CSR_UCAUSE = 0x042,
+	RISCV_CSR_UTVAL = 0x043,
+	RISCV_CSR_UIP = 0x044,
+	RISCV_CSR_SSTATUS = 0x100,
+	RISCV_CSR_SEDELEG = 0x102,
+	RISCV_CSR_SIDELEG = 0x103,
+	RISCV_CSR_SIE = 0x104,
+	RISCV_CSR_STVEC = 0x105,
+	RISCV_CSR_SCOUNTEREN = 0x106,
+	RISCV_CSR_SENVCFG = 0x10a,
+	RISCV_CSR_SSCRATCH = 0x140,
+	RISCV_CSR_SEPC = 0x141,
+	RISCV_CSR_SCAUSE = 0x142,
+	RISCV_CSR_STVAL = 0x143,
+	RISCV_CSR_SIP = 0x144,
+	RISCV_CSR_STIMECMP = 0x14d,
+	RISCV_CSR_STIMECMPH = 0x15d, /* rv32 only */
+	RISCV_CSR_SATP = 0x180,
+	RISCV_CSR_VSSTATUS = 0x200,
+	RISCV_CSR_VSIE = 0x204,
+	RISCV_CSR_VSTVEC = 0x205,
+	RISCV_CSR_VSSCRATCH = 0x240,
+	RISCV_CSR_VSEPC = 0x241,
+	RISCV_CSR_VSCAUSE = 0x242,
+	RISCV_CSR_VSTVAL = 0x243,
+	RISCV_CSR_VSIP = 0x244,
+	RISCV_CSR_VSTIMECMP = 0x24d,
+	RISCV_CSR_VSTIMECMPH = 0x25d, /* rv32 only */
+	RISCV_CSR_VSATP = 0x280,
+	RISCV_CSR_MSTATUS = 0x300,
+	RISCV_CSR_MISA = 0x301,
+	RISCV_CSR_MEDELEG = 0x302,
+	RISCV_CSR_MIDELEG = 0x303,
+	RISCV_CSR_MIE = 0x304,
+	RISCV_CSR_MTVEC = 0x305,
+	RISCV_CSR_MCOUNTEREN = 0x306,
+	RISCV_CSR_MENVCFG = 0x30a,
+	RISCV_CSR_MSTATUSH = 0x310, /* rv32 only */
+	RISCV_CSR_MENVCFGH = 0x31a, /* rv32 only */
+	RISCV_CSR_MCOUNTINHIBIT = 0x320,
+	RISCV_CSR_MHPMEVENT3 = 0x323,
+	RISCV_CSR_MHPMEVENT4 = 0x324,
+	RISCV_CSR_MHPMEVENT5 = 0x325,
+	RISCV_CSR_MHPMEVENT6 = 0x326,
+	RISCV_CSR_MHPMEVENT7 = 0x327,
+	RISCV_CSR_MHPMEVENT8 = 0x328,
+	RISCV_CSR_MHPMEVENT9 = 0x329,
+	RISCV_CSR_MHPMEVENT10 = 0x32a,
+	RISCV_CSR_MHPMEVENT11 = 0x32b,
+	RISCV_CSR_MHPMEVENT12 = 0x32c,
+	RISCV_CSR_MHPMEVENT13 = 0x32d,
+	RISCV_CSR_MHPMEVENT14 = 0x32e,
+	RISCV_CSR_MHPMEVENT15 = 0x32f,
+	RISCV_CSR_MHPMEVENT16 = 0x330,
+	RISCV_CSR_MHPMEVENT17 = 0x331,
+	RISCV_CSR_MHPMEVENT18 = 0x332,
+	RISCV_CSR_MHPMEVENT19 = 0x333,
+	RISCV_CSR_MHPMEVENT20 = 0x334,
+	RISCV_CSR_MHPMEVENT21 = 0x335,
+	RISCV_CSR_MHPMEVENT22 = 0x336,
+	RISCV_CSR_MHPMEVENT23 = 0x337,
+	RISCV_CSR_MHPMEVENT24 = 0x338,
+	RISCV_CSR_MHPMEVENT25 = 0x339,
+	RISCV_CSR_MHPMEVENT26 = 0x33a,
+	RISCV_CSR_MHPMEVENT27 = 0x33b,
+	RISCV_CSR_MHPMEVENT28 = 0x33c,
+	RISCV_CSR_MHPMEVENT29 = 0x33d,
+	RISCV_CSR_MHPMEVENT30 = 0x33e,
+	RISCV_CSR_MHPMEVENT31 = 0x33f,
+	RISCV_CSR_MSCRATCH = 0x340,
+	RISCV_CSR_MEPC = 0x341,
+	RISCV_CSR_MCAUSE = 0x342,
+	RISCV_CSR_MTVAL = 0x343,
+	RISCV_CSR_MIP = 0x344,
+	RISCV_CSR_MTINST = 0x34a,
+	RISCV_CSR_MTVAL2 = 0x34b,
+	RISCV_CSR_PMPCFG0 = 0x3a0,
+	RISCV_CSR_PMPCFG1 = 0x3a1,
+	RISCV_CSR_PMPCFG2 = 0x3a2,
+	RISCV_CSR_PMPCFG3 = 0x3a3,
+	RISCV_CSR_PMPCFG4 = 0x3a4,
+	RISCV_CSR_PMPCFG5 = 0x3a5,
+	RISCV_CSR_PMPCFG6 = 0x3a6,
+	RISCV_CSR_PMPCFG7 = 0x3a7,
+	RISCV_CSR_PMPCFG8 = 0x3a8,
+	RISCV_CSR_PMPCFG9 = 0x3a9,
+	RISCV_CSR_PMPCFG10 = 0x3aa,
+	RISCV_CSR_PMPCFG11 = 0x3ab,
+	RISCV_CSR_PMPCFG12 = 0x3ac,
+	RISCV_CSR_PMPCFG13 = 0x3ad,
+	RISCV_CSR_PMPCFG14 = 0x3ae,
+	RISCV_CSR_PMPCFG15 = 0x3af,
+	RISCV_CSR_PMPADDR0 = 0x3b0,
+	RISCV_CSR_PMPADDR1 = 0x3b1,
+	RISCV_CSR_PMPADDR2 = 0x3b2,
+	RISCV_CSR_PMPADDR3 = 0x3b3,
+	RISCV_CSR_PMPADDR4 = 0x3b4,
+	RISCV_CSR_PMPADDR5 = 0x3b5,
+	RISCV_CSR_PMPADDR6 = 0x3b6,
+	RISCV_CSR_PMPADDR7 = 0x3b7,
+	RISCV_CSR_PMPADDR8 = 0x3b8,
+	RISCV_CSR_PMPADDR9 = 0x3b9,
+	RISCV_CSR_PMPADDR10 = 0x3ba,
+	RISCV_CSR_PMPADDR11 = 0x3bb,
+	RISCV_CSR_PMPADDR12 = 0x3bc,
+	RISCV_CSR_PMPADDR13 = 0x3bd,
+	RISCV_CSR_PMPADDR14 = 0x3be,
+	RISCV_CSR_PMPADDR15 = 0x3bf,
+	RISCV_CSR_PMPADDR16 = 0x3c0,
+	RISCV_CSR_PMPADDR17 = 0x3c1,
+	RISCV_CSR_PMPADDR18 = 0x3c2,
+	RISCV_CSR_PMPADDR19 = 0x3c3,
+	RISCV_CSR_PMPADDR20 = 0x3c4,
+	RISCV_CSR_PMPADDR21 = 0x3c5,
+	RISCV_CSR_PMPADDR22 = 0x3c6,
+	RISCV_CSR_PMPADDR23 = 0x3c7,
+	RISCV_CSR_PMPADDR24 = 0x3c8,
+	RISCV_CSR_PMPADDR25 = 0x3c9,
+	RISCV_CSR_PMPADDR26 = 0x3ca,
+	RISCV_CSR_PMPADDR27 = 0x3cb,
+	RISCV_CSR_PMPADDR28 = 0x3cc,
+	RISCV_CSR_PMPADDR29 = 0x3cd,
+	RISCV_CSR_PMPADDR30 = 0x3ce,
+	RISCV_CSR_PMPADDR31 = 0x3cf,
+	RISCV_CSR_PMPADDR32 = 0x3d0,
+	RISCV_CSR_PMPADDR33 = 0x3d1,
+	RISCV_CSR_PMPADDR34 = 0x3d2,
+	RISCV_CSR_PMPADDR35 = 0x3d3,
+	RISCV_CSR_PMPADDR36 = 0x3d4,
+	RISCV_CSR_PMPADDR37 = 0x3d5,
+	RISCV_CSR_PMPADDR38 = 0x3d6,
+	RISCV_CSR_PMPADDR39 = 0x3d7,
+	RISCV_CSR_PMPADDR40 = 0x3d8,
+	RISCV_CSR_PMPADDR41 = 0x3d9,
+	RISCV_CSR_PMPADDR42 = 0x3da,
+	RISCV_CSR_PMPADDR43 = 0x3db,
+	RISCV_CSR_PMPADDR44 = 0x3dc,
+	RISCV_CSR_PMPADDR45 = 0x3dd,
+	RISCV_CSR_PMPADDR46 = 0x3de,
+	RISCV_CSR_PMPADDR47 = 0x3df,
+	RISCV_CSR_PMPADDR48 = 0x3e0,
+	RISCV_CSR_PMPADDR49 = 0x3e1,
+	RISCV_CSR_PMPADDR50 = 0x3e2,
+	RISCV_CSR_PMPADDR51 = 0x3e3,
+	RISCV_CSR_PMPADDR52 = 0x3e4,
+	RISCV_CSR_PMPADDR53 = 0x3e5,
+	RISCV_CSR_PMPADDR54 = 0x3e6,
+	RISCV_CSR_PMPADDR55 = 0x3e7,
+	RISCV_CSR_PMPADDR56 = 0x3e8,
+	RISCV_CSR_PMPADDR57 = 0x3e9,
+	RISCV_CSR_PMPADDR58 = 0x3ea,
+	RISCV_CSR_PMPADDR59 = 0x3eb,
+	RISCV_CSR_PMPADDR60 = 0x3ec,
+	RISCV_CSR_PMPADDR61 = 0x3ed,
+	RISCV_CSR_PMPADDR62 = 0x3ee,
+	RISCV_CSR_PMPADDR63 = 0x3ef,
+	RISCV_CSR_SCONTEXT = 0x5a8,
+	RISCV_CSR_HSTATUS = 0x600,
+	RISCV_CSR_HEDELEG = 0x602,
+	RISCV_CSR_HIDELEG = 0x603,
+	RISCV_CSR_HIE = 0x604,
+	RISCV_CSR_HTIMEDELTA = 0x605,
+	RISCV_CSR_HCOUNTEREN = 0x606,
+	RISCV_CSR_HGEIE = 0x607,
+	RISCV_CSR_HENVCFG = 0x60a,
+	RISCV_CSR_HTIMEDELTAH = 0x615, /* rv32 only */
+	RISCV_CSR_HENVCFGH = 0x61a, /* rv32 only */
+	RISCV_CSR_HTVAL = 0x643,
+	RISCV_CSR_HIP = 0x644,
+	RISCV_CSR_HVIP = 0x645,
+	RISCV_CSR_HTINST = 0x64a,
+	RISCV_CSR_HGATP = 0x680,
+	RISCV_CSR_HCONTEXT = 0x6a8,
+	RISCV_CSR_MSECCFG = 0x747,
+	RISCV_CSR_MSECCFGH = 0x757, /* rv32 only */
+	RISCV_CSR_TSELECT = 0x7a0,
+	RISCV_CSR_TDATA1 = 0x7a1,
+	RISCV_CSR_TDATA2 = 0x7a2,
+	RISCV_CSR_TDATA3 = 0x7a3,
+	RISCV_CSR_TINFO = 0x7a4,
+	RISCV_CSR_TCONTROL = 0x7a5,
+	RISCV_CSR_MCONTEXT = 0x7a8,
+	RISCV_CSR_MSCONTEXT = 0x7aa,
+	RISCV_CSR_DCSR = 0x7b0,
+	RISCV_CSR_DPC = 0x7b1,
+	RISCV_CSR_DSCRATCH0 = 0x7b2,
+	RISCV_CSR_DSCRATCH1 = 0x7b3,
+	RISCV_CSR_MCYCLE = 0xb00,
+	RISCV_CSR_MINSTRET = 0xb02,
+	RISCV_CSR_MHPMCOUNTER3 = 0xb03,
+	RISCV_CSR_MHPMCOUNTER4 = 0xb04,
+	RISCV_CSR_MHPMCOUNTER5 = 0xb05,
+	RISCV_CSR_MHPMCOUNTER6 = 0xb06,
+	RISCV_CSR_MHPMCOUNTER7 = 0xb07,
+	RISCV_CSR_MHPMCOUNTER8 = 0xb08,
+	RISCV_CSR_MHPMCOUNTER9 = 0xb09,
+	RISCV_CSR_MHPMCOUNTER10 = 0xb0a,
+	RISCV_CSR_MHPMCOUNTER11 = 0xb0b,
+	RISCV_CSR_MHPMCOUNTER12 = 0xb0c,
+	RISCV_CSR_MHPMCOUNTER13 = 0xb0d,
+	RISCV_CSR_MHPMCOUNTER14 = 0xb0e,
+	RISCV_CSR_MHPMCOUNTER15 = 0xb0f,
+	RISCV_CSR_MHPMCOUNTER16 = 0xb10,
+	RISCV_CSR_MHPMCOUNTER17 = 0xb11,
+	RISCV_CSR_MHPMCOUNTER18 = 0xb12,
+	RISCV_CSR_MHPMCOUNTER19 = 0xb13,
+	RISCV_CSR_MHPMCOUNTER20 = 0xb14,
+	RISCV_CSR_MHPMCOUNTER21 = 0xb15,
+	RISCV_CSR_MHPMCOUNTER22 = 0xb16,
+	RISCV_CSR_MHPMCOUNTER23 = 0xb17,
+	RISCV_CSR_MHPMCOUNTER24 = 0xb18,
+	RISCV_CSR_MHPMCOUNTER25 = 0xb19,
+	RISCV_CSR_MHPMCOUNTER26 = 0xb1a,
+	RISCV_CSR_MHPMCOUNTER27 = 0xb1b,
+	RISCV_CSR_MHPMCOUNTER28 = 0xb1c,
+	RISCV_CSR_MHPMCOUNTER29 = 0xb1d,
+	RISCV_CSR_MHPMCOUNTER30 = 0xb1e,
+	RISCV_CSR_MHPMCOUNTER31 = 0xb1f,
+	RISCV_CSR_MCYCLEH = 0xb80, /* rv32 only */
+	RISCV_CSR_MINSTRETH = 0xb82, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER3H = 0xb83, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER4H = 0xb84, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER5H = 0xb85, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER6H = 0xb86, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER7H = 0xb87, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER8H = 0xb88, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER9H = 0xb89, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER10H = 0xb8a, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER11H = 0xb8b, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER12H = 0xb8c, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER13H = 0xb8d, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER14H = 0xb8e, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER15H = 0xb8f, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER16H = 0xb90, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER17H = 0xb91, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER18H = 0xb92, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER19H = 0xb93, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER20H = 0xb94, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER21H = 0xb95, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER22H = 0xb96, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER23H = 0xb97, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER24H = 0xb98, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER25H = 0xb99, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER26H = 0xb9a, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER27H = 0xb9b, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER28H = 0xb9c, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER29H = 0xb9d, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER30H = 0xb9e, /* rv32 only */
+	RISCV_CSR_MHPMCOUNTER31H = 0xb9f, /* rv32 only */
+	RISCV_CSR_CYCLE = 0xc00,
+	RISCV_CSR_TIME = 0xc01,
+	RISCV_CSR_INSTRET = 0xc02,
+	RISCV_CSR_HPMCOUNTER3 = 0xc03,
+	RISCV_CSR_HPMCOUNTER4 = 0xc04,
+	RISCV_CSR_HPMCOUNTER5 = 0xc05,
+	RISCV_CSR_HPMCOUNTER6 = 0xc06,
+	RISCV_CSR_HPMCOUNTER7 = 0xc07,
+	RISCV_CSR_HPMCOUNTER8 = 0xc08,
+	RISCV_CSR_HPMCOUNTER9 = 0xc09,
+	RISCV_CSR_HPMCOUNTER10 = 0xc0a,
+	RISCV_CSR_HPMCOUNTER11 = 0xc0b,
+	RISCV_CSR_HPMCOUNTER12 = 0xc0c,
+	RISCV_CSR_HPMCOUNTER13 = 0xc0d,
+	RISCV_CSR_HPMCOUNTER14 = 0xc0e,
+	RISCV_CSR_HPMCOUNTER15 = 0xc0f,
+	RISCV_CSR_HPMCOUNTER16 = 0xc10,
+	RISCV_CSR_HPMCOUNTER17 = 0xc11,
+	RISCV_CSR_HPMCOUNTER18 = 0xc12,
+	RISCV_CSR_HPMCOUNTER19 = 0xc13,
+	RISCV_CSR_HPMCOUNTER20 = 0xc14,
+	RISCV_CSR_HPMCOUNTER21 = 0xc15,
+	RISCV_CSR_HPMCOUNTER22 = 0xc16,
+	RISCV_CSR_HPMCOUNTER23 = 0xc17,
+	RISCV_CSR_HPMCOUNTER24 = 0xc18,
+	RISCV_CSR_HPMCOUNTER25 = 0xc19,
+	RISCV_CSR_HPMCOUNTER26 = 0xc1a,
+	RISCV_CSR_HPMCOUNTER27 = 0xc1b,
+	RISCV_CSR_HPMCOUNTER28 = 0xc1c,
+	RISCV_CSR_HPMCOUNTER29 = 0xc1d,
+	RISCV_CSR_HPMCOUNTER30 = 0xc1e,
+	RISCV_CSR_HPMCOUNTER31 = 0xc1f,
+	RISCV_CSR_VL = 0xc20,
+	RISCV_CSR_VTYPE = 0xc21,
+	RISCV_CSR_VLENB = 0xc22,
+	RISCV_CSR_CYCLEH = 0xc80, /* rv32 only */
+	RISCV_CSR_TIMEH = 0xc81, /* rv32 only */
+	RISCV_CSR_INSTRETH = 0xc82, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER3H = 0xc83, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER4H = 0xc84, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER5H = 0xc85, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER6H = 0xc86, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER7H = 0xc87, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER8H = 0xc88, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER9H = 0xc89, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER10H = 0xc8a, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER11H = 0xc8b, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER12H = 0xc8c, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER13H = 0xc8d, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER14H = 0xc8e, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER15H = 0xc8f, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER16H = 0xc90, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER17H = 0xc91, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER18H = 0xc92, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER19H = 0xc93, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER20H = 0xc94, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER21H = 0xc95, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER22H = 0xc96, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER23H = 0xc97, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER24H = 0xc98, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER25H = 0xc99, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER26H = 0xc9a, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER27H = 0xc9b, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER28H = 0xc9c, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER29H = 0xc9d, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER30H = 0xc9e, /* rv32 only */
+	RISCV_CSR_HPMCOUNTER31H = 0xc9f, /* rv32 only */
+	RISCV_CSR_HGEIP = 0xe12,
+	RISCV_CSR_MVENDORID = 0xf11,
+	RISCV_CSR_MARCHID = 0xf12,
+	RISCV_CSR_MIMPID = 0xf13,
+	RISCV_CSR_MHARTID = 0xf14,
+	RISCV_CSR_MCONFIGPTR = 0xf15,
+} RISCVCsr;
+
+typedef enum {
+	RISCV_INS_JAL,
+	RISCV_INS_LUI,
+	RISCV_INS_AUIPC,
+	RISCV_INS_BEQ,
+	RISCV_INS_BNE,
+	RISCV_INS_BLT,
+	RISCV_INS_BGE,
+	RISCV_INS_BLTU,
+	RISCV_INS_BGEU,
+	RISCV_INS_JALR,
+	RISCV_INS_ADDI,
+	RISCV_INS_SLTI,
+	RISCV_INS_SLTIU,
+	RISCV_INS_XORI,
+	RISCV_INS_ORI,
+	RISCV_INS_ANDI,
+	RISCV_INS_LB,
+	RISCV_INS_LH,
+	RISCV_INS_LW,
+	RISCV_INS_LBU,
+	RISCV_INS_LHU,
+	RISCV_INS_SB,
+	RISCV_INS_SH,
+	RISCV_INS_SW,
+	RISCV_INS_FENCE,
+	RISCV_INS_FENCE_I,
+	RISCV_INS_ADD,
+	RISCV_INS_SUB,
+	RISCV_INS_SLL,
+	RISCV_INS_SLT,
+	RISCV_INS_SLTU,
+	RISCV_INS_XOR,
+	RISCV_INS_SRL,
+	RISCV_INS_SRA,
+	RISCV_INS_OR,
+	RISCV_INS_AND,
+	RISCV_INS_FLD,
+	RISCV_INS_FSD,
+	RISCV_INS_FMADD_D,
+	RISCV_INS_FMSUB_D,
+	RISCV_INS_FNMSUB_D,
+	RISCV_INS_FNMADD_D,
+	RISCV_INS_FADD_D,
+	RISCV_INS_FSUB_D,
+	RISCV_INS_FMUL_D,
+	RISCV_INS_FDIV_D,
+	RISCV_INS_FSGNJ_D,
+	RISCV_INS_FSGNJN_D,
+	RISCV_INS_FSGNJX_D,
+	RISCV_INS_FMIN_D,
+	RISCV_INS_FMAX_D,
+	RISCV_INS_FLE_D,
+	RISCV_INS_FLT_D,
+	RISCV_INS_FEQ_D,
+	RISCV_INS_FCVT_S_D,
+	RISCV_INS_FCVT_D_S,
+	RISCV_INS_FSQRT_D,
+	RISCV_INS_FCVT_W_D,
+	RISCV_INS_FCVT_WU_D,
+	RISCV_INS_FCVT_D_W,
+	RISCV_INS_FCVT_D_WU,
+	RISCV_INS_FCLASS_D,
+	RISCV_INS_FLW,
+	RISCV_INS_FSW,
+	RISCV_INS_FMADD_S,
+	RISCV_INS_FMSUB_S,
+	RISCV_INS_FNMSUB_S,
+	RISCV_INS_FNMADD_S,
+	RISCV_INS_FADD_S,
+	RISCV_INS_FSUB_S,
+	RISCV_INS_FMUL_S,
+	RISCV_INS_FDIV_S,
+	RISCV_INS_FSGNJ_S,
+	RISCV_INS_FSGNJN_S,
+	RISCV_INS_FSGNJX_S,
+	RISCV_INS_FMIN_S,
+	RISCV_INS_FMAX_S,
+	RISCV_INS_FLE_S,
+	RISCV_INS_FLT_S,
+	RISCV_INS_FEQ_S,
+	RISCV_INS_FSQRT_S,
+	RISCV_INS_FCVT_W_S,
+	RISCV_INS_FCVT_WU_S,
+	RISCV_INS_FCVT_S_W,
+	RISCV_INS_FCVT_S_WU,
+	RISCV_INS_FMV_X_W,
+	RISCV_INS_FCLASS_S,
+	RISCV_INS_FMV_W_X,
+	RISCV_INS_FLQ,
+	RISCV_INS_FSQ,
+	RISCV_INS_FMADD_Q,
+	RISCV_INS_FMSUB_Q,
+	RISCV_INS_FNMSUB_Q,
+	RISCV_INS_FNMADD_Q,
+	RISCV_INS_FADD_Q,
+	RISCV_INS_FSUB_Q,
+	RISCV_INS_FMUL_Q,
+	RISCV_INS_FDIV_Q,
+	RISCV_INS_FSGNJ_Q,
+	RISCV_INS_FSGNJN_Q,
+	RISCV_INS_FSGNJX_Q,
+	RISCV_INS_FMIN_Q,
+	RISCV_INS_FMAX_Q,
+	RISCV_INS_FLE_Q,
+	RISCV_INS_FLT_Q,
+	RISCV_INS_FEQ_Q,
+	RISCV_INS_FCVT_S_Q,
+	RISCV_INS_FCVT_Q_S,
+	RISCV_INS_FCVT_D_Q,
+	RISCV_INS_FCVT_Q_D,
+	RISCV_INS_FSQRT_Q,
+	RISCV_INS_FCVT_W_Q,
+	RISCV_INS_FCVT_WU_Q,
+	RISCV_INS_FCVT_Q_W,
+	RISCV_INS_FCVT_Q_WU,
+	RISCV_INS_FCLASS_Q,
+	RISCV_INS_FLH,
+	RISCV_INS_FSH,
+	RISCV_INS_FMADD_H,
+	RISCV_INS_FMSUB_H,
+	RISCV_INS_FNMSUB_H,
+	RISCV_INS_FNMADD_H,
+	RISCV_INS_FADD_H,
+	RISCV_INS_FSUB_H,
+	RISCV_INS_FMUL_H,
+	RISCV_INS_FDIV_H,
+	RISCV_INS_FSGNJ_H,
+	RISCV_INS_FSGNJN_H,
+	RISCV_INS_FSGNJX_H,
+	RISCV_INS_FMIN_H,
+	RISCV_INS_FMAX_H,
+	RISCV_INS_FLE_H,
+	RISCV_INS_FLT_H,
+	RISCV_INS_FEQ_H,
+	RISCV_INS_FCVT_H_S,
+	RISCV_INS_FCVT_S_H,
+	RISCV_INS_FSQRT_H,
+	RISCV_INS_FCVT_W_H,
+	RISCV_INS_FCVT_WU_H,
+	RISCV_INS_FCVT_H_W,
+	RISCV_INS_FCVT_H_WU,
+	RISCV_INS_FMV_X_H,
+	RISCV_INS_FCLASS_H,
+	RISCV_INS_FMV_H_X,
+	RISCV_INS_ADDIW,
+	RISCV_INS_LD,
+	RISCV_INS_LWU,
+	RISCV_INS_SD,
+	RISCV_INS_SLLI,
+	RISCV_INS_SRLI,
+	RISCV_INS_SRAI,
+	RISCV_INS_SLLIW,
+	RISCV_INS_SRLIW,
+	RISCV_INS_SRAIW,
+	RISCV_INS_ADDW,
+	RISCV_INS_SUBW,
+	RISCV_INS_SLLW,
+	RISCV_INS_SRLW,
+	RISCV_INS_SRAW,
+	RISCV_INS_CSRRW,
+	RISCV_INS_CSRRS,
+	RISCV_INS_CSRRC,
+	RISCV_INS_CSRRWI,
+	RISCV_INS_CSRRSI,
+	RISCV_INS_CSRRCI,
+	RISCV_INS_SFENCE_VMA,
+	RISCV_INS_ECALL,
+	RISCV_INS_EBREAK,
+	RISCV_INS_SRET,
+	RISCV_INS_MRET,
+	RISCV_INS_DRET,
+	RISCV_INS_WFI,
+	RISCV_INS_PREFETCH_I,
+	RISCV_INS_PREFETCH_R,
+	RISCV_INS_PREFETCH_W,
+	RISCV_INS_CBO_CLEAN,
+	RISCV_INS_CBO_FLUSH,
+	RISCV_INS_CBO_INVAL,
+	RISCV_INS_CBO_ZERO,
+	RISCV_INS_FSRI,
+	RISCV_INS_CMIX,
+	RISCV_INS_CMOV,
+	RISCV_INS_FSL,
+	RISCV_INS_FSR,
+	RISCV_INS_SLOI,
+	RISCV_INS_SROI,
+	RISCV_INS_RORI,
+	RISCV_INS_BCLRI,
+	RISCV_INS_BSETI,
+	RISCV_INS_BINVI,
+	RISCV_INS_BEXTI,
+	RISCV_INS_GORCI,
+	RISCV_INS_GREVI,
+	RISCV_INS_ANDN,
+	RISCV_INS_ORN,
+	RISCV_INS_XNOR,
+	RISCV_INS_SLO,
+	RISCV_INS_SRO,
+	RISCV_INS_ROL,
+	RISCV_INS_ROR,
+	RISCV_INS_BCLR,
+	RISCV_INS_BSET,
+	RISCV_INS_BINV,
+	RISCV_INS_BEXT,
+	RISCV_INS_GORC,
+	RISCV_INS_GREV,
+	RISCV_INS_SH1ADD,
+	RISCV_INS_SH2ADD,
+	RISCV_INS_SH3ADD,
+	RISCV_INS_CLMUL,
+	RISCV_INS_CLMULR,
+	RISCV_INS_CLMULH,
+	RISCV_INS_MIN,
+	RISCV_INS_MINU,
+	RISCV_INS_MAX,
+	RISCV_INS_MAXU,
+	RISCV_INS_SHFL,
+	RISCV_INS_UNSHFL,
+	RISCV_INS_BCOMPRESS,
+	RISCV_INS_BDECOMPRESS,
+	RISCV_INS_PACK,
+	RISCV_INS_PACKU,
+	RISCV_INS_PACKH,
+	RISCV_INS_BFP,
+	RISCV_INS_SHFLI,
+	RISCV_INS_UNSHFLI,
+	RISCV_INS_XPERM4,
+	RISCV_INS_XPERM8,
+	RISCV_INS_XPERM16,
+	RISCV_INS_CLZ,
+	RISCV_INS_CTZ,
+	RISCV_INS_CPOP,
+	RISCV_INS_SEXT_B,
+	RISCV_INS_SEXT_H,
+	RISCV_INS_CRC32_B,
+	RISCV_INS_CRC32_H,
+	RISCV_INS_CRC32_W,
+	RISCV_INS_CRC32C_B,
+	RISCV_INS_CRC32C_H,
+	RISCV_INS_CRC32C_W,
+	RISCV_INS_FSLW,
+	RISCV_INS_FSRW,
+	RISCV_INS_FSRIW,
+	RISCV_INS_SLLI_UW,
+	RISCV_INS_BMATOR,
+	RISCV_INS_BMATXOR,
+	RISCV_INS_ADD_UW,
+	RISCV_INS_SLOW,
+	RISCV_INS_SROW,
+	RISCV_INS_ROLW,
+	RISCV_INS_RORW,
+	RISCV_INS_GORCW,
+	RISCV_INS_GREVW,
+	RISCV_INS_SLOIW,
+	RISCV_INS_SROIW,
+	RISCV_INS_RORIW,
+	RISCV_INS_GORCIW,
+	RISCV_INS_GREVIW,
+	RISCV_INS_SH1ADD_UW,
+	RISCV_INS_SH2ADD_UW,
+	RISCV_INS_SH3ADD_UW,
+	RISCV_INS_SHFLW,
+	RISCV_INS_UNSHFLW,
+	RISCV_INS_BCOMPRESSW,
+	RISCV_INS_BDECOMPRESSW,
+	RISCV_INS_PACKW,
+	RISCV_INS_PACKUW,
+	RISCV_INS_BFPW,
+	RISCV_INS_XPERM32,
+	RISCV_INS_BMATFLIP,
+	RISCV_INS_CRC32_D,
+	RISCV_INS_CRC32C_D,
+	RISCV_INS_CLZW,
+	RISCV_INS_CTZW,
+	RISCV_INS_CPOPW,
+	RISCV_INS_BPICK,
+	RISCV_INS_BITREVI,
+	RISCV_INS_SRAI_U,
+	RISCV_INS_ADD8,
+	RISCV_INS_ADD16,
+	RISCV_INS_ADD64,
+	RISCV_INS_AVE,
+	RISCV_INS_BITREV,
+	RISCV_INS_CMPEQ8,
+	RISCV_INS_CMPEQ16,
+	RISCV_INS_CRAS16,
+	RISCV_INS_CRSA16,
+	RISCV_INS_KADD8,
+	RISCV_INS_KADD16,
+	RISCV_INS_KADD64,
+	RISCV_INS_KADDH,
+	RISCV_INS_KADDW,
+	RISCV_INS_KCRAS16,
+	RISCV_INS_KCRSA16,
+	RISCV_INS_KDMBB,
+	RISCV_INS_KDMBT,
+	RISCV_INS_KDMTT,
+	RISCV_INS_KDMABB,
+	RISCV_INS_KDMABT,
+	RISCV_INS_KDMATT,
+	RISCV_INS_KHM8,
+	RISCV_INS_KHMX8,
+	RISCV_INS_KHM16,
+	RISCV_INS_KHMX16,
+	RISCV_INS_KHMBB,
+	RISCV_INS_KHMBT,
+	RISCV_INS_KHMTT,
+	RISCV_INS_KMABB,
+	RISCV_INS_KMABT,
+	RISCV_INS_KMATT,
+	RISCV_INS_KMADA,
+	RISCV_INS_KMAXDA,
+	RISCV_INS_KMADS,
+	RISCV_INS_KMADRS,
+	RISCV_INS_KMAXDS,
+	RISCV_INS_KMAR64,
+	RISCV_INS_KMDA,
+	RISCV_INS_KMXDA,
+	RISCV_INS_KMMAC,
+	RISCV_INS_KMMAC_U,
+	RISCV_INS_KMMAWB,
+	RISCV_INS_KMMAWB_U,
+	RISCV_INS_KMMAWB2,
+	RISCV_INS_KMMAWB2_U,
+	RISCV_INS_KMMAWT,
+	RISCV_INS_KMMAWT_U,
+	RISCV_INS_KMMAWT2,
+	RISCV_INS_KMMAWT2_U,
+	RISCV_INS_KMMSB,
+	RISCV_INS_KMMSB_U,
+	RISCV_INS_KMMWB2,
+	RISCV_INS_KMMWB2_U,
+	RISCV_INS_KMMWT2,
+	RISCV_INS_KMMWT2_U,
+	RISCV_INS_KMSDA,
+	RISCV_INS_KMSXDA,
+	RISCV_INS_KMSR64,
+	RISCV_INS_KSLLW,
+	RISCV_INS_KSLLIW,
+	RISCV_INS_KSLL8,
+	RISCV_INS_KSLL16,
+	RISCV_INS_KSLRA8,
+	RISCV_INS_KSLRA8_U,
+	RISCV_INS_KSLRA16,
+	RISCV_INS_KSLRA16_U,
+	RISCV_INS_KSLRAW,
+	RISCV_INS_KSLRAW_U,
+	RISCV_INS_KSTAS16,
+	RISCV_INS_KSTSA16,
+	RISCV_INS_KSUB8,
+	RISCV_INS_KSUB16,
+	RISCV_INS_KSUB64,
+	RISCV_INS_KSUBH,
+	RISCV_INS_KSUBW,
+	RISCV_INS_KWMMUL,
+	RISCV_INS_KWMMUL_U,
+	RISCV_INS_MADDR32,
+	RISCV_INS_MAXW,
+	RISCV_INS_MINW,
+	RISCV_INS_MSUBR32,
+	RISCV_INS_MULR64,
+	RISCV_INS_MULSR64,
+	RISCV_INS_PBSAD,
+	RISCV_INS_PBSADA,
+	RISCV_INS_PKBB16,
+	RISCV_INS_PKBT16,
+	RISCV_INS_PKTT16,
+	RISCV_INS_PKTB16,
+	RISCV_INS_RADD8,
+	RISCV_INS_RADD16,
+	RISCV_INS_RADD64,
+	RISCV_INS_RADDW,
+	RISCV_INS_RCRAS16,
+	RISCV_INS_RCRSA16,
+	RISCV_INS_RSTAS16,
+	RISCV_INS_RSTSA16,
+	RISCV_INS_RSUB8,
+	RISCV_INS_RSUB16,
+	RISCV_INS_RSUB64,
+	RISCV_INS_RSUBW,
+	RISCV_INS_SCLIP32,
+	RISCV_INS_SCMPLE8,
+	RISCV_INS_SCMPLE16,
+	RISCV_INS_SCMPLT8,
+	RISCV_INS_SCMPLT16,
+	RISCV_INS_SLL8,
+	RISCV_INS_SLL16,
+	RISCV_INS_SMAL,
+	RISCV_INS_SMALBB,
+	RISCV_INS_SMALBT,
+	RISCV_INS_SMALTT,
+	RISCV_INS_SMALDA,
+	RISCV_INS_SMALXDA,
+	RISCV_INS_SMALDS,
+	RISCV_INS_SMALDRS,
+	RISCV_INS_SMALXDS,
+	RISCV_INS_SMAR64,
+	RISCV_INS_SMAQA,
+	RISCV_INS_SMAQA_SU,
+	RISCV_INS_SMAX8,
+	RISCV_INS_SMAX16,
+	RISCV_INS_SMBB16,
+	RISCV_INS_SMBT16,
+	RISCV_INS_SMTT16,
+	RISCV_INS_SMDS,
+	RISCV_INS_SMDRS,
+	RISCV_INS_SMXDS,
+	RISCV_INS_SMIN8,
+	RISCV_INS_SMIN16,
+	RISCV_INS_SMMUL,
+	RISCV_INS_SMMUL_U,
+	RISCV_INS_SMMWB,
+	RISCV_INS_SMMWB_U,
+	RISCV_INS_SMMWT,
+	RISCV_INS_SMMWT_U,
+	RISCV_INS_SMSLDA,
+	RISCV_INS_SMSLXDA,
+	RISCV_INS_SMSR64,
+	RISCV_INS_SMUL8,
+	RISCV_INS_SMULX8,
+	RISCV_INS_SMUL16,
+	RISCV_INS_SMULX16,
+	RISCV_INS_SRA_U,
+	RISCV_INS_SRA8,
+	RISCV_INS_SRA8_U,
+	RISCV_INS_SRA16,
+	RISCV_INS_SRA16_U,
+	RISCV_INS_SRL8,
+	RISCV_INS_SRL8_U,
+	RISCV_INS_SRL16,
+	RISCV_INS_SRL16_U,
+	RISCV_INS_STAS16,
+	RISCV_INS_STSA16,
+	RISCV_INS_SUB8,
+	RISCV_INS_SUB16,
+	RISCV_INS_SUB64,
+	RISCV_INS_UCLIP32,
+	RISCV_INS_UCMPLE8,
+	RISCV_INS_UCMPLE16,
+	RISCV_INS_UCMPLT8,
+	RISCV_INS_UCMPLT16,
+	RISCV_INS_UKADD8,
+	RISCV_INS_UKADD16,
+	RISCV_INS_UKADD64,
+	RISCV_INS_UKADDH,
+	RISCV_INS_UKADDW,
+	RISCV_INS_UKCRAS16,
+	RISCV_INS_UKCRSA16,
+	RISCV_INS_UKMAR64,
+	RISCV_INS_UKMSR64,
+	RISCV_INS_UKSTAS16,
+	RISCV_INS_UKSTSA16,
+	RISCV_INS_UKSUB8,
+	RISCV_INS_UKSUB16,
+	RISCV_INS_UKSUB64,
+	RISCV_INS_UKSUBH,
+	RISCV_INS_UKSUBW,
+	RISCV_INS_UMAR64,
+	RISCV_INS_UMAQA,
+	RISCV_INS_UMAX8,
+	RISCV_INS_UMAX16,
+	RISCV_INS_UMIN8,
+	RISCV_INS_UMIN16,
+	RISCV_INS_UMSR64,
+	RISCV_INS_UMUL8,
+	RISCV_INS_UMULX8,
+	RISCV_INS_UMUL16,
+	RISCV_INS_UMULX16,
+	RISCV_INS_URADD8,
+	RISCV_INS_URADD16,
+	RISCV_INS_URADD64,
+	RISCV_INS_URADDW,
+	RISCV_INS_URCRAS16,
+	RISCV_INS_URCRSA16,
+	RISCV_INS_URSTAS16,
+	RISCV_INS_URSTSA16,
+	RISCV_INS_URSUB8,
+	RISCV_INS_URSUB16,
+	RISCV_INS_URSUB64,
+	RISCV_INS_URSUBW,
+	RISCV_INS_WEXTI,
+	RISCV_INS_WEXT,
+	RISCV_INS_ADD32,
+	RISCV_INS_CRAS32,
+	RISCV_INS_CRSA32,
+	RISCV_INS_KADD32,
+	RISCV_INS_KCRAS32,
+	RISCV_INS_KCRSA32,
+	RISCV_INS_KDMBB16,
+	RISCV_INS_KDMBT16,
+	RISCV_INS_KDMTT16,
+	RISCV_INS_KDMABB16,
+	RISCV_INS_KDMABT16,
+	RISCV_INS_KDMATT16,
+	RISCV_INS_KHMBB16,
+	RISCV_INS_KHMBT16,
+	RISCV_INS_KHMTT16,
+	RISCV_INS_KMABB32,
+	RISCV_INS_KMABT32,
+	RISCV_INS_KMATT32,
+	RISCV_INS_KMAXDA32,
+	RISCV_INS_KMDA32,
+	RISCV_INS_KMXDA32,
+	RISCV_INS_KMADS32,
+	RISCV_INS_KMADRS32,
+	RISCV_INS_KMAXDS32,
+	RISCV_INS_KMSDA32,
+	RISCV_INS_KMSXDA32,
+	RISCV_INS_KSLL32,
+	RISCV_INS_KSLLI32,
+	RISCV_INS_KSLRA32,
+	RISCV_INS_KSLRA32_U,
+	RISCV_INS_KSTAS32,
+	RISCV_INS_KSTSA32,
+	RISCV_INS_KSUB32,
+	RISCV_INS_PKBB32,
+	RISCV_INS_PKBT32,
+	RISCV_INS_PKTT32,
+	RISCV_INS_PKTB32,
+	RISCV_INS_RADD32,
+	RISCV_INS_RCRAS32,
+	RISCV_INS_RCRSA32,
+	RISCV_INS_RSTAS32,
+	RISCV_INS_RSTSA32,
+	RISCV_INS_RSUB32,
+	RISCV_INS_SLL32,
+	RISCV_INS_SLLI32,
+	RISCV_INS_SMAX32,
+	RISCV_INS_SMBT32,
+	RISCV_INS_SMTT32,
+	RISCV_INS_SMDS32,
+	RISCV_INS_SMDRS32,
+	RISCV_INS_SMXDS32,
+	RISCV_INS_SMIN32,
+	RISCV_INS_SRA32,
+	RISCV_INS_SRA32_U,
+	RISCV_INS_SRAI32,
+	RISCV_INS_SRAI32_U,
+	RISCV_INS_SRAIW_U,
+	RISCV_INS_SRL32,
+	RISCV_INS_SRL32_U,
+	RISCV_INS_SRLI32,
+	RISCV_INS_SRLI32_U,
+	RISCV_INS_STAS32,
+	RISCV_INS_STSA32,
+	RISCV_INS_SUB32,
+	RISCV_INS_UKADD32,
+	RISCV_INS_UKCRAS32,
+	RISCV_INS_UKCRSA32,
+	RISCV_INS_UKSTAS32,
+	RISCV_INS_UKSTSA32,
+	RISCV_INS_UKSUB32,
+	RISCV_INS_UMAX32,
+	RISCV_INS_UMIN32,
+	RISCV_INS_URADD32,
+	RISCV_INS_URCRAS32,
+	RISCV_INS_URCRSA32,
+	RISCV_INS_URSTAS32,
+	RISCV_INS_URSTSA32,
+	RISCV_INS_URSUB32,
+	RISCV_INS_KSLLI16,
+	RISCV_INS_SCLIP16,
+	RISCV_INS_SLLI16,
+	RISCV_INS_SRAI16,
+	RISCV_INS_SRAI16_U,
+	RISCV_INS_SRLI16,
+	RISCV_INS_SRLI16_U,
+	RISCV_INS_UCLIP16,
+	RISCV_INS_INSB,
+	RISCV_INS_KSLLI8,
+	RISCV_INS_SCLIP8,
+	RISCV_INS_SLLI8,
+	RISCV_INS_SRAI8,
+	RISCV_INS_SRAI8_U,
+	RISCV_INS_SRLI8,
+	RISCV_INS_SRLI8_U,
+	RISCV_INS_UCLIP8,
+	RISCV_INS_CLRS8,
+	RISCV_INS_CLRS16,
+	RISCV_INS_CLRS32,
+	RISCV_INS_CLO8,
+	RISCV_INS_CLO16,
+	RISCV_INS_CLO32,
+	RISCV_INS_CLZ8,
+	RISCV_INS_CLZ16,
+	RISCV_INS_CLZ32,
+	RISCV_INS_KABS8,
+	RISCV_INS_KABS16,
+	RISCV_INS_KABSW,
+	RISCV_INS_SUNPKD810,
+	RISCV_INS_SUNPKD820,
+	RISCV_INS_SUNPKD830,
+	RISCV_INS_SUNPKD831,
+	RISCV_INS_SUNPKD832,
+	RISCV_INS_SWAP8,
+	RISCV_INS_ZUNPKD810,
+	RISCV_INS_ZUNPKD820,
+	RISCV_INS_ZUNPKD830,
+	RISCV_INS_ZUNPKD831,
+	RISCV_INS_ZUNPKD832,
+	RISCV_INS_KABS32,
+	RISCV_INS_VLUXEI8_V,
+	RISCV_INS_VLUXEI16_V,
+	RISCV_INS_VLUXEI32_V,
+	RISCV_INS_VLUXEI64_V,
+	RISCV_INS_VLUXEI128_V,
+	RISCV_INS_VLUXEI256_V,
+	RISCV_INS_VLUXEI512_V,
+	RISCV_INS_VLUXEI1024_V,
+	RISCV_INS_VSUXEI8_V,
+	RISCV_INS_VSUXEI16_V,
+	RISCV_INS_VSUXEI32_V,
+	RISCV_INS_VSUXEI64_V,
+	RISCV_INS_VSUXEI128_V,
+	RISCV_INS_VSUXEI256_V,
+	RISCV_INS_VSUXEI512_V,
+	RISCV_INS_VSUXEI1024_V,
+	RISCV_INS_VLSE8_V,
+	RISCV_INS_VLSE16_V,
+	RISCV_INS_VLSE32_V,
+	RISCV_INS_VLSE64_V,
+	RISCV_INS_VLSE128_V,
+	RISCV_INS_VLSE256_V,
+	RISCV_INS_VLSE512_V,
+	RISCV_INS_VLSE1024_V,
+	RISCV_INS_VSSE8_V,
+	RISCV_INS_VSSE16_V,
+	RISCV_INS_VSSE32_V,
+	RISCV_INS_VSSE64_V,
+	RISCV_INS_VSSE128_V,
+	RISCV_INS_VSSE256_V,
+	RISCV_INS_VSSE512_V,
+	RISCV_INS_VSSE1024_V,
+	RISCV_INS_VLOXEI8_V,
+	RISCV_INS_VLOXEI16_V,
+	RISCV_INS_VLOXEI32_V,
+	RISCV_INS_VLOXEI64_V,
+	RISCV_INS_VLOXEI128_V,
+	RISCV_INS_VLOXEI256_V,
+	RISCV_INS_VLOXEI512_V,
+	RISCV_INS_VLOXEI1024_V,
+	RISCV_INS_VSOXEI8_V,
+	RISCV_INS_VSOXEI16_V,
+	RISCV_INS_VSOXEI32_V,
+	RISCV_INS_VSOXEI64_V,
+	RISCV_INS_VSOXEI128_V,
+	RISCV_INS_VSOXEI256_V,
+	RISCV_INS_VSOXEI512_V,
+	RISCV_INS_VSOXEI1024_V,
+	RISCV_INS_VLE8_V,
+	RISCV_INS_VLE16_V,
+	RISCV_INS_VLE32_V,
+	RISCV_INS_VLE64_V,
+	RISCV_INS_VLE128_V,
+	RISCV_INS_VLE256_V,
+	RISCV_INS_VLE512_V,
+	RISCV_INS_VLE1024_V,
+	RISCV_INS_VSE8_V,
+	RISCV_INS_VSE16_V,
+	RISCV_INS_VSE32_V,
+	RISCV_INS_VSE64_V,
+	RISCV_INS_VSE128_V,
+	RISCV_INS_VSE256_V,
+	RISCV_INS_VSE512_V,
+	RISCV_INS_VSE1024_V,
+	RISCV_INS_VLE8FF_V,
+	RISCV_INS_VLE16FF_V,
+	RISCV_INS_VLE32FF_V,
+	RISCV_INS_VLE64FF_V,
+	RISCV_INS_VLE128FF_V,
+	RISCV_INS_VLE256FF_V,
+	RISCV_INS_VLE512FF_V,
+	RISCV_INS_VLE1024FF_V,
+	RISCV_INS_VSETVLI,
+	RISCV_INS_VSETIVLI,
+	RISCV_INS_VAMOSWAPEI8_V,
+	RISCV_INS_VAMOADDEI8_V,
+	RISCV_INS_VAMOXOREI8_V,
+	RISCV_INS_VAMOANDEI8_V,
+	RISCV_INS_VAMOOREI8_V,
+	RISCV_INS_VAMOMINEI8_V,
+	RISCV_INS_VAMOMAXEI8_V,
+	RISCV_INS_VAMOMINUEI8_V,
+	RISCV_INS_VAMOMAXUEI8_V,
+	RISCV_INS_VAMOSWAPEI16_V,
+	RISCV_INS_VAMOADDEI16_V,
+	RISCV_INS_VAMOXOREI16_V,
+	RISCV_INS_VAMOANDEI16_V,
+	RISCV_INS_VAMOOREI16_V,
+	RISCV_INS_VAMOMINEI16_V,
+	RISCV_INS_VAMOMAXEI16_V,
+	RISCV_INS_VAMOMINUEI16_V,
+	RISCV_INS_VAMOMAXUEI16_V,
+	RISCV_INS_VAMOSWAPEI32_V,
+	RISCV_INS_VAMOADDEI32_V,
+	RISCV_INS_VAMOXOREI32_V,
+	RISCV_INS_VAMOANDEI32_V,
+	RISCV_INS_VAMOOREI32_V,
+	RISCV_INS_VAMOMINEI32_V,
+	RISCV_INS_VAMOMAXEI32_V,
+	RISCV_INS_VAMOMINUEI32_V,
+	RISCV_INS_VAMOMAXUEI32_V,
+	RISCV_INS_VAMOSWAPEI64_V,
+	RISCV_INS_VAMOADDEI64_V,
+	RISCV_INS_VAMOXOREI64_V,
+	RISCV_INS_VAMOANDEI64_V,
+	RISCV_INS_VAMOOREI64_V,
+	RISCV_INS_VAMOMINEI64_V,
+	RISCV_INS_VAMOMAXEI64_V,
+	RISCV_INS_VAMOMINUEI64_V,
+	RISCV_INS_VAMOMAXUEI64_V,
+	RISCV_INS_VFADD_VF,
+	RISCV_INS_VFSUB_VF,
+	RISCV_INS_VFMIN_VF,
+	RISCV_INS_VFMAX_VF,
+	RISCV_INS_VFSGNJ_VF,
+	RISCV_INS_VFSGNJN_VF,
+	RISCV_INS_VFSGNJX_VF,
+	RISCV_INS_VFSLIDE1UP_VF,
+	RISCV_INS_VFSLIDE1DOWN_VF,
+	RISCV_INS_VMFEQ_VF,
+	RISCV_INS_VMFLE_VF,
+	RISCV_INS_VMFLT_VF,
+	RISCV_INS_VMFNE_VF,
+	RISCV_INS_VMFGT_VF,
+	RISCV_INS_VMFGE_VF,
+	RISCV_INS_VFDIV_VF,
+	RISCV_INS_VFRDIV_VF,
+	RISCV_INS_VFMUL_VF,
+	RISCV_INS_VFRSUB_VF,
+	RISCV_INS_VFMADD_VF,
+	RISCV_INS_VFNMADD_VF,
+	RISCV_INS_VFMSUB_VF,
+	RISCV_INS_VFNMSUB_VF,
+	RISCV_INS_VFMACC_VF,
+	RISCV_INS_VFNMACC_VF,
+	RISCV_INS_VFMSAC_VF,
+	RISCV_INS_VFNMSAC_VF,
+	RISCV_INS_VFWADD_VF,
+	RISCV_INS_VFWSUB_VF,
+	RISCV_INS_VFWADD_WF,
+	RISCV_INS_VFWSUB_WF,
+	RISCV_INS_VFWMUL_VF,
+	RISCV_INS_VFWMACC_VF,
+	RISCV_INS_VFWNMACC_VF,
+	RISCV_INS_VFWMSAC_VF,
+	RISCV_INS_VFWNMSAC_VF,
+	RISCV_INS_VFADD_VV,
+	RISCV_INS_VFREDUSUM_VS,
+	RISCV_INS_VFSUB_VV,
+	RISCV_INS_VFREDOSUM_VS,
+	RISCV_INS_VFMIN_VV,
+	RISCV_INS_VFREDMIN_VS,
+	RISCV_INS_VFMAX_VV,
+	RISCV_INS_VFREDMAX_VS,
+	RISCV_INS_VFSGNJ_VV,
+	RISCV_INS_VFSGNJN_VV,
+	RISCV_INS_VFSGNJX_VV,
+	RISCV_INS_VMFEQ_VV,
+	RISCV_INS_VMFLE_VV,
+	RISCV_INS_VMFLT_VV,
+	RISCV_INS_VMFNE_VV,
+	RISCV_INS_VFDIV_VV,
+	RISCV_INS_VFMUL_VV,
+	RISCV_INS_VFMADD_VV,
+	RISCV_INS_VFNMADD_VV,
+	RISCV_INS_VFMSUB_VV,
+	RISCV_INS_VFNMSUB_VV,
+	RISCV_INS_VFMACC_VV,
+	RISCV_INS_VFNMACC_VV,
+	RISCV_INS_VFMSAC_VV,
+	RISCV_INS_VFNMSAC_VV,
+	RISCV_INS_VFWADD_VV,
+	RISCV_INS_VFWREDUSUM_VS,
+	RISCV_INS_VFWSUB_VV,
+	RISCV_INS_VFWREDOSUM_VS,
+	RISCV_INS_VFWADD_WV,
+	RISCV_INS_VFWSUB_WV,
+	RISCV_INS_VFWMUL_VV,
+	RISCV_INS_VFWMACC_VV,
+	RISCV_INS_VFWNMACC_VV,
+	RISCV_INS_VFWMSAC_VV,
+	RISCV_INS_VFWNMSAC_VV,
+	RISCV_INS_VADD_VX,
+	RISCV_INS_VSUB_VX,
+	RISCV_INS_VRSUB_VX,
+	RISCV_INS_VMINU_VX,
+	RISCV_INS_VMIN_VX,
+	RISCV_INS_VMAXU_VX,
+	RISCV_INS_VMAX_VX,
+	RISCV_INS_VAND_VX,
+	RISCV_INS_VOR_VX,
+	RISCV_INS_VXOR_VX,
+	RISCV_INS_VRGATHER_VX,
+	RISCV_INS_VSLIDEUP_VX,
+	RISCV_INS_VSLIDEDOWN_VX,
+	RISCV_INS_VMSEQ_VX,
+	RISCV_INS_VMSNE_VX,
+	RISCV_INS_VMSLTU_VX,
+	RISCV_INS_VMSLT_VX,
+	RISCV_INS_VMSLEU_VX,
+	RISCV_INS_VMSLE_VX,
+	RISCV_INS_VMSGTU_VX,
+	RISCV_INS_VMSGT_VX,
+	RISCV_INS_VSADDU_VX,
+	RISCV_INS_VSADD_VX,
+	RISCV_INS_VSSUBU_VX,
+	RISCV_INS_VSSUB_VX,
+	RISCV_INS_VSLL_VX,
+	RISCV_INS_VSMUL_VX,
+	RISCV_INS_VSRL_VX,
+	RISCV_INS_VSRA_VX,
+	RISCV_INS_VSSRL_VX,
+	RISCV_INS_VSSRA_VX,
+	RISCV_INS_VNSRL_WX,
+	RISCV_INS_VNSRA_WX,
+	RISCV_INS_VNCLIPU_WX,
+	RISCV_INS_VNCLIP_WX,
+	RISCV_INS_VADD_VV,
+	RISCV_INS_VSUB_VV,
+	RISCV_INS_VMINU_VV,
+	RISCV_INS_VMIN_VV,
+	RISCV_INS_VMAXU_VV,
+	RISCV_INS_VMAX_VV,
+	RISCV_INS_VAND_VV,
+	RISCV_INS_VOR_VV,
+	RISCV_INS_VXOR_VV,
+	RISCV_INS_VRGATHER_VV,
+	RISCV_INS_VRGATHEREI16_VV,
+	RISCV_INS_VMSEQ_VV,
+	RISCV_INS_VMSNE_VV,
+	RISCV_INS_VMSLTU_VV,
+	RISCV_INS_VMSLT_VV,
+	RISCV_INS_VMSLEU_VV,
+	RISCV_INS_VMSLE_VV,
+	RISCV_INS_VSADDU_VV,
+	RISCV_INS_VSADD_VV,
+	RISCV_INS_VSSUBU_VV,
+	RISCV_INS_VSSUB_VV,
+	RISCV_INS_VSLL_VV,
+	RISCV_INS_VSMUL_VV,
+	RISCV_INS_VSRL_VV,
+	RISCV_INS_VSRA_VV,
+	RISCV_INS_VSSRL_VV,
+	RISCV_INS_VSSRA_VV,
+	RISCV_INS_VNSRL_WV,
+	RISCV_INS_VNSRA_WV,
+	RISCV_INS_VNCLIPU_WV,
+	RISCV_INS_VNCLIP_WV,
+	RISCV_INS_VWREDSUMU_VS,
+	RISCV_INS_VWREDSUM_VS,
+	RISCV_INS_VADD_VI,
+	RISCV_INS_VRSUB_VI,
+	RISCV_INS_VAND_VI,
+	RISCV_INS_VOR_VI,
+	RISCV_INS_VXOR_VI,
+	RISCV_INS_VRGATHER_VI,
+	RISCV_INS_VSLIDEUP_VI,
+	RISCV_INS_VSLIDEDOWN_VI,
+	RISCV_INS_VMSEQ_VI,
+	RISCV_INS_VMSNE_VI,
+	RISCV_INS_VMSLEU_VI,
+	RISCV_INS_VMSLE_VI,
+	RISCV_INS_VMSGTU_VI,
+	RISCV_INS_VMSGT_VI,
+	RISCV_INS_VSADDU_VI,
+	RISCV_INS_VSADD_VI,
+	RISCV_INS_VSLL_VI,
+	RISCV_INS_VSRL_VI,
+	RISCV_INS_VSRA_VI,
+	RISCV_INS_VSSRL_VI,
+	RISCV_INS_VSSRA_VI,
+	RISCV_INS_VNSRL_WI,
+	RISCV_INS_VNSRA_WI,
+	RISCV_INS_VNCLIPU_WI,
+	RISCV_INS_VNCLIP_WI,
+	RISCV_INS_VREDSUM_VS,
+	RISCV_INS_VREDAND_VS,
+	RISCV_INS_VREDOR_VS,
+	RISCV_INS_VREDXOR_VS,
+	RISCV_INS_VREDMINU_VS,
+	RISCV_INS_VREDMIN_VS,
+	RISCV_INS_VREDMAXU_VS,
+	RISCV_INS_VREDMAX_VS,
+	RISCV_INS_VAADDU_VV,
+	RISCV_INS_VAADD_VV,
+	RISCV_INS_VASUBU_VV,
+	RISCV_INS_VASUB_VV,
+	RISCV_INS_VMANDN_MM,
+	RISCV_INS_VMAND_MM,
+	RISCV_INS_VMOR_MM,
+	RISCV_INS_VMXOR_MM,
+	RISCV_INS_VMORN_MM,
+	RISCV_INS_VMNAND_MM,
+	RISCV_INS_VMNOR_MM,
+	RISCV_INS_VMXNOR_MM,
+	RISCV_INS_VDIVU_VV,
+	RISCV_INS_VDIV_VV,
+	RISCV_INS_VREMU_VV,
+	RISCV_INS_VREM_VV,
+	RISCV_INS_VMULHU_VV,
+	RISCV_INS_VMUL_VV,
+	RISCV_INS_VMULHSU_VV,
+	RISCV_INS_VMULH_VV,
+	RISCV_INS_VMADD_VV,
+	RISCV_INS_VNMSUB_VV,
+	RISCV_INS_VMACC_VV,
+	RISCV_INS_VNMSAC_VV,
+	RISCV_INS_VWADDU_VV,
+	RISCV_INS_VWADD_VV,
+	RISCV_INS_VWSUBU_VV,
+	RISCV_INS_VWSUB_VV,
+	RISCV_INS_VWADDU_WV,
+	RISCV_INS_VWADD_WV,
+	RISCV_INS_VWSUBU_WV,
+	RISCV_INS_VWSUB_WV,
+	RISCV_INS_VWMULU_VV,
+	RISCV_INS_VWMULSU_VV,
+	RISCV_INS_VWMUL_VV,
+	RISCV_INS_VWMACCU_VV,
+	RISCV_INS_VWMACC_VV,
+	RISCV_INS_VWMACCSU_VV,
+	RISCV_INS_VAADDU_VX,
+	RISCV_INS_VAADD_VX,
+	RISCV_INS_VASUBU_VX,
+	RISCV_INS_VASUB_VX,
+	RISCV_INS_VSLIDE1UP_VX,
+	RISCV_INS_VSLIDE1DOWN_VX,
+	RISCV_INS_VDIVU_VX,
+	RISCV_INS_VDIV_VX,
+	RISCV_INS_VREMU_VX,
+	RISCV_INS_VREM_VX,
+	RISCV_INS_VMULHU_VX,
+	RISCV_INS_VMUL_VX,
+	RISCV_INS_VMULHSU_VX,
+	RISCV_INS_VMULH_VX,
+	RISCV_INS_VMADD_VX,
+	RISCV_INS_VNMSUB_VX,
+	RISCV_INS_VMACC_VX,
+	RISCV_INS_VNMSAC_VX,
+	RISCV_INS_VWADDU_VX,
+	RISCV_INS_VWADD_VX,
+	RISCV_INS_VWSUBU_VX,
+	RISCV_INS_VWSUB_VX,
+	RISCV_INS_VWADDU_WX,
+	RISCV_INS_VWADD_WX,
+	RISCV_INS_VWSUBU_WX,
+	RISCV_INS_VWSUB_WX,
+	RISCV_INS_VWMULU_VX,
+	RISCV_INS_VWMULSU_VX,
+	RISCV_INS_VWMUL_VX,
+	RISCV_INS_VWMACCU_VX,
+	RISCV_INS_VWMACC_VX,
+	RISCV_INS_VWMACCUS_VX,
+	RISCV_INS_VWMACCSU_VX,
+	RISCV_INS_VFREDSUM_VS,
+	RISCV_INS_VFWREDSUM_VS,
+	RISCV_INS_VMORNOT_MM,
+	RISCV_INS_VMANDNOT_MM,
+	RISCV_INS_VFCVT_XU_F_V,
+	RISCV_INS_VFCVT_X_F_V,
+	RISCV_INS_VFCVT_F_XU_V,
+	RISCV_INS_VFCVT_F_X_V,
+	RISCV_INS_VFCVT_RTZ_XU_F_V,
+	RISCV_INS_VFCVT_RTZ_X_F_V,
+	RISCV_INS_VFWCVT_XU_F_V,
+	RISCV_INS_VFWCVT_X_F_V,
+	RISCV_INS_VFWCVT_F_XU_V,
+	RISCV_INS_VFWCVT_F_X_V,
+	RISCV_INS_VFWCVT_F_F_V,
+	RISCV_INS_VFWCVT_RTZ_XU_F_V,
+	RISCV_INS_VFWCVT_RTZ_X_F_V,
+	RISCV_INS_VFNCVT_XU_F_W,
+	RISCV_INS_VFNCVT_X_F_W,
+	RISCV_INS_VFNCVT_F_XU_W,
+	RISCV_INS_VFNCVT_F_X_W,
+	RISCV_INS_VFNCVT_F_F_W,
+	RISCV_INS_VFNCVT_ROD_F_F_W,
+	RISCV_INS_VFNCVT_RTZ_XU_F_W,
+	RISCV_INS_VFNCVT_RTZ_X_F_W,
+	RISCV_INS_VFSQRT_V,
+	RISCV_INS_VFRSQRT7_V,
+	RISCV_INS_VFREC7_V,
+	RISCV_INS_VFCLASS_V,
+	RISCV_INS_VZEXT_VF8,
+	RISCV_INS_VSEXT_VF8,
+	RISCV_INS_VZEXT_VF4,
+	RISCV_INS_VSEXT_VF4,
+	RISCV_INS_VZEXT_VF2,
+	RISCV_INS_VSEXT_VF2,
+	RISCV_INS_VMSBF_M,
+	RISCV_INS_VMSOF_M,
+	RISCV_INS_VMSIF_M,
+	RISCV_INS_VIOTA_M,
+	RISCV_INS_VCPOP_M,
+	RISCV_INS_VFIRST_M,
+	RISCV_INS_VPOPC_M,
+	RISCV_INS_VID_V,
+	RISCV_INS_VSETVL,
+	RISCV_INS_VFMERGE_VFM,
+	RISCV_INS_VADC_VXM,
+	RISCV_INS_VMADC_VXM,
+	RISCV_INS_VMADC_VX,
+	RISCV_INS_VSBC_VXM,
+	RISCV_INS_VMSBC_VXM,
+	RISCV_INS_VMSBC_VX,
+	RISCV_INS_VMERGE_VXM,
+	RISCV_INS_VADC_VVM,
+	RISCV_INS_VMADC_VVM,
+	RISCV_INS_VMADC_VV,
+	RISCV_INS_VSBC_VVM,
+	RISCV_INS_VMSBC_VVM,
+	RISCV_INS_VMSBC_VV,
+	RISCV_INS_VMERGE_VVM,
+	RISCV_INS_VADC_VIM,
+	RISCV_INS_VMADC_VIM,
+	RISCV_INS_VMADC_VI,
+	RISCV_INS_VMERGE_VIM,
+	RISCV_INS_VCOMPRESS_VM,
+	RISCV_INS_VMVNFR_V,
+	RISCV_INS_VFMV_F_S,
+	RISCV_INS_VMV1R_V,
+	RISCV_INS_VMV2R_V,
+	RISCV_INS_VMV4R_V,
+	RISCV_INS_VMV8R_V,
+	RISCV_INS_VMV_X_S,
+	RISCV_INS_VLM_V,
+	RISCV_INS_VSM_V,
+	RISCV_INS_VL1RE8_V,
+	RISCV_INS_VL1RE16_V,
+	RISCV_INS_VL1RE32_V,
+	RISCV_INS_VL1RE64_V,
+	RISCV_INS_VL2RE8_V,
+	RISCV_INS_VL2RE16_V,
+	RISCV_INS_VL2RE32_V,
+	RISCV_INS_VL2RE64_V,
+	RISCV_INS_VL4RE8_V,
+	RISCV_INS_VL4RE16_V,
+	RISCV_INS_VL4RE32_V,
+	RISCV_INS_VL4RE64_V,
+	RISCV_INS_VL8RE8_V,
+	RISCV_INS_VL8RE16_V,
+	RISCV_INS_VL8RE32_V,
+	RISCV_INS_VL8RE64_V,
+	RISCV_INS_VS1R_V,
+	RISCV_INS_VS2R_V,
+	RISCV_INS_VS4R_V,
+	RISCV_INS_VS8R_V,
+	RISCV_INS_VFMV_S_F,
+	RISCV_INS_VFMV_V_F,
+	RISCV_INS_VMV_V_X,
+	RISCV_INS_VMV_V_V,
+	RISCV_INS_VMV_V_I,
+	RISCV_INS_VMV_S_X,
+	RISCV_INS_VL1R_V,
+	RISCV_INS_VL2R_V,
+	RISCV_INS_VL4R_V,
+	RISCV_INS_VL8R_V,
+	RISCV_INS_VLE1_V,
+	RISCV_INS_VSE1_V,
+	RISCV_INS_AES32ESMI,
+	RISCV_INS_AES32ESI,
+	RISCV_INS_AES32DSMI,
+	RISCV_INS_AES32DSI,
+	RISCV_INS_SHA512SUM0R,
+	RISCV_INS_SHA512SUM1R,
+	RISCV_INS_SHA512SIG0L,
+	RISCV_INS_SHA512SIG0H,
+	RISCV_INS_SHA512SIG1L,
+	RISCV_INS_SHA512SIG1H,
+	RISCV_INS_SM4ED,
+	RISCV_INS_SM4KS,
+	RISCV_INS_SM3P0,
+	RISCV_INS_SM3P1,
+	RISCV_INS_SHA256SUM0,
+	RISCV_INS_SHA256SUM1,
+	RISCV_INS_SHA256SIG0,
+	RISCV_INS_SHA256SIG1,
+	RISCV_INS_AMOADD_W,
+	RISCV_INS_AMOXOR_W,
+	RISCV_INS_AMOOR_W,
+	RISCV_INS_AMOAND_W,
+	RISCV_INS_AMOMIN_W,
+	RISCV_INS_AMOMAX_W,
+	RISCV_INS_AMOMINU_W,
+	RISCV_INS_AMOMAXU_W,
+	RISCV_INS_AMOSWAP_W,
+	RISCV_INS_SC_W,
+	RISCV_INS_LR_W,
+	RISCV_INS_AMOADD_D,
+	RISCV_INS_AMOXOR_D,
+	RISCV_INS_AMOOR_D,
+	RISCV_INS_AMOAND_D,
+	RISCV_INS_AMOMIN_D,
+	RISCV_INS_AMOMAX_D,
+	RISCV_INS_AMOMINU_D,
+	RISCV_INS_AMOMAXU_D,
+	RISCV_INS_AMOSWAP_D,
+	RISCV_INS_SC_D,
+	RISCV_INS_LR_D,
+	RISCV_INS_MUL,
+	RISCV_INS_MULH,
+	RISCV_INS_MULHSU,
+	RISCV_INS_MULHU,
+	RISCV_INS_DIV,
+	RISCV_INS_DIVU,
+	RISCV_INS_REM,
+	RISCV_INS_REMU,
+	RISCV_INS_AES64KS2,
+	RISCV_INS_AES64ESM,
+	RISCV_INS_AES64ES,
+	RISCV_INS_AES64DSM,
+	RISCV_INS_AES64DS,
+	RISCV_INS_AES64KS1I,
+	RISCV_INS_AES64IM,
+	RISCV_INS_SHA512SUM0,
+	RISCV_INS_SHA512SUM1,
+	RISCV_INS_SHA512SIG0,
+	RISCV_INS_SHA512SIG1,
+	RISCV_INS_MULW,
+	RISCV_INS_DIVW,
+	RISCV_INS_DIVUW,
+	RISCV_INS_REMW,
+	RISCV_INS_REMUW,
+	RISCV_INS_HFENCE_VVMA,
+	RISCV_INS_HFENCE_GVMA,
+	RISCV_INS_HSV_B,
+	RISCV_INS_HSV_H,
+	RISCV_INS_HSV_W,
+	RISCV_INS_HLV_B,
+	RISCV_INS_HLV_BU,
+	RISCV_INS_HLV_H,
+	RISCV_INS_HLV_HU,
+	RISCV_INS_HLVX_HU,
+	RISCV_INS_HLV_W,
+	RISCV_INS_HLVX_WU,
+	RISCV_INS_HSV_D,
+	RISCV_INS_HLV_WU,
+	RISCV_INS_HLV_D,
+	RISCV_INS_SINVAL_VMA,
+	RISCV_INS_HINVAL_VVMA,
+	RISCV_INS_HINVAL_GVMA,
+	RISCV_INS_SFENCE_W_INVAL,
+	RISCV_INS_SFENCE_INVAL_IR,
+	RISCV_INS_FCVT_H_D,
+	RISCV_INS_FCVT_D_H,
+	RISCV_INS_FCVT_H_Q,
+	RISCV_INS_FCVT_Q_H,
+	RISCV_INS_FCVT_L_D,
+	RISCV_INS_FCVT_LU_D,
+	RISCV_INS_FCVT_D_L,
+	RISCV_INS_FCVT_D_LU,
+	RISCV_INS_FMV_X_D,
+	RISCV_INS_FMV_D_X,
+	RISCV_INS_FCVT_L_S,
+	RISCV_INS_FCVT_LU_S,
+	RISCV_INS_FCVT_S_L,
+	RISCV_INS_FCVT_S_LU,
+	RISCV_INS_FCVT_L_Q,
+	RISCV_INS_FCVT_LU_Q,
+	RISCV_INS_FCVT_Q_L,
+	RISCV_INS_FCVT_Q_LU,
+	RISCV_INS_FCVT_L_H,
+	RISCV_INS_FCVT_LU_H,
+	RISCV_INS_FCVT_H_L,
+	RISCV_INS_FCVT_H_LU,
+	RISCV_INS_COUNT,
+} RISCVInsId;
+
+typedef struct riscv_decoded_t {
+	ut32 data; /* raw instruction */
+	ut16 id; /*   RISCVInsId */
+	ut8 size; /*  instruction size in bytes */
+	ut8 rd; /*    register fields, always extracted */
+	ut8 rs1;
+	ut8 rs2;
+	ut8 rs3;
+	st64 imm; /*  immediate built as described by RISCVImmediate */
+} RISCVDecoded;
+
+/* registers read (use) and written (def) by an instruction, bit N is register N */
+typedef struct riscv_registers_t {
+	ut32 gpr_use;
+	ut32 gpr_def;
+	ut32 fpr_use;
+	ut32 fpr_def;
+	ut32 vec_use;
+	ut32 vec_def;
+} RISCVRegisters;
+
+/* stack pointer update and memory access of an instruction */
+typedef struct riscv_stack_effect_t {
+	st32 delta; /*   added to sp by addi sp, sp, imm */
+	bool clobber; /* sp is written with a value that is not sp + imm */
+	ut8 base; /*     base register of the memory access */
+	st32 offset; /*  offset of the access from base */
+	ut8 size; /*     bytes accessed, 0 when there is no memory access */
+	bool write; /*   the access is a store */
+} RISCVStackEffect;
+
+/* vector configuration set by the last vsetvli or vsetivli */
+typedef struct riscv_vector_state_t {
+	ut16 sew; /* element width in bits, 0 when the configuration is not known */
+	st8 lmul; /* log2 of the register group multiplier, -3 (mf8) to 3 (m8) */
+	bool ta; /*  tail agnostic */
+	bool ma; /*  mask agnostic */
+} RISCVVectorState;
+
+/* vector instruction annotated with the configuration it executes with */
+typedef struct riscv_vector_op_t {
+	RISCVVectorState vtype;
+	bool masked; /*  executed under the v0.t mask */
+	ut16 eew; /*     element width encoded in the instruction, 0 when none */
+	ut8 nf; /*       fields of segment loads and stores, 1 otherwise */
+	ut32 vec_use; /* vector registers read, whole groups included */
+	ut32 vec_def; /* vector registers written, whole groups included */
+} RISCVVectorOp;
+
+RISCV_API cchar *riscv_mnemonic(RISCVInsId id);
+RISCV_API bool riscv_op_class(RISCVInsId id, ut32 *type, st8 *family);
+RISCV_API cchar *riscv_csr_name(ut16 csr);
+RISCV_API st64 riscv_immediate(RISCVImmediate kind, ut32 data);
+RISCV_API bool riscv_alias(const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb);
+RISCV_API void riscv_registers_roles(ut32 roles, const RISCVDecoded *dec, RISCVRegisters *regs);
+RISCV_API void riscv_registers(const RISCVDecoded *dec, RISCVRegisters *regs);
+RISCV_API bool riscv_stack_effect(const RISCVDecoded *dec, RISCVStackEffect *effect);
+RISCV_API void riscv_vector_reset(RISCVVectorState *state);
+RISCV_API bool riscv_vector_op(RISCVVectorState *state, const RISCVDecoded *dec, RISCVVectorOp *op);
+RISCV_API bool riscv_decode_word(ut32 data, RISCVDecoded *dec);
+RISCV_API bool riscv_decode(const ut8 *buffer, const ut32 size, bool be, RISCVDecoded *dec);
+RISCV_API ut32 riscv_disassembler(const ut8 *buffer, const ut32 size, ut64 pc, bool be, RzStrBuf *sb);
+
+#ifndef RISCV_STANDALONE
+/* rizin only, the standalone library has no RzAnalysisOp nor RzIL */
+RISCV_API RzILOpEffect *riscv_il(const RISCVDecoded *dec, ut64 pc);
+RISCV_API ut32 riscv_analyze(const ut8 *buffer, const ut32 size, ut64 pc, bool be, RzAnalysisOp *op);
+#endif
+
+#endif /* RISCV_DECODE_H */
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_DECODE_PRIVATE_H
+#define RISCV_DECODE_PRIVATE_H
+
+#include "riscv_decode.h"
+
+#if defined(__GNUC__) && !defined(_WIN32)
+#define RISCV_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define RISCV_HIDDEN
+#endif
+
+typedef struct riscv_analysis_t {
+	ut32 type; /*    RZ_ANALYSIS_OP_TYPE_* */
+	st8 family; /*   RZ_ANALYSIS_OP_FAMILY_* */
+	ut8 cond; /*     RZ_TYPE_COND_* for conditional branches */
+	ut8 memsize; /*  bytes accessed by loads and stores */
+} RISCVAnalysis;
+
+typedef struct riscv_description_t {
+	ut16 name; /*    offset of the instruction name in the names of the standard */
+	ut8 decode; /*   index of the text decoder in decoders */
+} RISCVDescription;
+
+RISCV_HIDDEN extern const char registers_std[32][RISCV_REG_NAME_SIZE];
+RISCV_HIDDEN extern const char registers_vec[32][RISCV_REG_NAME_SIZE];
+RISCV_HIDDEN extern const char registers_flt[32][RISCV_REG_NAME_SIZE];
+
+/* names, descriptions and analysis of each standard, defined by riscv_decode_<standard>.c */
+RISCV_HIDDEN extern const char riscv_rv32i_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv32i_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv32i_analysis[];
+RISCV_HIDDEN extern const char riscv_rv32d_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv32d_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv32d_analysis[];
+RISCV_HIDDEN extern const char riscv_rv32f_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv32f_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv32f_analysis[];
+RISCV_HIDDEN extern const char riscv_rv32q_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv32q_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv32q_analysis[];
+RISCV_HIDDEN extern const char riscv_rv32zfh_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv32zfh_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv32zfh_analysis[];
+RISCV_HIDDEN extern const char riscv_rv64i_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv64i_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv64i_analysis[];
+RISCV_HIDDEN extern const char riscv_system_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_system_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_system_analysis[];
+RISCV_HIDDEN extern const char riscv_zicbo_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_zicbo_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_zicbo_analysis[];
+RISCV_HIDDEN extern const char riscv_rv32b_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv32b_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv32b_analysis[];
+RISCV_HIDDEN extern const char riscv_rv64b_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv64b_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv64b_analysis[];
+RISCV_HIDDEN extern const char riscv_rvp_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rvp_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rvp_analysis[];
+RISCV_HIDDEN extern const char riscv_rvv_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rvv_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rvv_analysis[];
+RISCV_HIDDEN extern const char riscv_rv32k_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv32k_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv32k_analysis[];
+RISCV_HIDDEN extern const char riscv_rvk_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rvk_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rvk_analysis[];
+RISCV_HIDDEN extern const char riscv_rv32a_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv32a_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv32a_analysis[];
+RISCV_HIDDEN extern const char riscv_rv64a_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv64a_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv64a_analysis[];
+RISCV_HIDDEN extern const char riscv_rv32m_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv32m_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv32m_analysis[];
+RISCV_HIDDEN extern const char riscv_rv64k_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv64k_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv64k_analysis[];
+RISCV_HIDDEN extern const char riscv_rv64m_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv64m_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv64m_analysis[];
+RISCV_HIDDEN extern const char riscv_rv32h_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv32h_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv32h_analysis[];
+RISCV_HIDDEN extern const char riscv_rv64h_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv64h_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv64h_analysis[];
+RISCV_HIDDEN extern const char riscv_svinval_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_svinval_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_svinval_analysis[];
+RISCV_HIDDEN extern const char riscv_rv32d_zfh_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv32d_zfh_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv32d_zfh_analysis[];
+RISCV_HIDDEN extern const char riscv_rv32q_zfh_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv32q_zfh_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv32q_zfh_analysis[];
+RISCV_HIDDEN extern const char riscv_rv64d_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv64d_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv64d_analysis[];
+RISCV_HIDDEN extern const char riscv_rv64f_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv64f_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv64f_analysis[];
+RISCV_HIDDEN extern const char riscv_rv64q_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv64q_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv64q_analysis[];
+RISCV_HIDDEN extern const char riscv_rv64zfh_names[];
+RISCV_HIDDEN extern const RISCVDescription riscv_rv64zfh_descriptions[];
+RISCV_HIDDEN extern const RISCVAnalysis riscv_rv64zfh_analysis[];
+
+#endif /* RISCV_DECODE_PRIVATE_H */
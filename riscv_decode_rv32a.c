@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv32a, RISCV_INS_AMOADD_W to RISCV_INS_LR_W */
+const char riscv_rv32a_names[] =
+	"amoadd.w\0"
+	"amoxor.w\0"
+	"amoor.w\0"
+	"amoand.w\0"
+	"amomin.w\0"
+	"amomax.w\0"
+	"amominu.w\0"
+	"amomaxu.w\0"
+	"amoswap.w\0"
+	"sc.w\0"
+	"lr.w\0";
+
+const RISCVDescription riscv_rv32a_descriptions[] = {
+	{ 0, 29 }, /* amoadd.w */
+	{ 9, 29 }, /* amoxor.w */
+	{ 18, 29 }, /* amoor.w */
+	{ 26, 29 }, /* amoand.w */
+	{ 35, 29 }, /* amomin.w */
+	{ 44, 29 }, /* amomax.w */
+	{ 53, 29 }, /* amominu.w */
+	{ 63, 29 }, /* amomaxu.w */
+	{ 73, 29 }, /* amoswap.w */
+	{ 83, 29 }, /* sc.w */
+	{ 88, 20 }, /* lr.w */
+};
+
+const RISCVAnalysis riscv_rv32a_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 4 }, /* amoadd.w */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 4 }, /* amoxor.w */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 4 }, /* amoor.w */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 4 }, /* amoand.w */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 4 }, /* amomin.w */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 4 }, /* amomax.w */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 4 }, /* amominu.w */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 4 }, /* amomaxu.w */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 4 }, /* amoswap.w */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 4 }, /* sc.w */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 4 }, /* lr.w */
+};
@@ -0,0 +1,196 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv32b, RISCV_INS_FSRI to RISCV_INS_CRC32C_W */
+const char riscv_rv32b_names[] =
+	"fsri\0"
+	"cmix\0"
+	"cmov\0"
+	"fsl\0"
+	"fsr\0"
+	"sloi\0"
+	"sroi\0"
+	"rori\0"
+	"bclri\0"
+	"bseti\0"
+	"binvi\0"
+	"bexti\0"
+	"gorci\0"
+	"grevi\0"
+	"andn\0"
+	"orn\0"
+	"xnor\0"
+	"slo\0"
+	"sro\0"
+	"rol\0"
+	"ror\0"
+	"bclr\0"
+	"bset\0"
+	"binv\0"
+	"bext\0"
+	"gorc\0"
+	"grev\0"
+	"sh1add\0"
+	"sh2add\0"
+	"sh3add\0"
+	"clmul\0"
+	"clmulr\0"
+	"clmulh\0"
+	"min\0"
+	"minu\0"
+	"max\0"
+	"maxu\0"
+	"shfl\0"
+	"unshfl\0"
+	"bcompress\0"
+	"bdecompress\0"
+	"pack\0"
+	"packu\0"
+	"packh\0"
+	"bfp\0"
+	"shfli\0"
+	"unshfli\0"
+	"xperm4\0"
+	"xperm8\0"
+	"xperm16\0"
+	"clz\0"
+	"ctz\0"
+	"cpop\0"
+	"sext.b\0"
+	"sext.h\0"
+	"crc32.b\0"
+	"crc32.h\0"
+	"crc32.w\0"
+	"crc32c.b\0"
+	"crc32c.h\0"
+	"crc32c.w\0";
+
+const RISCVDescription riscv_rv32b_descriptions[] = {
+	{ 0, 25 }, /* fsri */
+	{ 5, 23 }, /* cmix */
+	{ 10, 23 }, /* cmov */
+	{ 15, 23 }, /* fsl */
+	{ 19, 23 }, /* fsr */
+	{ 23, 27 }, /* sloi */
+	{ 28, 27 }, /* sroi */
+	{ 33, 27 }, /* rori */
+	{ 38, 27 }, /* bclri */
+	{ 44, 27 }, /* bseti */
+	{ 50, 27 }, /* binvi */
+	{ 56, 27 }, /* bexti */
+	{ 62, 27 }, /* gorci */
+	{ 68, 27 }, /* grevi */
+	{ 74, 22 }, /* andn */
+	{ 79, 22 }, /* orn */
+	{ 83, 22 }, /* xnor */
+	{ 88, 22 }, /* slo */
+	{ 92, 22 }, /* sro */
+	{ 96, 22 }, /* rol */
+	{ 100, 22 }, /* ror */
+	{ 104, 22 }, /* bclr */
+	{ 109, 22 }, /* bset */
+	{ 114, 22 }, /* binv */
+	{ 119, 22 }, /* bext */
+	{ 124, 22 }, /* gorc */
+	{ 129, 22 }, /* grev */
+	{ 134, 22 }, /* sh1add */
+	{ 141, 22 }, /* sh2add */
+	{ 148, 22 }, /* sh3add */
+	{ 155, 22 }, /* clmul */
+	{ 161, 22 }, /* clmulr */
+	{ 168, 22 }, /* clmulh */
+	{ 175, 22 }, /* min */
+	{ 179, 22 }, /* minu */
+	{ 184, 22 }, /* max */
+	{ 188, 22 }, /* maxu */
+	{ 193, 22 }, /* shfl */
+	{ 198, 22 }, /* unshfl */
+	{ 205, 22 }, /* bcompress */
+	{ 215, 22 }, /* bdecompress */
+	{ 227, 22 }, /* pack */
+	{ 232, 22 }, /* packu */
+	{ 238, 22 }, /* packh */
+	{ 244, 22 }, /* bfp */
+	{ 248, 28 }, /* shfli */
+	{ 254, 28 }, /* unshfli */
+	{ 262, 22 }, /* xperm4 */
+	{ 269, 22 }, /* xperm8 */
+	{ 276, 22 }, /* xperm16 */
+	{ 284, 19 }, /* clz */
+	{ 288, 19 }, /* ctz */
+	{ 292, 19 }, /* cpop */
+	{ 297, 19 }, /* sext.b */
+	{ 304, 19 }, /* sext.h */
+	{ 311, 19 }, /* crc32.b */
+	{ 319, 19 }, /* crc32.h */
+	{ 327, 19 }, /* crc32.w */
+	{ 335, 19 }, /* crc32c.b */
+	{ 344, 19 }, /* crc32c.h */
+	{ 353, 19 }, /* crc32c.w */
+};
+
+const RISCVAnalysis riscv_rv32b_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* fsri */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* cmix */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* cmov */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* fsl */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* fsr */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sloi */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sroi */
+	{ RZ_ANALYSIS_OP_TYPE_ROR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* rori */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bclri */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bseti */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* binvi */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bexti */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* gorci */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* grevi */
+	{ RZ_ANALYSIS_OP_TYPE_AND, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* andn */
+	{ RZ_ANALYSIS_OP_TYPE_OR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* orn */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* xnor */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* slo */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sro */
+	{ RZ_ANALYSIS_OP_TYPE_ROL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* rol */
+	{ RZ_ANALYSIS_OP_TYPE_ROR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* ror */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bclr */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bset */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* binv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bext */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* gorc */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* grev */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sh1add */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sh2add */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sh3add */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* clmul */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* clmulr */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* clmulh */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* min */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* minu */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* max */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* maxu */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* shfl */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* unshfl */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bcompress */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bdecompress */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* pack */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* packu */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* packh */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bfp */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* shfli */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* unshfli */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* xperm4 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* xperm8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* xperm16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* clz */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* ctz */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* cpop */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sext.b */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sext.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* crc32.b */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* crc32.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* crc32.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* crc32c.b */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* crc32c.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* crc32c.w */
+};
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv32d, RISCV_INS_FLD to RISCV_INS_FCLASS_D */
+const char riscv_rv32d_names[] =
+	"fld\0"
+	"fsd\0"
+	"fmadd.d\0"
+	"fmsub.d\0"
+	"fnmsub.d\0"
+	"fnmadd.d\0"
+	"fadd.d\0"
+	"fsub.d\0"
+	"fmul.d\0"
+	"fdiv.d\0"
+	"fsgnj.d\0"
+	"fsgnjn.d\0"
+	"fsgnjx.d\0"
+	"fmin.d\0"
+	"fmax.d\0"
+	"fle.d\0"
+	"flt.d\0"
+	"feq.d\0"
+	"fcvt.s.d\0"
+	"fcvt.d.s\0"
+	"fsqrt.d\0"
+	"fcvt.w.d\0"
+	"fcvt.wu.d\0"
+	"fcvt.d.w\0"
+	"fcvt.d.wu\0"
+	"fclass.d\0";
+
+const RISCVDescription riscv_rv32d_descriptions[] = {
+	{ 0, 5 }, /* fld */
+	{ 4, 8 }, /* fsd */
+	{ 8, 2 }, /* fmadd.d */
+	{ 16, 2 }, /* fmsub.d */
+	{ 24, 2 }, /* fnmsub.d */
+	{ 33, 2 }, /* fnmadd.d */
+	{ 42, 3 }, /* fadd.d */
+	{ 49, 3 }, /* fsub.d */
+	{ 56, 3 }, /* fmul.d */
+	{ 63, 3 }, /* fdiv.d */
+	{ 70, 1 }, /* fsgnj.d */
+	{ 78, 1 }, /* fsgnjn.d */
+	{ 87, 1 }, /* fsgnjx.d */
+	{ 96, 1 }, /* fmin.d */
+	{ 103, 1 }, /* fmax.d */
+	{ 110, 14 }, /* fle.d */
+	{ 116, 14 }, /* flt.d */
+	{ 122, 14 }, /* feq.d */
+	{ 128, 4 }, /* fcvt.s.d */
+	{ 137, 4 }, /* fcvt.d.s */
+	{ 146, 4 }, /* fsqrt.d */
+	{ 154, 15 }, /* fcvt.w.d */
+	{ 163, 15 }, /* fcvt.wu.d */
+	{ 173, 7 }, /* fcvt.d.w */
+	{ 182, 7 }, /* fcvt.d.wu */
+	{ 192, 13 }, /* fclass.d */
+};
+
+const RISCVAnalysis riscv_rv32d_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 8 }, /* fld */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 8 }, /* fsd */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmadd.d */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmsub.d */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fnmsub.d */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fnmadd.d */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fadd.d */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsub.d */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmul.d */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fdiv.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsgnj.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsgnjn.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsgnjx.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmin.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmax.d */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fle.d */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* flt.d */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* feq.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.s.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.d.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsqrt.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.w.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.wu.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.d.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.d.wu */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fclass.d */
+};
@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv32d-zfh, RISCV_INS_FCVT_H_D to RISCV_INS_FCVT_D_H */
+const char riscv_rv32d_zfh_names[] =
+	"fcvt.h.d\0"
+	"fcvt.d.h\0";
+
+const RISCVDescription riscv_rv32d_zfh_descriptions[] = {
+	{ 0, 4 }, /* fcvt.h.d */
+	{ 9, 4 }, /* fcvt.d.h */
+};
+
+const RISCVAnalysis riscv_rv32d_zfh_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.h.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.d.h */
+};
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv32f, RISCV_INS_FLW to RISCV_INS_FMV_W_X */
+const char riscv_rv32f_names[] =
+	"flw\0"
+	"fsw\0"
+	"fmadd.s\0"
+	"fmsub.s\0"
+	"fnmsub.s\0"
+	"fnmadd.s\0"
+	"fadd.s\0"
+	"fsub.s\0"
+	"fmul.s\0"
+	"fdiv.s\0"
+	"fsgnj.s\0"
+	"fsgnjn.s\0"
+	"fsgnjx.s\0"
+	"fmin.s\0"
+	"fmax.s\0"
+	"fle.s\0"
+	"flt.s\0"
+	"feq.s\0"
+	"fsqrt.s\0"
+	"fcvt.w.s\0"
+	"fcvt.wu.s\0"
+	"fcvt.s.w\0"
+	"fcvt.s.wu\0"
+	"fmv.x.w\0"
+	"fclass.s\0"
+	"fmv.w.x\0";
+
+const RISCVDescription riscv_rv32f_descriptions[] = {
+	{ 0, 5 }, /* flw */
+	{ 4, 8 }, /* fsw */
+	{ 8, 2 }, /* fmadd.s */
+	{ 16, 2 }, /* fmsub.s */
+	{ 24, 2 }, /* fnmsub.s */
+	{ 33, 2 }, /* fnmadd.s */
+	{ 42, 3 }, /* fadd.s */
+	{ 49, 3 }, /* fsub.s */
+	{ 56, 3 }, /* fmul.s */
+	{ 63, 3 }, /* fdiv.s */
+	{ 70, 1 }, /* fsgnj.s */
+	{ 78, 1 }, /* fsgnjn.s */
+	{ 87, 1 }, /* fsgnjx.s */
+	{ 96, 1 }, /* fmin.s */
+	{ 103, 1 }, /* fmax.s */
+	{ 110, 14 }, /* fle.s */
+	{ 116, 14 }, /* flt.s */
+	{ 122, 14 }, /* feq.s */
+	{ 128, 4 }, /* fsqrt.s */
+	{ 136, 15 }, /* fcvt.w.s */
+	{ 145, 15 }, /* fcvt.wu.s */
+	{ 155, 7 }, /* fcvt.s.w */
+	{ 164, 7 }, /* fcvt.s.wu */
+	{ 174, 13 }, /* fmv.x.w */
+	{ 182, 13 }, /* fclass.s */
+	{ 191, 6 }, /* fmv.w.x */
+};
+
+const RISCVAnalysis riscv_rv32f_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 4 }, /* flw */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 4 }, /* fsw */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmadd.s */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmsub.s */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fnmsub.s */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fnmadd.s */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fadd.s */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsub.s */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmul.s */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fdiv.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsgnj.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsgnjn.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsgnjx.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmin.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmax.s */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fle.s */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* flt.s */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* feq.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsqrt.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.w.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.wu.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.s.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.s.wu */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmv.x.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fclass.s */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmv.w.x */
+};
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv32h, RISCV_INS_HFENCE_VVMA to RISCV_INS_HLVX_WU */
+const char riscv_rv32h_names[] =
+	"hfence.vvma\0"
+	"hfence.gvma\0"
+	"hsv.b\0"
+	"hsv.h\0"
+	"hsv.w\0"
+	"hlv.b\0"
+	"hlv.bu\0"
+	"hlv.h\0"
+	"hlv.hu\0"
+	"hlvx.hu\0"
+	"hlv.w\0"
+	"hlvx.wu\0";
+
+const RISCVDescription riscv_rv32h_descriptions[] = {
+	{ 0, 33 }, /* hfence.vvma */
+	{ 12, 33 }, /* hfence.gvma */
+	{ 24, 33 }, /* hsv.b */
+	{ 30, 33 }, /* hsv.h */
+	{ 36, 33 }, /* hsv.w */
+	{ 42, 19 }, /* hlv.b */
+	{ 48, 19 }, /* hlv.bu */
+	{ 55, 19 }, /* hlv.h */
+	{ 61, 19 }, /* hlv.hu */
+	{ 68, 19 }, /* hlvx.hu */
+	{ 76, 19 }, /* hlv.w */
+	{ 82, 19 }, /* hlvx.wu */
+};
+
+const RISCVAnalysis riscv_rv32h_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 0 }, /* hfence.vvma */
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 0 }, /* hfence.gvma */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 1 }, /* hsv.b */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 2 }, /* hsv.h */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 4 }, /* hsv.w */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 1 }, /* hlv.b */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 1 }, /* hlv.bu */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 2 }, /* hlv.h */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 2 }, /* hlv.hu */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 2 }, /* hlvx.hu */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 4 }, /* hlv.w */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 4 }, /* hlvx.wu */
+};
@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv32i, RISCV_INS_JAL to RISCV_INS_AND */
+const char riscv_rv32i_names[] =
+	"jal\0"
+	"lui\0"
+	"auipc\0"
+	"beq\0"
+	"bne\0"
+	"blt\0"
+	"bge\0"
+	"bltu\0"
+	"bgeu\0"
+	"jalr\0"
+	"addi\0"
+	"slti\0"
+	"sltiu\0"
+	"xori\0"
+	"ori\0"
+	"andi\0"
+	"lb\0"
+	"lh\0"
+	"lw\0"
+	"lbu\0"
+	"lhu\0"
+	"sb\0"
+	"sh\0"
+	"sw\0"
+	"fence\0"
+	"fence.i\0"
+	"add\0"
+	"sub\0"
+	"sll\0"
+	"slt\0"
+	"sltu\0"
+	"xor\0"
+	"srl\0"
+	"sra\0"
+	"or\0"
+	"and\0";
+
+const RISCVDescription riscv_rv32i_descriptions[] = {
+	{ 0, 18 }, /* jal */
+	{ 4, 17 }, /* lui */
+	{ 8, 17 }, /* auipc */
+	{ 14, 34 }, /* beq */
+	{ 18, 34 }, /* bne */
+	{ 22, 34 }, /* blt */
+	{ 26, 34 }, /* bge */
+	{ 30, 34 }, /* bltu */
+	{ 35, 34 }, /* bgeu */
+	{ 40, 16 }, /* jalr */
+	{ 45, 21 }, /* addi */
+	{ 50, 21 }, /* slti */
+	{ 55, 21 }, /* sltiu */
+	{ 61, 21 }, /* xori */
+	{ 66, 21 }, /* ori */
+	{ 70, 21 }, /* andi */
+	{ 75, 16 }, /* lb */
+	{ 78, 16 }, /* lh */
+	{ 81, 16 }, /* lw */
+	{ 84, 16 }, /* lbu */
+	{ 88, 16 }, /* lhu */
+	{ 92, 35 }, /* sb */
+	{ 95, 35 }, /* sh */
+	{ 98, 35 }, /* sw */
+	{ 101, 9 }, /* fence */
+	{ 107, 0 }, /* fence.i */
+	{ 115, 22 }, /* add */
+	{ 119, 22 }, /* sub */
+	{ 123, 22 }, /* sll */
+	{ 127, 22 }, /* slt */
+	{ 131, 22 }, /* sltu */
+	{ 136, 22 }, /* xor */
+	{ 140, 22 }, /* srl */
+	{ 144, 22 }, /* sra */
+	{ 148, 22 }, /* or */
+	{ 151, 22 }, /* and */
+};
+
+const RISCVAnalysis riscv_rv32i_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_JMP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* jal */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* lui */
+	{ RZ_ANALYSIS_OP_TYPE_LEA, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* auipc */
+	{ RZ_ANALYSIS_OP_TYPE_CJMP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_EQ, 0 }, /* beq */
+	{ RZ_ANALYSIS_OP_TYPE_CJMP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_NE, 0 }, /* bne */
+	{ RZ_ANALYSIS_OP_TYPE_CJMP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_LT, 0 }, /* blt */
+	{ RZ_ANALYSIS_OP_TYPE_CJMP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_GE, 0 }, /* bge */
+	{ RZ_ANALYSIS_OP_TYPE_CJMP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_LO, 0 }, /* bltu */
+	{ RZ_ANALYSIS_OP_TYPE_CJMP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_HS, 0 }, /* bgeu */
+	{ RZ_ANALYSIS_OP_TYPE_RJMP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* jalr */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* addi */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* slti */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sltiu */
+	{ RZ_ANALYSIS_OP_TYPE_XOR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* xori */
+	{ RZ_ANALYSIS_OP_TYPE_OR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* ori */
+	{ RZ_ANALYSIS_OP_TYPE_AND, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* andi */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 1 }, /* lb */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 2 }, /* lh */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 4 }, /* lw */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 1 }, /* lbu */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 2 }, /* lhu */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 1 }, /* sb */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 2 }, /* sh */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 4 }, /* sw */
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* fence */
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* fence.i */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* add */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sub */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sll */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* slt */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sltu */
+	{ RZ_ANALYSIS_OP_TYPE_XOR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* xor */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* srl */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sra */
+	{ RZ_ANALYSIS_OP_TYPE_OR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* or */
+	{ RZ_ANALYSIS_OP_TYPE_AND, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* and */
+};
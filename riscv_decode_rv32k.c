@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv32k, RISCV_INS_AES32ESMI to RISCV_INS_SHA512SIG1H */
+const char riscv_rv32k_names[] =
+	"aes32esmi\0"
+	"aes32esi\0"
+	"aes32dsmi\0"
+	"aes32dsi\0"
+	"sha512sum0r\0"
+	"sha512sum1r\0"
+	"sha512sig0l\0"
+	"sha512sig0h\0"
+	"sha512sig1l\0"
+	"sha512sig1h\0";
+
+const RISCVDescription riscv_rv32k_descriptions[] = {
+	{ 0, 22 }, /* aes32esmi */
+	{ 10, 22 }, /* aes32esi */
+	{ 19, 22 }, /* aes32dsmi */
+	{ 29, 22 }, /* aes32dsi */
+	{ 38, 22 }, /* sha512sum0r */
+	{ 50, 22 }, /* sha512sum1r */
+	{ 62, 22 }, /* sha512sig0l */
+	{ 74, 22 }, /* sha512sig0h */
+	{ 86, 22 }, /* sha512sig1l */
+	{ 98, 22 }, /* sha512sig1h */
+};
+
+const RISCVAnalysis riscv_rv32k_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* aes32esmi */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* aes32esi */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* aes32dsmi */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* aes32dsi */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha512sum0r */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha512sum1r */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha512sig0l */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha512sig0h */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha512sig1l */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha512sig1h */
+};
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv32m, RISCV_INS_MUL to RISCV_INS_REMU */
+const char riscv_rv32m_names[] =
+	"mul\0"
+	"mulh\0"
+	"mulhsu\0"
+	"mulhu\0"
+	"div\0"
+	"divu\0"
+	"rem\0"
+	"remu\0";
+
+const RISCVDescription riscv_rv32m_descriptions[] = {
+	{ 0, 22 }, /* mul */
+	{ 4, 22 }, /* mulh */
+	{ 9, 22 }, /* mulhsu */
+	{ 16, 22 }, /* mulhu */
+	{ 22, 22 }, /* div */
+	{ 26, 22 }, /* divu */
+	{ 31, 22 }, /* rem */
+	{ 35, 22 }, /* remu */
+};
+
+const RISCVAnalysis riscv_rv32m_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* mul */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* mulh */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* mulhsu */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* mulhu */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* div */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* divu */
+	{ RZ_ANALYSIS_OP_TYPE_MOD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* rem */
+	{ RZ_ANALYSIS_OP_TYPE_MOD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* remu */
+};
@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv32q, RISCV_INS_FLQ to RISCV_INS_FCLASS_Q */
+const char riscv_rv32q_names[] =
+	"flq\0"
+	"fsq\0"
+	"fmadd.q\0"
+	"fmsub.q\0"
+	"fnmsub.q\0"
+	"fnmadd.q\0"
+	"fadd.q\0"
+	"fsub.q\0"
+	"fmul.q\0"
+	"fdiv.q\0"
+	"fsgnj.q\0"
+	"fsgnjn.q\0"
+	"fsgnjx.q\0"
+	"fmin.q\0"
+	"fmax.q\0"
+	"fle.q\0"
+	"flt.q\0"
+	"feq.q\0"
+	"fcvt.s.q\0"
+	"fcvt.q.s\0"
+	"fcvt.d.q\0"
+	"fcvt.q.d\0"
+	"fsqrt.q\0"
+	"fcvt.w.q\0"
+	"fcvt.wu.q\0"
+	"fcvt.q.w\0"
+	"fcvt.q.wu\0"
+	"fclass.q\0";
+
+const RISCVDescription riscv_rv32q_descriptions[] = {
+	{ 0, 5 }, /* flq */
+	{ 4, 8 }, /* fsq */
+	{ 8, 2 }, /* fmadd.q */
+	{ 16, 2 }, /* fmsub.q */
+	{ 24, 2 }, /* fnmsub.q */
+	{ 33, 2 }, /* fnmadd.q */
+	{ 42, 3 }, /* fadd.q */
+	{ 49, 3 }, /* fsub.q */
+	{ 56, 3 }, /* fmul.q */
+	{ 63, 3 }, /* fdiv.q */
+	{ 70, 1 }, /* fsgnj.q */
+	{ 78, 1 }, /* fsgnjn.q */
+	{ 87, 1 }, /* fsgnjx.q */
+	{ 96, 1 }, /* fmin.q */
+	{ 103, 1 }, /* fmax.q */
+	{ 110, 14 }, /* fle.q */
+	{ 116, 14 }, /* flt.q */
+	{ 122, 14 }, /* feq.q */
+	{ 128, 4 }, /* fcvt.s.q */
+	{ 137, 4 }, /* fcvt.q.s */
+	{ 146, 4 }, /* fcvt.d.q */
+	{ 155, 4 }, /* fcvt.q.d */
+	{ 164, 4 }, /* fsqrt.q */
+	{ 172, 15 }, /* fcvt.w.q */
+	{ 181, 15 }, /* fcvt.wu.q */
+	{ 191, 7 }, /* fcvt.q.w */
+	{ 200, 7 }, /* fcvt.q.wu */
+	{ 210, 13 }, /* fclass.q */
+};
+
+const RISCVAnalysis riscv_rv32q_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 16 }, /* flq */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 16 }, /* fsq */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmadd.q */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmsub.q */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fnmsub.q */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fnmadd.q */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fadd.q */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsub.q */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmul.q */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fdiv.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsgnj.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsgnjn.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsgnjx.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmin.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmax.q */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fle.q */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* flt.q */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* feq.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.s.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.q.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.d.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.q.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsqrt.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.w.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.wu.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.q.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.q.wu */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fclass.q */
+};
@@ -0,0 +1,19 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv32q-zfh, RISCV_INS_FCVT_H_Q to RISCV_INS_FCVT_Q_H */
+const char riscv_rv32q_zfh_names[] =
+	"fcvt.h.q\0"
+	"fcvt.q.h\0";
+
+const RISCVDescription riscv_rv32q_zfh_descriptions[] = {
+	{ 0, 4 }, /* fcvt.h.q */
+	{ 9, 4 }, /* fcvt.q.h */
+};
+
+const RISCVAnalysis riscv_rv32q_zfh_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.h.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.q.h */
+};
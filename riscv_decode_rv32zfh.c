@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv32zfh, RISCV_INS_FLH to RISCV_INS_FMV_H_X */
+const char riscv_rv32zfh_names[] =
+	"flh\0"
+	"fsh\0"
+	"fmadd.h\0"
+	"fmsub.h\0"
+	"fnmsub.h\0"
+	"fnmadd.h\0"
+	"fadd.h\0"
+	"fsub.h\0"
+	"fmul.h\0"
+	"fdiv.h\0"
+	"fsgnj.h\0"
+	"fsgnjn.h\0"
+	"fsgnjx.h\0"
+	"fmin.h\0"
+	"fmax.h\0"
+	"fle.h\0"
+	"flt.h\0"
+	"feq.h\0"
+	"fcvt.h.s\0"
+	"fcvt.s.h\0"
+	"fsqrt.h\0"
+	"fcvt.w.h\0"
+	"fcvt.wu.h\0"
+	"fcvt.h.w\0"
+	"fcvt.h.wu\0"
+	"fmv.x.h\0"
+	"fclass.h\0"
+	"fmv.h.x\0";
+
+const RISCVDescription riscv_rv32zfh_descriptions[] = {
+	{ 0, 5 }, /* flh */
+	{ 4, 8 }, /* fsh */
+	{ 8, 2 }, /* fmadd.h */
+	{ 16, 2 }, /* fmsub.h */
+	{ 24, 2 }, /* fnmsub.h */
+	{ 33, 2 }, /* fnmadd.h */
+	{ 42, 3 }, /* fadd.h */
+	{ 49, 3 }, /* fsub.h */
+	{ 56, 3 }, /* fmul.h */
+	{ 63, 3 }, /* fdiv.h */
+	{ 70, 1 }, /* fsgnj.h */
+	{ 78, 1 }, /* fsgnjn.h */
+	{ 87, 1 }, /* fsgnjx.h */
+	{ 96, 1 }, /* fmin.h */
+	{ 103, 1 }, /* fmax.h */
+	{ 110, 14 }, /* fle.h */
+	{ 116, 14 }, /* flt.h */
+	{ 122, 14 }, /* feq.h */
+	{ 128, 4 }, /* fcvt.h.s */
+	{ 137, 4 }, /* fcvt.s.h */
+	{ 146, 4 }, /* fsqrt.h */
+	{ 154, 15 }, /* fcvt.w.h */
+	{ 163, 15 }, /* fcvt.wu.h */
+	{ 173, 7 }, /* fcvt.h.w */
+	{ 182, 7 }, /* fcvt.h.wu */
+	{ 192, 13 }, /* fmv.x.h */
+	{ 200, 13 }, /* fclass.h */
+	{ 209, 6 }, /* fmv.h.x */
+};
+
+const RISCVAnalysis riscv_rv32zfh_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 2 }, /* flh */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 2 }, /* fsh */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmadd.h */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmsub.h */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fnmsub.h */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fnmadd.h */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fadd.h */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsub.h */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmul.h */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fdiv.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsgnj.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsgnjn.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsgnjx.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmin.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmax.h */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fle.h */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* flt.h */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* feq.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.h.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.s.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fsqrt.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.w.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.wu.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.h.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.h.wu */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmv.x.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fclass.h */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmv.h.x */
+};
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv64a, RISCV_INS_AMOADD_D to RISCV_INS_LR_D */
+const char riscv_rv64a_names[] =
+	"amoadd.d\0"
+	"amoxor.d\0"
+	"amoor.d\0"
+	"amoand.d\0"
+	"amomin.d\0"
+	"amomax.d\0"
+	"amominu.d\0"
+	"amomaxu.d\0"
+	"amoswap.d\0"
+	"sc.d\0"
+	"lr.d\0";
+
+const RISCVDescription riscv_rv64a_descriptions[] = {
+	{ 0, 29 }, /* amoadd.d */
+	{ 9, 29 }, /* amoxor.d */
+	{ 18, 29 }, /* amoor.d */
+	{ 26, 29 }, /* amoand.d */
+	{ 35, 29 }, /* amomin.d */
+	{ 44, 29 }, /* amomax.d */
+	{ 53, 29 }, /* amominu.d */
+	{ 63, 29 }, /* amomaxu.d */
+	{ 73, 29 }, /* amoswap.d */
+	{ 83, 29 }, /* sc.d */
+	{ 88, 20 }, /* lr.d */
+};
+
+const RISCVAnalysis riscv_rv64a_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 8 }, /* amoadd.d */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 8 }, /* amoxor.d */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 8 }, /* amoor.d */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 8 }, /* amoand.d */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 8 }, /* amomin.d */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 8 }, /* amomax.d */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 8 }, /* amominu.d */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 8 }, /* amomaxu.d */
+	{ RZ_ANALYSIS_OP_TYPE_XCHG, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 8 }, /* amoswap.d */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 8 }, /* sc.d */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_THREAD, RZ_TYPE_COND_AL, 8 }, /* lr.d */
+};
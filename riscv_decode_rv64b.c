@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv64b, RISCV_INS_FSLW to RISCV_INS_CPOPW */
+const char riscv_rv64b_names[] =
+	"fslw\0"
+	"fsrw\0"
+	"fsriw\0"
+	"slli.uw\0"
+	"bmator\0"
+	"bmatxor\0"
+	"add.uw\0"
+	"slow\0"
+	"srow\0"
+	"rolw\0"
+	"rorw\0"
+	"gorcw\0"
+	"grevw\0"
+	"sloiw\0"
+	"sroiw\0"
+	"roriw\0"
+	"gorciw\0"
+	"greviw\0"
+	"sh1add.uw\0"
+	"sh2add.uw\0"
+	"sh3add.uw\0"
+	"shflw\0"
+	"unshflw\0"
+	"bcompressw\0"
+	"bdecompressw\0"
+	"packw\0"
+	"packuw\0"
+	"bfpw\0"
+	"xperm32\0"
+	"bmatflip\0"
+	"crc32.d\0"
+	"crc32c.d\0"
+	"clzw\0"
+	"ctzw\0"
+	"cpopw\0";
+
+const RISCVDescription riscv_rv64b_descriptions[] = {
+	{ 0, 23 }, /* fslw */
+	{ 5, 23 }, /* fsrw */
+	{ 10, 26 }, /* fsriw */
+	{ 16, 27 }, /* slli.uw */
+	{ 24, 22 }, /* bmator */
+	{ 31, 22 }, /* bmatxor */
+	{ 39, 22 }, /* add.uw */
+	{ 46, 22 }, /* slow */
+	{ 51, 22 }, /* srow */
+	{ 56, 22 }, /* rolw */
+	{ 61, 22 }, /* rorw */
+	{ 66, 22 }, /* gorcw */
+	{ 72, 22 }, /* grevw */
+	{ 78, 28 }, /* sloiw */
+	{ 84, 28 }, /* sroiw */
+	{ 90, 28 }, /* roriw */
+	{ 96, 28 }, /* gorciw */
+	{ 103, 28 }, /* greviw */
+	{ 110, 22 }, /* sh1add.uw */
+	{ 120, 22 }, /* sh2add.uw */
+	{ 130, 22 }, /* sh3add.uw */
+	{ 140, 22 }, /* shflw */
+	{ 146, 22 }, /* unshflw */
+	{ 154, 22 }, /* bcompressw */
+	{ 165, 22 }, /* bdecompressw */
+	{ 178, 22 }, /* packw */
+	{ 184, 22 }, /* packuw */
+	{ 191, 22 }, /* bfpw */
+	{ 196, 22 }, /* xperm32 */
+	{ 204, 19 }, /* bmatflip */
+	{ 213, 19 }, /* crc32.d */
+	{ 221, 19 }, /* crc32c.d */
+	{ 230, 19 }, /* clzw */
+	{ 235, 19 }, /* ctzw */
+	{ 240, 19 }, /* cpopw */
+};
+
+const RISCVAnalysis riscv_rv64b_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* fslw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* fsrw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* fsriw */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* slli.uw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bmator */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bmatxor */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* add.uw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* slow */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* srow */
+	{ RZ_ANALYSIS_OP_TYPE_ROL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* rolw */
+	{ RZ_ANALYSIS_OP_TYPE_ROR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* rorw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* gorcw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* grevw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sloiw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sroiw */
+	{ RZ_ANALYSIS_OP_TYPE_ROR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* roriw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* gorciw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* greviw */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sh1add.uw */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sh2add.uw */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sh3add.uw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* shflw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* unshflw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bcompressw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bdecompressw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* packw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* packuw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bfpw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* xperm32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* bmatflip */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* crc32.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* crc32c.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* clzw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* ctzw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* cpopw */
+};
@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv64d, RISCV_INS_FCVT_L_D to RISCV_INS_FMV_D_X */
+const char riscv_rv64d_names[] =
+	"fcvt.l.d\0"
+	"fcvt.lu.d\0"
+	"fcvt.d.l\0"
+	"fcvt.d.lu\0"
+	"fmv.x.d\0"
+	"fmv.d.x\0";
+
+const RISCVDescription riscv_rv64d_descriptions[] = {
+	{ 0, 15 }, /* fcvt.l.d */
+	{ 9, 15 }, /* fcvt.lu.d */
+	{ 19, 7 }, /* fcvt.d.l */
+	{ 28, 7 }, /* fcvt.d.lu */
+	{ 38, 13 }, /* fmv.x.d */
+	{ 46, 6 }, /* fmv.d.x */
+};
+
+const RISCVAnalysis riscv_rv64d_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.l.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.lu.d */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.d.l */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.d.lu */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmv.x.d */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fmv.d.x */
+};
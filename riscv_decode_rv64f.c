@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv64f, RISCV_INS_FCVT_L_S to RISCV_INS_FCVT_S_LU */
+const char riscv_rv64f_names[] =
+	"fcvt.l.s\0"
+	"fcvt.lu.s\0"
+	"fcvt.s.l\0"
+	"fcvt.s.lu\0";
+
+const RISCVDescription riscv_rv64f_descriptions[] = {
+	{ 0, 15 }, /* fcvt.l.s */
+	{ 9, 15 }, /* fcvt.lu.s */
+	{ 19, 7 }, /* fcvt.s.l */
+	{ 28, 7 }, /* fcvt.s.lu */
+};
+
+const RISCVAnalysis riscv_rv64f_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.l.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.lu.s */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.s.l */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.s.lu */
+};
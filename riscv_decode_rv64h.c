@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv64h, RISCV_INS_HSV_D to RISCV_INS_HLV_D */
+const char riscv_rv64h_names[] =
+	"hsv.d\0"
+	"hlv.wu\0"
+	"hlv.d\0";
+
+const RISCVDescription riscv_rv64h_descriptions[] = {
+	{ 0, 33 }, /* hsv.d */
+	{ 6, 19 }, /* hlv.wu */
+	{ 13, 19 }, /* hlv.d */
+};
+
+const RISCVAnalysis riscv_rv64h_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 8 }, /* hsv.d */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 4 }, /* hlv.wu */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_VIRT, RZ_TYPE_COND_AL, 8 }, /* hlv.d */
+};
@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv64i, RISCV_INS_ADDIW to RISCV_INS_SRAW */
+const char riscv_rv64i_names[] =
+	"addiw\0"
+	"ld\0"
+	"lwu\0"
+	"sd\0"
+	"slli\0"
+	"srli\0"
+	"srai\0"
+	"slliw\0"
+	"srliw\0"
+	"sraiw\0"
+	"addw\0"
+	"subw\0"
+	"sllw\0"
+	"srlw\0"
+	"sraw\0";
+
+const RISCVDescription riscv_rv64i_descriptions[] = {
+	{ 0, 21 }, /* addiw */
+	{ 6, 16 }, /* ld */
+	{ 9, 16 }, /* lwu */
+	{ 13, 35 }, /* sd */
+	{ 16, 27 }, /* slli */
+	{ 21, 27 }, /* srli */
+	{ 26, 27 }, /* srai */
+	{ 31, 28 }, /* slliw */
+	{ 37, 28 }, /* srliw */
+	{ 43, 28 }, /* sraiw */
+	{ 49, 22 }, /* addw */
+	{ 54, 22 }, /* subw */
+	{ 59, 22 }, /* sllw */
+	{ 64, 22 }, /* srlw */
+	{ 69, 22 }, /* sraw */
+};
+
+const RISCVAnalysis riscv_rv64i_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* addiw */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 8 }, /* ld */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 4 }, /* lwu */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 8 }, /* sd */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* slli */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* srli */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* srai */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* slliw */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* srliw */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sraiw */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* addw */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* subw */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sllw */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* srlw */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* sraw */
+};
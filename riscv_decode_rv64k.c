@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv64k, RISCV_INS_AES64KS2 to RISCV_INS_SHA512SIG1 */
+const char riscv_rv64k_names[] =
+	"aes64ks2\0"
+	"aes64esm\0"
+	"aes64es\0"
+	"aes64dsm\0"
+	"aes64ds\0"
+	"aes64ks1i\0"
+	"aes64im\0"
+	"sha512sum0\0"
+	"sha512sum1\0"
+	"sha512sig0\0"
+	"sha512sig1\0";
+
+const RISCVDescription riscv_rv64k_descriptions[] = {
+	{ 0, 22 }, /* aes64ks2 */
+	{ 9, 22 }, /* aes64esm */
+	{ 18, 22 }, /* aes64es */
+	{ 26, 22 }, /* aes64dsm */
+	{ 35, 22 }, /* aes64ds */
+	{ 43, 19 }, /* aes64ks1i */
+	{ 53, 19 }, /* aes64im */
+	{ 61, 19 }, /* sha512sum0 */
+	{ 72, 19 }, /* sha512sum1 */
+	{ 83, 19 }, /* sha512sig0 */
+	{ 94, 19 }, /* sha512sig1 */
+};
+
+const RISCVAnalysis riscv_rv64k_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* aes64ks2 */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* aes64esm */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* aes64es */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* aes64dsm */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* aes64ds */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* aes64ks1i */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* aes64im */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha512sum0 */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha512sum1 */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha512sig0 */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha512sig1 */
+};
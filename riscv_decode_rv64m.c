@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv64m, RISCV_INS_MULW to RISCV_INS_REMUW */
+const char riscv_rv64m_names[] =
+	"mulw\0"
+	"divw\0"
+	"divuw\0"
+	"remw\0"
+	"remuw\0";
+
+const RISCVDescription riscv_rv64m_descriptions[] = {
+	{ 0, 22 }, /* mulw */
+	{ 5, 22 }, /* divw */
+	{ 10, 22 }, /* divuw */
+	{ 16, 22 }, /* remw */
+	{ 21, 22 }, /* remuw */
+};
+
+const RISCVAnalysis riscv_rv64m_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* mulw */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* divw */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* divuw */
+	{ RZ_ANALYSIS_OP_TYPE_MOD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* remw */
+	{ RZ_ANALYSIS_OP_TYPE_MOD, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* remuw */
+};
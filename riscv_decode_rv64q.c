@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv64q, RISCV_INS_FCVT_L_Q to RISCV_INS_FCVT_Q_LU */
+const char riscv_rv64q_names[] =
+	"fcvt.l.q\0"
+	"fcvt.lu.q\0"
+	"fcvt.q.l\0"
+	"fcvt.q.lu\0";
+
+const RISCVDescription riscv_rv64q_descriptions[] = {
+	{ 0, 15 }, /* fcvt.l.q */
+	{ 9, 15 }, /* fcvt.lu.q */
+	{ 19, 7 }, /* fcvt.q.l */
+	{ 28, 7 }, /* fcvt.q.lu */
+};
+
+const RISCVAnalysis riscv_rv64q_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.l.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.lu.q */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.q.l */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.q.lu */
+};
@@ -0,0 +1,25 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rv64zfh, RISCV_INS_FCVT_L_H to RISCV_INS_FCVT_H_LU */
+const char riscv_rv64zfh_names[] =
+	"fcvt.l.h\0"
+	"fcvt.lu.h\0"
+	"fcvt.h.l\0"
+	"fcvt.h.lu\0";
+
+const RISCVDescription riscv_rv64zfh_descriptions[] = {
+	{ 0, 15 }, /* fcvt.l.h */
+	{ 9, 15 }, /* fcvt.lu.h */
+	{ 19, 7 }, /* fcvt.h.l */
+	{ 28, 7 }, /* fcvt.h.lu */
+};
+
+const RISCVAnalysis riscv_rv64zfh_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.l.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.lu.h */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.h.l */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_FPU, RZ_TYPE_COND_AL, 0 }, /* fcvt.h.lu */
+};
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rvk, RISCV_INS_SM4ED to RISCV_INS_SHA256SIG1 */
+const char riscv_rvk_names[] =
+	"sm4ed\0"
+	"sm4ks\0"
+	"sm3p0\0"
+	"sm3p1\0"
+	"sha256sum0\0"
+	"sha256sum1\0"
+	"sha256sig0\0"
+	"sha256sig1\0";
+
+const RISCVDescription riscv_rvk_descriptions[] = {
+	{ 0, 22 }, /* sm4ed */
+	{ 6, 22 }, /* sm4ks */
+	{ 12, 19 }, /* sm3p0 */
+	{ 18, 19 }, /* sm3p1 */
+	{ 24, 19 }, /* sha256sum0 */
+	{ 35, 19 }, /* sha256sum1 */
+	{ 46, 19 }, /* sha256sig0 */
+	{ 57, 19 }, /* sha256sig1 */
+};
+
+const RISCVAnalysis riscv_rvk_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sm4ed */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sm4ks */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sm3p0 */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sm3p1 */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha256sum0 */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha256sum1 */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha256sig0 */
+	{ RZ_ANALYSIS_OP_TYPE_CRYPTO, RZ_ANALYSIS_OP_FAMILY_CRYPTO, RZ_TYPE_COND_AL, 0 }, /* sha256sig1 */
+};
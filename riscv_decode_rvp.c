@@ -0,0 +1,991 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rvp, RISCV_INS_BPICK to RISCV_INS_KABS32 */
+const char riscv_rvp_names[] =
+	"bpick\0"
+	"bitrevi\0"
+	"srai.u\0"
+	"add8\0"
+	"add16\0"
+	"add64\0"
+	"ave\0"
+	"bitrev\0"
+	"cmpeq8\0"
+	"cmpeq16\0"
+	"cras16\0"
+	"crsa16\0"
+	"kadd8\0"
+	"kadd16\0"
+	"kadd64\0"
+	"kaddh\0"
+	"kaddw\0"
+	"kcras16\0"
+	"kcrsa16\0"
+	"kdmbb\0"
+	"kdmbt\0"
+	"kdmtt\0"
+	"kdmabb\0"
+	"kdmabt\0"
+	"kdmatt\0"
+	"khm8\0"
+	"khmx8\0"
+	"khm16\0"
+	"khmx16\0"
+	"khmbb\0"
+	"khmbt\0"
+	"khmtt\0"
+	"kmabb\0"
+	"kmabt\0"
+	"kmatt\0"
+	"kmada\0"
+	"kmaxda\0"
+	"kmads\0"
+	"kmadrs\0"
+	"kmaxds\0"
+	"kmar64\0"
+	"kmda\0"
+	"kmxda\0"
+	"kmmac\0"
+	"kmmac.u\0"
+	"kmmawb\0"
+	"kmmawb.u\0"
+	"kmmawb2\0"
+	"kmmawb2.u\0"
+	"kmmawt\0"
+	"kmmawt.u\0"
+	"kmmawt2\0"
+	"kmmawt2.u\0"
+	"kmmsb\0"
+	"kmmsb.u\0"
+	"kmmwb2\0"
+	"kmmwb2.u\0"
+	"kmmwt2\0"
+	"kmmwt2.u\0"
+	"kmsda\0"
+	"kmsxda\0"
+	"kmsr64\0"
+	"ksllw\0"
+	"kslliw\0"
+	"ksll8\0"
+	"ksll16\0"
+	"kslra8\0"
+	"kslra8.u\0"
+	"kslra16\0"
+	"kslra16.u\0"
+	"kslraw\0"
+	"kslraw.u\0"
+	"kstas16\0"
+	"kstsa16\0"
+	"ksub8\0"
+	"ksub16\0"
+	"ksub64\0"
+	"ksubh\0"
+	"ksubw\0"
+	"kwmmul\0"
+	"kwmmul.u\0"
+	"maddr32\0"
+	"maxw\0"
+	"minw\0"
+	"msubr32\0"
+	"mulr64\0"
+	"mulsr64\0"
+	"pbsad\0"
+	"pbsada\0"
+	"pkbb16\0"
+	"pkbt16\0"
+	"pktt16\0"
+	"pktb16\0"
+	"radd8\0"
+	"radd16\0"
+	"radd64\0"
+	"raddw\0"
+	"rcras16\0"
+	"rcrsa16\0"
+	"rstas16\0"
+	"rstsa16\0"
+	"rsub8\0"
+	"rsub16\0"
+	"rsub64\0"
+	"rsubw\0"
+	"sclip32\0"
+	"scmple8\0"
+	"scmple16\0"
+	"scmplt8\0"
+	"scmplt16\0"
+	"sll8\0"
+	"sll16\0"
+	"smal\0"
+	"smalbb\0"
+	"smalbt\0"
+	"smaltt\0"
+	"smalda\0"
+	"smalxda\0"
+	"smalds\0"
+	"smaldrs\0"
+	"smalxds\0"
+	"smar64\0"
+	"smaqa\0"
+	"smaqa.su\0"
+	"smax8\0"
+	"smax16\0"
+	"smbb16\0"
+	"smbt16\0"
+	"smtt16\0"
+	"smds\0"
+	"smdrs\0"
+	"smxds\0"
+	"smin8\0"
+	"smin16\0"
+	"smmul\0"
+	"smmul.u\0"
+	"smmwb\0"
+	"smmwb.u\0"
+	"smmwt\0"
+	"smmwt.u\0"
+	"smslda\0"
+	"smslxda\0"
+	"smsr64\0"
+	"smul8\0"
+	"smulx8\0"
+	"smul16\0"
+	"smulx16\0"
+	"sra.u\0"
+	"sra8\0"
+	"sra8.u\0"
+	"sra16\0"
+	"sra16.u\0"
+	"srl8\0"
+	"srl8.u\0"
+	"srl16\0"
+	"srl16.u\0"
+	"stas16\0"
+	"stsa16\0"
+	"sub8\0"
+	"sub16\0"
+	"sub64\0"
+	"uclip32\0"
+	"ucmple8\0"
+	"ucmple16\0"
+	"ucmplt8\0"
+	"ucmplt16\0"
+	"ukadd8\0"
+	"ukadd16\0"
+	"ukadd64\0"
+	"ukaddh\0"
+	"ukaddw\0"
+	"ukcras16\0"
+	"ukcrsa16\0"
+	"ukmar64\0"
+	"ukmsr64\0"
+	"ukstas16\0"
+	"ukstsa16\0"
+	"uksub8\0"
+	"uksub16\0"
+	"uksub64\0"
+	"uksubh\0"
+	"uksubw\0"
+	"umar64\0"
+	"umaqa\0"
+	"umax8\0"
+	"umax16\0"
+	"umin8\0"
+	"umin16\0"
+	"umsr64\0"
+	"umul8\0"
+	"umulx8\0"
+	"umul16\0"
+	"umulx16\0"
+	"uradd8\0"
+	"uradd16\0"
+	"uradd64\0"
+	"uraddw\0"
+	"urcras16\0"
+	"urcrsa16\0"
+	"urstas16\0"
+	"urstsa16\0"
+	"ursub8\0"
+	"ursub16\0"
+	"ursub64\0"
+	"ursubw\0"
+	"wexti\0"
+	"wext\0"
+	"add32\0"
+	"cras32\0"
+	"crsa32\0"
+	"kadd32\0"
+	"kcras32\0"
+	"kcrsa32\0"
+	"kdmbb16\0"
+	"kdmbt16\0"
+	"kdmtt16\0"
+	"kdmabb16\0"
+	"kdmabt16\0"
+	"kdmatt16\0"
+	"khmbb16\0"
+	"khmbt16\0"
+	"khmtt16\0"
+	"kmabb32\0"
+	"kmabt32\0"
+	"kmatt32\0"
+	"kmaxda32\0"
+	"kmda32\0"
+	"kmxda32\0"
+	"kmads32\0"
+	"kmadrs32\0"
+	"kmaxds32\0"
+	"kmsda32\0"
+	"kmsxda32\0"
+	"ksll32\0"
+	"kslli32\0"
+	"kslra32\0"
+	"kslra32.u\0"
+	"kstas32\0"
+	"kstsa32\0"
+	"ksub32\0"
+	"pkbb32\0"
+	"pkbt32\0"
+	"pktt32\0"
+	"pktb32\0"
+	"radd32\0"
+	"rcras32\0"
+	"rcrsa32\0"
+	"rstas32\0"
+	"rstsa32\0"
+	"rsub32\0"
+	"sll32\0"
+	"slli32\0"
+	"smax32\0"
+	"smbt32\0"
+	"smtt32\0"
+	"smds32\0"
+	"smdrs32\0"
+	"smxds32\0"
+	"smin32\0"
+	"sra32\0"
+	"sra32.u\0"
+	"srai32\0"
+	"srai32.u\0"
+	"sraiw.u\0"
+	"srl32\0"
+	"srl32.u\0"
+	"srli32\0"
+	"srli32.u\0"
+	"stas32\0"
+	"stsa32\0"
+	"sub32\0"
+	"ukadd32\0"
+	"ukcras32\0"
+	"ukcrsa32\0"
+	"ukstas32\0"
+	"ukstsa32\0"
+	"uksub32\0"
+	"umax32\0"
+	"umin32\0"
+	"uradd32\0"
+	"urcras32\0"
+	"urcrsa32\0"
+	"urstas32\0"
+	"urstsa32\0"
+	"ursub32\0"
+	"kslli16\0"
+	"sclip16\0"
+	"slli16\0"
+	"srai16\0"
+	"srai16.u\0"
+	"srli16\0"
+	"srli16.u\0"
+	"uclip16\0"
+	"insb\0"
+	"kslli8\0"
+	"sclip8\0"
+	"slli8\0"
+	"srai8\0"
+	"srai8.u\0"
+	"srli8\0"
+	"srli8.u\0"
+	"uclip8\0"
+	"clrs8\0"
+	"clrs16\0"
+	"clrs32\0"
+	"clo8\0"
+	"clo16\0"
+	"clo32\0"
+	"clz8\0"
+	"clz16\0"
+	"clz32\0"
+	"kabs8\0"
+	"kabs16\0"
+	"kabsw\0"
+	"sunpkd810\0"
+	"sunpkd820\0"
+	"sunpkd830\0"
+	"sunpkd831\0"
+	"sunpkd832\0"
+	"swap8\0"
+	"zunpkd810\0"
+	"zunpkd820\0"
+	"zunpkd830\0"
+	"zunpkd831\0"
+	"zunpkd832\0"
+	"kabs32\0";
+
+const RISCVDescription riscv_rvp_descriptions[] = {
+	{ 0, 24 }, /* bpick */
+	{ 6, 19 }, /* bitrevi */
+	{ 14, 19 }, /* srai.u */
+	{ 21, 22 }, /* add8 */
+	{ 26, 22 }, /* add16 */
+	{ 32, 22 }, /* add64 */
+	{ 38, 22 }, /* ave */
+	{ 42, 22 }, /* bitrev */
+	{ 49, 22 }, /* cmpeq8 */
+	{ 56, 22 }, /* cmpeq16 */
+	{ 64, 22 }, /* cras16 */
+	{ 71, 22 }, /* crsa16 */
+	{ 78, 22 }, /* kadd8 */
+	{ 84, 22 }, /* kadd16 */
+	{ 91, 22 }, /* kadd64 */
+	{ 98, 22 }, /* kaddh */
+	{ 104, 22 }, /* kaddw */
+	{ 110, 22 }, /* kcras16 */
+	{ 118, 22 }, /* kcrsa16 */
+	{ 126, 22 }, /* kdmbb */
+	{ 132, 22 }, /* kdmbt */
+	{ 138, 22 }, /* kdmtt */
+	{ 144, 22 }, /* kdmabb */
+	{ 151, 22 }, /* kdmabt */
+	{ 158, 22 }, /* kdmatt */
+	{ 165, 22 }, /* khm8 */
+	{ 170, 22 }, /* khmx8 */
+	{ 176, 22 }, /* khm16 */
+	{ 182, 22 }, /* khmx16 */
+	{ 189, 22 }, /* khmbb */
+	{ 195, 22 }, /* khmbt */
+	{ 201, 22 }, /* khmtt */
+	{ 207, 22 }, /* kmabb */
+	{ 213, 22 }, /* kmabt */
+	{ 219, 22 }, /* kmatt */
+	{ 225, 22 }, /* kmada */
+	{ 231, 22 }, /* kmaxda */
+	{ 238, 22 }, /* kmads */
+	{ 244, 22 }, /* kmadrs */
+	{ 251, 22 }, /* kmaxds */
+	{ 258, 22 }, /* kmar64 */
+	{ 265, 22 }, /* kmda */
+	{ 270, 22 }, /* kmxda */
+	{ 276, 22 }, /* kmmac */
+	{ 282, 22 }, /* kmmac.u */
+	{ 290, 22 }, /* kmmawb */
+	{ 297, 22 }, /* kmmawb.u */
+	{ 306, 22 }, /* kmmawb2 */
+	{ 314, 22 }, /* kmmawb2.u */
+	{ 324, 22 }, /* kmmawt */
+	{ 331, 22 }, /* kmmawt.u */
+	{ 340, 22 }, /* kmmawt2 */
+	{ 348, 22 }, /* kmmawt2.u */
+	{ 358, 22 }, /* kmmsb */
+	{ 364, 22 }, /* kmmsb.u */
+	{ 372, 22 }, /* kmmwb2 */
+	{ 379, 22 }, /* kmmwb2.u */
+	{ 388, 22 }, /* kmmwt2 */
+	{ 395, 22 }, /* kmmwt2.u */
+	{ 404, 22 }, /* kmsda */
+	{ 410, 22 }, /* kmsxda */
+	{ 417, 22 }, /* kmsr64 */
+	{ 424, 22 }, /* ksllw */
+	{ 430, 19 }, /* kslliw */
+	{ 437, 22 }, /* ksll8 */
+	{ 443, 22 }, /* ksll16 */
+	{ 450, 22 }, /* kslra8 */
+	{ 457, 22 }, /* kslra8.u */
+	{ 466, 22 }, /* kslra16 */
+	{ 474, 22 }, /* kslra16.u */
+	{ 484, 22 }, /* kslraw */
+	{ 491, 22 }, /* kslraw.u */
+	{ 500, 22 }, /* kstas16 */
+	{ 508, 22 }, /* kstsa16 */
+	{ 516, 22 }, /* ksub8 */
+	{ 522, 22 }, /* ksub16 */
+	{ 529, 22 }, /* ksub64 */
+	{ 536, 22 }, /* ksubh */
+	{ 542, 22 }, /* ksubw */
+	{ 548, 22 }, /* kwmmul */
+	{ 555, 22 }, /* kwmmul.u */
+	{ 564, 22 }, /* maddr32 */
+	{ 572, 22 }, /* maxw */
+	{ 577, 22 }, /* minw */
+	{ 582, 22 }, /* msubr32 */
+	{ 590, 22 }, /* mulr64 */
+	{ 597, 22 }, /* mulsr64 */
+	{ 605, 22 }, /* pbsad */
+	{ 611, 22 }, /* pbsada */
+	{ 618, 22 }, /* pkbb16 */
+	{ 625, 22 }, /* pkbt16 */
+	{ 632, 22 }, /* pktt16 */
+	{ 639, 22 }, /* pktb16 */
+	{ 646, 22 }, /* radd8 */
+	{ 652, 22 }, /* radd16 */
+	{ 659, 22 }, /* radd64 */
+	{ 666, 22 }, /* raddw */
+	{ 672, 22 }, /* rcras16 */
+	{ 680, 22 }, /* rcrsa16 */
+	{ 688, 22 }, /* rstas16 */
+	{ 696, 22 }, /* rstsa16 */
+	{ 704, 22 }, /* rsub8 */
+	{ 710, 22 }, /* rsub16 */
+	{ 717, 22 }, /* rsub64 */
+	{ 724, 22 }, /* rsubw */
+	{ 730, 19 }, /* sclip32 */
+	{ 738, 22 }, /* scmple8 */
+	{ 746, 22 }, /* scmple16 */
+	{ 755, 22 }, /* scmplt8 */
+	{ 763, 22 }, /* scmplt16 */
+	{ 772, 22 }, /* sll8 */
+	{ 777, 22 }, /* sll16 */
+	{ 783, 22 }, /* smal */
+	{ 788, 22 }, /* smalbb */
+	{ 795, 22 }, /* smalbt */
+	{ 802, 22 }, /* smaltt */
+	{ 809, 22 }, /* smalda */
+	{ 816, 22 }, /* smalxda */
+	{ 824, 22 }, /* smalds */
+	{ 831, 22 }, /* smaldrs */
+	{ 839, 22 }, /* smalxds */
+	{ 847, 22 }, /* smar64 */
+	{ 854, 22 }, /* smaqa */
+	{ 860, 22 }, /* smaqa.su */
+	{ 869, 22 }, /* smax8 */
+	{ 875, 22 }, /* smax16 */
+	{ 882, 22 }, /* smbb16 */
+	{ 889, 22 }, /* smbt16 */
+	{ 896, 22 }, /* smtt16 */
+	{ 903, 22 }, /* smds */
+	{ 908, 22 }, /* smdrs */
+	{ 914, 22 }, /* smxds */
+	{ 920, 22 }, /* smin8 */
+	{ 926, 22 }, /* smin16 */
+	{ 933, 22 }, /* smmul */
+	{ 939, 22 }, /* smmul.u */
+	{ 947, 22 }, /* smmwb */
+	{ 953, 22 }, /* smmwb.u */
+	{ 961, 22 }, /* smmwt */
+	{ 967, 22 }, /* smmwt.u */
+	{ 975, 22 }, /* smslda */
+	{ 982, 22 }, /* smslxda */
+	{ 990, 22 }, /* smsr64 */
+	{ 997, 22 }, /* smul8 */
+	{ 1003, 22 }, /* smulx8 */
+	{ 1010, 22 }, /* smul16 */
+	{ 1017, 22 }, /* smulx16 */
+	{ 1025, 22 }, /* sra.u */
+	{ 1031, 22 }, /* sra8 */
+	{ 1036, 22 }, /* sra8.u */
+	{ 1043, 22 }, /* sra16 */
+	{ 1049, 22 }, /* sra16.u */
+	{ 1057, 22 }, /* srl8 */
+	{ 1062, 22 }, /* srl8.u */
+	{ 1069, 22 }, /* srl16 */
+	{ 1075, 22 }, /* srl16.u */
+	{ 1083, 22 }, /* stas16 */
+	{ 1090, 22 }, /* stsa16 */
+	{ 1097, 22 }, /* sub8 */
+	{ 1102, 22 }, /* sub16 */
+	{ 1108, 22 }, /* sub64 */
+	{ 1114, 19 }, /* uclip32 */
+	{ 1122, 22 }, /* ucmple8 */
+	{ 1130, 22 }, /* ucmple16 */
+	{ 1139, 22 }, /* ucmplt8 */
+	{ 1147, 22 }, /* ucmplt16 */
+	{ 1156, 22 }, /* ukadd8 */
+	{ 1163, 22 }, /* ukadd16 */
+	{ 1171, 22 }, /* ukadd64 */
+	{ 1179, 22 }, /* ukaddh */
+	{ 1186, 22 }, /* ukaddw */
+	{ 1193, 22 }, /* ukcras16 */
+	{ 1202, 22 }, /* ukcrsa16 */
+	{ 1211, 22 }, /* ukmar64 */
+	{ 1219, 22 }, /* ukmsr64 */
+	{ 1227, 22 }, /* ukstas16 */
+	{ 1236, 22 }, /* ukstsa16 */
+	{ 1245, 22 }, /* uksub8 */
+	{ 1252, 22 }, /* uksub16 */
+	{ 1260, 22 }, /* uksub64 */
+	{ 1268, 22 }, /* uksubh */
+	{ 1275, 22 }, /* uksubw */
+	{ 1282, 22 }, /* umar64 */
+	{ 1289, 22 }, /* umaqa */
+	{ 1295, 22 }, /* umax8 */
+	{ 1301, 22 }, /* umax16 */
+	{ 1308, 22 }, /* umin8 */
+	{ 1314, 22 }, /* umin16 */
+	{ 1321, 22 }, /* umsr64 */
+	{ 1328, 22 }, /* umul8 */
+	{ 1334, 22 }, /* umulx8 */
+	{ 1341, 22 }, /* umul16 */
+	{ 1348, 22 }, /* umulx16 */
+	{ 1356, 22 }, /* uradd8 */
+	{ 1363, 22 }, /* uradd16 */
+	{ 1371, 22 }, /* uradd64 */
+	{ 1379, 22 }, /* uraddw */
+	{ 1386, 22 }, /* urcras16 */
+	{ 1395, 22 }, /* urcrsa16 */
+	{ 1404, 22 }, /* urstas16 */
+	{ 1413, 22 }, /* urstsa16 */
+	{ 1422, 22 }, /* ursub8 */
+	{ 1429, 22 }, /* ursub16 */
+	{ 1437, 22 }, /* ursub64 */
+	{ 1445, 22 }, /* ursubw */
+	{ 1452, 19 }, /* wexti */
+	{ 1458, 22 }, /* wext */
+	{ 1463, 22 }, /* add32 */
+	{ 1469, 22 }, /* cras32 */
+	{ 1476, 22 }, /* crsa32 */
+	{ 1483, 22 }, /* kadd32 */
+	{ 1490, 22 }, /* kcras32 */
+	{ 1498, 22 }, /* kcrsa32 */
+	{ 1506, 22 }, /* kdmbb16 */
+	{ 1514, 22 }, /* kdmbt16 */
+	{ 1522, 22 }, /* kdmtt16 */
+	{ 1530, 22 }, /* kdmabb16 */
+	{ 1539, 22 }, /* kdmabt16 */
+	{ 1548, 22 }, /* kdmatt16 */
+	{ 1557, 22 }, /* khmbb16 */
+	{ 1565, 22 }, /* khmbt16 */
+	{ 1573, 22 }, /* khmtt16 */
+	{ 1581, 22 }, /* kmabb32 */
+	{ 1589, 22 }, /* kmabt32 */
+	{ 1597, 22 }, /* kmatt32 */
+	{ 1605, 22 }, /* kmaxda32 */
+	{ 1614, 22 }, /* kmda32 */
+	{ 1621, 22 }, /* kmxda32 */
+	{ 1629, 22 }, /* kmads32 */
+	{ 1637, 22 }, /* kmadrs32 */
+	{ 1646, 22 }, /* kmaxds32 */
+	{ 1655, 22 }, /* kmsda32 */
+	{ 1663, 22 }, /* kmsxda32 */
+	{ 1672, 22 }, /* ksll32 */
+	{ 1679, 19 }, /* kslli32 */
+	{ 1687, 22 }, /* kslra32 */
+	{ 1695, 22 }, /* kslra32.u */
+	{ 1705, 22 }, /* kstas32 */
+	{ 1713, 22 }, /* kstsa32 */
+	{ 1721, 22 }, /* ksub32 */
+	{ 1728, 22 }, /* pkbb32 */
+	{ 1735, 22 }, /* pkbt32 */
+	{ 1742, 22 }, /* pktt32 */
+	{ 1749, 22 }, /* pktb32 */
+	{ 1756, 22 }, /* radd32 */
+	{ 1763, 22 }, /* rcras32 */
+	{ 1771, 22 }, /* rcrsa32 */
+	{ 1779, 22 }, /* rstas32 */
+	{ 1787, 22 }, /* rstsa32 */
+	{ 1795, 22 }, /* rsub32 */
+	{ 1802, 22 }, /* sll32 */
+	{ 1808, 19 }, /* slli32 */
+	{ 1815, 22 }, /* smax32 */
+	{ 1822, 22 }, /* smbt32 */
+	{ 1829, 22 }, /* smtt32 */
+	{ 1836, 22 }, /* smds32 */
+	{ 1843, 22 }, /* smdrs32 */
+	{ 1851, 22 }, /* smxds32 */
+	{ 1859, 22 }, /* smin32 */
+	{ 1866, 22 }, /* sra32 */
+	{ 1872, 22 }, /* sra32.u */
+	{ 1880, 19 }, /* srai32 */
+	{ 1887, 19 }, /* srai32.u */
+	{ 1896, 19 }, /* sraiw.u */
+	{ 1904, 22 }, /* srl32 */
+	{ 1910, 22 }, /* srl32.u */
+	{ 1918, 19 }, /* srli32 */
+	{ 1925, 19 }, /* srli32.u */
+	{ 1934, 22 }, /* stas32 */
+	{ 1941, 22 }, /* stsa32 */
+	{ 1948, 22 }, /* sub32 */
+	{ 1954, 22 }, /* ukadd32 */
+	{ 1962, 22 }, /* ukcras32 */
+	{ 1971, 22 }, /* ukcrsa32 */
+	{ 1980, 22 }, /* ukstas32 */
+	{ 1989, 22 }, /* ukstsa32 */
+	{ 1998, 22 }, /* uksub32 */
+	{ 2006, 22 }, /* umax32 */
+	{ 2013, 22 }, /* umin32 */
+	{ 2020, 22 }, /* uradd32 */
+	{ 2028, 22 }, /* urcras32 */
+	{ 2037, 22 }, /* urcrsa32 */
+	{ 2046, 22 }, /* urstas32 */
+	{ 2055, 22 }, /* urstsa32 */
+	{ 2064, 22 }, /* ursub32 */
+	{ 2072, 19 }, /* kslli16 */
+	{ 2080, 19 }, /* sclip16 */
+	{ 2088, 19 }, /* slli16 */
+	{ 2095, 19 }, /* srai16 */
+	{ 2102, 19 }, /* srai16.u */
+	{ 2111, 19 }, /* srli16 */
+	{ 2118, 19 }, /* srli16.u */
+	{ 2127, 19 }, /* uclip16 */
+	{ 2135, 19 }, /* insb */
+	{ 2140, 19 }, /* kslli8 */
+	{ 2147, 19 }, /* sclip8 */
+	{ 2154, 19 }, /* slli8 */
+	{ 2160, 19 }, /* srai8 */
+	{ 2166, 19 }, /* srai8.u */
+	{ 2174, 19 }, /* srli8 */
+	{ 2180, 19 }, /* srli8.u */
+	{ 2188, 19 }, /* uclip8 */
+	{ 2195, 19 }, /* clrs8 */
+	{ 2201, 19 }, /* clrs16 */
+	{ 2208, 19 }, /* clrs32 */
+	{ 2215, 19 }, /* clo8 */
+	{ 2220, 19 }, /* clo16 */
+	{ 2226, 19 }, /* clo32 */
+	{ 2232, 19 }, /* clz8 */
+	{ 2237, 19 }, /* clz16 */
+	{ 2243, 19 }, /* clz32 */
+	{ 2249, 19 }, /* kabs8 */
+	{ 2255, 19 }, /* kabs16 */
+	{ 2262, 19 }, /* kabsw */
+	{ 2268, 19 }, /* sunpkd810 */
+	{ 2278, 19 }, /* sunpkd820 */
+	{ 2288, 19 }, /* sunpkd830 */
+	{ 2298, 19 }, /* sunpkd831 */
+	{ 2308, 19 }, /* sunpkd832 */
+	{ 2318, 19 }, /* swap8 */
+	{ 2324, 19 }, /* zunpkd810 */
+	{ 2334, 19 }, /* zunpkd820 */
+	{ 2344, 19 }, /* zunpkd830 */
+	{ 2354, 19 }, /* zunpkd831 */
+	{ 2364, 19 }, /* zunpkd832 */
+	{ 2374, 19 }, /* kabs32 */
+};
+
+const RISCVAnalysis riscv_rvp_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* bpick */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* bitrevi */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srai.u */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* add8 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* add16 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* add64 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ave */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* bitrev */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* cmpeq8 */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* cmpeq16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* cras16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* crsa16 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kadd8 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kadd16 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kadd64 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kaddh */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kaddw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kcras16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kcrsa16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kdmbb */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kdmbt */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kdmtt */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kdmabb */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kdmabt */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kdmatt */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* khm8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* khmx8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* khm16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* khmx16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* khmbb */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* khmbt */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* khmtt */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmabb */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmabt */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmatt */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmada */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmaxda */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmads */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmadrs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmaxds */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmar64 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmda */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmxda */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmac */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmac.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmawb */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmawb.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmawb2 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmawb2.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmawt */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmawt.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmawt2 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmawt2.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmsb */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmsb.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmwb2 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmwb2.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmwt2 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmmwt2.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmsda */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmsxda */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmsr64 */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ksllw */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kslliw */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ksll8 */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ksll16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kslra8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kslra8.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kslra16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kslra16.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kslraw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kslraw.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kstas16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kstsa16 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ksub8 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ksub16 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ksub64 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ksubh */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ksubw */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kwmmul */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kwmmul.u */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* maddr32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* maxw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* minw */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* msubr32 */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* mulr64 */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* mulsr64 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* pbsad */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* pbsada */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* pkbb16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* pkbt16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* pktt16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* pktb16 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* radd8 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* radd16 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* radd64 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* raddw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rcras16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rcrsa16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rstas16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rstsa16 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rsub8 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rsub16 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rsub64 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rsubw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sclip32 */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* scmple8 */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* scmple16 */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* scmplt8 */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* scmplt16 */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sll8 */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sll16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smal */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smalbb */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smalbt */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smaltt */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smalda */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smalxda */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smalds */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smaldrs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smalxds */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smar64 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smaqa */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smaqa.su */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smax8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smax16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smbb16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smbt16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smtt16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smds */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smdrs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smxds */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smin8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smin16 */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smmul */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smmul.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smmwb */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smmwb.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smmwt */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smmwt.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smslda */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smslxda */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smsr64 */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smul8 */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smulx8 */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smul16 */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smulx16 */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sra.u */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sra8 */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sra8.u */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sra16 */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sra16.u */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srl8 */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srl8.u */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srl16 */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srl16.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* stas16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* stsa16 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sub8 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sub16 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sub64 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uclip32 */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ucmple8 */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ucmple16 */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ucmplt8 */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ucmplt16 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukadd8 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukadd16 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukadd64 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukaddh */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukaddw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukcras16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukcrsa16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukmar64 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukmsr64 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukstas16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukstsa16 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uksub8 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uksub16 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uksub64 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uksubh */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uksubw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umar64 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umaqa */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umax8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umax16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umin8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umin16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umsr64 */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umul8 */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umulx8 */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umul16 */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umulx16 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uradd8 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uradd16 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uradd64 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uraddw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* urcras16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* urcrsa16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* urstas16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* urstsa16 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ursub8 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ursub16 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ursub64 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ursubw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* wexti */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* wext */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* add32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* cras32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* crsa32 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kadd32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kcras32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kcrsa32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kdmbb16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kdmbt16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kdmtt16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kdmabb16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kdmabt16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kdmatt16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* khmbb16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* khmbt16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* khmtt16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmabb32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmabt32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmatt32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmaxda32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmda32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmxda32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmads32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmadrs32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmaxds32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmsda32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kmsxda32 */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ksll32 */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kslli32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kslra32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kslra32.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kstas32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kstsa32 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ksub32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* pkbb32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* pkbt32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* pktt32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* pktb32 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* radd32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rcras32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rcrsa32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rstas32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rstsa32 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* rsub32 */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sll32 */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* slli32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smax32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smbt32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smtt32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smds32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smdrs32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smxds32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* smin32 */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sra32 */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sra32.u */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srai32 */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srai32.u */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sraiw.u */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srl32 */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srl32.u */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srli32 */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srli32.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* stas32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* stsa32 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sub32 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukadd32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukcras32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukcrsa32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukstas32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ukstsa32 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uksub32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umax32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* umin32 */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uradd32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* urcras32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* urcrsa32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* urstas32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* urstsa32 */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* ursub32 */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kslli16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sclip16 */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* slli16 */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srai16 */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srai16.u */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srli16 */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srli16.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uclip16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* insb */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kslli8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sclip8 */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* slli8 */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srai8 */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srai8.u */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srli8 */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* srli8.u */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* uclip8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* clrs8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* clrs16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* clrs32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* clo8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* clo16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* clo32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* clz8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* clz16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* clz32 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kabs8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kabs16 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kabsw */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sunpkd810 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sunpkd820 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sunpkd830 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sunpkd831 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* sunpkd832 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* swap8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* zunpkd810 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* zunpkd820 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* zunpkd830 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* zunpkd831 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* zunpkd832 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_MMX, RZ_TYPE_COND_AL, 0 }, /* kabs32 */
+};
@@ -0,0 +1,1390 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* rvv, RISCV_INS_VLUXEI8_V to RISCV_INS_VSE1_V */
+const char riscv_rvv_names[] =
+	"vluxei8.v\0"
+	"vluxei16.v\0"
+	"vluxei32.v\0"
+	"vluxei64.v\0"
+	"vluxei128.v\0"
+	"vluxei256.v\0"
+	"vluxei512.v\0"
+	"vluxei1024.v\0"
+	"vsuxei8.v\0"
+	"vsuxei16.v\0"
+	"vsuxei32.v\0"
+	"vsuxei64.v\0"
+	"vsuxei128.v\0"
+	"vsuxei256.v\0"
+	"vsuxei512.v\0"
+	"vsuxei1024.v\0"
+	"vlse8.v\0"
+	"vlse16.v\0"
+	"vlse32.v\0"
+	"vlse64.v\0"
+	"vlse128.v\0"
+	"vlse256.v\0"
+	"vlse512.v\0"
+	"vlse1024.v\0"
+	"vsse8.v\0"
+	"vsse16.v\0"
+	"vsse32.v\0"
+	"vsse64.v\0"
+	"vsse128.v\0"
+	"vsse256.v\0"
+	"vsse512.v\0"
+	"vsse1024.v\0"
+	"vloxei8.v\0"
+	"vloxei16.v\0"
+	"vloxei32.v\0"
+	"vloxei64.v\0"
+	"vloxei128.v\0"
+	"vloxei256.v\0"
+	"vloxei512.v\0"
+	"vloxei1024.v\0"
+	"vsoxei8.v\0"
+	"vsoxei16.v\0"
+	"vsoxei32.v\0"
+	"vsoxei64.v\0"
+	"vsoxei128.v\0"
+	"vsoxei256.v\0"
+	"vsoxei512.v\0"
+	"vsoxei1024.v\0"
+	"vle8.v\0"
+	"vle16.v\0"
+	"vle32.v\0"
+	"vle64.v\0"
+	"vle128.v\0"
+	"vle256.v\0"
+	"vle512.v\0"
+	"vle1024.v\0"
+	"vse8.v\0"
+	"vse16.v\0"
+	"vse32.v\0"
+	"vse64.v\0"
+	"vse128.v\0"
+	"vse256.v\0"
+	"vse512.v\0"
+	"vse1024.v\0"
+	"vle8ff.v\0"
+	"vle16ff.v\0"
+	"vle32ff.v\0"
+	"vle64ff.v\0"
+	"vle128ff.v\0"
+	"vle256ff.v\0"
+	"vle512ff.v\0"
+	"vle1024ff.v\0"
+	"vsetvli\0"
+	"vsetivli\0"
+	"vamoswapei8.v\0"
+	"vamoaddei8.v\0"
+	"vamoxorei8.v\0"
+	"vamoandei8.v\0"
+	"vamoorei8.v\0"
+	"vamominei8.v\0"
+	"vamomaxei8.v\0"
+	"vamominuei8.v\0"
+	"vamomaxuei8.v\0"
+	"vamoswapei16.v\0"
+	"vamoaddei16.v\0"
+	"vamoxorei16.v\0"
+	"vamoandei16.v\0"
+	"vamoorei16.v\0"
+	"vamominei16.v\0"
+	"vamomaxei16.v\0"
+	"vamominuei16.v\0"
+	"vamomaxuei16.v\0"
+	"vamoswapei32.v\0"
+	"vamoaddei32.v\0"
+	"vamoxorei32.v\0"
+	"vamoandei32.v\0"
+	"vamoorei32.v\0"
+	"vamominei32.v\0"
+	"vamomaxei32.v\0"
+	"vamominuei32.v\0"
+	"vamomaxuei32.v\0"
+	"vamoswapei64.v\0"
+	"vamoaddei64.v\0"
+	"vamoxorei64.v\0"
+	"vamoandei64.v\0"
+	"vamoorei64.v\0"
+	"vamominei64.v\0"
+	"vamomaxei64.v\0"
+	"vamominuei64.v\0"
+	"vamomaxuei64.v\0"
+	"vfadd.vf\0"
+	"vfsub.vf\0"
+	"vfmin.vf\0"
+	"vfmax.vf\0"
+	"vfsgnj.vf\0"
+	"vfsgnjn.vf\0"
+	"vfsgnjx.vf\0"
+	"vfslide1up.vf\0"
+	"vfslide1down.vf\0"
+	"vmfeq.vf\0"
+	"vmfle.vf\0"
+	"vmflt.vf\0"
+	"vmfne.vf\0"
+	"vmfgt.vf\0"
+	"vmfge.vf\0"
+	"vfdiv.vf\0"
+	"vfrdiv.vf\0"
+	"vfmul.vf\0"
+	"vfrsub.vf\0"
+	"vfmadd.vf\0"
+	"vfnmadd.vf\0"
+	"vfmsub.vf\0"
+	"vfnmsub.vf\0"
+	"vfmacc.vf\0"
+	"vfnmacc.vf\0"
+	"vfmsac.vf\0"
+	"vfnmsac.vf\0"
+	"vfwadd.vf\0"
+	"vfwsub.vf\0"
+	"vfwadd.wf\0"
+	"vfwsub.wf\0"
+	"vfwmul.vf\0"
+	"vfwmacc.vf\0"
+	"vfwnmacc.vf\0"
+	"vfwmsac.vf\0"
+	"vfwnmsac.vf\0"
+	"vfadd.vv\0"
+	"vfredusum.vs\0"
+	"vfsub.vv\0"
+	"vfredosum.vs\0"
+	"vfmin.vv\0"
+	"vfredmin.vs\0"
+	"vfmax.vv\0"
+	"vfredmax.vs\0"
+	"vfsgnj.vv\0"
+	"vfsgnjn.vv\0"
+	"vfsgnjx.vv\0"
+	"vmfeq.vv\0"
+	"vmfle.vv\0"
+	"vmflt.vv\0"
+	"vmfne.vv\0"
+	"vfdiv.vv\0"
+	"vfmul.vv\0"
+	"vfmadd.vv\0"
+	"vfnmadd.vv\0"
+	"vfmsub.vv\0"
+	"vfnmsub.vv\0"
+	"vfmacc.vv\0"
+	"vfnmacc.vv\0"
+	"vfmsac.vv\0"
+	"vfnmsac.vv\0"
+	"vfwadd.vv\0"
+	"vfwredusum.vs\0"
+	"vfwsub.vv\0"
+	"vfwredosum.vs\0"
+	"vfwadd.wv\0"
+	"vfwsub.wv\0"
+	"vfwmul.vv\0"
+	"vfwmacc.vv\0"
+	"vfwnmacc.vv\0"
+	"vfwmsac.vv\0"
+	"vfwnmsac.vv\0"
+	"vadd.vx\0"
+	"vsub.vx\0"
+	"vrsub.vx\0"
+	"vminu.vx\0"
+	"vmin.vx\0"
+	"vmaxu.vx\0"
+	"vmax.vx\0"
+	"vand.vx\0"
+	"vor.vx\0"
+	"vxor.vx\0"
+	"vrgather.vx\0"
+	"vslideup.vx\0"
+	"vslidedown.vx\0"
+	"vmseq.vx\0"
+	"vmsne.vx\0"
+	"vmsltu.vx\0"
+	"vmslt.vx\0"
+	"vmsleu.vx\0"
+	"vmsle.vx\0"
+	"vmsgtu.vx\0"
+	"vmsgt.vx\0"
+	"vsaddu.vx\0"
+	"vsadd.vx\0"
+	"vssubu.vx\0"
+	"vssub.vx\0"
+	"vsll.vx\0"
+	"vsmul.vx\0"
+	"vsrl.vx\0"
+	"vsra.vx\0"
+	"vssrl.vx\0"
+	"vssra.vx\0"
+	"vnsrl.wx\0"
+	"vnsra.wx\0"
+	"vnclipu.wx\0"
+	"vnclip.wx\0"
+	"vadd.vv\0"
+	"vsub.vv\0"
+	"vminu.vv\0"
+	"vmin.vv\0"
+	"vmaxu.vv\0"
+	"vmax.vv\0"
+	"vand.vv\0"
+	"vor.vv\0"
+	"vxor.vv\0"
+	"vrgather.vv\0"
+	"vrgatherei16.vv\0"
+	"vmseq.vv\0"
+	"vmsne.vv\0"
+	"vmsltu.vv\0"
+	"vmslt.vv\0"
+	"vmsleu.vv\0"
+	"vmsle.vv\0"
+	"vsaddu.vv\0"
+	"vsadd.vv\0"
+	"vssubu.vv\0"
+	"vssub.vv\0"
+	"vsll.vv\0"
+	"vsmul.vv\0"
+	"vsrl.vv\0"
+	"vsra.vv\0"
+	"vssrl.vv\0"
+	"vssra.vv\0"
+	"vnsrl.wv\0"
+	"vnsra.wv\0"
+	"vnclipu.wv\0"
+	"vnclip.wv\0"
+	"vwredsumu.vs\0"
+	"vwredsum.vs\0"
+	"vadd.vi\0"
+	"vrsub.vi\0"
+	"vand.vi\0"
+	"vor.vi\0"
+	"vxor.vi\0"
+	"vrgather.vi\0"
+	"vslideup.vi\0"
+	"vslidedown.vi\0"
+	"vmseq.vi\0"
+	"vmsne.vi\0"
+	"vmsleu.vi\0"
+	"vmsle.vi\0"
+	"vmsgtu.vi\0"
+	"vmsgt.vi\0"
+	"vsaddu.vi\0"
+	"vsadd.vi\0"
+	"vsll.vi\0"
+	"vsrl.vi\0"
+	"vsra.vi\0"
+	"vssrl.vi\0"
+	"vssra.vi\0"
+	"vnsrl.wi\0"
+	"vnsra.wi\0"
+	"vnclipu.wi\0"
+	"vnclip.wi\0"
+	"vredsum.vs\0"
+	"vredand.vs\0"
+	"vredor.vs\0"
+	"vredxor.vs\0"
+	"vredminu.vs\0"
+	"vredmin.vs\0"
+	"vredmaxu.vs\0"
+	"vredmax.vs\0"
+	"vaaddu.vv\0"
+	"vaadd.vv\0"
+	"vasubu.vv\0"
+	"vasub.vv\0"
+	"vmandn.mm\0"
+	"vmand.mm\0"
+	"vmor.mm\0"
+	"vmxor.mm\0"
+	"vmorn.mm\0"
+	"vmnand.mm\0"
+	"vmnor.mm\0"
+	"vmxnor.mm\0"
+	"vdivu.vv\0"
+	"vdiv.vv\0"
+	"vremu.vv\0"
+	"vrem.vv\0"
+	"vmulhu.vv\0"
+	"vmul.vv\0"
+	"vmulhsu.vv\0"
+	"vmulh.vv\0"
+	"vmadd.vv\0"
+	"vnmsub.vv\0"
+	"vmacc.vv\0"
+	"vnmsac.vv\0"
+	"vwaddu.vv\0"
+	"vwadd.vv\0"
+	"vwsubu.vv\0"
+	"vwsub.vv\0"
+	"vwaddu.wv\0"
+	"vwadd.wv\0"
+	"vwsubu.wv\0"
+	"vwsub.wv\0"
+	"vwmulu.vv\0"
+	"vwmulsu.vv\0"
+	"vwmul.vv\0"
+	"vwmaccu.vv\0"
+	"vwmacc.vv\0"
+	"vwmaccsu.vv\0"
+	"vaaddu.vx\0"
+	"vaadd.vx\0"
+	"vasubu.vx\0"
+	"vasub.vx\0"
+	"vslide1up.vx\0"
+	"vslide1down.vx\0"
+	"vdivu.vx\0"
+	"vdiv.vx\0"
+	"vremu.vx\0"
+	"vrem.vx\0"
+	"vmulhu.vx\0"
+	"vmul.vx\0"
+	"vmulhsu.vx\0"
+	"vmulh.vx\0"
+	"vmadd.vx\0"
+	"vnmsub.vx\0"
+	"vmacc.vx\0"
+	"vnmsac.vx\0"
+	"vwaddu.vx\0"
+	"vwadd.vx\0"
+	"vwsubu.vx\0"
+	"vwsub.vx\0"
+	"vwaddu.wx\0"
+	"vwadd.wx\0"
+	"vwsubu.wx\0"
+	"vwsub.wx\0"
+	"vwmulu.vx\0"
+	"vwmulsu.vx\0"
+	"vwmul.vx\0"
+	"vwmaccu.vx\0"
+	"vwmacc.vx\0"
+	"vwmaccus.vx\0"
+	"vwmaccsu.vx\0"
+	"vfredsum.vs\0"
+	"vfwredsum.vs\0"
+	"vmornot.mm\0"
+	"vmandnot.mm\0"
+	"vfcvt.xu.f.v\0"
+	"vfcvt.x.f.v\0"
+	"vfcvt.f.xu.v\0"
+	"vfcvt.f.x.v\0"
+	"vfcvt.rtz.xu.f.v\0"
+	"vfcvt.rtz.x.f.v\0"
+	"vfwcvt.xu.f.v\0"
+	"vfwcvt.x.f.v\0"
+	"vfwcvt.f.xu.v\0"
+	"vfwcvt.f.x.v\0"
+	"vfwcvt.f.f.v\0"
+	"vfwcvt.rtz.xu.f.v\0"
+	"vfwcvt.rtz.x.f.v\0"
+	"vfncvt.xu.f.w\0"
+	"vfncvt.x.f.w\0"
+	"vfncvt.f.xu.w\0"
+	"vfncvt.f.x.w\0"
+	"vfncvt.f.f.w\0"
+	"vfncvt.rod.f.f.w\0"
+	"vfncvt.rtz.xu.f.w\0"
+	"vfncvt.rtz.x.f.w\0"
+	"vfsqrt.v\0"
+	"vfrsqrt7.v\0"
+	"vfrec7.v\0"
+	"vfclass.v\0"
+	"vzext.vf8\0"
+	"vsext.vf8\0"
+	"vzext.vf4\0"
+	"vsext.vf4\0"
+	"vzext.vf2\0"
+	"vsext.vf2\0"
+	"vmsbf.m\0"
+	"vmsof.m\0"
+	"vmsif.m\0"
+	"viota.m\0"
+	"vcpop.m\0"
+	"vfirst.m\0"
+	"vpopc.m\0"
+	"vid.v\0"
+	"vsetvl\0"
+	"vfmerge.vfm\0"
+	"vadc.vxm\0"
+	"vmadc.vxm\0"
+	"vmadc.vx\0"
+	"vsbc.vxm\0"
+	"vmsbc.vxm\0"
+	"vmsbc.vx\0"
+	"vmerge.vxm\0"
+	"vadc.vvm\0"
+	"vmadc.vvm\0"
+	"vmadc.vv\0"
+	"vsbc.vvm\0"
+	"vmsbc.vvm\0"
+	"vmsbc.vv\0"
+	"vmerge.vvm\0"
+	"vadc.vim\0"
+	"vmadc.vim\0"
+	"vmadc.vi\0"
+	"vmerge.vim\0"
+	"vcompress.vm\0"
+	"vmvnfr.v\0"
+	"vfmv.f.s\0"
+	"vmv1r.v\0"
+	"vmv2r.v\0"
+	"vmv4r.v\0"
+	"vmv8r.v\0"
+	"vmv.x.s\0"
+	"vlm.v\0"
+	"vsm.v\0"
+	"vl1re8.v\0"
+	"vl1re16.v\0"
+	"vl1re32.v\0"
+	"vl1re64.v\0"
+	"vl2re8.v\0"
+	"vl2re16.v\0"
+	"vl2re32.v\0"
+	"vl2re64.v\0"
+	"vl4re8.v\0"
+	"vl4re16.v\0"
+	"vl4re32.v\0"
+	"vl4re64.v\0"
+	"vl8re8.v\0"
+	"vl8re16.v\0"
+	"vl8re32.v\0"
+	"vl8re64.v\0"
+	"vs1r.v\0"
+	"vs2r.v\0"
+	"vs4r.v\0"
+	"vs8r.v\0"
+	"vfmv.s.f\0"
+	"vfmv.v.f\0"
+	"vmv.v.x\0"
+	"vmv.v.v\0"
+	"vmv.v.i\0"
+	"vmv.s.x\0"
+	"vl1r.v\0"
+	"vl2r.v\0"
+	"vl4r.v\0"
+	"vl8r.v\0"
+	"vle1.v\0"
+	"vse1.v\0";
+
+const RISCVDescription riscv_rvv_descriptions[] = {
+	{ 0, 42 }, /* vluxei8.v */
+	{ 10, 42 }, /* vluxei16.v */
+	{ 21, 42 }, /* vluxei32.v */
+	{ 32, 42 }, /* vluxei64.v */
+	{ 43, 42 }, /* vluxei128.v */
+	{ 55, 42 }, /* vluxei256.v */
+	{ 67, 42 }, /* vluxei512.v */
+	{ 79, 42 }, /* vluxei1024.v */
+	{ 92, 43 }, /* vsuxei8.v */
+	{ 102, 43 }, /* vsuxei16.v */
+	{ 113, 43 }, /* vsuxei32.v */
+	{ 124, 43 }, /* vsuxei64.v */
+	{ 135, 43 }, /* vsuxei128.v */
+	{ 147, 43 }, /* vsuxei256.v */
+	{ 159, 43 }, /* vsuxei512.v */
+	{ 171, 43 }, /* vsuxei1024.v */
+	{ 184, 38 }, /* vlse8.v */
+	{ 192, 38 }, /* vlse16.v */
+	{ 201, 38 }, /* vlse32.v */
+	{ 210, 38 }, /* vlse64.v */
+	{ 219, 38 }, /* vlse128.v */
+	{ 229, 38 }, /* vlse256.v */
+	{ 239, 38 }, /* vlse512.v */
+	{ 249, 38 }, /* vlse1024.v */
+	{ 260, 45 }, /* vsse8.v */
+	{ 268, 45 }, /* vsse16.v */
+	{ 277, 45 }, /* vsse32.v */
+	{ 286, 45 }, /* vsse64.v */
+	{ 295, 45 }, /* vsse128.v */
+	{ 305, 45 }, /* vsse256.v */
+	{ 315, 45 }, /* vsse512.v */
+	{ 325, 45 }, /* vsse1024.v */
+	{ 336, 42 }, /* vloxei8.v */
+	{ 346, 42 }, /* vloxei16.v */
+	{ 357, 42 }, /* vloxei32.v */
+	{ 368, 42 }, /* vloxei64.v */
+	{ 379, 42 }, /* vloxei128.v */
+	{ 391, 42 }, /* vloxei256.v */
+	{ 403, 42 }, /* vloxei512.v */
+	{ 415, 42 }, /* vloxei1024.v */
+	{ 428, 43 }, /* vsoxei8.v */
+	{ 438, 43 }, /* vsoxei16.v */
+	{ 449, 43 }, /* vsoxei32.v */
+	{ 460, 43 }, /* vsoxei64.v */
+	{ 471, 43 }, /* vsoxei128.v */
+	{ 483, 43 }, /* vsoxei256.v */
+	{ 495, 43 }, /* vsoxei512.v */
+	{ 507, 43 }, /* vsoxei1024.v */
+	{ 520, 37 }, /* vle8.v */
+	{ 527, 37 }, /* vle16.v */
+	{ 535, 37 }, /* vle32.v */
+	{ 543, 37 }, /* vle64.v */
+	{ 551, 37 }, /* vle128.v */
+	{ 560, 37 }, /* vle256.v */
+	{ 569, 37 }, /* vle512.v */
+	{ 578, 37 }, /* vle1024.v */
+	{ 588, 44 }, /* vse8.v */
+	{ 595, 44 }, /* vse16.v */
+	{ 603, 44 }, /* vse32.v */
+	{ 611, 44 }, /* vse64.v */
+	{ 619, 44 }, /* vse128.v */
+	{ 628, 44 }, /* vse256.v */
+	{ 637, 44 }, /* vse512.v */
+	{ 646, 44 }, /* vse1024.v */
+	{ 656, 37 }, /* vle8ff.v */
+	{ 665, 37 }, /* vle16ff.v */
+	{ 675, 37 }, /* vle32ff.v */
+	{ 685, 37 }, /* vle64ff.v */
+	{ 695, 37 }, /* vle128ff.v */
+	{ 706, 37 }, /* vle256ff.v */
+	{ 717, 37 }, /* vle512ff.v */
+	{ 728, 37 }, /* vle1024ff.v */
+	{ 740, 19 }, /* vsetvli */
+	{ 748, 10 }, /* vsetivli */
+	{ 757, 46 }, /* vamoswapei8.v */
+	{ 771, 46 }, /* vamoaddei8.v */
+	{ 784, 46 }, /* vamoxorei8.v */
+	{ 797, 46 }, /* vamoandei8.v */
+	{ 810, 46 }, /* vamoorei8.v */
+	{ 822, 46 }, /* vamominei8.v */
+	{ 835, 46 }, /* vamomaxei8.v */
+	{ 848, 46 }, /* vamominuei8.v */
+	{ 862, 46 }, /* vamomaxuei8.v */
+	{ 876, 46 }, /* vamoswapei16.v */
+	{ 891, 46 }, /* vamoaddei16.v */
+	{ 905, 46 }, /* vamoxorei16.v */
+	{ 919, 46 }, /* vamoandei16.v */
+	{ 933, 46 }, /* vamoorei16.v */
+	{ 946, 46 }, /* vamominei16.v */
+	{ 960, 46 }, /* vamomaxei16.v */
+	{ 974, 46 }, /* vamominuei16.v */
+	{ 989, 46 }, /* vamomaxuei16.v */
+	{ 1004, 46 }, /* vamoswapei32.v */
+	{ 1019, 46 }, /* vamoaddei32.v */
+	{ 1033, 46 }, /* vamoxorei32.v */
+	{ 1047, 46 }, /* vamoandei32.v */
+	{ 1061, 46 }, /* vamoorei32.v */
+	{ 1074, 46 }, /* vamominei32.v */
+	{ 1088, 46 }, /* vamomaxei32.v */
+	{ 1102, 46 }, /* vamominuei32.v */
+	{ 1117, 46 }, /* vamomaxuei32.v */
+	{ 1132, 46 }, /* vamoswapei64.v */
+	{ 1147, 46 }, /* vamoaddei64.v */
+	{ 1161, 46 }, /* vamoxorei64.v */
+	{ 1175, 46 }, /* vamoandei64.v */
+	{ 1189, 46 }, /* vamoorei64.v */
+	{ 1202, 46 }, /* vamominei64.v */
+	{ 1216, 46 }, /* vamomaxei64.v */
+	{ 1230, 46 }, /* vamominuei64.v */
+	{ 1245, 46 }, /* vamomaxuei64.v */
+	{ 1260, 42 }, /* vfadd.vf */
+	{ 1269, 42 }, /* vfsub.vf */
+	{ 1278, 42 }, /* vfmin.vf */
+	{ 1287, 42 }, /* vfmax.vf */
+	{ 1296, 42 }, /* vfsgnj.vf */
+	{ 1306, 42 }, /* vfsgnjn.vf */
+	{ 1317, 42 }, /* vfsgnjx.vf */
+	{ 1328, 42 }, /* vfslide1up.vf */
+	{ 1342, 42 }, /* vfslide1down.vf */
+	{ 1358, 42 }, /* vmfeq.vf */
+	{ 1367, 42 }, /* vmfle.vf */
+	{ 1376, 42 }, /* vmflt.vf */
+	{ 1385, 42 }, /* vmfne.vf */
+	{ 1394, 42 }, /* vmfgt.vf */
+	{ 1403, 42 }, /* vmfge.vf */
+	{ 1412, 42 }, /* vfdiv.vf */
+	{ 1421, 42 }, /* vfrdiv.vf */
+	{ 1431, 42 }, /* vfmul.vf */
+	{ 1440, 42 }, /* vfrsub.vf */
+	{ 1450, 42 }, /* vfmadd.vf */
+	{ 1460, 42 }, /* vfnmadd.vf */
+	{ 1471, 42 }, /* vfmsub.vf */
+	{ 1481, 42 }, /* vfnmsub.vf */
+	{ 1492, 42 }, /* vfmacc.vf */
+	{ 1502, 42 }, /* vfnmacc.vf */
+	{ 1513, 42 }, /* vfmsac.vf */
+	{ 1523, 42 }, /* vfnmsac.vf */
+	{ 1534, 42 }, /* vfwadd.vf */
+	{ 1544, 42 }, /* vfwsub.vf */
+	{ 1554, 42 }, /* vfwadd.wf */
+	{ 1564, 42 }, /* vfwsub.wf */
+	{ 1574, 42 }, /* vfwmul.vf */
+	{ 1584, 42 }, /* vfwmacc.vf */
+	{ 1595, 42 }, /* vfwnmacc.vf */
+	{ 1607, 42 }, /* vfwmsac.vf */
+	{ 1618, 42 }, /* vfwnmsac.vf */
+	{ 1630, 40 }, /* vfadd.vv */
+	{ 1639, 40 }, /* vfredusum.vs */
+	{ 1652, 40 }, /* vfsub.vv */
+	{ 1661, 40 }, /* vfredosum.vs */
+	{ 1674, 40 }, /* vfmin.vv */
+	{ 1683, 40 }, /* vfredmin.vs */
+	{ 1695, 40 }, /* vfmax.vv */
+	{ 1704, 40 }, /* vfredmax.vs */
+	{ 1716, 40 }, /* vfsgnj.vv */
+	{ 1726, 40 }, /* vfsgnjn.vv */
+	{ 1737, 40 }, /* vfsgnjx.vv */
+	{ 1748, 40 }, /* vmfeq.vv */
+	{ 1757, 40 }, /* vmfle.vv */
+	{ 1766, 40 }, /* vmflt.vv */
+	{ 1775, 40 }, /* vmfne.vv */
+	{ 1784, 40 }, /* vfdiv.vv */
+	{ 1793, 40 }, /* vfmul.vv */
+	{ 1802, 40 }, /* vfmadd.vv */
+	{ 1812, 40 }, /* vfnmadd.vv */
+	{ 1823, 40 }, /* vfmsub.vv */
+	{ 1833, 40 }, /* vfnmsub.vv */
+	{ 1844, 40 }, /* vfmacc.vv */
+	{ 1854, 40 }, /* vfnmacc.vv */
+	{ 1865, 40 }, /* vfmsac.vv */
+	{ 1875, 40 }, /* vfnmsac.vv */
+	{ 1886, 40 }, /* vfwadd.vv */
+	{ 1896, 40 }, /* vfwredusum.vs */
+	{ 1910, 40 }, /* vfwsub.vv */
+	{ 1920, 40 }, /* vfwredosum.vs */
+	{ 1934, 40 }, /* vfwadd.wv */
+	{ 1944, 40 }, /* vfwsub.wv */
+	{ 1954, 40 }, /* vfwmul.vv */
+	{ 1964, 40 }, /* vfwmacc.vv */
+	{ 1975, 40 }, /* vfwnmacc.vv */
+	{ 1987, 40 }, /* vfwmsac.vv */
+	{ 1998, 40 }, /* vfwnmsac.vv */
+	{ 2010, 42 }, /* vadd.vx */
+	{ 2018, 42 }, /* vsub.vx */
+	{ 2026, 42 }, /* vrsub.vx */
+	{ 2035, 42 }, /* vminu.vx */
+	{ 2044, 42 }, /* vmin.vx */
+	{ 2052, 42 }, /* vmaxu.vx */
+	{ 2061, 42 }, /* vmax.vx */
+	{ 2069, 42 }, /* vand.vx */
+	{ 2077, 42 }, /* vor.vx */
+	{ 2084, 42 }, /* vxor.vx */
+	{ 2092, 42 }, /* vrgather.vx */
+	{ 2104, 42 }, /* vslideup.vx */
+	{ 2116, 42 }, /* vslidedown.vx */
+	{ 2130, 42 }, /* vmseq.vx */
+	{ 2139, 42 }, /* vmsne.vx */
+	{ 2148, 42 }, /* vmsltu.vx */
+	{ 2158, 42 }, /* vmslt.vx */
+	{ 2167, 42 }, /* vmsleu.vx */
+	{ 2177, 42 }, /* vmsle.vx */
+	{ 2186, 42 }, /* vmsgtu.vx */
+	{ 2196, 42 }, /* vmsgt.vx */
+	{ 2205, 42 }, /* vsaddu.vx */
+	{ 2215, 42 }, /* vsadd.vx */
+	{ 2224, 42 }, /* vssubu.vx */
+	{ 2234, 42 }, /* vssub.vx */
+	{ 2243, 42 }, /* vsll.vx */
+	{ 2251, 42 }, /* vsmul.vx */
+	{ 2260, 42 }, /* vsrl.vx */
+	{ 2268, 42 }, /* vsra.vx */
+	{ 2276, 42 }, /* vssrl.vx */
+	{ 2285, 42 }, /* vssra.vx */
+	{ 2294, 42 }, /* vnsrl.wx */
+	{ 2303, 42 }, /* vnsra.wx */
+	{ 2312, 42 }, /* vnclipu.wx */
+	{ 2323, 42 }, /* vnclip.wx */
+	{ 2333, 40 }, /* vadd.vv */
+	{ 2341, 40 }, /* vsub.vv */
+	{ 2349, 40 }, /* vminu.vv */
+	{ 2358, 40 }, /* vmin.vv */
+	{ 2366, 40 }, /* vmaxu.vv */
+	{ 2375, 40 }, /* vmax.vv */
+	{ 2383, 40 }, /* vand.vv */
+	{ 2391, 40 }, /* vor.vv */
+	{ 2398, 40 }, /* vxor.vv */
+	{ 2406, 40 }, /* vrgather.vv */
+	{ 2418, 40 }, /* vrgatherei16.vv */
+	{ 2434, 40 }, /* vmseq.vv */
+	{ 2443, 40 }, /* vmsne.vv */
+	{ 2452, 40 }, /* vmsltu.vv */
+	{ 2462, 40 }, /* vmslt.vv */
+	{ 2471, 40 }, /* vmsleu.vv */
+	{ 2481, 40 }, /* vmsle.vv */
+	{ 2490, 40 }, /* vsaddu.vv */
+	{ 2500, 40 }, /* vsadd.vv */
+	{ 2509, 40 }, /* vssubu.vv */
+	{ 2519, 40 }, /* vssub.vv */
+	{ 2528, 40 }, /* vsll.vv */
+	{ 2536, 40 }, /* vsmul.vv */
+	{ 2545, 40 }, /* vsrl.vv */
+	{ 2553, 40 }, /* vsra.vv */
+	{ 2561, 40 }, /* vssrl.vv */
+	{ 2570, 40 }, /* vssra.vv */
+	{ 2579, 40 }, /* vnsrl.wv */
+	{ 2588, 40 }, /* vnsra.wv */
+	{ 2597, 40 }, /* vnclipu.wv */
+	{ 2608, 40 }, /* vnclip.wv */
+	{ 2618, 40 }, /* vwredsumu.vs */
+	{ 2631, 40 }, /* vwredsum.vs */
+	{ 2643, 41 }, /* vadd.vi */
+	{ 2651, 41 }, /* vrsub.vi */
+	{ 2660, 41 }, /* vand.vi */
+	{ 2668, 41 }, /* vor.vi */
+	{ 2675, 41 }, /* vxor.vi */
+	{ 2683, 41 }, /* vrgather.vi */
+	{ 2695, 41 }, /* vslideup.vi */
+	{ 2707, 41 }, /* vslidedown.vi */
+	{ 2721, 41 }, /* vmseq.vi */
+	{ 2730, 41 }, /* vmsne.vi */
+	{ 2739, 41 }, /* vmsleu.vi */
+	{ 2749, 41 }, /* vmsle.vi */
+	{ 2758, 41 }, /* vmsgtu.vi */
+	{ 2768, 41 }, /* vmsgt.vi */
+	{ 2777, 41 }, /* vsaddu.vi */
+	{ 2787, 41 }, /* vsadd.vi */
+	{ 2796, 41 }, /* vsll.vi */
+	{ 2804, 41 }, /* vsrl.vi */
+	{ 2812, 41 }, /* vsra.vi */
+	{ 2820, 41 }, /* vssrl.vi */
+	{ 2829, 41 }, /* vssra.vi */
+	{ 2838, 41 }, /* vnsrl.wi */
+	{ 2847, 41 }, /* vnsra.wi */
+	{ 2856, 41 }, /* vnclipu.wi */
+	{ 2867, 41 }, /* vnclip.wi */
+	{ 2877, 40 }, /* vredsum.vs */
+	{ 2888, 40 }, /* vredand.vs */
+	{ 2899, 40 }, /* vredor.vs */
+	{ 2909, 40 }, /* vredxor.vs */
+	{ 2920, 40 }, /* vredminu.vs */
+	{ 2932, 40 }, /* vredmin.vs */
+	{ 2943, 40 }, /* vredmaxu.vs */
+	{ 2955, 40 }, /* vredmax.vs */
+	{ 2966, 40 }, /* vaaddu.vv */
+	{ 2976, 40 }, /* vaadd.vv */
+	{ 2985, 40 }, /* vasubu.vv */
+	{ 2995, 40 }, /* vasub.vv */
+	{ 3004, 40 }, /* vmandn.mm */
+	{ 3014, 40 }, /* vmand.mm */
+	{ 3023, 40 }, /* vmor.mm */
+	{ 3031, 40 }, /* vmxor.mm */
+	{ 3040, 40 }, /* vmorn.mm */
+	{ 3049, 40 }, /* vmnand.mm */
+	{ 3059, 40 }, /* vmnor.mm */
+	{ 3068, 40 }, /* vmxnor.mm */
+	{ 3078, 40 }, /* vdivu.vv */
+	{ 3087, 40 }, /* vdiv.vv */
+	{ 3095, 40 }, /* vremu.vv */
+	{ 3104, 40 }, /* vrem.vv */
+	{ 3112, 40 }, /* vmulhu.vv */
+	{ 3122, 40 }, /* vmul.vv */
+	{ 3130, 40 }, /* vmulhsu.vv */
+	{ 3141, 40 }, /* vmulh.vv */
+	{ 3150, 40 }, /* vmadd.vv */
+	{ 3159, 40 }, /* vnmsub.vv */
+	{ 3169, 40 }, /* vmacc.vv */
+	{ 3178, 40 }, /* vnmsac.vv */
+	{ 3188, 40 }, /* vwaddu.vv */
+	{ 3198, 40 }, /* vwadd.vv */
+	{ 3207, 40 }, /* vwsubu.vv */
+	{ 3217, 40 }, /* vwsub.vv */
+	{ 3226, 40 }, /* vwaddu.wv */
+	{ 3236, 40 }, /* vwadd.wv */
+	{ 3245, 40 }, /* vwsubu.wv */
+	{ 3255, 40 }, /* vwsub.wv */
+	{ 3264, 40 }, /* vwmulu.vv */
+	{ 3274, 40 }, /* vwmulsu.vv */
+	{ 3285, 40 }, /* vwmul.vv */
+	{ 3294, 40 }, /* vwmaccu.vv */
+	{ 3305, 40 }, /* vwmacc.vv */
+	{ 3315, 40 }, /* vwmaccsu.vv */
+	{ 3327, 42 }, /* vaaddu.vx */
+	{ 3337, 42 }, /* vaadd.vx */
+	{ 3346, 42 }, /* vasubu.vx */
+	{ 3356, 42 }, /* vasub.vx */
+	{ 3365, 42 }, /* vslide1up.vx */
+	{ 3378, 42 }, /* vslide1down.vx */
+	{ 3393, 42 }, /* vdivu.vx */
+	{ 3402, 42 }, /* vdiv.vx */
+	{ 3410, 42 }, /* vremu.vx */
+	{ 3419, 42 }, /* vrem.vx */
+	{ 3427, 42 }, /* vmulhu.vx */
+	{ 3437, 42 }, /* vmul.vx */
+	{ 3445, 42 }, /* vmulhsu.vx */
+	{ 3456, 42 }, /* vmulh.vx */
+	{ 3465, 42 }, /* vmadd.vx */
+	{ 3474, 42 }, /* vnmsub.vx */
+	{ 3484, 42 }, /* vmacc.vx */
+	{ 3493, 42 }, /* vnmsac.vx */
+	{ 3503, 42 }, /* vwaddu.vx */
+	{ 3513, 42 }, /* vwadd.vx */
+	{ 3522, 42 }, /* vwsubu.vx */
+	{ 3532, 42 }, /* vwsub.vx */
+	{ 3541, 42 }, /* vwaddu.wx */
+	{ 3551, 42 }, /* vwadd.wx */
+	{ 3560, 42 }, /* vwsubu.wx */
+	{ 3570, 42 }, /* vwsub.wx */
+	{ 3579, 42 }, /* vwmulu.vx */
+	{ 3589, 42 }, /* vwmulsu.vx */
+	{ 3600, 42 }, /* vwmul.vx */
+	{ 3609, 42 }, /* vwmaccu.vx */
+	{ 3620, 42 }, /* vwmacc.vx */
+	{ 3630, 42 }, /* vwmaccus.vx */
+	{ 3642, 42 }, /* vwmaccsu.vx */
+	{ 3654, 40 }, /* vfredsum.vs */
+	{ 3666, 40 }, /* vfwredsum.vs */
+	{ 3679, 40 }, /* vmornot.mm */
+	{ 3690, 40 }, /* vmandnot.mm */
+	{ 3702, 41 }, /* vfcvt.xu.f.v */
+	{ 3715, 41 }, /* vfcvt.x.f.v */
+	{ 3727, 41 }, /* vfcvt.f.xu.v */
+	{ 3740, 41 }, /* vfcvt.f.x.v */
+	{ 3752, 41 }, /* vfcvt.rtz.xu.f.v */
+	{ 3769, 41 }, /* vfcvt.rtz.x.f.v */
+	{ 3785, 41 }, /* vfwcvt.xu.f.v */
+	{ 3799, 41 }, /* vfwcvt.x.f.v */
+	{ 3812, 41 }, /* vfwcvt.f.xu.v */
+	{ 3826, 41 }, /* vfwcvt.f.x.v */
+	{ 3839, 41 }, /* vfwcvt.f.f.v */
+	{ 3852, 41 }, /* vfwcvt.rtz.xu.f.v */
+	{ 3870, 41 }, /* vfwcvt.rtz.x.f.v */
+	{ 3887, 41 }, /* vfncvt.xu.f.w */
+	{ 3901, 41 }, /* vfncvt.x.f.w */
+	{ 3914, 41 }, /* vfncvt.f.xu.w */
+	{ 3928, 41 }, /* vfncvt.f.x.w */
+	{ 3941, 41 }, /* vfncvt.f.f.w */
+	{ 3954, 41 }, /* vfncvt.rod.f.f.w */
+	{ 3971, 41 }, /* vfncvt.rtz.xu.f.w */
+	{ 3989, 41 }, /* vfncvt.rtz.x.f.w */
+	{ 4006, 41 }, /* vfsqrt.v */
+	{ 4015, 41 }, /* vfrsqrt7.v */
+	{ 4026, 41 }, /* vfrec7.v */
+	{ 4035, 41 }, /* vfclass.v */
+	{ 4045, 41 }, /* vzext.vf8 */
+	{ 4055, 41 }, /* vsext.vf8 */
+	{ 4065, 41 }, /* vzext.vf4 */
+	{ 4075, 41 }, /* vsext.vf4 */
+	{ 4085, 41 }, /* vzext.vf2 */
+	{ 4095, 41 }, /* vsext.vf2 */
+	{ 4105, 41 }, /* vmsbf.m */
+	{ 4113, 41 }, /* vmsof.m */
+	{ 4121, 41 }, /* vmsif.m */
+	{ 4129, 41 }, /* viota.m */
+	{ 4137, 30 }, /* vcpop.m */
+	{ 4145, 30 }, /* vfirst.m */
+	{ 4154, 30 }, /* vpopc.m */
+	{ 4162, 36 }, /* vid.v */
+	{ 4168, 22 }, /* vsetvl */
+	{ 4175, 42 }, /* vfmerge.vfm */
+	{ 4187, 42 }, /* vadc.vxm */
+	{ 4196, 42 }, /* vmadc.vxm */
+	{ 4206, 42 }, /* vmadc.vx */
+	{ 4215, 42 }, /* vsbc.vxm */
+	{ 4224, 42 }, /* vmsbc.vxm */
+	{ 4234, 42 }, /* vmsbc.vx */
+	{ 4243, 42 }, /* vmerge.vxm */
+	{ 4254, 40 }, /* vadc.vvm */
+	{ 4263, 40 }, /* vmadc.vvm */
+	{ 4273, 40 }, /* vmadc.vv */
+	{ 4282, 40 }, /* vsbc.vvm */
+	{ 4291, 40 }, /* vmsbc.vvm */
+	{ 4301, 40 }, /* vmsbc.vv */
+	{ 4310, 40 }, /* vmerge.vvm */
+	{ 4321, 41 }, /* vadc.vim */
+	{ 4330, 41 }, /* vmadc.vim */
+	{ 4340, 41 }, /* vmadc.vi */
+	{ 4349, 41 }, /* vmerge.vim */
+	{ 4360, 40 }, /* vcompress.vm */
+	{ 4373, 41 }, /* vmvnfr.v */
+	{ 4382, 30 }, /* vfmv.f.s */
+	{ 4391, 41 }, /* vmv1r.v */
+	{ 4399, 41 }, /* vmv2r.v */
+	{ 4407, 41 }, /* vmv4r.v */
+	{ 4415, 41 }, /* vmv8r.v */
+	{ 4423, 30 }, /* vmv.x.s */
+	{ 4431, 37 }, /* vlm.v */
+	{ 4437, 44 }, /* vsm.v */
+	{ 4443, 37 }, /* vl1re8.v */
+	{ 4452, 37 }, /* vl1re16.v */
+	{ 4462, 37 }, /* vl1re32.v */
+	{ 4472, 37 }, /* vl1re64.v */
+	{ 4482, 37 }, /* vl2re8.v */
+	{ 4491, 37 }, /* vl2re16.v */
+	{ 4501, 37 }, /* vl2re32.v */
+	{ 4511, 37 }, /* vl2re64.v */
+	{ 4521, 37 }, /* vl4re8.v */
+	{ 4530, 37 }, /* vl4re16.v */
+	{ 4540, 37 }, /* vl4re32.v */
+	{ 4550, 37 }, /* vl4re64.v */
+	{ 4560, 37 }, /* vl8re8.v */
+	{ 4569, 37 }, /* vl8re16.v */
+	{ 4579, 37 }, /* vl8re32.v */
+	{ 4589, 37 }, /* vl8re64.v */
+	{ 4599, 44 }, /* vs1r.v */
+	{ 4606, 44 }, /* vs2r.v */
+	{ 4613, 44 }, /* vs4r.v */
+	{ 4620, 44 }, /* vs8r.v */
+	{ 4627, 37 }, /* vfmv.s.f */
+	{ 4636, 37 }, /* vfmv.v.f */
+	{ 4645, 37 }, /* vmv.v.x */
+	{ 4653, 39 }, /* vmv.v.v */
+	{ 4661, 36 }, /* vmv.v.i */
+	{ 4669, 37 }, /* vmv.s.x */
+	{ 4677, 37 }, /* vl1r.v */
+	{ 4684, 37 }, /* vl2r.v */
+	{ 4691, 37 }, /* vl4r.v */
+	{ 4698, 37 }, /* vl8r.v */
+	{ 4705, 37 }, /* vle1.v */
+	{ 4712, 44 }, /* vse1.v */
+};
+
+const RISCVAnalysis riscv_rvv_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vluxei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vluxei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vluxei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vluxei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vluxei128.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vluxei256.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vluxei512.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vluxei1024.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsuxei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsuxei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsuxei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsuxei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsuxei128.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsuxei256.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsuxei512.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsuxei1024.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vlse8.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vlse16.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vlse32.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vlse64.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vlse128.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vlse256.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vlse512.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vlse1024.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsse8.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsse16.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsse32.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsse64.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsse128.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsse256.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsse512.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsse1024.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vloxei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vloxei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vloxei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vloxei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vloxei128.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vloxei256.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vloxei512.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vloxei1024.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsoxei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsoxei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsoxei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsoxei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsoxei128.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsoxei256.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsoxei512.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsoxei1024.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle8.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle16.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle32.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle64.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle128.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle256.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle512.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle1024.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vse8.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vse16.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vse32.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vse64.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vse128.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vse256.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vse512.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vse1024.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle8ff.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle16ff.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle32ff.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle64ff.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle128ff.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle256ff.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle512ff.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle1024ff.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsetvli */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsetivli */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoswapei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoaddei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoxorei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoandei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoorei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamominei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamomaxei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamominuei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamomaxuei8.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoswapei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoaddei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoxorei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoandei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoorei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamominei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamomaxei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamominuei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamomaxuei16.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoswapei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoaddei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoxorei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoandei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoorei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamominei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamomaxei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamominuei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamomaxuei32.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoswapei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoaddei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoxorei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoandei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamoorei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamominei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamomaxei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamominuei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vamomaxuei64.v */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfadd.vf */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfsub.vf */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmin.vf */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmax.vf */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfsgnj.vf */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfsgnjn.vf */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfsgnjx.vf */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfslide1up.vf */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfslide1down.vf */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmfeq.vf */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmfle.vf */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmflt.vf */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmfne.vf */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmfgt.vf */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmfge.vf */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfdiv.vf */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfrdiv.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmul.vf */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfrsub.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmadd.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfnmadd.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmsub.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfnmsub.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmacc.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfnmacc.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmsac.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfnmsac.vf */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwadd.vf */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwsub.vf */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwadd.wf */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwsub.wf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwmul.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwmacc.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwnmacc.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwmsac.vf */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwnmsac.vf */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfadd.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfredusum.vs */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfsub.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfredosum.vs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmin.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfredmin.vs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmax.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfredmax.vs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfsgnj.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfsgnjn.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfsgnjx.vv */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmfeq.vv */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmfle.vv */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmflt.vv */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmfne.vv */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfdiv.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmul.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmadd.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfnmadd.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmsub.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfnmsub.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmacc.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfnmacc.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmsac.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfnmsac.vv */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwadd.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwredusum.vs */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwsub.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwredosum.vs */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwadd.wv */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwsub.wv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwmul.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwmacc.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwnmacc.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwmsac.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwnmsac.vv */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vadd.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsub.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vrsub.vx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vminu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmin.vx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmaxu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmax.vx */
+	{ RZ_ANALYSIS_OP_TYPE_AND, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vand.vx */
+	{ RZ_ANALYSIS_OP_TYPE_OR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vor.vx */
+	{ RZ_ANALYSIS_OP_TYPE_XOR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vxor.vx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vrgather.vx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vslideup.vx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vslidedown.vx */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmseq.vx */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsne.vx */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsltu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmslt.vx */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsleu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsle.vx */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsgtu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsgt.vx */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsaddu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsadd.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vssubu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vssub.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsll.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsmul.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsrl.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsra.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vssrl.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vssra.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnsrl.wx */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnsra.wx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnclipu.wx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnclip.wx */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vadd.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsub.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vminu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmin.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmaxu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmax.vv */
+	{ RZ_ANALYSIS_OP_TYPE_AND, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vand.vv */
+	{ RZ_ANALYSIS_OP_TYPE_OR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vor.vv */
+	{ RZ_ANALYSIS_OP_TYPE_XOR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vxor.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vrgather.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vrgatherei16.vv */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmseq.vv */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsne.vv */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsltu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmslt.vv */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsleu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsle.vv */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsaddu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsadd.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vssubu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vssub.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsll.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsmul.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsrl.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsra.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vssrl.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vssra.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnsrl.wv */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnsra.wv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnclipu.wv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnclip.wv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwredsumu.vs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwredsum.vs */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vadd.vi */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vrsub.vi */
+	{ RZ_ANALYSIS_OP_TYPE_AND, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vand.vi */
+	{ RZ_ANALYSIS_OP_TYPE_OR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vor.vi */
+	{ RZ_ANALYSIS_OP_TYPE_XOR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vxor.vi */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vrgather.vi */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vslideup.vi */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vslidedown.vi */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmseq.vi */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsne.vi */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsleu.vi */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsle.vi */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsgtu.vi */
+	{ RZ_ANALYSIS_OP_TYPE_CMP, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsgt.vi */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsaddu.vi */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsadd.vi */
+	{ RZ_ANALYSIS_OP_TYPE_SHL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsll.vi */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsrl.vi */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsra.vi */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vssrl.vi */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vssra.vi */
+	{ RZ_ANALYSIS_OP_TYPE_SHR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnsrl.wi */
+	{ RZ_ANALYSIS_OP_TYPE_SAR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnsra.wi */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnclipu.wi */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnclip.wi */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vredsum.vs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vredand.vs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vredor.vs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vredxor.vs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vredminu.vs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vredmin.vs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vredmaxu.vs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vredmax.vs */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vaaddu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vaadd.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vasubu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vasub.vv */
+	{ RZ_ANALYSIS_OP_TYPE_AND, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmandn.mm */
+	{ RZ_ANALYSIS_OP_TYPE_AND, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmand.mm */
+	{ RZ_ANALYSIS_OP_TYPE_OR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmor.mm */
+	{ RZ_ANALYSIS_OP_TYPE_XOR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmxor.mm */
+	{ RZ_ANALYSIS_OP_TYPE_OR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmorn.mm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmnand.mm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmnor.mm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmxnor.mm */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vdivu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vdiv.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MOD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vremu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MOD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vrem.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmulhu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmul.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmulhsu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmulh.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmadd.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnmsub.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmacc.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnmsac.vv */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwaddu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwadd.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwsubu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwsub.vv */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwaddu.wv */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwadd.wv */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwsubu.wv */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwsub.wv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmulu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmulsu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmul.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmaccu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmacc.vv */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmaccsu.vv */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vaaddu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vaadd.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vasubu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vasub.vx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vslide1up.vx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vslide1down.vx */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vdivu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_DIV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vdiv.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MOD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vremu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MOD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vrem.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmulhu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmul.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmulhsu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmulh.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmadd.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnmsub.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmacc.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vnmsac.vx */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwaddu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwadd.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwsubu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwsub.vx */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwaddu.wx */
+	{ RZ_ANALYSIS_OP_TYPE_ADD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwadd.wx */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwsubu.wx */
+	{ RZ_ANALYSIS_OP_TYPE_SUB, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwsub.wx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmulu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmulsu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmul.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmaccu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmacc.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmaccus.vx */
+	{ RZ_ANALYSIS_OP_TYPE_MUL, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vwmaccsu.vx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfredsum.vs */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwredsum.vs */
+	{ RZ_ANALYSIS_OP_TYPE_OR, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmornot.mm */
+	{ RZ_ANALYSIS_OP_TYPE_AND, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmandnot.mm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfcvt.xu.f.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfcvt.x.f.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfcvt.f.xu.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfcvt.f.x.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfcvt.rtz.xu.f.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfcvt.rtz.x.f.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwcvt.xu.f.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwcvt.x.f.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwcvt.f.xu.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwcvt.f.x.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwcvt.f.f.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwcvt.rtz.xu.f.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfwcvt.rtz.x.f.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfncvt.xu.f.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfncvt.x.f.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfncvt.f.xu.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfncvt.f.x.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfncvt.f.f.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfncvt.rod.f.f.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfncvt.rtz.xu.f.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfncvt.rtz.x.f.w */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfsqrt.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfrsqrt7.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfrec7.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfclass.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vzext.vf8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsext.vf8 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vzext.vf4 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsext.vf4 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vzext.vf2 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsext.vf2 */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsbf.m */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsof.m */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsif.m */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* viota.m */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vcpop.m */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfirst.m */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vpopc.m */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vid.v */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsetvl */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmerge.vfm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vadc.vxm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmadc.vxm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmadc.vx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsbc.vxm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsbc.vxm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsbc.vx */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmerge.vxm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vadc.vvm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmadc.vvm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmadc.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsbc.vvm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsbc.vvm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmsbc.vv */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmerge.vvm */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vadc.vim */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmadc.vim */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmadc.vi */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmerge.vim */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vcompress.vm */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmvnfr.v */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmv.f.s */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmv1r.v */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmv2r.v */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmv4r.v */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmv8r.v */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmv.x.s */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vlm.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vsm.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl1re8.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl1re16.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl1re32.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl1re64.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl2re8.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl2re16.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl2re32.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl2re64.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl4re8.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl4re16.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl4re32.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl4re64.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl8re8.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl8re16.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl8re32.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl8re64.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vs1r.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vs2r.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vs4r.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vs8r.v */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmv.s.f */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vfmv.v.f */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmv.v.x */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmv.v.v */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmv.v.i */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vmv.s.x */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl1r.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl2r.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl4r.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vl8r.v */
+	{ RZ_ANALYSIS_OP_TYPE_LOAD, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vle1.v */
+	{ RZ_ANALYSIS_OP_TYPE_STORE, RZ_ANALYSIS_OP_FAMILY_SSE, RZ_TYPE_COND_AL, 0 }, /* vse1.v */
+};
@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* svinval, RISCV_INS_SINVAL_VMA to RISCV_INS_SFENCE_INVAL_IR */
+const char riscv_svinval_names[] =
+	"sinval.vma\0"
+	"hinval.vvma\0"
+	"hinval.gvma\0"
+	"sfence.w.inval\0"
+	"sfence.inval.ir\0";
+
+const RISCVDescription riscv_svinval_descriptions[] = {
+	{ 0, 33 }, /* sinval.vma */
+	{ 11, 33 }, /* hinval.vvma */
+	{ 23, 33 }, /* hinval.gvma */
+	{ 35, 0 }, /* sfence.w.inval */
+	{ 50, 0 }, /* sfence.inval.ir */
+};
+
+const RISCVAnalysis riscv_svinval_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_PRIV, RZ_TYPE_COND_AL, 0 }, /* sinval.vma */
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_PRIV, RZ_TYPE_COND_AL, 0 }, /* hinval.vvma */
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_PRIV, RZ_TYPE_COND_AL, 0 }, /* hinval.gvma */
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_PRIV, RZ_TYPE_COND_AL, 0 }, /* sfence.w.inval */
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_PRIV, RZ_TYPE_COND_AL, 0 }, /* sfence.inval.ir */
+};
@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* system, RISCV_INS_CSRRW to RISCV_INS_WFI */
+const char riscv_system_names[] =
+	"csrrw\0"
+	"csrrs\0"
+	"csrrc\0"
+	"csrrwi\0"
+	"csrrsi\0"
+	"csrrci\0"
+	"sfence.vma\0"
+	"ecall\0"
+	"ebreak\0"
+	"sret\0"
+	"mret\0"
+	"dret\0"
+	"wfi\0";
+
+const RISCVDescription riscv_system_descriptions[] = {
+	{ 0, 11 }, /* csrrw */
+	{ 6, 11 }, /* csrrs */
+	{ 12, 11 }, /* csrrc */
+	{ 18, 12 }, /* csrrwi */
+	{ 25, 12 }, /* csrrsi */
+	{ 32, 12 }, /* csrrci */
+	{ 39, 33 }, /* sfence.vma */
+	{ 50, 0 }, /* ecall */
+	{ 56, 0 }, /* ebreak */
+	{ 63, 0 }, /* sret */
+	{ 68, 0 }, /* mret */
+	{ 73, 0 }, /* dret */
+	{ 78, 0 }, /* wfi */
+};
+
+const RISCVAnalysis riscv_system_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* csrrw */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* csrrs */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* csrrc */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* csrrwi */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* csrrsi */
+	{ RZ_ANALYSIS_OP_TYPE_MOV, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* csrrci */
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_PRIV, RZ_TYPE_COND_AL, 0 }, /* sfence.vma */
+	{ RZ_ANALYSIS_OP_TYPE_SWI, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* ecall */
+	{ RZ_ANALYSIS_OP_TYPE_TRAP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* ebreak */
+	{ RZ_ANALYSIS_OP_TYPE_RET, RZ_ANALYSIS_OP_FAMILY_PRIV, RZ_TYPE_COND_AL, 0 }, /* sret */
+	{ RZ_ANALYSIS_OP_TYPE_RET, RZ_ANALYSIS_OP_FAMILY_PRIV, RZ_TYPE_COND_AL, 0 }, /* mret */
+	{ RZ_ANALYSIS_OP_TYPE_RET, RZ_ANALYSIS_OP_FAMILY_PRIV, RZ_TYPE_COND_AL, 0 }, /* dret */
+	{ RZ_ANALYSIS_OP_TYPE_UNK, RZ_ANALYSIS_OP_FAMILY_PRIV, RZ_TYPE_COND_AL, 0 }, /* wfi */
+};
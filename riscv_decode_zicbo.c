@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+/* zicbo, RISCV_INS_PREFETCH_I to RISCV_INS_CBO_ZERO */
+const char riscv_zicbo_names[] =
+	"prefetch.i\0"
+	"prefetch.r\0"
+	"prefetch.w\0"
+	"cbo.clean\0"
+	"cbo.flush\0"
+	"cbo.inval\0"
+	"cbo.zero\0";
+
+const RISCVDescription riscv_zicbo_descriptions[] = {
+	{ 0, 32 }, /* prefetch.i */
+	{ 11, 32 }, /* prefetch.r */
+	{ 22, 32 }, /* prefetch.w */
+	{ 33, 31 }, /* cbo.clean */
+	{ 43, 31 }, /* cbo.flush */
+	{ 53, 31 }, /* cbo.inval */
+	{ 63, 31 }, /* cbo.zero */
+};
+
+const RISCVAnalysis riscv_zicbo_analysis[] = {
+	{ RZ_ANALYSIS_OP_TYPE_NOP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* prefetch.i */
+	{ RZ_ANALYSIS_OP_TYPE_NOP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* prefetch.r */
+	{ RZ_ANALYSIS_OP_TYPE_NOP, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* prefetch.w */
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* cbo.clean */
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* cbo.flush */
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* cbo.inval */
+	{ RZ_ANALYSIS_OP_TYPE_SYNC, RZ_ANALYSIS_OP_FAMILY_CPU, RZ_TYPE_COND_AL, 0 }, /* cbo.zero */
+};
@@ -0,0 +1,1054 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_emu.h"
+
+/* handlers are threaded with computed gotos when the compiler supports them */
+#if defined(__GNUC__) || defined(__clang__)
+#define RISCV_EMU_THREADED 1
+#else
+#define RISCV_EMU_THREADED 0
+#endif
+
+/* instructions executed by the interpreter, the names follow RISCVInsId */
+#define RISCV_EMU_OPS(X) \
+	X(LUI) \
+	X(AUIPC) \
+	X(JAL) \
+	X(JALR) \
+	X(BEQ) \
+	X(BNE) \
+	X(BLT) \
+	X(BGE) \
+	X(BLTU) \
+	X(BGEU) \
+	X(LB) \
+	X(LH) \
+	X(LW) \
+	X(LD) \
+	X(LBU) \
+	X(LHU) \
+	X(LWU) \
+	X(SB) \
+	X(SH) \
+	X(SW) \
+	X(SD) \
+	X(ADDI) \
+	X(SLTI) \
+	X(SLTIU) \
+	X(XORI) \
+	X(ORI) \
+	X(ANDI) \
+	X(SLLI) \
+	X(SRLI) \
+	X(SRAI) \
+	X(ADD) \
+	X(SUB) \
+	X(SLL) \
+	X(SLT) \
+	X(SLTU) \
+	X(XOR) \
+	X(SRL) \
+	X(SRA) \
+	X(OR) \
+	X(AND) \
+	X(ADDIW) \
+	X(SLLIW) \
+	X(SRLIW) \
+	X(SRAIW) \
+	X(ADDW) \
+	X(SUBW) \
+	X(SLLW) \
+	X(SRLW) \
+	X(SRAW) \
+	X(FENCE) \
+	X(FENCE_I) \
+	X(ECALL) \
+	X(EBREAK) \
+	X(CSRRS) \
+	X(MUL) \
+	X(MULH) \
+	X(MULHSU) \
+	X(MULHU) \
+	X(DIV) \
+	X(DIVU) \
+	X(REM) \
+	X(REMU) \
+	X(MULW) \
+	X(DIVW) \
+	X(DIVUW) \
+	X(REMW) \
+	X(REMUW) \
+	X(LR_W) \
+	X(SC_W) \
+	X(AMOSWAP_W) \
+	X(AMOADD_W) \
+	X(AMOXOR_W) \
+	X(AMOAND_W) \
+	X(AMOOR_W) \
+	X(AMOMIN_W) \
+	X(AMOMAX_W) \
+	X(AMOMINU_W) \
+	X(AMOMAXU_W) \
+	X(LR_D) \
+	X(SC_D) \
+	X(AMOSWAP_D) \
+	X(AMOADD_D) \
+	X(AMOXOR_D) \
+	X(AMOAND_D) \
+	X(AMOOR_D) \
+	X(AMOMIN_D) \
+	X(AMOMAX_D) \
+	X(AMOMINU_D) \
+	X(AMOMAXU_D)
+
+#define RISCV_EMU_ENUM(name) RISCV_EMU_OP_##name,
+#define RISCV_EMU_CASE(name) \
+	case RISCV_INS_##name: \
+		return RISCV_EMU_OP_##name;
+#define RISCV_EMU_LABEL(name) &&op_##name,
+
+typedef enum {
+	RISCV_EMU_OP_ILLEGAL = 0,
+	RISCV_EMU_OPS(RISCV_EMU_ENUM)
+	RISCV_EMU_OP_END, /* appended to the blocks not ending with a control flow instruction */
+} RISCVEmuOp;
+
+static ut8 riscv_emu_op(RISCVInsId id) {
+	switch (id) {
+		RISCV_EMU_OPS(RISCV_EMU_CASE)
+	default:
+		return RISCV_EMU_OP_ILLEGAL;
+	}
+}
+
+/* 32 bits encodings used to expand the compressed instructions */
+#define enc_r(f7, rs2, rs1, f3, rd, opc) (((ut32)(f7) << 25) | ((rs2) << 20) | ((rs1) << 15) | ((f3) << 12) | ((rd) << 7) | (opc))
+#define enc_i(imm, rs1, f3, rd, opc)     ((((ut32)(imm)&0xfff) << 20) | ((rs1) << 15) | ((f3) << 12) | ((rd) << 7) | (opc))
+#define enc_s(imm, rs2, rs1, f3, opc)    (((((ut32)(imm) >> 5) & 0x7f) << 25) | ((rs2) << 20) | ((rs1) << 15) | ((f3) << 12) | (((imm)&0x1f) << 7) | (opc))
+#define enc_b(imm, rs2, rs1, f3) \
+	(((((ut32)(imm) >> 12) & 1) << 31) | ((((imm) >> 5) & 0x3f) << 25) | ((rs2) << 20) | ((rs1) << 15) | ((f3) << 12) | \
+		((((imm) >> 1) & 0xf) << 8) | ((((imm) >> 11) & 1) << 7) | 0x63)
+#define enc_j(imm, rd) \
+	(((((ut32)(imm) >> 20) & 1) << 31) | ((((imm) >> 1) & 0x3ff) << 21) | ((((imm) >> 11) & 1) << 20) | \
+		((((imm) >> 12) & 0xff) << 12) | ((rd) << 7) | 0x6f)
+
+#define OPC_LOAD   0x03
+#define OPC_OP_IMM 0x13
+#define OPC_OP_I32 0x1b
+#define OPC_STORE  0x23
+#define OPC_OP     0x33
+#define OPC_LUI    0x37
+#define OPC_OP_32  0x3b
+#define OPC_JALR   0x67
+#define OPC_SYSTEM 0x73
+
+#define cbit(c, from, to)  ((((ut32)(c)) >> (from) & 1) << (to))
+#define cbits(c, hi, lo)   ((((ut32)(c)) >> (lo)) & ((1u << ((hi) - (lo) + 1)) - 1))
+#define cimm6(c)           ((st32)((cbit(c, 12, 5) | cbits(c, 6, 2)) << 26) >> 26)
+#define creg(c, lo)        (8 + cbits(c, (lo) + 2, lo))
+
+/**
+ * Expands a RV64C instruction to its 32 bits equivalent,
+ * returns 0 for reserved encodings and for the F/D ones.
+ */
+static ut32 riscv_emu_expand(ut16 c) {
+	ut32 rd = cbits(c, 11, 7);
+	ut32 rs2 = cbits(c, 6, 2);
+	ut32 imm;
+
+	switch ((c & 3) << 3 | c >> 13) {
+	case 0x00: /* c.addi4spn */
+		imm = cbits(c, 12, 11) << 4 | cbits(c, 10, 7) << 6 | cbit(c, 6, 2) | cbit(c, 5, 3);
+		return imm ? enc_i(imm, 2, 0, creg(c, 2), OPC_OP_IMM) : 0;
+	case 0x02: /* c.lw */
+		imm = cbits(c, 12, 10) << 3 | cbit(c, 6, 2) | cbit(c, 5, 6);
+		return enc_i(imm, creg(c, 7), 2, creg(c, 2), OPC_LOAD);
+	case 0x03: /* c.ld */
+		imm = cbits(c, 12, 10) << 3 | cbits(c, 6, 5) << 6;
+		return enc_i(imm, creg(c, 7), 3, creg(c, 2), OPC_LOAD);
+	case 0x06: /* c.sw */
+		imm = cbits(c, 12, 10) << 3 | cbit(c, 6, 2) | cbit(c, 5, 6);
+		return enc_s(imm, creg(c, 2), creg(c, 7), 2, OPC_STORE);
+	case 0x07: /* c.sd */
+		imm = cbits(c, 12, 10) << 3 | cbits(c, 6, 5) << 6;
+		return enc_s(imm, creg(c, 2), creg(c, 7), 3, OPC_STORE);
+	case 0x08: /* c.addi, c.nop */
+		return enc_i(cimm6(c), rd, 0, rd, OPC_OP_IMM);
+	case 0x09: /* c.addiw */
+		return rd ? enc_i(cimm6(c), rd, 0, rd, OPC_OP_I32) : 0;
+	case 0x0a: /* c.li */
+		return enc_i(cimm6(c), 0, 0, rd, OPC_OP_IMM);
+	case 0x0b:
+		if (rd == 2) { /* c.addi16sp */
+			imm = cbit(c, 12, 9) | cbit(c, 6, 4) | cbit(c, 5, 6) | cbits(c, 4, 3) << 7 | cbit(c, 2, 5);
+			imm = (st32)(imm << 22) >> 22;
+			return imm ? enc_i(imm, 2, 0, 2, OPC_OP_IMM) : 0;
+		}
+		/* c.lui */
+		imm = (ut32)cimm6(c) << 12;
+		return imm && rd ? (imm | rd << 7 | OPC_LUI) : 0;
+	case 0x0c:
+		rd = creg(c, 7);
+		switch (cbits(c, 11, 10)) {
+		case 0: /* c.srli */
+			return enc_i(cbit(c, 12, 5) | rs2, rd, 5, rd, OPC_OP_IMM);
+		case 1: /* c.srai */
+			return enc_i(0x400 | cbit(c, 12, 5) | rs2, rd, 5, rd, OPC_OP_IMM);
+		case 2: /* c.andi */
+			return enc_i(cimm6(c), rd, 7, rd, OPC_OP_IMM);
+		default:
+			break;
+		}
+		rs2 = creg(c, 2);
+		switch (cbit(c, 12, 2) | cbits(c, 6, 5)) {
+		case 0: /* c.sub */
+			return enc_r(0x20, rs2, rd, 0, rd, OPC_OP);
+		case 1: /* c.xor */
+			return enc_r(0, rs2, rd, 4, rd, OPC_OP);
+		case 2: /* c.or */
+			return enc_r(0, rs2, rd, 6, rd, OPC_OP);
+		case 3: /* c.and */
+			return enc_r(0, rs2, rd, 7, rd, OPC_OP);
+		case 4: /* c.subw */
+			return enc_r(0x20, rs2, rd, 0, rd, OPC_OP_32);
+		case 5: /* c.addw */
+			return enc_r(0, rs2, rd, 0, rd, OPC_OP_32);
+		default:
+			return 0;
+		}
+	case 0x0d: /* c.j */
+		imm = cbit(c, 12, 11) | cbit(c, 11, 4) | cbits(c, 10, 9) << 8 | cbit(c, 8, 10) |
+			cbit(c, 7, 6) | cbit(c, 6, 7) | cbits(c, 5, 3) << 1 | cbit(c, 2, 5);
+		return enc_j((st32)(imm << 20) >> 20, 0);
+	case 0x0e: /* c.beqz */
+	case 0x0f: /* c.bnez */
+		imm = cbit(c, 12, 8) | cbits(c, 11, 10) << 3 | cbits(c, 6, 5) << 6 | cbits(c, 4, 3) << 1 | cbit(c, 2, 5);
+		return enc_b((st32)(imm << 23) >> 23, 0, creg(c, 7), (c >> 13) & 1);
+	case 0x10: /* c.slli */
+		return enc_i(cbit(c, 12, 5) | rs2, rd, 1, rd, OPC_OP_IMM);
+	case 0x12: /* c.lwsp */
+		imm = cbit(c, 12, 5) | cbits(c, 6, 4) << 2 | cbits(c, 3, 2) << 6;
+		return rd ? enc_i(imm, 2, 2, rd, OPC_LOAD) : 0;
+	case 0x13: /* c.ldsp */
+		imm = cbit(c, 12, 5) | cbits(c, 6, 5) << 3 | cbits(c, 4, 2) << 6;
+		return rd ? enc_i(imm, 2, 3, rd, OPC_LOAD) : 0;
+	case 0x14:
+		if (!(c & (1 << 12))) {
+			if (!rs2) { /* c.jr */
+				return rd ? enc_i(0, rd, 0, 0, OPC_JALR) : 0;
+			}
+			/* c.mv */
+			return enc_r(0, rs2, 0, 0, rd, OPC_OP);
+		}
+		if (!rs2) {
+			/* c.ebreak, c.jalr */
+			return rd ? enc_i(0, rd, 0, 1, OPC_JALR) : enc_i(1, 0, 0, 0, OPC_SYSTEM);
+		}
+		/* c.add */
+		return enc_r(0, rs2, rd, 0, rd, OPC_OP);
+	case 0x16: /* c.swsp */
+		imm = cbits(c, 12, 9) << 2 | cbits(c, 8, 7) << 6;
+		return enc_s(imm, rs2, 2, 2, OPC_STORE);
+	case 0x17: /* c.sdsp */
+		imm = cbits(c, 12, 10) << 3 | cbits(c, 9, 7) << 6;
+		return enc_s(imm, rs2, 2, 3, OPC_STORE);
+	default:
+		return 0;
+	}
+}
+
+static void riscv_emu_page_free(void *page) {
+	free(page);
+}
+
+RISCVEmu *riscv_emu_new(void) {
+	RISCVEmu *emu = RZ_NEW0(RISCVEmu);
+	if (!emu) {
+		return NULL;
+	}
+	emu->pages = ht_up_new(NULL, riscv_emu_page_free);
+	emu->blocks = RZ_NEWS0(RISCVEmuSlot, RISCV_EMU_BLOCKS_MIN);
+	if (!emu->pages || !emu->blocks) {
+		riscv_emu_free(emu);
+		return NULL;
+	}
+	emu->blocks_mask = RISCV_EMU_BLOCKS_MIN - 1;
+	for (ut32 i = 0; i < RISCV_EMU_TLB_SIZE; ++i) {
+		emu->tlb[i].page = UT64_MAX;
+	}
+	emu->reservation = UT64_MAX;
+	return emu;
+}
+
+/**
+ * Drops all the translated blocks
+ */
+void riscv_emu_flush(RISCVEmu *emu) {
+	rz_return_if_fail(emu);
+	for (ut32 i = 0; i <= emu->blocks_mask; ++i) {
+		free(emu->blocks[i].block);
+		emu->blocks[i].block = NULL;
+	}
+	emu->n_blocks = 0;
+}
+
+void riscv_emu_free(RISCVEmu *emu) {
+	if (!emu) {
+		return;
+	}
+	if (emu->blocks) {
+		riscv_emu_flush(emu);
+	}
+	ht_up_free(emu->pages);
+	free(emu->blocks);
+	free(emu);
+}
+
+static inline RISCVEmuPage *riscv_emu_page(RISCVEmu *emu, ut64 addr) {
+	ut64 page = addr >> RISCV_EMU_PAGE_BITS;
+	RISCVEmuTlb *tlb = &emu->tlb[page & (RISCV_EMU_TLB_SIZE - 1)];
+	if (tlb->page == page) {
+		return tlb->data;
+	}
+	RISCVEmuPage *data = ht_up_find(emu->pages, page, NULL);
+	if (!data) {
+		return NULL;
+	}
+	tlb->page = page;
+	tlb->data = data;
+	return data;
+}
+
+/* the blocks translated from the page become stale, they are dropped when looked up */
+static inline void riscv_emu_dirty(RISCVEmu *emu, RISCVEmuPage *page) {
+	if (page->code) {
+		page->code = false;
+		page->gen++;
+		emu->smc = true;
+	}
+}
+
+/**
+ * Maps zeroed memory in [addr, addr + size), the pages already mapped are kept
+ */
+bool riscv_emu_map(RISCVEmu *emu, ut64 addr, ut64 size) {
+	rz_return_val_if_fail(emu && size, false);
+	ut64 first = addr >> RISCV_EMU_PAGE_BITS;
+	ut64 last = (addr + size - 1) >> RISCV_EMU_PAGE_BITS;
+	if (last < first) {
+		return false;
+	}
+	for (ut64 page = first; page <= last; ++page) {
+		if (ht_up_find(emu->pages, page, NULL)) {
+			continue;
+		}
+		RISCVEmuPage *data = RZ_NEW0(RISCVEmuPage);
+		if (!data || !ht_up_insert(emu->pages, page, data)) {
+			free(data);
+			return false;
+		}
+		if (page == UT64_MAX >> RISCV_EMU_PAGE_BITS) {
+			break;
+		}
+	}
+	return true;
+}
+
+bool riscv_emu_read(RISCVEmu *emu, ut64 addr, ut8 *buffer, ut64 size) {
+	rz_return_val_if_fail(emu && buffer, false);
+	while (size > 0) {
+		RISCVEmuPage *page = riscv_emu_page(emu, addr);
+		if (!page) {
+			emu->fault = addr;
+			return false;
+		}
+		ut64 offset = addr & RISCV_EMU_PAGE_MASK;
+		ut64 n = RZ_MIN(size, RISCV_EMU_PAGE_SIZE - offset);
+		memcpy(buffer, page->data + offset, n);
+		buffer += n;
+		addr += n;
+		size -= n;
+	}
+	return true;
+}
+
+bool riscv_emu_write(RISCVEmu *emu, ut64 addr, const ut8 *buffer, ut64 size) {
+	rz_return_val_if_fail(emu && buffer, false);
+	while (size > 0) {
+		RISCVEmuPage *page = riscv_emu_page(emu, addr);
+		if (!page) {
+			emu->fault = addr;
+			return false;
+		}
+		ut64 offset = addr & RISCV_EMU_PAGE_MASK;
+		ut64 n = RZ_MIN(size, RISCV_EMU_PAGE_SIZE - offset);
+		riscv_emu_dirty(emu, page);
+		memcpy(page->data + offset, buffer, n);
+		buffer += n;
+		addr += n;
+		size -= n;
+	}
+	return true;
+}
+
+static inline bool riscv_emu_load(RISCVEmu *emu, ut64 addr, ut32 size, ut64 *value) {
+	RISCVEmuPage *page = riscv_emu_page(emu, addr);
+	ut32 offset = addr & RISCV_EMU_PAGE_MASK;
+	ut8 tmp[8] = { 0 };
+	const ut8 *data = page ? page->data + offset : tmp;
+	if (!page || offset + size > RISCV_EMU_PAGE_SIZE) {
+		/* unmapped or crossing a page boundary */
+		if (!riscv_emu_read(emu, addr, tmp, size)) {
+			return false;
+		}
+		data = tmp;
+	}
+	switch (size) {
+	case 1:
+		*value = rz_read_le8(data);
+		break;
+	case 2:
+		*value = rz_read_le16(data);
+		break;
+	case 4:
+		*value = rz_read_le32(data);
+		break;
+	default:
+		*value = rz_read_le64(data);
+		break;
+	}
+	return true;
+}
+
+static inline bool riscv_emu_store(RISCVEmu *emu, ut64 addr, ut32 size, ut64 value) {
+	RISCVEmuPage *page = riscv_emu_page(emu, addr);
+	ut32 offset = addr & RISCV_EMU_PAGE_MASK;
+	if (!page || offset + size > RISCV_EMU_PAGE_SIZE) {
+		ut8 tmp[8];
+		rz_write_le64(tmp, value);
+		return riscv_emu_write(emu, addr, tmp, size);
+	}
+	riscv_emu_dirty(emu, page);
+	switch (size) {
+	case 1:
+		rz_write_le8(page->data + offset, value);
+		break;
+	case 2:
+		rz_write_le16(page->data + offset, value);
+		break;
+	case 4:
+		rz_write_le32(page->data + offset, value);
+		break;
+	default:
+		rz_write_le64(page->data + offset, value);
+		break;
+	}
+	return true;
+}
+
+static bool riscv_emu_decode(RISCVEmu *emu, ut64 pc, RISCVEmuInsn *insn) {
+	ut8 bytes[4];
+	if (!riscv_emu_read(emu, pc, bytes, 2)) {
+		return false;
+	}
+	ut32 raw = rz_read_le16(bytes);
+	if ((raw & 3) == 3) {
+		if (!riscv_emu_read(emu, pc + 2, bytes + 2, 2)) {
+			return false;
+		}
+		raw = rz_read_le32(bytes);
+	}
+
+	RISCVDecoded dec;
+	ut32 word = (raw & 3) == 3 ? raw : riscv_emu_expand(raw);
+	memset(insn, 0, sizeof(RISCVEmuInsn));
+	insn->size = (raw & 3) == 3 ? 4 : 2;
+	if (!word || !riscv_decode_word(word, &dec)) {
+		insn->op = RISCV_EMU_OP_ILLEGAL;
+		return true;
+	}
+	insn->op = riscv_emu_op(dec.id);
+	insn->rd = dec.rd;
+	insn->rs1 = dec.rs1;
+	insn->rs2 = dec.rs2;
+	insn->imm = dec.imm;
+	return true;
+}
+
+static bool ends_block(ut8 op) {
+	switch (op) {
+	case RISCV_EMU_OP_ILLEGAL:
+	case RISCV_EMU_OP_JAL:
+	case RISCV_EMU_OP_JALR:
+	case RISCV_EMU_OP_BEQ:
+	case RISCV_EMU_OP_BNE:
+	case RISCV_EMU_OP_BLT:
+	case RISCV_EMU_OP_BGE:
+	case RISCV_EMU_OP_BLTU:
+	case RISCV_EMU_OP_BGEU:
+	case RISCV_EMU_OP_ECALL:
+	case RISCV_EMU_OP_EBREAK:
+		return true;
+	default:
+		return false;
+	}
+}
+
+/* decodes the instructions from pc up to the first control flow one, or to an unmapped page */
+static RISCVEmuBlock *riscv_emu_translate(RISCVEmu *emu, ut64 pc) {
+	RISCVEmuInsn insns[RISCV_EMU_BLOCK_MAX];
+	ut32 n_insns = 0;
+	ut64 end = pc;
+
+	while (n_insns < RISCV_EMU_BLOCK_MAX && riscv_emu_decode(emu, end, &insns[n_insns])) {
+		end += insns[n_insns].size;
+		if (ends_block(insns[n_insns++].op)) {
+			break;
+		}
+	}
+	if (!n_insns) {
+		return NULL;
+	}
+
+	bool open = !ends_block(insns[n_insns - 1].op);
+	RISCVEmuBlock *block = malloc(sizeof(RISCVEmuBlock) + sizeof(RISCVEmuInsn) * (n_insns + open));
+	if (!block) {
+		return NULL;
+	}
+	block->pc = pc;
+	block->n_insns = n_insns;
+	memcpy(block->insns, insns, sizeof(RISCVEmuInsn) * n_insns);
+	if (open) {
+		memset(&block->insns[n_insns], 0, sizeof(RISCVEmuInsn));
+		block->insns[n_insns].op = RISCV_EMU_OP_END;
+	}
+	/* a block is shorter than a page, so it spans at most two of them */
+	block->page[0] = riscv_emu_page(emu, pc);
+	block->page[1] = riscv_emu_page(emu, end - 1);
+	for (ut32 i = 0; i < 2; ++i) {
+		block->page[i]->code = true;
+		block->gen[i] = block->page[i]->gen;
+	}
+	return block;
+}
+
+static inline ut32 riscv_emu_hash(ut64 pc) {
+	return (ut32)((pc >> 1) * 0x9e3779b97f4a7c15ull >> 32);
+}
+
+static bool riscv_emu_grow(RISCVEmu *emu) {
+	ut32 size = (emu->blocks_mask + 1) * 2;
+	RISCVEmuSlot *blocks = RZ_NEWS0(RISCVEmuSlot, size);
+	if (!blocks) {
+		return false;
+	}
+	for (ut32 i = 0; i <= emu->blocks_mask; ++i) {
+		RISCVEmuSlot *slot = &emu->blocks[i];
+		if (!slot->block) {
+			continue;
+		}
+		ut32 j = riscv_emu_hash(slot->pc) & (size - 1);
+		while (blocks[j].block) {
+			j = (j + 1) & (size - 1);
+		}
+		blocks[j] = *slot;
+	}
+	free(emu->blocks);
+	emu->blocks = blocks;
+	emu->blocks_mask = size - 1;
+	return true;
+}
+
+/* backward shift deletion, the following entries of the probe chain are moved up */
+static void riscv_emu_remove(RISCVEmu *emu, ut32 i) {
+	ut32 mask = emu->blocks_mask;
+	free(emu->blocks[i].block);
+	emu->blocks[i].block = NULL;
+	emu->n_blocks--;
+	for (ut32 j = (i + 1) & mask; emu->blocks[j].block; j = (j + 1) & mask) {
+		ut32 home = riscv_emu_hash(emu->blocks[j].pc) & mask;
+		/* the entry stays when its home slot is cyclically in (i, j] */
+		if (i <= j ? (i < home && home <= j) : (i < home || home <= j)) {
+			continue;
+		}
+		emu->blocks[i] = emu->blocks[j];
+		emu->blocks[j].block = NULL;
+		i = j;
+	}
+}
+
+/**
+ * Returns the block starting at pc, translating it when missing or when
+ * its pages were written after the translation.
+ */
+static RISCVEmuBlock *riscv_emu_block(RISCVEmu *emu, ut64 pc) {
+	ut32 i = riscv_emu_hash(pc) & emu->blocks_mask;
+	for (; emu->blocks[i].block; i = (i + 1) & emu->blocks_mask) {
+		RISCVEmuSlot *slot = &emu->blocks[i];
+		if (slot->pc != pc) {
+			continue;
+		}
+		RISCVEmuBlock *block = slot->block;
+		if (block->gen[0] == block->page[0]->gen && block->gen[1] == block->page[1]->gen) {
+			return block;
+		}
+		/* stale, translated again in the same slot */
+		block = riscv_emu_translate(emu, pc);
+		if (!block) {
+			riscv_emu_remove(emu, i);
+			return NULL;
+		}
+		free(slot->block);
+		slot->block = block;
+		return block;
+	}
+
+	RISCVEmuBlock *block = riscv_emu_translate(emu, pc);
+	if (!block) {
+		return NULL;
+	}
+	/* load factor is kept under 1/2, when the table cannot grow it is emptied */
+	if ((emu->n_blocks + 1) * 2 > emu->blocks_mask + 1) {
+		if (!riscv_emu_grow(emu)) {
+			riscv_emu_flush(emu);
+		}
+		i = riscv_emu_hash(pc) & emu->blocks_mask;
+		while (emu->blocks[i].block) {
+			i = (i + 1) & emu->blocks_mask;
+		}
+	}
+	emu->blocks[i].pc = pc;
+	emu->blocks[i].block = block;
+	emu->n_blocks++;
+	return block;
+}
+
+static inline ut64 riscv_emu_mulhu(ut64 a, ut64 b) {
+	ut64 lo = (a & UT32_MAX) * (b & UT32_MAX);
+	ut64 mid0 = (a >> 32) * (b & UT32_MAX) + (lo >> 32);
+	ut64 mid1 = (a & UT32_MAX) * (b >> 32) + (mid0 & UT32_MAX);
+	return (a >> 32) * (b >> 32) + (mid0 >> 32) + (mid1 >> 32);
+}
+
+static inline ut64 riscv_emu_mulhsu(ut64 a, ut64 b) {
+	ut64 high = riscv_emu_mulhu(a, b);
+	return (st64)a < 0 ? high - b : high;
+}
+
+static inline ut64 riscv_emu_mulh(ut64 a, ut64 b) {
+	ut64 high = riscv_emu_mulhsu(a, b);
+	return (st64)b < 0 ? high - a : high;
+}
+
+#define X(r)    x[insn->r]
+#define sext(v) ((ut64)(st64)(st32)(v))
+
+#if RISCV_EMU_THREADED
+#define HANDLER(name) op_##name
+#define DISPATCH() \
+	do { \
+		x[0] = 0; \
+		if (executed == steps) { \
+			goto stop; \
+		} \
+		executed++; \
+		goto *handlers[insn->op]; \
+	} while (0)
+#else
+#define HANDLER(name) case RISCV_EMU_OP_##name
+#define DISPATCH()    goto dispatch
+#endif
+
+/* the next instruction is always in the same block, control flow ends it */
+#define NEXT() \
+	do { \
+		pc += insn->size; \
+		insn++; \
+		DISPATCH(); \
+	} while (0)
+
+/* the rest of the block is stale when the store modified translated code */
+#define NEXT_STORE() \
+	do { \
+		if (emu->smc) { \
+			pc += insn->size; \
+			goto lookup; \
+		} \
+		NEXT(); \
+	} while (0)
+
+#define BRANCH(cond) \
+	do { \
+		pc += (cond) ? insn->imm : insn->size; \
+		goto lookup; \
+	} while (0)
+
+#define LOAD(size, convert) \
+	do { \
+		ut64 value; \
+		if (!riscv_emu_load(emu, X(rs1) + insn->imm, size, &value)) { \
+			goto fault; \
+		} \
+		X(rd) = convert; \
+		NEXT(); \
+	} while (0)
+
+#define STORE(size) \
+	do { \
+		if (!riscv_emu_store(emu, X(rs1) + insn->imm, size, X(rs2))) { \
+			goto fault; \
+		} \
+		NEXT_STORE(); \
+	} while (0)
+
+/* value holds the loaded word (sign extended), src the rs2 operand */
+#define AMO(size, result) \
+	do { \
+		ut64 addr = X(rs1), value, src = X(rs2); \
+		if (!riscv_emu_load(emu, addr, size, &value)) { \
+			goto fault; \
+		} \
+		value = size == 4 ? sext(value) : value; \
+		if (!riscv_emu_store(emu, addr, size, (result))) { \
+			goto fault; \
+		} \
+		X(rd) = value; \
+		NEXT_STORE(); \
+	} while (0)
+
+#define LR(size) \
+	do { \
+		ut64 value; \
+		if (!riscv_emu_load(emu, X(rs1), size, &value)) { \
+			goto fault; \
+		} \
+		emu->reservation = X(rs1); \
+		X(rd) = size == 4 ? sext(value) : value; \
+		NEXT(); \
+	} while (0)
+
+#define SC(size) \
+	do { \
+		bool reserved = emu->reservation == X(rs1); \
+		emu->reservation = UT64_MAX; \
+		if (reserved && !riscv_emu_store(emu, X(rs1), size, X(rs2))) { \
+			goto fault; \
+		} \
+		X(rd) = !reserved; \
+		NEXT_STORE(); \
+	} while (0)
+
+/**
+ * Executes up to steps instructions starting from emu->pc.
+ * On return pc points to the instruction to execute next, or to the one
+ * that could not be executed for RISCV_EMU_ILLEGAL and RISCV_EMU_FAULT.
+ */
+RISCVEmuStatus riscv_emu_run(RISCVEmu *emu, ut64 steps) {
+	rz_return_val_if_fail(emu, RISCV_EMU_ILLEGAL);
+#if RISCV_EMU_THREADED
+	static const void *const handlers[] = {
+		&&op_ILLEGAL,
+		RISCV_EMU_OPS(RISCV_EMU_LABEL)
+		&&op_END,
+	};
+#endif
+	ut64 *x = emu->x;
+	ut64 pc = emu->pc;
+	ut64 executed = 0;
+	const RISCVEmuInsn *insn = NULL;
+	const RISCVEmuBlock *block;
+	RISCVEmuStatus status;
+
+lookup:
+	emu->smc = false;
+	block = riscv_emu_block(emu, pc);
+	if (!block) {
+		/* the first instruction cannot be fetched */
+		executed++;
+		goto fault;
+	}
+	insn = block->insns;
+	DISPATCH();
+#if !RISCV_EMU_THREADED
+dispatch:
+	x[0] = 0;
+	if (executed == steps) {
+		goto stop;
+	}
+	executed++;
+	switch (insn->op) {
+#endif
+	HANDLER(LUI):
+		X(rd) = insn->imm;
+		NEXT();
+	HANDLER(AUIPC):
+		X(rd) = pc + insn->imm;
+		NEXT();
+	HANDLER(JAL):
+		X(rd) = pc + insn->size;
+		pc += insn->imm;
+		goto lookup;
+	HANDLER(JALR): {
+		ut64 target = (X(rs1) + insn->imm) & ~1ull;
+		X(rd) = pc + insn->size;
+		pc = target;
+		goto lookup;
+	}
+	HANDLER(BEQ):
+		BRANCH(X(rs1) == X(rs2));
+	HANDLER(BNE):
+		BRANCH(X(rs1) != X(rs2));
+	HANDLER(BLT):
+		BRANCH((st64)X(rs1) < (st64)X(rs2));
+	HANDLER(BGE):
+		BRANCH((st64)X(rs1) >= (st64)X(rs2));
+	HANDLER(BLTU):
+		BRANCH(X(rs1) < X(rs2));
+	HANDLER(BGEU):
+		BRANCH(X(rs1) >= X(rs2));
+	HANDLER(LB):
+		LOAD(1, (st64)(st8)value);
+	HANDLER(LH):
+		LOAD(2, (st64)(st16)value);
+	HANDLER(LW):
+		LOAD(4, sext(value));
+	HANDLER(LD):
+		LOAD(8, value);
+	HANDLER(LBU):
+		LOAD(1, value);
+	HANDLER(LHU):
+		LOAD(2, value);
+	HANDLER(LWU):
+		LOAD(4, value);
+	HANDLER(SB):
+		STORE(1);
+	HANDLER(SH):
+		STORE(2);
+	HANDLER(SW):
+		STORE(4);
+	HANDLER(SD):
+		STORE(8);
+	HANDLER(ADDI):
+		X(rd) = X(rs1) + insn->imm;
+		NEXT();
+	HANDLER(SLTI):
+		X(rd) = (st64)X(rs1) < insn->imm;
+		NEXT();
+	HANDLER(SLTIU):
+		X(rd) = X(rs1) < (ut64)insn->imm;
+		NEXT();
+	HANDLER(XORI):
+		X(rd) = X(rs1) ^ insn->imm;
+		NEXT();
+	HANDLER(ORI):
+		X(rd) = X(rs1) | insn->imm;
+		NEXT();
+	HANDLER(ANDI):
+		X(rd) = X(rs1) & insn->imm;
+		NEXT();
+	HANDLER(SLLI):
+		X(rd) = X(rs1) << (insn->imm & 63);
+		NEXT();
+	HANDLER(SRLI):
+		X(rd) = X(rs1) >> (insn->imm & 63);
+		NEXT();
+	HANDLER(SRAI):
+		X(rd) = (st64)X(rs1) >> (insn->imm & 63);
+		NEXT();
+	HANDLER(ADD):
+		X(rd) = X(rs1) + X(rs2);
+		NEXT();
+	HANDLER(SUB):
+		X(rd) = X(rs1) - X(rs2);
+		NEXT();
+	HANDLER(SLL):
+		X(rd) = X(rs1) << (X(rs2) & 63);
+		NEXT();
+	HANDLER(SLT):
+		X(rd) = (st64)X(rs1) < (st64)X(rs2);
+		NEXT();
+	HANDLER(SLTU):
+		X(rd) = X(rs1) < X(rs2);
+		NEXT();
+	HANDLER(XOR):
+		X(rd) = X(rs1) ^ X(rs2);
+		NEXT();
+	HANDLER(SRL):
+		X(rd) = X(rs1) >> (X(rs2) & 63);
+		NEXT();
+	HANDLER(SRA):
+		X(rd) = (st64)X(rs1) >> (X(rs2) & 63);
+		NEXT();
+	HANDLER(OR):
+		X(rd) = X(rs1) | X(rs2);
+		NEXT();
+	HANDLER(AND):
+		X(rd) = X(rs1) & X(rs2);
+		NEXT();
+	HANDLER(ADDIW):
+		X(rd) = sext(X(rs1) + insn->imm);
+		NEXT();
+	HANDLER(SLLIW):
+		X(rd) = sext((ut32)X(rs1) << (insn->imm & 31));
+		NEXT();
+	HANDLER(SRLIW):
+		X(rd) = sext((ut32)X(rs1) >> (insn->imm & 31));
+		NEXT();
+	HANDLER(SRAIW):
+		X(rd) = sext((st32)X(rs1) >> (insn->imm & 31));
+		NEXT();
+	HANDLER(ADDW):
+		X(rd) = sext(X(rs1) + X(rs2));
+		NEXT();
+	HANDLER(SUBW):
+		X(rd) = sext(X(rs1) - X(rs2));
+		NEXT();
+	HANDLER(SLLW):
+		X(rd) = sext((ut32)X(rs1) << (X(rs2) & 31));
+		NEXT();
+	HANDLER(SRLW):
+		X(rd) = sext((ut32)X(rs1) >> (X(rs2) & 31));
+		NEXT();
+	HANDLER(SRAW):
+		X(rd) = sext((st32)X(rs1) >> (X(rs2) & 31));
+		NEXT();
+	HANDLER(FENCE):
+	HANDLER(FENCE_I):
+		/* a single hart, and writes to translated code are already tracked */
+		NEXT();
+	HANDLER(ECALL):
+		pc += insn->size;
+		status = RISCV_EMU_ECALL;
+		goto exit;
+	HANDLER(EBREAK):
+		pc += insn->size;
+		status = RISCV_EMU_EBREAK;
+		goto exit;
+	HANDLER(CSRRS):
+		/* only the user counters can be read */
+		if (insn->rs1 != RISCV_REG_ZERO || insn->imm < RISCV_CSR_CYCLE || insn->imm > RISCV_CSR_INSTRET) {
+			goto illegal;
+		}
+		X(rd) = emu->instret + executed - 1;
+		NEXT();
+	HANDLER(MUL):
+		X(rd) = X(rs1) * X(rs2);
+		NEXT();
+	HANDLER(MULH):
+		X(rd) = riscv_emu_mulh(X(rs1), X(rs2));
+		NEXT();
+	HANDLER(MULHSU):
+		X(rd) = riscv_emu_mulhsu(X(rs1), X(rs2));
+		NEXT();
+	HANDLER(MULHU):
+		X(rd) = riscv_emu_mulhu(X(rs1), X(rs2));
+		NEXT();
+	HANDLER(DIV): {
+		st64 a = X(rs1), b = X(rs2);
+		X(rd) = !b ? UT64_MAX : (b == -1 ? 0 - (ut64)a : (ut64)(a / b));
+		NEXT();
+	}
+	HANDLER(DIVU):
+		X(rd) = !X(rs2) ? UT64_MAX : X(rs1) / X(rs2);
+		NEXT();
+	HANDLER(REM): {
+		st64 a = X(rs1), b = X(rs2);
+		X(rd) = !b ? (ut64)a : (b == -1 ? 0 : (ut64)(a % b));
+		NEXT();
+	}
+	HANDLER(REMU):
+		X(rd) = !X(rs2) ? X(rs1) : X(rs1) % X(rs2);
+		NEXT();
+	HANDLER(MULW):
+		X(rd) = sext(X(rs1) * X(rs2));
+		NEXT();
+	HANDLER(DIVW): {
+		st32 a = X(rs1), b = X(rs2);
+		X(rd) = !b ? UT64_MAX : (b == -1 ? sext(0 - (ut32)a) : (ut64)(st64)(a / b));
+		NEXT();
+	}
+	HANDLER(DIVUW): {
+		ut32 a = X(rs1), b = X(rs2);
+		X(rd) = !b ? UT64_MAX : sext(a / b);
+		NEXT();
+	}
+	HANDLER(REMW): {
+		st32 a = X(rs1), b = X(rs2);
+		X(rd) = !b ? (ut64)(st64)a : (b == -1 ? 0 : (ut64)(st64)(a % b));
+		NEXT();
+	}
+	HANDLER(REMUW): {
+		ut32 a = X(rs1), b = X(rs2);
+		X(rd) = !b ? sext(a) : sext(a % b);
+		NEXT();
+	}
+	HANDLER(LR_W):
+		LR(4);
+	HANDLER(SC_W):
+		SC(4);
+	HANDLER(AMOSWAP_W):
+		AMO(4, src);
+	HANDLER(AMOADD_W):
+		AMO(4, value + src);
+	HANDLER(AMOXOR_W):
+		AMO(4, value ^ src);
+	HANDLER(AMOAND_W):
+		AMO(4, value & src);
+	HANDLER(AMOOR_W):
+		AMO(4, value | src);
+	HANDLER(AMOMIN_W):
+		AMO(4, (st32)value < (st32)src ? value : src);
+	HANDLER(AMOMAX_W):
+		AMO(4, (st32)value > (st32)src ? value : src);
+	HANDLER(AMOMINU_W):
+		AMO(4, (ut32)value < (ut32)src ? value : src);
+	HANDLER(AMOMAXU_W):
+		AMO(4, (ut32)value > (ut32)src ? value : src);
+	HANDLER(LR_D):
+		LR(8);
+	HANDLER(SC_D):
+		SC(8);
+	HANDLER(AMOSWAP_D):
+		AMO(8, src);
+	HANDLER(AMOADD_D):
+		AMO(8, value + src);
+	HANDLER(AMOXOR_D):
+		AMO(8, value ^ src);
+	HANDLER(AMOAND_D):
+		AMO(8, value & src);
+	HANDLER(AMOOR_D):
+		AMO(8, value | src);
+	HANDLER(AMOMIN_D):
+		AMO(8, (st64)value < (st64)src ? value : src);
+	HANDLER(AMOMAX_D):
+		AMO(8, (st64)value > (st64)src ? value : src);
+	HANDLER(AMOMINU_D):
+		AMO(8, value < src ? value : src);
+	HANDLER(AMOMAXU_D):
+		AMO(8, value > src ? value : src);
+	HANDLER(ILLEGAL):
+		goto illegal;
+	HANDLER(END):
+		executed--;
+		goto lookup;
+#if !RISCV_EMU_THREADED
+	}
+#endif
+
+stop:
+	status = RISCV_EMU_STEPS;
+	goto exit;
+illegal:
+	status = RISCV_EMU_ILLEGAL;
+	executed--;
+	goto exit;
+fault:
+	status = RISCV_EMU_FAULT;
+	executed--;
+exit:
+	x[0] = 0;
+	emu->pc = pc;
+	emu->instret += executed;
+	return status;
+}
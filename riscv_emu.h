@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_EMU_H
+#define RISCV_EMU_H
+
+#include "riscv_decode.h"
+
+#define RISCV_EMU_PAGE_BITS  12
+#define RISCV_EMU_PAGE_SIZE  (1ull << RISCV_EMU_PAGE_BITS)
+#define RISCV_EMU_PAGE_MASK  (RISCV_EMU_PAGE_SIZE - 1)
+#define RISCV_EMU_TLB_SIZE   64 /*  pages cached in front of the page table, power of two */
+#define RISCV_EMU_BLOCK_MAX  64 /*  instructions in a translated block */
+#define RISCV_EMU_BLOCKS_MIN 256 /* initial slots of the blocks table, power of two */
+
+typedef enum {
+	RISCV_EMU_STEPS = 0, /* the steps limit was reached */
+	RISCV_EMU_ECALL, /*     ecall executed, pc points to the next instruction */
+	RISCV_EMU_EBREAK, /*    ebreak executed, pc points to the next instruction */
+	RISCV_EMU_ILLEGAL, /*   invalid or not supported instruction at pc */
+	RISCV_EMU_FAULT, /*     access to unmapped memory, the address is in fault */
+} RISCVEmuStatus;
+
+/* decoded instruction in the form used by the interpreter */
+typedef struct riscv_emu_insn_t {
+	ut8 op; /*   handler of the instruction */
+	ut8 size; /* 2 or 4 */
+	ut8 rd;
+	ut8 rs1;
+	ut8 rs2;
+	st64 imm;
+} RISCVEmuInsn;
+
+typedef struct riscv_emu_page_t {
+	ut8 data[RISCV_EMU_PAGE_SIZE];
+	ut32 gen; /*  bumped by the first write after a block was translated from the page */
+	bool code; /* a block was translated from the page since the last write */
+} RISCVEmuPage;
+
+typedef struct riscv_emu_tlb_t {
+	ut64 page; /* page number, UT64_MAX when the entry is empty */
+	RISCVEmuPage *data;
+} RISCVEmuTlb;
+
+/* straight line code ending with a control flow instruction, the only one changing pc */
+typedef struct riscv_emu_block_t {
+	ut64 pc;
+	RISCVEmuPage *page[2]; /* first and last page of the code, can be the same */
+	ut32 gen[2]; /*          generation of the pages at translation time */
+	ut32 n_insns;
+	RISCVEmuInsn insns[];
+} RISCVEmuBlock;
+
+typedef struct riscv_emu_slot_t {
+	ut64 pc;
+	RISCVEmuBlock *block; /* NULL when the slot is empty */
+} RISCVEmuSlot;
+
+/* single hart RV64IMAC, little endian */
+typedef struct riscv_emu_t {
+	ut64 x[32];
+	ut64 pc;
+	ut64 instret; /*     instructions retired */
+	ut64 fault; /*       address of the last faulting access */
+	ut64 reservation; /* address reserved by lr, UT64_MAX when none */
+	HtUP *pages; /*      page number -> RISCVEmuPage */
+	RISCVEmuTlb tlb[RISCV_EMU_TLB_SIZE];
+	RISCVEmuSlot *blocks; /* open addressing with linear probing, keyed by pc */
+	ut32 blocks_mask; /*  slots - 1 */
+	ut32 n_blocks;
+	bool smc; /*          a store wrote to a page holding translated code */
+} RISCVEmu;
+
+RISCV_API RISCVEmu *riscv_emu_new(void);
+RISCV_API void riscv_emu_free(RISCVEmu *emu);
+RISCV_API bool riscv_emu_map(RISCVEmu *emu, ut64 addr, ut64 size);
+RISCV_API bool riscv_emu_read(RISCVEmu *emu, ut64 addr, ut8 *buffer, ut64 size);
+RISCV_API bool riscv_emu_write(RISCVEmu *emu, ut64 addr, const ut8 *buffer, ut64 size);
+RISCV_API void riscv_emu_flush(RISCVEmu *emu);
+RISCV_API RISCVEmuStatus riscv_emu_run(RISCVEmu *emu, ut64 steps);
+
+#endif /* RISCV_EMU_H */
@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_fold.h"
+
+static ut8 memory_access_size(RISCVInsId id) {
+	switch (id) {
+	case RISCV_INS_LB:
+	case RISCV_INS_LBU:
+	case RISCV_INS_SB:
+		return 1;
+	case RISCV_INS_LH:
+	case RISCV_INS_LHU:
+	case RISCV_INS_SH:
+	case RISCV_INS_FLH:
+	case RISCV_INS_FSH:
+		return 2;
+	case RISCV_INS_LW:
+	case RISCV_INS_LWU:
+	case RISCV_INS_SW:
+	case RISCV_INS_FLW:
+	case RISCV_INS_FSW:
+		return 4;
+	case RISCV_INS_LD:
+	case RISCV_INS_SD:
+	case RISCV_INS_FLD:
+	case RISCV_INS_FSD:
+		return 8;
+	case RISCV_INS_FLQ:
+	case RISCV_INS_FSQ:
+		return 16;
+	default:
+		return 0;
+	}
+}
+
+static bool is_store(RISCVInsId id) {
+	switch (id) {
+	case RISCV_INS_SB:
+	case RISCV_INS_SH:
+	case RISCV_INS_SW:
+	case RISCV_INS_SD:
+	case RISCV_INS_FSH:
+	case RISCV_INS_FSW:
+	case RISCV_INS_FSD:
+	case RISCV_INS_FSQ:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool ends_block(RISCVInsId id) {
+	switch (id) {
+	case RISCV_INS_JAL:
+	case RISCV_INS_JALR:
+	case RISCV_INS_BEQ:
+	case RISCV_INS_BNE:
+	case RISCV_INS_BLT:
+	case RISCV_INS_BGE:
+	case RISCV_INS_BLTU:
+	case RISCV_INS_BGEU:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void riscv_fold_init(RISCVFold *fold) {
+	rz_return_if_fail(fold);
+	memset(fold, 0, sizeof(RISCVFold));
+}
+
+/**
+ * Sets the global pointer value, gp relative accesses are then resolved in every block
+ */
+void riscv_fold_set_gp(RISCVFold *fold, ut64 gp) {
+	rz_return_if_fail(fold);
+	fold->gp = gp;
+	fold->pinned |= 1u << RISCV_REG_GP;
+	fold->value[RISCV_REG_GP] = gp;
+	fold->known |= 1u << RISCV_REG_GP;
+}
+
+/**
+ * Sets the thread pointer value, tp relative (tls) accesses are then resolved in every block
+ */
+void riscv_fold_set_tp(RISCVFold *fold, ut64 tp) {
+	rz_return_if_fail(fold);
+	fold->tp = tp;
+	fold->pinned |= 1u << RISCV_REG_TP;
+	fold->value[RISCV_REG_TP] = tp;
+	fold->known |= 1u << RISCV_REG_TP;
+}
+
+/**
+ * Forgets all the tracked values, to be called at the start of each block
+ */
+void riscv_fold_reset(RISCVFold *fold) {
+	rz_return_if_fail(fold);
+	fold->known = fold->pinned;
+	fold->value[RISCV_REG_GP] = fold->gp;
+	fold->value[RISCV_REG_TP] = fold->tp;
+}
+
+/**
+ * Feeds one decoded instruction to the folding stage.
+ * Returns true and fills xref when the instruction completes a lui/auipc pair
+ * or uses gp/tp when their values are set.
+ */
+bool riscv_fold_step(RISCVFold *fold, ut64 pc, const RISCVDecoded *dec, RISCVXref *xref) {
+	rz_return_val_if_fail(fold && dec && xref, false);
+	RISCVRegisters regs;
+	bool found = false;
+	bool base_known = fold->known & (1u << dec->rs1);
+	ut64 target = fold->value[dec->rs1] + dec->imm;
+	ut64 value = 0;
+	bool defines = false;
+
+	switch (dec->id) {
+	case RISCV_INS_LUI:
+		value = dec->imm;
+		defines = true;
+		break;
+	case RISCV_INS_AUIPC:
+		value = pc + dec->imm;
+		defines = true;
+		break;
+	case RISCV_INS_ADDIW:
+		target = (st64)(st32)target;
+		/* fall-thru */
+	case RISCV_INS_ADDI:
+		if (!base_known) {
+			break;
+		}
+		xref->type = RISCV_XREF_ADDR;
+		xref->size = 0;
+		found = true;
+		value = target;
+		defines = true;
+		break;
+	case RISCV_INS_ADD: {
+		/* tls local-exec: lui + add with tp, x0 counts as known zero */
+		ut32 known = fold->known | 1;
+		if (!(known & (1u << dec->rs1)) || !(known & (1u << dec->rs2))) {
+			break;
+		}
+		target = fold->value[dec->rs1] + fold->value[dec->rs2];
+		xref->type = RISCV_XREF_ADDR;
+		xref->size = 0;
+		found = true;
+		value = target;
+		defines = true;
+		break;
+	}
+	case RISCV_INS_JALR:
+		if (!base_known) {
+			break;
+		}
+		xref->type = dec->rd == RISCV_REG_ZERO ? RISCV_XREF_JUMP : RISCV_XREF_CALL;
+		xref->size = 0;
+		found = true;
+		break;
+	default:
+		xref->size = memory_access_size(dec->id);
+		if (!base_known || !xref->size) {
+			break;
+		}
+		xref->type = is_store(dec->id) ? RISCV_XREF_WRITE : RISCV_XREF_READ;
+		found = true;
+		break;
+	}
+
+	if (found) {
+		xref->from = pc;
+		xref->to = target;
+		xref->reg = dec->id == RISCV_INS_ADD && dec->rs2 == RISCV_REG_TP ? RISCV_REG_TP : dec->rs1;
+	}
+
+	riscv_registers(dec, &regs);
+	fold->known &= ~regs.gpr_def;
+	if (defines && dec->rd != RISCV_REG_ZERO) {
+		fold->value[dec->rd] = value;
+		fold->known |= 1u << dec->rd;
+	}
+	return found;
+}
+
+/**
+ * Linear sweep over buffer, appends to xrefs all the addresses built by
+ * lui/auipc pairs or relative to gp/tp when set. Tracking restarts after
+ * every control flow instruction, gp/tp keep the value set by the caller.
+ * Returns the number of xrefs added.
+ */
+ut32 riscv_fold_sweep(RISCVFold *fold, const ut8 *buffer, ut64 size, ut64 base, bool be, RzVector /*<RISCVXref>*/ *xrefs) {
+	rz_return_val_if_fail(fold && buffer && xrefs, 0);
+	RISCVDecoded dec;
+	RISCVXref xref;
+	ut32 count = 0;
+
+	riscv_fold_reset(fold);
+	for (ut64 offset = 0; offset + 4 <= size; offset += 4) {
+		if (!riscv_decode(buffer + offset, size - offset, be, &dec)) {
+			riscv_fold_reset(fold);
+			continue;
+		}
+		if (riscv_fold_step(fold, base + offset, &dec, &xref)) {
+			if (!rz_vector_push(xrefs, &xref)) {
+				break;
+			}
+			count++;
+		}
+		if (ends_block(dec.id)) {
+			riscv_fold_reset(fold);
+		}
+	}
+	return count;
+}
@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_FOLD_H
+#define RISCV_FOLD_H
+
+#include "riscv_decode.h"
+
+typedef enum {
+	RISCV_XREF_ADDR = 0, /* address materialized in a register */
+	RISCV_XREF_READ, /*     memory read */
+	RISCV_XREF_WRITE, /*    memory write */
+	RISCV_XREF_JUMP, /*     indirect jump */
+	RISCV_XREF_CALL, /*     indirect call */
+} RISCVXrefType;
+
+typedef struct riscv_xref_t {
+	ut64 from; /* address of the instruction using the resolved address */
+	ut64 to; /*   resolved address */
+	ut8 type; /*  RISCVXrefType */
+	ut8 size; /*  bytes accessed by loads and stores */
+	ut8 reg; /*   base register, RISCV_REG_GP/RISCV_REG_TP for small data and tls */
+} RISCVXref;
+
+/* upper immediates (lui/auipc) tracked per register within a block */
+typedef struct riscv_fold_t {
+	ut64 value[32];
+	ut32 known; /*  bit N is set when value[N] is valid */
+	ut32 pinned; /* registers with a value known for the whole program (gp/tp) */
+	ut64 gp;
+	ut64 tp;
+} RISCVFold;
+
+RISCV_API void riscv_fold_init(RISCVFold *fold);
+RISCV_API void riscv_fold_set_gp(RISCVFold *fold, ut64 gp);
+RISCV_API void riscv_fold_set_tp(RISCVFold *fold, ut64 tp);
+RISCV_API void riscv_fold_reset(RISCVFold *fold);
+RISCV_API bool riscv_fold_step(RISCVFold *fold, ut64 pc, const RISCVDecoded *dec, RISCVXref *xref);
+RISCV_API ut32 riscv_fold_sweep(RISCVFold *fold, const ut8 *buffer, ut64 size, ut64 base, bool be, RzVector /*<RISCVXref>*/ *xrefs);
+
+#endif /* RISCV_FOLD_H */
@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_functions.h"
+#include "riscv_targets.h"
+
+/* instructions after the stack allocation where ra must be saved */
+#define PROLOGUE_WINDOW 4
+/* smallest chunk worth a thread */
+#define CHUNK_MIN_SIZE 0x10000
+
+typedef struct functions_ctx_t {
+	const ut8 *buffer;
+	ut64 size;
+	ut64 base;
+	bool be;
+	RzVector /*<RISCVFunction>*/ *functions;
+} FunctionsCtx;
+
+typedef struct functions_chunk_t {
+	const FunctionsCtx *ctx;
+	ut64 from; /*    first byte (or function index) handled by the thread */
+	ut64 to; /*      end of the range */
+	RzVector starts; /* ut64, candidates found in the chunk */
+	bool failed; /* a candidate could not be stored */
+} FunctionsChunk;
+
+static int start_cmp(const void *a, const void *b, void *user) {
+	ut64 x = *(const ut64 *)a;
+	ut64 y = *(const ut64 *)b;
+	return x < y ? -1 : x > y;
+}
+
+/* addi sp, sp, -N followed by sd/sw ra, X(sp) */
+static bool is_prologue(const FunctionsCtx *ctx, ut64 offset, const RISCVDecoded *dec) {
+	if (dec->id != RISCV_INS_ADDI || dec->rd != RISCV_REG_SP || dec->rs1 != RISCV_REG_SP || dec->imm >= 0) {
+		return false;
+	}
+	RISCVDecoded next;
+	for (ut32 i = 1; i <= PROLOGUE_WINDOW && offset + (i + 1) * 4 <= ctx->size; ++i) {
+		if (!riscv_decode(ctx->buffer + offset + i * 4, ctx->size - offset - i * 4, ctx->be, &next)) {
+			return false;
+		}
+		if ((next.id == RISCV_INS_SD || next.id == RISCV_INS_SW) &&
+			next.rs1 == RISCV_REG_SP && next.rs2 == RISCV_REG_RA) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void *functions_starts(void *user) {
+	FunctionsChunk *chunk = user;
+	const FunctionsCtx *ctx = chunk->ctx;
+	RISCVDecoded dec;
+
+	/* one more word, so auipc+jalr pairs crossing the chunk end are found */
+	ut64 end = chunk->to + 4 <= ctx->size ? chunk->to + 4 : chunk->to;
+	if (riscv_targets_scan(ctx->buffer + chunk->from, end - chunk->from, ctx->base + chunk->from, ctx->be, RISCV_TARGETS_CALL, &chunk->starts) == RISCV_TARGETS_FAILED) {
+		chunk->failed = true;
+		return NULL;
+	}
+
+	for (ut64 offset = chunk->from; offset + 4 <= chunk->to; offset += 4) {
+		if (!riscv_decode(ctx->buffer + offset, ctx->size - offset, ctx->be, &dec) || !is_prologue(ctx, offset, &dec)) {
+			continue;
+		}
+		ut64 addr = ctx->base + offset;
+		if (!rz_vector_push(&chunk->starts, &addr)) {
+			chunk->failed = true;
+			break;
+		}
+	}
+	return NULL;
+}
+
+/* ret, indirect jumps and jumps leaving [start, next) end the function */
+static bool is_function_end(const RISCVDecoded *dec, ut64 pc, ut64 start, ut64 next) {
+	if (dec->rd != RISCV_REG_ZERO) {
+		return false;
+	} else if (dec->id == RISCV_INS_JALR) {
+		return true;
+	} else if (dec->id == RISCV_INS_JAL) {
+		ut64 target = pc + dec->imm;
+		return target < start || target >= next;
+	}
+	return false;
+}
+
+static void *functions_sizes(void *user) {
+	FunctionsChunk *chunk = user;
+	const FunctionsCtx *ctx = chunk->ctx;
+	ut64 n_functions = rz_vector_len(ctx->functions);
+	RISCVDecoded dec;
+
+	for (ut64 i = chunk->from; i < chunk->to; ++i) {
+		RISCVFunction *fcn = rz_vector_index_ptr(ctx->functions, i);
+		ut64 next = i + 1 < n_functions ? ((RISCVFunction *)rz_vector_index_ptr(ctx->functions, i + 1))->addr : ctx->base + ctx->size;
+		ut64 end = next;
+		for (ut64 pc = fcn->addr; pc + 4 <= next; pc += 4) {
+			ut64 offset = pc - ctx->base;
+			if (riscv_decode(ctx->buffer + offset, ctx->size - offset, ctx->be, &dec) && is_function_end(&dec, pc, fcn->addr, next)) {
+				end = pc + 4;
+			}
+		}
+		fcn->size = end - fcn->addr;
+	}
+	return NULL;
+}
+
+/* runs the chunks on their own threads, or inline when a thread cannot be created */
+static void functions_run(FunctionsChunk *chunks, ut32 n_chunks, RzThreadFunction function) {
+	RzThread **threads = n_chunks > 1 ? RZ_NEWS0(RzThread *, n_chunks) : NULL;
+	for (ut32 i = 0; i < n_chunks; ++i) {
+		if (threads) {
+			threads[i] = rz_th_new(function, &chunks[i]);
+		}
+		if (!threads || !threads[i]) {
+			function(&chunks[i]);
+		}
+	}
+	for (ut32 i = 0; threads && i < n_chunks; ++i) {
+		if (threads[i]) {
+			rz_th_wait(threads[i]);
+			rz_th_free(threads[i]);
+		}
+	}
+	free(threads);
+}
+
+/* splits [0, total) in n_chunks ranges aligned to align */
+static void functions_split(FunctionsChunk *chunks, ut32 n_chunks, ut64 total, ut64 align) {
+	ut64 step = (total / n_chunks + align - 1) / align * align;
+	for (ut32 i = 0; i < n_chunks; ++i) {
+		chunks[i].from = RZ_MIN(i * step, total);
+		chunks[i].to = i + 1 < n_chunks ? RZ_MIN((i + 1) * step, total) : total;
+	}
+}
+
+/**
+ * Partitions the code in buffer into functions.
+ * Entry points are the call targets, the stack allocations followed by a
+ * save of ra and the start of the buffer; each function ends with the last
+ * ret or tail call found before the next entry point.
+ * The buffer is processed by n_threads threads (0 uses the physical cores)
+ * and functions is cleared and filled sorted by address.
+ * Returns false when the candidates cannot be stored.
+ */
+bool riscv_functions_find(const ut8 *buffer, ut64 size, ut64 base, bool be, ut32 n_threads, RzVector /*<RISCVFunction>*/ *functions) {
+	rz_return_val_if_fail(buffer && functions, false);
+	FunctionsCtx ctx = { buffer, size & ~3ull, base, be, functions };
+	RzVector starts;
+	bool ok = false;
+
+	rz_vector_clear(functions);
+	if (!n_threads) {
+		n_threads = rz_th_request_physical_cores(UT32_MAX);
+	}
+	n_threads = RZ_MAX(1, RZ_MIN(n_threads, ctx.size / CHUNK_MIN_SIZE));
+
+	FunctionsChunk *chunks = RZ_NEWS0(FunctionsChunk, n_threads);
+	if (!chunks) {
+		return false;
+	}
+	for (ut32 i = 0; i < n_threads; ++i) {
+		chunks[i].ctx = &ctx;
+		rz_vector_init(&chunks[i].starts, sizeof(ut64), NULL, NULL);
+	}
+	rz_vector_init(&starts, sizeof(ut64), NULL, NULL);
+
+	functions_split(chunks, n_threads, ctx.size, 4);
+	functions_run(chunks, n_threads, functions_starts);
+
+	/* merge the candidates, keeping only aligned entry points inside the buffer */
+	if (ctx.size >= 4 && !rz_vector_push(&starts, &base)) {
+		goto fail;
+	}
+	for (ut32 i = 0; i < n_threads; ++i) {
+		if (chunks[i].failed) {
+			goto fail;
+		}
+		ut64 *addr;
+		rz_vector_foreach(&chunks[i].starts, addr) {
+			if (*addr < base || *addr >= base + ctx.size || (*addr - base) & 3) {
+				continue;
+			}
+			if (!rz_vector_push(&starts, addr)) {
+				goto fail;
+			}
+		}
+	}
+	rz_vector_sort(&starts, start_cmp, false, NULL);
+
+	ut64 *addr, last = UT64_MAX;
+	rz_vector_foreach(&starts, addr) {
+		if (*addr == last) {
+			continue;
+		}
+		RISCVFunction fcn = { *addr, 0 };
+		if (!rz_vector_push(functions, &fcn)) {
+			goto fail;
+		}
+		last = *addr;
+	}
+
+	functions_split(chunks, n_threads, rz_vector_len(functions), 1);
+	functions_run(chunks, n_threads, functions_sizes);
+	ok = true;
+
+fail:
+	for (ut32 i = 0; i < n_threads; ++i) {
+		rz_vector_fini(&chunks[i].starts);
+	}
+	rz_vector_fini(&starts);
+	free(chunks);
+	return ok;
+}
@@ -0,0 +1,16 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_FUNCTIONS_H
+#define RISCV_FUNCTIONS_H
+
+#include "riscv_decode.h"
+
+typedef struct riscv_function_t {
+	ut64 addr; /* entry point */
+	ut64 size; /* bytes up to the last ret or tail call before the next function */
+} RISCVFunction;
+
+RISCV_API bool riscv_functions_find(const ut8 *buffer, ut64 size, ut64 base, bool be, ut32 n_threads, RzVector /*<RISCVFunction>*/ *functions);
+
+#endif /* RISCV_FUNCTIONS_H */
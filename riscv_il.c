@@ -0,0 +1,2968 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode_private.h"
+
+#define RISCV_IL_STACK 6
+
+typedef enum {
+	RISCV_IL_END = 0,
+	RISCV_IL_RS1,
+	RISCV_IL_RS2,
+	RISCV_IL_FS1,
+	RISCV_IL_FS2,
+	RISCV_IL_FS3,
+	RISCV_IL_IMM,
+	RISCV_IL_NEXT,
+	RISCV_IL_TARGET,
+	RISCV_IL_CONST,
+	RISCV_IL_VAR,
+	RISCV_IL_SIGNED,
+	RISCV_IL_UNSIGNED,
+	RISCV_IL_LOAD,
+	RISCV_IL_NOT,
+	RISCV_IL_NEG,
+	RISCV_IL_INV,
+	RISCV_IL_BOOL,
+	RISCV_IL_FLOAT,
+	RISCV_IL_FBITS,
+	RISCV_IL_FNEG,
+	RISCV_IL_FSQRT,
+	RISCV_IL_FTOINT,
+	RISCV_IL_FTOSINT,
+	RISCV_IL_ITOF,
+	RISCV_IL_SITOF,
+	RISCV_IL_FCONV,
+	RISCV_IL_ADD,
+	RISCV_IL_SUB,
+	RISCV_IL_MUL,
+	RISCV_IL_DIV,
+	RISCV_IL_SDIV,
+	RISCV_IL_MOD,
+	RISCV_IL_SMOD,
+	RISCV_IL_AND,
+	RISCV_IL_OR,
+	RISCV_IL_XOR,
+	RISCV_IL_SHL,
+	RISCV_IL_SHR,
+	RISCV_IL_SAR,
+	RISCV_IL_EQ,
+	RISCV_IL_ULT,
+	RISCV_IL_SLT,
+	RISCV_IL_FADD,
+	RISCV_IL_FSUB,
+	RISCV_IL_FMUL,
+	RISCV_IL_FDIV,
+	RISCV_IL_FLT,
+	RISCV_IL_FLE,
+	RISCV_IL_FEQ,
+	RISCV_IL_ITE,
+	RISCV_IL_FMAD,
+	RISCV_IL_SETRD,
+	RISCV_IL_SETFD,
+	RISCV_IL_SETL,
+	RISCV_IL_STORE,
+	RISCV_IL_JMP,
+	RISCV_IL_BRANCH,
+	RISCV_IL_SEQ,
+	RISCV_IL_NOP,
+	RISCV_IL_GOTO,
+} RISCVILOp;
+
+typedef struct riscv_il_code_t {
+	ut8 op; /*  RISCVILOp */
+	ut8 arg; /* size in bits, index of il_consts[] or of il_names[] */
+} RISCVILCode;
+
+typedef struct riscv_il_const_t {
+	ut8 bits;
+	ut64 value;
+} RISCVILConst;
+
+/* operands popped from the stack by each RISCVILOp */
+static const ut8 il_arity[] = {
+	0, /* end */
+	0, /* rs1 */
+	0, /* rs2 */
+	0, /* fs1 */
+	0, /* fs2 */
+	0, /* fs3 */
+	0, /* imm */
+	0, /* next */
+	0, /* target */
+	0, /* const */
+	0, /* var */
+	1, /* signed */
+	1, /* unsigned */
+	1, /* load */
+	1, /* not */
+	1, /* neg */
+	1, /* inv */
+	1, /* bool */
+	1, /* float */
+	1, /* fbits */
+	1, /* fneg */
+	1, /* fsqrt */
+	1, /* ftoint */
+	1, /* ftosint */
+	1, /* itof */
+	1, /* sitof */
+	1, /* fconv */
+	2, /* add */
+	2, /* sub */
+	2, /* mul */
+	2, /* div */
+	2, /* sdiv */
+	2, /* mod */
+	2, /* smod */
+	2, /* and */
+	2, /* or */
+	2, /* xor */
+	2, /* shl */
+	2, /* shr */
+	2, /* sar */
+	2, /* eq */
+	2, /* ult */
+	2, /* slt */
+	2, /* fadd */
+	2, /* fsub */
+	2, /* fmul */
+	2, /* fdiv */
+	2, /* flt */
+	2, /* fle */
+	2, /* feq */
+	3, /* ite */
+	3, /* fmad */
+	1, /* setrd */
+	1, /* setfd */
+	1, /* setl */
+	2, /* store */
+	1, /* jmp */
+	1, /* branch */
+	2, /* seq */
+	0, /* nop */
+	0, /* goto */
+};
+
+static const RISCVILConst il_consts[] = {
+	{ 64, 0xfffffffffffffffeull },
+	{ 64, 0x3full },
+	{ 64, 0x7fffffffffffffffull },
+	{ 64, 0x8000000000000000ull },
+	{ 64, 0xffffffff00000000ull },
+	{ 32, 0x7fffffffull },
+	{ 32, 0x80000000ull },
+	{ 32, 0x1full },
+	{ 64, 0x0ull },
+	{ 128, 0x40ull },
+	{ 64, 0xffffffffffffffffull },
+	{ 32, 0x0ull },
+	{ 32, 0xffffffffull },
+};
+
+/* local variables and goto labels */
+static const char *il_names[] = {
+	"tgt",
+	"ecall",
+	"ebreak",
+	"val",
+};
+
+static const RISCVILCode il_code[] = {
+	{ RISCV_IL_END, 0 }, /* end */
+	{ RISCV_IL_NEXT, 0 }, /* jal */
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_TARGET, 0 },
+	{ RISCV_IL_JMP, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_IMM, 0 }, /* lui */
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_TARGET, 0 }, /* auipc */
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* beq */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_BRANCH, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* bne */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_INV, 0 },
+	{ RISCV_IL_BRANCH, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* blt */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_SLT, 0 },
+	{ RISCV_IL_BRANCH, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* bge */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_SLT, 0 },
+	{ RISCV_IL_INV, 0 },
+	{ RISCV_IL_BRANCH, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* bltu */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_ULT, 0 },
+	{ RISCV_IL_BRANCH, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* bgeu */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_ULT, 0 },
+	{ RISCV_IL_INV, 0 },
+	{ RISCV_IL_BRANCH, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* jalr */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_CONST, 0 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_SETL, 0 },
+	{ RISCV_IL_NEXT, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_VAR, 0 },
+	{ RISCV_IL_JMP, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* addi */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* slti */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_SLT, 0 },
+	{ RISCV_IL_BOOL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sltiu */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ULT, 0 },
+	{ RISCV_IL_BOOL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* xori */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_XOR, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* ori */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* andi */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* lb */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_LOAD, 8 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* lh */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_LOAD, 16 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* lw */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* lbu */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_LOAD, 8 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* lhu */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_LOAD, 16 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sb */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 8 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sh */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 16 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sw */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_NOP, 0 }, /* fence */
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* add */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sub */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_SUB, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sll */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_CONST, 1 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_SHL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* slt */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_SLT, 0 },
+	{ RISCV_IL_BOOL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sltu */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_ULT, 0 },
+	{ RISCV_IL_BOOL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* xor */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_XOR, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* srl */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_CONST, 1 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_SHR, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sra */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_CONST, 1 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_SAR, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* or */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* and */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* fld */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_LOAD, 64 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* fsd */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fmadd.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS3, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FMAD, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fmsub.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS3, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FNEG, 0 },
+	{ RISCV_IL_FMAD, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fnmsub.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FNEG, 0 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS3, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FMAD, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fnmadd.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FNEG, 0 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS3, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FNEG, 0 },
+	{ RISCV_IL_FMAD, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fadd.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FADD, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fsub.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FSUB, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fmul.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FMUL, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fdiv.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FDIV, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fsgnj.d */
+	{ RISCV_IL_CONST, 2 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_CONST, 3 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fsgnjn.d */
+	{ RISCV_IL_CONST, 2 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_NOT, 0 },
+	{ RISCV_IL_CONST, 3 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fsgnjx.d */
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_CONST, 3 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_XOR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fmin.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FLT, 0 },
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS2, 0 }, /* fmax.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FLT, 0 },
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fle.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FLE, 0 },
+	{ RISCV_IL_BOOL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* flt.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FLT, 0 },
+	{ RISCV_IL_BOOL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* feq.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FEQ, 0 },
+	{ RISCV_IL_BOOL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fcvt.s.d */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FCONV, 32 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fcvt.d.s */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FCONV, 64 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fsqrt.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FSQRT, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fcvt.w.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FTOSINT, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fcvt.wu.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FTOINT, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* fcvt.d.w */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SITOF, 64 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* fcvt.d.wu */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_ITOF, 64 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* flw */
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* fsw */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fmadd.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS3, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FMAD, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fmsub.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS3, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FNEG, 0 },
+	{ RISCV_IL_FMAD, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fnmsub.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FNEG, 0 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS3, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FMAD, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fnmadd.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FNEG, 0 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS3, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FNEG, 0 },
+	{ RISCV_IL_FMAD, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fadd.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FADD, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fsub.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FSUB, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fmul.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FMUL, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fdiv.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FDIV, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fsgnj.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 5 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 6 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fsgnjn.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 5 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_NOT, 0 },
+	{ RISCV_IL_CONST, 6 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fsgnjx.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 6 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_XOR, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fmin.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FLT, 0 },
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fmax.s */
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FLT, 0 },
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fle.s */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FLE, 0 },
+	{ RISCV_IL_BOOL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* flt.s */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FLT, 0 },
+	{ RISCV_IL_BOOL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* feq.s */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FEQ, 0 },
+	{ RISCV_IL_BOOL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fsqrt.s */
+	{ RISCV_IL_FS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FSQRT, 0 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fcvt.w.s */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FTOSINT, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fcvt.wu.s */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FTOINT, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fcvt.s.w */
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SITOF, 32 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fcvt.s.wu */
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_ITOF, 32 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fmv.x.w */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fmv.w.x */
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* addiw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* ld */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_LOAD, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* lwu */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sd */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* slli */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_SHL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* srli */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_SHR, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* srai */
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_SAR, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* slliw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SHL, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* srliw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SHR, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sraiw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_IMM, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SAR, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* addw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* subw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SUB, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sllw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 7 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_SHL, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* srlw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 7 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_SHR, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sraw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 7 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_SAR, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_GOTO, 1 }, /* ecall */
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_GOTO, 2 }, /* ebreak */
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amoadd.w */
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amoxor.w */
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_XOR, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amoor.w */
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amoand.w */
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amomin.w */
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SLT, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amomax.w */
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SLT, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amominu.w */
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_ULT, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amomaxu.w */
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_ULT, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amoswap.w */
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sc.w */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_CONST, 8 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* lr.w */
+	{ RISCV_IL_LOAD, 32 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amoadd.d */
+	{ RISCV_IL_LOAD, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_ADD, 0 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amoxor.d */
+	{ RISCV_IL_LOAD, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_XOR, 0 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amoor.d */
+	{ RISCV_IL_LOAD, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amoand.d */
+	{ RISCV_IL_LOAD, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_AND, 0 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amomin.d */
+	{ RISCV_IL_LOAD, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_SLT, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amomax.d */
+	{ RISCV_IL_LOAD, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_SLT, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amominu.d */
+	{ RISCV_IL_LOAD, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_ULT, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amomaxu.d */
+	{ RISCV_IL_LOAD, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_ULT, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* amoswap.d */
+	{ RISCV_IL_LOAD, 64 },
+	{ RISCV_IL_SETL, 3 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_VAR, 3 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* sc.d */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_STORE, 0 },
+	{ RISCV_IL_CONST, 8 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_SEQ, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* lr.d */
+	{ RISCV_IL_LOAD, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* mul */
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_MUL, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* mulh */
+	{ RISCV_IL_SIGNED, 128 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_SIGNED, 128 },
+	{ RISCV_IL_MUL, 0 },
+	{ RISCV_IL_CONST, 9 },
+	{ RISCV_IL_SHR, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* mulhsu */
+	{ RISCV_IL_SIGNED, 128 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 128 },
+	{ RISCV_IL_MUL, 0 },
+	{ RISCV_IL_CONST, 9 },
+	{ RISCV_IL_SHR, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* mulhu */
+	{ RISCV_IL_UNSIGNED, 128 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 128 },
+	{ RISCV_IL_MUL, 0 },
+	{ RISCV_IL_CONST, 9 },
+	{ RISCV_IL_SHR, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS2, 0 }, /* div */
+	{ RISCV_IL_CONST, 8 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_CONST, 10 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_CONST, 10 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_NEG, 0 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_SDIV, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS2, 0 }, /* divu */
+	{ RISCV_IL_CONST, 8 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_CONST, 10 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_DIV, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS2, 0 }, /* rem */
+	{ RISCV_IL_CONST, 8 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_CONST, 10 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_CONST, 8 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_SMOD, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS2, 0 }, /* remu */
+	{ RISCV_IL_CONST, 8 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_MOD, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* mulw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_MUL, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS2, 0 }, /* divw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 11 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_CONST, 12 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 12 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_NEG, 0 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SDIV, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS2, 0 }, /* divuw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 11 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_CONST, 12 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_DIV, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS2, 0 }, /* remw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 11 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 12 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_CONST, 11 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_SMOD, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS2, 0 }, /* remuw */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_CONST, 11 },
+	{ RISCV_IL_EQ, 0 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_RS2, 0 },
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_MOD, 0 },
+	{ RISCV_IL_ITE, 0 },
+	{ RISCV_IL_SIGNED, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fcvt.l.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FTOSINT, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fcvt.lu.d */
+	{ RISCV_IL_FLOAT, 64 },
+	{ RISCV_IL_FTOINT, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* fcvt.d.l */
+	{ RISCV_IL_SITOF, 64 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* fcvt.d.lu */
+	{ RISCV_IL_ITOF, 64 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fmv.x.d */
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_RS1, 0 }, /* fmv.d.x */
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fcvt.l.s */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FTOSINT, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_FS1, 0 }, /* fcvt.lu.s */
+	{ RISCV_IL_UNSIGNED, 32 },
+	{ RISCV_IL_FLOAT, 32 },
+	{ RISCV_IL_FTOINT, 64 },
+	{ RISCV_IL_SETRD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fcvt.s.l */
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_SITOF, 32 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+	{ RISCV_IL_CONST, 4 }, /* fcvt.s.lu */
+	{ RISCV_IL_RS1, 0 },
+	{ RISCV_IL_ITOF, 32 },
+	{ RISCV_IL_FBITS, 0 },
+	{ RISCV_IL_UNSIGNED, 64 },
+	{ RISCV_IL_OR, 0 },
+	{ RISCV_IL_SETFD, 0 },
+	{ RISCV_IL_END, 0 },
+};
+
+/* offset in il_code[] of the template of each instruction, 0 when it cannot be lifted */
+static const ut16 il_templates[RISCV_INS_COUNT] = {
+	1, /* jal */
+	7, /* lui */
+	10, /* auipc */
+	13, /* beq */
+	18, /* bne */
+	24, /* blt */
+	29, /* bge */
+	35, /* bltu */
+	40, /* bgeu */
+	46, /* jalr */
+	59, /* addi */
+	64, /* slti */
+	70, /* sltiu */
+	76, /* xori */
+	81, /* ori */
+	86, /* andi */
+	91, /* lb */
+	98, /* lh */
+	105, /* lw */
+	112, /* lbu */
+	119, /* lhu */
+	126, /* sb */
+	133, /* sh */
+	140, /* sw */
+	147, /* fence */
+	147, /* fence.i */
+	149, /* add */
+	154, /* sub */
+	159, /* sll */
+	166, /* slt */
+	172, /* sltu */
+	178, /* xor */
+	183, /* srl */
+	190, /* sra */
+	197, /* or */
+	202, /* and */
+	207, /* fld */
+	213, /* fsd */
+	219, /* fmadd.d */
+	229, /* fmsub.d */
+	240, /* fnmsub.d */
+	251, /* fnmadd.d */
+	263, /* fadd.d */
+	271, /* fsub.d */
+	279, /* fmul.d */
+	287, /* fdiv.d */
+	295, /* fsgnj.d */
+	304, /* fsgnjn.d */
+	314, /* fsgnjx.d */
+	321, /* fmin.d */
+	334, /* fmax.d */
+	347, /* fle.d */
+	355, /* flt.d */
+	363, /* feq.d */
+	371, /* fcvt.s.d */
+	380, /* fcvt.d.s */
+	387, /* fsqrt.d */
+	393, /* fcvt.w.d */
+	399, /* fcvt.wu.d */
+	405, /* fcvt.d.w */
+	411, /* fcvt.d.wu */
+	0, /* fclass.d */
+	417, /* flw */
+	426, /* fsw */
+	433, /* fmadd.s */
+	449, /* fmsub.s */
+	466, /* fnmsub.s */
+	483, /* fnmadd.s */
+	501, /* fadd.s */
+	514, /* fsub.s */
+	527, /* fmul.s */
+	540, /* fdiv.s */
+	553, /* fsgnj.s */
+	567, /* fsgnjn.s */
+	582, /* fsgnjx.s */
+	594, /* fmin.s */
+	614, /* fmax.s */
+	634, /* fle.s */
+	644, /* flt.s */
+	654, /* feq.s */
+	664, /* fsqrt.s */
+	674, /* fcvt.w.s */
+	681, /* fcvt.wu.s */
+	688, /* fcvt.s.w */
+	697, /* fcvt.s.wu */
+	706, /* fmv.x.w */
+	0, /* fclass.s */
+	711, /* fmv.w.x */
+	0, /* flq */
+	0, /* fsq */
+	0, /* fmadd.q */
+	0, /* fmsub.q */
+	0, /* fnmsub.q */
+	0, /* fnmadd.q */
+	0, /* fadd.q */
+	0, /* fsub.q */
+	0, /* fmul.q */
+	0, /* fdiv.q */
+	0, /* fsgnj.q */
+	0, /* fsgnjn.q */
+	0, /* fsgnjx.q */
+	0, /* fmin.q */
+	0, /* fmax.q */
+	0, /* fle.q */
+	0, /* flt.q */
+	0, /* feq.q */
+	0, /* fcvt.s.q */
+	0, /* fcvt.q.s */
+	0, /* fcvt.d.q */
+	0, /* fcvt.q.d */
+	0, /* fsqrt.q */
+	0, /* fcvt.w.q */
+	0, /* fcvt.wu.q */
+	0, /* fcvt.q.w */
+	0, /* fcvt.q.wu */
+	0, /* fclass.q */
+	0, /* flh */
+	0, /* fsh */
+	0, /* fmadd.h */
+	0, /* fmsub.h */
+	0, /* fnmsub.h */
+	0, /* fnmadd.h */
+	0, /* fadd.h */
+	0, /* fsub.h */
+	0, /* fmul.h */
+	0, /* fdiv.h */
+	0, /* fsgnj.h */
+	0, /* fsgnjn.h */
+	0, /* fsgnjx.h */
+	0, /* fmin.h */
+	0, /* fmax.h */
+	0, /* fle.h */
+	0, /* flt.h */
+	0, /* feq.h */
+	0, /* fcvt.h.s */
+	0, /* fcvt.s.h */
+	0, /* fsqrt.h */
+	0, /* fcvt.w.h */
+	0, /* fcvt.wu.h */
+	0, /* fcvt.h.w */
+	0, /* fcvt.h.wu */
+	0, /* fmv.x.h */
+	0, /* fclass.h */
+	0, /* fmv.h.x */
+	718, /* addiw */
+	726, /* ld */
+	732, /* lwu */
+	739, /* sd */
+	745, /* slli */
+	750, /* srli */
+	755, /* srai */
+	760, /* slliw */
+	768, /* srliw */
+	776, /* sraiw */
+	784, /* addw */
+	792, /* subw */
+	800, /* sllw */
+	810, /* srlw */
+	820, /* sraw */
+	0, /* csrrw */
+	0, /* csrrs */
+	0, /* csrrc */
+	0, /* csrrwi */
+	0, /* csrrsi */
+	0, /* csrrci */
+	147, /* sfence.vma */
+	830, /* ecall */
+	832, /* ebreak */
+	0, /* sret */
+	0, /* mret */
+	0, /* dret */
+	147, /* wfi */
+	0, /* prefetch.i */
+	0, /* prefetch.r */
+	0, /* prefetch.w */
+	0, /* cbo.clean */
+	0, /* cbo.flush */
+	0, /* cbo.inval */
+	0, /* cbo.zero */
+	0, /* fsri */
+	0, /* cmix */
+	0, /* cmov */
+	0, /* fsl */
+	0, /* fsr */
+	0, /* sloi */
+	0, /* sroi */
+	0, /* rori */
+	0, /* bclri */
+	0, /* bseti */
+	0, /* binvi */
+	0, /* bexti */
+	0, /* gorci */
+	0, /* grevi */
+	0, /* andn */
+	0, /* orn */
+	0, /* xnor */
+	0, /* slo */
+	0, /* sro */
+	0, /* rol */
+	0, /* ror */
+	0, /* bclr */
+	0, /* bset */
+	0, /* binv */
+	0, /* bext */
+	0, /* gorc */
+	0, /* grev */
+	0, /* sh1add */
+	0, /* sh2add */
+	0, /* sh3add */
+	0, /* clmul */
+	0, /* clmulr */
+	0, /* clmulh */
+	0, /* min */
+	0, /* minu */
+	0, /* max */
+	0, /* maxu */
+	0, /* shfl */
+	0, /* unshfl */
+	0, /* bcompress */
+	0, /* bdecompress */
+	0, /* pack */
+	0, /* packu */
+	0, /* packh */
+	0, /* bfp */
+	0, /* shfli */
+	0, /* unshfli */
+	0, /* xperm4 */
+	0, /* xperm8 */
+	0, /* xperm16 */
+	0, /* clz */
+	0, /* ctz */
+	0, /* cpop */
+	0, /* sext.b */
+	0, /* sext.h */
+	0, /* crc32.b */
+	0, /* crc32.h */
+	0, /* crc32.w */
+	0, /* crc32c.b */
+	0, /* crc32c.h */
+	0, /* crc32c.w */
+	0, /* fslw */
+	0, /* fsrw */
+	0, /* fsriw */
+	0, /* slli.uw */
+	0, /* bmator */
+	0, /* bmatxor */
+	0, /* add.uw */
+	0, /* slow */
+	0, /* srow */
+	0, /* rolw */
+	0, /* rorw */
+	0, /* gorcw */
+	0, /* grevw */
+	0, /* sloiw */
+	0, /* sroiw */
+	0, /* roriw */
+	0, /* gorciw */
+	0, /* greviw */
+	0, /* sh1add.uw */
+	0, /* sh2add.uw */
+	0, /* sh3add.uw */
+	0, /* shflw */
+	0, /* unshflw */
+	0, /* bcompressw */
+	0, /* bdecompressw */
+	0, /* packw */
+	0, /* packuw */
+	0, /* bfpw */
+	0, /* xperm32 */
+	0, /* bmatflip */
+	0, /* crc32.d */
+	0, /* crc32c.d */
+	0, /* clzw */
+	0, /* ctzw */
+	0, /* cpopw */
+	0, /* bpick */
+	0, /* bitrevi */
+	0, /* srai.u */
+	0, /* add8 */
+	0, /* add16 */
+	0, /* add64 */
+	0, /* ave */
+	0, /* bitrev */
+	0, /* cmpeq8 */
+	0, /* cmpeq16 */
+	0, /* cras16 */
+	0, /* crsa16 */
+	0, /* kadd8 */
+	0, /* kadd16 */
+	0, /* kadd64 */
+	0, /* kaddh */
+	0, /* kaddw */
+	0, /* kcras16 */
+	0, /* kcrsa16 */
+	0, /* kdmbb */
+	0, /* kdmbt */
+	0, /* kdmtt */
+	0, /* kdmabb */
+	0, /* kdmabt */
+	0, /* kdmatt */
+	0, /* khm8 */
+	0, /* khmx8 */
+	0, /* khm16 */
+	0, /* khmx16 */
+	0, /* khmbb */
+	0, /* khmbt */
+	0, /* khmtt */
+	0, /* kmabb */
+	0, /* kmabt */
+	0, /* kmatt */
+	0, /* kmada */
+	0, /* kmaxda */
+	0, /* kmads */
+	0, /* kmadrs */
+	0, /* kmaxds */
+	0, /* kmar64 */
+	0, /* kmda */
+	0, /* kmxda */
+	0, /* kmmac */
+	0, /* kmmac.u */
+	0, /* kmmawb */
+	0, /* kmmawb.u */
+	0, /* kmmawb2 */
+	0, /* kmmawb2.u */
+	0, /* kmmawt */
+	0, /* kmmawt.u */
+	0, /* kmmawt2 */
+	0, /* kmmawt2.u */
+	0, /* kmmsb */
+	0, /* kmmsb.u */
+	0, /* kmmwb2 */
+	0, /* kmmwb2.u */
+	0, /* kmmwt2 */
+	0, /* kmmwt2.u */
+	0, /* kmsda */
+	0, /* kmsxda */
+	0, /* kmsr64 */
+	0, /* ksllw */
+	0, /* kslliw */
+	0, /* ksll8 */
+	0, /* ksll16 */
+	0, /* kslra8 */
+	0, /* kslra8.u */
+	0, /* kslra16 */
+	0, /* kslra16.u */
+	0, /* kslraw */
+	0, /* kslraw.u */
+	0, /* kstas16 */
+	0, /* kstsa16 */
+	0, /* ksub8 */
+	0, /* ksub16 */
+	0, /* ksub64 */
+	0, /* ksubh */
+	0, /* ksubw */
+	0, /* kwmmul */
+	0, /* kwmmul.u */
+	0, /* maddr32 */
+	0, /* maxw */
+	0, /* minw */
+	0, /* msubr32 */
+	0, /* mulr64 */
+	0, /* mulsr64 */
+	0, /* pbsad */
+	0, /* pbsada */
+	0, /* pkbb16 */
+	0, /* pkbt16 */
+	0, /* pktt16 */
+	0, /* pktb16 */
+	0, /* radd8 */
+	0, /* radd16 */
+	0, /* radd64 */
+	0, /* raddw */
+	0, /* rcras16 */
+	0, /* rcrsa16 */
+	0, /* rstas16 */
+	0, /* rstsa16 */
+	0, /* rsub8 */
+	0, /* rsub16 */
+	0, /* rsub64 */
+	0, /* rsubw */
+	0, /* sclip32 */
+	0, /* scmple8 */
+	0, /* scmple16 */
+	0, /* scmplt8 */
+	0, /* scmplt16 */
+	0, /* sll8 */
+	0, /* sll16 */
+	0, /* smal */
+	0, /* smalbb */
+	0, /* smalbt */
+	0, /* smaltt */
+	0, /* smalda */
+	0, /* smalxda */
+	0, /* smalds */
+	0, /* smaldrs */
+	0, /* smalxds */
+	0, /* smar64 */
+	0, /* smaqa */
+	0, /* smaqa.su */
+	0, /* smax8 */
+	0, /* smax16 */
+	0, /* smbb16 */
+	0, /* smbt16 */
+	0, /* smtt16 */
+	0, /* smds */
+	0, /* smdrs */
+	0, /* smxds */
+	0, /* smin8 */
+	0, /* smin16 */
+	0, /* smmul */
+	0, /* smmul.u */
+	0, /* smmwb */
+	0, /* smmwb.u */
+	0, /* smmwt */
+	0, /* smmwt.u */
+	0, /* smslda */
+	0, /* smslxda */
+	0, /* smsr64 */
+	0, /* smul8 */
+	0, /* smulx8 */
+	0, /* smul16 */
+	0, /* smulx16 */
+	0, /* sra.u */
+	0, /* sra8 */
+	0, /* sra8.u */
+	0, /* sra16 */
+	0, /* sra16.u */
+	0, /* srl8 */
+	0, /* srl8.u */
+	0, /* srl16 */
+	0, /* srl16.u */
+	0, /* stas16 */
+	0, /* stsa16 */
+	0, /* sub8 */
+	0, /* sub16 */
+	0, /* sub64 */
+	0, /* uclip32 */
+	0, /* ucmple8 */
+	0, /* ucmple16 */
+	0, /* ucmplt8 */
+	0, /* ucmplt16 */
+	0, /* ukadd8 */
+	0, /* ukadd16 */
+	0, /* ukadd64 */
+	0, /* ukaddh */
+	0, /* ukaddw */
+	0, /* ukcras16 */
+	0, /* ukcrsa16 */
+	0, /* ukmar64 */
+	0, /* ukmsr64 */
+	0, /* ukstas16 */
+	0, /* ukstsa16 */
+	0, /* uksub8 */
+	0, /* uksub16 */
+	0, /* uksub64 */
+	0, /* uksubh */
+	0, /* uksubw */
+	0, /* umar64 */
+	0, /* umaqa */
+	0, /* umax8 */
+	0, /* umax16 */
+	0, /* umin8 */
+	0, /* umin16 */
+	0, /* umsr64 */
+	0, /* umul8 */
+	0, /* umulx8 */
+	0, /* umul16 */
+	0, /* umulx16 */
+	0, /* uradd8 */
+	0, /* uradd16 */
+	0, /* uradd64 */
+	0, /* uraddw */
+	0, /* urcras16 */
+	0, /* urcrsa16 */
+	0, /* urstas16 */
+	0, /* urstsa16 */
+	0, /* ursub8 */
+	0, /* ursub16 */
+	0, /* ursub64 */
+	0, /* ursubw */
+	0, /* wexti */
+	0, /* wext */
+	0, /* add32 */
+	0, /* cras32 */
+	0, /* crsa32 */
+	0, /* kadd32 */
+	0, /* kcras32 */
+	0, /* kcrsa32 */
+	0, /* kdmbb16 */
+	0, /* kdmbt16 */
+	0, /* kdmtt16 */
+	0, /* kdmabb16 */
+	0, /* kdmabt16 */
+	0, /* kdmatt16 */
+	0, /* khmbb16 */
+	0, /* khmbt16 */
+	0, /* khmtt16 */
+	0, /* kmabb32 */
+	0, /* kmabt32 */
+	0, /* kmatt32 */
+	0, /* kmaxda32 */
+	0, /* kmda32 */
+	0, /* kmxda32 */
+	0, /* kmads32 */
+	0, /* kmadrs32 */
+	0, /* kmaxds32 */
+	0, /* kmsda32 */
+	0, /* kmsxda32 */
+	0, /* ksll32 */
+	0, /* kslli32 */
+	0, /* kslra32 */
+	0, /* kslra32.u */
+	0, /* kstas32 */
+	0, /* kstsa32 */
+	0, /* ksub32 */
+	0, /* pkbb32 */
+	0, /* pkbt32 */
+	0, /* pktt32 */
+	0, /* pktb32 */
+	0, /* radd32 */
+	0, /* rcras32 */
+	0, /* rcrsa32 */
+	0, /* rstas32 */
+	0, /* rstsa32 */
+	0, /* rsub32 */
+	0, /* sll32 */
+	0, /* slli32 */
+	0, /* smax32 */
+	0, /* smbt32 */
+	0, /* smtt32 */
+	0, /* smds32 */
+	0, /* smdrs32 */
+	0, /* smxds32 */
+	0, /* smin32 */
+	0, /* sra32 */
+	0, /* sra32.u */
+	0, /* srai32 */
+	0, /* srai32.u */
+	0, /* sraiw.u */
+	0, /* srl32 */
+	0, /* srl32.u */
+	0, /* srli32 */
+	0, /* srli32.u */
+	0, /* stas32 */
+	0, /* stsa32 */
+	0, /* sub32 */
+	0, /* ukadd32 */
+	0, /* ukcras32 */
+	0, /* ukcrsa32 */
+	0, /* ukstas32 */
+	0, /* ukstsa32 */
+	0, /* uksub32 */
+	0, /* umax32 */
+	0, /* umin32 */
+	0, /* uradd32 */
+	0, /* urcras32 */
+	0, /* urcrsa32 */
+	0, /* urstas32 */
+	0, /* urstsa32 */
+	0, /* ursub32 */
+	0, /* kslli16 */
+	0, /* sclip16 */
+	0, /* slli16 */
+	0, /* srai16 */
+	0, /* srai16.u */
+	0, /* srli16 */
+	0, /* srli16.u */
+	0, /* uclip16 */
+	0, /* insb */
+	0, /* kslli8 */
+	0, /* sclip8 */
+	0, /* slli8 */
+	0, /* srai8 */
+	0, /* srai8.u */
+	0, /* srli8 */
+	0, /* srli8.u */
+	0, /* uclip8 */
+	0, /* clrs8 */
+	0, /* clrs16 */
+	0, /* clrs32 */
+	0, /* clo8 */
+	0, /* clo16 */
+	0, /* clo32 */
+	0, /* clz8 */
+	0, /* clz16 */
+	0, /* clz32 */
+	0, /* kabs8 */
+	0, /* kabs16 */
+	0, /* kabsw */
+	0, /* sunpkd810 */
+	0, /* sunpkd820 */
+	0, /* sunpkd830 */
+	0, /* sunpkd831 */
+	0, /* sunpkd832 */
+	0, /* swap8 */
+	0, /* zunpkd810 */
+	0, /* zunpkd820 */
+	0, /* zunpkd830 */
+	0, /* zunpkd831 */
+	0, /* zunpkd832 */
+	0, /* kabs32 */
+	0, /* vluxei8.v */
+	0, /* vluxei16.v */
+	0, /* vluxei32.v */
+	0, /* vluxei64.v */
+	0, /* vluxei128.v */
+	0, /* vluxei256.v */
+	0, /* vluxei512.v */
+	0, /* vluxei1024.v */
+	0, /* vsuxei8.v */
+	0, /* vsuxei16.v */
+	0, /* vsuxei32.v */
+	0, /* vsuxei64.v */
+	0, /* vsuxei128.v */
+	0, /* vsuxei256.v */
+	0, /* vsuxei512.v */
+	0, /* vsuxei1024.v */
+	0, /* vlse8.v */
+	0, /* vlse16.v */
+	0, /* vlse32.v */
+	0, /* vlse64.v */
+	0, /* vlse128.v */
+	0, /* vlse256.v */
+	0, /* vlse512.v */
+	0, /* vlse1024.v */
+	0, /* vsse8.v */
+	0, /* vsse16.v */
+	0, /* vsse32.v */
+	0, /* vsse64.v */
+	0, /* vsse128.v */
+	0, /* vsse256.v */
+	0, /* vsse512.v */
+	0, /* vsse1024.v */
+	0, /* vloxei8.v */
+	0, /* vloxei16.v */
+	0, /* vloxei32.v */
+	0, /* vloxei64.v */
+	0, /* vloxei128.v */
+	0, /* vloxei256.v */
+	0, /* vloxei512.v */
+	0, /* vloxei1024.v */
+	0, /* vsoxei8.v */
+	0, /* vsoxei16.v */
+	0, /* vsoxei32.v */
+	0, /* vsoxei64.v */
+	0, /* vsoxei128.v */
+	0, /* vsoxei256.v */
+	0, /* vsoxei512.v */
+	0, /* vsoxei1024.v */
+	0, /* vle8.v */
+	0, /* vle16.v */
+	0, /* vle32.v */
+	0, /* vle64.v */
+	0, /* vle128.v */
+	0, /* vle256.v */
+	0, /* vle512.v */
+	0, /* vle1024.v */
+	0, /* vse8.v */
+	0, /* vse16.v */
+	0, /* vse32.v */
+	0, /* vse64.v */
+	0, /* vse128.v */
+	0, /* vse256.v */
+	0, /* vse512.v */
+	0, /* vse1024.v */
+	0, /* vle8ff.v */
+	0, /* vle16ff.v */
+	0, /* vle32ff.v */
+	0, /* vle64ff.v */
+	0, /* vle128ff.v */
+	0, /* vle256ff.v */
+	0, /* vle512ff.v */
+	0, /* vle1024ff.v */
+	0, /* vsetvli */
+	0, /* vsetivli */
+	0, /* vamoswapei8.v */
+	0, /* vamoaddei8.v */
+	0, /* vamoxorei8.v */
+	0, /* vamoandei8.v */
+	0, /* vamoorei8.v */
+	0, /* vamominei8.v */
+	0, /* vamomaxei8.v */
+	0, /* vamominuei8.v */
+	0, /* vamomaxuei8.v */
+	0, /* vamoswapei16.v */
+	0, /* vamoaddei16.v */
+	0, /* vamoxorei16.v */
+	0, /* vamoandei16.v */
+	0, /* vamoorei16.v */
+	0, /* vamominei16.v */
+	0, /* vamomaxei16.v */
+	0, /* vamominuei16.v */
+	0, /* vamomaxuei16.v */
+	0, /* vamoswapei32.v */
+	0, /* vamoaddei32.v */
+	0, /* vamoxorei32.v */
+	0, /* vamoandei32.v */
+	0, /* vamoorei32.v */
+	0, /* vamominei32.v */
+	0, /* vamomaxei32.v */
+	0, /* vamominuei32.v */
+	0, /* vamomaxuei32.v */
+	0, /* vamoswapei64.v */
+	0, /* vamoaddei64.v */
+	0, /* vamoxorei64.v */
+	0, /* vamoandei64.v */
+	0, /* vamoorei64.v */
+	0, /* vamominei64.v */
+	0, /* vamomaxei64.v */
+	0, /* vamominuei64.v */
+	0, /* vamomaxuei64.v */
+	0, /* vfadd.vf */
+	0, /* vfsub.vf */
+	0, /* vfmin.vf */
+	0, /* vfmax.vf */
+	0, /* vfsgnj.vf */
+	0, /* vfsgnjn.vf */
+	0, /* vfsgnjx.vf */
+	0, /* vfslide1up.vf */
+	0, /* vfslide1down.vf */
+	0, /* vmfeq.vf */
+	0, /* vmfle.vf */
+	0, /* vmflt.vf */
+	0, /* vmfne.vf */
+	0, /* vmfgt.vf */
+	0, /* vmfge.vf */
+	0, /* vfdiv.vf */
+	0, /* vfrdiv.vf */
+	0, /* vfmul.vf */
+	0, /* vfrsub.vf */
+	0, /* vfmadd.vf */
+	0, /* vfnmadd.vf */
+	0, /* vfmsub.vf */
+	0, /* vfnmsub.vf */
+	0, /* vfmacc.vf */
+	0, /* vfnmacc.vf */
+	0, /* vfmsac.vf */
+	0, /* vfnmsac.vf */
+	0, /* vfwadd.vf */
+	0, /* vfwsub.vf */
+	0, /* vfwadd.wf */
+	0, /* vfwsub.wf */
+	0, /* vfwmul.vf */
+	0, /* vfwmacc.vf */
+	0, /* vfwnmacc.vf */
+	0, /* vfwmsac.vf */
+	0, /* vfwnmsac.vf */
+	0, /* vfadd.vv */
+	0, /* vfredusum.vs */
+	0, /* vfsub.vv */
+	0, /* vfredosum.vs */
+	0, /* vfmin.vv */
+	0, /* vfredmin.vs */
+	0, /* vfmax.vv */
+	0, /* vfredmax.vs */
+	0, /* vfsgnj.vv */
+	0, /* vfsgnjn.vv */
+	0, /* vfsgnjx.vv */
+	0, /* vmfeq.vv */
+	0, /* vmfle.vv */
+	0, /* vmflt.vv */
+	0, /* vmfne.vv */
+	0, /* vfdiv.vv */
+	0, /* vfmul.vv */
+	0, /* vfmadd.vv */
+	0, /* vfnmadd.vv */
+	0, /* vfmsub.vv */
+	0, /* vfnmsub.vv */
+	0, /* vfmacc.vv */
+	0, /* vfnmacc.vv */
+	0, /* vfmsac.vv */
+	0, /* vfnmsac.vv */
+	0, /* vfwadd.vv */
+	0, /* vfwredusum.vs */
+	0, /* vfwsub.vv */
+	0, /* vfwredosum.vs */
+	0, /* vfwadd.wv */
+	0, /* vfwsub.wv */
+	0, /* vfwmul.vv */
+	0, /* vfwmacc.vv */
+	0, /* vfwnmacc.vv */
+	0, /* vfwmsac.vv */
+	0, /* vfwnmsac.vv */
+	0, /* vadd.vx */
+	0, /* vsub.vx */
+	0, /* vrsub.vx */
+	0, /* vminu.vx */
+	0, /* vmin.vx */
+	0, /* vmaxu.vx */
+	0, /* vmax.vx */
+	0, /* vand.vx */
+	0, /* vor.vx */
+	0, /* vxor.vx */
+	0, /* vrgather.vx */
+	0, /* vslideup.vx */
+	0, /* vslidedown.vx */
+	0, /* vmseq.vx */
+	0, /* vmsne.vx */
+	0, /* vmsltu.vx */
+	0, /* vmslt.vx */
+	0, /* vmsleu.vx */
+	0, /* vmsle.vx */
+	0, /* vmsgtu.vx */
+	0, /* vmsgt.vx */
+	0, /* vsaddu.vx */
+	0, /* vsadd.vx */
+	0, /* vssubu.vx */
+	0, /* vssub.vx */
+	0, /* vsll.vx */
+	0, /* vsmul.vx */
+	0, /* vsrl.vx */
+	0, /* vsra.vx */
+	0, /* vssrl.vx */
+	0, /* vssra.vx */
+	0, /* vnsrl.wx */
+	0, /* vnsra.wx */
+	0, /* vnclipu.wx */
+	0, /* vnclip.wx */
+	0, /* vadd.vv */
+	0, /* vsub.vv */
+	0, /* vminu.vv */
+	0, /* vmin.vv */
+	0, /* vmaxu.vv */
+	0, /* vmax.vv */
+	0, /* vand.vv */
+	0, /* vor.vv */
+	0, /* vxor.vv */
+	0, /* vrgather.vv */
+	0, /* vrgatherei16.vv */
+	0, /* vmseq.vv */
+	0, /* vmsne.vv */
+	0, /* vmsltu.vv */
+	0, /* vmslt.vv */
+	0, /* vmsleu.vv */
+	0, /* vmsle.vv */
+	0, /* vsaddu.vv */
+	0, /* vsadd.vv */
+	0, /* vssubu.vv */
+	0, /* vssub.vv */
+	0, /* vsll.vv */
+	0, /* vsmul.vv */
+	0, /* vsrl.vv */
+	0, /* vsra.vv */
+	0, /* vssrl.vv */
+	0, /* vssra.vv */
+	0, /* vnsrl.wv */
+	0, /* vnsra.wv */
+	0, /* vnclipu.wv */
+	0, /* vnclip.wv */
+	0, /* vwredsumu.vs */
+	0, /* vwredsum.vs */
+	0, /* vadd.vi */
+	0, /* vrsub.vi */
+	0, /* vand.vi */
+	0, /* vor.vi */
+	0, /* vxor.vi */
+	0, /* vrgather.vi */
+	0, /* vslideup.vi */
+	0, /* vslidedown.vi */
+	0, /* vmseq.vi */
+	0, /* vmsne.vi */
+	0, /* vmsleu.vi */
+	0, /* vmsle.vi */
+	0, /* vmsgtu.vi */
+	0, /* vmsgt.vi */
+	0, /* vsaddu.vi */
+	0, /* vsadd.vi */
+	0, /* vsll.vi */
+	0, /* vsrl.vi */
+	0, /* vsra.vi */
+	0, /* vssrl.vi */
+	0, /* vssra.vi */
+	0, /* vnsrl.wi */
+	0, /* vnsra.wi */
+	0, /* vnclipu.wi */
+	0, /* vnclip.wi */
+	0, /* vredsum.vs */
+	0, /* vredand.vs */
+	0, /* vredor.vs */
+	0, /* vredxor.vs */
+	0, /* vredminu.vs */
+	0, /* vredmin.vs */
+	0, /* vredmaxu.vs */
+	0, /* vredmax.vs */
+	0, /* vaaddu.vv */
+	0, /* vaadd.vv */
+	0, /* vasubu.vv */
+	0, /* vasub.vv */
+	0, /* vmandn.mm */
+	0, /* vmand.mm */
+	0, /* vmor.mm */
+	0, /* vmxor.mm */
+	0, /* vmorn.mm */
+	0, /* vmnand.mm */
+	0, /* vmnor.mm */
+	0, /* vmxnor.mm */
+	0, /* vdivu.vv */
+	0, /* vdiv.vv */
+	0, /* vremu.vv */
+	0, /* vrem.vv */
+	0, /* vmulhu.vv */
+	0, /* vmul.vv */
+	0, /* vmulhsu.vv */
+	0, /* vmulh.vv */
+	0, /* vmadd.vv */
+	0, /* vnmsub.vv */
+	0, /* vmacc.vv */
+	0, /* vnmsac.vv */
+	0, /* vwaddu.vv */
+	0, /* vwadd.vv */
+	0, /* vwsubu.vv */
+	0, /* vwsub.vv */
+	0, /* vwaddu.wv */
+	0, /* vwadd.wv */
+	0, /* vwsubu.wv */
+	0, /* vwsub.wv */
+	0, /* vwmulu.vv */
+	0, /* vwmulsu.vv */
+	0, /* vwmul.vv */
+	0, /* vwmaccu.vv */
+	0, /* vwmacc.vv */
+	0, /* vwmaccsu.vv */
+	0, /* vaaddu.vx */
+	0, /* vaadd.vx */
+	0, /* vasubu.vx */
+	0, /* vasub.vx */
+	0, /* vslide1up.vx */
+	0, /* vslide1down.vx */
+	0, /* vdivu.vx */
+	0, /* vdiv.vx */
+	0, /* vremu.vx */
+	0, /* vrem.vx */
+	0, /* vmulhu.vx */
+	0, /* vmul.vx */
+	0, /* vmulhsu.vx */
+	0, /* vmulh.vx */
+	0, /* vmadd.vx */
+	0, /* vnmsub.vx */
+	0, /* vmacc.vx */
+	0, /* vnmsac.vx */
+	0, /* vwaddu.vx */
+	0, /* vwadd.vx */
+	0, /* vwsubu.vx */
+	0, /* vwsub.vx */
+	0, /* vwaddu.wx */
+	0, /* vwadd.wx */
+	0, /* vwsubu.wx */
+	0, /* vwsub.wx */
+	0, /* vwmulu.vx */
+	0, /* vwmulsu.vx */
+	0, /* vwmul.vx */
+	0, /* vwmaccu.vx */
+	0, /* vwmacc.vx */
+	0, /* vwmaccus.vx */
+	0, /* vwmaccsu.vx */
+	0, /* vfredsum.vs */
+	0, /* vfwredsum.vs */
+	0, /* vmornot.mm */
+	0, /* vmandnot.mm */
+	0, /* vfcvt.xu.f.v */
+	0, /* vfcvt.x.f.v */
+	0, /* vfcvt.f.xu.v */
+	0, /* vfcvt.f.x.v */
+	0, /* vfcvt.rtz.xu.f.v */
+	0, /* vfcvt.rtz.x.f.v */
+	0, /* vfwcvt.xu.f.v */
+	0, /* vfwcvt.x.f.v */
+	0, /* vfwcvt.f.xu.v */
+	0, /* vfwcvt.f.x.v */
+	0, /* vfwcvt.f.f.v */
+	0, /* vfwcvt.rtz.xu.f.v */
+	0, /* vfwcvt.rtz.x.f.v */
+	0, /* vfncvt.xu.f.w */
+	0, /* vfncvt.x.f.w */
+	0, /* vfncvt.f.xu.w */
+	0, /* vfncvt.f.x.w */
+	0, /* vfncvt.f.f.w */
+	0, /* vfncvt.rod.f.f.w */
+	0, /* vfncvt.rtz.xu.f.w */
+	0, /* vfncvt.rtz.x.f.w */
+	0, /* vfsqrt.v */
+	0, /* vfrsqrt7.v */
+	0, /* vfrec7.v */
+	0, /* vfclass.v */
+	0, /* vzext.vf8 */
+	0, /* vsext.vf8 */
+	0, /* vzext.vf4 */
+	0, /* vsext.vf4 */
+	0, /* vzext.vf2 */
+	0, /* vsext.vf2 */
+	0, /* vmsbf.m */
+	0, /* vmsof.m */
+	0, /* vmsif.m */
+	0, /* viota.m */
+	0, /* vcpop.m */
+	0, /* vfirst.m */
+	0, /* vpopc.m */
+	0, /* vid.v */
+	0, /* vsetvl */
+	0, /* vfmerge.vfm */
+	0, /* vadc.vxm */
+	0, /* vmadc.vxm */
+	0, /* vmadc.vx */
+	0, /* vsbc.vxm */
+	0, /* vmsbc.vxm */
+	0, /* vmsbc.vx */
+	0, /* vmerge.vxm */
+	0, /* vadc.vvm */
+	0, /* vmadc.vvm */
+	0, /* vmadc.vv */
+	0, /* vsbc.vvm */
+	0, /* vmsbc.vvm */
+	0, /* vmsbc.vv */
+	0, /* vmerge.vvm */
+	0, /* vadc.vim */
+	0, /* vmadc.vim */
+	0, /* vmadc.vi */
+	0, /* vmerge.vim */
+	0, /* vcompress.vm */
+	0, /* vmvnfr.v */
+	0, /* vfmv.f.s */
+	0, /* vmv1r.v */
+	0, /* vmv2r.v */
+	0, /* vmv4r.v */
+	0, /* vmv8r.v */
+	0, /* vmv.x.s */
+	0, /* vlm.v */
+	0, /* vsm.v */
+	0, /* vl1re8.v */
+	0, /* vl1re16.v */
+	0, /* vl1re32.v */
+	0, /* vl1re64.v */
+	0, /* vl2re8.v */
+	0, /* vl2re16.v */
+	0, /* vl2re32.v */
+	0, /* vl2re64.v */
+	0, /* vl4re8.v */
+	0, /* vl4re16.v */
+	0, /* vl4re32.v */
+	0, /* vl4re64.v */
+	0, /* vl8re8.v */
+	0, /* vl8re16.v */
+	0, /* vl8re32.v */
+	0, /* vl8re64.v */
+	0, /* vs1r.v */
+	0, /* vs2r.v */
+	0, /* vs4r.v */
+	0, /* vs8r.v */
+	0, /* vfmv.s.f */
+	0, /* vfmv.v.f */
+	0, /* vmv.v.x */
+	0, /* vmv.v.v */
+	0, /* vmv.v.i */
+	0, /* vmv.s.x */
+	0, /* vl1r.v */
+	0, /* vl2r.v */
+	0, /* vl4r.v */
+	0, /* vl8r.v */
+	0, /* vle1.v */
+	0, /* vse1.v */
+	0, /* aes32esmi */
+	0, /* aes32esi */
+	0, /* aes32dsmi */
+	0, /* aes32dsi */
+	0, /* sha512sum0r */
+	0, /* sha512sum1r */
+	0, /* sha512sig0l */
+	0, /* sha512sig0h */
+	0, /* sha512sig1l */
+	0, /* sha512sig1h */
+	0, /* sm4ed */
+	0, /* sm4ks */
+	0, /* sm3p0 */
+	0, /* sm3p1 */
+	0, /* sha256sum0 */
+	0, /* sha256sum1 */
+	0, /* sha256sig0 */
+	0, /* sha256sig1 */
+	834, /* amoadd.w */
+	849, /* amoxor.w */
+	864, /* amoor.w */
+	879, /* amoand.w */
+	894, /* amomin.w */
+	916, /* amomax.w */
+	938, /* amominu.w */
+	960, /* amomaxu.w */
+	982, /* amoswap.w */
+	995, /* sc.w */
+	1003, /* lr.w */
+	1008, /* amoadd.d */
+	1021, /* amoxor.d */
+	1034, /* amoor.d */
+	1047, /* amoand.d */
+	1060, /* amomin.d */
+	1076, /* amomax.d */
+	1092, /* amominu.d */
+	1108, /* amomaxu.d */
+	1124, /* amoswap.d */
+	1135, /* sc.d */
+	1142, /* lr.d */
+	1146, /* mul */
+	1151, /* mulh */
+	1161, /* mulhsu */
+	1171, /* mulhu */
+	1181, /* div */
+	1197, /* divu */
+	1207, /* rem */
+	1222, /* remu */
+	0, /* aes64ks2 */
+	0, /* aes64esm */
+	0, /* aes64es */
+	0, /* aes64dsm */
+	0, /* aes64ds */
+	0, /* aes64ks1i */
+	0, /* aes64im */
+	0, /* sha512sum0 */
+	0, /* sha512sum1 */
+	0, /* sha512sig0 */
+	0, /* sha512sig1 */
+	1232, /* mulw */
+	1240, /* divw */
+	1262, /* divuw */
+	1276, /* remw */
+	1297, /* remuw */
+	0, /* hfence.vvma */
+	0, /* hfence.gvma */
+	0, /* hsv.b */
+	0, /* hsv.h */
+	0, /* hsv.w */
+	0, /* hlv.b */
+	0, /* hlv.bu */
+	0, /* hlv.h */
+	0, /* hlv.hu */
+	0, /* hlvx.hu */
+	0, /* hlv.w */
+	0, /* hlvx.wu */
+	0, /* hsv.d */
+	0, /* hlv.wu */
+	0, /* hlv.d */
+	0, /* sinval.vma */
+	0, /* hinval.vvma */
+	0, /* hinval.gvma */
+	0, /* sfence.w.inval */
+	0, /* sfence.inval.ir */
+	0, /* fcvt.h.d */
+	0, /* fcvt.d.h */
+	0, /* fcvt.h.q */
+	0, /* fcvt.q.h */
+	1312, /* fcvt.l.d */
+	1317, /* fcvt.lu.d */
+	1322, /* fcvt.d.l */
+	1327, /* fcvt.d.lu */
+	1332, /* fmv.x.d */
+	1335, /* fmv.d.x */
+	1338, /* fcvt.l.s */
+	1344, /* fcvt.lu.s */
+	1350, /* fcvt.s.l */
+	1358, /* fcvt.s.lu */
+	0, /* fcvt.l.q */
+	0, /* fcvt.lu.q */
+	0, /* fcvt.q.l */
+	0, /* fcvt.q.lu */
+	0, /* fcvt.l.h */
+	0, /* fcvt.lu.h */
+	0, /* fcvt.h.l */
+	0, /* fcvt.h.lu */
+};
+
+/* dyn uses rne since frm is not modeled */
+static RzFloatRMode riscv_il_rmode(ut32 data) {
+	switch ((data >> 12) & 7) {
+	case 1:
+		return RZ_FLOAT_RMODE_RTZ;
+	case 2:
+		return RZ_FLOAT_RMODE_RTN;
+	case 3:
+		return RZ_FLOAT_RMODE_RTP;
+	case 4:
+		return RZ_FLOAT_RMODE_RNA;
+	default:
+		return RZ_FLOAT_RMODE_RNE;
+	}
+}
+
+static RzFloatFormat riscv_il_format(ut8 bits) {
+	return bits == 32 ? RZ_FLOAT_IEEE754_BIN_32 : RZ_FLOAT_IEEE754_BIN_64;
+}
+
+static RzILOpPure *riscv_il_gpr(ut8 reg) {
+	if (reg == RISCV_REG_ZERO) {
+		return rz_il_op_new_bitv_from_ut64(64, 0);
+	}
+	return rz_il_op_new_var(registers_std[reg], RZ_IL_VAR_KIND_GLOBAL);
+}
+
+static void riscv_il_free(void **stack, const bool *effect, ut32 sp) {
+	while (sp > 0) {
+		sp--;
+		if (effect[sp]) {
+			rz_il_op_effect_free(stack[sp]);
+		} else {
+			rz_il_op_pure_free(stack[sp]);
+		}
+	}
+}
+
+/**
+ * Lifts the decoded instruction to RzIL by instantiating its template:
+ * the code is shared by all the instructions with the same semantics and
+ * only the operands (registers, immediate, pc) are patched in.
+ * Returns NULL when the instruction has no template.
+ */
+RzILOpEffect *riscv_il(const RISCVDecoded *dec, ut64 pc) {
+	rz_return_val_if_fail(dec && dec->id < RISCV_INS_COUNT, NULL);
+	void *stack[RISCV_IL_STACK];
+	bool effect[RISCV_IL_STACK];
+	ut32 sp = 0;
+	RzFloatRMode mode = riscv_il_rmode(dec->data);
+
+	for (const RISCVILCode *code = il_code + il_templates[dec->id]; code->op != RISCV_IL_END; ++code) {
+		/* operands are consumed by the constructors, x[] points to the popped ones */
+		sp -= il_arity[code->op];
+		void **x = stack + sp;
+		void *op = NULL;
+		switch (code->op) {
+		case RISCV_IL_RS1:
+			op = riscv_il_gpr(dec->rs1);
+			break;
+		case RISCV_IL_RS2:
+			op = riscv_il_gpr(dec->rs2);
+			break;
+		case RISCV_IL_FS1:
+			op = rz_il_op_new_var(registers_flt[dec->rs1], RZ_IL_VAR_KIND_GLOBAL);
+			break;
+		case RISCV_IL_FS2:
+			op = rz_il_op_new_var(registers_flt[dec->rs2], RZ_IL_VAR_KIND_GLOBAL);
+			break;
+		case RISCV_IL_FS3:
+			op = rz_il_op_new_var(registers_flt[dec->rs3], RZ_IL_VAR_KIND_GLOBAL);
+			break;
+		case RISCV_IL_IMM:
+			op = rz_il_op_new_bitv_from_st64(64, dec->imm);
+			break;
+		case RISCV_IL_NEXT:
+			op = rz_il_op_new_bitv_from_ut64(64, pc + dec->size);
+			break;
+		case RISCV_IL_TARGET:
+			op = rz_il_op_new_bitv_from_ut64(64, pc + dec->imm);
+			break;
+		case RISCV_IL_CONST:
+			op = rz_il_op_new_bitv_from_ut64(il_consts[code->arg].bits, il_consts[code->arg].value);
+			break;
+		case RISCV_IL_VAR:
+			op = rz_il_op_new_var(il_names[code->arg], RZ_IL_VAR_KIND_LOCAL);
+			break;
+		case RISCV_IL_SIGNED:
+			op = rz_il_op_new_signed(code->arg, x[0]);
+			break;
+		case RISCV_IL_UNSIGNED:
+			op = rz_il_op_new_unsigned(code->arg, x[0]);
+			break;
+		case RISCV_IL_LOAD:
+			op = rz_il_op_new_loadw(0, x[0], code->arg);
+			break;
+		case RISCV_IL_NOT:
+			op = rz_il_op_new_log_not(x[0]);
+			break;
+		case RISCV_IL_NEG:
+			op = rz_il_op_new_neg(x[0]);
+			break;
+		case RISCV_IL_INV:
+			op = rz_il_op_new_bool_inv(x[0]);
+			break;
+		case RISCV_IL_BOOL:
+			op = rz_il_op_new_ite(x[0], rz_il_op_new_bitv_from_ut64(64, 1), rz_il_op_new_bitv_from_ut64(64, 0));
+			break;
+		case RISCV_IL_FLOAT:
+			op = rz_il_op_new_float(riscv_il_format(code->arg), x[0]);
+			break;
+		case RISCV_IL_FBITS:
+			op = rz_il_op_new_fbits(x[0]);
+			break;
+		case RISCV_IL_FNEG:
+			op = rz_il_op_new_fneg(x[0]);
+			break;
+		case RISCV_IL_FSQRT:
+			op = rz_il_op_new_fsqrt(mode, x[0]);
+			break;
+		case RISCV_IL_FTOINT:
+			op = rz_il_op_new_fcast_int(code->arg, mode, x[0]);
+			break;
+		case RISCV_IL_FTOSINT:
+			op = rz_il_op_new_fcast_sint(code->arg, mode, x[0]);
+			break;
+		case RISCV_IL_ITOF:
+			op = rz_il_op_new_fcast_float(riscv_il_format(code->arg), mode, x[0]);
+			break;
+		case RISCV_IL_SITOF:
+			op = rz_il_op_new_fcast_sfloat(riscv_il_format(code->arg), mode, x[0]);
+			break;
+		case RISCV_IL_FCONV:
+			op = rz_il_op_new_fconvert(riscv_il_format(code->arg), mode, x[0]);
+			break;
+		case RISCV_IL_ADD:
+			op = rz_il_op_new_add(x[0], x[1]);
+			break;
+		case RISCV_IL_SUB:
+			op = rz_il_op_new_sub(x[0], x[1]);
+			break;
+		case RISCV_IL_MUL:
+			op = rz_il_op_new_mul(x[0], x[1]);
+			break;
+		case RISCV_IL_DIV:
+			op = rz_il_op_new_div(x[0], x[1]);
+			break;
+		case RISCV_IL_SDIV:
+			op = rz_il_op_new_sdiv(x[0], x[1]);
+			break;
+		case RISCV_IL_MOD:
+			op = rz_il_op_new_mod(x[0], x[1]);
+			break;
+		case RISCV_IL_SMOD:
+			op = rz_il_op_new_smod(x[0], x[1]);
+			break;
+		case RISCV_IL_AND:
+			op = rz_il_op_new_log_and(x[0], x[1]);
+			break;
+		case RISCV_IL_OR:
+			op = rz_il_op_new_log_or(x[0], x[1]);
+			break;
+		case RISCV_IL_XOR:
+			op = rz_il_op_new_log_xor(x[0], x[1]);
+			break;
+		case RISCV_IL_SHL:
+			op = rz_il_op_new_shiftl(rz_il_op_new_b0(), x[0], x[1]);
+			break;
+		case RISCV_IL_SHR:
+			op = rz_il_op_new_shiftr(rz_il_op_new_b0(), x[0], x[1]);
+			break;
+		case RISCV_IL_SAR:
+			op = rz_il_op_new_shiftr_arith(x[0], x[1]);
+			break;
+		case RISCV_IL_EQ:
+			op = rz_il_op_new_eq(x[0], x[1]);
+			break;
+		case RISCV_IL_ULT:
+			op = rz_il_op_new_ult(x[0], x[1]);
+			break;
+		case RISCV_IL_SLT:
+			op = rz_il_op_new_slt(x[0], x[1]);
+			break;
+		case RISCV_IL_FADD:
+			op = rz_il_op_new_fadd(mode, x[0], x[1]);
+			break;
+		case RISCV_IL_FSUB:
+			op = rz_il_op_new_fsub(mode, x[0], x[1]);
+			break;
+		case RISCV_IL_FMUL:
+			op = rz_il_op_new_fmul(mode, x[0], x[1]);
+			break;
+		case RISCV_IL_FDIV:
+			op = rz_il_op_new_fdiv(mode, x[0], x[1]);
+			break;
+		case RISCV_IL_FLT:
+			op = rz_il_op_new_flt(x[0], x[1]);
+			break;
+		case RISCV_IL_FLE:
+			op = rz_il_op_new_fle(x[0], x[1]);
+			break;
+		case RISCV_IL_FEQ:
+			op = rz_il_op_new_feq(x[0], x[1]);
+			break;
+		case RISCV_IL_ITE:
+			op = rz_il_op_new_ite(x[0], x[1], x[2]);
+			break;
+		case RISCV_IL_FMAD:
+			op = rz_il_op_new_fmad(mode, x[0], x[1], x[2]);
+			break;
+		case RISCV_IL_SETRD:
+			/* writes to x0 are discarded */
+			if (dec->rd == RISCV_REG_ZERO) {
+				rz_il_op_pure_free(x[0]);
+				op = rz_il_op_new_nop();
+				break;
+			}
+			op = rz_il_op_new_set(registers_std[dec->rd], false, x[0]);
+			break;
+		case RISCV_IL_SETFD:
+			op = rz_il_op_new_set(registers_flt[dec->rd], false, x[0]);
+			break;
+		case RISCV_IL_SETL:
+			op = rz_il_op_new_set(il_names[code->arg], true, x[0]);
+			break;
+		case RISCV_IL_STORE:
+			op = rz_il_op_new_storew(0, x[0], x[1]);
+			break;
+		case RISCV_IL_JMP:
+			op = rz_il_op_new_jmp(x[0]);
+			break;
+		case RISCV_IL_BRANCH:
+			op = rz_il_op_new_branch(x[0], rz_il_op_new_jmp(rz_il_op_new_bitv_from_ut64(64, pc + dec->imm)), rz_il_op_new_nop());
+			break;
+		case RISCV_IL_SEQ:
+			op = rz_il_op_new_seq(x[0], x[1]);
+			break;
+		case RISCV_IL_NOP:
+			op = rz_il_op_new_nop();
+			break;
+		case RISCV_IL_GOTO:
+			op = rz_il_op_new_goto(il_names[code->arg]);
+			break;
+		default:
+			break;
+		}
+		if (!op) {
+			riscv_il_free(stack, effect, sp);
+			return NULL;
+		}
+		effect[sp] = code->op >= RISCV_IL_SETRD;
+		stack[sp++] = op;
+	}
+	if (sp != 1) {
+		riscv_il_free(stack, effect, sp);
+		return NULL;
+	}
+	return stack[0];
+}
@@ -0,0 +1,252 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_liveness.h"
+
+#define reg_set_or(a, b) \
+	do { \
+		(a).gpr |= (b).gpr; \
+		(a).fpr |= (b).fpr; \
+		(a).vec |= (b).vec; \
+	} while (0)
+
+#define reg_set_eq(a, b) ((a).gpr == (b).gpr && (a).fpr == (b).fpr && (a).vec == (b).vec)
+
+/* standard calling convention, bit N is xN/fN/vN */
+#define ABI_ARGS       0x0003fc00u /* a0-a7 and fa0-fa7 */
+#define ABI_CALLER_GPR 0xf003fce2u /* ra, t0-t6 and a0-a7 */
+#define ABI_CALLER_FPR 0xf003fcffu /* ft0-ft11 and fa0-fa7 */
+#define ABI_CALLER_VEC 0xffffffffu /* no vector register is preserved */
+#define ABI_RETURN     0x00000c00u /* a0-a1 and fa0-fa1 */
+
+/* live at the exit of the blocks without successors */
+static const RISCVRegSet abi_return = { ABI_RETURN, ABI_RETURN, 0 };
+
+/* registers of the instruction, a call reads the arguments and clobbers the caller saved registers */
+static void liveness_registers(const RISCVDecoded *dec, RISCVRegisters *regs) {
+	riscv_registers(dec, regs);
+	if ((dec->id == RISCV_INS_JAL || dec->id == RISCV_INS_JALR) && dec->rd != RISCV_REG_ZERO) {
+		regs->gpr_use |= ABI_ARGS;
+		regs->fpr_use |= ABI_ARGS;
+		regs->gpr_def |= ABI_CALLER_GPR;
+		regs->fpr_def |= ABI_CALLER_FPR;
+		regs->vec_def |= ABI_CALLER_VEC;
+	}
+}
+
+static void block_use_def(const RISCVLiveness *lv, ut32 block, RISCVRegSet *use, RISCVRegSet *def) {
+	RISCVDecoded dec;
+	RISCVRegisters regs;
+	ut64 offset = lv->cfg->addr[block] - lv->base;
+	ut64 end = offset + lv->cfg->size[block];
+
+	/* undecodable words are skipped, as in riscv_liveness_at() */
+	for (; offset < end; offset += 4) {
+		if (!riscv_decode(lv->buffer + offset, lv->size - offset, lv->be, &dec)) {
+			continue;
+		}
+		liveness_registers(&dec, &regs);
+		/* a read is exposed only when the block did not write the register before */
+		use->gpr |= regs.gpr_use & ~def->gpr;
+		use->fpr |= regs.fpr_use & ~def->fpr;
+		use->vec |= regs.vec_use & ~def->vec;
+		def->gpr |= regs.gpr_def;
+		def->fpr |= regs.fpr_def;
+		def->vec |= regs.vec_def;
+	}
+}
+
+static bool liveness_solve(RISCVLiveness *lv) {
+	const RISCVCfg *cfg = lv->cfg;
+	ut32 n_blocks = cfg->n_blocks;
+	ut32 *pred_offset = RZ_NEWS0(ut32, n_blocks + 1);
+	ut32 *preds = RZ_NEWS0(ut32, cfg->n_edges + 1);
+	ut32 *queue = RZ_NEWS(ut32, n_blocks);
+	ut8 *queued = RZ_NEWS0(ut8, n_blocks);
+	if (!pred_offset || !preds || !queue || !queued) {
+		free(pred_offset);
+		free(preds);
+		free(queue);
+		free(queued);
+		return false;
+	}
+
+	/* predecessors in the same flat layout of the successors */
+	for (ut32 j = 0; j < cfg->edge_offset[n_blocks]; ++j) {
+		pred_offset[cfg->edges[j] + 1]++;
+	}
+	for (ut32 i = 0; i < n_blocks; ++i) {
+		pred_offset[i + 1] += pred_offset[i];
+	}
+	for (ut32 i = 0; i < n_blocks; ++i) {
+		for (ut32 j = cfg->edge_offset[i]; j < cfg->edge_offset[i + 1]; ++j) {
+			preds[pred_offset[cfg->edges[j]]++] = i;
+		}
+	}
+	for (ut32 i = n_blocks; i > 0; --i) {
+		pred_offset[i] = pred_offset[i - 1];
+	}
+	pred_offset[0] = 0;
+
+	/* backward problem: visiting the blocks from the last converges faster */
+	ut32 head = 0, count = n_blocks;
+	for (ut32 i = 0; i < n_blocks; ++i) {
+		queue[i] = n_blocks - 1 - i;
+		queued[i] = 1;
+	}
+
+	while (count > 0) {
+		ut32 b = queue[head];
+		head = (head + 1) % n_blocks;
+		count--;
+		queued[b] = 0;
+
+		ut32 first = cfg->edge_offset[b], last = cfg->edge_offset[b + 1];
+		RISCVRegSet out = first != last ? (RISCVRegSet){ 0 } : abi_return;
+		for (ut32 j = first; j < last; ++j) {
+			reg_set_or(out, lv->in[cfg->edges[j]]);
+		}
+		lv->out[b] = out;
+
+		RISCVRegSet in = {
+			.gpr = lv->use[b].gpr | (out.gpr & ~lv->def[b].gpr),
+			.fpr = lv->use[b].fpr | (out.fpr & ~lv->def[b].fpr),
+			.vec = lv->use[b].vec | (out.vec & ~lv->def[b].vec),
+		};
+		if (reg_set_eq(in, lv->in[b])) {
+			continue;
+		}
+		lv->in[b] = in;
+
+		for (ut32 j = pred_offset[b]; j < pred_offset[b + 1]; ++j) {
+			ut32 p = preds[j];
+			if (queued[p]) {
+				continue;
+			}
+			queued[p] = 1;
+			queue[(head + count) % n_blocks] = p;
+			count++;
+		}
+	}
+
+	free(pred_offset);
+	free(preds);
+	free(queue);
+	free(queued);
+	return true;
+}
+
+/**
+ * Computes the live registers of the function described by cfg,
+ * as built by riscv_cfg_new(); its blocks must be contained in buffer.
+ * Calls and returns follow the standard calling convention: a call reads
+ * a0-a7/fa0-fa7 and clobbers the caller saved registers, a0-a1/fa0-fa1
+ * are live at the exit of the blocks without successors.
+ */
+RISCVLiveness *riscv_liveness_new(const ut8 *buffer, ut64 size, ut64 base, bool be, const RISCVCfg *cfg) {
+	rz_return_val_if_fail(buffer && cfg && cfg->n_blocks > 0, NULL);
+	ut32 n_blocks = cfg->n_blocks;
+
+	if (cfg->edge_offset[n_blocks] > cfg->n_edges) {
+		return NULL;
+	}
+	for (ut32 i = 0; i < n_blocks; ++i) {
+		if (cfg->addr[i] < base || cfg->addr[i] + cfg->size[i] > base + size ||
+			cfg->edge_offset[i] > cfg->edge_offset[i + 1]) {
+			return NULL;
+		}
+	}
+	for (ut32 j = 0; j < cfg->edge_offset[n_blocks]; ++j) {
+		if (cfg->edges[j] >= n_blocks) {
+			return NULL;
+		}
+	}
+
+	RISCVLiveness *lv = RZ_NEW0(RISCVLiveness);
+	if (!lv) {
+		return NULL;
+	}
+	lv->buffer = buffer;
+	lv->base = base;
+	lv->size = size;
+	lv->be = be;
+	lv->cfg = cfg;
+	lv->use = RZ_NEWS0(RISCVRegSet, n_blocks);
+	lv->def = RZ_NEWS0(RISCVRegSet, n_blocks);
+	lv->in = RZ_NEWS0(RISCVRegSet, n_blocks);
+	lv->out = RZ_NEWS0(RISCVRegSet, n_blocks);
+	if (!lv->use || !lv->def || !lv->in || !lv->out) {
+		riscv_liveness_free(lv);
+		return NULL;
+	}
+
+	for (ut32 i = 0; i < n_blocks; ++i) {
+		block_use_def(lv, i, &lv->use[i], &lv->def[i]);
+	}
+
+	if (!liveness_solve(lv)) {
+		riscv_liveness_free(lv);
+		return NULL;
+	}
+	return lv;
+}
+
+void riscv_liveness_free(RISCVLiveness *lv) {
+	if (!lv) {
+		return;
+	}
+	free(lv->use);
+	free(lv->def);
+	free(lv->in);
+	free(lv->out);
+	free(lv);
+}
+
+/**
+ * Returns the index of the block containing addr or RISCV_LIVENESS_INVALID
+ */
+ut32 riscv_liveness_block_at(const RISCVLiveness *lv, ut64 addr) {
+	rz_return_val_if_fail(lv, RISCV_LIVENESS_INVALID);
+	const RISCVCfg *cfg = lv->cfg;
+	ut32 lo = 0, hi = cfg->n_blocks;
+	while (lo < hi) {
+		ut32 mid = lo + (hi - lo) / 2;
+		if (addr < cfg->addr[mid]) {
+			hi = mid;
+		} else if (addr >= cfg->addr[mid] + cfg->size[mid]) {
+			lo = mid + 1;
+		} else {
+			return mid;
+		}
+	}
+	return RISCV_LIVENESS_INVALID;
+}
+
+/**
+ * Sets the registers live before executing the instruction at addr
+ */
+bool riscv_liveness_at(const RISCVLiveness *lv, ut64 addr, RISCVRegSet *live) {
+	rz_return_val_if_fail(lv && live, false);
+	ut32 b = riscv_liveness_block_at(lv, addr);
+	if (b == RISCV_LIVENESS_INVALID) {
+		return false;
+	}
+
+	RISCVDecoded dec;
+	RISCVRegisters regs;
+
+	*live = lv->out[b];
+	/* the decoder handles only 32 bits instructions, so the block can be walked backward */
+	for (ut64 pc = lv->cfg->addr[b] + lv->cfg->size[b]; pc > addr;) {
+		pc -= 4;
+		ut64 offset = pc - lv->base;
+		if (!riscv_decode(lv->buffer + offset, lv->size - offset, lv->be, &dec)) {
+			continue;
+		}
+		liveness_registers(&dec, &regs);
+		live->gpr = (live->gpr & ~regs.gpr_def) | regs.gpr_use;
+		live->fpr = (live->fpr & ~regs.fpr_def) | regs.fpr_use;
+		live->vec = (live->vec & ~regs.vec_def) | regs.vec_use;
+	}
+	return true;
+}
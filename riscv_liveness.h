@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_LIVENESS_H
+#define RISCV_LIVENESS_H
+
+#include "riscv_cfg.h"
+
+#define RISCV_LIVENESS_INVALID UT32_MAX
+
+/* one bit per register, bit N is xN/fN/vN */
+typedef struct riscv_reg_set_t {
+	ut32 gpr;
+	ut32 fpr;
+	ut32 vec;
+} RISCVRegSet;
+
+typedef struct riscv_liveness_t {
+	const ut8 *buffer; /*  borrowed, code of the function */
+	ut64 base; /*          address of buffer[0] */
+	ut64 size; /*          size of buffer */
+	bool be;
+	const RISCVCfg *cfg; /* borrowed */
+	RISCVRegSet *use; /*   upward exposed uses of each block */
+	RISCVRegSet *def; /*   registers written by each block */
+	RISCVRegSet *in; /*    live at the entry of each block */
+	RISCVRegSet *out; /*   live at the exit of each block */
+} RISCVLiveness;
+
+RISCV_API RISCVLiveness *riscv_liveness_new(const ut8 *buffer, ut64 size, ut64 base, bool be, const RISCVCfg *cfg);
+RISCV_API void riscv_liveness_free(RISCVLiveness *lv);
+RISCV_API ut32 riscv_liveness_block_at(const RISCVLiveness *lv, ut64 addr);
+RISCV_API bool riscv_liveness_at(const RISCVLiveness *lv, ut64 addr, RISCVRegSet *live);
+
+#endif /* RISCV_LIVENESS_H */
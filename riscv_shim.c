@@ -0,0 +1,264 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+void rz_strbuf_init(RzStrBuf *sb) {
+	rz_return_if_fail(sb);
+	memset(sb, 0, sizeof(RzStrBuf));
+}
+
+void rz_strbuf_fini(RzStrBuf *sb) {
+	rz_return_if_fail(sb);
+	R_FREE(sb->ptr);
+	sb->len = 0;
+	sb->size = 0;
+}
+
+RzStrBuf *rz_strbuf_new(const char *s) {
+	RzStrBuf *sb = RZ_NEW0(RzStrBuf);
+	if (sb && s && !rz_strbuf_set(sb, s)) {
+		R_FREE(sb);
+	}
+	return sb;
+}
+
+void rz_strbuf_free(RzStrBuf *sb) {
+	if (!sb) {
+		return;
+	}
+	rz_strbuf_fini(sb);
+	free(sb);
+}
+
+const char *rz_strbuf_get(RzStrBuf *sb) {
+	rz_return_val_if_fail(sb, NULL);
+	return sb->ptr ? sb->ptr : "";
+}
+
+/**
+ * Returns the string and frees the buffer, the caller owns the string.
+ */
+char *rz_strbuf_drain(RzStrBuf *sb) {
+	rz_return_val_if_fail(sb, NULL);
+	char *ret = sb->ptr ? sb->ptr : strdup("");
+	free(sb);
+	return ret;
+}
+
+/* grows the buffer to hold length more bytes and the NUL */
+static bool strbuf_reserve(RzStrBuf *sb, size_t length) {
+	size_t needed = sb->len + length + 1;
+	if (needed <= sb->size) {
+		return true;
+	}
+	size_t size = RZ_MAX(needed, sb->size * 2);
+	size = RZ_MAX(size, 64);
+	char *ptr = realloc(sb->ptr, size);
+	if (!ptr) {
+		return false;
+	}
+	sb->ptr = ptr;
+	sb->size = size;
+	return true;
+}
+
+bool rz_strbuf_append(RzStrBuf *sb, const char *s) {
+	rz_return_val_if_fail(sb && s, false);
+	size_t length = strlen(s);
+	if (!strbuf_reserve(sb, length)) {
+		return false;
+	}
+	memcpy(sb->ptr + sb->len, s, length + 1);
+	sb->len += length;
+	return true;
+}
+
+static bool strbuf_vappendf(RzStrBuf *sb, const char *fmt, va_list ap) {
+	va_list copy;
+	va_copy(copy, ap);
+	int length = vsnprintf(NULL, 0, fmt, copy);
+	va_end(copy);
+	if (length < 0 || !strbuf_reserve(sb, length)) {
+		return false;
+	}
+	vsnprintf(sb->ptr + sb->len, length + 1, fmt, ap);
+	sb->len += length;
+	return true;
+}
+
+bool rz_strbuf_appendf(RzStrBuf *sb, const char *fmt, ...) {
+	rz_return_val_if_fail(sb && fmt, false);
+	va_list ap;
+	va_start(ap, fmt);
+	bool ret = strbuf_vappendf(sb, fmt, ap);
+	va_end(ap);
+	return ret;
+}
+
+bool rz_strbuf_set(RzStrBuf *sb, const char *s) {
+	rz_return_val_if_fail(sb, false);
+	sb->len = 0;
+	if (sb->ptr) {
+		sb->ptr[0] = 0;
+	}
+	return !s || rz_strbuf_append(sb, s);
+}
+
+bool rz_strbuf_setf(RzStrBuf *sb, const char *fmt, ...) {
+	rz_return_val_if_fail(sb && fmt, false);
+	sb->len = 0;
+	if (sb->ptr) {
+		sb->ptr[0] = 0;
+	}
+	va_list ap;
+	va_start(ap, fmt);
+	bool ret = strbuf_vappendf(sb, fmt, ap);
+	va_end(ap);
+	return ret;
+}
+
+void rz_vector_init(RzVector *vec, size_t elem_size, RzVectorFree free, void *free_user) {
+	rz_return_if_fail(vec);
+	vec->a = NULL;
+	vec->len = 0;
+	vec->capacity = 0;
+	vec->elem_size = elem_size;
+	vec->free = free;
+	vec->free_user = free_user;
+}
+
+void rz_vector_fini(RzVector *vec) {
+	rz_return_if_fail(vec);
+	for (size_t i = 0; vec->free && i < vec->len; ++i) {
+		vec->free((char *)vec->a + vec->elem_size * i, vec->free_user);
+	}
+	R_FREE(vec->a);
+	vec->len = 0;
+	vec->capacity = 0;
+}
+
+void *rz_vector_reserve(RzVector *vec, size_t capacity) {
+	rz_return_val_if_fail(vec, NULL);
+	if (vec->capacity < capacity) {
+		void *a = realloc(vec->a, vec->elem_size * capacity);
+		if (!a) {
+			return NULL;
+		}
+		vec->a = a;
+		vec->capacity = capacity;
+	}
+	return vec->a;
+}
+
+/**
+ * Copies the element at x to the end of the vector, returns the copy.
+ */
+void *rz_vector_push(RzVector *vec, void *x) {
+	rz_return_val_if_fail(vec, NULL);
+	if (vec->len >= vec->capacity && !rz_vector_reserve(vec, vec->capacity ? vec->capacity * 2 : 4)) {
+		return NULL;
+	}
+	void *p = (char *)vec->a + vec->elem_size * vec->len++;
+	if (x) {
+		memcpy(p, x, vec->elem_size);
+	}
+	return p;
+}
+
+/**
+ * Reads the whole file, the returned string is always NUL terminated.
+ */
+char *rz_file_slurp(const char *str, size_t *usz) {
+	rz_return_val_if_fail(str, NULL);
+	FILE *fd = fopen(str, "rb");
+	if (!fd) {
+		return NULL;
+	}
+	char *ret = NULL;
+	long size;
+	if (fseek(fd, 0, SEEK_END) || (size = ftell(fd)) < 0 || fseek(fd, 0, SEEK_SET)) {
+		goto end;
+	}
+	ret = malloc((size_t)size + 1);
+	if (!ret) {
+		goto end;
+	}
+	if (fread(ret, 1, size, fd) != (size_t)size) {
+		R_FREE(ret);
+		goto end;
+	}
+	ret[size] = 0;
+	if (usz) {
+		*usz = size;
+	}
+
+end:
+	fclose(fd);
+	return ret;
+}
+
+/**
+ * Maps the file read only, only RZ_PERM_R is supported and the
+ * mode and base are ignored. Without mmap() the file is read in memory.
+ */
+RzMmap *rz_file_mmap(const char *file, int perm, int mode, ut64 base) {
+	rz_return_val_if_fail(file && perm == RZ_PERM_R, NULL);
+	(void)mode;
+	(void)base;
+	RzMmap *m = RZ_NEW0(RzMmap);
+	if (!m) {
+		return NULL;
+	}
+#ifdef _WIN32
+	size_t size = 0;
+	m->buf = (ut8 *)rz_file_slurp(file, &size);
+	m->len = size;
+	if (!m->buf) {
+		R_FREE(m);
+	}
+#else
+	struct stat st;
+	int fd = open(file, O_RDONLY);
+	if (fd < 0) {
+		free(m);
+		return NULL;
+	}
+	if (fstat(fd, &st) || st.st_size <= 0) {
+		goto fail;
+	}
+	m->buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (m->buf == MAP_FAILED) {
+		goto fail;
+	}
+	m->len = st.st_size;
+	close(fd);
+	return m;
+
+fail:
+	close(fd);
+	R_FREE(m);
+#endif
+	return m;
+}
+
+void rz_file_mmap_free(RzMmap *m) {
+	if (!m) {
+		return;
+	}
+#ifdef _WIN32
+	free(m->buf);
+#else
+	munmap(m->buf, m->len);
+#endif
+	free(m);
+}
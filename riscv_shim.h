@@ -0,0 +1,266 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_SHIM_H
+#define RISCV_SHIM_H
+
+/**
+ * Subset of rz_types.h, rz_util.h and rz_analysis.h used by the decoder when
+ * built as a standalone library (RISCV_STANDALONE), without linking rz_util.
+ * The names and the values are the same of rizin, so the RZ_ANALYSIS_OP_*
+ * classes returned by riscv_op_class() can be used as they are.
+ * Included by riscv_decode.h, which defines RISCV_API.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+typedef uint8_t ut8;
+typedef uint16_t ut16;
+typedef uint32_t ut32;
+typedef uint64_t ut64;
+typedef int8_t st8;
+typedef int16_t st16;
+typedef int32_t st32;
+typedef int64_t st64;
+typedef const char cchar;
+
+#define UT8_MAX  UINT8_MAX
+#define UT16_MAX UINT16_MAX
+#define UT32_MAX UINT32_MAX
+#define UT64_MAX UINT64_MAX
+
+#define PFMT64d PRId64
+#define PFMT64x PRIx64
+
+/**
+ * The functions are renamed to riscv_shim_* so that a program linking both this library
+ * and rz_util gets each its own, the rz_* names are kept as macros. Only RzStrBuf, needed
+ * by the disassemblers, is part of the api of the library, the rest is hidden.
+ */
+#if defined(__GNUC__) && !defined(_WIN32)
+#define RISCV_SHIM_API __attribute__((visibility("hidden")))
+#else
+#define RISCV_SHIM_API
+#endif
+
+#define rz_strbuf_init    riscv_shim_strbuf_init
+#define rz_strbuf_fini    riscv_shim_strbuf_fini
+#define rz_strbuf_new     riscv_shim_strbuf_new
+#define rz_strbuf_free    riscv_shim_strbuf_free
+#define rz_strbuf_get     riscv_shim_strbuf_get
+#define rz_strbuf_drain   riscv_shim_strbuf_drain
+#define rz_strbuf_set     riscv_shim_strbuf_set
+#define rz_strbuf_setf    riscv_shim_strbuf_setf
+#define rz_strbuf_append  riscv_shim_strbuf_append
+#define rz_strbuf_appendf riscv_shim_strbuf_appendf
+#define rz_vector_init    riscv_shim_vector_init
+#define rz_vector_fini    riscv_shim_vector_fini
+#define rz_vector_reserve riscv_shim_vector_reserve
+#define rz_vector_push    riscv_shim_vector_push
+#define rz_file_mmap      riscv_shim_file_mmap
+#define rz_file_mmap_free riscv_shim_file_mmap_free
+#define rz_file_slurp     riscv_shim_file_slurp
+
+/* RZ_PRINTF_CHECK of rz_types.h, checks the arguments of the formats */
+#if defined(__GNUC__)
+#define RZ_PRINTF_CHECK(fmt, dots) __attribute__((format(printf, fmt, dots)))
+#else
+#define RZ_PRINTF_CHECK(fmt, dots)
+#endif
+
+#define RZ_NEW(x)      ((x *)malloc(sizeof(x)))
+#define RZ_NEW0(x)     ((x *)calloc(1, sizeof(x)))
+#define RZ_NEWS(x, y)  ((x *)malloc((y) * sizeof(x)))
+#define RZ_NEWS0(x, y) ((x *)calloc(y, sizeof(x)))
+#define R_FREE(x) \
+	do { \
+		free(x); \
+		(x) = NULL; \
+	} while (0)
+
+#define RZ_ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+#define RZ_MIN(x, y)     (((x) > (y)) ? (y) : (x))
+#define RZ_MAX(x, y)     (((x) > (y)) ? (x) : (y))
+
+#define RZ_PERM_R 4
+
+/* no logging, the checks only protect from invalid arguments */
+#define rz_return_if_fail(expr) \
+	do { \
+		if (!(expr)) { \
+			return; \
+		} \
+	} while (0)
+#define rz_return_val_if_fail(expr, val) \
+	do { \
+		if (!(expr)) { \
+			return (val); \
+		} \
+	} while (0)
+
+static inline ut16 rz_read_le16(const void *src) {
+	const ut8 *s = (const ut8 *)src;
+	return (ut16)(s[0] | (s[1] << 8));
+}
+
+static inline ut32 rz_read_le32(const void *src) {
+	const ut8 *s = (const ut8 *)src;
+	return (ut32)s[0] | ((ut32)s[1] << 8) | ((ut32)s[2] << 16) | ((ut32)s[3] << 24);
+}
+
+static inline ut16 rz_read_ble16(const void *src, bool big_endian) {
+	const ut8 *s = (const ut8 *)src;
+	return big_endian ? (ut16)((s[0] << 8) | s[1]) : rz_read_le16(src);
+}
+
+static inline ut32 rz_read_ble32(const void *src, bool big_endian) {
+	const ut8 *s = (const ut8 *)src;
+	return big_endian ? ((ut32)s[0] << 24) | ((ut32)s[1] << 16) | ((ut32)s[2] << 8) | (ut32)s[3] : rz_read_le32(src);
+}
+
+typedef struct rz_strbuf_t {
+	char *ptr; /* NUL terminated, NULL until the first write */
+	size_t len;
+	size_t size; /* allocated bytes */
+} RzStrBuf;
+
+RISCV_API void rz_strbuf_init(RzStrBuf *sb);
+RISCV_API void rz_strbuf_fini(RzStrBuf *sb);
+RISCV_API RzStrBuf *rz_strbuf_new(const char *s);
+RISCV_API void rz_strbuf_free(RzStrBuf *sb);
+RISCV_API const char *rz_strbuf_get(RzStrBuf *sb);
+RISCV_API char *rz_strbuf_drain(RzStrBuf *sb);
+RISCV_API bool rz_strbuf_set(RzStrBuf *sb, const char *s);
+RISCV_API bool rz_strbuf_setf(RzStrBuf *sb, const char *fmt, ...) RZ_PRINTF_CHECK(2, 3);
+RISCV_API bool rz_strbuf_append(RzStrBuf *sb, const char *s);
+RISCV_API bool rz_strbuf_appendf(RzStrBuf *sb, const char *fmt, ...) RZ_PRINTF_CHECK(2, 3);
+
+typedef void (*RzVectorFree)(void *e, void *user);
+
+typedef struct rz_vector_t {
+	void *a;
+	size_t len;
+	size_t capacity;
+	size_t elem_size;
+	RzVectorFree free;
+	void *free_user;
+} RzVector;
+
+RISCV_SHIM_API void rz_vector_init(RzVector *vec, size_t elem_size, RzVectorFree free, void *free_user);
+RISCV_SHIM_API void rz_vector_fini(RzVector *vec);
+RISCV_SHIM_API void *rz_vector_reserve(RzVector *vec, size_t capacity);
+RISCV_SHIM_API void *rz_vector_push(RzVector *vec, void *x);
+
+static inline size_t rz_vector_len(const RzVector *vec) {
+	return vec->len;
+}
+
+typedef struct rz_mmap_t {
+	ut8 *buf;
+	ut64 len;
+} RzMmap;
+
+RISCV_SHIM_API RzMmap *rz_file_mmap(const char *file, int perm, int mode, ut64 base);
+RISCV_SHIM_API void rz_file_mmap_free(RzMmap *m);
+RISCV_SHIM_API char *rz_file_slurp(const char *str, size_t *usz);
+
+typedef enum {
+	RZ_ANALYSIS_OP_TYPE_COND = 0x80000000,
+	RZ_ANALYSIS_OP_TYPE_REP = 0x40000000,
+	RZ_ANALYSIS_OP_TYPE_MEM = 0x20000000,
+	RZ_ANALYSIS_OP_TYPE_REG = 0x10000000,
+	RZ_ANALYSIS_OP_TYPE_IND = 0x08000000,
+	RZ_ANALYSIS_OP_TYPE_NULL = 0,
+	RZ_ANALYSIS_OP_TYPE_JMP = 1,
+	RZ_ANALYSIS_OP_TYPE_UJMP = 2,
+	RZ_ANALYSIS_OP_TYPE_RJMP = RZ_ANALYSIS_OP_TYPE_REG | RZ_ANALYSIS_OP_TYPE_UJMP,
+	RZ_ANALYSIS_OP_TYPE_CJMP = RZ_ANALYSIS_OP_TYPE_COND | RZ_ANALYSIS_OP_TYPE_JMP,
+	RZ_ANALYSIS_OP_TYPE_CALL = 3,
+	RZ_ANALYSIS_OP_TYPE_UCALL = 4,
+	RZ_ANALYSIS_OP_TYPE_RCALL = RZ_ANALYSIS_OP_TYPE_REG | RZ_ANALYSIS_OP_TYPE_UCALL,
+	RZ_ANALYSIS_OP_TYPE_RET = 5,
+	RZ_ANALYSIS_OP_TYPE_ILL = 6,
+	RZ_ANALYSIS_OP_TYPE_UNK = 7,
+	RZ_ANALYSIS_OP_TYPE_NOP = 8,
+	RZ_ANALYSIS_OP_TYPE_MOV = 9,
+	RZ_ANALYSIS_OP_TYPE_TRAP = 10,
+	RZ_ANALYSIS_OP_TYPE_SWI = 11,
+	RZ_ANALYSIS_OP_TYPE_UPUSH = 12,
+	RZ_ANALYSIS_OP_TYPE_PUSH = 13,
+	RZ_ANALYSIS_OP_TYPE_POP = 14,
+	RZ_ANALYSIS_OP_TYPE_CMP = 15,
+	RZ_ANALYSIS_OP_TYPE_ACMP = 16,
+	RZ_ANALYSIS_OP_TYPE_ADD = 17,
+	RZ_ANALYSIS_OP_TYPE_SUB = 18,
+	RZ_ANALYSIS_OP_TYPE_IO = 19,
+	RZ_ANALYSIS_OP_TYPE_MUL = 20,
+	RZ_ANALYSIS_OP_TYPE_DIV = 21,
+	RZ_ANALYSIS_OP_TYPE_SHR = 22,
+	RZ_ANALYSIS_OP_TYPE_SHL = 23,
+	RZ_ANALYSIS_OP_TYPE_SAL = 24,
+	RZ_ANALYSIS_OP_TYPE_SAR = 25,
+	RZ_ANALYSIS_OP_TYPE_OR = 26,
+	RZ_ANALYSIS_OP_TYPE_AND = 27,
+	RZ_ANALYSIS_OP_TYPE_XOR = 28,
+	RZ_ANALYSIS_OP_TYPE_NOR = 29,
+	RZ_ANALYSIS_OP_TYPE_NOT = 30,
+	RZ_ANALYSIS_OP_TYPE_STORE = 31,
+	RZ_ANALYSIS_OP_TYPE_LOAD = 32,
+	RZ_ANALYSIS_OP_TYPE_LEA = 33,
+	RZ_ANALYSIS_OP_TYPE_LEAVE = 34,
+	RZ_ANALYSIS_OP_TYPE_ROR = 35,
+	RZ_ANALYSIS_OP_TYPE_ROL = 36,
+	RZ_ANALYSIS_OP_TYPE_XCHG = 37,
+	RZ_ANALYSIS_OP_TYPE_MOD = 38,
+	RZ_ANALYSIS_OP_TYPE_SWITCH = 39,
+	RZ_ANALYSIS_OP_TYPE_CASE = 40,
+	RZ_ANALYSIS_OP_TYPE_LENGTH = 41,
+	RZ_ANALYSIS_OP_TYPE_CAST = 42,
+	RZ_ANALYSIS_OP_TYPE_NEW = 43,
+	RZ_ANALYSIS_OP_TYPE_ABS = 44,
+	RZ_ANALYSIS_OP_TYPE_CPL = 45,
+	RZ_ANALYSIS_OP_TYPE_CRYPTO = 46,
+	RZ_ANALYSIS_OP_TYPE_SYNC = 47,
+} _RzAnalysisOpType;
+
+typedef enum {
+	RZ_ANALYSIS_OP_FAMILY_UNKNOWN = -1,
+	RZ_ANALYSIS_OP_FAMILY_CPU = 0,
+	RZ_ANALYSIS_OP_FAMILY_FPU,
+	RZ_ANALYSIS_OP_FAMILY_MMX,
+	RZ_ANALYSIS_OP_FAMILY_SSE,
+	RZ_ANALYSIS_OP_FAMILY_PRIV,
+	RZ_ANALYSIS_OP_FAMILY_CRYPTO,
+	RZ_ANALYSIS_OP_FAMILY_THREAD,
+	RZ_ANALYSIS_OP_FAMILY_VIRT,
+	RZ_ANALYSIS_OP_FAMILY_SECURITY,
+	RZ_ANALYSIS_OP_FAMILY_IO,
+	RZ_ANALYSIS_OP_FAMILY_LAST
+} RzAnalysisOpFamily;
+
+typedef enum {
+	RZ_TYPE_COND_AL = 0,
+	RZ_TYPE_COND_EQ,
+	RZ_TYPE_COND_NE,
+	RZ_TYPE_COND_GE,
+	RZ_TYPE_COND_GT,
+	RZ_TYPE_COND_LE,
+	RZ_TYPE_COND_LT,
+	RZ_TYPE_COND_NV,
+	RZ_TYPE_COND_HS,
+	RZ_TYPE_COND_LO,
+	RZ_TYPE_COND_MI,
+	RZ_TYPE_COND_PL,
+	RZ_TYPE_COND_VS,
+	RZ_TYPE_COND_VC,
+	RZ_TYPE_COND_HI,
+	RZ_TYPE_COND_LS,
+} RzTypeCond;
+
+#endif /* RISCV_SHIM_H */
@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_stack.h"
+
+#define RISCV_REG_FP 8 /* s0 */
+
+static int slot_cmp(const void *a, const void *b, void *user) {
+	const RISCVStackSlot *x = a;
+	const RISCVStackSlot *y = b;
+	if (x->offset != y->offset) {
+		return x->offset < y->offset ? -1 : 1;
+	}
+	return (int)x->size - (int)y->size;
+}
+
+/* applies the instruction to the state, slot is filled when a frame slot is accessed */
+static bool stack_step(RISCVStackState *state, const RISCVDecoded *dec, RISCVStackSlot *slot) {
+	RISCVStackEffect effect;
+	RISCVRegisters regs;
+	bool access = false;
+
+	riscv_stack_effect(dec, &effect);
+	if (effect.size) {
+		if (effect.base == RISCV_REG_SP && (state->known & RISCV_STACK_SP)) {
+			slot->offset = state->sp + effect.offset;
+			access = true;
+		} else if (effect.base == RISCV_REG_FP && (state->known & RISCV_STACK_FP)) {
+			slot->offset = state->fp + effect.offset;
+			access = true;
+		}
+		slot->size = effect.size;
+		slot->access = effect.write ? RISCV_STACK_WRITE : RISCV_STACK_READ;
+	}
+
+	/* frame pointer set up and sp restored from it */
+	bool addi = dec->id == RISCV_INS_ADDI;
+	riscv_registers(dec, &regs);
+	if (addi && dec->rd == RISCV_REG_FP && dec->rs1 == RISCV_REG_SP && (state->known & RISCV_STACK_SP)) {
+		state->fp = state->sp + dec->imm;
+		state->known |= RISCV_STACK_FP;
+	} else if (regs.gpr_def & (1u << RISCV_REG_FP)) {
+		state->known &= ~RISCV_STACK_FP;
+	}
+	if (effect.delta) {
+		state->sp += effect.delta;
+	} else if (effect.clobber) {
+		if (addi && dec->rs1 == RISCV_REG_FP && (state->known & RISCV_STACK_FP)) {
+			state->sp = state->fp + dec->imm;
+			state->known |= RISCV_STACK_SP;
+		} else {
+			state->known &= ~RISCV_STACK_SP;
+		}
+	}
+	return access;
+}
+
+/* walks the block from its entry state, stops before addr; slots and deepest are optional */
+static void stack_block(const RISCVStack *stack, ut32 block, ut64 addr, RISCVStackState *state, RzVector *slots, st64 *deepest) {
+	const RISCVCfg *cfg = stack->cfg;
+	RISCVDecoded dec;
+	RISCVStackSlot slot;
+	ut64 end = RZ_MIN(addr, cfg->addr[block] + cfg->size[block]);
+
+	*state = stack->in[block];
+	for (ut64 pc = cfg->addr[block]; pc < end; pc += 4) {
+		ut64 offset = pc - stack->base;
+		if (!riscv_decode(stack->buffer + offset, stack->size - offset, stack->be, &dec)) {
+			continue;
+		}
+		if (stack_step(state, &dec, &slot) && slots) {
+			rz_vector_push(slots, &slot);
+		}
+		if (deepest && (state->known & RISCV_STACK_SP) && -state->sp > *deepest) {
+			*deepest = -state->sp;
+		}
+	}
+}
+
+/* merges the incoming state, returns true when the successor has to be visited again */
+static bool stack_merge(RISCVStack *stack, ut32 block, const RISCVStackState *state) {
+	RISCVStackState *in = &stack->in[block];
+	if (!stack->reached[block]) {
+		stack->reached[block] = 1;
+		*in = *state;
+		return true;
+	}
+	ut8 known = in->known & state->known;
+	if (in->sp != state->sp) {
+		known &= ~RISCV_STACK_SP;
+	}
+	if (in->fp != state->fp) {
+		known &= ~RISCV_STACK_FP;
+	}
+	if (known == in->known) {
+		return false;
+	}
+	in->known = known;
+	return true;
+}
+
+static bool stack_propagate(RISCVStack *stack, ut32 entry) {
+	const RISCVCfg *cfg = stack->cfg;
+	RISCVStackState state = { 0, 0, RISCV_STACK_SP };
+	ut32 *todo = RZ_NEWS(ut32, cfg->n_blocks);
+	ut8 *queued = RZ_NEWS0(ut8, cfg->n_blocks);
+	ut32 n_todo = 0;
+	if (!todo || !queued) {
+		free(todo);
+		free(queued);
+		return false;
+	}
+
+	stack_merge(stack, entry, &state);
+	todo[n_todo++] = entry;
+	queued[entry] = 1;
+	while (n_todo > 0) {
+		ut32 block = todo[--n_todo];
+		queued[block] = 0;
+		stack_block(stack, block, UT64_MAX, &state, NULL, NULL);
+		for (ut32 i = cfg->edge_offset[block]; i < cfg->edge_offset[block + 1]; ++i) {
+			ut32 succ = cfg->edges[i];
+			if (stack_merge(stack, succ, &state) && !queued[succ]) {
+				queued[succ] = 1;
+				todo[n_todo++] = succ;
+			}
+		}
+	}
+	free(todo);
+	free(queued);
+	return true;
+}
+
+/* collects the accessed slots, merging the accesses to the same slot */
+static void stack_slots(RISCVStack *stack) {
+	RISCVStackState state;
+	for (ut32 i = 0; i < stack->cfg->n_blocks; ++i) {
+		if (!stack->reached[i]) {
+			continue;
+		}
+		stack_block(stack, i, UT64_MAX, &state, &stack->slots, &stack->frame_size);
+	}
+
+	rz_vector_sort(&stack->slots, slot_cmp, false, NULL);
+	RISCVStackSlot *slots = stack->slots.a;
+	size_t unique = 0;
+	for (size_t i = 0; i < rz_vector_len(&stack->slots); ++i) {
+		if (unique && slots[unique - 1].offset == slots[i].offset && slots[unique - 1].size == slots[i].size) {
+			slots[unique - 1].access |= slots[i].access;
+			continue;
+		}
+		slots[unique++] = slots[i];
+	}
+	stack->slots.len = unique;
+}
+
+/**
+ * Tracks sp (and the s0 frame pointer) over the graph of a function
+ * starting at block entry, and collects the stack slots it accesses.
+ * Offsets are relative to the sp at the function entry, so the stack
+ * allocated by the function has negative offsets.
+ */
+RISCVStack *riscv_stack_new(const ut8 *buffer, ut64 size, ut64 base, bool be, const RISCVCfg *cfg, ut32 entry) {
+	rz_return_val_if_fail(buffer && cfg && entry < cfg->n_blocks, NULL);
+	RISCVStack *stack = RZ_NEW0(RISCVStack);
+	if (!stack) {
+		return NULL;
+	}
+	stack->buffer = buffer;
+	stack->base = base;
+	stack->size = size;
+	stack->be = be;
+	stack->cfg = cfg;
+	stack->in = RZ_NEWS0(RISCVStackState, cfg->n_blocks);
+	stack->reached = RZ_NEWS0(ut8, cfg->n_blocks);
+	rz_vector_init(&stack->slots, sizeof(RISCVStackSlot), NULL, NULL);
+	if (!stack->in || !stack->reached || !stack_propagate(stack, entry)) {
+		riscv_stack_free(stack);
+		return NULL;
+	}
+	stack_slots(stack);
+	return stack;
+}
+
+void riscv_stack_free(RISCVStack *stack) {
+	if (!stack) {
+		return;
+	}
+	free(stack->in);
+	free(stack->reached);
+	rz_vector_fini(&stack->slots);
+	free(stack);
+}
+
+/**
+ * Sets the state before executing the instruction at addr
+ */
+bool riscv_stack_at(const RISCVStack *stack, ut64 addr, RISCVStackState *state) {
+	rz_return_val_if_fail(stack && state, false);
+	ut32 block = riscv_cfg_block_at(stack->cfg, addr);
+	if (block == RISCV_CFG_INVALID || !stack->reached[block]) {
+		return false;
+	}
+	stack_block(stack, block, addr, state, NULL, NULL);
+	return true;
+}
@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_STACK_H
+#define RISCV_STACK_H
+
+#include "riscv_cfg.h"
+
+#define RISCV_STACK_SP (1 << 0) /* sp offset is known */
+#define RISCV_STACK_FP (1 << 1) /* s0 holds a known offset from the entry sp */
+
+#define RISCV_STACK_READ  (1 << 0)
+#define RISCV_STACK_WRITE (1 << 1)
+
+/* offsets are relative to the value of sp at the function entry */
+typedef struct riscv_stack_state_t {
+	st64 sp;
+	st64 fp;
+	ut8 known; /* RISCV_STACK_SP | RISCV_STACK_FP */
+} RISCVStackState;
+
+typedef struct riscv_stack_slot_t {
+	st64 offset; /* from the sp at the function entry */
+	ut8 size;
+	ut8 access; /*  RISCV_STACK_READ | RISCV_STACK_WRITE */
+} RISCVStackSlot;
+
+typedef struct riscv_stack_t {
+	const ut8 *buffer; /*  borrowed */
+	ut64 base;
+	ut64 size;
+	bool be;
+	const RISCVCfg *cfg; /* borrowed */
+	RISCVStackState *in; /* state at the entry of each block */
+	ut8 *reached; /*       block reached from the entry */
+	st64 frame_size; /*    deepest known sp, as positive size */
+	RzVector /*<RISCVStackSlot>*/ slots; /* sorted by offset */
+} RISCVStack;
+
+RISCV_API RISCVStack *riscv_stack_new(const ut8 *buffer, ut64 size, ut64 base, bool be, const RISCVCfg *cfg, ut32 entry);
+RISCV_API void riscv_stack_free(RISCVStack *stack);
+RISCV_API bool riscv_stack_at(const RISCVStack *stack, ut64 addr, RISCVStackState *state);
+
+#endif /* RISCV_STACK_H */
@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_switch.h"
+
+/* instructions before the jalr searched for the table and the bound check */
+#define SWITCH_WINDOW 32
+/* nesting allowed when resolving a constant (lui/auipc + addi chains) */
+#define SWITCH_DEPTH 4
+
+#define NOT_FOUND (-1)
+
+typedef struct switch_slice_t {
+	RISCVDecoded dec[SWITCH_WINDOW];
+	ut64 pc[SWITCH_WINDOW];
+	st32 count; /* the jalr is the last one */
+} SwitchSlice;
+
+/* last instruction before index writing reg */
+static st32 slice_def(const SwitchSlice *slice, st32 index, ut8 reg) {
+	RISCVRegisters regs;
+	for (st32 i = index - 1; i >= 0; --i) {
+		riscv_registers(&slice->dec[i], &regs);
+		if (regs.gpr_def & (1u << reg)) {
+			return i;
+		}
+	}
+	return NOT_FOUND;
+}
+
+static bool slice_const(const SwitchSlice *slice, st32 index, ut8 reg, ut32 depth, ut64 *value) {
+	if (reg == RISCV_REG_ZERO) {
+		*value = 0;
+		return true;
+	}
+	st32 def = slice_def(slice, index, reg);
+	if (def == NOT_FOUND || !depth) {
+		return false;
+	}
+	const RISCVDecoded *dec = &slice->dec[def];
+	ut64 base;
+	switch (dec->id) {
+	case RISCV_INS_LUI:
+		*value = dec->imm;
+		return true;
+	case RISCV_INS_AUIPC:
+		*value = slice->pc[def] + dec->imm;
+		return true;
+	case RISCV_INS_ADDI:
+		if (!slice_const(slice, def, dec->rs1, depth - 1, &base)) {
+			return false;
+		}
+		*value = base + dec->imm;
+		return true;
+	default:
+		return false;
+	}
+}
+
+static ut8 entry_load_size(RISCVInsId id) {
+	switch (id) {
+	case RISCV_INS_LW:
+	case RISCV_INS_LWU:
+		return 4;
+	case RISCV_INS_LD:
+		return 8;
+	default:
+		return 0;
+	}
+}
+
+/* index << scale added to the table address: add with slli or shNadd, the scale must match the entry size */
+static bool slice_table(const SwitchSlice *slice, st32 index, ut8 reg, ut8 entry_size, ut8 *idx, ut64 *table) {
+	st32 def = slice_def(slice, index, reg);
+	if (def == NOT_FOUND) {
+		return false;
+	}
+	const RISCVDecoded *dec = &slice->dec[def];
+	st64 scale = entry_size == 8 ? 3 : 2;
+	switch (dec->id) {
+	case RISCV_INS_SH2ADD:
+	case RISCV_INS_SH3ADD:
+		if ((dec->id == RISCV_INS_SH3ADD) != (scale == 3)) {
+			return false;
+		}
+		*idx = dec->rs1;
+		return slice_const(slice, def, dec->rs2, SWITCH_DEPTH, table);
+	case RISCV_INS_ADD:
+		break;
+	default:
+		return false;
+	}
+	ut8 operands[2] = { dec->rs1, dec->rs2 };
+	for (ut32 i = 0; i < 2; ++i) {
+		st32 shift = slice_def(slice, def, operands[i]);
+		if (shift == NOT_FOUND || slice->dec[shift].id != RISCV_INS_SLLI || slice->dec[shift].imm != scale) {
+			continue;
+		}
+		*idx = slice->dec[shift].rs1;
+		return slice_const(slice, def, operands[i ^ 1], SWITCH_DEPTH, table);
+	}
+	return false;
+}
+
+/*
+ * bound check on the index before it is scaled:
+ *   bltu bound, idx, default  -> idx <= bound
+ *   bgeu idx, bound, default  -> idx < bound
+ *   sltiu t, idx, N; beqz t, default
+ */
+static bool slice_bound(const SwitchSlice *slice, st32 index, ut8 idx, ut32 *n_cases, ut64 *defval) {
+	ut64 bound;
+	for (st32 i = index - 1; i >= 0; --i) {
+		const RISCVDecoded *dec = &slice->dec[i];
+		ut64 target = slice->pc[i] + dec->imm;
+		if (dec->id == RISCV_INS_BLTU && dec->rs2 == idx && slice_const(slice, i, dec->rs1, SWITCH_DEPTH, &bound)) {
+			*n_cases = bound + 1;
+		} else if (dec->id == RISCV_INS_BGEU && dec->rs1 == idx && slice_const(slice, i, dec->rs2, SWITCH_DEPTH, &bound)) {
+			*n_cases = bound;
+		} else if (dec->id == RISCV_INS_BEQ && dec->rs2 == RISCV_REG_ZERO) {
+			st32 cmp = slice_def(slice, i, dec->rs1);
+			if (cmp == NOT_FOUND || slice->dec[cmp].id != RISCV_INS_SLTIU || slice->dec[cmp].rs1 != idx) {
+				continue;
+			}
+			*n_cases = slice->dec[cmp].imm;
+		} else {
+			continue;
+		}
+		*defval = target;
+		return *n_cases > 0 && *n_cases <= RISCV_SWITCH_MAX_CASES;
+	}
+	return false;
+}
+
+static bool switch_slice(const ut8 *buffer, ut64 size, ut64 base, bool be, ut64 start, ut64 jump, SwitchSlice *slice) {
+	ut64 first = jump - start > (SWITCH_WINDOW - 1) * 4 ? jump - (SWITCH_WINDOW - 1) * 4 : start;
+	slice->count = 0;
+	for (ut64 pc = first; pc <= jump; pc += 4) {
+		ut64 offset = pc - base;
+		if (!riscv_decode(buffer + offset, size - offset, be, &slice->dec[slice->count])) {
+			/* data or unknown instruction, the slice starts after it */
+			slice->count = 0;
+			continue;
+		}
+		slice->pc[slice->count++] = pc;
+	}
+	return slice->count > 0;
+}
+
+/**
+ * Recovers the jump table used by the indirect jump at address jump.
+ * The code between start (usually the function entry) and the jump is
+ * sliced backward to find the table load, the table address and the
+ * bound check on the index; the entries are read through read and their
+ * targets are appended to targets (when not NULL).
+ */
+bool riscv_switch_recover(const ut8 *buffer, ut64 size, ut64 base, bool be, ut64 start, ut64 jump, RISCVReadAt read, void *user, RISCVSwitch *sw, RzVector /*<ut64>*/ *targets) {
+	rz_return_val_if_fail(buffer && read && sw, false);
+	if (start < base || start > jump || jump + 4 > base + size || (jump - start) & 3) {
+		return false;
+	}
+
+	SwitchSlice slice;
+	if (!switch_slice(buffer, size, base, be, start, jump, &slice)) {
+		return false;
+	}
+	st32 last = slice.count - 1;
+	const RISCVDecoded *jalr = &slice.dec[last];
+	if (jalr->id != RISCV_INS_JALR || jalr->rd != RISCV_REG_ZERO || slice.pc[last] != jump) {
+		return false;
+	}
+
+	memset(sw, 0, sizeof(RISCVSwitch));
+	sw->jump = jump;
+
+	/* jalr target: the loaded entry, or entry + base for relative tables */
+	st32 load = slice_def(&slice, last, jalr->rs1);
+	if (load == NOT_FOUND) {
+		return false;
+	}
+	if (slice.dec[load].id == RISCV_INS_ADD) {
+		const RISCVDecoded *add = &slice.dec[load];
+		ut8 operands[2] = { add->rs1, add->rs2 };
+		st32 entry = NOT_FOUND;
+		for (ut32 i = 0; i < 2 && entry == NOT_FOUND; ++i) {
+			st32 def = slice_def(&slice, load, operands[i]);
+			if (def != NOT_FOUND && entry_load_size(slice.dec[def].id) &&
+				slice_const(&slice, load, operands[i ^ 1], SWITCH_DEPTH, &sw->base)) {
+				entry = def;
+			}
+		}
+		if (entry == NOT_FOUND) {
+			return false;
+		}
+		sw->relative = true;
+		load = entry;
+	}
+	const RISCVDecoded *entry = &slice.dec[load];
+	sw->entry_size = entry_load_size(entry->id);
+	if (!sw->entry_size) {
+		return false;
+	}
+
+	ut8 idx;
+	if (!slice_table(&slice, load, entry->rs1, sw->entry_size, &idx, &sw->table) ||
+		!slice_bound(&slice, load, idx, &sw->n_cases, &sw->defval)) {
+		return false;
+	}
+	sw->table += entry->imm;
+
+	for (ut32 i = 0; targets && i < sw->n_cases; ++i) {
+		ut8 raw[8];
+		if (!read(user, sw->table + (ut64)i * sw->entry_size, raw, sw->entry_size)) {
+			return false;
+		}
+		ut64 target = sw->entry_size == 8 ? rz_read_ble64(raw, be) : (ut64)(st64)(st32)rz_read_ble32(raw, be);
+		if (entry->id == RISCV_INS_LWU) {
+			target &= UT32_MAX;
+		}
+		target += sw->base;
+		if (!rz_vector_push(targets, &target)) {
+			return false;
+		}
+	}
+	return true;
+}
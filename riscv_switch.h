@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_SWITCH_H
+#define RISCV_SWITCH_H
+
+#include "riscv_decode.h"
+
+/* largest table that is enumerated */
+#define RISCV_SWITCH_MAX_CASES 0x10000
+
+/* reads len bytes at addr, used to access the jump table */
+typedef bool (*RISCVReadAt)(void *user, ut64 addr, ut8 *buf, ut32 len);
+
+typedef struct riscv_switch_t {
+	ut64 jump; /*       address of the indirect jalr */
+	ut64 table; /*      address of the first entry */
+	ut64 base; /*       value added to the entries of relative tables */
+	ut64 defval; /*     target taken when the bound check fails */
+	ut32 n_cases; /*    number of entries */
+	ut8 entry_size; /*  4 or 8 bytes */
+	bool relative; /*   entries are offsets from base */
+} RISCVSwitch;
+
+RISCV_API bool riscv_switch_recover(const ut8 *buffer, ut64 size, ut64 base, bool be, ut64 start, ut64 jump, RISCVReadAt read, void *user, RISCVSwitch *sw, RzVector /*<ut64>*/ *targets);
+
+#endif /* RISCV_SWITCH_H */
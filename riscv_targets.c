@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_targets.h"
+
+/* words checked per step of the scan, the filter loop has no branches */
+#define SCAN_LANES 8
+
+#define OPCODE_AUIPC  0x17
+#define OPCODE_BRANCH 0x63
+#define OPCODE_JALR   0x67
+#define OPCODE_JAL    0x6f
+
+#define word_opcode(w) ((w)&0x7f)
+#define word_funct3(w) (((w) >> 12) & 0x7)
+#define word_rd(w)     (((w) >> 7) & 0x1f)
+#define word_rs1(w)    (((w) >> 15) & 0x1f)
+
+/* major opcodes that can lead to a target, funct3 2 and 3 are not branches */
+static inline ut32 scan_filter(ut32 word) {
+	ut32 opcode = word_opcode(word);
+	ut32 funct3 = word_funct3(word);
+	return (opcode == OPCODE_JAL) |
+		((opcode == OPCODE_BRANCH) & ((funct3 & 6) != 2)) |
+		((opcode == OPCODE_JALR) & (funct3 == 0) & (word_rs1(word) == 0)) |
+		(opcode == OPCODE_AUIPC);
+}
+
+static int target_cmp(const void *a, const void *b, void *user) {
+	ut64 x = *(const ut64 *)a;
+	ut64 y = *(const ut64 *)b;
+	return x < y ? -1 : x > y;
+}
+
+static bool scan_word(ut32 word, ut32 next, bool has_next, ut64 pc, ut32 kinds, ut64 *target) {
+	ut32 kind;
+	switch (word_opcode(word)) {
+	case OPCODE_JAL:
+		kind = word_rd(word) ? RISCV_TARGETS_CALL : RISCV_TARGETS_JUMP;
+		*target = pc + riscv_immediate(RISCV_IMM_J, word);
+		break;
+	case OPCODE_BRANCH:
+		kind = RISCV_TARGETS_BRANCH;
+		*target = pc + riscv_immediate(RISCV_IMM_B, word);
+		break;
+	case OPCODE_JALR:
+		/* jalr from x0, the target is absolute; jalr clears the lowest bit */
+		kind = word_rd(word) ? RISCV_TARGETS_CALL : RISCV_TARGETS_JUMP;
+		*target = riscv_immediate(RISCV_IMM_I, word) & ~1ull;
+		break;
+	default:
+		/* auipc rd followed by jalr rd: far call or tail call */
+		if (!has_next || word_opcode(next) != OPCODE_JALR || word_funct3(next) ||
+			!word_rd(word) || word_rs1(next) != word_rd(word)) {
+			return false;
+		}
+		kind = word_rd(next) ? RISCV_TARGETS_CALL : RISCV_TARGETS_JUMP;
+		*target = (pc + riscv_immediate(RISCV_IMM_U, word) + riscv_immediate(RISCV_IMM_I, next)) & ~1ull;
+		break;
+	}
+	return kinds & kind;
+}
+
+/**
+ * Collects the static targets of branches, jumps and calls found in buffer
+ * without matching the full instruction table; only the major opcode is
+ * checked. On return targets is sorted and without duplicates.
+ * Returns the number of targets found by this scan (duplicates included),
+ * or RISCV_TARGETS_FAILED when a target cannot be pushed: the scan stops
+ * there and targets holds the ones found before.
+ */
+ut32 riscv_targets_scan(const ut8 *buffer, ut64 size, ut64 base, bool be, ut32 kinds, RzVector /*<ut64>*/ *targets) {
+	rz_return_val_if_fail(buffer && targets, 0);
+	ut32 words[SCAN_LANES];
+	ut64 target;
+	ut32 count = 0;
+	ut64 n_words = size / 4;
+	bool failed = false;
+
+	for (ut64 i = 0; !failed && i < n_words; i += SCAN_LANES) {
+		ut32 lanes = n_words - i < SCAN_LANES ? n_words - i : SCAN_LANES;
+		ut32 hits = 0;
+		for (ut32 j = 0; j < lanes; ++j) {
+			words[j] = rz_read_ble32(buffer + (i + j) * 4, be);
+		}
+		for (ut32 j = 0; j < lanes; ++j) {
+			hits |= scan_filter(words[j]) << j;
+		}
+		for (ut32 j = 0; hits && j < lanes; ++j) {
+			if (!(hits & (1u << j))) {
+				continue;
+			}
+			hits &= ~(1u << j);
+			ut64 k = i + j;
+			bool has_next = k + 1 < n_words;
+			ut32 next = has_next ? rz_read_ble32(buffer + (k + 1) * 4, be) : 0;
+			if (!scan_word(words[j], next, has_next, base + k * 4, kinds, &target)) {
+				continue;
+			}
+			if (!rz_vector_push(targets, &target)) {
+				/* the targets pushed so far are still sorted below */
+				failed = true;
+				break;
+			}
+			count++;
+		}
+	}
+
+	/* sort and drop the duplicates in place */
+	rz_vector_sort(targets, target_cmp, false, NULL);
+	ut64 *items = targets->a;
+	size_t unique = 0;
+	for (size_t i = 0; i < rz_vector_len(targets); ++i) {
+		if (!unique || items[unique - 1] != items[i]) {
+			items[unique++] = items[i];
+		}
+	}
+	targets->len = unique;
+	return failed ? RISCV_TARGETS_FAILED : count;
+}
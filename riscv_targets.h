@@ -0,0 +1,20 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_TARGETS_H
+#define RISCV_TARGETS_H
+
+#include "riscv_decode.h"
+
+/* kinds of control flow whose targets are collected */
+#define RISCV_TARGETS_BRANCH (1 << 0) /* conditional branches */
+#define RISCV_TARGETS_JUMP   (1 << 1) /* jal/jalr without link register */
+#define RISCV_TARGETS_CALL   (1 << 2) /* jal/jalr with a link register */
+#define RISCV_TARGETS_ALL    (RISCV_TARGETS_BRANCH | RISCV_TARGETS_JUMP | RISCV_TARGETS_CALL)
+
+/* returned by riscv_targets_scan() when a target cannot be pushed */
+#define RISCV_TARGETS_FAILED UT32_MAX
+
+RISCV_API ut32 riscv_targets_scan(const ut8 *buffer, ut64 size, ut64 base, bool be, ut32 kinds, RzVector /*<ut64>*/ *targets);
+
+#endif /* RISCV_TARGETS_H */
@@ -0,0 +1,274 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_vendor.h"
+#include "riscv_decode_private.h"
+
+/* major opcode in bits 6:0 and funct3 in bits 9:7 */
+#define VENDOR_BUCKET(data) (((data) & 0x7f) | (((data) >> 5) & 0x380))
+
+static void vendor_insn_fini(void *e, void *user) {
+	RISCVVendorInsn *insn = e;
+	free((char *)insn->name);
+	free((char *)insn->format);
+}
+
+static const RISCVVendorInsn *vendor_insn(const RISCVVendor *vendor, ut32 index) {
+	return (const RISCVVendorInsn *)vendor->insns.a + index;
+}
+
+RISCVVendor *riscv_vendor_new(void) {
+	RISCVVendor *vendor = RZ_NEW0(RISCVVendor);
+	if (!vendor) {
+		return NULL;
+	}
+	rz_vector_init(&vendor->insns, sizeof(RISCVVendorInsn), vendor_insn_fini, NULL);
+	return vendor;
+}
+
+void riscv_vendor_free(RISCVVendor *vendor) {
+	if (!vendor) {
+		return;
+	}
+	rz_vector_fini(&vendor->insns);
+	free(vendor->index);
+	free(vendor->candidates);
+	free(vendor);
+}
+
+/**
+ * Copies the descriptors into the vendor table, the instructions are
+ * decoded only after the next riscv_vendor_build().
+ * Fails without adding anything when a descriptor is not valid.
+ */
+bool riscv_vendor_add(RISCVVendor *vendor, const RISCVVendorInsn *insns, ut32 n_insns) {
+	rz_return_val_if_fail(vendor && insns, false);
+	if (RISCV_INS_COUNT + rz_vector_len(&vendor->insns) + n_insns >= UT16_MAX) {
+		return false;
+	}
+	for (ut32 i = 0; i < n_insns; ++i) {
+		const RISCVVendorInsn *insn = &insns[i];
+		/* only 32 bits instructions, bucketed by major opcode */
+		if (!insn->name || (insn->mask & 0x7f) != 0x7f || (insn->match & ~insn->mask) || (insn->match & 3) != 3) {
+			return false;
+		}
+	}
+	/* all the strings are copied before the table is touched */
+	RISCVVendorInsn *copies = RZ_NEWS0(RISCVVendorInsn, n_insns ? n_insns : 1);
+	if (!copies) {
+		return false;
+	}
+	bool ok = true;
+	for (ut32 i = 0; i < n_insns && ok; ++i) {
+		copies[i] = insns[i];
+		copies[i].name = strdup(insns[i].name);
+		copies[i].format = insns[i].format ? strdup(insns[i].format) : NULL;
+		ok = copies[i].name && (!insns[i].format || copies[i].format);
+	}
+	if (!ok || !rz_vector_reserve(&vendor->insns, rz_vector_len(&vendor->insns) + n_insns)) {
+		for (ut32 i = 0; i < n_insns; ++i) {
+			vendor_insn_fini(&copies[i], NULL);
+		}
+		free(copies);
+		return false;
+	}
+	/* cannot fail after the reserve */
+	for (ut32 i = 0; i < n_insns; ++i) {
+		rz_vector_push(&vendor->insns, &copies[i]);
+	}
+	free(copies);
+	R_FREE(vendor->index);
+	R_FREE(vendor->candidates);
+	return true;
+}
+
+static ut32 popcount(ut32 x) {
+	ut32 n = 0;
+	for (; x; x &= x - 1) {
+		n++;
+	}
+	return n;
+}
+
+/**
+ * Rebuilds the buckets after the last riscv_vendor_add(). Each bucket lists
+ * the vendor instructions it can hold, the most specific ones first; vendor
+ * instructions take precedence over the standard ones.
+ */
+bool riscv_vendor_build(RISCVVendor *vendor) {
+	rz_return_val_if_fail(vendor, false);
+	ut32 n_insns = rz_vector_len(&vendor->insns);
+	/* worst case every instruction is in the eight funct3 buckets of its opcode */
+	ut32 capacity = 1 + n_insns * 8 + RISCV_VENDOR_BUCKETS;
+	if (capacity >= UT16_MAX) {
+		return false;
+	}
+
+	free(vendor->index);
+	free(vendor->candidates);
+	vendor->index = RZ_NEWS0(ut16, RISCV_VENDOR_BUCKETS);
+	vendor->candidates = RZ_NEWS(ut16, capacity);
+	ut16 *order = RZ_NEWS(ut16, n_insns + 1);
+	if (!vendor->index || !vendor->candidates || !order) {
+		R_FREE(vendor->index);
+		R_FREE(vendor->candidates);
+		free(order);
+		return false;
+	}
+
+	/* stable insertion sort by the number of checked bits */
+	for (ut32 i = 0; i < n_insns; ++i) {
+		ut32 bits = popcount(vendor_insn(vendor, i)->mask), j = i;
+		for (; j > 0 && popcount(vendor_insn(vendor, order[j - 1])->mask) < bits; --j) {
+			order[j] = order[j - 1];
+		}
+		order[j] = i;
+	}
+
+	/* offset 0 is the empty list shared by the buckets without vendor instructions */
+	ut32 size = 0;
+	vendor->candidates[size++] = UT16_MAX;
+	for (ut32 bucket = 0; bucket < RISCV_VENDOR_BUCKETS; ++bucket) {
+		ut32 start = size;
+		for (ut32 i = 0; i < n_insns; ++i) {
+			const RISCVVendorInsn *insn = vendor_insn(vendor, order[i]);
+			ut32 key = VENDOR_BUCKET(insn->match) ^ bucket;
+			if (!(key & VENDOR_BUCKET(insn->mask))) {
+				vendor->candidates[size++] = order[i];
+			}
+		}
+		if (size != start) {
+			vendor->candidates[size++] = UT16_MAX;
+			vendor->index[bucket] = start;
+		}
+	}
+	free(order);
+	return true;
+}
+
+/**
+ * Decodes a vendor instruction, or a standard one when no vendor instruction matches.
+ * Vendor instructions get the id RISCV_INS_COUNT + the order they were added;
+ * until riscv_vendor_build() is called only the standard ones are decoded.
+ */
+bool riscv_vendor_decode_word(const RISCVVendor *vendor, ut32 data, RISCVDecoded *dec) {
+	rz_return_val_if_fail(vendor && dec, false);
+	if (!vendor->index) {
+		return riscv_decode_word(data, dec);
+	}
+	const ut16 *list = vendor->candidates + vendor->index[VENDOR_BUCKET(data)];
+	for (; *list != UT16_MAX; ++list) {
+		const RISCVVendorInsn *insn = vendor_insn(vendor, *list);
+		if ((data & insn->mask) != insn->match) {
+			continue;
+		}
+		dec->data = data;
+		dec->id = RISCV_INS_COUNT + *list;
+		dec->size = 4;
+		dec->rd = (data >> 7) & 0x1f;
+		dec->rs1 = (data >> 15) & 0x1f;
+		dec->rs2 = (data >> 20) & 0x1f;
+		dec->rs3 = data >> 27;
+		dec->imm = riscv_immediate(insn->imm, data);
+		return true;
+	}
+	return riscv_decode_word(data, dec);
+}
+
+bool riscv_vendor_decode(const RISCVVendor *vendor, const ut8 *buffer, const ut32 size, bool be, RISCVDecoded *dec) {
+	rz_return_val_if_fail(buffer && dec, false);
+	if (size < 4) {
+		return false;
+	}
+	return riscv_vendor_decode_word(vendor, rz_read_ble32(buffer, be), dec);
+}
+
+cchar *riscv_vendor_mnemonic(const RISCVVendor *vendor, ut16 id) {
+	rz_return_val_if_fail(vendor, NULL);
+	if (id < RISCV_INS_COUNT) {
+		return riscv_mnemonic(id);
+	} else if ((size_t)id - RISCV_INS_COUNT >= rz_vector_len(&vendor->insns)) {
+		return NULL;
+	}
+	return vendor_insn(vendor, id - RISCV_INS_COUNT)->name;
+}
+
+void riscv_vendor_registers(const RISCVVendor *vendor, const RISCVDecoded *dec, RISCVRegisters *regs) {
+	rz_return_if_fail(vendor && dec && regs);
+	if (dec->id < RISCV_INS_COUNT) {
+		riscv_registers(dec, regs);
+		return;
+	}
+	rz_return_if_fail((size_t)dec->id - RISCV_INS_COUNT < rz_vector_len(&vendor->insns));
+	riscv_registers_roles(vendor_insn(vendor, dec->id - RISCV_INS_COUNT)->regs, dec, regs);
+}
+
+/* renders the {operand} placeholder, returns false when it is not known */
+static bool vendor_operand(cchar *name, size_t length, const RISCVDecoded *dec, ut64 pc, RzStrBuf *sb) {
+	static const struct {
+		cchar *name;
+		const char (*registers)[RISCV_REG_NAME_SIZE];
+		ut8 field;
+	} operands[] = {
+		{ "rd", registers_std, 0 },
+		{ "rs1", registers_std, 1 },
+		{ "rs2", registers_std, 2 },
+		{ "rs3", registers_std, 3 },
+		{ "fd", registers_flt, 0 },
+		{ "fs1", registers_flt, 1 },
+		{ "fs2", registers_flt, 2 },
+		{ "fs3", registers_flt, 3 },
+		{ "vd", registers_vec, 0 },
+		{ "vs1", registers_vec, 1 },
+		{ "vs2", registers_vec, 2 },
+		{ "vs3", registers_vec, 0 },
+	};
+	if (length == 3 && !strncmp(name, "imm", 3)) {
+		rz_strbuf_appendf(sb, "%" PFMT64d, dec->imm);
+		return true;
+	} else if (length == 6 && !strncmp(name, "target", 6)) {
+		rz_strbuf_appendf(sb, "0x%" PFMT64x, pc + dec->imm);
+		return true;
+	}
+	for (ut32 i = 0; i < RZ_ARRAY_SIZE(operands); ++i) {
+		if (strlen(operands[i].name) != length || strncmp(operands[i].name, name, length)) {
+			continue;
+		}
+		const ut8 fields[] = { dec->rd, dec->rs1, dec->rs2, dec->rs3 };
+		rz_strbuf_append(sb, operands[i].registers[fields[operands[i].field]]);
+		return true;
+	}
+	return false;
+}
+
+ut32 riscv_vendor_disassembler(const RISCVVendor *vendor, const ut8 *buffer, const ut32 size, ut64 pc, bool be, RzStrBuf *sb) {
+	rz_return_val_if_fail(vendor && buffer && size && sb, RISCV_INVALID_SIZE);
+	RISCVDecoded dec;
+	if (!riscv_vendor_decode(vendor, buffer, size, be, &dec)) {
+		return RISCV_INVALID_SIZE;
+	} else if (dec.id < RISCV_INS_COUNT) {
+		return riscv_disassembler(buffer, size, pc, be, sb);
+	}
+
+	const RISCVVendorInsn *insn = vendor_insn(vendor, dec.id - RISCV_INS_COUNT);
+	rz_strbuf_set(sb, insn->name);
+	if (!insn->format || !*insn->format) {
+		return dec.size;
+	}
+	rz_strbuf_append(sb, " ");
+	for (cchar *p = insn->format; *p;) {
+		cchar *open = strchr(p, '{');
+		cchar *close = open ? strchr(open, '}') : NULL;
+		if (!close) {
+			rz_strbuf_append(sb, p);
+			break;
+		}
+		rz_strbuf_appendf(sb, "%.*s", (int)(open - p), p);
+		if (!vendor_operand(open + 1, close - open - 1, &dec, pc, sb)) {
+			/* unknown placeholders are kept as they are */
+			rz_strbuf_appendf(sb, "%.*s", (int)(close - open + 1), open);
+		}
+		p = close + 1;
+	}
+	return dec.size;
+}
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_VENDOR_H
+#define RISCV_VENDOR_H
+
+#include "riscv_decode.h"
+
+/* buckets keyed by major opcode and funct3 */
+#define RISCV_VENDOR_BUCKETS 1024
+
+/**
+ * Vendor instruction descriptor, the format renders the operands:
+ *   {rd} {rs1} {rs2} {rs3}  general purpose registers
+ *   {fd} {fs1} {fs2} {fs3}  floating point registers
+ *   {vd} {vs1} {vs2} {vs3}  vector registers
+ *   {imm}                   immediate as described by RISCVImmediate
+ *   {target}                pc + immediate
+ */
+typedef struct riscv_vendor_insn_t {
+	cchar *name; /*   mnemonic */
+	ut32 mask; /*     checked bits, must include the major opcode */
+	ut32 match; /*    expected value of the checked bits */
+	ut8 imm; /*       RISCVImmediate */
+	ut16 regs; /*     RISCV_REGS_* roles of the register operands */
+	cchar *format; /* operands, NULL or empty when there are none */
+} RISCVVendorInsn;
+
+/* vendor instructions get the ids from RISCV_INS_COUNT onwards, in the order they are added */
+typedef struct riscv_vendor_t {
+	RzVector /*<RISCVVendorInsn>*/ insns;
+	ut16 *index; /*      offset in candidates of each bucket, NULL until built */
+	ut16 *candidates; /* vendor instructions of each bucket, ending with UT16_MAX */
+} RISCVVendor;
+
+RISCV_API RISCVVendor *riscv_vendor_new(void);
+RISCV_API void riscv_vendor_free(RISCVVendor *vendor);
+RISCV_API bool riscv_vendor_add(RISCVVendor *vendor, const RISCVVendorInsn *insns, ut32 n_insns);
+RISCV_API bool riscv_vendor_build(RISCVVendor *vendor);
+RISCV_API bool riscv_vendor_decode_word(const RISCVVendor *vendor, ut32 data, RISCVDecoded *dec);
+RISCV_API bool riscv_vendor_decode(const RISCVVendor *vendor, const ut8 *buffer, const ut32 size, bool be, RISCVDecoded *dec);
+RISCV_API cchar *riscv_vendor_mnemonic(const RISCVVendor *vendor, ut16 id);
+RISCV_API void riscv_vendor_registers(const RISCVVendor *vendor, const RISCVDecoded *dec, RISCVRegisters *regs);
+RISCV_API ut32 riscv_vendor_disassembler(const RISCVVendor *vendor, const ut8 *buffer, const ut32 size, ut64 pc, bool be, RzStrBuf *sb);
+
+#endif /* RISCV_VENDOR_H */
@@ -0,0 +1,12 @@
+# SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+# SPDX-License-Identifier: LGPL-3.0-only
+
+# the generator reads riscv_opcodes.json from the working directory
+execute_process(COMMAND ${PYTHON} generate_riscv_disassembler.py --blob
+	WORKING_DIRECTORY ${SOURCE}
+	OUTPUT_FILE ${OUTPUT}
+	RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+	file(REMOVE ${OUTPUT})
+	message(FATAL_ERROR "generate_riscv_disassembler.py --blob failed: ${result}")
+endif()
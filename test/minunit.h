@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#ifndef RISCV_MINUNIT_H
+#define RISCV_MINUNIT_H
+
+/**
+ * Minimal unit test helpers, same interface of the rizin test/unit/minunit.h.
+ * Each test is a bool function ending with mu_end, a failed check returns false.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+static int mu_tests_run = 0;
+static int mu_tests_failed = 0;
+/* arguments of the test executable, like the path of the data files */
+static int mu_argc = 0;
+static char **mu_argv = NULL;
+
+#define mu_fail(message) \
+	do { \
+		fprintf(stderr, "%s:%d: %s\n", __FILE__, __LINE__, message); \
+		return false; \
+	} while (0)
+
+#define mu_assert(message, test) \
+	do { \
+		if (!(test)) { \
+			mu_fail(message); \
+		} \
+	} while (0)
+
+#define mu_assert_true(actual, message)  mu_assert(message, (actual))
+#define mu_assert_false(actual, message) mu_assert(message, !(actual))
+#define mu_assert_notnull(actual, message) mu_assert(message, (actual) != NULL)
+
+#define mu_assert_eq(actual, expected, message) \
+	do { \
+		uint64_t act__ = (uint64_t)(actual), exp__ = (uint64_t)(expected); \
+		if (act__ != exp__) { \
+			fprintf(stderr, "%s:%d: %s: expected 0x%" PRIx64 ", got 0x%" PRIx64 "\n", __FILE__, __LINE__, message, exp__, act__); \
+			return false; \
+		} \
+	} while (0)
+
+#define mu_assert_streq(actual, expected, message) \
+	do { \
+		const char *act__ = (actual), *exp__ = (expected); \
+		if (!act__ || strcmp(act__, exp__)) { \
+			fprintf(stderr, "%s:%d: %s: expected '%s', got '%s'\n", __FILE__, __LINE__, message, exp__, act__ ? act__ : "(null)"); \
+			return false; \
+		} \
+	} while (0)
+
+#define mu_end return true
+
+#define mu_run_test(test) \
+	do { \
+		mu_tests_run++; \
+		if (!test()) { \
+			fprintf(stderr, "FAIL %s\n", #test); \
+			mu_tests_failed++; \
+		} \
+	} while (0)
+
+#define mu_main(all_tests) \
+	int main(int argc, char **argv) { \
+		mu_argc = argc; \
+		mu_argv = argv; \
+		all_tests(); \
+		printf("%d tests, %d failed\n", mu_tests_run, mu_tests_failed); \
+		return mu_tests_failed ? 1 : 0; \
+	}
+
+#endif /* RISCV_MINUNIT_H */
@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_blob.h"
+#include "minunit.h"
+
+/* path of the blob written by generate_riscv_disassembler.py --blob */
+static cchar *blob_path(void) {
+	return mu_argc > 1 ? mu_argv[1] : "riscv.bin";
+}
+
+static ut32 xorshift(ut32 *state) {
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+/* decodes data with both the compiled tables and the blob, the text is compared when there is no alias */
+static bool same_decode(const RISCVBlob *blob, ut32 data) {
+	ut8 buffer[4] = { data & 0xff, (data >> 8) & 0xff, (data >> 16) & 0xff, data >> 24 };
+	RISCVDecoded a, b;
+	memset(&a, 0, sizeof(a));
+	memset(&b, 0, sizeof(b));
+	bool x = riscv_decode(buffer, sizeof(buffer), false, &a);
+	bool y = riscv_blob_decode(blob, buffer, sizeof(buffer), false, &b);
+	char message[128];
+	snprintf(message, sizeof(message), "0x%08x", data);
+	mu_assert_eq(y, x, message);
+	if (!x) {
+		return true;
+	}
+	mu_assert_eq(b.id, a.id, message);
+	mu_assert_eq(b.size, a.size, message);
+	mu_assert_eq(b.imm, a.imm, message);
+	mu_assert_true(b.rd == a.rd && b.rs1 == a.rs1 && b.rs2 == a.rs2 && b.rs3 == a.rs3, message);
+
+	RzStrBuf alias, sa, sb;
+	rz_strbuf_init(&alias);
+	rz_strbuf_init(&sa);
+	rz_strbuf_init(&sb);
+	bool aliased = riscv_alias(&a, 0x1000, &alias);
+	mu_assert_eq(riscv_disassembler(buffer, sizeof(buffer), 0x1000, false, &sa), a.size, message);
+	mu_assert_eq(riscv_blob_disassembler(blob, buffer, sizeof(buffer), 0x1000, false, &sb), a.size, message);
+	if (!aliased) {
+		mu_assert_streq(rz_strbuf_get(&sb), rz_strbuf_get(&sa), message);
+	}
+	rz_strbuf_fini(&alias);
+	rz_strbuf_fini(&sa);
+	rz_strbuf_fini(&sb);
+	mu_end;
+}
+
+static bool test_blob_mnemonics(void) {
+	RISCVBlob *blob = riscv_blob_open(blob_path());
+	mu_assert_notnull(blob, "open the blob");
+	for (ut32 id = 0; id < RISCV_INS_COUNT; ++id) {
+		mu_assert_streq(riscv_blob_mnemonic(blob, id), riscv_mnemonic(id), "mnemonic");
+	}
+	mu_assert_true(riscv_blob_mnemonic(blob, RISCV_INS_COUNT) == NULL, "no mnemonic past the last id");
+	riscv_blob_free(blob);
+	mu_end;
+}
+
+static bool test_blob_compressed(void) {
+	RISCVBlob *blob = riscv_blob_open(blob_path());
+	mu_assert_notnull(blob, "open the blob");
+	for (ut32 data = 0; data < 0x10000; ++data) {
+		if ((data & 3) != 3 && !same_decode(blob, data)) {
+			riscv_blob_free(blob);
+			return false;
+		}
+	}
+	riscv_blob_free(blob);
+	mu_end;
+}
+
+static bool test_blob_random(void) {
+	RISCVBlob *blob = riscv_blob_open(blob_path());
+	mu_assert_notnull(blob, "open the blob");
+	ut32 state = 0x9e3779b9;
+	for (ut32 i = 0; i < 1000000; ++i) {
+		/* half of the words with the 32 bits instruction size */
+		ut32 data = xorshift(&state) | (i & 1 ? 3 : 0);
+		if (!same_decode(blob, data)) {
+			riscv_blob_free(blob);
+			return false;
+		}
+	}
+	riscv_blob_free(blob);
+	mu_end;
+}
+
+static bool test_blob_invalid(void) {
+	FILE *fd = fopen(blob_path(), "rb");
+	mu_assert_notnull(fd, "open the blob file");
+	static ut8 buffer[1 << 20];
+	size_t size = fread(buffer, 1, sizeof(buffer), fd);
+	fclose(fd);
+	mu_assert_true(size > sizeof(RISCVBlobHeader) && size < sizeof(buffer), "read the blob");
+
+	RISCVBlob *blob = riscv_blob_new(buffer, size);
+	mu_assert_notnull(blob, "valid blob");
+	riscv_blob_free(blob);
+	mu_assert_true(riscv_blob_new(buffer, size - 1) == NULL, "truncated blob");
+	mu_assert_true(riscv_blob_new(buffer, sizeof(RISCVBlobHeader) - 1) == NULL, "truncated header");
+	buffer[0] ^= 0xff;
+	mu_assert_true(riscv_blob_new(buffer, size) == NULL, "wrong magic");
+	buffer[0] ^= 0xff;
+	buffer[4] ^= 0xff;
+	mu_assert_true(riscv_blob_new(buffer, size) == NULL, "wrong version");
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_blob_mnemonics);
+	mu_run_test(test_blob_compressed);
+	mu_run_test(test_blob_random);
+	mu_run_test(test_blob_invalid);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_cfg.h"
+#include "minunit.h"
+
+#define RA 1
+#define T1 6
+#define A0 10
+#define A1 11
+#define A2 12
+#define A3 13
+
+#define ENC_I(opcode, funct3, rd, rs1, imm) \
+	((((ut32)(imm) & 0xfff) << 20) | ((rs1) << 15) | ((funct3) << 12) | ((rd) << 7) | (opcode))
+#define ENC_B(funct3, rs1, rs2, imm) \
+	(((((ut32)(imm) >> 12) & 1) << 31) | ((((ut32)(imm) >> 5) & 0x3f) << 25) | ((rs2) << 20) | ((rs1) << 15) | \
+		((funct3) << 12) | ((((ut32)(imm) >> 1) & 0xf) << 8) | ((((ut32)(imm) >> 11) & 1) << 7) | 0x63)
+#define ENC_J(rd, imm) \
+	(((((ut32)(imm) >> 20) & 1) << 31) | ((((ut32)(imm) >> 1) & 0x3ff) << 21) | ((((ut32)(imm) >> 11) & 1) << 20) | \
+		((((ut32)(imm) >> 12) & 0xff) << 12) | ((rd) << 7) | 0x6f)
+
+#define ADDI(rd, rs1, imm) ENC_I(0x13, 0, rd, rs1, imm)
+#define JALR(rd, rs1, imm) ENC_I(0x67, 0, rd, rs1, imm)
+#define BEQ(rs1, rs2, imm) ENC_B(0, rs1, rs2, imm)
+#define JAL(rd, imm)       ENC_J(rd, imm)
+#define RET                JALR(0, RA, 0)
+
+static void put_code(ut8 *buffer, const ut32 *code, ut32 n_insns) {
+	for (ut32 i = 0; i < n_insns; ++i) {
+		buffer[i * 4 + 0] = code[i] & 0xff;
+		buffer[i * 4 + 1] = (code[i] >> 8) & 0xff;
+		buffer[i * 4 + 2] = (code[i] >> 16) & 0xff;
+		buffer[i * 4 + 3] = code[i] >> 24;
+	}
+}
+
+static bool test_cfg_diamond(void) {
+	static const ut32 code[] = {
+		BEQ(A1, 0, 12), /*  0x1000 b0 */
+		ADDI(A0, A2, 0), /* 0x1004 b1 */
+		JAL(0, 8), /*       0x1008 */
+		ADDI(A0, A3, 0), /* 0x100c b2 */
+		RET, /*             0x1010 b3 */
+	};
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+	const ut64 entry = 0x1000;
+
+	RISCVCfg *cfg = riscv_cfg_new(buffer, sizeof(buffer), 0x1000, false, &entry, 1);
+	mu_assert_notnull(cfg, "cfg");
+	static const ut64 addr[] = { 0x1000, 0x1004, 0x100c, 0x1010 };
+	static const ut32 size[] = { 4, 8, 4, 4 };
+	static const ut32 edge_offset[] = { 0, 2, 3, 4, 4 };
+	static const ut32 edges[] = { 2, 1, 3, 3 };
+	mu_assert_eq(cfg->n_blocks, RZ_ARRAY_SIZE(addr), "blocks");
+	mu_assert_eq(cfg->n_edges, RZ_ARRAY_SIZE(edges), "edges");
+	for (ut32 i = 0; i < cfg->n_blocks; ++i) {
+		mu_assert_eq(cfg->addr[i], addr[i], "block address");
+		mu_assert_eq(cfg->size[i], size[i], "block size");
+	}
+	for (ut32 i = 0; i <= cfg->n_blocks; ++i) {
+		mu_assert_eq(cfg->edge_offset[i], edge_offset[i], "edge offset");
+	}
+	for (ut32 i = 0; i < cfg->n_edges; ++i) {
+		mu_assert_eq(cfg->edges[i], edges[i], "successor, the jump before the fall through");
+	}
+	mu_assert_eq(riscv_cfg_block_at(cfg, 0x1008), 1, "block at");
+	mu_assert_eq(riscv_cfg_block_at(cfg, 0x1014), RISCV_CFG_INVALID, "no block");
+	riscv_cfg_free(cfg);
+	mu_end;
+}
+
+static bool test_cfg_call(void) {
+	static const ut32 code[] = {
+		ADDI(A0, 0, 1), /*  0x2000 */
+		JAL(RA, 0x10), /*   0x2004 the call does not end the block */
+		JALR(0, T1, 0), /*  0x2008 indirect jump, no successors */
+		ADDI(A0, 0, 2), /*  0x200c not reached */
+		RET, /*             0x2010 callee, not followed */
+	};
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+	const ut64 entry = 0x2000;
+
+	RISCVCfg *cfg = riscv_cfg_new(buffer, sizeof(buffer), 0x2000, false, &entry, 1);
+	mu_assert_notnull(cfg, "cfg");
+	mu_assert_eq(cfg->n_blocks, 1, "one block");
+	mu_assert_eq(cfg->size[0], 12, "up to the indirect jump");
+	mu_assert_eq(cfg->n_edges, 0, "no successors");
+	mu_assert_eq(riscv_cfg_block_at(cfg, 0x2010), RISCV_CFG_INVALID, "callee");
+	riscv_cfg_free(cfg);
+
+	/* the callee given as a second entry gets its own block */
+	const ut64 entries[] = { 0x2000, 0x2010 };
+	cfg = riscv_cfg_new(buffer, sizeof(buffer), 0x2000, false, entries, RZ_ARRAY_SIZE(entries));
+	mu_assert_notnull(cfg, "cfg");
+	mu_assert_eq(cfg->n_blocks, 2, "two blocks");
+	mu_assert_eq(riscv_cfg_block_at(cfg, 0x2010), 1, "callee");
+	riscv_cfg_free(cfg);
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_cfg_diamond);
+	mu_run_test(test_cfg_call);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_cost.h"
+#include "minunit.h"
+
+static bool test_cost_defaults(void) {
+	RISCVCostModel *model = riscv_cost_model_new();
+	mu_assert_notnull(model, "new model");
+	mu_assert_eq(model->issue_width, 1, "single issue");
+	mu_assert_eq(model->cost[RISCV_INS_ADD].latency, 1, "alu");
+	mu_assert_eq(model->cost[RISCV_INS_LW].latency, 3, "load");
+	mu_assert_eq(model->cost[RISCV_INS_DIV].latency, 20, "div");
+	mu_assert_eq(model->cost[RISCV_INS_DIV].throughput, 20, "div is not pipelined");
+	mu_assert_eq(model->cost[RISCV_INS_FDIV_S].latency, 20, "fdiv");
+	mu_assert_eq(model->cost[RISCV_INS_FADD_S].latency, 4, "fpu");
+	riscv_cost_model_free(model);
+	mu_end;
+}
+
+static bool test_cost_parse(void) {
+	RISCVCostModel *model = riscv_cost_model_new();
+	mu_assert_notnull(model, "new model");
+	mu_assert_true(riscv_cost_model_parse(model,
+			       "# dual issue core\n"
+			       "issue 2\n"
+			       "\n"
+			       "@load 5 2\n"
+			       "lw 7 # faster path\n"
+			       "mul 2 1"),
+		"parse");
+	mu_assert_eq(model->issue_width, 2, "issue");
+	mu_assert_eq(model->cost[RISCV_INS_LB].latency, 5, "class latency");
+	mu_assert_eq(model->cost[RISCV_INS_LB].throughput, 2, "class throughput");
+	mu_assert_eq(model->cost[RISCV_INS_LW].latency, 7, "mnemonic after the class");
+	mu_assert_eq(model->cost[RISCV_INS_LW].throughput, 1, "default throughput");
+	mu_assert_eq(model->cost[RISCV_INS_MUL].latency, 2, "last line without newline");
+	mu_assert_eq(model->cost[RISCV_INS_ADD].latency, 1, "untouched");
+	riscv_cost_model_free(model);
+	mu_end;
+}
+
+static bool test_cost_parse_errors(void) {
+	static cchar *profiles[] = {
+		"unknown 1",
+		"@unknown 1",
+		"add",
+		"add 256",
+		"add 1 256",
+		"issue 0",
+		"issue 2 1",
+		"add 4\n@alu x",
+		"add 1 xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx",
+	};
+	RISCVCostModel *model = riscv_cost_model_new();
+	RISCVCostModel *expected = riscv_cost_model_new();
+	mu_assert_true(model && expected, "new model");
+	for (size_t i = 0; i < RZ_ARRAY_SIZE(profiles); ++i) {
+		mu_assert_false(riscv_cost_model_parse(model, profiles[i]), profiles[i]);
+		mu_assert_true(!memcmp(model, expected, sizeof(RISCVCostModel)), "the model is left untouched");
+	}
+	riscv_cost_model_free(model);
+	riscv_cost_model_free(expected);
+	mu_end;
+}
+
+static bool test_cost_estimate(void) {
+	static const ut8 block[] = {
+		0x03, 0xa5, 0x05, 0x00, /* lw a0, 0(a1) */
+		0x13, 0x05, 0x15, 0x00, /* addi a0, a0, 1 */
+		0x93, 0x85, 0x15, 0x00, /* addi a1, a1, 1 */
+	};
+	RISCVCostModel *model = riscv_cost_model_new();
+	mu_assert_notnull(model, "new model");
+	RISCVCostEstimate estimate;
+	mu_assert_true(riscv_cost_block(model, block, sizeof(block), false, &estimate), "block");
+	mu_assert_eq(estimate.n_insns, 3, "instructions");
+	mu_assert_eq(estimate.latency, 5, "serialized latency");
+	mu_assert_eq(estimate.critical, 4, "lw then addi a0");
+	mu_assert_eq(estimate.resources, 3, "single issue");
+	mu_assert_eq(estimate.cycles, 4, "cycles");
+
+	/* the chain on a0 is not carried across iterations, the one on a1 is */
+	mu_assert_true(riscv_cost_loop(model, block, sizeof(block), false, &estimate), "loop");
+	mu_assert_eq(estimate.critical, 1, "carried addi a1");
+	mu_assert_eq(estimate.cycles, 3, "bound by the issue");
+	mu_assert_true(riscv_cost_model_parse(model, "issue 4"), "issue 4");
+	mu_assert_true(riscv_cost_loop(model, block, sizeof(block), false, &estimate), "loop");
+	mu_assert_eq(estimate.cycles, 1, "bound by the carried chain");
+	mu_assert_false(riscv_cost_block(model, block, 2, false, &estimate), "no instructions");
+	riscv_cost_model_free(model);
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_cost_defaults);
+	mu_run_test(test_cost_parse);
+	mu_run_test(test_cost_parse_errors);
+	mu_run_test(test_cost_estimate);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)
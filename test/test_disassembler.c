@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+/* the private instructions table gives one encoding of each instruction id */
+#include "../riscv_decode.c"
+#include "minunit.h"
+
+static ut32 xorshift(ut32 *state) {
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+static bool disassemble(ut32 data, RzStrBuf *sb, RISCVDecoded *dec) {
+	ut8 buffer[4];
+	buffer[0] = data & 0xff;
+	buffer[1] = (data >> 8) & 0xff;
+	buffer[2] = (data >> 16) & 0xff;
+	buffer[3] = data >> 24;
+	rz_strbuf_set(sb, "");
+	ut32 size = riscv_disassembler(buffer, sizeof(buffer), 0x1000, false, sb);
+	return riscv_decode(buffer, sizeof(buffer), false, dec) && size == dec->size;
+}
+
+/* every id, with the constant bits and with random values in the operand bits */
+static bool test_every_id(void) {
+	ut32 state = 0x2545f491;
+	RzStrBuf sb;
+	rz_strbuf_init(&sb);
+	for (ut32 id = 0; id < RISCV_INS_COUNT; ++id) {
+		const RISCVInstruction *ins = &instructions[id];
+		for (ut32 i = 0; i < 32; ++i) {
+			ut32 data = ins->cbits | (i ? xorshift(&state) & ~ins->mbits : 0);
+			RISCVDecoded dec;
+			if (!disassemble(data, &sb, &dec)) {
+				continue;
+			}
+			cchar *text = rz_strbuf_get(&sb);
+			char message[128];
+			snprintf(message, sizeof(message), "%s 0x%08x '%s'", riscv_mnemonic(id), data, text);
+			mu_assert(message, *text && !strstr(text, "(null)") && !strchr(text, '%'));
+			RzStrBuf alias;
+			rz_strbuf_init(&alias);
+			if (!riscv_alias(&dec, 0x1000, &alias)) {
+				size_t length = strlen(riscv_mnemonic(dec.id));
+				mu_assert(message, !strncmp(text, riscv_mnemonic(dec.id), length) && strchr(" .", text[length] ? text[length] : ' '));
+			}
+			rz_strbuf_fini(&alias);
+		}
+	}
+	rz_strbuf_fini(&sb);
+	mu_end;
+}
+
+static bool test_operands(void) {
+	static const struct {
+		ut32 data;
+		cchar *text;
+	} tests[] = {
+		{ 0x0ff0000f, "fence iorw, iorw" },
+		{ 0x0310000f, "fence rw, w" },
+		{ 0x0000000f, "fence 0, 0" },
+		{ 0x8330000f, "fence.tso" },
+		{ 0x0c55a2af, "amoswap.w.aq t0, t0, (a1)" },
+		{ 0x00b5b52f, "amoadd.d a0, a1, (a1)" },
+		{ 0x1605a52f, "lr.w.aqrl a0, (a1)" },
+		{ 0x1ac5a52f, "sc.w.rl a0, a2, (a1)" },
+		{ 0x02a5f553, "fadd.d f10, f11, f10" },
+		{ 0x02a58553, "fadd.d f10, f11, f10, rne" },
+		{ 0x02a59553, "fadd.d f10, f11, f10, rtz" },
+		{ 0x02a5d553, "fadd.d f10, f11, f10, 5" },
+		{ 0xc005f553, "fcvt.w.s a0, f11" },
+		{ 0x60c5f5c3, "fmadd.s f11, f11, f12, f12" },
+		{ 0x00813083, "ld ra, 8(sp)" },
+		{ 0x00452503, "lw a0, 4(a0)" },
+		{ 0x01013507, "fld f10, 16(sp)" },
+		{ 0xf9bf83e7, "jalr t2, -101(t6)" },
+		{ 0x00558513, "addi a0, a1, 5" },
+	};
+	RzStrBuf sb;
+	rz_strbuf_init(&sb);
+	for (size_t i = 0; i < RZ_ARRAY_SIZE(tests); ++i) {
+		RISCVDecoded dec;
+		mu_assert_true(disassemble(tests[i].data, &sb, &dec), tests[i].text);
+		mu_assert_streq(rz_strbuf_get(&sb), tests[i].text, "operands");
+	}
+	rz_strbuf_fini(&sb);
+	mu_end;
+}
+
+/* the aliases print their operands like the instruction they replace */
+static bool test_aliases(void) {
+	static const struct {
+		ut32 data;
+		cchar *text;
+	} tests[] = {
+		{ 0x30046073, "csrsi mstatus, 0x8" },
+		{ 0x00215573, "fsrmi a0, 0x2" },
+		{ 0x001fd073, "fsflagsi 0x1f" },
+	};
+	RzStrBuf sb, alias;
+	rz_strbuf_init(&sb);
+	rz_strbuf_init(&alias);
+	for (size_t i = 0; i < RZ_ARRAY_SIZE(tests); ++i) {
+		RISCVDecoded dec;
+		mu_assert_true(disassemble(tests[i].data, &sb, &dec), tests[i].text);
+		mu_assert_true(riscv_alias(&dec, 0x1000, &alias), tests[i].text);
+		mu_assert_streq(rz_strbuf_get(&alias), tests[i].text, "alias");
+		mu_assert_streq(rz_strbuf_get(&sb), tests[i].text, "the disassembler prints the alias");
+	}
+	rz_strbuf_fini(&sb);
+	rz_strbuf_fini(&alias);
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_every_id);
+	mu_run_test(test_operands);
+	mu_run_test(test_aliases);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)
@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_emu.h"
+#include "minunit.h"
+
+#define A0 10
+#define A1 11
+#define T0 5
+#define T1 6
+
+/* encoders usable in static initializers */
+#define ENC_I(opcode, funct3, rd, rs1, imm) \
+	((((ut32)(imm) & 0xfff) << 20) | ((rs1) << 15) | ((funct3) << 12) | ((rd) << 7) | (opcode))
+#define ENC_S(funct3, rs1, rs2, imm) \
+	(((((ut32)(imm) >> 5) & 0x7f) << 25) | ((rs2) << 20) | ((rs1) << 15) | ((funct3) << 12) | \
+		(((ut32)(imm) & 0x1f) << 7) | 0x23)
+#define ENC_B(funct3, rs1, rs2, imm) \
+	(((((ut32)(imm) >> 12) & 1) << 31) | ((((ut32)(imm) >> 5) & 0x3f) << 25) | ((rs2) << 20) | ((rs1) << 15) | \
+		((funct3) << 12) | ((((ut32)(imm) >> 1) & 0xf) << 8) | ((((ut32)(imm) >> 11) & 1) << 7) | 0x63)
+#define ENC_J(rd, imm) \
+	(((((ut32)(imm) >> 20) & 1) << 31) | ((((ut32)(imm) >> 1) & 0x3ff) << 21) | ((((ut32)(imm) >> 11) & 1) << 20) | \
+		((((ut32)(imm) >> 12) & 0xff) << 12) | ((rd) << 7) | 0x6f)
+
+#define ADDI(rd, rs1, imm) ENC_I(0x13, 0, rd, rs1, imm)
+#define ADD(rd, rs1, rs2)  (((rs2) << 20) | ((rs1) << 15) | ((rd) << 7) | 0x33)
+#define LW(rd, rs1, imm)   ENC_I(0x03, 2, rd, rs1, imm)
+#define SW(rs2, rs1, imm)  ENC_S(2, rs1, rs2, imm)
+#define LUI(rd, imm)       (((ut32)(imm) << 12) | ((rd) << 7) | 0x37)
+#define BNE(rs1, rs2, imm) ENC_B(1, rs1, rs2, imm)
+#define JAL(rd, imm)       ENC_J(rd, imm)
+#define ECALL              0x00000073
+#define EBREAK             0x00100073
+
+static bool load(RISCVEmu *emu, ut64 addr, const ut32 *code, ut32 n_insns) {
+	for (ut32 i = 0; i < n_insns; ++i) {
+		ut8 buffer[4] = { code[i] & 0xff, (code[i] >> 8) & 0xff, (code[i] >> 16) & 0xff, code[i] >> 24 };
+		if (!riscv_emu_write(emu, addr + i * 4, buffer, sizeof(buffer))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/* sum of 1..100 */
+static const ut32 loop[] = {
+	ADDI(A0, 0, 0),
+	ADDI(A1, 0, 100),
+	ADD(A0, A0, A1),
+	ADDI(A1, A1, -1),
+	BNE(A1, 0, -8),
+	ECALL,
+};
+
+static bool test_emu_loop(void) {
+	RISCVEmu *emu = riscv_emu_new();
+	mu_assert_notnull(emu, "new emu");
+	mu_assert_true(riscv_emu_map(emu, 0x1000, 0x1000), "map");
+	mu_assert_true(load(emu, 0x1000, loop, RZ_ARRAY_SIZE(loop)), "load");
+	emu->pc = 0x1000;
+	mu_assert_eq(riscv_emu_run(emu, 10000), RISCV_EMU_ECALL, "ecall");
+	mu_assert_eq(emu->x[A0], 5050, "sum");
+	mu_assert_eq(emu->pc, 0x1018, "pc after the ecall");
+	mu_assert_eq(emu->instret, 2 + 100 * 3 + 1, "instret");
+	riscv_emu_free(emu);
+	mu_end;
+}
+
+static bool test_emu_step_resume(void) {
+	RISCVEmu *emu = riscv_emu_new();
+	mu_assert_notnull(emu, "new emu");
+	mu_assert_true(riscv_emu_map(emu, 0x1000, 0x1000), "map");
+	mu_assert_true(load(emu, 0x1000, loop, RZ_ARRAY_SIZE(loop)), "load");
+	emu->pc = 0x1000;
+	/* stops in the middle of the blocks, each run resumes from pc */
+	RISCVEmuStatus status;
+	ut32 runs = 0;
+	while ((status = riscv_emu_run(emu, 7)) == RISCV_EMU_STEPS) {
+		mu_assert_eq(emu->instret, (runs + 1) * 7, "steps of each run");
+		runs++;
+	}
+	mu_assert_eq(status, RISCV_EMU_ECALL, "ecall");
+	mu_assert_eq(runs, 43, "runs");
+	mu_assert_eq(emu->x[A0], 5050, "sum");
+	mu_assert_eq(emu->instret, 2 + 100 * 3 + 1, "instret");
+	mu_assert_eq(riscv_emu_run(emu, 0), RISCV_EMU_STEPS, "no steps");
+	mu_assert_eq(emu->pc, 0x1018, "pc is kept");
+	riscv_emu_free(emu);
+	mu_end;
+}
+
+static bool test_emu_self_modifying(void) {
+	static const ut32 target[] = {
+		ADDI(A0, 0, 1),
+		ECALL,
+	};
+	/* the guest rewrites the first instruction of target to addi a0, zero, 2 */
+	static const ut32 patch[] = {
+		LUI(T0, 0x1),
+		LUI(T1, 0x200),
+		ADDI(T1, T1, 0x513),
+		SW(T1, T0, 0),
+		JAL(0, 0x1000 - 0x2010),
+	};
+	RISCVEmu *emu = riscv_emu_new();
+	mu_assert_notnull(emu, "new emu");
+	mu_assert_true(riscv_emu_map(emu, 0x1000, 0x2000), "map");
+	mu_assert_true(load(emu, 0x1000, target, RZ_ARRAY_SIZE(target)), "load");
+	mu_assert_true(load(emu, 0x2000, patch, RZ_ARRAY_SIZE(patch)), "load");
+	emu->pc = 0x1000;
+	mu_assert_eq(riscv_emu_run(emu, 100), RISCV_EMU_ECALL, "first run");
+	mu_assert_eq(emu->x[A0], 1, "original code");
+
+	emu->pc = 0x2000;
+	mu_assert_eq(riscv_emu_run(emu, 100), RISCV_EMU_ECALL, "patched run");
+	mu_assert_eq(emu->x[A0], 2, "code written by the guest");
+
+	/* writes from the host invalidate the translated blocks as well */
+	const ut32 host[] = { ADDI(A0, 0, 3) };
+	mu_assert_true(load(emu, 0x1000, host, 1), "host write");
+	emu->pc = 0x1000;
+	mu_assert_eq(riscv_emu_run(emu, 100), RISCV_EMU_ECALL, "host patched run");
+	mu_assert_eq(emu->x[A0], 3, "code written by the host");
+	riscv_emu_free(emu);
+	mu_end;
+}
+
+static bool test_emu_compressed(void) {
+	static const ut8 code[] = {
+		0x15, 0x45, /* c.li a0, 5 */
+		0x05, 0x05, /* c.addi a0, 1 */
+		0xaa, 0x85, /* c.mv a1, a0 */
+		0x73, 0x00, 0x00, 0x00, /* ecall */
+	};
+	RISCVEmu *emu = riscv_emu_new();
+	mu_assert_notnull(emu, "new emu");
+	mu_assert_true(riscv_emu_map(emu, 0x1000, 0x1000), "map");
+	mu_assert_true(riscv_emu_write(emu, 0x1000, code, sizeof(code)), "load");
+	emu->pc = 0x1000;
+	mu_assert_eq(riscv_emu_run(emu, 100), RISCV_EMU_ECALL, "ecall");
+	mu_assert_eq(emu->x[A0], 6, "a0");
+	mu_assert_eq(emu->x[A1], 6, "a1");
+	mu_assert_eq(emu->pc, 0x100a, "pc after the ecall");
+	mu_assert_eq(emu->instret, 4, "instret");
+	riscv_emu_free(emu);
+	mu_end;
+}
+
+static bool test_emu_faults(void) {
+	static const ut32 code[] = {
+		LUI(T0, 0x10),
+		LW(A0, T0, 4),
+	};
+	RISCVEmu *emu = riscv_emu_new();
+	mu_assert_notnull(emu, "new emu");
+	mu_assert_true(riscv_emu_map(emu, 0x1000, 0x1000), "map");
+	mu_assert_true(load(emu, 0x1000, code, RZ_ARRAY_SIZE(code)), "load");
+	emu->pc = 0x1000;
+	mu_assert_eq(riscv_emu_run(emu, 100), RISCV_EMU_FAULT, "unmapped load");
+	mu_assert_eq(emu->fault, 0x10004, "faulting address");
+	mu_assert_eq(emu->pc, 0x1004, "pc of the load");
+	mu_assert_eq(emu->instret, 1, "the load is not retired");
+
+	emu->pc = 0x8000;
+	mu_assert_eq(riscv_emu_run(emu, 100), RISCV_EMU_FAULT, "unmapped fetch");
+	mu_assert_eq(emu->fault, 0x8000, "faulting fetch");
+	mu_assert_eq(emu->pc, 0x8000, "pc is kept");
+
+	/* zero is an illegal instruction */
+	emu->pc = 0x1100;
+	mu_assert_eq(riscv_emu_run(emu, 100), RISCV_EMU_ILLEGAL, "illegal");
+	mu_assert_eq(emu->pc, 0x1100, "pc of the illegal instruction");
+
+	const ut32 ebreak[] = { EBREAK };
+	mu_assert_true(load(emu, 0x1100, ebreak, 1), "load");
+	mu_assert_eq(riscv_emu_run(emu, 100), RISCV_EMU_EBREAK, "ebreak");
+	mu_assert_eq(emu->pc, 0x1104, "pc after the ebreak");
+	riscv_emu_free(emu);
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_emu_loop);
+	mu_run_test(test_emu_step_resume);
+	mu_run_test(test_emu_self_modifying);
+	mu_run_test(test_emu_compressed);
+	mu_run_test(test_emu_faults);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)
@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_fold.h"
+#include "minunit.h"
+
+static void put32(ut8 *buffer, ut32 data) {
+	buffer[0] = data & 0xff;
+	buffer[1] = (data >> 8) & 0xff;
+	buffer[2] = (data >> 16) & 0xff;
+	buffer[3] = data >> 24;
+}
+
+static bool test_fold_sweep(void) {
+	static const ut32 code[] = {
+		0x00012537, /* 0x1000 lui a0, 0x12 */
+		0x03452583, /* 0x1004 lw a1, 0x34(a0) */
+		0x00001297, /* 0x1008 auipc t0, 0x1 */
+		0x010280e7, /* 0x100c jalr 0x10(t0) */
+		0x00b1a423, /* 0x1010 sw a1, 8(gp) */
+		0x00052603, /* 0x1014 lw a2, 0(a0), a0 is not known after the call */
+		0x00020737, /* 0x1018 lui a4, 0x20 */
+		0xff070713, /* 0x101c addi a4, a4, -16 */
+		0x000017b7, /* 0x1020 lui a5, 0x1 */
+		0x004787b3, /* 0x1024 add a5, a5, tp */
+	};
+	ut8 buffer[sizeof(code)];
+	for (size_t i = 0; i < RZ_ARRAY_SIZE(code); ++i) {
+		put32(buffer + i * 4, code[i]);
+	}
+	RISCVFold fold;
+	riscv_fold_init(&fold);
+	riscv_fold_set_gp(&fold, 0x8000);
+	riscv_fold_set_tp(&fold, 0x70000);
+	RzVector xrefs;
+	rz_vector_init(&xrefs, sizeof(RISCVXref), NULL, NULL);
+	ut32 count = riscv_fold_sweep(&fold, buffer, sizeof(buffer), 0x1000, false, &xrefs);
+
+	static const RISCVXref expected[] = {
+		{ 0x1004, 0x12034, RISCV_XREF_READ, 4, 10 /* a0 */ },
+		{ 0x100c, 0x2018, RISCV_XREF_CALL, 0, 5 /* t0 */ },
+		{ 0x1010, 0x8008, RISCV_XREF_WRITE, 4, RISCV_REG_GP },
+		{ 0x101c, 0x1fff0, RISCV_XREF_ADDR, 0, 14 /* a4 */ },
+		{ 0x1024, 0x71000, RISCV_XREF_ADDR, 0, RISCV_REG_TP },
+	};
+	mu_assert_eq(count, RZ_ARRAY_SIZE(expected), "xrefs");
+	mu_assert_eq(rz_vector_len(&xrefs), count, "pushed xrefs");
+	for (ut32 i = 0; i < count; ++i) {
+		const RISCVXref *xref = (const RISCVXref *)xrefs.a + i;
+		char message[64];
+		snprintf(message, sizeof(message), "xref %u", i);
+		mu_assert_eq(xref->from, expected[i].from, message);
+		mu_assert_eq(xref->to, expected[i].to, message);
+		mu_assert_eq(xref->type, expected[i].type, message);
+		mu_assert_eq(xref->size, expected[i].size, message);
+		mu_assert_eq(xref->reg, expected[i].reg, message);
+	}
+	rz_vector_fini(&xrefs);
+	mu_end;
+}
+
+static bool test_fold_step(void) {
+	RISCVFold fold;
+	RISCVDecoded dec;
+	RISCVXref xref;
+	riscv_fold_init(&fold);
+	mu_assert_true(riscv_decode_word(0x00012537, &dec), "lui a0, 0x12");
+	mu_assert_false(riscv_fold_step(&fold, 0x1000, &dec, &xref), "lui alone");
+	mu_assert_true(riscv_decode_word(0x00a00513, &dec), "li a0, 10");
+	mu_assert_false(riscv_fold_step(&fold, 0x1004, &dec, &xref), "a0 is overwritten by li");
+	mu_assert_true(riscv_decode_word(0x03452583, &dec), "lw a1, 0x34(a0)");
+	mu_assert_false(riscv_fold_step(&fold, 0x1008, &dec, &xref), "a0 is not known anymore");
+
+	mu_assert_true(riscv_decode_word(0x00012537, &dec), "lui a0, 0x12");
+	riscv_fold_step(&fold, 0x100c, &dec, &xref);
+	riscv_fold_reset(&fold);
+	mu_assert_true(riscv_decode_word(0x03452583, &dec), "lw a1, 0x34(a0)");
+	mu_assert_false(riscv_fold_step(&fold, 0x1010, &dec, &xref), "forgotten by the reset");
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_fold_sweep);
+	mu_run_test(test_fold_step);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_functions.h"
+#include "minunit.h"
+
+#define RA 1
+#define SP 2
+#define A0 10
+
+#define ENC_I(opcode, funct3, rd, rs1, imm) \
+	((((ut32)(imm) & 0xfff) << 20) | ((rs1) << 15) | ((funct3) << 12) | ((rd) << 7) | (opcode))
+#define ENC_S(funct3, rs1, rs2, imm) \
+	(((((ut32)(imm) >> 5) & 0x7f) << 25) | ((rs2) << 20) | ((rs1) << 15) | ((funct3) << 12) | \
+		(((ut32)(imm) & 0x1f) << 7) | 0x23)
+#define ENC_J(rd, imm) \
+	(((((ut32)(imm) >> 20) & 1) << 31) | ((((ut32)(imm) >> 1) & 0x3ff) << 21) | ((((ut32)(imm) >> 11) & 1) << 20) | \
+		((((ut32)(imm) >> 12) & 0xff) << 12) | ((rd) << 7) | 0x6f)
+
+#define ADDI(rd, rs1, imm) ENC_I(0x13, 0, rd, rs1, imm)
+#define LD(rd, rs1, imm)   ENC_I(0x03, 3, rd, rs1, imm)
+#define SD(rs2, rs1, imm)  ENC_S(3, rs1, rs2, imm)
+#define JAL(rd, imm)       ENC_J(rd, imm)
+#define RET                ENC_I(0x67, 0, 0, RA, 0)
+#define NOP                ADDI(0, 0, 0)
+
+static void put_code(ut8 *buffer, const ut32 *code, ut32 n_insns) {
+	for (ut32 i = 0; i < n_insns; ++i) {
+		buffer[i * 4 + 0] = code[i] & 0xff;
+		buffer[i * 4 + 1] = (code[i] >> 8) & 0xff;
+		buffer[i * 4 + 2] = (code[i] >> 16) & 0xff;
+		buffer[i * 4 + 3] = code[i] >> 24;
+	}
+}
+
+static const ut32 code[] = {
+	JAL(RA, 0x10), /*       0x1000 start of the buffer, calls 0x1010 */
+	RET, /*                 0x1004 */
+	NOP, /*                 0x1008 padding */
+	NOP, /*                 0x100c */
+	ADDI(A0, A0, 1), /*     0x1010 call target */
+	JAL(0, 4), /*           0x1014 tail call */
+	ADDI(SP, SP, -16), /*   0x1018 prologue */
+	SD(RA, SP, 8), /*       0x101c */
+	LD(RA, SP, 8), /*       0x1020 */
+	ADDI(SP, SP, 16), /*    0x1024 */
+	RET, /*                 0x1028 */
+	NOP, /*                 0x102c padding */
+};
+
+static bool check_functions(RzVector *functions) {
+	static const RISCVFunction expected[] = {
+		{ 0x1000, 0x08 },
+		{ 0x1010, 0x08 },
+		{ 0x1018, 0x14 },
+	};
+	mu_assert_eq(rz_vector_len(functions), RZ_ARRAY_SIZE(expected), "functions");
+	for (ut32 i = 0; i < RZ_ARRAY_SIZE(expected); ++i) {
+		const RISCVFunction *fcn = rz_vector_index_ptr(functions, i);
+		char message[64];
+		snprintf(message, sizeof(message), "function %u", i);
+		mu_assert_eq(fcn->addr, expected[i].addr, message);
+		mu_assert_eq(fcn->size, expected[i].size, message);
+	}
+	return true;
+}
+
+static bool test_functions_find(void) {
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+	RzVector functions;
+	rz_vector_init(&functions, sizeof(RISCVFunction), NULL, NULL);
+
+	mu_assert_true(riscv_functions_find(buffer, sizeof(buffer), 0x1000, false, 1, &functions), "one thread");
+	mu_assert_true(check_functions(&functions), "one thread");
+	/* the vector is cleared, the result does not depend on the threads */
+	mu_assert_true(riscv_functions_find(buffer, sizeof(buffer), 0x1000, false, 0, &functions), "all the cores");
+	mu_assert_true(check_functions(&functions), "all the cores");
+	rz_vector_fini(&functions);
+	mu_end;
+}
+
+static bool test_functions_empty(void) {
+	ut8 buffer[2] = { 0 };
+	RzVector functions;
+	rz_vector_init(&functions, sizeof(RISCVFunction), NULL, NULL);
+	mu_assert_true(riscv_functions_find(buffer, sizeof(buffer), 0x1000, false, 1, &functions), "no words");
+	mu_assert_eq(rz_vector_len(&functions), 0, "no functions");
+	rz_vector_fini(&functions);
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_functions_find);
+	mu_run_test(test_functions_empty);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_decode.h"
+#include "minunit.h"
+
+static RzILOpEffect *lift(ut32 word, ut64 pc) {
+	RISCVDecoded dec;
+	if (!riscv_decode_word(word, &dec)) {
+		return NULL;
+	}
+	return riscv_il(&dec, pc);
+}
+
+static bool test_il_set(void) {
+	RzILOpEffect *op = lift(0x00558513, 0x1000); /* addi a0, a1, 5 */
+	mu_assert_notnull(op, "addi");
+	mu_assert_eq(op->code, RZ_IL_OP_SET, "set");
+	mu_assert_streq(op->op.set.v, "a0", "rd");
+	mu_assert_false(op->op.set.is_local, "global register");
+	mu_assert_eq(op->op.set.x->code, RZ_IL_OP_ADD, "rs1 + imm");
+	mu_assert_eq(op->op.set.x->op.add.x->code, RZ_IL_OP_VAR, "rs1");
+	mu_assert_streq(op->op.set.x->op.add.x->op.var.v, "a1", "rs1");
+	rz_il_op_effect_free(op);
+
+	/* writes to x0 are discarded */
+	op = lift(0x00558013, 0x1000); /* addi zero, a1, 5 */
+	mu_assert_notnull(op, "addi zero");
+	mu_assert_eq(op->code, RZ_IL_OP_NOP, "nop");
+	rz_il_op_effect_free(op);
+	mu_end;
+}
+
+static bool test_il_control_flow(void) {
+	RzILOpEffect *op = lift(0x100000ef, 0x1000); /* jal 0x1100 */
+	mu_assert_notnull(op, "jal");
+	mu_assert_eq(op->code, RZ_IL_OP_SEQ, "link then jump");
+	mu_assert_eq(op->op.seq.x->code, RZ_IL_OP_SET, "link");
+	mu_assert_streq(op->op.seq.x->op.set.v, "ra", "link register");
+	mu_assert_eq(op->op.seq.y->code, RZ_IL_OP_JMP, "jump");
+	rz_il_op_effect_free(op);
+
+	op = lift(0x00b50463, 0x1000); /* beq a0, a1, 0x1008 */
+	mu_assert_notnull(op, "beq");
+	mu_assert_eq(op->code, RZ_IL_OP_BRANCH, "branch");
+	mu_assert_eq(op->op.branch.condition->code, RZ_IL_OP_EQ, "condition");
+	mu_assert_eq(op->op.branch.true_eff->code, RZ_IL_OP_JMP, "taken");
+	mu_assert_eq(op->op.branch.false_eff->code, RZ_IL_OP_NOP, "not taken");
+	rz_il_op_effect_free(op);
+	mu_end;
+}
+
+static bool test_il_memory(void) {
+	RzILOpEffect *op = lift(0x00b13423, 0x1000); /* sd a1, 8(sp) */
+	mu_assert_notnull(op, "sd");
+	mu_assert_eq(op->code, RZ_IL_OP_STOREW, "store");
+	mu_assert_eq(op->op.storew.key->code, RZ_IL_OP_ADD, "sp + 8");
+	rz_il_op_effect_free(op);
+
+	/* the csr instructions have no template */
+	mu_assert_true(lift(0x30051073, 0x1000) == NULL, "csrw mstatus, a0");
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_il_set);
+	mu_run_test(test_il_control_flow);
+	mu_run_test(test_il_memory);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)
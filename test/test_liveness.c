@@ -0,0 +1,174 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_liveness.h"
+#include "minunit.h"
+
+#define RA 1
+#define T0 5
+#define T1 6
+#define S0 8
+#define S1 9
+#define A0 10
+#define A1 11
+#define A2 12
+#define A3 13
+#define A5 15
+
+#define BIT(reg) (1u << (reg))
+/* a0-a1 and fa0-fa1, live at the exit of a function */
+#define RETURN (BIT(A0) | BIT(A1))
+/* a0-a7 and fa0-fa7, read by a call */
+#define ARGS 0x0003fc00u
+
+#define ENC_I(opcode, funct3, rd, rs1, imm) \
+	((((ut32)(imm) & 0xfff) << 20) | ((rs1) << 15) | ((funct3) << 12) | ((rd) << 7) | (opcode))
+#define ENC_B(funct3, rs1, rs2, imm) \
+	(((((ut32)(imm) >> 12) & 1) << 31) | ((((ut32)(imm) >> 5) & 0x3f) << 25) | ((rs2) << 20) | ((rs1) << 15) | \
+		((funct3) << 12) | ((((ut32)(imm) >> 1) & 0xf) << 8) | ((((ut32)(imm) >> 11) & 1) << 7) | 0x63)
+#define ENC_J(rd, imm) \
+	(((((ut32)(imm) >> 20) & 1) << 31) | ((((ut32)(imm) >> 1) & 0x3ff) << 21) | ((((ut32)(imm) >> 11) & 1) << 20) | \
+		((((ut32)(imm) >> 12) & 0xff) << 12) | ((rd) << 7) | 0x6f)
+
+#define ADDI(rd, rs1, imm) ENC_I(0x13, 0, rd, rs1, imm)
+#define ADD(rd, rs1, rs2)  (((rs2) << 20) | ((rs1) << 15) | ((rd) << 7) | 0x33)
+#define BEQ(rs1, rs2, imm) ENC_B(0, rs1, rs2, imm)
+#define BNE(rs1, rs2, imm) ENC_B(1, rs1, rs2, imm)
+#define JAL(rd, imm)       ENC_J(rd, imm)
+#define RET                ENC_I(0x67, 0, 0, RA, 0)
+
+static void put_code(ut8 *buffer, const ut32 *code, ut32 n_insns) {
+	for (ut32 i = 0; i < n_insns; ++i) {
+		buffer[i * 4 + 0] = code[i] & 0xff;
+		buffer[i * 4 + 1] = (code[i] >> 8) & 0xff;
+		buffer[i * 4 + 2] = (code[i] >> 16) & 0xff;
+		buffer[i * 4 + 3] = code[i] >> 24;
+	}
+}
+
+static bool test_liveness_diamond(void) {
+	static const ut32 code[] = {
+		BEQ(A1, 0, 12), /* 0x1000 b0 */
+		ADDI(A0, A2, 0), /* 0x1004 b1 */
+		JAL(0, 8), /*      0x1008 */
+		ADDI(A0, A3, 0), /* 0x100c b2 */
+		RET, /*            0x1010 b3 */
+	};
+	static ut64 addr[] = { 0x1000, 0x1004, 0x100c, 0x1010 };
+	static ut32 size[] = { 4, 8, 4, 4 };
+	static ut32 edge_offset[] = { 0, 2, 3, 4, 4 };
+	static ut32 edges[] = { 2, 1, 3, 3 };
+	const RISCVCfg cfg = { 4, 4, addr, size, edge_offset, edges };
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+
+	RISCVLiveness *lv = riscv_liveness_new(buffer, sizeof(buffer), 0x1000, false, &cfg);
+	mu_assert_notnull(lv, "liveness");
+	mu_assert_eq(lv->out[3].gpr, RETURN, "return values live at the exit");
+	mu_assert_eq(lv->out[3].fpr, RETURN, "float return values live at the exit");
+	mu_assert_eq(lv->in[3].gpr, RETURN | BIT(RA), "ret reads ra");
+	mu_assert_eq(lv->in[1].gpr, BIT(A1) | BIT(A2) | BIT(RA), "then arm");
+	mu_assert_eq(lv->in[2].gpr, BIT(A1) | BIT(A3) | BIT(RA), "else arm");
+	mu_assert_eq(lv->in[0].gpr, BIT(A1) | BIT(A2) | BIT(A3) | BIT(RA), "a0 is written on both arms");
+	mu_assert_eq(riscv_liveness_block_at(lv, 0x1008), 1, "block at");
+	mu_assert_eq(riscv_liveness_block_at(lv, 0x1014), RISCV_LIVENESS_INVALID, "no block");
+	riscv_liveness_free(lv);
+	mu_end;
+}
+
+static bool test_liveness_loop(void) {
+	static const ut32 code[] = {
+		ADDI(A0, 0, 0), /*   0x2000 b0 */
+		ADD(A0, A0, A1), /*  0x2004 b1 */
+		ADDI(A1, A1, -1), /* 0x2008 */
+		BNE(A1, 0, -8), /*   0x200c */
+		RET, /*              0x2010 b2 */
+	};
+	static ut64 addr[] = { 0x2000, 0x2004, 0x2010 };
+	static ut32 size[] = { 4, 12, 4 };
+	static ut32 edge_offset[] = { 0, 1, 3, 3 };
+	static ut32 edges[] = { 1, 1, 2 };
+	const RISCVCfg cfg = { 3, 3, addr, size, edge_offset, edges };
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+
+	RISCVLiveness *lv = riscv_liveness_new(buffer, sizeof(buffer), 0x2000, false, &cfg);
+	mu_assert_notnull(lv, "liveness");
+	mu_assert_eq(lv->in[1].gpr, BIT(A0) | BIT(A1) | BIT(RA), "loop body");
+	mu_assert_eq(lv->out[1].gpr, BIT(A0) | BIT(A1) | BIT(RA), "live around the back edge");
+	mu_assert_eq(lv->in[0].gpr, BIT(A1) | BIT(RA), "a0 is set before the loop");
+
+	RISCVRegSet live;
+	mu_assert_true(riscv_liveness_at(lv, 0x200c, &live), "at bne");
+	mu_assert_eq(live.gpr, BIT(A0) | BIT(A1) | BIT(RA), "live before bne");
+	mu_assert_false(riscv_liveness_at(lv, 0x3000, &live), "outside of the function");
+	riscv_liveness_free(lv);
+	mu_end;
+}
+
+static bool test_liveness_call(void) {
+	static const ut32 code[] = {
+		ADDI(A0, S0, 0), /* 0x3000 */
+		ADDI(T1, 0, 5), /*  0x3004 dead, clobbered by the call */
+		JAL(RA, 0x100), /*  0x3008 */
+		ADD(S1, A0, T0), /* 0x300c */
+		RET, /*             0x3010 */
+	};
+	static ut64 addr[] = { 0x3000 };
+	static ut32 size[] = { 20 };
+	static ut32 edge_offset[] = { 0, 0 };
+	const RISCVCfg cfg = { 1, 0, addr, size, edge_offset, NULL };
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+
+	RISCVLiveness *lv = riscv_liveness_new(buffer, sizeof(buffer), 0x3000, false, &cfg);
+	mu_assert_notnull(lv, "liveness");
+	RISCVRegSet live;
+	mu_assert_true(riscv_liveness_at(lv, 0x300c, &live), "after the call");
+	mu_assert_eq(live.gpr, RETURN | BIT(T0) | BIT(RA), "the result and t0 are read after the call");
+	mu_assert_true(riscv_liveness_at(lv, 0x3008, &live), "at the call");
+	mu_assert_eq(live.gpr, ARGS, "the call reads the arguments and clobbers t0 and ra");
+	mu_assert_eq(live.fpr, ARGS, "the call reads the float arguments");
+	mu_assert_true(riscv_liveness_at(lv, 0x3000, &live), "at the entry");
+	mu_assert_eq(live.gpr, (ARGS & ~BIT(A0)) | BIT(S0), "t1 is dead, a0 comes from s0");
+	mu_assert_eq(lv->in[0].gpr, live.gpr, "block entry");
+	riscv_liveness_free(lv);
+	mu_end;
+}
+
+static bool test_liveness_undecodable(void) {
+	static const ut32 code[] = {
+		0x00000000, /*      0x4000 not an instruction */
+		ADDI(A0, A5, 0), /* 0x4004 */
+		RET, /*             0x4008 */
+	};
+	static ut64 addr[] = { 0x4000 };
+	static ut32 size[] = { 12 };
+	static ut32 edge_offset[] = { 0, 0 };
+	const RISCVCfg cfg = { 1, 0, addr, size, edge_offset, NULL };
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+
+	RISCVLiveness *lv = riscv_liveness_new(buffer, sizeof(buffer), 0x4000, false, &cfg);
+	mu_assert_notnull(lv, "liveness");
+	RISCVRegSet live;
+	mu_assert_true(riscv_liveness_at(lv, 0x4000, &live), "at the entry");
+	mu_assert_eq(lv->in[0].gpr, BIT(A1) | BIT(A5) | BIT(RA), "the block continues after the word");
+	mu_assert_eq(live.gpr, lv->in[0].gpr, "both walks agree");
+	riscv_liveness_free(lv);
+
+	/* blocks outside of the buffer */
+	addr[0] = 0x5000;
+	mu_assert_true(riscv_liveness_new(buffer, sizeof(buffer), 0x4000, false, &cfg) == NULL, "invalid cfg");
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_liveness_diamond);
+	mu_run_test(test_liveness_loop);
+	mu_run_test(test_liveness_call);
+	mu_run_test(test_liveness_undecodable);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_stack.h"
+#include "minunit.h"
+
+#define RA 1
+#define SP 2
+#define S0 8
+#define A0 10
+#define A1 11
+
+#define ENC_I(opcode, funct3, rd, rs1, imm) \
+	((((ut32)(imm) & 0xfff) << 20) | ((rs1) << 15) | ((funct3) << 12) | ((rd) << 7) | (opcode))
+#define ENC_S(funct3, rs1, rs2, imm) \
+	(((((ut32)(imm) >> 5) & 0x7f) << 25) | ((rs2) << 20) | ((rs1) << 15) | ((funct3) << 12) | \
+		(((ut32)(imm) & 0x1f) << 7) | 0x23)
+#define ENC_B(funct3, rs1, rs2, imm) \
+	(((((ut32)(imm) >> 12) & 1) << 31) | ((((ut32)(imm) >> 5) & 0x3f) << 25) | ((rs2) << 20) | ((rs1) << 15) | \
+		((funct3) << 12) | ((((ut32)(imm) >> 1) & 0xf) << 8) | ((((ut32)(imm) >> 11) & 1) << 7) | 0x63)
+
+#define ADDI(rd, rs1, imm) ENC_I(0x13, 0, rd, rs1, imm)
+#define SUB(rd, rs1, rs2)  ((0x20 << 25) | ((rs2) << 20) | ((rs1) << 15) | ((rd) << 7) | 0x33)
+#define LD(rd, rs1, imm)   ENC_I(0x03, 3, rd, rs1, imm)
+#define SD(rs2, rs1, imm)  ENC_S(3, rs1, rs2, imm)
+#define SW(rs2, rs1, imm)  ENC_S(2, rs1, rs2, imm)
+#define BEQ(rs1, rs2, imm) ENC_B(0, rs1, rs2, imm)
+#define RET                ENC_I(0x67, 0, 0, RA, 0)
+
+static void put_code(ut8 *buffer, const ut32 *code, ut32 n_insns) {
+	for (ut32 i = 0; i < n_insns; ++i) {
+		buffer[i * 4 + 0] = code[i] & 0xff;
+		buffer[i * 4 + 1] = (code[i] >> 8) & 0xff;
+		buffer[i * 4 + 2] = (code[i] >> 16) & 0xff;
+		buffer[i * 4 + 3] = code[i] >> 24;
+	}
+}
+
+static bool test_stack_frame(void) {
+	static const ut32 code[] = {
+		ADDI(SP, SP, -32), /*  0x1000 */
+		SD(RA, SP, 24), /*     0x1004 */
+		SD(S0, SP, 16), /*     0x1008 */
+		ADDI(S0, SP, 32), /*   0x100c frame pointer at the entry sp */
+		SUB(SP, SP, A0), /*    0x1010 alloca, sp is not known anymore */
+		SW(A1, S0, -20), /*    0x1014 accessed through s0 */
+		ADDI(SP, S0, -32), /*  0x1018 sp restored from s0 */
+		LD(RA, SP, 24), /*     0x101c */
+		LD(S0, SP, 16), /*     0x1020 */
+		ADDI(SP, SP, 32), /*   0x1024 */
+		RET, /*                0x1028 */
+	};
+	static ut64 addr[] = { 0x1000 };
+	static ut32 size[] = { sizeof(code) };
+	static ut32 edge_offset[] = { 0, 0 };
+	const RISCVCfg cfg = { 1, 0, addr, size, edge_offset, NULL };
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+
+	RISCVStack *stack = riscv_stack_new(buffer, sizeof(buffer), 0x1000, false, &cfg, 0);
+	mu_assert_notnull(stack, "stack");
+	mu_assert_eq(stack->frame_size, 32, "frame size");
+
+	static const RISCVStackSlot expected[] = {
+		{ -20, 4, RISCV_STACK_WRITE },
+		{ -16, 8, RISCV_STACK_READ | RISCV_STACK_WRITE },
+		{ -8, 8, RISCV_STACK_READ | RISCV_STACK_WRITE },
+	};
+	mu_assert_eq(rz_vector_len(&stack->slots), RZ_ARRAY_SIZE(expected), "slots");
+	for (ut32 i = 0; i < RZ_ARRAY_SIZE(expected); ++i) {
+		const RISCVStackSlot *slot = rz_vector_index_ptr(&stack->slots, i);
+		char message[64];
+		snprintf(message, sizeof(message), "slot %u", i);
+		mu_assert_eq(slot->offset, expected[i].offset, message);
+		mu_assert_eq(slot->size, expected[i].size, message);
+		mu_assert_eq(slot->access, expected[i].access, message);
+	}
+
+	RISCVStackState state;
+	mu_assert_true(riscv_stack_at(stack, 0x1010, &state), "before the alloca");
+	mu_assert_eq(state.known, RISCV_STACK_SP | RISCV_STACK_FP, "both known");
+	mu_assert_eq(state.sp, -32, "sp");
+	mu_assert_eq(state.fp, 0, "fp");
+	mu_assert_true(riscv_stack_at(stack, 0x1014, &state), "after the alloca");
+	mu_assert_eq(state.known, RISCV_STACK_FP, "only fp is known");
+	mu_assert_true(riscv_stack_at(stack, 0x101c, &state), "after the restore");
+	mu_assert_eq(state.known & RISCV_STACK_SP, RISCV_STACK_SP, "sp is known again");
+	mu_assert_eq(state.sp, -32, "restored sp");
+	mu_assert_true(riscv_stack_at(stack, 0x1028, &state), "at the ret");
+	mu_assert_eq(state.sp, 0, "frame released");
+	mu_assert_false(riscv_stack_at(stack, 0x102c, &state), "outside of the function");
+	riscv_stack_free(stack);
+	mu_end;
+}
+
+static bool test_stack_merge(void) {
+	static const ut32 code[] = {
+		ADDI(SP, SP, -16), /* 0x2000 b0 */
+		BEQ(A0, 0, 8), /*     0x2004 */
+		ADDI(SP, SP, -16), /* 0x2008 b1 only on one path */
+		SD(A1, SP, 0), /*     0x200c b2 */
+		RET, /*               0x2010 */
+	};
+	static ut64 addr[] = { 0x2000, 0x2008, 0x200c };
+	static ut32 size[] = { 8, 4, 8 };
+	static ut32 edge_offset[] = { 0, 2, 3, 3 };
+	static ut32 edges[] = { 2, 1, 2 };
+	const RISCVCfg cfg = { 3, 3, addr, size, edge_offset, edges };
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+
+	RISCVStack *stack = riscv_stack_new(buffer, sizeof(buffer), 0x2000, false, &cfg, 0);
+	mu_assert_notnull(stack, "stack");
+	RISCVStackState state;
+	mu_assert_true(riscv_stack_at(stack, 0x2008, &state), "one predecessor");
+	mu_assert_eq(state.known, RISCV_STACK_SP, "known sp");
+	mu_assert_eq(state.sp, -16, "sp");
+	mu_assert_true(riscv_stack_at(stack, 0x200c, &state), "join");
+	mu_assert_eq(state.known, 0, "the paths disagree on sp");
+	mu_assert_eq(rz_vector_len(&stack->slots), 0, "the store has no known slot");
+	mu_assert_eq(stack->frame_size, 32, "deepest sp");
+	riscv_stack_free(stack);
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_stack_frame);
+	mu_run_test(test_stack_merge);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)
@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_switch.h"
+#include "minunit.h"
+
+#define T0 5
+#define T1 6
+#define A0 10
+#define A1 11
+
+#define ENC_I(opcode, funct3, rd, rs1, imm) \
+	((((ut32)(imm) & 0xfff) << 20) | ((rs1) << 15) | ((funct3) << 12) | ((rd) << 7) | (opcode))
+#define ENC_R(funct7, funct3, rd, rs1, rs2) \
+	(((funct7) << 25) | ((rs2) << 20) | ((rs1) << 15) | ((funct3) << 12) | ((rd) << 7) | 0x33)
+#define ENC_B(funct3, rs1, rs2, imm) \
+	(((((ut32)(imm) >> 12) & 1) << 31) | ((((ut32)(imm) >> 5) & 0x3f) << 25) | ((rs2) << 20) | ((rs1) << 15) | \
+		((funct3) << 12) | ((((ut32)(imm) >> 1) & 0xf) << 8) | ((((ut32)(imm) >> 11) & 1) << 7) | 0x63)
+
+#define ADDI(rd, rs1, imm)    ENC_I(0x13, 0, rd, rs1, imm)
+#define SLLI(rd, rs1, shamt)  ENC_I(0x13, 1, rd, rs1, shamt)
+#define SLTIU(rd, rs1, imm)   ENC_I(0x13, 3, rd, rs1, imm)
+#define LW(rd, rs1, imm)      ENC_I(0x03, 2, rd, rs1, imm)
+#define LD(rd, rs1, imm)      ENC_I(0x03, 3, rd, rs1, imm)
+#define JALR(rd, rs1, imm)    ENC_I(0x67, 0, rd, rs1, imm)
+#define ADD(rd, rs1, rs2)     ENC_R(0, 0, rd, rs1, rs2)
+#define SH2ADD(rd, rs1, rs2)  ENC_R(0x10, 4, rd, rs1, rs2)
+#define SH3ADD(rd, rs1, rs2)  ENC_R(0x10, 6, rd, rs1, rs2)
+#define LUI(rd, imm)          (((ut32)(imm) << 12) | ((rd) << 7) | 0x37)
+#define AUIPC(rd, imm)        (((ut32)(imm) << 12) | ((rd) << 7) | 0x17)
+#define BEQ(rs1, rs2, imm)    ENC_B(0, rs1, rs2, imm)
+#define BLTU(rs1, rs2, imm)   ENC_B(6, rs1, rs2, imm)
+
+static void put_code(ut8 *buffer, const ut32 *code, ut32 n_insns) {
+	for (ut32 i = 0; i < n_insns; ++i) {
+		buffer[i * 4 + 0] = code[i] & 0xff;
+		buffer[i * 4 + 1] = (code[i] >> 8) & 0xff;
+		buffer[i * 4 + 2] = (code[i] >> 16) & 0xff;
+		buffer[i * 4 + 3] = code[i] >> 24;
+	}
+}
+
+/* the jump table is a little endian array at 0x2000 */
+typedef struct table_t {
+	const ut8 *data;
+	ut32 size;
+} Table;
+
+static bool table_read(void *user, ut64 addr, ut8 *buf, ut32 len) {
+	const Table *table = user;
+	if (addr < 0x2000 || addr - 0x2000 + len > table->size) {
+		return false;
+	}
+	memcpy(buf, table->data + addr - 0x2000, len);
+	return true;
+}
+
+static bool test_switch_absolute(void) {
+	static const ut32 code[] = {
+		ADDI(T0, 0, 4), /*       0x1000 */
+		BLTU(T0, A0, 0x20), /*   0x1004 index > 4 goes to 0x1024 */
+		AUIPC(T1, 0x1), /*       0x1008 */
+		ADDI(T1, T1, -8), /*     0x100c table at 0x2000 */
+		SLLI(A0, A0, 3), /*      0x1010 */
+		ADD(A0, A0, T1), /*      0x1014 */
+		LD(A1, A0, 0), /*        0x1018 */
+		JALR(0, A1, 0), /*       0x101c */
+	};
+	static const ut8 data[] = {
+		0x00, 0x30, 0, 0, 0, 0, 0, 0,
+		0x10, 0x30, 0, 0, 0, 0, 0, 0,
+		0x20, 0x30, 0, 0, 0, 0, 0, 0,
+		0x00, 0x30, 0, 0, 0, 0, 0, 0,
+		0x30, 0x30, 0, 0, 0, 0, 0, 0,
+	};
+	Table table = { data, sizeof(data) };
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+	RzVector targets;
+	rz_vector_init(&targets, sizeof(ut64), NULL, NULL);
+
+	RISCVSwitch sw;
+	mu_assert_true(riscv_switch_recover(buffer, sizeof(buffer), 0x1000, false, 0x1000, 0x101c, table_read, &table, &sw, &targets), "recover");
+	mu_assert_eq(sw.jump, 0x101c, "jump");
+	mu_assert_eq(sw.table, 0x2000, "table");
+	mu_assert_eq(sw.defval, 0x1024, "default");
+	mu_assert_eq(sw.n_cases, 5, "cases");
+	mu_assert_eq(sw.entry_size, 8, "entry size");
+	mu_assert_false(sw.relative, "absolute");
+	mu_assert_eq(rz_vector_len(&targets), 5, "targets");
+	mu_assert_eq(*(ut64 *)rz_vector_index_ptr(&targets, 2), 0x3020, "third case");
+	mu_assert_eq(*(ut64 *)rz_vector_index_ptr(&targets, 4), 0x3030, "last case");
+
+	/* an index scaled by 4 cannot select 8 bytes entries */
+	const ut32 scale4[] = { SLLI(A0, A0, 2) };
+	put_code(buffer + 0x10, scale4, RZ_ARRAY_SIZE(scale4));
+	mu_assert_false(riscv_switch_recover(buffer, sizeof(buffer), 0x1000, false, 0x1000, 0x101c, table_read, &table, &sw, NULL), "slli 2 with ld");
+	const ut32 scale8[] = { ADDI(0, 0, 0), SH3ADD(A0, A0, T1) };
+	put_code(buffer + 0x10, scale8, RZ_ARRAY_SIZE(scale8));
+	mu_assert_true(riscv_switch_recover(buffer, sizeof(buffer), 0x1000, false, 0x1000, 0x101c, table_read, &table, &sw, NULL), "sh3add with ld");
+	mu_assert_eq(sw.table, 0x2000, "sh3add table");
+	rz_vector_fini(&targets);
+	mu_end;
+}
+
+static bool test_switch_relative(void) {
+	static const ut32 code[] = {
+		SLTIU(T0, A0, 3), /*     0x1000 */
+		BEQ(T0, 0, 0x20), /*     0x1004 index >= 3 goes to 0x1024 */
+		LUI(T1, 0x2), /*         0x1008 table at 0x2000 */
+		SH2ADD(A0, A0, T1), /*   0x100c */
+		LW(A1, A0, 0), /*        0x1010 */
+		ADD(A1, A1, T1), /*      0x1014 entries are offsets from the table */
+		JALR(0, A1, 0), /*       0x1018 */
+	};
+	static const ut8 data[] = {
+		0x28, 0xf0, 0xff, 0xff, /* 0x1028 */
+		0x30, 0xf0, 0xff, 0xff, /* 0x1030 */
+		0x00, 0x01, 0x00, 0x00, /* 0x2100 */
+	};
+	Table table = { data, sizeof(data) };
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+	RzVector targets;
+	rz_vector_init(&targets, sizeof(ut64), NULL, NULL);
+
+	RISCVSwitch sw;
+	mu_assert_true(riscv_switch_recover(buffer, sizeof(buffer), 0x1000, false, 0x1000, 0x1018, table_read, &table, &sw, &targets), "recover");
+	mu_assert_eq(sw.table, 0x2000, "table");
+	mu_assert_eq(sw.base, 0x2000, "base");
+	mu_assert_eq(sw.defval, 0x1024, "default");
+	mu_assert_eq(sw.n_cases, 3, "cases");
+	mu_assert_eq(sw.entry_size, 4, "entry size");
+	mu_assert_true(sw.relative, "relative");
+	static const ut64 expected[] = { 0x1028, 0x1030, 0x2100 };
+	mu_assert_eq(rz_vector_len(&targets), RZ_ARRAY_SIZE(expected), "targets");
+	for (ut32 i = 0; i < RZ_ARRAY_SIZE(expected); ++i) {
+		mu_assert_eq(*(ut64 *)rz_vector_index_ptr(&targets, i), expected[i], "sign extended offsets");
+	}
+
+	/* sh3add scales the index for 8 bytes entries */
+	const ut32 scale8[] = { SH3ADD(A0, A0, T1) };
+	put_code(buffer + 0xc, scale8, RZ_ARRAY_SIZE(scale8));
+	mu_assert_false(riscv_switch_recover(buffer, sizeof(buffer), 0x1000, false, 0x1000, 0x1018, table_read, &table, &sw, NULL), "sh3add with lw");
+	/* not an indirect jump */
+	mu_assert_false(riscv_switch_recover(buffer, sizeof(buffer), 0x1000, false, 0x1000, 0x1014, table_read, &table, &sw, NULL), "add");
+	rz_vector_fini(&targets);
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_switch_absolute);
+	mu_run_test(test_switch_relative);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)
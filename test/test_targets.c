@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_targets.h"
+#include "minunit.h"
+
+#define RA 1
+#define T1 6
+#define A0 10
+
+#define ENC_I(opcode, funct3, rd, rs1, imm) \
+	((((ut32)(imm) & 0xfff) << 20) | ((rs1) << 15) | ((funct3) << 12) | ((rd) << 7) | (opcode))
+#define ENC_B(funct3, rs1, rs2, imm) \
+	(((((ut32)(imm) >> 12) & 1) << 31) | ((((ut32)(imm) >> 5) & 0x3f) << 25) | ((rs2) << 20) | ((rs1) << 15) | \
+		((funct3) << 12) | ((((ut32)(imm) >> 1) & 0xf) << 8) | ((((ut32)(imm) >> 11) & 1) << 7) | 0x63)
+#define ENC_J(rd, imm) \
+	(((((ut32)(imm) >> 20) & 1) << 31) | ((((ut32)(imm) >> 1) & 0x3ff) << 21) | ((((ut32)(imm) >> 11) & 1) << 20) | \
+		((((ut32)(imm) >> 12) & 0xff) << 12) | ((rd) << 7) | 0x6f)
+
+#define ADDI(rd, rs1, imm)  ENC_I(0x13, 0, rd, rs1, imm)
+#define AUIPC(rd, imm)      (((ut32)(imm) << 12) | ((rd) << 7) | 0x17)
+#define JALR(rd, rs1, imm)  ENC_I(0x67, 0, rd, rs1, imm)
+#define BEQ(rs1, rs2, imm)  ENC_B(0, rs1, rs2, imm)
+#define JAL(rd, imm)        ENC_J(rd, imm)
+#define NOP                 ADDI(0, 0, 0)
+
+static void put_code(ut8 *buffer, const ut32 *code, ut32 n_insns) {
+	for (ut32 i = 0; i < n_insns; ++i) {
+		buffer[i * 4 + 0] = code[i] & 0xff;
+		buffer[i * 4 + 1] = (code[i] >> 8) & 0xff;
+		buffer[i * 4 + 2] = (code[i] >> 16) & 0xff;
+		buffer[i * 4 + 3] = code[i] >> 24;
+	}
+}
+
+/* more words than one step of the scan */
+static const ut32 code[] = {
+	BEQ(A0, 0, 8), /*        0x1000 -> 0x1008 */
+	JAL(RA, 0x100), /*       0x1004 -> 0x1104 */
+	JAL(0, -8), /*           0x1008 -> 0x1000 */
+	NOP, /*                  0x100c */
+	AUIPC(T1, 0x1), /*       0x1010 */
+	JALR(RA, T1, 0x11), /*   0x1014 -> 0x2021, jalr clears bit 0 */
+	JALR(0, 0, 0x7ff), /*    0x1018 -> 0x7fe */
+	NOP, /*                  0x101c */
+	NOP, /*                  0x1020 */
+	JAL(RA, 0xe0), /*        0x1024 -> 0x1104 again */
+};
+
+static bool test_targets_all(void) {
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+	RzVector targets;
+	rz_vector_init(&targets, sizeof(ut64), NULL, NULL);
+
+	ut32 count = riscv_targets_scan(buffer, sizeof(buffer), 0x1000, false, RISCV_TARGETS_ALL, &targets);
+	mu_assert_eq(count, 6, "targets found, duplicates included");
+	static const ut64 expected[] = { 0x7fe, 0x1000, 0x1008, 0x1104, 0x2020 };
+	mu_assert_eq(rz_vector_len(&targets), RZ_ARRAY_SIZE(expected), "sorted without duplicates");
+	for (ut32 i = 0; i < RZ_ARRAY_SIZE(expected); ++i) {
+		char message[64];
+		snprintf(message, sizeof(message), "target %u", i);
+		mu_assert_eq(*(ut64 *)rz_vector_index_ptr(&targets, i), expected[i], message);
+	}
+	rz_vector_fini(&targets);
+	mu_end;
+}
+
+static bool test_targets_kinds(void) {
+	ut8 buffer[sizeof(code)];
+	put_code(buffer, code, RZ_ARRAY_SIZE(code));
+	RzVector targets;
+	rz_vector_init(&targets, sizeof(ut64), NULL, NULL);
+
+	ut32 count = riscv_targets_scan(buffer, sizeof(buffer), 0x1000, false, RISCV_TARGETS_CALL, &targets);
+	mu_assert_eq(count, 3, "calls");
+	mu_assert_eq(rz_vector_len(&targets), 2, "call targets");
+	mu_assert_eq(*(ut64 *)rz_vector_index_ptr(&targets, 0), 0x1104, "jal");
+	mu_assert_eq(*(ut64 *)rz_vector_index_ptr(&targets, 1), 0x2020, "auipc+jalr");
+
+	/* the targets of the previous scan are kept and merged */
+	count = riscv_targets_scan(buffer, sizeof(buffer), 0x1000, false, RISCV_TARGETS_BRANCH, &targets);
+	mu_assert_eq(count, 1, "branches");
+	mu_assert_eq(rz_vector_len(&targets), 3, "merged targets");
+	mu_assert_eq(*(ut64 *)rz_vector_index_ptr(&targets, 0), 0x1008, "beq");
+
+	/* the auipc+jalr pair is cut by the end of the buffer */
+	rz_vector_clear(&targets);
+	count = riscv_targets_scan(buffer, 0x14, 0x1000, false, RISCV_TARGETS_CALL, &targets);
+	mu_assert_eq(count, 1, "truncated pair");
+	rz_vector_fini(&targets);
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_targets_all);
+	mu_run_test(test_targets_kinds);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2026 deroad <wargio@libero.it>
+// SPDX-License-Identifier: LGPL-3.0-only
+
+#include "riscv_vendor.h"
+#include "minunit.h"
+
+/* the less specific instruction is added first, the most specific one must win anyway */
+static const RISCVVendorInsn vendor_insns[] = {
+	{ "vx.any", 0x0000707f, 0x0000000b, RISCV_IMM_I, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1, "{rd}, {rs1}, {imm}" },
+	{ "vx.mac", 0xfe00707f, 0x0000000b, RISCV_IMM_NONE, RISCV_REGS_GPR_RD | RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, "{rd}, {rs1}, {rs2}" },
+	/* overrides the standard nop, the other addi encodings stay standard */
+	{ "vx.nop", 0xffffffff, 0x00000013, RISCV_IMM_NONE, 0, NULL },
+	{ "vx.br", 0x0000707f, 0x0000005b, RISCV_IMM_B, RISCV_REGS_GPR_RS1 | RISCV_REGS_GPR_RS2, "{rs1}, {rs2}, {target} {unknown}" },
+};
+
+static bool disassemble(const RISCVVendor *vendor, ut32 data, cchar *expected) {
+	ut8 buffer[4] = { data & 0xff, (data >> 8) & 0xff, (data >> 16) & 0xff, data >> 24 };
+	RzStrBuf sb;
+	rz_strbuf_init(&sb);
+	mu_assert_eq(riscv_vendor_disassembler(vendor, buffer, sizeof(buffer), 0x1000, false, &sb), 4, expected);
+	mu_assert_streq(rz_strbuf_get(&sb), expected, "vendor text");
+	rz_strbuf_fini(&sb);
+	mu_end;
+}
+
+static bool test_vendor_precedence(void) {
+	RISCVVendor *vendor = riscv_vendor_new();
+	mu_assert_notnull(vendor, "new vendor");
+	mu_assert_true(riscv_vendor_add(vendor, vendor_insns, RZ_ARRAY_SIZE(vendor_insns)), "add");
+	RISCVDecoded dec;
+	mu_assert_false(riscv_vendor_decode_word(vendor, 0x00c5850b, &dec), "not built yet");
+	mu_assert_true(riscv_vendor_decode_word(vendor, 0x00558513, &dec), "standard instructions before the build");
+	mu_assert_eq(dec.id, RISCV_INS_ADDI, "addi a0, a1, 5");
+	mu_assert_true(riscv_vendor_build(vendor), "build");
+
+	mu_assert_true(riscv_vendor_decode_word(vendor, 0x00c5850b, &dec), "funct7 0");
+	mu_assert_eq(dec.id, RISCV_INS_COUNT + 1, "the most specific instruction wins");
+	mu_assert_streq(riscv_vendor_mnemonic(vendor, dec.id), "vx.mac", "mnemonic");
+	mu_assert_true(riscv_vendor_decode_word(vendor, 0x1235850b, &dec), "funct7 9");
+	mu_assert_eq(dec.id, RISCV_INS_COUNT, "fallback on the less specific instruction");
+	mu_assert_eq(dec.imm, 0x123, "imm");
+
+	mu_assert_true(riscv_vendor_decode_word(vendor, 0x00000013, &dec), "nop");
+	mu_assert_eq(dec.id, RISCV_INS_COUNT + 2, "vendor instructions take precedence");
+	mu_assert_true(riscv_vendor_decode_word(vendor, 0x00150513, &dec), "addi");
+	mu_assert_eq(dec.id, RISCV_INS_ADDI, "standard instruction");
+	mu_assert_streq(riscv_vendor_mnemonic(vendor, dec.id), "addi", "standard mnemonic");
+	mu_assert_true(riscv_vendor_mnemonic(vendor, RISCV_INS_COUNT + RZ_ARRAY_SIZE(vendor_insns)) == NULL, "unknown id");
+
+	RISCVRegisters regs;
+	mu_assert_true(riscv_vendor_decode_word(vendor, 0x00c5850b, &dec), "vx.mac");
+	riscv_vendor_registers(vendor, &dec, &regs);
+	mu_assert_eq(regs.gpr_def, 1u << 10, "rd is a0");
+	mu_assert_eq(regs.gpr_use, (1u << 11) | (1u << 12), "rs1 and rs2 are a1 and a2");
+
+	if (!disassemble(vendor, 0x00c5850b, "vx.mac a0, a1, a2") ||
+		!disassemble(vendor, 0x1235850b, "vx.any a0, a1, 291") ||
+		!disassemble(vendor, 0x00000013, "vx.nop") ||
+		!disassemble(vendor, 0x00150513, "addi a0, a0, 1") ||
+		!disassemble(vendor, 0x00b5085b, "vx.br a0, a1, 0x1010 {unknown}")) {
+		riscv_vendor_free(vendor);
+		return false;
+	}
+	riscv_vendor_free(vendor);
+	mu_end;
+}
+
+static bool test_vendor_invalid(void) {
+	static const RISCVVendorInsn invalid[] = {
+		{ "vx.ok", 0x0000707f, 0x0000002b, RISCV_IMM_NONE, 0, NULL },
+		/* the major opcode must be checked */
+		{ "vx.bad", 0x00007000, 0x0000000b, RISCV_IMM_NONE, 0, NULL },
+	};
+	RISCVVendor *vendor = riscv_vendor_new();
+	mu_assert_notnull(vendor, "new vendor");
+	mu_assert_true(riscv_vendor_add(vendor, vendor_insns, 1), "add");
+	mu_assert_false(riscv_vendor_add(vendor, invalid, RZ_ARRAY_SIZE(invalid)), "invalid descriptor");
+	mu_assert_true(riscv_vendor_mnemonic(vendor, RISCV_INS_COUNT + 1) == NULL, "nothing added on failure");
+	mu_assert_true(riscv_vendor_add(vendor, invalid, 0), "empty add");
+	mu_assert_true(riscv_vendor_mnemonic(vendor, RISCV_INS_COUNT + 1) == NULL, "nothing added by an empty add");
+	mu_assert_true(riscv_vendor_build(vendor), "build");
+	RISCVDecoded dec;
+	mu_assert_false(riscv_vendor_decode_word(vendor, 0x0000002b, &dec), "vx.ok not added");
+	riscv_vendor_free(vendor);
+	mu_end;
+}
+
+static int all_tests(void) {
+	mu_run_test(test_vendor_precedence);
+	mu_run_test(test_vendor_invalid);
+	return mu_tests_failed;
+}
+
+mu_main(all_tests)